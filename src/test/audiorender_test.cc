@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+//  audiorender_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/audiorender.h"
+#include "yakc/yakc.h"
+#include "test/testemu.h"
+#include <string.h>
+
+using namespace YAKC;
+
+TEST(audiorender_events) {
+    audiorender r;
+    r.init(audiorender::sample_rate);
+    r.set_cpu_freq(1750);
+    sound_funcs snd = r.callbacks();
+    CHECK(snd.userdata == &r);
+
+    // silence before the first event
+    snd.stop(snd.userdata, 0, 0);
+    snd.stop(snd.userdata, 0, 1);
+    r.render(17500);
+    CHECK((r.num_frames() >= 441) && (r.num_frames() <= 442));
+    for (int i = 0; i < r.num_frames()*2; i++) {
+        CHECK(r.samples()[i] == 0);
+    }
+
+    // 441Hz on the left channel, right channel stays silent
+    snd.sound(snd.userdata, 17500, 0, 441);
+    const int start = r.num_frames();
+    r.render(35000);
+    CHECK((r.num_frames() >= 882) && (r.num_frames() <= 883));
+    int transitions = 0;
+    int16_t last = r.samples()[start*2];
+    for (int i = start; i < r.num_frames(); i++) {
+        const int16_t l = r.samples()[i*2];
+        const int16_t rt = r.samples()[i*2 + 1];
+        CHECK((l == 0x3FFF) || (l == -0x3FFF));
+        CHECK(rt == 0);
+        if (l != last) {
+            transitions++;
+            last = l;
+        }
+    }
+    // 4.41 periods in 441 samples, 2 transitions per period
+    CHECK((transitions >= 8) && (transitions <= 9));
+    CHECK(r.num_events == 3);
+
+    // stop again
+    snd.stop(snd.userdata, 35000, 0);
+    r.render(52500);
+    CHECK((r.num_frames() >= 1323) && (r.num_frames() <= 1324));
+    CHECK(r.samples()[(r.num_frames()-1)*2] == 0);
+
+    // buffer must not overflow
+    r.render(1750000 * 2);
+    CHECK(r.full());
+    CHECK(r.num_frames() == audiorender::sample_rate);
+}
+
+TEST(audiorender_volume) {
+    audiorender r;
+    r.init(audiorender::sample_rate);
+    r.set_cpu_freq(1750);
+    r.honor_volume = true;
+    sound_funcs snd = r.callbacks();
+
+    // the volume change takes effect at its cycle position, not immediately
+    snd.sound(snd.userdata, 0, 0, 441);
+    snd.volume(snd.userdata, 17500, 0);
+    r.render(35000);
+    CHECK((r.num_frames() >= 882) && (r.num_frames() <= 883));
+    bool loud = true;
+    bool silent = true;
+    for (int i = 0; i < 441; i++) {
+        loud &= (r.samples()[i*2] == 0x3FFF) || (r.samples()[i*2] == -0x3FFF);
+    }
+    for (int i = 442; i < r.num_frames(); i++) {
+        silent &= r.samples()[i*2] == 0;
+    }
+    CHECK(loud && silent);
+    CHECK(r.num_events == 2);
+}
+
+TEST(audiorender_overflow) {
+    audiorender r;
+    r.init(10);
+    r.set_cpu_freq(1750);
+    sound_funcs snd = r.callbacks();
+    r.render(1750);
+    CHECK(r.full());
+
+    // events which can't be rendered anymore must not overrun the queue
+    for (int i = 0; i < 300; i++) {
+        snd.sound(snd.userdata, 1750 + i, 0, 1000 + i);
+    }
+    CHECK(r.num_events == 300);
+    CHECK(r.num_dropped_events == 300 - 255);
+    CHECK(r.num_frames() == 10);
+}
+
+TEST(audiorender_wav) {
+    audiorender r;
+    r.init(100);
+    r.set_cpu_freq(1750);
+    sound_funcs snd = r.callbacks();
+    snd.sound(snd.userdata, 0, 1, 1000);
+    r.render(1750000);
+    CHECK(r.num_frames() == 100);
+    CHECK(r.wav_size() == audiorender::wav_header_size + 100*4);
+
+    ubyte wav[audiorender::wav_header_size + 100*4];
+    CHECK(r.write_wav(wav, 16) == 0);
+    CHECK(r.write_wav(wav, sizeof(wav)) == int(sizeof(wav)));
+    CHECK(memcmp(&wav[0], "RIFF", 4) == 0);
+    CHECK(memcmp(&wav[8], "WAVEfmt ", 8) == 0);
+    CHECK(memcmp(&wav[36], "data", 4) == 0);
+    // riff size, channels, sample rate, bits per sample, data size
+    CHECK(wav[4] == ((36 + 400) & 0xFF) && wav[5] == ((36 + 400)>>8));
+    CHECK(wav[22] == 2 && wav[23] == 0);
+    CHECK(wav[24] == 0x44 && wav[25] == 0xAC && wav[26] == 0 && wav[27] == 0);
+    CHECK(wav[34] == 16);
+    CHECK(wav[40] == 0x90 && wav[41] == 0x01);
+    // first sample: left silent, right high
+    CHECK(wav[44] == 0 && wav[45] == 0);
+    CHECK(wav[46] == 0xFF && wav[47] == 0x3F);
+}
+
+TEST(audiorender_kc85) {
+    // boot a KC85/3 headless and render its audio output
+    static yakc emu;
+    static audiorender r;
+    const int num_secs = 5;
+    r.init(audiorender::sample_rate * num_secs);
+    init_test_emu(emu, kc85_exp::none, r.callbacks());
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    r.set_cpu_freq(emu.board.clck.base_freq_khz);
+
+    const int frame_micro_secs = 1000000 / 60;
+    for (int i = 0; i < num_secs * 60; i++) {
+        emu.onframe(1, frame_micro_secs, 0, 0);
+        r.render(emu.kc85.abs_cycle_count);
+    }
+    CHECK(r.num_frames() >= (audiorender::sample_rate * num_secs) - audiorender::sample_rate/60);
+    CHECK(r.num_events > 0);
+    emu.poweroff();
+}
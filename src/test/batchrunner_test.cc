@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+//  batchrunner_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/batchrunner.h"
+#include "test/games.h"
+#include "test/testemu.h"
+#include <thread>
+
+using namespace YAKC;
+
+//------------------------------------------------------------------------------
+static void
+setup_emu(yakc& emu, void* /*userdata*/) {
+    init_test_emu(emu);
+}
+
+//------------------------------------------------------------------------------
+static bool
+same_results(const batchrunner::result* r0, const batchrunner::result* r1, int num) {
+    for (int i = 0; i < num; i++) {
+        if ((r0[i].reason != r1[i].reason) ||
+            (r0[i].pc != r1[i].pc) ||
+            (r0[i].cycles != r1[i].cycles) ||
+            (r0[i].screen_hash != r1[i].screen_hash)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+TEST(batchrunner) {
+    static const struct {
+        const ubyte* data;
+        int size;
+    } games[] = {
+        { dump_pengo, sizeof(dump_pengo) },
+        { dump_cave, sizeof(dump_cave) },
+        { dump_house, sizeof(dump_house) },
+        { dump_digger3, sizeof(dump_digger3) },
+    };
+    const int num_games = int(sizeof(games) / sizeof(games[0]));
+    static const uint64_t budgets[] = { 1000000, 5000000, 20000000 };
+    const int num_budgets = int(sizeof(budgets) / sizeof(budgets[0]));
+
+    // each game with different cycle budgets, with jobs of very
+    // different length to give the work stealing something to do
+    static batchrunner::job jobs[32];
+    // a job always has a cycle budget, even with other exit conditions
+    CHECK(jobs[0].max_cycles > 0);
+    int num_jobs = 0;
+    for (int b = 0; b < num_budgets; b++) {
+        for (int g = 0; g < num_games; g++) {
+            batchrunner::job& j = jobs[num_jobs++];
+            j.data = games[g].data;
+            j.size = games[g].size;
+            j.max_cycles = budgets[b];
+        }
+    }
+    // stop at the start address of a game
+    const int exit_pc_job = num_jobs;
+    {
+        batchrunner::job& j = jobs[num_jobs++];
+        j.data = dump_pengo;
+        j.size = sizeof(dump_pengo);
+        j.exit_pc = dump_pengo[21] | dump_pengo[22]<<8;
+        j.max_cycles = budgets[0];
+    }
+    // boot the OS until the screen doesn't change anymore
+    const int settle_job = num_jobs;
+    {
+        batchrunner::job& j = jobs[num_jobs++];
+        j.model = device::z1013_64;
+        j.os = os_rom::z1013_mon_a2;
+        j.settle_frames = 10;
+        j.max_cycles = 100000000;
+    }
+    {
+        batchrunner::job& j = jobs[num_jobs++];
+        j.model = device::z9001;
+        j.os = os_rom::z9001_os_1_2;
+        j.settle_frames = 10;
+        j.max_cycles = 100000000;
+    }
+    // a truncated program image
+    const int load_error_job = num_jobs;
+    {
+        batchrunner::job& j = jobs[num_jobs++];
+        j.data = dump_cave;
+        j.size = 1024;
+        j.max_cycles = budgets[0];
+    }
+
+    // run on a single worker, and on multiple workers
+    static batchrunner::result results1[32];
+    static batchrunner::result resultsN[32];
+    batchrunner runner1;
+    runner1.setup(1, setup_emu, nullptr);
+    CHECK(runner1.num_workers() == 1);
+    runner1.run(jobs, results1, num_jobs);
+    CHECK(runner1.num_steals == 0);
+    runner1.discard();
+    CHECK(!runner1.is_valid());
+
+    int num_threads = int(std::thread::hardware_concurrency());
+    if (num_threads < 4) {
+        num_threads = 4;
+    }
+    batchrunner runnerN;
+    runnerN.setup(num_threads, setup_emu, nullptr);
+    CHECK(runnerN.num_workers() == num_threads);
+    runnerN.run(jobs, resultsN, num_jobs);
+
+    // all jobs must have completed with identical results
+    CHECK(same_results(results1, resultsN, num_jobs));
+    for (int i = 0; i < num_jobs; i++) {
+        CHECK(results1[i].reason != batchrunner::exit_none);
+        CHECK(resultsN[i].worker >= 0);
+    }
+    for (int i = 0; i < num_budgets * num_games; i++) {
+        CHECK(results1[i].reason == batchrunner::exit_budget);
+        CHECK(results1[i].cycles >= jobs[i].max_cycles);
+    }
+    CHECK(results1[exit_pc_job].reason == batchrunner::exit_pc);
+    CHECK(results1[exit_pc_job].pc == jobs[exit_pc_job].exit_pc);
+    CHECK(results1[settle_job].reason == batchrunner::exit_settled);
+    CHECK(results1[settle_job + 1].reason == batchrunner::exit_settled);
+    CHECK(results1[load_error_job].reason == batchrunner::exit_load_error);
+
+    // a second run on the same workers must produce the same results
+    static batchrunner::result results2[32];
+    runnerN.run(jobs, results2, num_jobs);
+    CHECK(same_results(results1, results2, num_jobs));
+}
@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+//  bootcache_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/bootcache.h"
+#include "test/testemu.h"
+
+using namespace YAKC;
+
+static yakc emu;
+static bootcache cache;
+
+static void init_emu() {
+    static bool initialized = false;
+    if (!initialized) {
+        initialized = true;
+        init_test_emu(emu);
+    }
+    emu.boot_cache = &cache;
+}
+
+static void boot(device model, os_rom os) {
+    if (emu.switchedon()) {
+        emu.poweroff();
+    }
+    emu.poweron(model, os);
+}
+
+TEST(bootcache_kc85) {
+    init_emu();
+    cache.clear();
+
+    // first boot must capture, the boot frames aren't instrumented
+    emu.board.ops.reset();
+    emu.board.ops.enabled = true;
+    boot(device::kc85_3, os_rom::caos_3_1);
+    CHECK(cache.num_misses == 1);
+    CHECK(cache.num_hits == 0);
+    CHECK(cache.has(emu));
+    CHECK(emu.board.ops.enabled && (emu.board.ops.num_instructions() == 0));
+    emu.board.ops.enabled = false;
+    CHECK(emu.kc85.abs_cycle_count == 0);
+    const uint64_t irm_hash = hash(emu.kc85.video.irm, kc85_video::irm_size);
+    const uword pc = emu.board.cpu.PC;
+
+    // second boot must restore, and end up in the same state
+    boot(device::kc85_3, os_rom::caos_3_1);
+    CHECK(cache.num_misses == 1);
+    CHECK(cache.num_hits == 1);
+    CHECK(emu.kc85.abs_cycle_count == 0);
+    CHECK(irm_hash == hash(emu.kc85.video.irm, kc85_video::irm_size));
+    CHECK(pc == emu.board.cpu.PC);
+
+    // the restored system must keep running
+    for (int i = 0; i < 50; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    CHECK(emu.kc85.abs_cycle_count > 0);
+
+    // the hash covers the BASIC ROM which is actually mapped
+    const uint64_t h0 = bootcache::rom_hash(emu);
+    dump_basic_c0[0x100] ^= 0xFF;
+    CHECK(h0 != bootcache::rom_hash(emu));
+    dump_basic_c0[0x100] ^= 0xFF;
+    CHECK(h0 == bootcache::rom_hash(emu));
+
+    // a different module configuration must invalidate the entry
+    static ubyte rom[0x2000] = { 0x7F, 0x7F };
+    emu.kc85.exp.register_rom_module(kc85_exp::m026_forth, 0xC1, rom, sizeof(rom), "");
+    emu.kc85.exp.insert_module(0x08, kc85_exp::m026_forth);
+    CHECK(h0 != bootcache::rom_hash(emu));
+    CHECK(!cache.has(emu));
+    boot(device::kc85_3, os_rom::caos_3_1);
+    CHECK(cache.num_misses == 2);
+    emu.kc85.exp.remove_module(0x08, emu.board.cpu.mem);
+    emu.kc85.exp.insert_module(0x08, kc85_exp::none);
+    CHECK(h0 == bootcache::rom_hash(emu));
+    CHECK(cache.has(emu));
+    emu.poweroff();
+}
+
+TEST(bootcache_z1013_z9001) {
+    init_emu();
+    cache.clear();
+    cache.num_hits = cache.num_misses = 0;
+    boot(device::z1013_64, os_rom::none);
+    CHECK(cache.has(emu));
+    CHECK(emu.cycle_count() == 0);
+    boot(device::z9001, os_rom::z9001_os_1_2);
+    CHECK(cache.has(emu));
+    CHECK(emu.cycle_count() == 0);
+    CHECK(cache.num_misses == 2);
+    boot(device::z1013_64, os_rom::none);
+    CHECK(emu.cycle_count() == 0);
+    boot(device::z9001, os_rom::z9001_os_1_2);
+    CHECK(emu.cycle_count() == 0);
+    CHECK(cache.num_misses == 2);
+    CHECK(cache.num_hits == 2);
+    CHECK(emu.z9001.on);
+
+    // a boot which doesn't settle isn't cached, but also starts at cycle 0
+    cache.clear();
+    const int max_frames = cache.max_frames;
+    cache.max_frames = 5;
+    boot(device::z1013_64, os_rom::none);
+    CHECK(!cache.has(emu));
+    CHECK(emu.cycle_count() == 0);
+    cache.max_frames = max_frames;
+    emu.poweroff();
+    emu.boot_cache = nullptr;
+    cache.clear();
+}
@@ -0,0 +1,242 @@
+//------------------------------------------------------------------------------
+//  callgraph_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/yakc.h"
+#include "yakc/snapshot.h"
+#include "yakc/z80bus.h"
+#include "yakc/z80int.h"
+
+using namespace YAKC;
+
+static ubyte ram[0x10000];
+
+static void run(z80& cpu, callgraph& calls, uword pc) {
+    cpu.PC = pc;
+    cpu.HALT = false;
+    while (!cpu.HALT) {
+        const uword pc = cpu.PC;
+        calls.record(cpu, pc, cpu.step());
+    }
+}
+
+TEST(callgraph) {
+    static z80bus bus;
+    static z80 cpu;
+    memset(ram, 0, sizeof(ram));
+    cpu.mem.map(0, 0x0000, sizeof(ram), ram, true);
+    cpu.init(&bus);
+    ubyte prog[] = {
+        0x31, 0x00, 0x80,   // LD SP,0x8000
+        0xCD, 0x10, 0x00,   // CALL outer
+        0xCD, 0x20, 0x00,   // CALL inner
+        0x76,               // HALT
+    };
+    ubyte outer[] = {
+        0xCD, 0x20, 0x00,   // CALL inner
+        0xC9,               // RET
+    };
+    ubyte inner[] = {
+        0x00,               // NOP
+        0xC9,               // RET
+    };
+    cpu.mem.write(0x0000, prog, sizeof(prog));
+    cpu.mem.write(0x0010, outer, sizeof(outer));
+    cpu.mem.write(0x0020, inner, sizeof(inner));
+
+    callgraph calls;
+    calls.enabled = true;
+    run(cpu, calls, 0x0000);
+    CHECK(calls.depth() == 0);
+    CHECK(calls.num_nodes() == 4);
+    CHECK(calls.total_cycles() == 10 + 17 + 17 + 4 + 27 + 14 + 14);
+
+    CHECK(calls.analyze() == 2);
+    const callgraph::target& t0 = calls.get_target(0);
+    const callgraph::target& t1 = calls.get_target(1);
+    CHECK((t0.addr == 0x0010) && (t0.count == 1) && (t0.incl_cycles == 27 + 14) && (t0.excl_cycles == 27));
+    CHECK((t1.addr == 0x0020) && (t1.count == 2) && (t1.incl_cycles == 28) && (t1.excl_cycles == 28));
+    CHECK(!t0.irq && (t0.func == callgraph::no_func));
+
+    // folded stacks with symbol names
+    symbols syms;
+    const char* sym_text = "outer: equ 0010h\n0x0020 inner ; comment\n";
+    CHECK(syms.load(sym_text, int(strlen(sym_text))) == 2);
+    snapshot::membuf buf;
+    CHECK(calls.save_folded(snapshot::membuf::write, &buf, &syms));
+    const char* folded = "(top) 48\nouter 27\nouter;inner 14\ninner 14\n";
+    CHECK((buf.size == int(strlen(folded))) && (0 == memcmp(buf.ptr, folded, buf.size)));
+    buf.discard();
+
+    // a function which drops its return address and jumps, the next
+    // call at the same stack position replaces it
+    ubyte prog2[] = {
+        0x31, 0x00, 0x80,   // LD SP,0x8000
+        0xCD, 0x30, 0x00,   // CALL 0x0030
+        0x76,               // HALT
+    };
+    ubyte drop[] = {
+        0xE1,               // POP HL
+        0xC3, 0x40, 0x00,   // JP 0x0040
+    };
+    ubyte cont[] = {
+        0xCD, 0x20, 0x00,   // CALL inner
+        0x76,               // HALT
+    };
+    cpu.mem.write(0x0100, prog2, sizeof(prog2));
+    cpu.mem.write(0x0030, drop, sizeof(drop));
+    cpu.mem.write(0x0040, cont, sizeof(cont));
+    calls.reset();
+    run(cpu, calls, 0x0100);
+    CHECK(calls.depth() == 0);
+    CHECK(calls.analyze() == 2);
+    CHECK((calls.get_target(0).addr == 0x0030) && (calls.get_target(0).incl_cycles == 10 + 10 + 17));
+    CHECK((calls.get_target(1).addr == 0x0020) && (calls.get_target(1).incl_cycles == 14));
+
+    calls.discard();
+    CHECK(calls.num_nodes() == 0);
+    CHECK(!calls.enabled);
+}
+
+TEST(callgraph_symbols) {
+    symbols syms;
+    const char* text =
+        "CRT     EQU 0F003H\n"
+        "KBD:    equ $E0F7\r\n"
+        "E1A4    PADR\n"
+        "0xE000  CAOS_INIT   ; the entry\n"
+        "; a comment line\n"
+        "LOOP = #0200\n"
+        "not a symbol line\n"
+        "ADDR\n";
+    CHECK(syms.load(text, int(strlen(text))) == 5);
+    CHECK(syms.size() == 5);
+    CHECK(0 == strcmp(syms.lookup(0xF003), "CRT"));
+    CHECK(0 == strcmp(syms.lookup(0xE0F7), "KBD"));
+    CHECK(0 == strcmp(syms.lookup(0xE1A4), "PADR"));
+    CHECK(0 == strcmp(syms.lookup(0xE000), "CAOS_INIT"));
+    CHECK(0 == strcmp(syms.lookup(0x0200), "LOOP"));
+    CHECK(syms.lookup(0x1234) == nullptr);
+    syms.add(0xE000, "INIT");
+    CHECK(0 == strcmp(syms.lookup(0xE000), "INIT"));
+    CHECK(syms.size() == 5);
+
+    char name[64];
+    callgraph::target_name(&syms, 0xF003, 0x24, false, name, sizeof(name));
+    CHECK(0 == strcmp(name, "CRT#24"));
+    callgraph::target_name(&syms, 0x1234, callgraph::no_func, true, name, sizeof(name));
+    CHECK(0 == strcmp(name, "irq:1234"));
+    syms.clear();
+    CHECK(syms.size() == 0);
+}
+
+class irqTestBus : public z80bus {
+public:
+    z80 cpu;
+    virtual void irq() override {
+        cpu.irq();
+    }
+};
+
+TEST(callgraph_irq) {
+    static irqTestBus bus;
+    z80& cpu = bus.cpu;
+    memset(ram, 0, sizeof(ram));
+    cpu.mem.map(0, 0x0000, sizeof(ram), ram, true);
+    cpu.IM = 0x02;
+    cpu.I = 0x01;
+    ubyte prog[] = {
+        0x31, 0x00, 0x80,   // LD SP,0x8000
+        0xFB,               // EI
+        0x00, 0x00, 0x00,   // 3x NOP
+        0x76,               // HALT
+    };
+    ubyte handler[] = {
+        0x00,               // NOP
+        0xFB,               // EI
+        0xED, 0x4D,         // RETI
+    };
+    cpu.mem.write(0x0000, prog, sizeof(prog));
+    cpu.mem.write(0x0010, handler, sizeof(handler));
+    cpu.mem.w16(0x01E0, 0x0010);
+    z80int dev;
+    cpu.connect_irq_device(&dev);
+
+    callgraph calls;
+    calls.enabled = true;
+    calls.begin_run(cpu);
+    while (!cpu.HALT) {
+        if (cpu.PC == 0x0005) {
+            dev.request_interrupt(&bus, 0xE0);
+        }
+        const uword pc = cpu.PC;
+        calls.record(cpu, pc, cpu.step());
+        cpu.handle_irq();
+    }
+    calls.end_run(cpu);
+    CHECK(cpu.irq_trap == nullptr);
+    CHECK(calls.depth() == 0);
+    CHECK(calls.analyze() == 1);
+    const callgraph::target& t = calls.get_target(0);
+    CHECK((t.addr == 0x0010) && t.irq && (t.count == 1));
+    CHECK((t.excl_cycles > 0) && (t.incl_cycles == t.excl_cycles));
+
+    snapshot::membuf buf;
+    CHECK(calls.save_folded(snapshot::membuf::write, &buf, nullptr));
+    const char* folded = "irq:0010 ";
+    CHECK((buf.size > 0) && (nullptr != strstr((const char*)buf.ptr, folded)));
+    buf.discard();
+}
+
+TEST(callgraph_kc85) {
+    static yakc emu;
+    emu.init(ext_funcs(), sound_funcs());
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    CHECK(emu.board.calls.dispatch_addr == 0xF003);
+    for (int i = 0; i < 100; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+
+    // call a CAOS system function through the PV1 dispatcher
+    ubyte prog[] = {
+        0x3E, 0x41,         // LD A,'A'
+        0xCD, 0x03, 0xF0,   // CALL 0F003H
+        0x00,               // DB 0 (CRT)
+        0x18, 0xFE,         // JR $
+    };
+    z80& cpu = emu.board.cpu;
+    cpu.mem.write(0x0200, prog, sizeof(prog));
+    cpu.PC = 0x0200;
+
+    // the call graph sees the same T-states as the profiler
+    callgraph& calls = emu.board.calls;
+    profiler& prof = emu.board.prof;
+    calls.enabled = true;
+    prof.enabled = true;
+    for (int i = 0; i < 2; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    calls.enabled = false;
+    prof.enabled = false;
+    CHECK(cpu.irq_trap == nullptr);
+    CHECK(calls.total_cycles() == prof.total_cycles());
+
+    const int num_targets = calls.analyze();
+    CHECK(num_targets > 1);
+    bool has_func = false;
+    bool ok = true;
+    for (int i = 0; i < num_targets; i++) {
+        const callgraph::target& t = calls.get_target(i);
+        if ((t.addr == 0xF003) && (t.func == 0x00) && (t.count == 1)) {
+            has_func = true;
+        }
+        ok &= (t.incl_cycles >= t.excl_cycles);
+    }
+    CHECK(has_func);
+    CHECK(ok);
+    calls.discard();
+    prof.discard();
+    emu.poweroff();
+}
@@ -0,0 +1,169 @@
+//------------------------------------------------------------------------------
+//  coverage_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/yakc.h"
+#include "yakc/snapshot.h"
+#include "yakc/z80bus.h"
+
+using namespace YAKC;
+
+TEST(coverage) {
+    static z80bus bus;
+    static z80 cpu;
+    static ubyte rom[0x0400];
+    static ubyte ram[0x0400];
+    memset(rom, 0, sizeof(rom));
+    memset(ram, 0, sizeof(ram));
+    ubyte prog[] = {
+        0x3A, 0x00, 0x40,           // LD A,(4000h)
+        0x21, 0x10, 0x00,           // LD HL,0010h
+        0x46,                       // LD B,(HL)
+        0x32, 0x01, 0x40,           // LD (4001h),A
+        0x76,                       // HALT
+    };
+    memcpy(rom, prog, sizeof(prog));
+    rom[0x10] = 0x55;
+    cpu.mem.map(0, 0x0000, sizeof(rom), rom, false);
+    cpu.mem.map(0, 0x4000, sizeof(ram), ram, true);
+    cpu.init(&bus);
+
+    static coverage cov;
+    cov.add_bank("rom", 0x0000, rom, sizeof(rom));
+    cov.add_bank("ram", 0x4000, ram, sizeof(ram));
+    CHECK(cov.num_banks() == 2);
+    CHECK((0 == strcmp(cov.bank_name(1), "ram")) && (cov.bank_addr(1) == 0x4000) && (cov.bank_size(1) == 0x400));
+
+    // nothing is recorded when disabled
+    cov.begin_run(cpu);
+    CHECK(cpu.mem.cov == nullptr);
+    cov.enabled = true;
+    cov.begin_run(cpu);
+    CHECK(cpu.mem.cov == &cov);
+    CHECK(!cpu.mem.is_writable(0x4000));
+    while (!cpu.HALT) {
+        cpu.step();
+    }
+    cov.end_run(cpu);
+    CHECK(cpu.mem.cov == nullptr);
+    CHECK(cpu.mem.is_writable(0x4000));
+    CHECK((ram[1] == 0) && (cpu.B == 0x55));
+
+    // opcodes and operands are executed, the other accesses are data
+    CHECK(cov.get(0, 0x0000) == coverage::exec);
+    CHECK(cov.get(0, 0x0002) == coverage::exec);
+    CHECK(cov.get(0, 0x000A) == coverage::exec);
+    CHECK(cov.get(0, 0x000B) == 0);
+    CHECK(cov.get(0, 0x0010) == coverage::read);
+    CHECK(cov.find(&ram[0]) == coverage::read);
+    CHECK(cov.find(&ram[1]) == coverage::write);
+    CHECK(cov.find(&prog[0]) == 0);
+    CHECK(cov.count(0, coverage::exec) == 11);
+
+    // the discovered regions
+    snapshot::membuf buf;
+    CHECK(cov.save(snapshot::membuf::write, &buf));
+    buf.write(&buf, "", 1);
+    const char* text =
+        "# rom 0000-03FF: 11 executed, 1 read, 0 written\n"
+        "rom 0000 000A code\n"
+        "rom 0010 0010 data\n"
+        "# ram 4000-43FF: 0 executed, 1 read, 1 written\n"
+        "ram 4000 4000 data\n";
+    CHECK(0 == strcmp((const char*)buf.ptr, text));
+    buf.discard();
+
+    cov.reset();
+    CHECK(cov.count(0, coverage::exec) == 0);
+    cov.clear_banks();
+    CHECK(cov.num_banks() == 0);
+}
+
+TEST(coverage_systems) {
+    static yakc emu;
+    emu.init(ext_funcs(), sound_funcs());
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    coverage& cov = emu.board.cov;
+    cov.enabled = true;
+
+    // the KC85/3 boots in the CAOS ROM
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    CHECK(cov.num_banks() == 3);
+    CHECK(0 == strcmp(cov.bank_name(2), "caos_e"));
+    for (int i = 0; i < 150; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    CHECK(emu.board.cpu.mem.cov == nullptr);
+    CHECK(cov.count(2, coverage::exec) > 256);
+    CHECK(cov.get(2, 0x1000) & coverage::exec);         // power-on at F000
+    CHECK(cov.count(0, coverage::write) > 0);
+    snapshot::membuf buf;
+    CHECK(cov.save(snapshot::membuf::write, &buf));
+    buf.write(&buf, "", 1);
+    CHECK(nullptr != strstr((const char*)buf.ptr, "caos_e F000 "));
+    buf.discard();
+    emu.poweroff();
+    CHECK(cov.num_banks() == 0);
+
+    // the Z1013 monitor and the Z9001 OS
+    emu.poweron(device::z1013_64, os_rom::none);
+    CHECK((cov.num_banks() == 2) && (0 == strcmp(cov.bank_name(1), "mon_a2")));
+    for (int i = 0; i < 50; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    CHECK(cov.count(1, coverage::exec) > 0);
+    emu.poweroff();
+    emu.poweron(device::z9001, os_rom::z9001_os_1_2);
+    CHECK(cov.num_banks() == 4);
+    for (int i = 0; i < 50; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    CHECK(cov.count(2, coverage::exec) + cov.count(3, coverage::exec) > 0);
+    emu.poweroff();
+    cov.enabled = false;
+}
+
+TEST(coverage_block) {
+    static yakc emu;
+    emu.init(ext_funcs(), sound_funcs());
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    const ubyte prog[] = {
+        0xF3,                       // DI
+        0x21, 0x00, 0x10,           // LD HL,1000h
+        0x01, 0x00, 0x02,           // LD BC,0200h
+        0x3E, 0xAA,                 // LD A,AAh
+        0xED, 0xB1,                 // CPIR
+        0x21, 0x00, 0xE0,           // LD HL,E000h
+        0x11, 0x00, 0x20,           // LD DE,2000h
+        0x01, 0x00, 0x01,           // LD BC,0100h
+        0xED, 0xB0,                 // LDIR
+        0x18, 0xFE,                 // JR $
+    };
+    emu.board.cpu.mem.write(0x0200, prog, sizeof(prog));
+    memset(&emu.kc85.ram[0][0x1000], 0, 0x200);
+
+    // block instructions don't run in bulk while recording the coverage
+    coverage& cov = emu.board.cov;
+    cov.reset();
+    cov.enabled = true;
+    emu.board.cpu.PC = 0x0200;
+    emu.onframe(1, 20000, 0, 0);
+    cov.enabled = false;
+    CHECK(emu.board.cpu.PC == 0x0216);
+    CHECK((0 == strcmp(cov.bank_name(0), "ram")) && (0 == strcmp(cov.bank_name(2), "caos_e")));
+    bool valid = true;
+    for (int i = 0; i < 0x200; i++) {
+        valid &= cov.get(0, 0x1000 + i) == coverage::read;
+    }
+    for (int i = 0; i < 0x100; i++) {
+        valid &= cov.get(2, i) == coverage::read;
+        valid &= cov.get(0, 0x2000 + i) == coverage::write;
+    }
+    CHECK(valid);
+    CHECK(cov.get(0, 0x11FF) == coverage::read);
+    CHECK(cov.get(0, 0x1200) == 0);
+    emu.poweroff();
+}
@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+//  forkpoint_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/forkpoint.h"
+#include "test/testemu.h"
+
+using namespace YAKC;
+
+static void run(yakc& emu, int num_frames) {
+    for (int i = 0; i < num_frames; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+}
+
+TEST(forkpoint) {
+    static yakc parent;
+    static yakc child0;
+    static yakc child1;
+    init_test_emu(parent, kc85_exp::m022_16kbyte);
+    init_test_emu(child0, kc85_exp::m022_16kbyte);
+    init_test_emu(child1, kc85_exp::m022_16kbyte);
+    parent.poweron(device::kc85_3, os_rom::caos_3_1);
+    run(parent, 100);
+
+    static forkpoint fp;
+    fp.capture(parent);
+    CHECK(fp.valid());
+    const uint64_t h0 = test_state_hash(parent);
+    const ubyte b0 = parent.board.cpu.mem.r8(0x0200);
+    const uword pc0 = parent.board.cpu.PC;
+
+    // the parent can continue running, and writing to its memory
+    run(parent, 10);
+    parent.board.cpu.mem.w8(0x0200, b0 + 1);
+
+    // clone into a switched-off emulator
+    fp.clone(child0);
+    CHECK(child0.kc85.on && child0.is_device(device::kc85_3));
+    // 16 KByte system RAM and 16 KByte module RAM are shared
+    CHECK(child0.board.cpu.mem.num_shared_pages() == 32);
+    CHECK(child0.board.cpu.mem.r8(0x0200) == b0);
+    CHECK(child0.board.cpu.PC == pc0);
+
+    // running the clone only copies the pages it writes to
+    run(child0, 50);
+    const int num_shared = child0.board.cpu.mem.num_shared_pages();
+    CHECK((num_shared > 0) && (num_shared < 32));
+    child0.board.cpu.mem.w8(0x0200, b0 + 2);
+    CHECK(child0.board.cpu.mem.r8(0x0200) == ubyte(b0 + 2));
+
+    // a second clone must start from the captured state, and end up
+    // in the same state as the first after running the same frames
+    fp.clone(child1);
+    CHECK(h0 == test_state_hash(child1));
+    CHECK(child1.board.cpu.mem.num_shared_pages() == 0);
+    fp.clone(child1);
+    run(child1, 50);
+    child1.board.cpu.mem.w8(0x0200, b0 + 2);
+    CHECK(test_state_hash(child0) == test_state_hash(child1));
+
+    // re-cloning into the same instance
+    for (int i = 0; i < 100; i++) {
+        fp.clone(child1);
+    }
+    CHECK(h0 == test_state_hash(child1));
+
+    // recapturing a clone only copies the pages it wrote to, the other
+    // pages stay shared
+    fp.clone(child1);
+    run(child1, 10);
+    child1.board.cpu.mem.w8(0x0200, b0 + 3);
+    const int num_clean = child1.board.cpu.mem.num_shared_pages();
+    CHECK((num_clean > 0) && (num_clean < 32));
+    fp.capture(child1);
+    CHECK(child1.board.cpu.mem.num_shared_pages() == num_clean);
+    fp.clone(child0);
+    CHECK(child0.board.cpu.mem.r8(0x0200) == ubyte(b0 + 3));
+    CHECK(test_state_hash(child0) == test_state_hash(child1));
+
+    // switching a clone off ends sharing
+    fp.clone(child1);
+    child1.poweroff();
+    CHECK(child1.board.cpu.mem.num_shared_pages() == 0);
+    child0.poweroff();
+    parent.poweroff();
+    fp.discard();
+    CHECK(!fp.valid());
+}
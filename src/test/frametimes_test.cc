@@ -0,0 +1,143 @@
+//------------------------------------------------------------------------------
+//  frametimes_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/yakc.h"
+#include "yakc/snapshot.h"
+
+using namespace YAKC;
+
+static void spin(uint64_t ns) {
+    const uint64_t start = frametimes::now();
+    while ((frametimes::now() - start) < ns) {
+        // busy wait
+    }
+}
+
+TEST(frametimes) {
+    static frametimes times;
+    times.reset();
+
+    // nothing is measured when disabled
+    times.begin(frametimes::cpu);
+    times.end();
+    times.next_frame();
+    CHECK(times.num_frames() == 0);
+
+    // nested sections only get their exclusive time
+    times.enabled = true;
+    const uint64_t start = frametimes::now();
+    times.begin(frametimes::cpu);
+    spin(2000000);
+    times.begin(frametimes::video);
+    spin(1000000);
+    times.end();
+    times.end();
+    const uint64_t elapsed = frametimes::now() - start;
+    times.next_frame();
+    CHECK(times.num_frames() == 1);
+    const uint64_t cpu_ns = times.get_ns(0, frametimes::cpu);
+    const uint64_t video_ns = times.get_ns(0, frametimes::video);
+    CHECK(cpu_ns >= 2000000);
+    CHECK(video_ns >= 1000000);
+    CHECK((cpu_ns + video_ns) <= elapsed);
+    CHECK(times.get_calls(0, frametimes::cpu) == 1);
+    CHECK(times.get_calls(0, frametimes::video) == 1);
+    CHECK(times.get_calls(0, frametimes::audio) == 0);
+
+    // sampled sections count all calls
+    times.begin(frametimes::cpu);
+    for (int i = 0; i < 4 * frametimes::sample_interval; i++) {
+        const bool timed = times.sample(frametimes::clocks);
+        if (timed) {
+            times.begin(frametimes::clocks);
+        }
+        if (timed) {
+            times.end();
+        }
+    }
+    times.end();
+    times.next_frame();
+    CHECK(times.num_frames() == 2);
+    CHECK(times.get_calls(0, frametimes::clocks) == 4 * frametimes::sample_interval);
+    CHECK(times.get_calls(1, frametimes::video) == 1);
+
+    // the history is a ring
+    for (int i = 0; i < frametimes::history_size + 5; i++) {
+        times.next_frame();
+    }
+    CHECK(times.num_frames() == frametimes::history_size);
+    CHECK(times.get_calls(0, frametimes::cpu) == 0);
+    times.reset();
+    CHECK(times.num_frames() == 0);
+    CHECK(0 == strcmp(frametimes::section_name(frametimes::snapshot), "snapshot"));
+}
+
+TEST(frametimes_trace) {
+    static frametimes times;
+    times.enabled = true;
+    times.start_capture(4);
+    CHECK(times.capturing());
+    times.begin(frametimes::cpu);
+    times.begin(frametimes::banks);
+    times.end();
+    times.end();
+    times.next_frame();
+    times.begin(frametimes::render);
+    times.end();
+    times.begin(frametimes::ui);
+    times.end();
+    times.stop_capture();
+    CHECK(!times.capturing());
+    CHECK(times.num_events() == 4);
+
+    // Chrome trace JSON: banks ends first, then cpu and the frame marker
+    snapshot::membuf buf;
+    CHECK(times.save_trace(snapshot::membuf::write, &buf));
+    buf.write(&buf, "", 1);
+    const char* json = (const char*) buf.ptr;
+    const char* head = "{\"traceEvents\":[\n{\"name\":\"banks\",\"cat\":\"yakc\",\"ph\":\"X\"";
+    CHECK(0 == strncmp(json, head, strlen(head)));
+    const char* cpu = strstr(json, "\"name\":\"cpu\"");
+    const char* frame = strstr(json, "\"name\":\"frame\"");
+    const char* render = strstr(json, "\"name\":\"render\"");
+    CHECK(cpu && frame && render && (cpu < frame) && (frame < render));
+    CHECK(nullptr == strstr(json, "\"name\":\"ui\""));
+    CHECK(nullptr != strstr(json, "}\n],\"displayTimeUnit\":\"ms\"}\n"));
+    buf.discard();
+}
+
+TEST(frametimes_kc85) {
+    static yakc emu;
+    emu.init(ext_funcs(), sound_funcs());
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    for (int i = 0; i < 10; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+
+    // the emulator subsystems are measured inside onframe()
+    frametimes& times = emu.board.times;
+    times.reset();
+    times.enabled = true;
+    for (int i = 0; i < 10; i++) {
+        emu.onframe(1, 20000, 0, 0);
+        times.next_frame();
+    }
+    times.enabled = false;
+    CHECK(times.num_frames() == 10);
+    bool valid = true;
+    for (int i = 0; i < 10; i++) {
+        valid &= times.get_calls(i, frametimes::cpu) == 1;
+        valid &= times.get_ns(i, frametimes::cpu) > 0;
+        // one video decoder call per PAL line
+        valid &= (times.get_calls(i, frametimes::video) >= 300) && (times.get_calls(i, frametimes::video) <= 320);
+        valid &= times.get_calls(i, frametimes::clocks) > 1000;
+        valid &= times.get_calls(i, frametimes::snapshot) == 1;
+        valid &= times.get_calls(i, frametimes::render) == 0;
+    }
+    CHECK(valid);
+    CHECK(times.average_ns(frametimes::cpu) > 0);
+    emu.poweroff();
+}
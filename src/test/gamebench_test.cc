@@ -0,0 +1,343 @@
+//------------------------------------------------------------------------------
+//  gamebench_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/movie.h"
+#include "test/games.h"
+#include "test/testemu.h"
+#include "Core/Time/Clock.h"
+#include <string.h>
+#include <inttypes.h>
+
+/*
+Replay-driven benchmarks of real KC85/3 games, running in the headless
+emulator core. Each game is loaded into RAM and started like the
+FileLoader in the app does, then a scripted play session is recorded
+into a movie, and the movie is replayed while measuring the host time.
+
+After each frame, the video output (kc85_video::rgba8_buffer) and the
+memory banks are hashed. The per-frame hashes of the replay must match
+the recorded session, and the hashes chained over all frames are checked
+against known-good values at checkpoints, so that any optimization of the
+CPU, memory or video emulation which changes behaviour is detected
+(and roughly located). If a change is intended to alter emulation
+results, update the checkpoint hashes with the values printed by the
+test.
+
+The instruction mix of each session is counted while recording (so it
+doesn't affect the measured replay time), and the most frequently
+executed instructions are printed after the timing results.
+*/
+
+using namespace YAKC;
+using namespace Oryol;
+
+// a key pressed at a frame number for a number of frames
+struct keypress {
+    int frame;
+    ubyte key;
+    int num_frames;
+};
+
+// a benchmark session
+struct session {
+    const char* name;
+    const ubyte* data;
+    int size;
+    const keypress* keys;
+    int num_keys;
+    int num_frames;
+    const uint64_t* checkpoints;    // chained hash every checkpoint_interval frames
+};
+static const int checkpoint_interval = 500;
+static const int max_frames = 4000;
+static const int boot_frames = 150;
+static const int num_top_ops = 12;
+
+// KC85 key codes
+static const ubyte key_enter = 0x0D;
+static const ubyte key_space = 0x20;
+static const ubyte key_left = 0x08;
+static const ubyte key_right = 0x09;
+static const ubyte key_down = 0x0A;
+static const ubyte key_up = 0x0B;
+
+static yakc emu;
+static movie mv;
+static uint64_t frame_hashes[max_frames];
+
+//------------------------------------------------------------------------------
+static void
+init_emu() {
+    static bool initialized = false;
+    if (!initialized) {
+        initialized = true;
+        init_test_emu(emu);
+    }
+    if (emu.switchedon()) {
+        emu.poweroff();
+    }
+}
+
+//------------------------------------------------------------------------------
+//  load a KCC or TAP file into memory and start it (see FileLoader)
+//
+static void
+load_and_start(const ubyte* data, int size) {
+    const bool is_tap = 0xC3 == data[0];
+    const ubyte* hdr = is_tap ? data + 17 : data;
+    const uword load_addr = hdr[17] | hdr[18]<<8;
+    const uword end_addr = hdr[19] | hdr[20]<<8;
+    const uword exec_addr = hdr[21] | hdr[22]<<8;
+    const ubyte* ptr = hdr + 128;
+    z80& cpu = emu.board.cpu;
+    uword addr = load_addr;
+    while (addr < end_addr) {
+        if (is_tap) {
+            // skip TAP block lead byte
+            ptr++;
+        }
+        for (int i = 0; (i < 128) && (addr < end_addr); i++) {
+            YAKC_ASSERT(ptr < (data + size));
+            cpu.mem.w8(addr++, *ptr++);
+        }
+    }
+    // same patch as FileLoader, otherwise the playfield is broken
+    if (0 == memcmp(hdr, "DIGGER  COM\x01", 12)) {
+        cpu.mem.w16(0x09AA, 0x0160);
+        cpu.mem.w8(0x3d3a, 0xB5);
+    }
+    cpu.A = 0x00;
+    cpu.F = 0x10;
+    cpu.BC = cpu.BC_ = 0x0000;
+    cpu.DE = cpu.DE_ = 0x0000;
+    cpu.HL = cpu.HL_ = 0x0000;
+    cpu.AF_ = 0x0000;
+    cpu.SP = 0x01C2;
+    for (uword a = 0xb200; a < 0xb700; a++) {
+        cpu.mem.w8(a, 0);
+    }
+    cpu.mem.w8(0xb7a0, 0);
+    cpu.out(0x89, 0x9f);
+    cpu.mem.w16(cpu.SP, 0xf15c);
+    cpu.PC = exec_addr;
+}
+
+//------------------------------------------------------------------------------
+static uint64_t
+frame_hash() {
+    uint64_t h = hash(emu.kc85.video.rgba8_buffer, kc85_video::rgba8_buffer_size);
+    snapshot::bank_t banks[snapshot::max_banks];
+    const int num_banks = snapshot::enumerate_banks(emu, banks, snapshot::max_banks);
+    for (int i = 0; i < num_banks; i++) {
+        h = hash(banks[i].ptr, banks[i].size, h);
+    }
+    return h;
+}
+
+//------------------------------------------------------------------------------
+static void
+print_opstats(const char* name) {
+    opstats& ops = emu.board.ops;
+    const int num_entries = ops.analyze();
+    const uint64_t total = ops.num_instructions();
+    printf("  %s: %" PRIu64 " instructions, %d opcodes\n", name, total, num_entries);
+    for (int i = 0; (i < num_entries) && (i < num_top_ops); i++) {
+        const opstats::entry& e = ops.get_entry(i);
+        printf("  %s: %6.2f%% %4s %02X %-16s", name, (100.0 * e.count) / total,
+            opstats::table_name(e.table), e.op, z80::op_name(e.table, e.op));
+        if (opstats::is_conditional(e.table, e.op)) {
+            printf(" %6.2f%% taken", (100.0 * e.taken) / e.count);
+        }
+        printf("\n");
+    }
+}
+
+//------------------------------------------------------------------------------
+static ubyte
+scripted_key(const session& s, int frame) {
+    for (int i = 0; i < s.num_keys; i++) {
+        const keypress& k = s.keys[i];
+        if ((frame >= k.frame) && (frame < (k.frame + k.num_frames))) {
+            return k.key;
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+static void
+run_session(const session& s) {
+    YAKC_ASSERT(s.num_frames <= max_frames);
+    init_emu();
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    // start from cleared memory instead of the power-on noise, so the
+    // checkpoints don't depend on how the noise is generated
+    snapshot::bank_t banks[snapshot::max_banks];
+    const int num_banks = snapshot::enumerate_banks(emu, banks, snapshot::max_banks);
+    for (int i = 0; i < num_banks; i++) {
+        clear(banks[i].ptr, banks[i].size);
+    }
+    for (int i = 0; i < boot_frames; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    load_and_start(s.data, s.size);
+
+    // record the scripted session, and count the instruction mix
+    emu.board.ops.reset();
+    emu.board.ops.enabled = true;
+    mv.start_recording(emu);
+    for (int i = 0; i < s.num_frames; i++) {
+        emu.put_key(scripted_key(s, i));
+        emu.onframe(1, 20000, 0, 0);
+        frame_hashes[i] = frame_hash();
+    }
+    mv.stop_recording(emu);
+    emu.board.ops.enabled = false;
+    CHECK(mv.num_frames() == s.num_frames);
+
+    CHECK(emu.board.ops.analyze() > 0);
+    CHECK(emu.board.ops.num_instructions() > 0);
+
+    // replay, only measure the time spent in the emulator
+    CHECK(mv.start_replay(emu));
+    const uint64_t start_cycles = emu.cycle_count();
+    double host_secs = 0.0;
+    uint64_t chained_hash = 0;
+    int first_mismatch = -1;
+    int first_drift = -1;
+    int frame = 0;
+    for (; frame < s.num_frames; frame++) {
+        auto start = Clock::Now();
+        const bool valid = mv.replay_frame(emu);
+        host_secs += Clock::Since(start).AsSeconds();
+        if (!valid) {
+            break;
+        }
+        const uint64_t h = frame_hash();
+        if ((first_mismatch < 0) && (h != frame_hashes[frame])) {
+            first_mismatch = frame;
+        }
+        chained_hash = hash(&h, sizeof(h), chained_hash);
+        if (((frame + 1) % checkpoint_interval) == 0) {
+            const int cp = frame / checkpoint_interval;
+            printf("  %s: checkpoint %d: 0x%016" PRIx64 "\n", s.name, cp, chained_hash);
+            if ((first_drift < 0) && (s.checkpoints[cp] != chained_hash)) {
+                first_drift = frame + 1 - checkpoint_interval;
+            }
+        }
+    }
+    CHECK(frame == s.num_frames);
+    CHECK(mv.num_desyncs() == 0);
+    CHECK(first_mismatch < 0);
+    CHECK(first_drift < 0);
+    if (first_mismatch >= 0) {
+        printf("  %s: replay differs from recording at frame %d!\n", s.name, first_mismatch);
+    }
+    if (first_drift >= 0) {
+        printf("  %s: emulation drifted after frame %d!\n", s.name, first_drift);
+    }
+
+    const double emu_secs = double(emu.cycle_count() - start_cycles) / (emu.board.clck.base_freq_khz * 1000.0);
+    printf("%s: %d frames, %.2fs emulated in %.3fs host (%.1fx realtime)\n",
+        s.name, s.num_frames, emu_secs, host_secs, emu_secs / host_secs);
+    print_opstats(s.name);
+    emu.poweroff();
+}
+
+//------------------------------------------------------------------------------
+TEST(gamebench_pengo) {
+    static const keypress keys[] = {
+        { 1500, key_enter, 5 },
+        // select GAME in the menu
+        { 1650, 'G', 5 }, { 1662, 'A', 5 }, { 1674, 'M', 5 }, { 1686, 'E', 5 }, { 1698, key_enter, 5 },
+        // enter a name
+        { 1800, 'Y', 5 }, { 1812, 'A', 5 }, { 1824, 'K', 5 }, { 1836, 'C', 5 }, { 1848, key_enter, 5 },
+        { 2050, key_enter, 20 },
+        // play
+        { 2250, key_right, 40 }, { 2300, key_up, 30 }, { 2360, key_left, 40 }, { 2450, key_down, 30 },
+        { 2500, key_space, 5 }, { 2550, key_right, 60 },
+    };
+    static const uint64_t checkpoints[] = {
+        0xf6c56be69dba11e5ULL,
+        0x5441e4ca5c4d2fa6ULL,
+        0xc458c21911ff835cULL,
+        0x74d65ef6c30c4361ULL,
+        0xbd4f7730966649ebULL,
+    };
+    session s = {
+        "pengo", dump_pengo, sizeof(dump_pengo),
+        keys, int(sizeof(keys)/sizeof(keys[0])), 2700, checkpoints
+    };
+    run_session(s);
+}
+
+//------------------------------------------------------------------------------
+TEST(gamebench_cave) {
+    static const keypress keys[] = {
+        { 600, key_enter, 10 },
+        // movement keys and speed
+        { 800, key_up, 10 }, { 860, key_down, 10 }, { 920, '5', 10 }, { 1000, key_enter, 10 },
+        // fly
+        { 1050, key_up, 30 }, { 1100, key_down, 20 }, { 1150, key_up, 30 }, { 1250, key_down, 40 },
+        { 1350, key_up, 30 }, { 1450, key_down, 30 },
+        // second try
+        { 1700, key_enter, 10 }, { 1760, key_up, 20 }, { 1820, key_down, 30 }, { 1900, key_up, 20 },
+    };
+    static const uint64_t checkpoints[] = {
+        0x0aaddbc89893df21ULL,
+        0x05c5609aeb5e51c0ULL,
+        0x63bdcabaf70ae070ULL,
+        0x381f5e70b1ca1cdaULL,
+    };
+    session s = {
+        "cave", dump_cave, sizeof(dump_cave),
+        keys, int(sizeof(keys)/sizeof(keys[0])), 2000, checkpoints
+    };
+    run_session(s);
+}
+
+//------------------------------------------------------------------------------
+TEST(gamebench_house) {
+    static const keypress keys[] = {
+        { 900, key_enter, 10 },
+        // select GAME in the menu
+        { 1600, 'G', 5 }, { 1612, 'A', 5 }, { 1624, 'M', 5 }, { 1636, 'E', 5 }, { 1648, key_enter, 5 },
+        { 1800, key_enter, 10 },
+        // play
+        { 1900, key_right, 40 }, { 2000, key_up, 40 }, { 2100, key_left, 40 }, { 2200, key_down, 40 },
+        { 2300, key_space, 5 }, { 2400, key_right, 60 }, { 2500, key_up, 40 },
+    };
+    static const uint64_t checkpoints[] = {
+        0xfd656eabe7ef290cULL,
+        0x5728b6e9d1333130ULL,
+        0x6dfed9c4c0d1877fULL,
+        0xff6338efe9bcb94eULL,
+        0x8779ce9170e874fbULL,
+    };
+    session s = {
+        "house", dump_house, sizeof(dump_house),
+        keys, int(sizeof(keys)/sizeof(keys[0])), 2600, checkpoints
+    };
+    run_session(s);
+}
+
+//------------------------------------------------------------------------------
+TEST(gamebench_digger) {
+    static const keypress keys[] = {
+        { 400, 'P', 10 }, { 600, key_enter, 10 },
+        // dig
+        { 700, key_right, 40 }, { 800, key_down, 40 }, { 900, key_left, 40 }, { 1000, key_right, 60 },
+        { 1100, key_down, 60 }, { 1200, key_left, 40 }, { 1300, key_up, 40 },
+    };
+    static const uint64_t checkpoints[] = {
+        0xa14e3c3de42a4ce0ULL,
+        0xcf13cb197e37a071ULL,
+        0x408f81f09f2ea1cdULL,
+    };
+    session s = {
+        "digger", dump_digger3, sizeof(dump_digger3),
+        keys, int(sizeof(keys)/sizeof(keys[0])), 1500, checkpoints
+    };
+    run_session(s);
+}
@@ -0,0 +1,3832 @@
+// #version:3#
+// machine generated, do not edit!
+#include "games.h"
+namespace YAKC {
+unsigned char dump_pengo[16000] = {
+0x50, 0x45, 0x4e, 0x47, 0x4f, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x4d, 0x1, 0x0, 0x0, 0x0, 0x0, 
+0x3, 0x0, 0x2, 0x0, 0x40, 0x44, 0x1d, 0xdd, 0xcb, 0x7, 0xfe, 0xdd, 0xcb, 0x7, 0xf6, 0x31, 
+0xc4, 0x1, 0x16, 0x3, 0x21, 0xb8, 0xf3, 0xcd, 0xbc, 0xe2, 0xf3, 0xcd, 0x57, 0xf3, 0xdd, 0xcb, 
+0x7, 0xfe, 0xdd, 0xcb, 0x7, 0xf6, 0x21, 0x0, 0x0, 0x11, 0x1, 0x0, 0x1, 0xc4, 0x1, 0x36, 
+0x0, 0xed, 0xb0, 0x21, 0x0, 0x40, 0x11, 0x1, 0x40, 0x1, 0x0, 0x40, 0x36, 0x0, 0xed, 0xb0, 
+0x21, 0x0, 0xb8, 0x11, 0x1, 0xb8, 0x1, 0x0, 0x28, 0x36, 0x0, 0xed, 0xb0, 0xdd, 0x36, 0x9, 
+0xbd, 0x3a, 0xfe, 0x29, 0xfe, 0x50, 0xc2, 0x0, 0xf0, 0x3a, 0x34, 0x1d, 0xfe, 0x77, 0xc2, 0x0, 
+0xf0, 0x3a, 0x53, 0x1f, 0xfe, 0x3e, 0xc2, 0x0, 0xf0, 0x3a, 0xfd, 0xb7, 0xfe, 0x68, 0x20, 0x4, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0xff, 0xa7, 0x11, 0xfe, 0xa7, 0x1, 0x0, 
+0x28, 0x36, 0x0, 0xed, 0xb8, 0x21, 0x0, 0xb2, 0x11, 0xff, 0xb1, 0x1, 0x0, 0xa, 0x77, 0xed, 
+0xb8, 0xc9, 0xd6, 0x2c, 0x2, 0xe0, 0xe5, 0xd5, 0xc5, 0xf5, 0x3e, 0x7, 0xcd, 0xc8, 0x2, 0x21, 
+0x0, 0x0, 0x22, 0x9c, 0xb7, 0x21, 0x28, 0x20, 0x22, 0x9e, 0xb7, 0x21, 0x0, 0x1e, 0x22, 0xa0, 
+0xb7, 0x21, 0x37, 0xf8, 0x22, 0xa4, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x2, 0xa, 0x2, 0xb, 0x20, 
+0x54, 0x49, 0x4d, 0x45, 0xa, 0xd, 0x20, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0xb, 0x4c, 0x49, 0x56, 0x45, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x47, 0x41, 0x4d, 0x45, 0xa, 0x8, 0x8, 0x8, 0x8, 0x46, 0x49, 0x45, 0x4c, 
+0x44, 0x0, 0x21, 0x0, 0x0, 0x11, 0x30, 0x32, 0x1, 0x8, 0x33, 0x3e, 0x0, 0xcd, 0xc2, 0xc, 
+0x21, 0x0, 0xe0, 0x11, 0x50, 0x32, 0xcd, 0xc2, 0xc, 0x21, 0x26, 0x0, 0x11, 0x70, 0x32, 0xcd, 
+0xc2, 0xc, 0x21, 0x26, 0xe0, 0x11, 0x90, 0x32, 0xcd, 0xc2, 0xc, 0x11, 0x10, 0x32, 0x21, 0x2, 
+0x0, 0x6, 0x12, 0xc5, 0x1, 0x8, 0x33, 0xcd, 0xc2, 0xc, 0x26, 0xe0, 0xcd, 0xc2, 0xc, 0x26, 
+0x0, 0x2c, 0x2c, 0xc1, 0x10, 0xed, 0x21, 0x0, 0x10, 0x11, 0xf0, 0x31, 0x6, 0xd, 0xc5, 0x1, 
+0x8, 0x33, 0xaf, 0xcd, 0xc2, 0xc, 0x2e, 0x26, 0xcd, 0xc2, 0xc, 0x2e, 0x0, 0x3e, 0x10, 0x84, 
+0x67, 0xc1, 0x10, 0xea, 0x21, 0x2, 0x10, 0x22, 0xe4, 0x2, 0xf1, 0x3d, 0x57, 0xe, 0x1e, 0xcd, 
+0x3, 0xf0, 0x41, 0x50, 0x5f, 0x21, 0xb8, 0x2c, 0x19, 0x22, 0xe2, 0x2, 0x2a, 0xe2, 0x2, 0x7e, 
+0x23, 0x22, 0xe2, 0x2, 0x6, 0x8, 0xc5, 0xcb, 0x27, 0xf5, 0xdc, 0xa, 0x4, 0x3a, 0xe4, 0x2, 
+0xc6, 0x2, 0x32, 0xe4, 0x2, 0xfe, 0x26, 0xca, 0xe1, 0x3, 0xf1, 0xc1, 0x10, 0xe8, 0xc3, 0xbc, 
+0x3, 0x3e, 0x2, 0x32, 0xe4, 0x2, 0x3a, 0xe5, 0x2, 0xc6, 0x10, 0x32, 0xe5, 0x2, 0xfe, 0xe0, 
+0xc2, 0xda, 0x3, 0xf1, 0xc1, 0xe1, 0x11, 0x90, 0x31, 0x1, 0x0, 0x33, 0x3e, 0x0, 0xcd, 0xc2, 
+0xc, 0xe1, 0xcd, 0xc2, 0xc, 0xe1, 0xcd, 0xc2, 0xc, 0xc9, 0x2a, 0xe4, 0x2, 0x11, 0x90, 0x31, 
+0x1, 0xf8, 0x32, 0x3e, 0x0, 0xcd, 0xc2, 0xc, 0xc9, 0x3a, 0x38, 0x0, 0x3c, 0x32, 0x38, 0x0, 
+0xd6, 0x29, 0xfe, 0x0, 0xc8, 0xaf, 0x32, 0x4, 0x0, 0x32, 0x10, 0x0, 0x32, 0x19, 0x0, 0x32, 
+0x22, 0x0, 0x32, 0x2b, 0x0, 0x32, 0x8, 0x0, 0x32, 0x11, 0x0, 0x32, 0x1a, 0x0, 0x32, 0x23, 
+0x0, 0x32, 0x2c, 0x0, 0x32, 0x43, 0x0, 0x3e, 0x8, 0x32, 0x9, 0x0, 0xc6, 0x8, 0x32, 0x12, 
+0x0, 0xc6, 0x8, 0x32, 0x1b, 0x0, 0xc6, 0x8, 0x32, 0x24, 0x0, 0x3a, 0x38, 0x0, 0x3d, 0x57, 
+0xe, 0xb, 0xcd, 0x3, 0xf0, 0x41, 0x50, 0x5f, 0x21, 0x0, 0x2b, 0x19, 0x7e, 0x32, 0x41, 0x0, 
+0x23, 0x7e, 0x32, 0x40, 0x0, 0xf5, 0x23, 0xe5, 0x7e, 0xe6, 0xf, 0x32, 0x7, 0x0, 0x7e, 0xcb, 
+0x67, 0xc2, 0x93, 0x4, 0xcb, 0x6f, 0xc2, 0x98, 0x4, 0xcb, 0x77, 0xc2, 0x9d, 0x4, 0x3e, 0xf, 
+0xc3, 0x9f, 0x4, 0x3e, 0x77, 0xc3, 0x9f, 0x4, 0x3e, 0x17, 0xc3, 0x9f, 0x4, 0x3e, 0x37, 0x32, 
+0x39, 0x0, 0x21, 0xd0, 0x32, 0x11, 0x1f, 0x33, 0x23, 0x7e, 0xfe, 0x0, 0xc2, 0xb3, 0x4, 0x3a, 
+0x39, 0x0, 0x77, 0xe5, 0xd5, 0xed, 0x52, 0xd1, 0xe1, 0xc2, 0xa8, 0x4, 0xe1, 0x23, 0x7e, 0x32, 
+0x0, 0x0, 0x23, 0x7e, 0xcd, 0xf3, 0x4, 0x32, 0x1, 0x0, 0x23, 0x7e, 0x32, 0x32, 0x0, 0x23, 
+0x7e, 0xcd, 0xf3, 0x4, 0x32, 0x33, 0x0, 0x23, 0x7e, 0x32, 0x34, 0x0, 0x23, 0x7e, 0xcd, 0xf3, 
+0x4, 0x32, 0x35, 0x0, 0x23, 0x7e, 0x32, 0x36, 0x0, 0x23, 0x7e, 0xcd, 0xf3, 0x4, 0x32, 0x37, 
+0x0, 0xf1, 0xc9, 0xe5, 0x57, 0xe, 0x8, 0xcd, 0x3, 0xf0, 0x41, 0xe1, 0xc9, 0x0, 0x0, 0x0, 
+0xc6, 0xa, 0xff, 0x3, 0x18, 0xff, 0x3, 0x0, 0x11, 0x0, 0x5, 0x1, 0x5, 0x0, 0xed, 0xb0, 
+0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0x2a, 0x0, 0x5, 0x22, 0x33, 0x5, 0x22, 0x3b, 
+0x5, 0x21, 0x2, 0x5, 0x11, 0x5, 0x5, 0x1, 0x3, 0x0, 0xed, 0xb0, 0xcd, 0x3, 0xf0, 0x35, 
+0x3a, 0x82, 0xb7, 0xc6, 0xa, 0x32, 0x82, 0xb7, 0x3a, 0x84, 0xb7, 0xc6, 0xa, 0x32, 0x84, 0xb7, 
+0x3a, 0x5, 0x5, 0x47, 0x10, 0xfe, 0x3a, 0x6, 0x5, 0x3d, 0x32, 0x6, 0x5, 0xfe, 0x0, 0xc2, 
+0x40, 0x5, 0x3a, 0x3, 0x5, 0x32, 0x6, 0x5, 0x3a, 0x7, 0x5, 0x3d, 0x32, 0x7, 0x5, 0xfe, 
+0x0, 0xc2, 0x2c, 0x5, 0x21, 0x82, 0xb7, 0x36, 0x0, 0x23, 0x23, 0x36, 0x0, 0xcd, 0x3, 0xf0, 
+0x35, 0xc9, 0x3a, 0x44, 0x0, 0xfe, 0x0, 0xca, 0x7f, 0x5, 0x3d, 0x32, 0x44, 0x0, 0xc9, 0x3a, 
+0x43, 0x0, 0xfe, 0x34, 0xc2, 0x8b, 0x5, 0xaf, 0x32, 0x43, 0x0, 0x3c, 0x32, 0x43, 0x0, 0x3d, 
+0x57, 0xe, 0x5, 0xcd, 0x3, 0xf0, 0x41, 0x50, 0x5f, 0x21, 0x8a, 0x2d, 0x19, 0x11, 0x82, 0xb7, 
+0x1, 0x4, 0x0, 0xed, 0xb0, 0x7e, 0x32, 0x44, 0x0, 0x3e, 0x0, 0x12, 0x13, 0xaf, 0x12, 0xcd, 
+0x3, 0xf0, 0x35, 0xc9, 0xb, 0xb, 0xdd, 0x7e, 0xd, 0x32, 0xb5, 0x5, 0x21, 0x45, 0x0, 0xbe, 
+0xca, 0x4, 0x6, 0x23, 0xbe, 0xca, 0x16, 0x6, 0x23, 0xbe, 0xca, 0x28, 0x6, 0x23, 0xbe, 0xca, 
+0x3a, 0x6, 0xaf, 0x32, 0x2, 0x0, 0x32, 0x3, 0x0, 0x3a, 0xb4, 0x5, 0x21, 0xb5, 0x5, 0xbe, 
+0xca, 0xf1, 0x5, 0xaf, 0x32, 0x42, 0x0, 0xaf, 0xf5, 0x3a, 0xb5, 0x5, 0x32, 0xb4, 0x5, 0xf1, 
+0xc9, 0x21, 0x42, 0x0, 0x34, 0x3e, 0x4, 0xbe, 0xc2, 0xe7, 0x5, 0xaf, 0x32, 0x42, 0x0, 0x3e, 
+0xff, 0xc3, 0xe8, 0x5, 0x3e, 0x2, 0x32, 0x2, 0x0, 0xaf, 0x32, 0x3, 0x0, 0x21, 0x90, 0x2e, 
+0x22, 0x5, 0x0, 0xc3, 0xd9, 0x5, 0x3e, 0xfe, 0x32, 0x2, 0x0, 0xaf, 0x32, 0x3, 0x0, 0x21, 
+0x50, 0x2f, 0x22, 0x5, 0x0, 0xc3, 0xd9, 0x5, 0xaf, 0x32, 0x2, 0x0, 0x3e, 0xf0, 0x32, 0x3, 
+0x0, 0x21, 0x10, 0x2f, 0x22, 0x5, 0x0, 0xc3, 0xd9, 0x5, 0xaf, 0x32, 0x2, 0x0, 0x3e, 0x10, 
+0x32, 0x3, 0x0, 0x21, 0xd0, 0x2e, 0x22, 0x5, 0x0, 0xc3, 0xd9, 0x5, 0xf5, 0x47, 0xe6, 0xf0, 
+0x78, 0xf5, 0xcc, 0xeb, 0xf2, 0xf1, 0xc4, 0xe2, 0xf2, 0xf1, 0xc9, 0x2b, 0xa7, 0xca, 0x9a, 0x6, 
+0x6, 0x6, 0x23, 0x7e, 0xfe, 0x0, 0xc2, 0x7d, 0x6, 0x3e, 0x9, 0xcd, 0x25, 0xf7, 0xcd, 0x25, 
+0xf7, 0x10, 0xef, 0x3e, 0x8, 0xcd, 0x25, 0xf7, 0xaf, 0xcd, 0x4c, 0x6, 0xc9, 0x4f, 0xe6, 0xf0, 
+0xc2, 0x88, 0x6, 0x3e, 0x9, 0xcd, 0x25, 0xf7, 0x79, 0xc5, 0xcd, 0x4c, 0x6, 0xc1, 0x5, 0x78, 
+0xa7, 0xc8, 0x23, 0x7e, 0xcd, 0xe2, 0xf2, 0x10, 0xf9, 0xc9, 0x6, 0x6, 0x23, 0x7e, 0xfe, 0x0, 
+0xc2, 0x89, 0x6, 0x10, 0xf7, 0xcd, 0x4c, 0x6, 0xc9, 0xf5, 0xe5, 0x21, 0x38, 0x36, 0x22, 0xaa, 
+0xb7, 0x21, 0x0, 0x0, 0x22, 0x9c, 0xb7, 0x21, 0x28, 0x20, 0x22, 0x9e, 0xb7, 0xe1, 0x2e, 0x0, 
+0x22, 0xa0, 0xb7, 0x21, 0xc8, 0x34, 0x11, 0x60, 0x33, 0x1a, 0x32, 0xa3, 0xb7, 0x7e, 0xfe, 0x0, 
+0xca, 0xe0, 0x6, 0xfe, 0x5b, 0xca, 0xe2, 0x6, 0xcd, 0x25, 0xf7, 0x23, 0x13, 0xc3, 0xc9, 0x6, 
+0xf1, 0xc9, 0x1a, 0xfe, 0x28, 0xca, 0xf4, 0x6, 0xf1, 0xf5, 0xfe, 0x0, 0xca, 0xf4, 0x6, 0x3e, 
+0x20, 0xc3, 0xd8, 0x6, 0x3e, 0x5b, 0xc3, 0xd8, 0x6, 0xc6, 0x43, 0x80, 0x1, 0x40, 0x0, 0x0, 
+0x10, 0x0, 0x0, 0x0, 0xc6, 0xd, 0xff, 0x3, 0x20, 0x80, 0x0, 0x70, 0x0, 0x0, 0x0, 0xc6, 
+0x67, 0xff, 0x6, 0x38, 0x10, 0x0, 0x70, 0x0, 0x0, 0x0, 0xc6, 0xc, 0xff, 0x4, 0x18, 0x60, 
+0x0, 0x30, 0x0, 0x0, 0x0, 0xc6, 0x4, 0xff, 0x3, 0x14, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 
+0x3e, 0x7, 0xcd, 0xc8, 0x2, 0x3e, 0x11, 0xcd, 0x25, 0xf7, 0x26, 0x0, 0xaf, 0xcd, 0xa9, 0x6, 
+0x26, 0x17, 0x2f, 0xcd, 0xa9, 0x6, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x21, 0x2, 0xa, 0x22, 0xa0, 
+0xb7, 0xcd, 0xc6, 0xf1, 0x50, 0x45, 0x4e, 0x47, 0x4f, 0x3a, 0xa, 0xa, 0xa, 0xa, 0xd, 0x20, 
+0x20, 0x53, 0x4e, 0x4f, 0x57, 0x42, 0x45, 0x45, 0x0, 0x3a, 0x7, 0x0, 0xfe, 0x1, 0xca, 0x76, 
+0x7, 0x3e, 0x53, 0xcd, 0x25, 0xf7, 0x3e, 0x3a, 0xcd, 0x25, 0xf7, 0x21, 0x10, 0xa, 0x22, 0xa0, 
+0xb7, 0xcd, 0xc6, 0xf1, 0x43, 0x52, 0x59, 0x53, 0x54, 0x41, 0x4c, 0x2d, 0x42, 0x4c, 0x4f, 0x43, 
+0x4b, 0x53, 0x3a, 0xa, 0xa, 0xa, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x49, 0x43, 0x45, 
+0x2d, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x3a, 0x0, 0x21, 0x2, 0x11, 0x22, 0xa0, 0xb7, 0xcd, 0xc6, 
+0xf1, 0x4c, 0x49, 0x56, 0x45, 0x53, 0x3a, 0xa, 0xd, 0x20, 0x20, 0x47, 0x41, 0x4d, 0x45, 0x20, 
+0x3a, 0xa, 0xd, 0x20, 0x20, 0x46, 0x49, 0x45, 0x4c, 0x44, 0x3a, 0x9, 0x9, 0x9, 0x9, 0x9, 
+0x52, 0x45, 0x43, 0x4f, 0x52, 0x44, 0x3a, 0xb, 0xb, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 
+0x53, 0x43, 0x4f, 0x52, 0x45, 0x20, 0x3a, 0x0, 0x21, 0x9, 0x11, 0x22, 0xa0, 0xb7, 0x21, 0xa0, 
+0xb7, 0x3a, 0x49, 0x0, 0xcd, 0x4c, 0x6, 0x35, 0x23, 0x34, 0x2b, 0x3a, 0x41, 0x0, 0xcd, 0x4c, 
+0x6, 0x35, 0x23, 0x34, 0x2b, 0x3a, 0x40, 0x0, 0xcd, 0x4c, 0x6, 0x21, 0x15, 0x11, 0x22, 0xa0, 
+0xb7, 0x21, 0x3a, 0x0, 0xaf, 0xcd, 0x5b, 0x6, 0x21, 0x15, 0x13, 0x22, 0xa0, 0xb7, 0x21, 0x0, 
+0xba, 0xaf, 0xcd, 0x5b, 0x6, 0x21, 0xc, 0x50, 0x11, 0x50, 0x2f, 0x1, 0xd0, 0x32, 0xaf, 0xcd, 
+0xc2, 0xc, 0x21, 0xf9, 0x6, 0xcd, 0x8, 0x5, 0x21, 0x20, 0x50, 0x6, 0x3, 0xc5, 0xe5, 0x11, 
+0x90, 0x31, 0x1, 0x0, 0x33, 0xaf, 0xcd, 0xc2, 0xc, 0x21, 0x4, 0x7, 0xcd, 0x8, 0x5, 0xe1, 
+0x2c, 0x2c, 0xc1, 0x10, 0xe8, 0x21, 0x24, 0x70, 0x11, 0x90, 0x31, 0x1, 0xf8, 0x32, 0xaf, 0xcd, 
+0xc2, 0xc, 0x21, 0xf, 0x7, 0xcd, 0x8, 0x5, 0x21, 0xc, 0x70, 0x3a, 0x7, 0x0, 0x47, 0xc5, 
+0xe5, 0x11, 0x90, 0x2f, 0x1, 0xd8, 0x32, 0xaf, 0xcd, 0xc2, 0xc, 0x21, 0x1a, 0x7, 0xcd, 0x8, 
+0x5, 0xe1, 0x2c, 0x2c, 0x2c, 0xc1, 0x10, 0xe7, 0x3e, 0x10, 0xcd, 0x8, 0xf2, 0x3a, 0xd8, 0x32, 
+0x32, 0xa3, 0xb7, 0x21, 0x1e, 0x15, 0x22, 0xa0, 0xb7, 0xcd, 0xc6, 0xf1, 0xa2, 0xa3, 0xa4, 0xa5, 
+0xa6, 0xa3, 0xa7, 0x20, 0x0, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x3e, 0x8d, 0xcd, 0x25, 0xf7, 0x21, 
+0x25, 0x7, 0xcd, 0x8, 0x5, 0x3a, 0x29, 0x7, 0xd6, 0x1, 0x20, 0x2, 0x3e, 0x28, 0x32, 0x29, 
+0x7, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0xc2, 0xaf, 0x8, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x7b, 0x85, 0x6f, 0x7a, 0x84, 0x67, 0xe5, 0xcd, 0xbf, 0xe0, 0x1a, 0x47, 0xe1, 0xc9, 0x21, 0x3f, 
+0x0, 0xe, 0x0, 0xf5, 0x7e, 0x83, 0x27, 0x77, 0x2b, 0x7e, 0x8a, 0x27, 0x77, 0x6, 0x4, 0x2b, 
+0x7e, 0x89, 0x27, 0x77, 0x10, 0xf9, 0xf1, 0xd6, 0x1, 0x27, 0x20, 0xe2, 0xc9, 0xaf, 0x2a, 0xa, 
+0x0, 0xed, 0x52, 0x28, 0x20, 0xaf, 0x2a, 0x13, 0x0, 0xed, 0x52, 0x28, 0x28, 0xaf, 0x2a, 0x1c, 
+0x0, 0xed, 0x52, 0x28, 0x30, 0x3a, 0x23, 0x0, 0xa7, 0xc8, 0xaf, 0x32, 0x23, 0x0, 0x3e, 0x20, 
+0x32, 0x24, 0x0, 0x18, 0x2e, 0x3a, 0x8, 0x0, 0xa7, 0xc8, 0xaf, 0x32, 0x8, 0x0, 0x3e, 0x20, 
+0x32, 0x9, 0x0, 0x18, 0x1e, 0x3a, 0x11, 0x0, 0xa7, 0xc8, 0xaf, 0x32, 0x11, 0x0, 0x3e, 0x20, 
+0x32, 0x12, 0x0, 0x18, 0xe, 0x3a, 0x1a, 0x0, 0xa7, 0xc8, 0xaf, 0x32, 0x1a, 0x0, 0x3e, 0x20, 
+0x32, 0x1b, 0x0, 0x11, 0x80, 0x0, 0x3a, 0x4c, 0x0, 0xcd, 0xde, 0x8, 0x21, 0x7, 0x1f, 0x22, 
+0xa0, 0xb7, 0x3e, 0x20, 0x32, 0xa3, 0xb7, 0x21, 0x3a, 0x0, 0xaf, 0xcd, 0x5b, 0x6, 0xc9, 0x21, 
+0x0, 0x0, 0x11, 0x1, 0x0, 0x1, 0x44, 0x0, 0x36, 0x0, 0xed, 0xb0, 0x3e, 0x5, 0x32, 0x49, 
+0x0, 0xc9, 0x3a, 0x38, 0x0, 0x3d, 0x57, 0xe, 0xb, 0xcd, 0x83, 0xfd, 0x50, 0x5f, 0x21, 0x0, 
+0x2b, 0x19, 0x23, 0x23, 0x7e, 0x32, 0x4c, 0x0, 0x2a, 0xc, 0x0, 0x22, 0x4a, 0x0, 0xaf, 0x32, 
+0x42, 0x0, 0x32, 0x43, 0x0, 0x32, 0x44, 0x0, 0x3a, 0x7, 0x0, 0x21, 0x2, 0x10, 0x22, 0xa, 
+0x0, 0x3d, 0xc8, 0x21, 0x24, 0xd0, 0x22, 0x13, 0x0, 0x3d, 0xc8, 0x21, 0x24, 0x10, 0x22, 0x1c, 
+0x0, 0x3d, 0xc8, 0x21, 0x2, 0xd0, 0x22, 0x25, 0x0, 0xc9, 0x21, 0xd0, 0x32, 0x11, 0x20, 0x33, 
+0x3a, 0x39, 0x0, 0xbe, 0x20, 0x2, 0x36, 0x0, 0x23, 0xe5, 0xaf, 0xed, 0x52, 0xe1, 0xc8, 0x18, 
+0xef, 0xc6, 0xc, 0xa0, 0x1, 0x18, 0x20, 0x0, 0x60, 0x0, 0x0, 0x0, 0xc6, 0x75, 0xff, 0x2, 
+0x10, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x3a, 0x2c, 0x0, 0xa7, 0xc8, 0x2a, 0x2d, 0x0, 0x11, 
+0x18, 0x14, 0x1, 0x38, 0x14, 0xaf, 0xcd, 0xc2, 0xc, 0x2a, 0x2d, 0x0, 0xed, 0x5b, 0x30, 0x0, 
+0xcd, 0xd0, 0x8, 0xe5, 0x78, 0xfe, 0x4f, 0xca, 0x7d, 0xa, 0xfe, 0x2f, 0xca, 0x7d, 0xa, 0xfe, 
+0x3f, 0xca, 0x7d, 0xa, 0xd1, 0x2a, 0xa, 0x0, 0xaf, 0xed, 0x52, 0xca, 0x90, 0xa, 0x2a, 0x13, 
+0x0, 0xaf, 0xed, 0x52, 0xca, 0x90, 0xa, 0x2a, 0x1c, 0x0, 0xaf, 0xed, 0x52, 0xca, 0x90, 0xa, 
+0x2a, 0x25, 0x0, 0xaf, 0xed, 0x52, 0xca, 0x90, 0xa, 0x2a, 0x2d, 0x0, 0x11, 0x0, 0x33, 0x3a, 
+0x57, 0x0, 0xbb, 0xca, 0xa9, 0xa, 0x2a, 0x2d, 0x0, 0x3a, 0x30, 0x0, 0x85, 0x6f, 0x3a, 0x31, 
+0x0, 0x84, 0x67, 0x22, 0x2d, 0x0, 0x11, 0x18, 0x14, 0x1, 0x38, 0x14, 0x3e, 0x1, 0xcd, 0xc2, 
+0xc, 0x11, 0x90, 0x31, 0xed, 0x4b, 0x57, 0x0, 0xaf, 0xcd, 0xc2, 0xc, 0xc9, 0x21, 0xe1, 0x9, 
+0xcd, 0x8, 0x5, 0x21, 0x0, 0x0, 0x22, 0x30, 0x0, 0xaf, 0x32, 0x2c, 0x0, 0xc3, 0x24, 0xa, 
+0xd5, 0xcd, 0xfd, 0x8, 0xe1, 0x0, 0x11, 0xf0, 0x30, 0x1, 0xd8, 0x32, 0xaf, 0xcd, 0xc2, 0xc, 
+0x21, 0xec, 0x9, 0xcd, 0x8, 0x5, 0xc3, 0x49, 0xa, 0x54, 0x5d, 0x2a, 0x32, 0x0, 0xaf, 0xed, 
+0x52, 0xca, 0xd0, 0xa, 0x2a, 0x34, 0x0, 0xaf, 0xed, 0x52, 0xca, 0xd7, 0xa, 0x6b, 0x62, 0x11, 
+0x36, 0x0, 0x3a, 0x30, 0x0, 0x85, 0x12, 0x3a, 0x31, 0x0, 0x84, 0x13, 0x12, 0xc3, 0x56, 0xa, 
+0x6b, 0x62, 0x11, 0x32, 0x0, 0x18, 0xeb, 0x6b, 0x62, 0x11, 0x34, 0x0, 0x18, 0xe4, 0xed, 0x44, 
+0xff, 0x18, 0x5, 0x40, 0x0, 0x60, 0x0, 0x0, 0x0, 0x3a, 0x2, 0x0, 0xfe, 0x2, 0xca, 0x54, 
+0xb, 0xfe, 0xfe, 0xca, 0x3e, 0xb, 0x3a, 0x3, 0x0, 0xfe, 0xf0, 0xca, 0x1e, 0xb, 0x21, 0xff, 
+0xae, 0x11, 0x20, 0xdc, 0x3e, 0x5f, 0xe5, 0xd5, 0xcd, 0xec, 0xb, 0x21, 0xde, 0xa, 0xcd, 0x8, 
+0x5, 0xd1, 0xe1, 0x3e, 0x4f, 0xcd, 0xec, 0xb, 0x1, 0x0, 0xd0, 0xc3, 0x67, 0xb, 0x21, 0xff, 
+0xa7, 0x11, 0x20, 0xfc, 0x3e, 0x5f, 0xe5, 0xd5, 0xcd, 0xec, 0xb, 0x21, 0xde, 0xa, 0xcd, 0x8, 
+0x5, 0xd1, 0xe1, 0x3e, 0x4f, 0xcd, 0xec, 0xb, 0x1, 0x0, 0x10, 0xc3, 0x67, 0xb, 0x3e, 0x5f, 
+0xcd, 0x1e, 0xc, 0x21, 0xde, 0xa, 0xcd, 0x8, 0x5, 0x3e, 0x4f, 0xcd, 0x1e, 0xc, 0x1, 0x2, 
+0x0, 0xc3, 0x67, 0xb, 0x3e, 0x5f, 0xcd, 0x2d, 0xc, 0x21, 0xde, 0xa, 0xcd, 0x8, 0x5, 0x3e, 
+0x4f, 0xcd, 0x2d, 0xc, 0x1, 0x24, 0x0, 0x3a, 0x8, 0x0, 0xfe, 0x2, 0x28, 0x16, 0x3a, 0x11, 
+0x0, 0xfe, 0x2, 0x28, 0x29, 0x3a, 0x1a, 0x0, 0xfe, 0x2, 0x28, 0x3c, 0x3a, 0x23, 0x0, 0xfe, 
+0x2, 0x28, 0x4f, 0xc9, 0x3a, 0xa, 0x0, 0xb9, 0x28, 0x8, 0x3a, 0xb, 0x0, 0xb8, 0x28, 0x2, 
+0x18, 0xdc, 0x3e, 0x1, 0x32, 0x8, 0x0, 0x3e, 0x18, 0x32, 0x9, 0x0, 0x18, 0xd0, 0x3a, 0x13, 
+0x0, 0xb9, 0x28, 0x8, 0x3a, 0x14, 0x0, 0xb8, 0x28, 0x2, 0x18, 0xc9, 0x3e, 0x1, 0x32, 0x11, 
+0x0, 0x3e, 0x18, 0x32, 0x12, 0x0, 0x18, 0xbd, 0x3a, 0x1c, 0x0, 0xb9, 0x28, 0x8, 0x3a, 0x1d, 
+0x0, 0xb8, 0x28, 0x2, 0x18, 0xb6, 0x3e, 0x1, 0x32, 0x1a, 0x0, 0x3e, 0x18, 0x32, 0x1b, 0x0, 
+0x18, 0xaa, 0x3a, 0x25, 0x0, 0xb9, 0x28, 0x8, 0x3a, 0x26, 0x0, 0xb8, 0x28, 0x2, 0x18, 0xa3, 
+0x3e, 0x1, 0x32, 0x23, 0x0, 0x3e, 0x18, 0x32, 0x24, 0x0, 0x18, 0x97, 0xd5, 0x54, 0x5d, 0x13, 
+0x6, 0x4, 0xc5, 0x23, 0x23, 0x23, 0x13, 0x13, 0x13, 0x1, 0x1d, 0x0, 0x77, 0xed, 0xb0, 0xc1, 
+0x10, 0xf0, 0xe1, 0x6, 0x4, 0xc5, 0xf5, 0x3e, 0x4, 0x84, 0x67, 0xf1, 0xe5, 0xcd, 0xbf, 0xe0, 
+0x62, 0x6b, 0x13, 0x1, 0x5, 0x0, 0x77, 0xed, 0xb0, 0xe1, 0xc1, 0x10, 0xe8, 0xc9, 0x21, 0x80, 
+0xa8, 0x6, 0x34, 0x77, 0x23, 0x77, 0x11, 0x1f, 0x0, 0x19, 0x10, 0xf7, 0xc9, 0x21, 0x26, 0x10, 
+0x6, 0x34, 0xc5, 0xe5, 0xcd, 0xbf, 0xe0, 0x12, 0x13, 0x12, 0xe1, 0x47, 0x3e, 0x4, 0x84, 0x67, 
+0x78, 0xc1, 0x10, 0xee, 0xc9, 0x3a, 0x32, 0x0, 0x21, 0x34, 0x0, 0xbe, 0x20, 0x5, 0x23, 0x23, 
+0xbe, 0x28, 0x10, 0x3a, 0x33, 0x0, 0x21, 0x35, 0x0, 0xbe, 0x20, 0x5, 0x23, 0x23, 0xbe, 0x28, 
+0x7, 0xaf, 0xc9, 0x11, 0x0, 0x10, 0x18, 0x3, 0x11, 0x2, 0x0, 0x2a, 0x32, 0x0, 0xd5, 0xcd, 
+0xd0, 0x8, 0xd1, 0x78, 0xfe, 0x3f, 0x28, 0x1b, 0xaf, 0xf5, 0x7a, 0xed, 0x44, 0x57, 0x7b, 0xed, 
+0x44, 0x5f, 0x2a, 0x32, 0x0, 0xd5, 0xcd, 0xd0, 0x8, 0xd1, 0xf1, 0x4f, 0x78, 0xfe, 0x3f, 0x28, 
+0x14, 0xaf, 0xc9, 0xd5, 0xcd, 0xd0, 0x8, 0xd1, 0x78, 0xfe, 0x3f, 0x28, 0x5, 0x3e, 0xff, 0xc3, 
+0x79, 0xc, 0xaf, 0x37, 0xc9, 0x79, 0xfe, 0xff, 0x28, 0xf8, 0xd5, 0xcd, 0xd0, 0x8, 0xd1, 0x78, 
+0xfe, 0x3f, 0x28, 0xee, 0xaf, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0xe0, 0x32, 0xf5, 0xc5, 0xd5, 0xe5, 0xfe, 0x0, 0xc2, 0x9f, 0xd, 0x8, 0x7d, 0x8, 0xed, 0x43, 
+0xc0, 0xc, 0x7d, 0xfe, 0x20, 0x3e, 0x0, 0x38, 0x4, 0x3e, 0x80, 0xcb, 0xad, 0xb7, 0xcb, 0x1c, 
+0x84, 0x6, 0x37, 0x4f, 0xa, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x6a, 0xd, 0x13, 0xa, 
+0x8, 0x6f, 0x8, 0xcb, 0xad, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x8c, 0xd, 0xa, 0x8, 
+0x6f, 0x8, 0xcb, 0xad, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x6a, 0xd, 0x13, 0xa, 0x8, 
+0x6f, 0x8, 0xcb, 0xad, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x8c, 0xd, 0x3e, 0xf8, 0x81, 
+0x4f, 0x8, 0x3c, 0xfe, 0x20, 0xcb, 0xaf, 0x6f, 0xf5, 0x8, 0xf1, 0x20, 0x4, 0x3e, 0x80, 0x81, 
+0x4f, 0xa, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x6a, 0xd, 0x13, 0xa, 0x8, 0x6f, 0x8, 
+0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x8c, 0xd, 0xa, 0x8, 0x6f, 0x8, 0x85, 0x6f, 0xc, 
+0xa, 0xc, 0x67, 0xcd, 0x6a, 0xd, 0x13, 0xa, 0x8, 0x6f, 0x8, 0x85, 0x6f, 0xc, 0xa, 0xc, 
+0x67, 0xcd, 0x8c, 0xd, 0xb7, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x1a, 0x77, 0x13, 0x24, 0x1a, 0x77, 
+0x13, 0xcb, 0xfd, 0x1a, 0x77, 0x13, 0x25, 0x1a, 0x77, 0x13, 0xcb, 0xed, 0x1a, 0x77, 0x13, 0x24, 
+0x1a, 0x77, 0x13, 0xcb, 0xbd, 0x1a, 0x77, 0x13, 0x25, 0x1a, 0x77, 0xc9, 0xd5, 0xed, 0x5b, 0xc0, 
+0xc, 0x1a, 0x77, 0x13, 0xcb, 0xed, 0x1a, 0x77, 0x13, 0xed, 0x53, 0xc0, 0xc, 0xd1, 0xc9, 0x8, 
+0x7d, 0x8, 0xed, 0x43, 0xc0, 0xc, 0x7d, 0xfe, 0x20, 0x3e, 0x0, 0x38, 0x4, 0x3e, 0x80, 0xcb, 
+0xad, 0xb7, 0xcb, 0x1c, 0x84, 0x6, 0x37, 0x4f, 0xa, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 
+0x3e, 0xe, 0x13, 0xa, 0x8, 0x6f, 0x8, 0xcb, 0xad, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 
+0x60, 0xe, 0xa, 0x8, 0x6f, 0x8, 0xcb, 0xad, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x3e, 
+0xe, 0x13, 0xa, 0x8, 0x6f, 0x8, 0xcb, 0xad, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x60, 
+0xe, 0x3e, 0xf8, 0x81, 0x4f, 0x8, 0x3c, 0xfe, 0x20, 0xcb, 0xaf, 0x6f, 0xf5, 0x8, 0xf1, 0x20, 
+0x4, 0x3e, 0x80, 0x81, 0x4f, 0xa, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x3e, 0xe, 0x13, 
+0xa, 0x8, 0x6f, 0x8, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x60, 0xe, 0xa, 0x8, 0x6f, 
+0x8, 0x85, 0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x3e, 0xe, 0x13, 0xa, 0x8, 0x6f, 0x8, 0x85, 
+0x6f, 0xc, 0xa, 0xc, 0x67, 0xcd, 0x60, 0xe, 0xb7, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x7e, 0x12, 
+0x13, 0x24, 0x7e, 0x12, 0x13, 0xcb, 0xfd, 0x7e, 0x12, 0x13, 0x25, 0x7e, 0x12, 0x13, 0xcb, 0xed, 
+0x7e, 0x12, 0x13, 0x24, 0x7e, 0x12, 0x13, 0xcb, 0xbd, 0x7e, 0x12, 0x13, 0x25, 0x7e, 0x12, 0xc9, 
+0xd5, 0xed, 0x5b, 0xc0, 0xc, 0x7e, 0x12, 0x13, 0xcb, 0xed, 0x7e, 0x12, 0x13, 0xed, 0x53, 0xc0, 
+0xc, 0xd1, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x3a, 0x0, 0x0, 0x21, 0x5c, 0x0, 0xbe, 0x30, 0x7, 0x21, 0xfe, 0x0, 0x22, 0x60, 0x0, 0xc9, 
+0x21, 0x2, 0x0, 0x22, 0x60, 0x0, 0xc9, 0x3a, 0x1, 0x0, 0x21, 0x5d, 0x0, 0xbe, 0x30, 0x7, 
+0x21, 0x0, 0xf0, 0x22, 0x60, 0x0, 0xc9, 0x21, 0x0, 0x10, 0x22, 0x60, 0x0, 0xc9, 0x3a, 0x0, 
+0x0, 0x21, 0x5c, 0x0, 0x96, 0x30, 0x2, 0xed, 0x44, 0x57, 0x3a, 0x1, 0x0, 0x21, 0x5d, 0x0, 
+0x96, 0x30, 0x2, 0xed, 0x44, 0xa7, 0xcb, 0x1f, 0xcb, 0x1f, 0xcb, 0x1f, 0xba, 0xf5, 0xdc, 0x97, 
+0xe, 0xf1, 0xd4, 0x80, 0xe, 0xc9, 0x3a, 0x5d, 0x0, 0xfe, 0x78, 0x38, 0x7, 0x21, 0x0, 0xf0, 
+0x22, 0x60, 0x0, 0xc9, 0x21, 0x0, 0x10, 0x22, 0x60, 0x0, 0xc9, 0x3a, 0x5c, 0x0, 0xfe, 0x14, 
+0x38, 0x7, 0x21, 0xfe, 0x0, 0x22, 0x60, 0x0, 0xc9, 0x21, 0x2, 0x0, 0x22, 0x60, 0x0, 0xc9, 
+0x3a, 0x60, 0x0, 0xa7, 0x28, 0x5, 0x11, 0x0, 0xf0, 0x18, 0x3, 0x11, 0xfe, 0x0, 0x2a, 0x5c, 
+0x0, 0xd5, 0xcd, 0xd0, 0x8, 0xd1, 0x78, 0xfe, 0x2f, 0x28, 0xd, 0xfe, 0x3f, 0x28, 0x9, 0xfe, 
+0x4f, 0x28, 0x5, 0xed, 0x53, 0x60, 0x0, 0xc9, 0x7b, 0xed, 0x44, 0x5f, 0x7a, 0xed, 0x44, 0x57, 
+0xed, 0x53, 0x60, 0x0, 0xc9, 0x3a, 0x39, 0x0, 0xfe, 0x77, 0x20, 0x2, 0x6, 0x3, 0xfe, 0x17, 
+0x20, 0x2, 0x6, 0x2, 0xfe, 0x37, 0x20, 0x2, 0x6, 0x1, 0xfe, 0xf, 0x20, 0x2, 0x6, 0x1, 
+0x78, 0x32, 0x5b, 0x0, 0xc9, 0xaf, 0x32, 0x67, 0x0, 0x6, 0x4, 0xc5, 0x78, 0xfe, 0x4, 0x20, 
+0x3, 0x11, 0x2, 0x0, 0xfe, 0x3, 0x20, 0x3, 0x11, 0xfe, 0x0, 0xfe, 0x2, 0x20, 0x3, 0x11, 
+0x0, 0x10, 0xfe, 0x1, 0x20, 0x3, 0x11, 0x0, 0xf0, 0x2a, 0x5c, 0x0, 0xcd, 0xd0, 0x8, 0x21, 
+0x67, 0x0, 0x78, 0xfe, 0x2f, 0x20, 0x1, 0x34, 0xfe, 0x3f, 0x20, 0x1, 0x34, 0xfe, 0x4f, 0x20, 
+0x1, 0x34, 0xc1, 0x10, 0xc6, 0xc9, 0x3a, 0x2c, 0x0, 0xa7, 0xc8, 0x3a, 0x5d, 0x0, 0x21, 0x2e, 
+0x0, 0xbe, 0x28, 0x8, 0x3a, 0x5c, 0x0, 0x2b, 0xbe, 0x28, 0x28, 0xc9, 0x3a, 0x5c, 0x0, 0x21, 
+0x2d, 0x0, 0xbe, 0x38, 0xf, 0x3a, 0x30, 0x0, 0xfe, 0x2, 0xc0, 0xcd, 0xd6, 0xe, 0x21, 0x68, 
+0x0, 0xcb, 0xc6, 0xc9, 0x3a, 0x30, 0x0, 0xfe, 0xfe, 0xc0, 0xcd, 0xd6, 0xe, 0x21, 0x68, 0x0, 
+0xcb, 0xc6, 0xc9, 0x3a, 0x5d, 0x0, 0x21, 0x2e, 0x0, 0xbe, 0x38, 0xf, 0x3a, 0x31, 0x0, 0xfe, 
+0x10, 0xc0, 0xcd, 0xeb, 0xe, 0x21, 0x68, 0x0, 0xcb, 0xc6, 0xc9, 0x3a, 0x31, 0x0, 0xfe, 0xf0, 
+0xc0, 0xcd, 0xeb, 0xe, 0x21, 0x68, 0x0, 0xcb, 0xc6, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x79, 0xa7, 0x28, 0x8, 0xcb, 0x18, 0xcb, 0x18, 0xcb, 0x18, 0xcb, 0x18, 0xaf, 0xcb, 0x40, 0x28, 
+0x2, 0xf6, 0x3, 0xcb, 0x48, 0x28, 0x2, 0xf6, 0xc, 0xcb, 0x50, 0x28, 0x2, 0xf6, 0x30, 0xcb, 
+0x58, 0xc8, 0xf6, 0xc0, 0xc9, 0xe5, 0x1a, 0x47, 0xcd, 0x0, 0x10, 0x77, 0xcb, 0xfd, 0x77, 0x13, 
+0x1a, 0x47, 0xcd, 0x0, 0x10, 0xcb, 0xc4, 0x77, 0xcb, 0xbd, 0x77, 0xe1, 0xc9, 0x67, 0x27, 0x77, 
+0x37, 0x98, 0xef, 0xa, 0xb0, 0xf5, 0x78, 0xa7, 0x20, 0xa, 0x11, 0x3d, 0x10, 0x1, 0x4, 0x0, 
+0xed, 0xb0, 0x18, 0xf, 0x21, 0x3d, 0x10, 0x11, 0x3e, 0x10, 0x1, 0x4, 0x0, 0x3a, 0xa3, 0xb7, 
+0x77, 0xed, 0xb0, 0xf1, 0xfe, 0x20, 0x30, 0x4, 0xcd, 0x25, 0xf7, 0xc9, 0xf5, 0xfe, 0x60, 0x30, 
+0xa, 0x2a, 0xa6, 0xb7, 0x11, 0x0, 0x0, 0xd6, 0x20, 0x18, 0x32, 0xfe, 0x80, 0x30, 0xa, 0x2a, 
+0xa8, 0xb7, 0x11, 0x0, 0x1, 0xd6, 0x60, 0x18, 0x24, 0xfe, 0xa0, 0x30, 0xa, 0x2a, 0xac, 0xb7, 
+0x11, 0x0, 0x0, 0xd6, 0x80, 0x18, 0x16, 0xfe, 0xe0, 0x30, 0xa, 0x2a, 0xaa, 0xb7, 0x11, 0x0, 
+0x0, 0xd6, 0xa0, 0x18, 0x8, 0x2a, 0xac, 0xb7, 0x11, 0x0, 0x1, 0xd6, 0xe0, 0x19, 0xe5, 0x57, 
+0xe, 0x8, 0xcd, 0x83, 0xfd, 0x50, 0x5f, 0xe1, 0x19, 0x22, 0x41, 0x10, 0xf1, 0xe, 0x1, 0xf5, 
+0xc5, 0x2a, 0xa0, 0xb7, 0x54, 0xe, 0x8, 0xcd, 0x83, 0xfd, 0x67, 0xcd, 0xbf, 0xe0, 0xed, 0x53, 
+0x43, 0x10, 0xed, 0x5b, 0x41, 0x10, 0xc1, 0xf1, 0xcd, 0x25, 0x10, 0x13, 0xcb, 0xed, 0xcd, 0x25, 
+0x10, 0x13, 0xcb, 0xad, 0xcb, 0xf5, 0xcd, 0x25, 0x10, 0x13, 0xcb, 0xed, 0xcd, 0x25, 0x10, 0x2a, 
+0x43, 0x10, 0x11, 0x3d, 0x10, 0x1a, 0x77, 0xcb, 0xed, 0x13, 0x1a, 0x77, 0xcb, 0xf5, 0xcb, 0xad, 
+0x13, 0x1a, 0x77, 0xcb, 0xed, 0x13, 0x1a, 0x77, 0x3e, 0x9, 0xcd, 0x25, 0xf7, 0x79, 0xa7, 0xc8, 
+0xe, 0x0, 0xc3, 0xbf, 0x10, 0xeb, 0xe3, 0xeb, 0x1a, 0xfe, 0x0, 0x20, 0x3, 0xeb, 0xe3, 0xc9, 
+0xd5, 0xe5, 0xc5, 0xcd, 0x45, 0x10, 0xc1, 0xe1, 0xd1, 0x13, 0x18, 0xec, 0x1a, 0xfe, 0x0, 0xc8, 
+0xc5, 0xd5, 0xe5, 0xcd, 0x45, 0x10, 0xe1, 0xd1, 0xc1, 0x13, 0x18, 0xf0, 0xf7, 0xb7, 0xf7, 0xb7, 
+0xc6, 0x20, 0xff, 0x5, 0x4, 0xe0, 0x0, 0x20, 0x0, 0x0, 0x0, 0xe, 0x8, 0x6, 0x20, 0x21, 
+0x0, 0xa8, 0x7e, 0xa9, 0x77, 0x23, 0x7c, 0xfe, 0xb2, 0x20, 0xf7, 0x3e, 0x8, 0x81, 0x4f, 0xc5, 
+0xe5, 0x21, 0x40, 0x11, 0xcd, 0x8, 0x5, 0x3a, 0x45, 0x11, 0xc6, 0x5, 0x32, 0x45, 0x11, 0x3a, 
+0x47, 0x11, 0xd6, 0x5, 0x32, 0x47, 0x11, 0xe1, 0xc1, 0x10, 0xd4, 0x3a, 0x39, 0x0, 0xf6, 0x80, 
+0x32, 0x3c, 0x11, 0x32, 0x3e, 0x11, 0xee, 0x40, 0x32, 0x3d, 0x11, 0x32, 0x3f, 0x11, 0x21, 0xa, 
+0xe, 0x22, 0xa0, 0xb7, 0x6, 0x0, 0x21, 0x3c, 0x11, 0xcd, 0x15, 0x11, 0x20, 0x56, 0x49, 0x43, 
+0x54, 0x4f, 0x52, 0x59, 0x20, 0x0, 0x3e, 0xff, 0xcd, 0x8, 0xf2, 0x3e, 0xd0, 0xcd, 0x8, 0xf2, 
+0xc9, 0x6, 0x6, 0x1a, 0xbe, 0x28, 0x7, 0x30, 0x3, 0x3e, 0xff, 0xc9, 0xaf, 0xc9, 0x23, 0x13, 
+0x10, 0xf1, 0x3e, 0x80, 0xc9, 0x21, 0x3a, 0x0, 0x11, 0x0, 0xba, 0x6, 0xa, 0xe5, 0xd5, 0xc5, 
+0xcd, 0xb1, 0x11, 0xc1, 0xd1, 0xfe, 0xff, 0x28, 0xe, 0x21, 0x11, 0x0, 0x19, 0xeb, 0xe1, 0x10, 
+0xec, 0x3e, 0x11, 0x32, 0x6a, 0x0, 0xc9, 0xe1, 0xc5, 0xd5, 0x4, 0x50, 0xe, 0x11, 0xcd, 0x83, 
+0xfd, 0x4f, 0x21, 0xba, 0xba, 0x11, 0xcb, 0xba, 0xed, 0xb8, 0xd1, 0x21, 0x3a, 0x0, 0x1, 0x6, 
+0x0, 0xed, 0xb0, 0x21, 0x4d, 0x0, 0x1, 0xa, 0x0, 0xed, 0xb0, 0x3a, 0x41, 0x0, 0x12, 0xc1, 
+0x78, 0xed, 0x44, 0xc6, 0xa, 0xc6, 0x1, 0x27, 0x32, 0x6a, 0x0, 0xc9, 0x10, 0x10, 0x30, 0x30, 
+0xf5, 0xaf, 0xcd, 0xc8, 0x2, 0x21, 0xd, 0x2, 0x22, 0xa0, 0xb7, 0x21, 0x1c, 0x12, 0x6, 0x0, 
+0xcd, 0x15, 0x11, 0x54, 0x4f, 0x50, 0x2d, 0x54, 0x45, 0x4e, 0x0, 0x3e, 0xf0, 0x32, 0xa3, 0xb7, 
+0x21, 0xa, 0x2, 0x22, 0xa0, 0xb7, 0x6, 0x1, 0x3e, 0x89, 0xcd, 0x45, 0x10, 0x21, 0x1c, 0x2, 
+0x22, 0xa0, 0xb7, 0x6, 0x1, 0x3e, 0x88, 0xcd, 0x45, 0x10, 0x3e, 0x38, 0x32, 0xa3, 0xb7, 0x21, 
+0x22, 0x5, 0x22, 0xa0, 0xb7, 0xcd, 0xc6, 0xf1, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x20, 0x20, 0x20, 
+0x50, 0x4c, 0x41, 0x43, 0x45, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x53, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x41, 0x4d, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x47, 0x41, 0x4d, 0x45, 0x0, 0x21, 0x0, 0x7, 0x22, 0xa0, 0xb7, 0x6, 0x26, 0x3e, 0x5f, 0xcd, 
+0x25, 0xf7, 0x10, 0xf9, 0x21, 0x25, 0x1e, 0x22, 0xa0, 0xb7, 0x3e, 0x8d, 0xcd, 0x25, 0xf7, 0xf1, 
+0x6, 0x1, 0x21, 0x3, 0x7, 0x22, 0xa0, 0xb7, 0xf5, 0x78, 0xfe, 0x1, 0x20, 0x4, 0x3e, 0x10, 
+0x18, 0xe, 0xfe, 0x2, 0x28, 0x4, 0xfe, 0x3, 0x20, 0x4, 0x3e, 0x30, 0x18, 0x2, 0x3e, 0x70, 
+0x32, 0xa3, 0xb7, 0x78, 0xc6, 0x0, 0x27, 0x4f, 0xf1, 0xb9, 0xf5, 0x20, 0x5, 0x21, 0xa3, 0xb7, 
+0xcb, 0xfe, 0x2a, 0xa0, 0xb7, 0x24, 0x24, 0x2e, 0x3, 0x78, 0xfe, 0xa, 0x30, 0x1, 0x2c, 0x22, 
+0xa0, 0xb7, 0xc5, 0xe5, 0x78, 0xc6, 0x0, 0x27, 0xcd, 0x4c, 0x6, 0x3e, 0x2e, 0xcd, 0x25, 0xf7, 
+0xe1, 0x2e, 0x8, 0x22, 0xa0, 0xb7, 0xc1, 0xc5, 0x5, 0x48, 0x16, 0x11, 0xcd, 0x83, 0xfd, 0x50, 
+0x5f, 0x21, 0x0, 0xba, 0x19, 0xe5, 0x3e, 0xff, 0xcd, 0x5b, 0x6, 0xcd, 0xc6, 0xf1, 0x20, 0x20, 
+0x20, 0x0, 0xe1, 0x11, 0x6, 0x0, 0x19, 0xe5, 0x6, 0xa, 0x7e, 0xa7, 0x28, 0x6, 0xcd, 0x25, 
+0xf7, 0x23, 0x10, 0xf6, 0x21, 0xa0, 0xb7, 0x36, 0x23, 0xe1, 0x11, 0xa, 0x0, 0x19, 0x7e, 0xcd, 
+0x4c, 0x6, 0xc1, 0x4, 0x78, 0xfe, 0xb, 0x28, 0x4, 0xf1, 0xc3, 0xb8, 0x12, 0xf1, 0xc9, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0xc6, 0x67, 0x0, 0x6, 0x38, 0x40, 0x0, 0xa0, 0x0, 0x0, 0x0, 0xc6, 0x75, 0xff, 0x2, 0x10, 
+0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0xcd, 0x6f, 0x9, 0x21, 0x0, 0x15, 0x22, 0xc, 0x0, 0xcd, 
+0x19, 0x4, 0xfe, 0x0, 0xca, 0x73, 0x1c, 0xcd, 0x82, 0x9, 0xcd, 0x30, 0x7, 0x3e, 0x20, 0x32, 
+0xa3, 0xb7, 0x3a, 0x40, 0x0, 0xed, 0x4b, 0x32, 0x0, 0xed, 0x5b, 0x34, 0x0, 0x2a, 0x36, 0x0, 
+0xcd, 0xe6, 0x2, 0x21, 0x7, 0x1e, 0x22, 0xa0, 0xb7, 0x2a, 0x4a, 0x0, 0xcd, 0xc0, 0xf2, 0x21, 
+0x14, 0x1e, 0x22, 0xa0, 0xb7, 0x3a, 0x49, 0x0, 0xcd, 0x4c, 0x6, 0x21, 0x22, 0x1e, 0x22, 0xa0, 
+0xb7, 0x3a, 0x41, 0x0, 0xcd, 0x4c, 0x6, 0x21, 0x22, 0x1f, 0x22, 0xa0, 0xb7, 0x3a, 0x40, 0x0, 
+0xcd, 0x4c, 0x6, 0x21, 0x7, 0x1f, 0x22, 0xa0, 0xb7, 0x21, 0x3a, 0x0, 0xaf, 0xcd, 0x5b, 0x6, 
+0x2a, 0x0, 0x0, 0x11, 0x50, 0x13, 0x1, 0x70, 0x13, 0x3e, 0x1, 0xcd, 0xc2, 0xc, 0x2a, 0x0, 
+0x0, 0x11, 0xd0, 0x2e, 0x1, 0xd0, 0x32, 0xaf, 0xcd, 0xc2, 0xc, 0x3a, 0x7, 0x0, 0xf5, 0x2a, 
+0xa, 0x0, 0x11, 0x78, 0x13, 0x1, 0x98, 0x13, 0x3e, 0x1, 0xcd, 0xc2, 0xc, 0xf1, 0x3d, 0xca, 
+0x28, 0x15, 0xf5, 0x2a, 0x13, 0x0, 0x11, 0xa0, 0x13, 0x1, 0xc0, 0x13, 0x3e, 0x1, 0xcd, 0xc2, 
+0xc, 0xf1, 0x3d, 0xca, 0x28, 0x15, 0xf5, 0x2a, 0x1c, 0x0, 0x11, 0xc8, 0x13, 0x1, 0xe8, 0x13, 
+0x3e, 0x1, 0xcd, 0xc2, 0xc, 0xf1, 0x3d, 0xca, 0x28, 0x15, 0x2a, 0x25, 0x0, 0x11, 0xf0, 0x13, 
+0x1, 0x10, 0x14, 0x3e, 0x1, 0xcd, 0xc2, 0xc, 0x6, 0x10, 0xc5, 0x21, 0x40, 0x14, 0xcd, 0x8, 
+0x5, 0x3a, 0x42, 0x14, 0xd6, 0x10, 0x32, 0x42, 0x14, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0xc2, 0x44, 
+0x15, 0xc1, 0x10, 0xe6, 0xaf, 0x32, 0x42, 0x14, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0xca, 0x61, 0x17, 
+0xcd, 0xb6, 0x5, 0xf5, 0x2a, 0x0, 0x0, 0xed, 0x5b, 0x2, 0x0, 0xcd, 0xd0, 0x8, 0x78, 0xfe, 
+0x4f, 0xca, 0x9, 0x16, 0xfe, 0x2f, 0xca, 0x15, 0x16, 0xfe, 0x3f, 0xca, 0xb8, 0x16, 0xf1, 0x21, 
+0x2, 0x0, 0x7e, 0xa7, 0x20, 0xb, 0x23, 0x7e, 0xa7, 0x20, 0x6, 0x21, 0xd0, 0x2e, 0x22, 0x5, 
+0x0, 0xaf, 0x32, 0x42, 0x0, 0x2a, 0x0, 0x0, 0x3a, 0x2, 0x0, 0x85, 0x5f, 0x3a, 0x3, 0x0, 
+0x84, 0x57, 0x2a, 0xa, 0x0, 0xaf, 0xed, 0x52, 0xca, 0x18, 0x17, 0x2a, 0x13, 0x0, 0xaf, 0xed, 
+0x52, 0xca, 0x28, 0x17, 0x2a, 0x1c, 0x0, 0xaf, 0xed, 0x52, 0xca, 0x38, 0x17, 0x2a, 0x25, 0x0, 
+0xaf, 0xed, 0x52, 0xca, 0x48, 0x17, 0x2a, 0x0, 0x0, 0x11, 0x50, 0x13, 0x1, 0x70, 0x13, 0xaf, 
+0xcd, 0xc2, 0xc, 0x2a, 0x0, 0x0, 0x3a, 0x2, 0x0, 0x85, 0x6f, 0x3a, 0x3, 0x0, 0x84, 0x67, 
+0x22, 0x0, 0x0, 0x21, 0x4, 0x0, 0x3e, 0x40, 0x86, 0x77, 0xfe, 0x80, 0xdc, 0xfe, 0x15, 0x2a, 
+0x0, 0x0, 0x11, 0x50, 0x13, 0x1, 0x70, 0x13, 0x3e, 0x1, 0xcd, 0xc2, 0xc, 0x2a, 0x0, 0x0, 
+0xed, 0x5b, 0x5, 0x0, 0x1, 0xd0, 0x32, 0xaf, 0xcd, 0xc2, 0xc, 0xc3, 0x61, 0x17, 0x2a, 0x5, 
+0x0, 0x11, 0x20, 0x0, 0x19, 0x22, 0x5, 0x0, 0xc9, 0xf1, 0xfe, 0xff, 0xc2, 0x72, 0x16, 0xcd, 
+0xe8, 0xa, 0xc3, 0x72, 0x16, 0xf1, 0xfe, 0xff, 0xc2, 0x72, 0x16, 0x2a, 0x0, 0x0, 0x3a, 0x2, 
+0x0, 0x85, 0x6f, 0x3a, 0x3, 0x0, 0x84, 0x67, 0xed, 0x5b, 0x2, 0x0, 0xe5, 0xcd, 0xd0, 0x8, 
+0x78, 0xfe, 0x4f, 0xca, 0x7b, 0x16, 0xfe, 0x3f, 0xca, 0x7b, 0x16, 0xfe, 0x2f, 0xca, 0x7b, 0x16, 
+0x3a, 0x2c, 0x0, 0xfe, 0x1, 0xca, 0x7b, 0x16, 0xe1, 0x22, 0x2d, 0x0, 0xed, 0x5b, 0x2, 0x0, 
+0xed, 0x53, 0x30, 0x0, 0x21, 0xf8, 0x32, 0x22, 0x57, 0x0, 0x3e, 0x1, 0x32, 0x2c, 0x0, 0x21, 
+0xb0, 0x32, 0x11, 0x18, 0x14, 0x1, 0x20, 0x0, 0xed, 0xb0, 0x21, 0x10, 0x33, 0x1, 0x8, 0x0, 
+0xed, 0xb0, 0x21, 0x0, 0x0, 0x22, 0x2, 0x0, 0xc3, 0x85, 0x15, 0x21, 0x4b, 0x14, 0xcd, 0x8, 
+0x5, 0xe1, 0x11, 0xb0, 0x31, 0x1, 0xf8, 0x32, 0xaf, 0xcd, 0xc2, 0xc, 0xe5, 0xc5, 0x21, 0x4b, 
+0x14, 0xcd, 0x8, 0x5, 0xc1, 0xe1, 0x11, 0xd0, 0x31, 0xaf, 0xcd, 0xc2, 0xc, 0xe5, 0x21, 0x4b, 
+0x14, 0xcd, 0x8, 0x5, 0xe1, 0x11, 0xb0, 0x32, 0x1, 0x10, 0x33, 0xaf, 0xcd, 0xc2, 0xc, 0x21, 
+0x4b, 0x14, 0xcd, 0x8, 0x5, 0xc3, 0x72, 0x16, 0xf1, 0xfe, 0xff, 0xc2, 0x72, 0x16, 0x2a, 0x0, 
+0x0, 0x3a, 0x2, 0x0, 0x85, 0x6f, 0x3a, 0x3, 0x0, 0x84, 0x67, 0xed, 0x5b, 0x2, 0x0, 0xe5, 
+0xcd, 0xd0, 0x8, 0xe1, 0x78, 0xfe, 0x4f, 0xca, 0x72, 0x16, 0xfe, 0x3f, 0xca, 0x72, 0x16, 0xfe, 
+0x2f, 0xca, 0x72, 0x16, 0x3a, 0x2c, 0x0, 0xfe, 0x1, 0xca, 0x72, 0x16, 0x22, 0x2d, 0x0, 0xed, 
+0x5b, 0x2, 0x0, 0xed, 0x53, 0x30, 0x0, 0x21, 0x0, 0x33, 0x22, 0x57, 0x0, 0x3e, 0x1, 0x32, 
+0x2c, 0x0, 0x21, 0xb0, 0x32, 0x11, 0x18, 0x14, 0x1, 0x20, 0x0, 0xed, 0xb0, 0x21, 0x10, 0x33, 
+0x1, 0x8, 0x0, 0xed, 0xb0, 0xc3, 0x72, 0x16, 0x3a, 0x8, 0x0, 0xfe, 0x0, 0xca, 0xb6, 0x15, 
+0xfe, 0x1, 0xca, 0x58, 0x17, 0xc3, 0x99, 0x1b, 0x3a, 0x11, 0x0, 0xfe, 0x0, 0xca, 0xb6, 0x15, 
+0xfe, 0x1, 0xca, 0x58, 0x17, 0xc3, 0x99, 0x1b, 0x3a, 0x1a, 0x0, 0xfe, 0x0, 0xca, 0xb6, 0x15, 
+0xfe, 0x1, 0xca, 0x58, 0x17, 0xc3, 0x99, 0x1b, 0x3a, 0x23, 0x0, 0xfe, 0x0, 0xca, 0xb6, 0x15, 
+0xfe, 0x1, 0xca, 0x58, 0x17, 0xc3, 0x99, 0x1b, 0x21, 0x0, 0x0, 0x22, 0x2, 0x0, 0xc3, 0xb6, 
+0x15, 0x3a, 0x39, 0x0, 0xfe, 0xf, 0x28, 0xb, 0x3a, 0x69, 0x0, 0x2f, 0x32, 0x69, 0x0, 0xcb, 
+0x47, 0x28, 0x3, 0xcd, 0xf0, 0x17, 0xcd, 0x72, 0x5, 0xcd, 0xf6, 0x9, 0x3a, 0x39, 0x0, 0xfe, 
+0x77, 0x20, 0x2, 0x6, 0x10, 0xfe, 0x17, 0x20, 0x2, 0x6, 0xd, 0xfe, 0x37, 0x20, 0x2, 0x6, 
+0x9, 0xfe, 0xf, 0x20, 0x2, 0x6, 0x9, 0x78, 0xcd, 0x8, 0xf2, 0x3a, 0x4a, 0x0, 0xd6, 0x1, 
+0x27, 0x32, 0x4a, 0x0, 0x30, 0xe, 0x3a, 0x4b, 0x0, 0xfe, 0x0, 0xca, 0x69, 0x1b, 0xd6, 0x1, 
+0x27, 0x32, 0x4b, 0x0, 0x21, 0x7, 0x1e, 0x22, 0xa0, 0xb7, 0x2a, 0x4a, 0x0, 0xcd, 0xc0, 0xf2, 
+0x3a, 0x2c, 0x0, 0xfe, 0x0, 0xc2, 0x48, 0x15, 0xcd, 0x45, 0xc, 0xd2, 0x48, 0x15, 0x3a, 0x41, 
+0x0, 0xed, 0x5b, 0x4a, 0x0, 0xcd, 0xde, 0x8, 0x21, 0x0, 0x0, 0x22, 0xa, 0x0, 0x22, 0x13, 
+0x0, 0x22, 0x1c, 0x0, 0x22, 0x25, 0x0, 0xcd, 0xca, 0x9, 0xcd, 0x4b, 0x11, 0xc3, 0x5f, 0x14, 
+0xaf, 0x32, 0x59, 0x0, 0x3a, 0x59, 0x0, 0x3c, 0x32, 0x59, 0x0, 0x47, 0x3a, 0x7, 0x0, 0x3c, 
+0xb8, 0xc8, 0x3a, 0x59, 0x0, 0x3d, 0x57, 0xe, 0x9, 0xcd, 0x83, 0xfd, 0x50, 0x5f, 0x21, 0x8, 
+0x0, 0x19, 0x11, 0x5a, 0x0, 0x1, 0x9, 0x0, 0xed, 0xb0, 0x3a, 0x59, 0x0, 0x3d, 0x57, 0xe, 
+0x28, 0xcd, 0x83, 0xfd, 0x60, 0x6f, 0x11, 0x78, 0x13, 0x19, 0x22, 0x63, 0x0, 0x11, 0x20, 0x0, 
+0x19, 0x22, 0x65, 0x0, 0xcd, 0x52, 0x18, 0x3a, 0x59, 0x0, 0x3d, 0x57, 0xe, 0x9, 0xcd, 0x83, 
+0xfd, 0x50, 0x5f, 0x21, 0x8, 0x0, 0x19, 0xeb, 0x21, 0x5a, 0x0, 0x1, 0x9, 0x0, 0xed, 0xb0, 
+0x18, 0xa2, 0x3a, 0x5a, 0x0, 0xfe, 0x0, 0xca, 0xd7, 0x18, 0xfe, 0x1, 0xca, 0x4d, 0x19, 0x3a, 
+0x5b, 0x0, 0xfe, 0x0, 0xc2, 0x77, 0x19, 0x2a, 0x5c, 0x0, 0xed, 0x5b, 0x63, 0x0, 0xed, 0x4b, 
+0x65, 0x0, 0xaf, 0xcd, 0xc2, 0xc, 0xcd, 0x10, 0x1a, 0xaf, 0x2a, 0x5c, 0x0, 0xed, 0x5b, 0x0, 
+0x0, 0xed, 0x52, 0xca, 0x98, 0x1b, 0x2a, 0x5c, 0x0, 0xed, 0x5b, 0x63, 0x0, 0xed, 0x4b, 0x65, 
+0x0, 0x3e, 0x1, 0xcd, 0xc2, 0xc, 0x11, 0xd0, 0x2f, 0x3a, 0x60, 0x0, 0xfe, 0x2, 0x20, 0x3, 
+0x11, 0x50, 0x30, 0xfe, 0xfe, 0x20, 0x3, 0x11, 0x90, 0x2f, 0x3a, 0x61, 0x0, 0xfe, 0x10, 0x20, 
+0x3, 0x11, 0xd0, 0x2f, 0xfe, 0xf0, 0x20, 0x3, 0x11, 0x10, 0x30, 0x3a, 0x62, 0x0, 0xc6, 0x40, 
+0x32, 0x62, 0x0, 0xfe, 0x80, 0x30, 0x5, 0x21, 0x20, 0x0, 0x19, 0xeb, 0x2a, 0x5c, 0x0, 0x1, 
+0xd8, 0x32, 0xaf, 0xcd, 0xc2, 0xc, 0xc9, 0x3a, 0x5b, 0x0, 0x3d, 0x32, 0x5b, 0x0, 0x2a, 0x5c, 
+0x0, 0xcd, 0xbf, 0xe0, 0x3a, 0x39, 0x0, 0x47, 0x1a, 0xb8, 0x20, 0x59, 0x1, 0xd8, 0x32, 0x3a, 
+0x5b, 0x0, 0xfe, 0x0, 0x28, 0x2c, 0xfe, 0x4, 0x30, 0xb, 0x2a, 0x5c, 0x0, 0x11, 0xd0, 0x30, 
+0xaf, 0xcd, 0xc2, 0xc, 0xc9, 0xfe, 0x8, 0x30, 0xb, 0x2a, 0x5c, 0x0, 0x11, 0xb0, 0x30, 0xaf, 
+0xcd, 0xc2, 0xc, 0xc9, 0xfe, 0xc, 0xd0, 0x2a, 0x5c, 0x0, 0x11, 0x90, 0x30, 0xaf, 0xcd, 0xc2, 
+0xc, 0xc9, 0x2a, 0x5c, 0x0, 0x11, 0xb0, 0x32, 0x1, 0x10, 0x33, 0xaf, 0xcd, 0xc2, 0xc, 0x3e, 
+0x2, 0x32, 0x5a, 0x0, 0x2a, 0x5c, 0x0, 0xed, 0x5b, 0x63, 0x0, 0xed, 0x4b, 0x65, 0x0, 0x3e, 
+0x1, 0xcd, 0xc2, 0xc, 0xc9, 0x3a, 0x5b, 0x0, 0xfe, 0x0, 0xc0, 0x18, 0xe2, 0x3a, 0x5b, 0x0, 
+0x3d, 0x32, 0x5b, 0x0, 0xfe, 0x0, 0x28, 0xca, 0x11, 0x20, 0x33, 0x3a, 0x62, 0x0, 0xc6, 0x40, 
+0x32, 0x62, 0x0, 0xfe, 0x80, 0x30, 0x5, 0x21, 0x20, 0x0, 0x19, 0xeb, 0x2a, 0x5c, 0x0, 0x1, 
+0x18, 0x33, 0xaf, 0xcd, 0xc2, 0xc, 0xc9, 0x3a, 0x5b, 0x0, 0x3d, 0x32, 0x5b, 0x0, 0xfe, 0x0, 
+0x28, 0x3e, 0x3a, 0x60, 0x0, 0xfe, 0xfe, 0x20, 0x3, 0x11, 0x90, 0x2f, 0xfe, 0x2, 0x20, 0x3, 
+0x11, 0x50, 0x30, 0x3a, 0x61, 0x0, 0xfe, 0x10, 0x20, 0x3, 0x11, 0xd0, 0x2f, 0xfe, 0xf0, 0x20, 
+0x3, 0x11, 0x10, 0x30, 0x3a, 0x62, 0x0, 0xc6, 0x40, 0x32, 0x62, 0x0, 0xfe, 0x80, 0x30, 0x5, 
+0x21, 0x20, 0x0, 0x19, 0xeb, 0x2a, 0x5c, 0x0, 0x1, 0xd8, 0x32, 0xaf, 0xcd, 0xc2, 0xc, 0xc9, 
+0x2a, 0x5c, 0x0, 0xed, 0x5b, 0x60, 0x0, 0x7b, 0x85, 0x6f, 0x7a, 0x84, 0x67, 0xe5, 0xcd, 0xbf, 
+0xe0, 0xe1, 0x1a, 0xfe, 0x2f, 0x28, 0xd, 0x21, 0x60, 0x0, 0x7e, 0xed, 0x44, 0x77, 0x23, 0x7e, 
+0xed, 0x44, 0x77, 0xc9, 0x11, 0xb0, 0x31, 0x1, 0xf8, 0x32, 0xaf, 0xe5, 0xc5, 0xcd, 0xc2, 0xc, 
+0x3e, 0x3, 0xcd, 0x8, 0xf2, 0xc1, 0xe1, 0x11, 0xd0, 0x31, 0xaf, 0xe5, 0xcd, 0xc2, 0xc, 0x3e, 
+0x6, 0xcd, 0x8, 0xf2, 0xe1, 0x11, 0xb0, 0x32, 0x1, 0x10, 0x33, 0xaf, 0xcd, 0xc2, 0xc, 0xc9, 
+0xaf, 0x32, 0x68, 0x0, 0x3a, 0x60, 0x0, 0xa7, 0x20, 0xe, 0x3a, 0x61, 0x0, 0xa7, 0x20, 0x8, 
+0xcd, 0xae, 0xe, 0x21, 0x68, 0x0, 0xcb, 0xc6, 0xcd, 0x55, 0xf, 0x3a, 0x39, 0x0, 0xfe, 0x77, 
+0x28, 0xb, 0xcd, 0x96, 0xf, 0x21, 0x68, 0x0, 0xcb, 0x46, 0xc2, 0x96, 0x1a, 0x3a, 0x1, 0x0, 
+0x21, 0x5d, 0x0, 0xbe, 0x20, 0xb, 0xcd, 0x80, 0xe, 0x21, 0x68, 0x0, 0xcb, 0xc6, 0xc3, 0x96, 
+0x1a, 0x3a, 0x0, 0x0, 0x21, 0x5c, 0x0, 0xbe, 0x20, 0xb, 0xcd, 0x97, 0xe, 0x21, 0x68, 0x0, 
+0xcb, 0xc6, 0xc3, 0x96, 0x1a, 0x3a, 0x67, 0x0, 0xfe, 0x3, 0x20, 0x8, 0x21, 0x68, 0x0, 0xcb, 
+0xc6, 0xc3, 0x96, 0x1a, 0xfe, 0x2, 0x20, 0x8, 0x21, 0x68, 0x0, 0xcb, 0xd6, 0xc3, 0x96, 0x1a, 
+0xcd, 0xae, 0xe, 0x3a, 0x61, 0x0, 0xa7, 0x28, 0x8, 0x21, 0x68, 0x0, 0xcb, 0xe6, 0xc3, 0x96, 
+0x1a, 0x21, 0x68, 0x0, 0xcb, 0xde, 0x2a, 0x5c, 0x0, 0xed, 0x5b, 0x60, 0x0, 0xcd, 0xd0, 0x8, 
+0x78, 0xfe, 0x2f, 0xca, 0x14, 0x1b, 0xfe, 0x3f, 0xca, 0x14, 0x1b, 0xfe, 0x4f, 0xca, 0x14, 0x1b, 
+0x2a, 0x5c, 0x0, 0x3a, 0x60, 0x0, 0x85, 0x5f, 0x3a, 0x61, 0x0, 0x84, 0x57, 0x2a, 0xa, 0x0, 
+0xaf, 0xed, 0x52, 0x20, 0x6, 0x3a, 0x8, 0x0, 0xa7, 0x20, 0x3c, 0x2a, 0x13, 0x0, 0xaf, 0xed, 
+0x52, 0x20, 0x6, 0x3a, 0x11, 0x0, 0xa7, 0x20, 0x2e, 0x2a, 0x1c, 0x0, 0xaf, 0xed, 0x52, 0x20, 
+0x6, 0x3a, 0x1a, 0x0, 0xa7, 0x20, 0x20, 0x2a, 0x25, 0x0, 0xaf, 0xed, 0x52, 0x20, 0x6, 0x3a, 
+0x23, 0x0, 0xa7, 0x20, 0x12, 0x3a, 0x2c, 0x0, 0xa7, 0x28, 0x7, 0x2a, 0x2d, 0x0, 0xaf, 0xed, 
+0x52, 0xc8, 0xed, 0x53, 0x5c, 0x0, 0xc9, 0x21, 0x60, 0x0, 0x7e, 0xed, 0x44, 0x77, 0x23, 0x7e, 
+0xed, 0x44, 0x77, 0xc9, 0x3a, 0x68, 0x0, 0xcb, 0x47, 0x28, 0x4, 0xcd, 0x35, 0xf, 0xc9, 0xcb, 
+0x57, 0x28, 0x6, 0xcd, 0x0, 0xf, 0xc3, 0xb0, 0x1a, 0xcb, 0x5f, 0x28, 0x16, 0xcb, 0x67, 0x28, 
+0x7, 0xcd, 0xae, 0xe, 0xcd, 0x35, 0xf, 0xc9, 0x21, 0x68, 0x0, 0xcb, 0xe6, 0xcd, 0x97, 0xe, 
+0xc3, 0x96, 0x1a, 0xcb, 0x67, 0xca, 0xb0, 0x1a, 0x21, 0x68, 0x0, 0xcb, 0xde, 0xcd, 0x80, 0xe, 
+0xc3, 0x96, 0x1a, 0xc6, 0xc, 0xff, 0x4, 0xc0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xc6, 0x6, 
+0xff, 0x4, 0x20, 0x50, 0x0, 0x78, 0x0, 0x0, 0x0, 0x21, 0x53, 0x1b, 0xcd, 0x8, 0x5, 0x3e, 
+0x7, 0x32, 0xa3, 0xb7, 0x21, 0x8, 0xe, 0x22, 0xa0, 0xb7, 0x6, 0x1, 0xcd, 0x15, 0x11, 0x4e, 
+0x4f, 0x20, 0x4d, 0x4f, 0x52, 0x45, 0x20, 0x54, 0x49, 0x4d, 0x45, 0x0, 0x3e, 0xff, 0xcd, 0x8, 
+0xf2, 0x3e, 0x80, 0xcd, 0x8, 0xf2, 0x18, 0x6c, 0xe1, 0x62, 0x6b, 0xe5, 0x2a, 0x0, 0x0, 0x11, 
+0xb0, 0x32, 0x1, 0x10, 0x33, 0xaf, 0xcd, 0xc2, 0xc, 0xe1, 0x11, 0x10, 0x31, 0x1, 0xe0, 0x32, 
+0xe5, 0xaf, 0xcd, 0xc2, 0xc, 0x21, 0x5e, 0x1b, 0xcd, 0x8, 0x5, 0x3e, 0x30, 0xcd, 0x8, 0xf2, 
+0xe1, 0x11, 0x30, 0x31, 0x1, 0xe8, 0x32, 0xe5, 0xaf, 0xcd, 0xc2, 0xc, 0x21, 0x5e, 0x1b, 0xcd, 
+0x8, 0x5, 0x3e, 0x20, 0xcd, 0x8, 0xf2, 0xe1, 0x11, 0x50, 0x31, 0x1, 0xf0, 0x32, 0xe5, 0xaf, 
+0xcd, 0xc2, 0xc, 0x21, 0x5e, 0x1b, 0xcd, 0x8, 0x5, 0x3e, 0x10, 0xcd, 0x8, 0xf2, 0xe1, 0x11, 
+0x70, 0x31, 0x1, 0xd8, 0x32, 0xaf, 0xcd, 0xc2, 0xc, 0x21, 0x5e, 0x1b, 0xcd, 0x8, 0x5, 0x3e, 
+0xff, 0xcd, 0x8, 0xf2, 0xcd, 0xca, 0x9, 0x3a, 0x49, 0x0, 0xd6, 0x1, 0x27, 0x32, 0x49, 0x0, 
+0xa7, 0x28, 0x18, 0x21, 0x0, 0x0, 0x22, 0xa, 0x0, 0x22, 0x13, 0x0, 0x22, 0x1c, 0x0, 0x22, 
+0x25, 0x0, 0xcd, 0x25, 0x4, 0xcd, 0x82, 0x9, 0xc3, 0x6d, 0x14, 0x3e, 0x32, 0x32, 0xa3, 0xb7, 
+0x21, 0x0, 0xe, 0x22, 0xa0, 0xb7, 0x6, 0x1, 0xcd, 0x15, 0x11, 0x20, 0x20, 0x2a, 0x2a, 0x2a, 
+0x20, 0x47, 0x41, 0x4d, 0x45, 0x20, 0x4f, 0x56, 0x45, 0x52, 0x20, 0x2a, 0x2a, 0x2a, 0x20, 0x20, 
+0x0, 0x3e, 0xff, 0xcd, 0x8, 0xf2, 0x3e, 0x80, 0xcd, 0x8, 0xf2, 0xcd, 0xc5, 0x11, 0x3a, 0x6a, 
+0x0, 0xcd, 0x20, 0x12, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0x20, 0xf9, 0x31, 0xc4, 0x1, 0x21, 0xd1, 
+0x1f, 0xe3, 0xc9, 0x2a, 0xc, 0x0, 0x6, 0x5, 0x7c, 0x90, 0xfe, 0x5, 0x28, 0x1, 0x67, 0x22, 
+0xc, 0x0, 0xaf, 0x32, 0x38, 0x0, 0xc3, 0x5f, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0xc6, 0xa, 0xff, 0x3, 0x18, 0x88, 0x0, 0x90, 0x0, 0x0, 0x0, 0xc6, 0xc, 0xff, 0x3, 0x10, 
+0x98, 0x0, 0xa0, 0x0, 0x0, 0x0, 0xe3, 0x7e, 0xe5, 0xf5, 0xfe, 0x21, 0x38, 0x5, 0x21, 0x90, 
+0x1c, 0x18, 0x3, 0x21, 0x9b, 0x1c, 0xcd, 0x8, 0x5, 0xf1, 0xcd, 0x25, 0xf7, 0xe1, 0x23, 0xfe, 
+0x0, 0x20, 0xe4, 0xe3, 0xc9, 0xf5, 0xcd, 0xca, 0x9, 0xf1, 0xfe, 0x0, 0x20, 0x3, 0x1, 0x20, 
+0x3, 0xfe, 0x1, 0x20, 0x3, 0x1, 0x1a, 0xa, 0xfe, 0x2, 0x20, 0x3, 0x1, 0x12, 0x13, 0xfe, 
+0x3, 0x20, 0x3, 0x1, 0x9, 0x1d, 0x79, 0x32, 0x6b, 0x0, 0x78, 0x32, 0x38, 0x0, 0xcd, 0x19, 
+0x4, 0xc9, 0x0, 0x0, 0x28, 0x20, 0x0, 0x0, 0x0, 0x7, 0x37, 0xf8, 0x1, 0xa, 0xe, 0xc, 
+0x0, 0x0, 0x0, 0x7, 0x7d, 0xf7, 0x11, 0x1, 0xe, 0x5, 0x0, 0x0, 0x0, 0x7, 0x37, 0xf8, 
+0x14, 0x4, 0xa, 0x1, 0x0, 0x0, 0x0, 0x5, 0x37, 0xf8, 0x1, 0x1, 0xe, 0x8, 0x0, 0x0, 
+0x0, 0x7, 0x37, 0xf8, 0x0, 0xd6, 0x2, 0xff, 0x3, 0x20, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 
+0x9, 0x8, 0xb, 0xa, 0x77, 0x27, 0x67, 0x37, 0x37, 0x67, 0x27, 0x77, 0x7f, 0x7f, 0x50, 0x45, 
+0x4e, 0x47, 0x4f, 0x1, 0x21, 0x38, 0x36, 0x22, 0xaa, 0xb7, 0x21, 0x0, 0xba, 0x11, 0x1, 0xba, 
+0x1, 0x0, 0x1, 0x36, 0x0, 0xed, 0xb0, 0x21, 0x30, 0x1d, 0x11, 0x45, 0x0, 0x1, 0x4, 0x0, 
+0xed, 0xb0, 0x21, 0xf2, 0x1c, 0x11, 0x9c, 0xb9, 0x1, 0x32, 0x0, 0xed, 0xb0, 0x3e, 0x5, 0x32, 
+0x98, 0xb7, 0x3e, 0x0, 0xcd, 0x6a, 0xfc, 0x3e, 0x7, 0xcd, 0xc8, 0x2, 0x6, 0x40, 0xc5, 0x21, 
+0x5, 0x2, 0x22, 0xa0, 0xb7, 0x6, 0x0, 0x21, 0x34, 0x1d, 0xcd, 0x15, 0x11, 0x53, 0x4f, 0x57, 
+0x41, 0x43, 0x4f, 0x20, 0x0, 0x21, 0x38, 0x1d, 0x6, 0x0, 0xcd, 0x15, 0x11, 0x50, 0x52, 0x45, 
+0x53, 0x45, 0x4e, 0x54, 0x53, 0x0, 0x21, 0x34, 0x1d, 0x11, 0x35, 0x1d, 0x4e, 0x6, 0x3, 0x1a, 
+0x77, 0x23, 0x13, 0x10, 0xfa, 0x71, 0x21, 0x3b, 0x1d, 0x11, 0x3a, 0x1d, 0x4e, 0x6, 0x3, 0x1a, 
+0x77, 0x2b, 0x1b, 0x10, 0xfa, 0x71, 0xc1, 0x10, 0xb5, 0x6, 0x10, 0xc5, 0x21, 0x25, 0x1d, 0xcd, 
+0x8, 0x5, 0x3a, 0x2a, 0x1d, 0xc6, 0x10, 0x32, 0x2a, 0x1d, 0x3a, 0x2c, 0x1d, 0xd6, 0x10, 0x32, 
+0x2c, 0x1d, 0xc1, 0x10, 0xe6, 0x26, 0x5, 0xaf, 0xcd, 0xa9, 0x6, 0x3e, 0xff, 0xcd, 0x8, 0xf2, 
+0x3e, 0x27, 0x32, 0xa3, 0xb7, 0x21, 0x7, 0xf, 0x22, 0xa0, 0xb7, 0xcd, 0xa6, 0x1c, 0x61, 0x6e, 
+0x20, 0x41, 0x2e, 0x57, 0x65, 0x69, 0x73, 0x73, 0x66, 0x6c, 0x6f, 0x67, 0x2d, 0x70, 0x72, 0x6f, 
+0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0, 0x3e, 0x80, 0xcd, 0x8, 0xf2, 0x3e, 0x77, 0x32, 
+0xa3, 0xb7, 0x21, 0x5, 0x11, 0x22, 0xa0, 0xb7, 0xcd, 0xa6, 0x1c, 0xa8, 0x20, 0x31, 0x39, 0x38, 
+0x38, 0x20, 0x20, 0x4d, 0x61, 0x64, 0x65, 0x20, 0x62, 0x79, 0x20, 0x53, 0x4f, 0x57, 0x41, 0x43, 
+0x4f, 0x6a, 0x6f, 0x79, 0x77, 0x61, 0x72, 0x65, 0x0, 0xcd, 0xc6, 0xf1, 0xa, 0xa, 0xd, 0x20, 
+0x20, 0x0, 0x3e, 0x80, 0xcd, 0x8, 0xf2, 0x3e, 0x37, 0x32, 0xa3, 0xb7, 0xcd, 0xa6, 0x1c, 0x3e, 
+0x45, 0x4e, 0x54, 0x45, 0x52, 0x3c, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 
+0xa, 0xd, 0x20, 0x20, 0x3e, 0x53, 0x50, 0x41, 0x43, 0x45, 0x3c, 0x20, 0x20, 0x6f, 0x74, 0x68, 
+0x65, 0x72, 0x20, 0x73, 0x6e, 0x6f, 0x77, 0x62, 0x65, 0x65, 0x73, 0x0, 0x3e, 0x80, 0xcd, 0x8, 
+0xf2, 0x1, 0x8, 0x33, 0x21, 0x0, 0xb0, 0x11, 0x30, 0x32, 0xc5, 0xaf, 0xcd, 0xc2, 0xc, 0xc1, 
+0x21, 0x26, 0xb0, 0x11, 0x70, 0x32, 0xc5, 0xaf, 0xcd, 0xc2, 0xc, 0xc1, 0x21, 0x0, 0xf0, 0x11, 
+0x50, 0x32, 0xc5, 0xaf, 0xcd, 0xc2, 0xc, 0xc1, 0x21, 0x26, 0xf0, 0x11, 0x90, 0x32, 0xaf, 0xcd, 
+0xc2, 0xc, 0x21, 0x2, 0xb0, 0x6, 0x12, 0xc5, 0x11, 0x10, 0x32, 0x1, 0x8, 0x33, 0xaf, 0xe5, 
+0xd5, 0xc5, 0xcd, 0xc2, 0xc, 0xc1, 0xd1, 0xe1, 0x26, 0xf0, 0xe5, 0xaf, 0xcd, 0xc2, 0xc, 0xe1, 
+0x26, 0xb0, 0x2c, 0x2c, 0xc1, 0x10, 0xe0, 0x21, 0x0, 0xc0, 0x6, 0x3, 0xc5, 0x11, 0xf0, 0x31, 
+0x1, 0x8, 0x33, 0xaf, 0xd5, 0xc5, 0xe5, 0xcd, 0xc2, 0xc, 0xe1, 0x2e, 0x26, 0xc1, 0xd1, 0xe5, 
+0xaf, 0xcd, 0xc2, 0xc, 0xe1, 0x3e, 0x10, 0x84, 0x67, 0x2e, 0x0, 0xc1, 0x10, 0xde, 0x21, 0x4, 
+0xd0, 0x6, 0x10, 0xc5, 0x11, 0x90, 0x31, 0x1, 0xf8, 0x32, 0xaf, 0xe5, 0xcd, 0xc2, 0xc, 0xe1, 
+0x2c, 0x2c, 0xc1, 0x10, 0xee, 0xcd, 0x6f, 0x9, 0xaf, 0x32, 0x6c, 0x0, 0xcd, 0xc5, 0x1c, 0x21, 
+0xc, 0xc0, 0x22, 0xa, 0x0, 0x2e, 0x10, 0x22, 0x13, 0x0, 0x2e, 0x14, 0x22, 0x1c, 0x0, 0x2e, 
+0x18, 0x22, 0x25, 0x0, 0x21, 0xfe, 0x0, 0x22, 0xe, 0x0, 0x22, 0x17, 0x0, 0x22, 0x20, 0x0, 
+0x22, 0x29, 0x0, 0x3e, 0x2, 0x32, 0x8, 0x0, 0x32, 0x11, 0x0, 0x32, 0x1a, 0x0, 0x32, 0x23, 
+0x0, 0xaf, 0x32, 0x9, 0x0, 0x32, 0x12, 0x0, 0x32, 0x1b, 0x0, 0x32, 0x24, 0x0, 0x21, 0x0, 
+0x0, 0x22, 0x0, 0x0, 0x21, 0xb0, 0x32, 0x11, 0x78, 0x13, 0x1, 0x20, 0x0, 0xed, 0xb0, 0x21, 
+0x10, 0x33, 0x1, 0x8, 0x0, 0xed, 0xb0, 0x21, 0x78, 0x13, 0x1, 0x28, 0x0, 0xed, 0xb0, 0x1, 
+0x28, 0x0, 0xed, 0xb0, 0x1, 0x28, 0x0, 0xed, 0xb0, 0xcd, 0xf0, 0x17, 0xcd, 0x72, 0x5, 0x3a, 
+0x6b, 0x0, 0xcd, 0x8, 0xf2, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0x28, 0x1e, 0xfe, 0x20, 0x28, 0x2, 
+0x18, 0xe7, 0x3a, 0x6c, 0x0, 0x3c, 0xfe, 0x4, 0x20, 0x1, 0xaf, 0x32, 0x6c, 0x0, 0xcd, 0xc5, 
+0x1c, 0x21, 0x90, 0x1c, 0xcd, 0x8, 0x5, 0xc3, 0x53, 0x1f, 0xcd, 0xca, 0x9, 0x21, 0x90, 0x1c, 
+0xcd, 0x8, 0x5, 0x3e, 0x0, 0xcd, 0xc8, 0x2, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x3e, 0x1, 0xcd, 
+0x6a, 0xfc, 0x3e, 0xc, 0xcd, 0x25, 0xf7, 0x3e, 0x2, 0xcd, 0x6a, 0xfc, 0x3e, 0xc, 0xcd, 0x25, 
+0xf7, 0x3e, 0x4, 0xcd, 0x6a, 0xfc, 0x3e, 0xc, 0xcd, 0x25, 0xf7, 0x3e, 0x0, 0xcd, 0x6a, 0xfc, 
+0x3e, 0x11, 0xcd, 0x25, 0xf7, 0x26, 0x17, 0x3e, 0xff, 0xcd, 0xa9, 0x6, 0x3e, 0x4, 0xcd, 0x6a, 
+0xfc, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0xc6, 0xf1, 0x10, 0xa, 0x20, 0x4b, 0x45, 0x59, 0x53, 
+0x3a, 0xa, 0xd, 0xa, 0x20, 0x20, 0x52, 0x49, 0x47, 0x48, 0x54, 0x20, 0x20, 0x20, 0x3e, 0x20, 
+0x3c, 0xd, 0xa, 0x20, 0x20, 0x4c, 0x45, 0x46, 0x54, 0x20, 0x20, 0x20, 0x20, 0x3e, 0x20, 0x3c, 
+0xd, 0xa, 0x20, 0x20, 0x46, 0x4f, 0x52, 0x57, 0x41, 0x52, 0x44, 0x20, 0x3e, 0x20, 0x3c, 0xd, 
+0xa, 0x20, 0x20, 0x42, 0x41, 0x43, 0x4b, 0x20, 0x20, 0x20, 0x20, 0x3e, 0x20, 0x3c, 0x10, 0xa, 
+0xa, 0x0, 0x3e, 0x37, 0x32, 0xa3, 0xb7, 0x21, 0x45, 0x0, 0x6, 0x4, 0xcd, 0xc6, 0xf1, 0xd, 
+0xa, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x0, 0x3e, 0x8, 0x32, 
+0xa2, 0xb7, 0x7e, 0xcd, 0x25, 0xf7, 0xaf, 0x32, 0xa2, 0xb7, 0x23, 0x10, 0xdf, 0x3e, 0x7, 0x32, 
+0xa3, 0xb7, 0xaf, 0xcd, 0x6a, 0xfc, 0x3e, 0x30, 0x32, 0xa3, 0xb7, 0x21, 0x11, 0xa, 0x22, 0x9c, 
+0xb7, 0x21, 0x13, 0xa, 0x22, 0x9e, 0xb7, 0x21, 0x0, 0x0, 0x22, 0xa0, 0xb7, 0x3a, 0xe6, 0x24, 
+0xfe, 0x0, 0x20, 0x24, 0xcd, 0xc6, 0xf1, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74, 
+0x68, 0x65, 0xd, 0xa, 0x6f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x61, 0x6c, 0x2d, 0x70, 0x72, 0x6f, 
+0x67, 0x72, 0x61, 0x6d, 0x2e, 0x0, 0x18, 0x59, 0xfe, 0x99, 0x20, 0x22, 0xcd, 0xc6, 0xf1, 0x54, 
+0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6f, 0x6c, 
+0x64, 0xd, 0xa, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x2e, 0x0, 0x18, 0x33, 0xcd, 0xc6, 
+0xf1, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x70, 0x79, 0xd, 
+0xa, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0xd, 0xa, 0x0, 0x3a, 0xe6, 0x24, 0xcd, 0x4c, 
+0x6, 0xcd, 0xc6, 0xf1, 0x2e, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 
+0x0, 0x21, 0x0, 0x4, 0x22, 0xa0, 0xb7, 0xcd, 0xc6, 0xf1, 0x41, 0x6c, 0x6c, 0x20, 0x63, 0x6f, 
+0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x62, 0x79, 0xa, 0xd, 0xa, 0x20, 0x41, 
+0x6e, 0x64, 0x72, 0x65, 0x20, 0x57, 0x65, 0x69, 0x73, 0x73, 0x66, 0x6c, 0x6f, 0x67, 0xd, 0xa, 
+0x20, 0x4b, 0x61, 0x72, 0x6c, 0x73, 0x62, 0x61, 0x64, 0x65, 0x72, 0x20, 0x53, 0x74, 0x72, 0x2e, 
+0x31, 0x33, 0xd, 0xa, 0x20, 0x45, 0x52, 0x4c, 0x41, 0x20, 0x28, 0x47, 0x44, 0x52, 0x29, 0xd, 
+0xa, 0x20, 0x39, 0x34, 0x33, 0x35, 0x0, 0x3e, 0x28, 0x32, 0xa3, 0xb7, 0x21, 0x0, 0x0, 0x22, 
+0x9c, 0xb7, 0x21, 0x28, 0x20, 0x22, 0x9e, 0xb7, 0x21, 0x1f, 0x15, 0x22, 0xa0, 0xb7, 0xcd, 0xc6, 
+0xf1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa3, 0xa7, 0x0, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x3e, 0x1, 
+0xcd, 0x6a, 0xfc, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0xc6, 0xf1, 0xc, 0xa, 0x20, 0x3e, 0x3e, 
+0x3e, 0x20, 0x4d, 0x45, 0x4e, 0x55, 0x20, 0x3c, 0x3c, 0x3c, 0xa, 0xd, 0xa, 0x3e, 0x47, 0x41, 
+0x4d, 0x45, 0xd, 0xa, 0x3e, 0xd, 0xa, 0x3e, 0x4d, 0x45, 0x4e, 0x55, 0xd, 0xa, 0x3e, 0x4e, 
+0x45, 0x57, 0xd, 0xa, 0x3e, 0x43, 0x53, 0x41, 0x56, 0x45, 0xd, 0xa, 0x3e, 0x4b, 0x45, 0x59, 
+0x53, 0xd, 0xa, 0x3e, 0x43, 0x48, 0x41, 0x52, 0x54, 0xd, 0xa, 0x3e, 0x49, 0x4e, 0x53, 0x54, 
+0x52, 0x55, 0x43, 0x54, 0xd, 0xa, 0x3e, 0x0, 0x18, 0x5, 0xcd, 0xc6, 0xf1, 0x3e, 0x0, 0xcd, 
+0xa4, 0xf2, 0x13, 0x1a, 0xfe, 0x20, 0x28, 0xf2, 0xa7, 0x28, 0xef, 0x3e, 0xbc, 0x21, 0x54, 0x22, 
+0x1, 0x70, 0x0, 0xcd, 0x9d, 0xf1, 0x30, 0x7, 0xe5, 0xcd, 0x38, 0xf3, 0x30, 0x10, 0xe1, 0x3e, 
+0x17, 0x32, 0xa3, 0xb7, 0xcd, 0xcd, 0xf2, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x18, 0xcc, 0x21, 0xa, 
+0x22, 0xe3, 0xe5, 0xcd, 0x4c, 0xf4, 0xe3, 0x7e, 0xa7, 0x20, 0x6, 0xdb, 0x88, 0xcb, 0x97, 0xd3, 
+0x88, 0x23, 0xe3, 0xc9, 0xbc, 0xbc, 0x47, 0x41, 0x4d, 0x45, 0x1, 0xc3, 0x21, 0x23, 0xbc, 0xbc, 
+0x4d, 0x45, 0x4e, 0x55, 0x1, 0x21, 0xb8, 0x21, 0xe3, 0xc9, 0xbc, 0xbc, 0x4e, 0x45, 0x57, 0x1, 
+0xc3, 0xa1, 0x22, 0xbc, 0xbc, 0x43, 0x53, 0x41, 0x56, 0x45, 0x1, 0xc3, 0x27, 0x29, 0xbc, 0xbc, 
+0x4b, 0x45, 0x59, 0x53, 0x1, 0xc3, 0xde, 0x22, 0xbc, 0xbc, 0x43, 0x48, 0x41, 0x52, 0x54, 0x1, 
+0xc3, 0xca, 0x22, 0xbc, 0xbc, 0x49, 0x4e, 0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 0x1, 0xc3, 0xcd, 
+0x23, 0xcd, 0xc6, 0xf1, 0x2, 0x20, 0x72, 0x65, 0x61, 0x6c, 0x6c, 0x79, 0x3f, 0x20, 0x28, 0x59, 
+0x29, 0x7, 0xd, 0xa, 0x0, 0xdd, 0x7e, 0xd, 0xa7, 0x28, 0xfa, 0xfe, 0x59, 0xf5, 0x3e, 0x7, 
+0xcd, 0x25, 0xf7, 0xf1, 0xc0, 0x21, 0x44, 0x1d, 0xe3, 0xc9, 0xaf, 0xcd, 0x6a, 0xfc, 0xaf, 0xcd, 
+0x20, 0x12, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0x20, 0xf9, 0x21, 0xd3, 0x1f, 0xe3, 0xc9, 0x3e, 0x4, 
+0xcd, 0x6a, 0xfc, 0x3e, 0x37, 0x32, 0xa3, 0xb7, 0x3e, 0x7, 0xcd, 0x25, 0xf7, 0x21, 0xb, 0x3, 
+0x22, 0xa0, 0xb7, 0x11, 0x45, 0x0, 0x6, 0x4, 0xd5, 0xcd, 0x10, 0xf2, 0xd1, 0x12, 0x21, 0xa2, 
+0xb7, 0x36, 0x8, 0xcd, 0x25, 0xf7, 0x36, 0x0, 0x3e, 0x7, 0xcd, 0x25, 0xf7, 0x13, 0x21, 0xa0, 
+0xb7, 0x35, 0x23, 0x34, 0x10, 0xe2, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x3e, 0x1, 0xcd, 0x6a, 0xfc, 
+0xc9, 0x3e, 0x2, 0xcd, 0x6a, 0xfc, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0xc6, 0xf1, 0xc, 0xa, 
+0x20, 0x59, 0x6f, 0x75, 0x72, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x0, 0x3e, 0x3, 0xcd, 0x6a, 
+0xfc, 0x3e, 0xc, 0xcd, 0x25, 0xf7, 0xcd, 0x10, 0xf2, 0xfe, 0xd, 0x28, 0x5, 0xcd, 0x25, 0xf7, 
+0x18, 0xf4, 0x11, 0x0, 0x0, 0xcd, 0x24, 0xe0, 0x11, 0x4d, 0x0, 0x1, 0xa, 0x0, 0xed, 0xb0, 
+0x3e, 0x0, 0xcd, 0x6a, 0xfc, 0xc3, 0x56, 0x14, 0xc5, 0xf5, 0x3e, 0x7, 0xcd, 0xc8, 0x2, 0x21, 
+0x20, 0x1, 0x22, 0xa0, 0xb7, 0xcd, 0xc6, 0xf1, 0x50, 0x41, 0x47, 0x45, 0x20, 0x0, 0xf1, 0xcd, 
+0x4c, 0x6, 0xcd, 0xc6, 0xf1, 0xd, 0xa, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x54, 0x52, 0x55, 0x43, 
+0x54, 0x49, 0x4f, 0x4e, 0x53, 0x20, 0x74, 0x6f, 0x20, 0x50, 0x45, 0x4e, 0x47, 0x4f, 0xd, 0xa, 
+0x0, 0xf1, 0xa7, 0x28, 0x1e, 0xcd, 0xc6, 0xf1, 0x20, 0x20, 0x20, 0x20, 0x28, 0x67, 0x65, 0x72, 
+0x6d, 0x61, 0x6e, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x29, 
+0xd, 0xa, 0x0, 0x3e, 0x5f, 0x6, 0x28, 0xcd, 0x25, 0xf7, 0x10, 0xfb, 0xc9, 0x3e, 0x0, 0xcd, 
+0x6a, 0xfc, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x3e, 0x1, 0x6, 0x1, 0xcd, 0x68, 0x23, 0xcd, 0xc6, 
+0xf1, 0xa, 0xa, 0x20, 0x20, 0x20, 0x49, 0x6e, 0x68, 0x61, 0x6c, 0x74, 0x3a, 0xa, 0xa, 0xd, 
+0xa, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x2e, 0x2e, 0x2e, 0x49, 0x6e, 0x68, 0x61, 0x6c, 0x74, 
+0x73, 0x76, 0x65, 0x72, 0x7a, 0x65, 0x69, 0x63, 0x68, 0x6e, 0x69, 0x73, 0xa, 0xa, 0xd, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x32, 0x2e, 0x2e, 0x2e, 0x4d, 0x65, 0x6e, 0x7d, 0x65, 0x72, 0x6b, 0x6c, 
+0x7b, 0x72, 0x75, 0x6e, 0x67, 0xa, 0xa, 0xd, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33, 0x2e, 0x2e, 
+0x2e, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x65, 0x72, 0x6b, 0x6c, 0x7b, 0x72, 0x75, 0x6e, 0x67, 0xa, 
+0xa, 0xd, 0x20, 0x20, 0x20, 0x20, 0x20, 0x34, 0x2e, 0x2e, 0x2e, 0x50, 0x45, 0x4e, 0x47, 0x4f, 
+0x2c, 0x20, 0x49, 0x43, 0x45, 0x2d, 0x2c, 0x20, 0x43, 0x52, 0x59, 0x53, 0x54, 0x41, 0x4c, 0x2d, 
+0x42, 0x4c, 0x4f, 0x43, 0x4b, 0xa, 0xa, 0xd, 0x20, 0x20, 0x20, 0x20, 0x20, 0x35, 0x2e, 0x2e, 
+0x2e, 0x53, 0x6e, 0x6f, 0x77, 0x62, 0x65, 0x65, 0x61, 0x72, 0x74, 0x65, 0x6e, 0x20, 0x76, 0x6f, 
+0x72, 0x73, 0x74, 0x65, 0x6c, 0x6c, 0x65, 0x6e, 0xa, 0xa, 0xd, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x36, 0x2e, 0x2e, 0x2e, 0x7a, 0x75, 0x72, 0x7d, 0x63, 0x6b, 0x20, 0x69, 0x6e, 0x73, 0x20, 0x53, 
+0x70, 0x69, 0x65, 0x6c, 0x6d, 0x65, 0x6e, 0x7d, 0xa, 0xa, 0xd, 0xa, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x57, 0x7b, 0x68, 0x6c, 0x65, 0x6e, 0x20, 0x53, 0x69, 0x65, 0x20, 0x21, 
+0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x31, 0xca, 0xd7, 0x23, 0xfe, 0x32, 0xca, 0xe7, 0x24, 0xfe, 0x33, 
+0xca, 0x28, 0x27, 0xfe, 0x34, 0xca, 0xe4, 0x27, 0xfe, 0x35, 0xca, 0x82, 0x28, 0xfe, 0x36, 0x20, 
+0xe0, 0x21, 0xd3, 0x1f, 0xe3, 0xc9, 0x9, 0x3e, 0x2, 0x6, 0x1, 0xcd, 0x68, 0x23, 0xcd, 0xc6, 
+0xf1, 0xd, 0xa, 0x20, 0x20, 0x47, 0x41, 0x4d, 0x45, 0xa, 0xa, 0xd, 0x20, 0x20, 0x4d, 0x45, 
+0x4e, 0x55, 0xa, 0xa, 0xd, 0x20, 0x20, 0x4e, 0x45, 0x57, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 
+0xd, 0xa, 0x20, 0x20, 0x43, 0x53, 0x41, 0x56, 0x45, 0xa, 0xa, 0xd, 0x20, 0x20, 0x4b, 0x45, 
+0x59, 0x53, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xd, 0xa, 0x20, 0x20, 0x43, 0x48, 
+0x41, 0x52, 0x54, 0xa, 0xa, 0xd, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 
+0x0, 0x21, 0xd, 0x6, 0x22, 0x9c, 0xb7, 0x21, 0x1b, 0x1a, 0x22, 0x9e, 0xb7, 0x21, 0x0, 0x0, 
+0x22, 0xa0, 0xb7, 0xcd, 0xc6, 0xf1, 0x6e, 0x65, 0x75, 0x65, 0x73, 0x20, 0x53, 0x70, 0x69, 0x65, 
+0x6c, 0xa, 0xa, 0xd, 0x41, 0x6e, 0x7a, 0x65, 0x69, 0x67, 0x65, 0x20, 0x64, 0x65, 0x73, 0x20, 
+0x4d, 0x65, 0x6e, 0x7d, 0x73, 0xa, 0xa, 0xd, 0x4b, 0x61, 0x6c, 0x74, 0x73, 0x74, 0x61, 0x72, 
+0x74, 0x20, 0x64, 0x65, 0x73, 0x20, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d, 0x73, 0x2c, 
+0xd, 0xa, 0x64, 0x61, 0x62, 0x65, 0x69, 0x20, 0x77, 0x69, 0x72, 0x64, 0x20, 0x64, 0x69, 0x65, 
+0x20, 0x42, 0x65, 0x73, 0x74, 0x65, 0x6e, 0x6c, 0x69, 0x73, 0x74, 0x65, 0xd, 0xa, 0x67, 0x65, 
+0x6c, 0x7c, 0x73, 0x63, 0x68, 0x74, 0xd, 0xa, 0x20, 0x28, 0x41, 0x75, 0x66, 0x72, 0x75, 0x66, 
+0x20, 0x65, 0x72, 0x66, 0x6f, 0x6c, 0x67, 0x74, 0x20, 0x6e, 0x75, 0x72, 0x20, 0x62, 0x65, 0x69, 
+0xd, 0xa, 0x20, 0x20, 0x41, 0x6e, 0x74, 0x77, 0x6f, 0x72, 0x74, 0x20, 0x22, 0x59, 0x22, 0x20, 
+0x61, 0x75, 0x66, 0xd, 0xa, 0x20, 0x20, 0x22, 0x72, 0x65, 0x61, 0x6c, 0x6c, 0x79, 0x3f, 0x20, 
+0x28, 0x59, 0x29, 0x22, 0x20, 0x29, 0xa, 0xa, 0xd, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 
+0x6d, 0x20, 0x61, 0x75, 0x66, 0x20, 0x4b, 0x61, 0x73, 0x73, 0x65, 0x74, 0x74, 0x65, 0xa, 0xa, 
+0xd, 0x6e, 0x65, 0x75, 0x65, 0x20, 0x53, 0x74, 0x65, 0x75, 0x65, 0x72, 0x74, 0x61, 0x73, 0x74, 
+0x65, 0x6e, 0xd, 0xa, 0x20, 0x28, 0x4e, 0x61, 0x63, 0x68, 0x20, 0x41, 0x75, 0x66, 0x72, 0x75, 
+0x66, 0x20, 0x64, 0x65, 0x72, 0x20, 0x46, 0x75, 0x6e, 0x6b, 0x74, 0x69, 0x6f, 0x6e, 0xd, 0xa, 
+0x20, 0x20, 0x73, 0x74, 0x65, 0x68, 0x74, 0x20, 0x64, 0x65, 0x72, 0x20, 0x43, 0x75, 0x72, 0x73, 
+0x6f, 0x72, 0x20, 0x69, 0x6d, 0xd, 0xa, 0x20, 0x20, 0x46, 0x65, 0x6e, 0x73, 0x74, 0x65, 0x72, 
+0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x73, 0x20, 0x6f, 0x62, 0x65, 0x6e, 0x2e, 0xd, 0xa, 0x20, 0x20, 
+0x44, 0x61, 0x6e, 0x61, 0x63, 0x68, 0x20, 0x74, 0x69, 0x70, 0x70, 0x74, 0x20, 0x6d, 0x61, 0x6e, 
+0x20, 0x61, 0x75, 0x66, 0x20, 0x64, 0x69, 0x65, 0xd, 0xa, 0x20, 0x20, 0x67, 0x65, 0x77, 0x7d, 
+0x6e, 0x73, 0x63, 0x68, 0x74, 0x65, 0x6e, 0x20, 0x53, 0x74, 0x65, 0x75, 0x65, 0x72, 0x74, 0x61, 
+0x73, 0x74, 0x65, 0x6e, 0x2e, 0x20, 0x20, 0x52, 0x65, 0x69, 0x68, 0x65, 0x6e, 0x66, 0x6f, 0x6c, 
+0x67, 0x65, 0x3a, 0x20, 0x72, 0x65, 0x63, 0x68, 0x74, 0x73, 0x2c, 0x6c, 0x69, 0x6e, 0x6b, 0x73, 
+0x20, 0x20, 0x20, 0x20, 0x76, 0x6f, 0x72, 0x77, 0x7b, 0x72, 0x74, 0x73, 0x2c, 0x72, 0x7d, 0x63, 
+0x6b, 0x77, 0x7b, 0x72, 0x74, 0x73, 0x29, 0xa, 0xa, 0xd, 0x42, 0x65, 0x73, 0x74, 0x65, 0x6e, 
+0x6c, 0x69, 0x73, 0x74, 0x65, 0x20, 0x61, 0x6e, 0x7a, 0x65, 0x69, 0x67, 0x65, 0x6e, 0xa, 0xa, 
+0xd, 0x41, 0x6e, 0x6c, 0x65, 0x69, 0x74, 0x75, 0x6e, 0x67, 0x65, 0x6e, 0x20, 0x75, 0x2e, 0x20, 
+0x49, 0x6e, 0x66, 0x6f, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x8d, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 
+0xd, 0x20, 0xf9, 0x21, 0x0, 0x0, 0x22, 0x9c, 0xb7, 0x21, 0x28, 0x20, 0x22, 0x9e, 0xb7, 0x21, 
+0x0, 0x0, 0x22, 0xa0, 0xb7, 0xc3, 0xd7, 0x23, 0x3e, 0x3, 0x6, 0x1, 0xcd, 0x68, 0x23, 0x3e, 
+0xa, 0xcd, 0x25, 0xf7, 0x21, 0x0, 0x38, 0xcd, 0x78, 0xe5, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0x20, 
+0xf9, 0x3e, 0x3, 0x6, 0x1, 0xcd, 0x68, 0x23, 0x3e, 0xa, 0xcd, 0x25, 0xf7, 0x21, 0x10, 0x3c, 
+0xcd, 0x78, 0xe5, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0x20, 0xf9, 0xc3, 0xd7, 0x23, 0x77, 0x76, 0x6e, 
+0xec, 0xfc, 0xfc, 0x3e, 0x13, 0xf, 0xf, 0xf, 0xf, 0x7e, 0x32, 0x5d, 0x27, 0x23, 0x7e, 0x32, 
+0x5f, 0x27, 0x23, 0x7e, 0x32, 0x60, 0x27, 0x23, 0x7e, 0x32, 0x5e, 0x27, 0x23, 0x7e, 0x32, 0x62, 
+0x27, 0x23, 0x7e, 0x32, 0x64, 0x27, 0x23, 0x7e, 0x32, 0x63, 0x27, 0x23, 0x7e, 0x32, 0x61, 0x27, 
+0x23, 0x1a, 0x32, 0x65, 0x27, 0x32, 0x66, 0x27, 0x13, 0x1a, 0x32, 0x67, 0x27, 0x32, 0x68, 0x27, 
+0x13, 0xe5, 0xd5, 0xed, 0x4b, 0xaa, 0xb7, 0xc5, 0x1, 0x5d, 0x27, 0xed, 0x43, 0xaa, 0xb7, 0x3e, 
+0xa0, 0x6, 0x0, 0x21, 0x65, 0x27, 0xcd, 0x45, 0x10, 0xc1, 0xed, 0x43, 0xaa, 0xb7, 0xd1, 0xe1, 
+0xc9, 0xcd, 0x69, 0x27, 0xcd, 0xc6, 0xf1, 0xa, 0xa, 0x8, 0x8, 0x0, 0xcd, 0x69, 0x27, 0xcd, 
+0xc6, 0xf1, 0xb, 0xb, 0x0, 0xcd, 0x69, 0x27, 0xcd, 0xc6, 0xf1, 0xa, 0xa, 0x8, 0x8, 0x0, 
+0xcd, 0x69, 0x27, 0xc9, 0x3e, 0x4, 0x6, 0x0, 0xcd, 0x68, 0x23, 0x21, 0x2, 0x6, 0x22, 0xa0, 
+0xb7, 0x21, 0x50, 0x2f, 0x11, 0xd0, 0x32, 0xcd, 0xc1, 0x27, 0x6, 0x1, 0xcd, 0x15, 0x11, 0x9, 
+0x20, 0x50, 0x45, 0x4e, 0x47, 0x4f, 0x0, 0x21, 0x2, 0xc, 0x22, 0xa0, 0xb7, 0x21, 0x90, 0x31, 
+0x11, 0xf8, 0x32, 0xcd, 0xc1, 0x27, 0x6, 0x1, 0xcd, 0x15, 0x11, 0x9, 0x20, 0x49, 0x43, 0x45, 
+0x2d, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x0, 0x21, 0x2, 0x12, 0x22, 0xa0, 0xb7, 0x21, 0x90, 0x31, 
+0x11, 0x0, 0x33, 0xcd, 0xc1, 0x27, 0x6, 0x1, 0xcd, 0x15, 0x11, 0x9, 0x20, 0x43, 0x52, 0x59, 
+0x53, 0x54, 0x41, 0x4c, 0x2d, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x0, 0x21, 0x25, 0x1c, 0x22, 0xa0, 
+0xb7, 0x3e, 0x8d, 0x6, 0x1, 0xcd, 0x45, 0x10, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0x20, 0xf9, 0xc3, 
+0xd7, 0x23, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 
+0x17, 0x17, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 
+0xf, 0xf, 0x3e, 0x5, 0x6, 0x0, 0xcd, 0x68, 0x23, 0x21, 0x2, 0x6, 0x22, 0xa0, 0xb7, 0x21, 
+0x90, 0x2f, 0x11, 0x62, 0x28, 0xcd, 0xc1, 0x27, 0x6, 0x1, 0xcd, 0x15, 0x11, 0x9, 0x20, 0x46, 
+0x55, 0x4e, 0x4e, 0x59, 0x42, 0x45, 0x45, 0x53, 0x0, 0x21, 0x2, 0xc, 0x22, 0xa0, 0xb7, 0x21, 
+0x90, 0x2f, 0x11, 0x6a, 0x28, 0xcd, 0xc1, 0x27, 0x6, 0x1, 0xcd, 0x15, 0x11, 0x9, 0x20, 0x48, 
+0x55, 0x4e, 0x54, 0x45, 0x52, 0x42, 0x45, 0x45, 0x53, 0x0, 0x21, 0x2, 0x12, 0x22, 0xa0, 0xb7, 
+0x21, 0x90, 0x2f, 0x11, 0x72, 0x28, 0xcd, 0xc1, 0x27, 0x6, 0x1, 0xcd, 0x15, 0x11, 0x9, 0x20, 
+0x50, 0x45, 0x52, 0x53, 0x45, 0x43, 0x55, 0x54, 0x4f, 0x52, 0x42, 0x45, 0x45, 0x53, 0x0, 0x21, 
+0x2, 0x18, 0x22, 0xa0, 0xb7, 0x21, 0x90, 0x2f, 0x11, 0x7a, 0x28, 0xcd, 0xc1, 0x27, 0x6, 0x1, 
+0xcd, 0x15, 0x11, 0x9, 0x20, 0x4b, 0x49, 0x4c, 0x4c, 0x45, 0x52, 0x42, 0x45, 0x45, 0x53, 0x0, 
+0x21, 0x26, 0x1c, 0x22, 0xa0, 0xb7, 0x3e, 0x8d, 0x6, 0x1, 0xcd, 0x45, 0x10, 0xdd, 0x7e, 0xd, 
+0xfe, 0xd, 0x20, 0xf9, 0xc3, 0xd7, 0x23, 0x3e, 0x2, 0xcd, 0x6a, 0xfc, 0x3e, 0x7, 0x32, 0xa3, 
+0xb7, 0xcd, 0xc6, 0xf1, 0xc, 0xa, 0x20, 0x53, 0x54, 0x41, 0x52, 0x54, 0x20, 0x54, 0x41, 0x50, 
+0x45, 0x20, 0x7, 0x0, 0x3e, 0xbf, 0x32, 0xa3, 0xb7, 0x3e, 0x8d, 0xcd, 0x25, 0xf7, 0xdd, 0x7e, 
+0xd, 0xfe, 0xd, 0x20, 0xf9, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0xc6, 0xf1, 0x8, 0x8d, 0xd, 
+0xa, 0x20, 0x4f, 0x4b, 0x0, 0x3a, 0xf1, 0xb7, 0xfe, 0x72, 0x28, 0xd, 0x3a, 0xe6, 0x24, 0xfe, 
+0x99, 0x28, 0x6, 0xc6, 0x1, 0x27, 0x32, 0xe6, 0x24, 0x21, 0xfe, 0x29, 0xdd, 0x75, 0x5, 0xdd, 
+0x74, 0x6, 0x1, 0x0, 0x20, 0xcd, 0x6a, 0xe3, 0x11, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 
+0xa0, 0x0, 0x3e, 0x7b, 0x21, 0x0, 0x2, 0xdd, 0x75, 0x5, 0xdd, 0x74, 0x6, 0x19, 0xf5, 0xc5, 
+0xd5, 0xe5, 0xcd, 0x76, 0xe3, 0xe1, 0xd1, 0xc1, 0xf1, 0x3d, 0x20, 0xeb, 0xdd, 0x75, 0x5, 0xdd, 
+0x74, 0x6, 0x19, 0xcd, 0xf6, 0xe3, 0x3a, 0xf1, 0xb7, 0xfe, 0x72, 0x28, 0xd, 0x3a, 0xe6, 0x24, 
+0xfe, 0x99, 0x28, 0x6, 0xd6, 0x1, 0x27, 0x32, 0xe6, 0x24, 0xcd, 0xc6, 0xf1, 0xd, 0xa, 0x20, 
+0x56, 0x45, 0x52, 0x49, 0x46, 0x59, 0x3f, 0x20, 0x28, 0x59, 0x29, 0x7, 0x0, 0xdd, 0x7e, 0xd, 
+0xfe, 0x0, 0x28, 0xf9, 0xcd, 0x25, 0xf7, 0xfe, 0x59, 0xf5, 0x3e, 0xc, 0xcd, 0x25, 0xf7, 0xf1, 
+0xcc, 0x64, 0xf4, 0x3e, 0xc, 0xcd, 0x25, 0xf7, 0x3e, 0x1, 0xcd, 0x6a, 0xfc, 0xc9, 0x50, 0x45, 
+0x4e, 0x47, 0x4f, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x4d, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 
+0x2, 0x0, 0x40, 0x15, 0x2a, 0xdd, 0xcb, 0x7, 0xfe, 0xdd, 0xcb, 0x7, 0xf6, 0x31, 0xc4, 0x1, 
+0x16, 0x3, 0x21, 0xb8, 0xf3, 0xcd, 0xbc, 0xe2, 0xf3, 0xcd, 0x57, 0xf3, 0xdd, 0xcb, 0x7, 0xfe, 
+0xdd, 0xcb, 0x7, 0xf6, 0x21, 0x0, 0x0, 0x11, 0x1, 0x0, 0x1, 0xc4, 0x1, 0x36, 0x0, 0xed, 
+0xb0, 0x21, 0x0, 0x40, 0x11, 0x1, 0x40, 0x1, 0x0, 0x40, 0x36, 0x0, 0xed, 0xb0, 0x21, 0x0, 
+0xb8, 0x11, 0x1, 0xb8, 0x1, 0x0, 0x28, 0x36, 0x0, 0xed, 0xb0, 0xdd, 0x36, 0x9, 0xbd, 0x3a, 
+0xfe, 0x29, 0xfe, 0x50, 0xc2, 0x0, 0xf0, 0x3a, 0x34, 0x1d, 0xfe, 0x77, 0xc2, 0x0, 0xf0, 0x3a, 
+0x53, 0x1f, 0xfe, 0x3e, 0xc2, 0x0, 0xf0, 0x3a, 0xfd, 0xb7, 0xfe, 0x68, 0x20, 0x4, 0xaf, 0x32, 
+0xe6, 0x24, 0x3e, 0xc, 0xcd, 0x25, 0xf7, 0xcd, 0x5c, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x1, 0x1, 0x11, 0x14, 0xc, 0xe, 0x4, 0x14, 0xe, 0x20, 0x4, 0x2, 0x1, 0x12, 0x1c, 0xa, 
+0x18, 0x8, 0xe, 0xc, 0x1c, 0xe, 0x3, 0x1, 0x13, 0xa, 0x12, 0x22, 0x18, 0x4, 0x16, 0xe, 
+0xe, 0x4, 0x1, 0x14, 0x14, 0x16, 0x4, 0x4, 0x1e, 0xe, 0x8, 0xe, 0x5, 0x2, 0x12, 0x16, 
+0x12, 0x8, 0x14, 0x20, 0xe, 0x6, 0x4, 0x6, 0x2, 0x13, 0x14, 0xc, 0x1c, 0xe, 0x10, 0x14, 
+0x16, 0x8, 0x7, 0x2, 0x14, 0x1e, 0xe, 0x14, 0xe, 0x12, 0x8, 0x8, 0x18, 0x8, 0x2, 0x21, 
+0x4, 0x12, 0xc, 0x6, 0x1e, 0x14, 0x16, 0xe, 0x9, 0x2, 0x22, 0x14, 0x6, 0x1a, 0x18, 0x22, 
+0x6, 0x4, 0x6, 0x10, 0x2, 0x23, 0x20, 0x16, 0x14, 0x14, 0x22, 0xe, 0x12, 0x12, 0x11, 0x2, 
+0x24, 0x6, 0x6, 0xc, 0xe, 0x22, 0x18, 0x1a, 0xe, 0x12, 0x3, 0x13, 0x10, 0xa, 0x8, 0xc, 
+0x22, 0x14, 0x12, 0x18, 0x13, 0x3, 0x14, 0x12, 0xa, 0x1a, 0x8, 0x18, 0x14, 0x8, 0x4, 0x14, 
+0x3, 0x22, 0x14, 0xa, 0x18, 0x18, 0x20, 0x4, 0x2, 0x4, 0x15, 0x3, 0x23, 0x16, 0xa, 0x4, 
+0x8, 0x16, 0x14, 0xe, 0x8, 0x16, 0x3, 0x24, 0x10, 0x12, 0x10, 0x1a, 0x12, 0xc, 0x20, 0x18, 
+0x17, 0x3, 0x41, 0x12, 0x12, 0x24, 0x8, 0x4, 0x4, 0x8, 0x14, 0x18, 0x3, 0x42, 0x14, 0x12, 
+0x8, 0x18, 0x1c, 0xe, 0x14, 0x4, 0x19, 0x3, 0x43, 0x16, 0x12, 0x12, 0x10, 0x22, 0x8, 0xc, 
+0xc, 0x20, 0x3, 0x44, 0x12, 0xe, 0xc, 0x16, 0x22, 0x10, 0x16, 0x8, 0x21, 0x4, 0x14, 0x12, 
+0x10, 0x12, 0xc, 0xc, 0x12, 0x14, 0x14, 0x22, 0x4, 0x23, 0x16, 0x10, 0x4, 0x6, 0x1c, 0x18, 
+0x18, 0xc, 0x23, 0x4, 0x24, 0xa, 0x10, 0x16, 0x8, 0x4, 0x18, 0x8, 0x8, 0x24, 0x4, 0x42, 
+0x12, 0x18, 0x18, 0x4, 0x1c, 0xa, 0x4, 0x12, 0x25, 0x4, 0x43, 0xa, 0xa, 0x8, 0xa, 0x18, 
+0xe, 0x8, 0x16, 0x26, 0x4, 0x44, 0x12, 0xe, 0x14, 0x18, 0xc, 0xa, 0x18, 0x4, 0x27, 0x4, 
+0x81, 0x1a, 0x14, 0x24, 0xc, 0x18, 0x1a, 0x24, 0x16, 0x28, 0x4, 0x82, 0xa, 0x14, 0x4, 0x10, 
+0xe, 0x4, 0x8, 0x6, 0x29, 0x4, 0x83, 0xe, 0xc, 0x22, 0x4, 0x4, 0x16, 0x1e, 0x10, 0x30, 
+0x4, 0x84, 0x12, 0x6, 0x1e, 0x18, 0x1e, 0x2, 0x6, 0x14, 0x31, 0x5, 0x24, 0x12, 0xe, 0x20, 
+0xe, 0xc, 0x10, 0x24, 0x8, 0x32, 0x5, 0x43, 0x10, 0x10, 0x18, 0x6, 0x8, 0x2, 0x2, 0x14, 
+0x33, 0x5, 0x44, 0x14, 0xc, 0x18, 0x18, 0x14, 0xa, 0x22, 0x6, 0x34, 0x5, 0x82, 0x14, 0x10, 
+0x4, 0x10, 0x1e, 0xa, 0xe, 0x4, 0x35, 0x5, 0x83, 0x10, 0xc, 0x10, 0x6, 0x20, 0x1a, 0x2, 
+0x10, 0x36, 0x5, 0x84, 0x16, 0xe, 0x1a, 0x18, 0x4, 0x4, 0x24, 0x6, 0x37, 0x6, 0x44, 0x12, 
+0xe, 0x16, 0xe, 0x24, 0x6, 0x12, 0x1a, 0x38, 0x6, 0x83, 0x10, 0xa, 0xe, 0xc, 0x1e, 0x16, 
+0x4, 0xa, 0x39, 0x6, 0x84, 0x20, 0x16, 0x16, 0xc, 0x22, 0x4, 0x4, 0x18, 0x40, 0x7, 0x84, 
+0x12, 0xe, 0x14, 0x12, 0x4, 0x4, 0x22, 0x18, 0x0, 0x0, 0x1f, 0xcf, 0xe4, 0x0, 0x9, 0x7c, 
+0xfa, 0x50, 0x2, 0x95, 0xce, 0xa7, 0xff, 0xf9, 0x5c, 0xea, 0x50, 0x2, 0x97, 0xcf, 0xa4, 0x0, 
+0x9, 0xfc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xce, 0xe4, 0x40, 0x89, 0x57, 0xaa, 0x0, 
+0xc0, 0xb, 0x87, 0x4e, 0xff, 0xdc, 0xb8, 0x74, 0x0, 0xc0, 0x15, 0x7a, 0xa4, 0x40, 0x89, 0xdc, 
+0xee, 0x0, 0x0, 0x0, 0x10, 0x40, 0x35, 0x7b, 0x65, 0x40, 0x81, 0x5d, 0xeb, 0x54, 0xa, 0x95, 
+0xb0, 0xa5, 0x41, 0xe9, 0x57, 0x4a, 0x54, 0x12, 0x15, 0xe, 0xa4, 0x58, 0x21, 0xf6, 0xee, 0x1, 
+0x90, 0x0, 0x10, 0x2, 0x15, 0xfe, 0xa5, 0x0, 0x29, 0x7f, 0xda, 0x54, 0x14, 0x15, 0x75, 0x55, 
+0x55, 0x1, 0x0, 0x1a, 0x77, 0x54, 0x15, 0x15, 0x47, 0x5d, 0x14, 0x75, 0x1c, 0x44, 0x10, 0x0, 
+0x10, 0x88, 0x15, 0xa8, 0xb5, 0x7b, 0xed, 0x40, 0x3, 0x5e, 0xdf, 0x95, 0x2, 0x4, 0x0, 0xb7, 
+0xf0, 0x0, 0x0, 0xb, 0xef, 0xae, 0x80, 0x29, 0xef, 0xaa, 0x70, 0x8, 0x9d, 0x80, 0x0, 0x20, 
+0x1e, 0xea, 0xa6, 0xa, 0xed, 0x3a, 0xee, 0x6a, 0x8a, 0x82, 0xe8, 0x5, 0x83, 0xbd, 0x2c, 0x80, 
+0x19, 0xef, 0x90, 0xa, 0x24, 0xea, 0xa9, 0xe2, 0x2e, 0xb, 0xe8, 0x0, 0x0, 0x0, 0x3f, 0xff, 
+0xe0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x40, 0xbf, 0xd7, 0xe0, 0x5, 0x1, 0xdd, 0x7e, 0x5d, 0xc2, 
+0x80, 0x16, 0x2d, 0xd5, 0xa9, 0xdd, 0x6b, 0x0, 0x1a, 0x0, 0x1b, 0x1, 0x1c, 0x1, 0x0, 0x18, 
+0x1, 0x1b, 0x1, 0x0, 0x15, 0x1, 0x1b, 0x1, 0x0, 0x14, 0x1, 0x18, 0x1, 0x0, 0x12, 0x1, 
+0x15, 0x1, 0x0, 0x10, 0x1, 0x14, 0x1, 0x0, 0x12, 0x1, 0x15, 0x1, 0x1, 0x14, 0x1, 0x18, 
+0x1, 0x0, 0x18, 0x1, 0x1d, 0x1, 0x0, 0xe5, 0x0, 0x18, 0x1, 0x1, 0x12, 0x1, 0x15, 0x1, 
+0x0, 0x15, 0x1, 0x1b, 0x1, 0x0, 0xd8, 0x0, 0x15, 0x1, 0x1, 0x1b, 0x1, 0x1c, 0x1, 0x0, 
+0x18, 0x1, 0x1b, 0x1, 0x0, 0x15, 0x1, 0x1b, 0x1, 0x0, 0x14, 0x1, 0x18, 0x1, 0x0, 0x12, 
+0x1, 0x15, 0x1, 0x0, 0x10, 0x1, 0x14, 0x1, 0x0, 0x12, 0x1, 0x15, 0x1, 0x1, 0x14, 0x1, 
+0x18, 0x1, 0x0, 0x18, 0x1, 0x1d, 0x1, 0x0, 0xe5, 0x0, 0x18, 0x1, 0x0, 0xc0, 0x0, 0x14, 
+0x1, 0x0, 0xd8, 0x0, 0x15, 0x1, 0x2, 0x10, 0x1, 0x14, 0x1, 0x1, 0x10, 0x1, 0x14, 0x1, 
+0x1, 0xd8, 0x0, 0x10, 0x1, 0x1, 0xe5, 0x0, 0x12, 0x1, 0x0, 0x10, 0x1, 0x14, 0x1, 0x0, 
+0x12, 0x1, 0x15, 0x1, 0x1, 0x15, 0x1, 0x1b, 0x1, 0x1, 0x12, 0x1, 0x15, 0x1, 0x2, 0x14, 
+0x1, 0x18, 0x1, 0x1, 0x18, 0x1, 0x1d, 0x1, 0x1, 0xe5, 0x0, 0x18, 0x1, 0x2, 0x12, 0x1, 
+0x15, 0x1, 0x1, 0x15, 0x1, 0x1b, 0x1, 0x1, 0xd8, 0x0, 0x15, 0x1, 0x2, 0x10, 0x1, 0x14, 
+0x1, 0x1, 0x10, 0x1, 0x14, 0x1, 0x1, 0xd8, 0x0, 0x10, 0x1, 0x1, 0xe5, 0x0, 0x12, 0x1, 
+0x0, 0x10, 0x1, 0x14, 0x1, 0x0, 0x12, 0x1, 0x15, 0x1, 0x1, 0x15, 0x1, 0x1b, 0x1, 0x1, 
+0x12, 0x1, 0x15, 0x1, 0x2, 0x14, 0x1, 0x18, 0x1, 0x1, 0x18, 0x1, 0x1d, 0x1, 0x1, 0xe5, 
+0x0, 0x18, 0x1, 0x1, 0xc0, 0x0, 0x14, 0x1, 0x1, 0xd8, 0x0, 0x15, 0x1, 0x3, 0x0, 0x0, 
+0x1, 0x3, 0x3, 0x3, 0x1, 0x7, 0x3, 0x1, 0xf, 0xf, 0x7, 0xf, 0x1d, 0x63, 0x3a, 0xe, 
+0xc0, 0x40, 0x1c, 0xa0, 0xc0, 0x90, 0xa0, 0x30, 0xc8, 0x28, 0x8, 0xe8, 0xe0, 0xb8, 0x44, 0x10, 
+0x1, 0x3, 0x3, 0x3, 0x1, 0x7, 0x3, 0x1, 0xf, 0xf, 0x7, 0xf, 0x1d, 0x61, 0x38, 0xe, 
+0xc0, 0x40, 0x1c, 0xa0, 0xc0, 0x90, 0xa0, 0x30, 0xc8, 0x68, 0x48, 0xe8, 0xe0, 0xe0, 0x80, 0x10, 
+0x0, 0x8, 0xb, 0x7, 0x4, 0x1c, 0xc, 0x0, 0x3c, 0x28, 0x28, 0x38, 0x3, 0xe, 0x4, 0x24, 
+0x0, 0x40, 0x40, 0x80, 0x40, 0xf8, 0xf0, 0x80, 0x68, 0x24, 0x20, 0x6c, 0xc8, 0x0, 0x70, 0x20, 
+0x0, 0x2, 0x2, 0x1, 0x2, 0x1f, 0xf, 0x1, 0x16, 0x24, 0x4, 0x36, 0x13, 0x0, 0xe, 0x4, 
+0x0, 0x10, 0xd0, 0xe0, 0x20, 0x38, 0x30, 0x0, 0x3c, 0x14, 0x14, 0x1c, 0xc0, 0x70, 0x20, 0x24, 
+0x0, 0xf, 0xf, 0x7, 0x7, 0x1f, 0xf, 0x7, 0x3f, 0x2f, 0x2f, 0x3f, 0x3, 0xe, 0x5, 0x27, 
+0x0, 0xc0, 0xc0, 0x80, 0xc0, 0xf8, 0xf0, 0x80, 0xec, 0xe4, 0xe0, 0xec, 0xc8, 0x80, 0xb0, 0xe0, 
+0x0, 0x3, 0x3, 0x1, 0x3, 0x1f, 0xf, 0x1, 0x37, 0x27, 0x7, 0x37, 0x13, 0x1, 0xd, 0x7, 
+0x0, 0xf0, 0xf0, 0xe0, 0xe0, 0xf8, 0xf0, 0xe0, 0xfc, 0xf4, 0xf4, 0xfc, 0xc0, 0x70, 0xa0, 0xe4, 
+0x3, 0x2, 0x38, 0x5, 0x3, 0x9, 0x5, 0xc, 0x13, 0x14, 0x10, 0x17, 0x7, 0x1d, 0x22, 0x8, 
+0x80, 0xc0, 0xc0, 0xc0, 0x80, 0xe0, 0xc0, 0x80, 0xf0, 0xf0, 0xe0, 0xf0, 0xb8, 0xc6, 0x5c, 0x70, 
+0x3, 0x2, 0x38, 0x5, 0x3, 0x9, 0x5, 0xc, 0x13, 0x16, 0x12, 0x17, 0x7, 0x7, 0x1, 0x8, 
+0x80, 0xc0, 0xc0, 0xc0, 0x80, 0xe0, 0xc0, 0x80, 0xf0, 0xf0, 0xe0, 0xf0, 0xb8, 0x86, 0x1c, 0x70, 
+0x0, 0x1f, 0x3f, 0x7, 0x60, 0xd8, 0xc0, 0x71, 0xd8, 0xc0, 0x60, 0xd0, 0x3f, 0x1c, 0x3e, 0x71, 
+0x0, 0xf8, 0xdc, 0xe0, 0xee, 0x77, 0x77, 0xee, 0x77, 0x6e, 0xec, 0x76, 0xfc, 0x13, 0x3e, 0xfc, 
+0x0, 0x1f, 0x3f, 0x7, 0x60, 0xcc, 0xc0, 0x71, 0xcc, 0xc0, 0x60, 0xc8, 0x3f, 0x1, 0x23, 0x71, 
+0x0, 0xf8, 0xdc, 0xe0, 0xee, 0xef, 0xef, 0xee, 0xef, 0xee, 0xec, 0xee, 0xfe, 0xc1, 0xe3, 0xdc, 
+0x1, 0x1f, 0x3f, 0x7, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xe3, 0x41, 0xff, 0xd, 0x0, 0x5, 0x41, 
+0x80, 0xf8, 0xe4, 0xe0, 0xce, 0xff, 0xbf, 0xe6, 0xff, 0xc7, 0x82, 0xff, 0xb0, 0x0, 0xa0, 0x82, 
+0x1, 0x7, 0xf, 0x1, 0x3f, 0x7f, 0x3f, 0x1f, 0x7f, 0x7f, 0x7f, 0x7f, 0x21, 0x5, 0x2d, 0x71, 
+0x80, 0xe0, 0xf0, 0x80, 0xcc, 0x7e, 0x9c, 0xc8, 0xfe, 0xfe, 0xfe, 0xfe, 0x84, 0xa0, 0xb4, 0x8e, 
+0x0, 0x4d, 0x41, 0x5, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x7f, 0x3f, 0x7f, 0x7, 0x1, 0x3, 0x1f, 
+0x0, 0xb2, 0x83, 0xa0, 0xfd, 0xe7, 0xf3, 0xc5, 0xff, 0xfe, 0xfc, 0xfe, 0xe0, 0x80, 0xc0, 0xf8, 
+0x5, 0x21, 0x71, 0x2d, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 0x1f, 0xf, 0x3f, 0x1, 0x0, 0x1, 0x3, 
+0xa0, 0x84, 0x8a, 0xb4, 0xe6, 0xfe, 0xce, 0xfa, 0xfc, 0xf8, 0xf0, 0xfc, 0x80, 0x0, 0x80, 0xc0, 
+0x0, 0x1f, 0x3b, 0x7, 0x77, 0xee, 0xee, 0x77, 0xee, 0x76, 0x37, 0x6e, 0x3f, 0xc8, 0x7c, 0x3f, 
+0x0, 0xf8, 0xfc, 0xe0, 0x6, 0x1b, 0x3, 0x8e, 0x1b, 0x3, 0x6, 0xb, 0xfc, 0x38, 0x7c, 0x8e, 
+0x0, 0x1f, 0x3b, 0x7, 0x77, 0xf7, 0xf7, 0x77, 0xf7, 0x77, 0x37, 0x77, 0x7f, 0x83, 0xc7, 0x3b, 
+0x0, 0xf8, 0xfc, 0xe0, 0x6, 0x33, 0x3, 0x8e, 0x33, 0x3, 0x6, 0x13, 0xfc, 0x80, 0xc4, 0x8e, 
+0x0, 0x0, 0x0, 0x0, 0x3, 0x7, 0x7, 0x1, 0x3, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0xc0, 0xe0, 0xe0, 0x80, 0xc0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x1, 0x1, 0x0, 0xf, 0x3f, 0x1f, 0x3, 0x3f, 0x33, 0x21, 0x3f, 0x0, 0x0, 0x0, 0x1, 
+0x0, 0x80, 0x80, 0x0, 0xf0, 0x9c, 0x98, 0xc0, 0x7c, 0xcc, 0x84, 0xfc, 0x0, 0x0, 0x0, 0x80, 
+0x1, 0x1f, 0x3f, 0x7, 0x7f, 0x7f, 0x7f, 0x3f, 0x7f, 0x73, 0x21, 0x7f, 0xd, 0x0, 0x0, 0x21, 
+0x80, 0xf8, 0xe4, 0xe0, 0xce, 0xfe, 0xbe, 0xe4, 0xfe, 0xce, 0x84, 0xfe, 0xb0, 0x0, 0x0, 0x84, 
+0x0, 0x1, 0x1f, 0x0, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xf, 0x1, 0xf, 0x1f, 
+0xf0, 0xfc, 0x8e, 0xf8, 0xf, 0xff, 0x9f, 0x7, 0xff, 0xfc, 0xf8, 0xfe, 0xf0, 0x80, 0xe0, 0xf8, 
+0xf, 0x3f, 0x38, 0x1f, 0x4, 0x1c, 0xc, 0x2, 0x3c, 0x28, 0x28, 0x38, 0x3, 0xe, 0x4, 0x24, 
+0xf0, 0xec, 0x3c, 0xd8, 0x20, 0x38, 0x30, 0x40, 0x3c, 0x14, 0x14, 0x1c, 0xc0, 0x70, 0x20, 0x24, 
+0x3, 0xd, 0x38, 0x7, 0x60, 0x3f, 0x61, 0x72, 0xc, 0x38, 0x38, 0x18, 0x24, 0xe, 0x23, 0x28, 
+0xf0, 0xcc, 0x86, 0xf8, 0x82, 0xfe, 0xc7, 0xa6, 0x30, 0x1c, 0x1c, 0x18, 0x24, 0x70, 0xc4, 0x14, 
+0x7, 0x3f, 0x71, 0x1f, 0xe0, 0xe4, 0xe6, 0xe0, 0xe0, 0x7f, 0xf8, 0x71, 0x38, 0xc7, 0x6c, 0x18, 
+0xe0, 0xfc, 0xc6, 0xf8, 0x83, 0x93, 0xb3, 0x83, 0x83, 0xfe, 0xe7, 0xc6, 0x1e, 0xe4, 0x32, 0x18, 
+0x0, 0x7, 0x1f, 0x0, 0x7f, 0xc1, 0x63, 0x3f, 0xc1, 0xcd, 0xcd, 0xc1, 0x63, 0xff, 0x7f, 0x49, 
+0x0, 0xe0, 0xf8, 0x0, 0xfe, 0x83, 0xc6, 0xfc, 0x83, 0xb3, 0xb3, 0x83, 0xc6, 0xff, 0xfe, 0x92, 
+0x3f, 0xf0, 0xe7, 0x78, 0xdf, 0xe6, 0xd3, 0xcf, 0x8e, 0xbf, 0xbb, 0xbe, 0xf1, 0x3f, 0x7c, 0xf0, 
+0xfc, 0xbf, 0xcf, 0x1e, 0xfd, 0x3d, 0x7d, 0xfb, 0x7d, 0xf3, 0xf1, 0xf9, 0x8b, 0xfc, 0x3e, 0xe7, 
+0x16, 0xbe, 0x82, 0x64, 0xbb, 0xab, 0x2f, 0xa4, 0x87, 0x18, 0x98, 0xb3, 0xd1, 0x3b, 0x30, 0xe7, 
+0xac, 0x8f, 0xb1, 0xea, 0x2c, 0x89, 0xbd, 0x45, 0xf1, 0x43, 0xc9, 0xd5, 0x89, 0x9c, 0x3c, 0xa4, 
+0x0, 0x10, 0x6, 0x2, 0x30, 0x0, 0x16, 0x0, 0x18, 0x14, 0x0, 0x2, 0x0, 0x0, 0x0, 0xb, 
+0x0, 0x50, 0x0, 0x0, 0x24, 0x0, 0x44, 0x84, 0x48, 0x80, 0x30, 0x24, 0x0, 0x0, 0x0, 0x0, 
+0x19, 0x19, 0x3f, 0x3f, 0x3f, 0x3f, 0x19, 0x19, 0x19, 0x19, 0x3f, 0x3f, 0x3f, 0x3f, 0x19, 0x19, 
+0xfc, 0xfc, 0x98, 0x98, 0x98, 0x98, 0xfc, 0xfc, 0xfc, 0xfc, 0x98, 0x98, 0x98, 0x98, 0xfc, 0xfc, 
+0x0, 0xaa, 0xff, 0x0, 0xaa, 0xff, 0xaa, 0xff, 0xff, 0x55, 0xff, 0x55, 0x55, 0x0, 0x0, 0xff, 
+0x0, 0xaa, 0xff, 0x0, 0xaa, 0xff, 0xaa, 0xff, 0xff, 0x55, 0xff, 0x55, 0x55, 0x0, 0x0, 0xff, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x3, 0x0, 0xc, 0x19, 0x19, 0x6, 
+0x0, 0x0, 0x3, 0x0, 0xc, 0x33, 0x18, 0x7, 0x67, 0x98, 0x33, 0xcc, 0xcc, 0x98, 0x98, 0x67, 
+0x19, 0xc, 0x6, 0x19, 0x1, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x98, 0xcc, 0x67, 0x98, 0x98, 0x67, 0xcc, 0x33, 0x33, 0xc, 0x7, 0x18, 0x0, 0x0, 0x0, 0x3, 
+0x0, 0x0, 0xc0, 0x0, 0x30, 0xcc, 0x18, 0xe0, 0xe6, 0x19, 0xcc, 0x33, 0x33, 0xc, 0x19, 0xe6, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0xc0, 0x0, 0x30, 0x98, 0x98, 0x60, 
+0x19, 0x33, 0xe6, 0x19, 0x19, 0xe6, 0x33, 0xcc, 0xcc, 0x30, 0xe0, 0x18, 0x0, 0x0, 0x0, 0xc0, 
+0x98, 0x30, 0x60, 0x98, 0x80, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x7, 0x7, 0x7, 0x0, 0x7, 0x7, 0x7, 0x0, 0x0, 0x7, 0x7, 0x0, 0x0, 0x7, 0x7, 
+0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 0x2f, 
+0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x6f, 0x6f, 0x0, 0x0, 0x6f, 0x6f, 0x0, 0x0, 
+0x0, 0x0, 0x18, 0x0, 0x5, 0x0, 0x2, 0x1c, 0xf, 0x79, 0x71, 0x3f, 0xc1, 0x49, 0xcd, 0xe1, 
+0x0, 0x0, 0x60, 0x0, 0x82, 0x3, 0x3, 0xe0, 0xf0, 0x9e, 0x8e, 0xfc, 0x83, 0x92, 0xb3, 0x87, 
+0x0, 0xc0, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x3f, 0x7f, 0xf, 0xe1, 0x49, 0xcd, 0xf1, 
+0x0, 0x0, 0x0, 0x0, 0xe, 0x0, 0x6, 0x1c, 0x0, 0xfc, 0xfe, 0xf0, 0x87, 0x92, 0xb3, 0x8f, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2d, 
+0x0, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x2d, 0x28, 0x28, 0x2d, 0x0, 0x0, 0x28, 0x28, 0x2d, 
+0x0, 0x28, 0x28, 0x28, 0x28, 0x2d, 0x0, 0x0, 0x28, 0x28, 0x28, 0x28, 0x2d, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x2d, 0x2d, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x5, 
+0x38, 0x38, 0x2d, 0x2d, 0x0, 0x38, 0x38, 0x5, 0x28, 0x38, 0x38, 0x38, 0x38, 0x2d, 0x2d, 0x28, 
+0x38, 0x38, 0x38, 0x38, 0x2d, 0x2d, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x2d, 0x28, 0x38, 0x38, 
+0x5, 0x38, 0x38, 0x2d, 0x28, 0x28, 0x2d, 0x0, 0x38, 0x38, 0x38, 0x2d, 0x2d, 0x38, 0x38, 0x5, 
+0x38, 0x38, 0x5, 0x0, 0x38, 0x38, 0x5, 0x38, 0x38, 0x5, 0x0, 0x38, 0x38, 0x5, 0x0, 0x0, 
+0x0, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x5, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x5, 0x0, 
+0x38, 0x38, 0x38, 0x38, 0x2d, 0x38, 0x38, 0x5, 0x38, 0x38, 0x5, 0x28, 0x28, 0x28, 0x2d, 0x38, 
+0x38, 0x5, 0x0, 0x38, 0x38, 0x5, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x5, 0x0, 0x0, 0x0, 
+0x0, 0x38, 0x38, 0x5, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x5, 0x38, 0x38, 0x38, 0x38, 0x5, 
+0x38, 0x38, 0x5, 0x38, 0x38, 0x38, 0x5, 0x38, 0x38, 0x5, 0x0, 0x38, 0x38, 0x5, 0x0, 0x0, 
+0x0, 0x0, 0x38, 0x38, 0x5, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x2d, 0x28, 0x28, 0x28, 0x2d, 
+0x38, 0x38, 0x5, 0x0, 0x38, 0x38, 0x38, 0x5, 0x38, 0x38, 0x2d, 0x28, 0x38, 0x38, 0x5, 0x38, 
+0x38, 0x2d, 0x28, 0x38, 0x38, 0x5, 0x0, 0x0, 0x0, 0x0, 0x38, 0x38, 0x5, 0x0, 0x0, 0x0, 
+0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x5, 0x38, 0x38, 0x5, 0x0, 0x0, 0x38, 0x38, 0x5, 
+0x0, 0x38, 0x38, 0x38, 0x38, 0x5, 0x0, 0x0, 0x38, 0x38, 0x38, 0x38, 0x5, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0xa0, 0x5b, 0x5b, 0x5b, 0x5b, 0xa1, 0x20, 0xa0, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa1, 
+0xa0, 0x5b, 0xa1, 0x20, 0x20, 0xa0, 0x5b, 0xa1, 0x20, 0xa0, 0x5b, 0x5b, 0x5b, 0xa1, 0x20, 0x20, 
+0xa0, 0x5b, 0x5b, 0x5b, 0xa1, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 
+0xa1, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0xa0, 0xa1, 0x20, 0x5b, 0x5b, 0x20, 
+0xa0, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0xa1, 0xa0, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0xa1, 0x20, 0x20, 
+0x20, 0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0xa1, 0x20, 
+0x5b, 0x5b, 0x5b, 0xa0, 0xa1, 0x5b, 0x5b, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0xa0, 0x5b, 
+0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 
+0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x20, 
+0x5b, 0x5b, 0x20, 0xa0, 0x5b, 0x5b, 0xa1, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x5b, 0x5b, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x20, 0x5b, 0x5b, 0x20, 0x5b, 0x5b, 0x5b, 0x20, 0x5b, 
+0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x5b, 0xa1, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x20, 
+0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 
+0x20, 0x20, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 
+0x5b, 0x5b, 0xa0, 0x20, 0x20, 0x5b, 0x5b, 0xa0, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 
+0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xff, 
+0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x7f, 0xc0, 0xc0, 0x7c, 0x6, 0x6, 0xc6, 0x7f, 
+0xff, 0x0, 0x3c, 0x66, 0x66, 0x3c, 0x0, 0xff, 0xff, 0x0, 0x63, 0x6b, 0x6b, 0x3e, 0x0, 0xff, 
+0xff, 0x0, 0x3c, 0x66, 0x66, 0x3b, 0x0, 0xff, 0xff, 0x0, 0x3e, 0x60, 0x60, 0x3e, 0x0, 0xff, 
+0xe0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xe0, 0x3c, 0x42, 0x99, 0xa1, 0xa1, 0x99, 0x42, 0x3c, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x80, 0x0, 0xa8, 0x40, 0x80, 0x40, 0xa8, 0x0, 0x82, 0x80, 0xa8, 0x40, 0x82, 0xc0, 0xa8, 
+0x0, 0x84, 0x0, 0xa9, 0x40, 0x84, 0x40, 0xa9, 0x0, 0x86, 0x80, 0xa9, 0x40, 0x86, 0xc0, 0xa9, 
+0x0, 0x88, 0x0, 0xaa, 0x40, 0x88, 0x40, 0xaa, 0x0, 0x8a, 0x80, 0xaa, 0x40, 0x8a, 0xc0, 0xaa, 
+0x0, 0x8c, 0x0, 0xab, 0x40, 0x8c, 0x40, 0xab, 0x0, 0x8e, 0x80, 0xab, 0x40, 0x8e, 0xc0, 0xab, 
+0x0, 0x90, 0x0, 0xac, 0x40, 0x90, 0x40, 0xac, 0x0, 0x92, 0x80, 0xac, 0x40, 0x92, 0xc0, 0xac, 
+0x0, 0x94, 0x0, 0xad, 0x40, 0x94, 0x40, 0xad, 0x0, 0x96, 0x80, 0xad, 0x40, 0x96, 0xc0, 0xad, 
+0x0, 0x98, 0x0, 0xae, 0x40, 0x98, 0x40, 0xae, 0x0, 0x9a, 0x80, 0xae, 0x40, 0x9a, 0xc0, 0xae, 
+0x0, 0x9c, 0x0, 0xaf, 0x40, 0x9c, 0x40, 0xaf, 0x0, 0x9e, 0x80, 0xaf, 0x40, 0x9e, 0xc0, 0xaf, 
+0x0, 0xa0, 0x0, 0xb0, 0x40, 0xa0, 0x40, 0xb0, 0x8, 0xa0, 0x8, 0xb0, 0x48, 0xa0, 0x48, 0xb0, 
+0x10, 0xa0, 0x10, 0xb0, 0x50, 0xa0, 0x50, 0xb0, 0x18, 0xa0, 0x18, 0xb0, 0x58, 0xa0, 0x58, 0xb0, 
+0x0, 0xa2, 0x80, 0xb0, 0x40, 0xa2, 0xc0, 0xb0, 0x8, 0xa2, 0x88, 0xb0, 0x48, 0xa2, 0xc8, 0xb0, 
+0x10, 0xa2, 0x90, 0xb0, 0x50, 0xa2, 0xd0, 0xb0, 0x18, 0xa2, 0x98, 0xb0, 0x58, 0xa2, 0xd8, 0xb0, 
+0x0, 0xa4, 0x0, 0xb1, 0x40, 0xa4, 0x40, 0xb1, 0x8, 0xa4, 0x8, 0xb1, 0x48, 0xa4, 0x48, 0xb1, 
+0x10, 0xa4, 0x10, 0xb1, 0x50, 0xa4, 0x50, 0xb1, 0x18, 0xa4, 0x18, 0xb1, 0x58, 0xa4, 0x58, 0xb1, 
+0x0, 0xa6, 0x80, 0xb1, 0x40, 0xa6, 0xc0, 0xb1, 0x8, 0xa6, 0x88, 0xb1, 0x48, 0xa6, 0xc8, 0xb1, 
+0x10, 0xa6, 0x90, 0xb1, 0x50, 0xa6, 0xd0, 0xb1, 0x18, 0xa6, 0x98, 0xb1, 0x58, 0xa6, 0xd8, 0xb1, 
+0x20, 0x50, 0x45, 0x4e, 0x47, 0x4f, 0x20, 0x69, 0x73, 0x74, 0x20, 0x65, 0x69, 0x6e, 0x20, 0x43, 
+0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x73, 0x70, 0x69, 0x65, 0x6c, 0x20, 0x66, 0x7d, 0x72, 
+0x20, 0x64, 0x65, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4b, 0x43, 0x20, 0x38, 0x35, 0x2f, 0x33, 
+0x2e, 0x20, 0x44, 0x65, 0x72, 0x20, 0x50, 0x69, 0x6e, 0x67, 0x75, 0x69, 0x6e, 0x20, 0x28, 0x50, 
+0x45, 0x4e, 0x47, 0x4f, 0x29, 0x20, 0x69, 0x73, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x6c, 0x73, 0x20, 0x64, 0x65, 0x72, 0x20, 0x53, 0x74, 0x65, 
+0x75, 0x65, 0x72, 0x74, 0x61, 0x73, 0x74, 0x65, 0x6e, 0x20, 0x28, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 
+0x6c, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x74, 
+0x61, 0x73, 0x74, 0x65, 0x6e, 0x29, 0x20, 0x7d, 0x62, 0x65, 0x72, 0x20, 0x64, 0x61, 0x73, 0x20, 
+0x53, 0x70, 0x69, 0x65, 0x6c, 0x66, 0x65, 0x6c, 0x64, 0x20, 0x7a, 0x75, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x73, 0x74, 0x65, 0x75, 0x65, 0x72, 0x6e, 0x2e, 0x20, 0x44, 0x65, 0x6e, 0x20, 0x53, 0x6e, 
+0x6f, 0x77, 0x62, 0x65, 0x65, 0x73, 0x20, 0x69, 0x73, 0x74, 0x20, 0x64, 0x61, 0x62, 0x65, 0x69, 
+0x20, 0x61, 0x75, 0x73, 0x7a, 0x75, 0x2d, 0x20, 0x20, 0x77, 0x65, 0x69, 0x63, 0x68, 0x65, 0x6e, 
+0x2e, 0x20, 0x44, 0x69, 0x65, 0x20, 0x41, 0x75, 0x66, 0x67, 0x61, 0x62, 0x65, 0x20, 0x64, 0x65, 
+0x73, 0x20, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x65, 0x72, 0x73, 0x20, 0x62, 0x65, 0x2d, 0x20, 0x20, 
+0x20, 0x73, 0x74, 0x65, 0x68, 0x74, 0x20, 0x6e, 0x75, 0x6e, 0x20, 0x64, 0x61, 0x72, 0x69, 0x6e, 
+0x2c, 0x20, 0x64, 0x69, 0x65, 0x20, 0x33, 0x20, 0x4b, 0x72, 0x69, 0x73, 0x74, 0x61, 0x6c, 0x6c, 
+0x62, 0x6c, 0x7c, 0x63, 0x6b, 0x65, 0x20, 0x20, 0x20, 0x28, 0x43, 0x52, 0x59, 0x53, 0x54, 0x41, 
+0x4c, 0x2d, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x53, 0x29, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x69, 0x6e, 
+0x65, 0x20, 0x77, 0x61, 0x61, 0x67, 0x65, 0x72, 0x65, 0x63, 0x68, 0x74, 0x65, 0x20, 0x20, 0x20, 
+0x20, 0x6f, 0x2e, 0x20, 0x73, 0x65, 0x6e, 0x6b, 0x72, 0x65, 0x63, 0x68, 0x74, 0x65, 0x20, 0x52, 
+0x65, 0x69, 0x68, 0x65, 0x20, 0x7a, 0x75, 0x73, 0x61, 0x6d, 0x6d, 0x65, 0x6e, 0x7a, 0x75, 0x73, 
+0x63, 0x68, 0x69, 0x65, 0x62, 0x65, 0x6e, 0x2e, 0x20, 0x57, 0x65, 0x6e, 0x6e, 0x20, 0x6d, 0x61, 
+0x6e, 0x20, 0x6e, 0x7b, 0x6d, 0x6c, 0x69, 0x63, 0x68, 0x20, 0x6d, 0x69, 0x74, 0x20, 0x50, 0x45, 
+0x4e, 0x47, 0x4f, 0x20, 0x65, 0x69, 0x6e, 0x65, 0x20, 0x57, 0x65, 0x69, 0x6c, 0x65, 0x20, 0x20, 
+0x20, 0x67, 0x65, 0x67, 0x65, 0x6e, 0x20, 0x65, 0x69, 0x6e, 0x65, 0x6e, 0x20, 0x45, 0x69, 0x73, 
+0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x28, 0x49, 0x43, 0x45, 0x2d, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 
+0x29, 0x20, 0x61, 0x6e, 0x2d, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6e, 0x6e, 0x74, 0x2c, 0x20, 
+0x77, 0x69, 0x72, 0x64, 0x20, 0x64, 0x69, 0x65, 0x73, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x74, 
+0x67, 0x65, 0x73, 0x63, 0x68, 0x6c, 0x65, 0x75, 0x64, 0x65, 0x72, 0x74, 0x2e, 0x20, 0x20, 0x20, 
+0x20, 0x49, 0x73, 0x74, 0x20, 0x68, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x20, 0x42, 0x6c, 0x6f, 
+0x63, 0x6b, 0x20, 0x6b, 0x65, 0x69, 0x6e, 0x20, 0x50, 0x6c, 0x61, 0x74, 0x7a, 0x2c, 0x20, 0x73, 
+0x6f, 0x20, 0x77, 0x69, 0x72, 0x64, 0x20, 0x20, 0x20, 0x65, 0x72, 0x20, 0x7a, 0x65, 0x72, 0x66, 
+0x72, 0x65, 0x73, 0x73, 0x65, 0x6e, 0x2e, 0x20, 0x4b, 0x72, 0x69, 0x73, 0x74, 0x61, 0x6c, 0x6c, 
+0x62, 0x6c, 0x7c, 0x63, 0x6b, 0x65, 0x20, 0x6b, 0x7c, 0x6e, 0x6e, 0x65, 0x6e, 0x20, 0x20, 0x20, 
+0x20, 0x6e, 0x69, 0x63, 0x68, 0x74, 0x20, 0x7a, 0x65, 0x72, 0x66, 0x72, 0x65, 0x73, 0x73, 0x65, 
+0x6e, 0x20, 0x77, 0x65, 0x72, 0x64, 0x65, 0x6e, 0x2e, 0x20, 0x4b, 0x6f, 0x6d, 0x6d, 0x74, 0x20, 
+0x65, 0x69, 0x6e, 0x65, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x77, 0x65, 0x67, 0x67, 0x65, 0x73, 0x63, 
+0x68, 0x6c, 0x65, 0x75, 0x64, 0x65, 0x72, 0x74, 0x65, 0x6e, 0x20, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 
+0x20, 0x65, 0x69, 0x6e, 0x20, 0x53, 0x6e, 0x6f, 0x77, 0x62, 0x65, 0x65, 0x20, 0x69, 0x6e, 0x20, 
+0x20, 0x64, 0x65, 0x6e, 0x20, 0x57, 0x65, 0x67, 0x2c, 0x20, 0x77, 0x69, 0x72, 0x64, 0x20, 0x65, 
+0x73, 0x20, 0x6c, 0x69, 0x71, 0x75, 0x69, 0x64, 0x69, 0x65, 0x72, 0x74, 0x20, 0x75, 0x2e, 0x20, 
+0x64, 0x61, 0x66, 0x7d, 0x72, 0x20, 0x20, 0x20, 0x20, 0x50, 0x75, 0x6e, 0x6b, 0x74, 0x65, 0x20, 
+0x61, 0x75, 0x66, 0x61, 0x64, 0x64, 0x69, 0x65, 0x72, 0x74, 0x2e, 0x20, 0x4e, 0x61, 0x63, 0x68, 
+0x20, 0x65, 0x69, 0x6e, 0x69, 0x67, 0x65, 0x72, 0x20, 0x5a, 0x65, 0x69, 0x74, 0x20, 0x20, 0x20, 
+0x20, 0x6b, 0x6f, 0x6d, 0x6d, 0x74, 0x20, 0x64, 0x61, 0x73, 0x20, 0x53, 0x6e, 0x6f, 0x77, 0x62, 
+0x65, 0x65, 0x20, 0x64, 0x61, 0x6e, 0x6e, 0x20, 0x77, 0x69, 0x65, 0x64, 0x65, 0x72, 0x20, 0x69, 
+0x6e, 0x73, 0x20, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x20, 0x20, 0x45, 0x73, 0x20, 0x67, 0x69, 0x62, 
+0x74, 0x20, 0x61, 0x75, 0x63, 0x68, 0x20, 0x6e, 0x6f, 0x63, 0x68, 0x20, 0x65, 0x69, 0x6e, 0x65, 
+0x20, 0x4d, 0x7c, 0x67, 0x6c, 0x69, 0x63, 0x68, 0x6b, 0x65, 0x69, 0x74, 0x2c, 0x20, 0x20, 0x20, 
+0x20, 0x64, 0x69, 0x65, 0x20, 0x4a, 0x61, 0x67, 0x64, 0x20, 0x7a, 0x75, 0x20, 0x76, 0x65, 0x72, 
+0x65, 0x69, 0x6e, 0x66, 0x61, 0x63, 0x68, 0x65, 0x6e, 0x2e, 0x20, 0x44, 0x61, 0x7a, 0x75, 0x20, 
+0x6c, 0x7b, 0x7e, 0x74, 0x20, 0x6d, 0x61, 0x6e, 0x20, 0x50, 0x45, 0x4e, 0x47, 0x4f, 0x20, 0x67, 
+0x65, 0x67, 0x65, 0x6e, 0x20, 0x65, 0x69, 0x6e, 0x65, 0x20, 0x42, 0x65, 0x67, 0x72, 0x65, 0x6e, 
+0x7a, 0x75, 0x6e, 0x67, 0x73, 0x77, 0x61, 0x6e, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x72, 0x65, 0x6e, 0x6e, 0x65, 0x6e, 0x2e, 0x20, 0x44, 0x69, 0x65, 0x73, 0x65, 0x72, 0x20, 
+0x57, 0x61, 0x6e, 0x64, 0x20, 0x77, 0x69, 0x72, 0x64, 0x20, 0x64, 0x61, 0x6e, 0x6e, 0x20, 0x27, 
+0x65, 0x69, 0x6e, 0x67, 0x65, 0x2d, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x7a, 0x74, 0x27, 0x2c, 
+0x20, 0x73, 0x6f, 0x20, 0x64, 0x61, 0x7e, 0x20, 0x61, 0x6c, 0x6c, 0x65, 0x20, 0x53, 0x6e, 0x6f, 
+0x77, 0x62, 0x65, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x64, 0x69, 0x65, 0x73, 0x65, 0x72, 0x20, 
+0x20, 0x57, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x72, 0x73, 0x63, 0x68, 0x7c, 0x70, 0x66, 0x74, 0x20, 
+0x73, 0x69, 0x6e, 0x64, 0x2c, 0x20, 0x75, 0x6e, 0x64, 0x20, 0x73, 0x69, 0x63, 0x68, 0x20, 0x65, 
+0x72, 0x73, 0x74, 0x6d, 0x61, 0x6c, 0x20, 0x20, 0x20, 0x6e, 0x69, 0x63, 0x68, 0x74, 0x20, 0x77, 
+0x65, 0x69, 0x74, 0x65, 0x72, 0x62, 0x65, 0x77, 0x65, 0x67, 0x65, 0x6e, 0x20, 0x6b, 0x7c, 0x6e, 
+0x6e, 0x65, 0x6e, 0x2e, 0x20, 0x20, 0x28, 0x8d, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x20, 0x68, 0x69, 0x65, 0x72, 0x20, 0x6e, 0x6f, 0x63, 0x68, 0x20, 0x65, 0x69, 0x6e, 0x69, 0x67, 
+0x65, 0x20, 0x48, 0x69, 0x6e, 0x77, 0x65, 0x69, 0x73, 0x65, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x2d, 0x7a, 0x75, 0x72, 0x20, 0x54, 0x6f, 0x6e, 0x61, 0x75, 0x73, 0x67, 0x61, 0x62, 
+0x65, 0x20, 0x73, 0x6f, 0x6c, 0x6c, 0x74, 0x65, 0x20, 0x77, 0x65, 0x6e, 0x69, 0x67, 0x73, 0x74, 
+0x65, 0x6e, 0x73, 0x20, 0x65, 0x69, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x53, 0x54, 0x45, 0x52, 0x45, 
+0x4f, 0x2d, 0x4b, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x77, 0x65, 0x6e, 0x64, 0x65, 
+0x74, 0x20, 0x77, 0x65, 0x72, 0x64, 0x65, 0x6e, 0x2e, 0x20, 0x44, 0x61, 0x62, 0x65, 0x69, 0x20, 
+0x20, 0x20, 0x20, 0x73, 0x63, 0x68, 0x6c, 0x69, 0x65, 0x7e, 0x74, 0x20, 0x6d, 0x61, 0x6e, 0x20, 
+0x64, 0x65, 0x6e, 0x20, 0x4b, 0x43, 0x20, 0x61, 0x6d, 0x20, 0x62, 0x65, 0x73, 0x74, 0x65, 0x6e, 
+0x20, 0x67, 0x6c, 0x65, 0x69, 0x63, 0x68, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x6f, 0x63, 0x68, 0x20, 
+0x61, 0x6e, 0x20, 0x65, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x54, 0x45, 0x52, 0x45, 0x4f, 0x2d, 0x41, 
+0x6e, 0x6c, 0x61, 0x67, 0x65, 0x20, 0x61, 0x6e, 0x2e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x73, 0x6f, 0x6c, 0x6c, 0x74, 
+0x65, 0x20, 0x77, 0x7b, 0x68, 0x72, 0x65, 0x6e, 0x64, 0x20, 0x64, 0x65, 0x73, 0x20, 0x53, 0x70, 
+0x69, 0x65, 0x6c, 0x61, 0x62, 0x6c, 0x61, 0x75, 0x66, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x70, 0x6c, 0x7c, 0x74, 0x7a, 0x6c, 0x69, 0x63, 0x68, 0x20, 0x64, 0x61, 0x73, 
+0x20, 0x41, 0x62, 0x62, 0x69, 0x6c, 0x64, 0x20, 0x65, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x46, 0x69, 
+0x67, 0x75, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x68, 0x65, 
+0x6e, 0x62, 0x6c, 0x65, 0x69, 0x62, 0x65, 0x6e, 0x20, 0x28, 0x77, 0x61, 0x73, 0x20, 0x6e, 0x75, 
+0x72, 0x20, 0x62, 0x65, 0x69, 0x20, 0x73, 0x65, 0x68, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x67, 0x65, 0x77, 0x61, 0x67, 0x74, 0x65, 0x6e, 0x20, 0x4d, 0x61, 0x6e, 0x7c, 
+0x76, 0x65, 0x72, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x20, 0x61, 0x75, 0x63, 0x68, 0x20, 0x64, 0x61, 
+0x6e, 0x6e, 0x20, 0x6e, 0x75, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x68, 0x72, 0x20, 
+0x73, 0x65, 0x6c, 0x74, 0x65, 0x6e, 0x20, 0x76, 0x6f, 0x72, 0x6b, 0x6f, 0x6d, 0x6d, 0x74, 0x29, 
+0x2c, 0x20, 0x73, 0x6f, 0x20, 0x65, 0x6e, 0x74, 0x2d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x73, 0x63, 0x68, 0x75, 0x6c, 0x64, 0x69, 0x67, 0x65, 0x6e, 0x20, 0x53, 0x69, 
+0x65, 0x20, 0x64, 0x61, 0x73, 0x20, 0x62, 0x69, 0x74, 0x74, 0x65, 0x20, 0x75, 0x6e, 0x64, 0x20, 
+0x62, 0x65, 0x75, 0x6e, 0x2d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x75, 0x68, 0x69, 0x67, 
+0x65, 0x6e, 0x20, 0x53, 0x69, 0x65, 0x20, 0x73, 0x69, 0x63, 0x68, 0x20, 0x6e, 0x69, 0x63, 0x68, 
+0x74, 0x2c, 0x20, 0x64, 0x61, 0x73, 0x20, 0x41, 0x62, 0x62, 0x69, 0x6c, 0x64, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x68, 0x61, 0x74, 0x20, 0x61, 0x75, 0x66, 0x20, 0x64, 0x61, 0x73, 0x20, 0x53, 
+0x70, 0x69, 0x65, 0x6c, 0x20, 0x6b, 0x65, 0x69, 0x6e, 0x65, 0x72, 0x6c, 0x65, 0x69, 0x20, 0x41, 
+0x75, 0x73, 0x2d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x72, 0x6b, 0x75, 
+0x6e, 0x67, 0x65, 0x6e, 0x2e, 0x20, 0x44, 0x65, 0x72, 0x20, 0x46, 0x65, 0x68, 0x6c, 0x65, 0x72, 
+0x20, 0x68, 0x61, 0x74, 0x20, 0x73, 0x65, 0x69, 0x6e, 0x65, 0x20, 0x55, 0x72, 0x2d, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x73, 0x61, 0x63, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x65, 0x72, 0x20, 
+0x67, 0x65, 0x73, 0x61, 0x6d, 0x74, 0x65, 0x6e, 0x20, 0x4b, 0x6f, 0x6e, 0x7a, 0x65, 0x70, 0x74, 
+0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x73, 0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x67, 0x72, 
+0x61, 0x6d, 0x6d, 0x65, 0x73, 0x2c, 0x20, 0x69, 0x73, 0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 
+0x6e, 0x75, 0x72, 0x20, 0x7b, 0x75, 0x7e, 0x65, 0x72, 0x73, 0x74, 0x20, 0x75, 0x6d, 0x2d, 0x20, 
+0x20, 0x20, 0x20, 0x73, 0x74, 0x7b, 0x6e, 0x64, 0x6c, 0x69, 0x63, 0x68, 0x20, 0x7a, 0x75, 0x20, 
+0x65, 0x6e, 0x74, 0x66, 0x65, 0x72, 0x6e, 0x65, 0x6e, 0x2e, 0x20, 0x42, 0x65, 0x69, 0x20, 0x73, 
+0x70, 0x7b, 0x74, 0x65, 0x72, 0x65, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x53, 0x4f, 0x57, 0x41, 0x43, 
+0x4f, 0x2d, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x65, 0x6e, 0x20, 0x69, 0x73, 0x74, 0x20, 0x65, 0x72, 
+0x20, 0x6e, 0x61, 0x74, 0x2e, 0x20, 0x62, 0x65, 0x68, 0x6f, 0x62, 0x65, 0x6e, 0x2e, 0xa, 0xa, 
+0xa, 0x8, 0x8d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+};
+unsigned char dump_cave[11904] = {
+0x43, 0x41, 0x56, 0x45, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x3, 0x0, 0x2, 0x0, 0x30, 0xe, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x80, 0x3, 0x56, 0x9a, 0xed, 0x53, 0x2, 0x2, 0x6, 0x4, 0xc5, 0x1, 0x4, 0x0, 0xed, 0xb0, 
+0x22, 0x0, 0x2, 0xeb, 0x11, 0x7c, 0x0, 0x19, 0xeb, 0x2a, 0x0, 0x2, 0xc1, 0x10, 0xeb, 0x2a, 
+0x2, 0x2, 0x11, 0x20, 0x0, 0x19, 0xeb, 0x2a, 0x0, 0x2, 0x6, 0x4, 0xc5, 0x1, 0x4, 0x0, 
+0xed, 0xb0, 0x22, 0x0, 0x2, 0xeb, 0x11, 0x7c, 0x0, 0x19, 0xeb, 0x2a, 0x0, 0x2, 0xc1, 0x10, 
+0xeb, 0xc9, 0x28, 0x28, 0x28, 0x28, 0xd6, 0xae, 0x32, 0x42, 0x2, 0x32, 0x43, 0x2, 0x32, 0x44, 
+0x2, 0x32, 0x45, 0x2, 0xed, 0x53, 0x46, 0x2, 0x21, 0x42, 0x2, 0x1, 0x4, 0x0, 0xed, 0xb0, 
+0x2a, 0x46, 0x2, 0x11, 0x20, 0x0, 0x19, 0xeb, 0x21, 0x42, 0x2, 0x1, 0x4, 0x0, 0xed, 0xb0, 
+0xc9, 0x56, 0x9a, 0x60, 0x3, 0x28, 0xf5, 0xc5, 0xd5, 0xe5, 0xed, 0x53, 0x73, 0x2, 0x32, 0x75, 
+0x2, 0xcd, 0x3, 0xf0, 0x34, 0x22, 0x71, 0x2, 0x3a, 0x75, 0x2, 0xcd, 0x48, 0x2, 0x2a, 0x71, 
+0x2, 0xed, 0x5b, 0x73, 0x2, 0xeb, 0xcd, 0x4, 0x2, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x0, 0x0, 
+0xc6, 0x7f, 0xff, 0x5, 0xff, 0xff, 0x3, 0x8c, 0x2a, 0xa0, 0x2, 0x22, 0xc0, 0x2, 0x21, 0xa2, 
+0x2, 0x11, 0xa5, 0x2, 0x1, 0x3, 0x0, 0xed, 0xb0, 0xcd, 0x3, 0xf0, 0x35, 0x3a, 0x82, 0xb7, 
+0xc6, 0x7f, 0x32, 0x82, 0xb7, 0x32, 0x84, 0xb7, 0x3a, 0xa5, 0x2, 0x47, 0x10, 0xfe, 0x3a, 0xa6, 
+0x2, 0x3d, 0x32, 0xa6, 0x2, 0xfe, 0x0, 0xc2, 0xc8, 0x2, 0x3a, 0xa3, 0x2, 0x32, 0xa6, 0x2, 
+0x3a, 0xa7, 0x2, 0x3d, 0x32, 0xa7, 0x2, 0xfe, 0x0, 0xc2, 0xb9, 0x2, 0x3e, 0x0, 0x32, 0x82, 
+0xb7, 0x32, 0x84, 0xb7, 0xcd, 0x3, 0xf0, 0x35, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0xf, 0x3, 0x10, 0x3a, 0x0, 0x3, 0xed, 0x44, 0xc6, 0x15, 0x32, 0x0, 0x3, 0x3a, 0x1, 0x3, 
+0xed, 0x44, 0xc6, 0x16, 0x32, 0x1, 0x3, 0x3e, 0x16, 0x32, 0x2, 0x3, 0x21, 0xfe, 0xae, 0x11, 
+0xff, 0xae, 0x1, 0x40, 0x5, 0xed, 0xb8, 0x6, 0x15, 0x21, 0xc0, 0xa9, 0x11, 0x20, 0x0, 0x3a, 
+0x2, 0x3, 0x77, 0x19, 0x77, 0x3a, 0x0, 0x3, 0xb8, 0xcc, 0x46, 0x3, 0x3a, 0x1, 0x3, 0xb8, 
+0xcc, 0x4c, 0x3, 0x19, 0x10, 0xe9, 0x3e, 0x10, 0x32, 0x2, 0x3, 0xc9, 0x3e, 0x16, 0x32, 0x2, 
+0x3, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0xff, 0x0, 0xfc, 0x1, 0xf8, 0x3, 0x3, 0x7, 0x10, 0x4, 0x0, 0xff, 0xe0, 
+0x8, 0x1, 0xff, 0xe0, 0xff, 0xff, 0xc0, 0xc0, 0x7f, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0x0, 
+0x48, 0x20, 0x60, 0x0, 0xd8, 0x10, 0xf8, 0x0, 0xff, 0x1f, 0x3f, 0x0, 0xb8, 0xff, 0xcd, 0xe0, 
+0xbb, 0xc7, 0xf0, 0x0, 0xdf, 0xf8, 0xe0, 0x0, 0x7c, 0xff, 0xc0, 0x0, 0x48, 0xf, 0x80, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x3, 0x80, 0x6f, 0xfd, 0x7, 0xf8, 
+0x33, 0x7f, 0xfe, 0xfc, 0x1f, 0x7, 0xff, 0x9c, 0x1f, 0x80, 0x3f, 0x86, 0x0, 0x0, 0x0, 0x1, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x54, 0x5d, 0x13, 0x77, 0xed, 0xb0, 0xc9, 0x7f, 0x7f, 0x43, 0x41, 0x56, 0x45, 0x1, 0x0, 0x0, 
+0x0, 0x0, 0x21, 0x0, 0x1f, 0x22, 0xaa, 0xb7, 0x3e, 0x1, 0x21, 0x0, 0x0, 0x11, 0x28, 0x20, 
+0xcd, 0x3, 0xf0, 0x3c, 0x3e, 0x2, 0x21, 0x0, 0x7, 0x11, 0x20, 0x15, 0xcd, 0x3, 0xf0, 0x3c, 
+0x3e, 0x1, 0xcd, 0x3, 0xf0, 0x3d, 0x21, 0x0, 0xa8, 0x1, 0xff, 0x9, 0x3e, 0x0, 0xcd, 0x0, 
+0x4, 0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x10, 0x11, 0x0, 0x21, 0x0, 0x1a, 0xcd, 0x3, 
+0xf0, 0x45, 0x21, 0x0, 0x10, 0x11, 0x0, 0xa8, 0x1, 0xff, 0x9, 0xed, 0xb0, 0xcd, 0xd2, 0xb, 
+0x3e, 0x2, 0xcd, 0x3, 0xf0, 0x3d, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0xc, 
+0xa, 0xa, 0x9, 0x9, 0x57, 0x65, 0x6c, 0x63, 0x68, 0x65, 0x20, 0x54, 0x61, 0x73, 0x74, 0x65, 
+0x20, 0x66, 0x75, 0x65, 0x72, 0x20, 0x42, 0x65, 0x77, 0x65, 0x67, 0x75, 0x6e, 0x67, 0xd, 0xa, 
+0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x61, 0x63, 0x68, 0x20, 0x6f, 0x62, 0x65, 0x6e, 0x3f, 
+0x0, 0x3e, 0x7, 0xcd, 0x3, 0xf0, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0x28, 0xf9, 0x32, 0x8, 
+0x0, 0xcd, 0x3, 0xf0, 0x23, 0x20, 0x4f, 0x4b, 0xd, 0xa, 0xa, 0x20, 0x20, 0x20, 0x20, 0x6e, 
+0x61, 0x63, 0x68, 0x20, 0x75, 0x6e, 0x74, 0x65, 0x6e, 0x3f, 0x0, 0x3e, 0x7, 0xcd, 0x3, 0xf0, 
+0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0x28, 0xf9, 0x32, 0x9, 0x0, 0xcd, 0x3, 0xf0, 0x23, 0x20, 
+0x4f, 0x4b, 0xd, 0xa, 0xa, 0xa, 0x20, 0x20, 0x47, 0x65, 0x73, 0x63, 0x68, 0x77, 0x69, 0x6e, 
+0x64, 0x69, 0x67, 0x6b, 0x65, 0x69, 0x74, 0x20, 0x28, 0x31, 0x2d, 0x39, 0x29, 0x0, 0x3e, 0x7, 
+0xcd, 0x3, 0xf0, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0x28, 0xf9, 0xfe, 0x31, 0xfa, 0x4, 0x5, 
+0xfe, 0x3a, 0xf2, 0x4, 0x5, 0xd6, 0x30, 0x32, 0x2, 0x0, 0xed, 0x44, 0xc6, 0xa, 0x47, 0x97, 
+0xc6, 0x8, 0x10, 0xfc, 0x32, 0x3, 0x0, 0x21, 0x0, 0x0, 0x22, 0x15, 0x0, 0x21, 0x20, 0x0, 
+0x22, 0x13, 0x0, 0x3e, 0x1, 0x32, 0xa, 0x0, 0x21, 0x20, 0x0, 0x6, 0x22, 0x36, 0x0, 0x23, 
+0x10, 0xfb, 0x21, 0x16, 0xd8, 0x22, 0x0, 0x0, 0x21, 0x0, 0x0, 0x22, 0x4, 0x0, 0x22, 0x6, 
+0x0, 0x21, 0x0, 0x20, 0x22, 0xb, 0x0, 0x21, 0x0, 0x2a, 0x22, 0xd, 0x0, 0x21, 0x0, 0x20, 
+0x22, 0xf, 0x0, 0x21, 0xc0, 0xa9, 0x1, 0x3f, 0x5, 0x3e, 0x0, 0xcd, 0x0, 0x4, 0x3e, 0x0, 
+0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0x0, 0x2a, 0x0, 0x0, 0x11, 0x60, 0x3, 0x3e, 
+0x28, 0xcd, 0x76, 0x2, 0xc3, 0x92, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0x7f, 0xff, 
+0x5, 0xff, 0x21, 0x87, 0x5, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0x21, 0x8d, 0x5, 
+0x11, 0xa0, 0x2, 0x1, 0x5, 0x0, 0xed, 0xb0, 0xcd, 0xa8, 0x2, 0x3e, 0x1, 0xcd, 0x3, 0xf0, 
+0x3d, 0x3e, 0x20, 0x32, 0xa3, 0xb7, 0x21, 0x5, 0x1e, 0x22, 0xa0, 0xb7, 0x2a, 0x4, 0x0, 0xcd, 
+0x3, 0xf0, 0x1a, 0x21, 0x14, 0x1e, 0x22, 0xa0, 0xb7, 0x2a, 0x6, 0x0, 0xcd, 0x3, 0xf0, 0x1a, 
+0x21, 0x23, 0x1e, 0x22, 0xa0, 0xb7, 0x2a, 0x1, 0x2f, 0xcd, 0x3, 0xf0, 0x1a, 0x2a, 0x0, 0x0, 
+0x11, 0xc0, 0x3, 0x3e, 0x10, 0xcd, 0x76, 0x2, 0x2a, 0xf, 0x0, 0x7e, 0x32, 0x0, 0x3, 0x23, 
+0x7e, 0x32, 0x1, 0x3, 0x23, 0x22, 0xf, 0x0, 0xcd, 0x3, 0x3, 0xdd, 0x7e, 0xd, 0x21, 0x8, 
+0x0, 0xbe, 0xc2, 0x16, 0x6, 0xf5, 0x3a, 0x1, 0x0, 0xd6, 0x8, 0xfe, 0x30, 0xc2, 0x12, 0x6, 
+0xc6, 0x8, 0x32, 0x1, 0x0, 0xf1, 0x21, 0x9, 0x0, 0xbe, 0xc2, 0x2e, 0x6, 0xf5, 0x3a, 0x1, 
+0x0, 0xc6, 0x8, 0xfe, 0xe0, 0xc2, 0x2a, 0x6, 0xd6, 0x8, 0x32, 0x1, 0x0, 0xf1, 0x2a, 0x0, 
+0x0, 0xcd, 0x3, 0xf0, 0x34, 0x13, 0x13, 0x13, 0x1a, 0xfe, 0x16, 0xca, 0xe3, 0x6, 0x1b, 0x1a, 
+0xfe, 0x16, 0xca, 0xe3, 0x6, 0x1b, 0x1a, 0xfe, 0x16, 0xca, 0xe3, 0x6, 0x1b, 0x1a, 0xfe, 0x16, 
+0xca, 0xe9, 0x6, 0x2a, 0x0, 0x0, 0x11, 0x60, 0x3, 0x3e, 0x28, 0xcd, 0x76, 0x2, 0x2a, 0xd, 
+0x0, 0xed, 0x5b, 0xf, 0x0, 0xed, 0x52, 0xfa, 0xe, 0xb, 0x2a, 0x4, 0x0, 0x3e, 0x1, 0x85, 
+0x27, 0x6f, 0xd2, 0x7a, 0x6, 0x3e, 0x1, 0x84, 0x27, 0x67, 0x22, 0x4, 0x0, 0x3a, 0x11, 0x0, 
+0xc6, 0x1, 0x27, 0x32, 0x11, 0x0, 0xfe, 0x10, 0xc2, 0xa3, 0x6, 0x97, 0x32, 0x11, 0x0, 0x2a, 
+0x6, 0x0, 0x3a, 0x2, 0x0, 0x85, 0x27, 0x6f, 0xd2, 0xa0, 0x6, 0x3e, 0x1, 0x84, 0x27, 0x67, 
+0x22, 0x6, 0x0, 0x3e, 0xff, 0x32, 0x82, 0xb7, 0x32, 0x84, 0xb7, 0x97, 0x32, 0x83, 0xb7, 0x32, 
+0x85, 0xb7, 0x32, 0x86, 0xb7, 0x32, 0x87, 0xb7, 0xcd, 0x3, 0xf0, 0x35, 0x6, 0xff, 0x10, 0xfe, 
+0x6, 0xff, 0x10, 0xfe, 0x97, 0x32, 0x82, 0xb7, 0x32, 0x84, 0xb7, 0xcd, 0x3, 0xf0, 0x35, 0x3a, 
+0x3, 0x0, 0xcd, 0x3, 0xf0, 0x14, 0xc3, 0xb1, 0x5, 0xc6, 0x10, 0xff, 0x4, 0x10, 0xc6, 0xc, 
+0xff, 0x2, 0x1d, 0x11, 0xa0, 0x3, 0xc3, 0xec, 0x6, 0x11, 0x80, 0x3, 0x2a, 0x0, 0x0, 0x2c, 
+0x3e, 0x28, 0xcd, 0x76, 0x2, 0x21, 0xd9, 0x6, 0x11, 0xa0, 0x2, 0x1, 0x5, 0x0, 0xed, 0xb0, 
+0x21, 0x0, 0x0, 0x22, 0x82, 0xb7, 0x22, 0x84, 0xb7, 0x22, 0x86, 0xb7, 0xcd, 0xa8, 0x2, 0x3e, 
+0x50, 0xcd, 0x3, 0xf0, 0x14, 0x3e, 0x70, 0xf5, 0x47, 0x2a, 0x0, 0x0, 0x2c, 0x3e, 0xf8, 0x84, 
+0x67, 0x11, 0x80, 0x1f, 0x78, 0xcd, 0x76, 0x2, 0x3e, 0x8, 0x84, 0x67, 0x78, 0x11, 0xa0, 0x1f, 
+0xcd, 0x76, 0x2, 0x3e, 0x8, 0x84, 0x67, 0x78, 0x11, 0xc0, 0x1f, 0xcd, 0x76, 0x2, 0x21, 0xde, 
+0x6, 0x11, 0xa0, 0x2, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x3e, 0x80, 0x32, 0x82, 0xb7, 0x32, 0x84, 
+0xb7, 0xcd, 0xa8, 0x2, 0xf1, 0xd6, 0x8, 0x20, 0xbe, 0xc3, 0x66, 0x7, 0xc6, 0x1, 0x80, 0x1, 
+0x20, 0xc6, 0x1, 0xff, 0x2, 0xfe, 0x21, 0x0, 0x0, 0x22, 0x82, 0xb7, 0x22, 0x84, 0xb7, 0x22, 
+0x86, 0xb7, 0x21, 0xc0, 0xa9, 0x1, 0x3f, 0x5, 0x3e, 0x17, 0xcd, 0x0, 0x4, 0x21, 0x61, 0x7, 
+0x11, 0xa0, 0x2, 0x1, 0x5, 0x0, 0xed, 0xb0, 0xcd, 0xa8, 0x2, 0x3a, 0xa1, 0x2, 0xed, 0x44, 
+0x32, 0xa1, 0x2, 0x21, 0xc0, 0xa9, 0x1, 0x3f, 0x5, 0x3e, 0x27, 0xcd, 0x0, 0x4, 0xcd, 0xa8, 
+0x2, 0x6, 0x5, 0xc5, 0x21, 0xc0, 0xa9, 0x1, 0x3f, 0x5, 0x3e, 0x17, 0xcd, 0x0, 0x4, 0x21, 
+0x0, 0xc0, 0x11, 0x0, 0x88, 0x1, 0x0, 0x14, 0xed, 0xb0, 0x3e, 0x20, 0x32, 0x82, 0xb7, 0x32, 
+0x84, 0xb7, 0x21, 0x5c, 0x7, 0x11, 0xa0, 0x2, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x21, 0xc0, 0xa9, 
+0x1, 0x3f, 0x5, 0x3e, 0x27, 0xcd, 0x0, 0x4, 0x21, 0x1, 0xc0, 0x11, 0x0, 0x88, 0x1, 0x0, 
+0x14, 0xed, 0xb0, 0x3e, 0x30, 0x32, 0x82, 0xb7, 0x32, 0x84, 0xb7, 0xcd, 0xa8, 0x2, 0xc1, 0x10, 
+0xb2, 0x6, 0x20, 0xc5, 0x21, 0xfe, 0xae, 0x11, 0xff, 0xae, 0x1, 0x40, 0x5, 0xed, 0xb8, 0x6, 
+0x2a, 0x11, 0x20, 0x0, 0x21, 0xc0, 0xa9, 0x36, 0x0, 0x19, 0x10, 0xfb, 0xc1, 0x10, 0xe4, 0x3e, 
+0x50, 0x32, 0xa3, 0xb7, 0x21, 0x17, 0x6, 0x22, 0xa0, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x5b, 0x5b, 
+0x5b, 0x5b, 0x0, 0x21, 0x17, 0x1c, 0x22, 0xa0, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x0, 0x3e, 0x2, 0xcd, 0x3, 0xf0, 0x3d, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x21, 0x4, 0x0, 
+0xed, 0x5b, 0x13, 0x0, 0x1, 0x4, 0x0, 0xed, 0xb0, 0xed, 0x53, 0x13, 0x0, 0xcd, 0x3, 0xf0, 
+0x23, 0xc, 0xa, 0x9, 0x9, 0x41, 0x55, 0x53, 0x57, 0x45, 0x52, 0x54, 0x55, 0x4e, 0x47, 0xa, 
+0xd, 0x9, 0x9, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0xa, 0xa, 0xa, 
+0x9, 0x9, 0x4d, 0x45, 0x54, 0x45, 0x52, 0x20, 0x20, 0x20, 0x20, 0x50, 0x55, 0x4e, 0x4b, 0x54, 
+0x45, 0xa, 0xa, 0xa, 0xd, 0x0, 0x21, 0x20, 0x0, 0x3e, 0x0, 0x3c, 0xf5, 0xcd, 0x3, 0xf0, 
+0x1c, 0xcd, 0x3, 0xf0, 0x23, 0x8, 0x8, 0x20, 0x9, 0x2e, 0x56, 0x45, 0x52, 0x53, 0x55, 0x43, 
+0x48, 0x3a, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x0, 0x7e, 0x23, 0xcd, 0x3, 0xf0, 0x1c, 0xcd, 
+0x3, 0xf0, 0x23, 0x8, 0x8, 0x8, 0x8, 0x0, 0x7e, 0x23, 0xcd, 0x3, 0xf0, 0x1c, 0xcd, 0x3, 
+0xf0, 0x23, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x0, 0x7e, 0x23, 0xcd, 0x3, 0xf0, 
+0x1c, 0xcd, 0x3, 0xf0, 0x23, 0x8, 0x8, 0x8, 0x8, 0x0, 0x7e, 0x23, 0xcd, 0x3, 0xf0, 0x1c, 
+0xcd, 0x3, 0xf0, 0x23, 0xa, 0xd, 0x0, 0xf1, 0x47, 0x3a, 0xa, 0x0, 0xb8, 0x78, 0xc2, 0x8b, 
+0x8, 0x2a, 0x13, 0x0, 0x2b, 0x7e, 0x57, 0x2b, 0x7e, 0x5f, 0x2a, 0x15, 0x0, 0xed, 0x52, 0xfa, 
+0x5, 0x9, 0xc3, 0x9, 0x9, 0xed, 0x53, 0x15, 0x0, 0xcd, 0x3, 0xf0, 0x23, 0xa, 0x20, 0x42, 
+0x65, 0x73, 0x74, 0x65, 0x72, 0x20, 0x56, 0x65, 0x72, 0x73, 0x75, 0x63, 0x68, 0x3a, 0x20, 0x20, 
+0x0, 0x2a, 0x15, 0x0, 0xcd, 0x3, 0xf0, 0x1a, 0xcd, 0x3, 0xf0, 0x23, 0x20, 0x50, 0x75, 0x6e, 
+0x6b, 0x74, 0x65, 0x0, 0x21, 0x1e, 0x13, 0x22, 0xa0, 0xb7, 0x3e, 0x8d, 0xcd, 0x3, 0xf0, 0x0, 
+0xdd, 0x7e, 0xd, 0xfe, 0xd, 0xc2, 0x40, 0x9, 0x3a, 0xa, 0x0, 0x3c, 0x32, 0xa, 0x0, 0xfe, 
+0xa, 0xc2, 0x42, 0x5, 0x2a, 0x15, 0x0, 0xed, 0x5b, 0x1, 0x2f, 0xed, 0x52, 0xfa, 0xdf, 0x9, 
+0x3e, 0x3, 0x21, 0xd, 0xc, 0x11, 0x12, 0x2, 0xcd, 0x3, 0xf0, 0x3c, 0x3e, 0x2, 0xcd, 0x3, 
+0xf0, 0x3d, 0x3e, 0x97, 0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0x9, 0x9, 0x9, 0x9, 
+0x9, 0x9, 0xa, 0xa, 0x2a, 0x2a, 0x2a, 0x20, 0x4e, 0x45, 0x55, 0x45, 0x52, 0x20, 0x52, 0x45, 
+0x43, 0x4f, 0x52, 0x44, 0x20, 0x2a, 0x2a, 0x2a, 0x0, 0x3e, 0x80, 0xcd, 0x3, 0xf0, 0x14, 0x21, 
+0x2, 0x5, 0x22, 0xa0, 0xb7, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x44, 0x65, 
+0x69, 0x6e, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x3a, 0x0, 0x3e, 0x3, 0xcd, 0x3, 0xf0, 0x3d, 0x3e, 
+0x7, 0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0x11, 0x0, 0xcd, 0x3, 0xf0, 0x17, 0x62, 
+0x6b, 0x11, 0x3, 0x2f, 0x1, 0x12, 0x0, 0xed, 0xb0, 0x2a, 0x15, 0x0, 0x22, 0x1, 0x2f, 0x3e, 
+0x2, 0xcd, 0x3, 0xf0, 0x3d, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0xa, 
+0xa, 0xa, 0xa, 0x9, 0x44, 0x65, 0x6e, 0x20, 0x52, 0x65, 0x6b, 0x6f, 0x72, 0x64, 0x20, 0x68, 
+0x7b, 0x6c, 0x74, 0x20, 0x7a, 0x75, 0x72, 0x20, 0x5a, 0x65, 0x69, 0x74, 0xa, 0xa, 0xd, 0x20, 
+0x20, 0x20, 0x20, 0x0, 0x21, 0x3, 0x2f, 0xcd, 0x3, 0xf0, 0x45, 0xcd, 0x3, 0xf0, 0x23, 0xa, 
+0xa, 0xd, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x69, 0x74, 0x20, 0x0, 0x2a, 0x1, 
+0x2f, 0xcd, 0x3, 0xf0, 0x1a, 0xcd, 0x3, 0xf0, 0x23, 0x20, 0x50, 0x75, 0x6e, 0x6b, 0x74, 0x65, 
+0x6e, 0x2e, 0xa, 0xa, 0xa, 0xd, 0x9, 0x46, 0x52, 0x45, 0x49, 0x53, 0x50, 0x49, 0x45, 0x4c, 
+0x45, 0x3a, 0x20, 0x0, 0x3a, 0x0, 0x2f, 0xcd, 0x3, 0xf0, 0x1c, 0x21, 0x1e, 0x13, 0x22, 0xa0, 
+0xb7, 0x3e, 0x8d, 0xcd, 0x3, 0xf0, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0x20, 0xf9, 0x3a, 0x0, 
+0x2f, 0xfe, 0x0, 0xca, 0x7f, 0xa, 0xd6, 0x1, 0x27, 0x32, 0x0, 0x2f, 0xc3, 0xe, 0x4, 0xcd, 
+0x3, 0xf0, 0x23, 0xc, 0xa, 0xa, 0xa, 0x20, 0x20, 0x20, 0x44, 0x61, 0x73, 0x20, 0x77, 0x61, 
+0x72, 0x27, 0x73, 0x20, 0x64, 0x61, 0x6e, 0x6e, 0x20, 0x61, 0x75, 0x63, 0x68, 0x20, 0x73, 0x63, 
+0x68, 0x6f, 0x6e, 0x20, 0x21, 0xa, 0xa, 0xa, 0xa, 0xd, 0x0, 0x3e, 0xf, 0x32, 0xa3, 0xb7, 
+0xcd, 0x3, 0xf0, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x6f, 0x63, 0x68, 
+0x20, 0x65, 0x69, 0x6e, 0x20, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x63, 0x68, 0x65, 0x6e, 0xa, 0xa, 
+0xd, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x65, 0x66, 
+0x7b, 0x6c, 0x6c, 0x69, 0x67, 0x20, 0x3f, 0xa, 0xa, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 
+0x8, 0x8, 0x28, 0x4a, 0x2f, 0x4e, 0x29, 0x7, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x4a, 0xca, 0xe, 
+0x4, 0xfe, 0x4e, 0xca, 0x0, 0xf0, 0xc3, 0xf9, 0xa, 0xc6, 0x10, 0xa0, 0x2, 0x10, 0x6, 0x1e, 
+0xc5, 0x78, 0x21, 0xc0, 0xa9, 0x1, 0x3f, 0x5, 0xcd, 0x0, 0x4, 0x21, 0x0, 0x0, 0x22, 0x82, 
+0xb7, 0x22, 0x84, 0xb7, 0x22, 0x86, 0xb7, 0x21, 0x9, 0xb, 0x11, 0xa0, 0x2, 0x1, 0x5, 0x0, 
+0xed, 0xb0, 0xcd, 0xa8, 0x2, 0xc1, 0x10, 0xd8, 0x3e, 0x2, 0xcd, 0x3, 0xf0, 0x3d, 0x3e, 0x7, 
+0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0xa, 0x0, 0x6, 0xe, 0xc5, 0x1e, 0x7, 0x68, 
+0x3e, 0x2, 0x32, 0x81, 0xb7, 0xcd, 0x3, 0xf0, 0xf, 0xcd, 0x3, 0xf0, 0x23, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x44, 0x55, 0x20, 0x48, 0x41, 0x53, 0x54, 0x20, 0x47, 0x45, 0x57, 0x4f, 0x4e, 
+0x4e, 0x45, 0x4e, 0x20, 0x21, 0x21, 0x21, 0xa, 0xd, 0x0, 0xc1, 0x10, 0xcf, 0x3e, 0x7, 0x32, 
+0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0xa, 0x9, 0x44, 0x75, 0x20, 0x62, 0x65, 0x6b, 0x6f, 0x6d, 
+0x6d, 0x73, 0x74, 0x0, 0x3a, 0x2, 0x0, 0xcd, 0x3, 0xf0, 0x1c, 0xcd, 0x3, 0xf0, 0x23, 0x8, 
+0x8, 0x20, 0x9, 0x20, 0x46, 0x72, 0x65, 0x69, 0x73, 0x70, 0x69, 0x65, 0x6c, 0x65, 0x2e, 0x0, 
+0x21, 0x1e, 0x13, 0x22, 0xa0, 0xb7, 0x3e, 0x8d, 0xcd, 0x3, 0xf0, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 
+0xd, 0xc2, 0xbc, 0xb, 0x21, 0x2, 0x0, 0x3a, 0x0, 0x2f, 0x86, 0x27, 0x32, 0x0, 0x2f, 0xc3, 
+0x32, 0x8, 0x3e, 0x2, 0xcd, 0x3, 0xf0, 0x3d, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 
+0x23, 0xc, 0xa, 0x20, 0x43, 0x41, 0x56, 0x45, 0x20, 0x2d, 0xa, 0xa, 0xd, 0x20, 0x64, 0x65, 
+0x75, 0x74, 0x73, 0x63, 0x68, 0x65, 0x20, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x28, 
+0x20, 0x4f, 0x6b, 0x74, 0x2e, 0x31, 0x39, 0x38, 0x37, 0x20, 0x29, 0xa, 0xa, 0xd, 0x20, 0x43, 
+0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x79, 0x20, 0x41, 0x2e, 0x57, 0x65, 
+0x69, 0x7e, 0x66, 0x6c, 0x6f, 0x67, 0xa, 0xd, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0xa, 0xd, 0x20, 0x53, 0x74, 0x65, 0x75, 0x65, 
+0x72, 0x65, 0x20, 0x64, 0x65, 0x69, 0x6e, 0x65, 0x6e, 0x20, 0x47, 0x6c, 0x65, 0x69, 0x74, 0x65, 
+0x72, 0x20, 0x73, 0x6f, 0x77, 0x65, 0x69, 0x74, 0xa, 0xd, 0x20, 0x77, 0x69, 0x65, 0x20, 0x6d, 
+0x7c, 0x67, 0x6c, 0x69, 0x63, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x69, 0x6e, 0x65, 0xa, 0xd, 
+0x20, 0x75, 0x6e, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x73, 0x63, 0x68, 0x74, 0x65, 0x20, 0x48, 0x7c, 
+0x68, 0x6c, 0x65, 0x20, 0x6f, 0x68, 0x6e, 0x65, 0x20, 0x64, 0x61, 0x62, 0x65, 0x69, 0xa, 0xd, 
+0x20, 0x61, 0x6e, 0x7a, 0x75, 0x65, 0x63, 0x6b, 0x65, 0x6e, 0x2e, 0xa, 0xa, 0xd, 0x20, 0x44, 
+0x75, 0x20, 0x68, 0x61, 0x73, 0x74, 0x20, 0x39, 0x20, 0x56, 0x65, 0x72, 0x73, 0x75, 0x63, 0x68, 
+0x65, 0x2c, 0x20, 0x64, 0x65, 0x72, 0x20, 0x62, 0x65, 0x73, 0x74, 0x65, 0xa, 0xd, 0x20, 0x6b, 
+0x6f, 0x6d, 0x6d, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x69, 0x65, 0x20, 0x45, 0x6e, 0x64, 0x77, 
+0x65, 0x72, 0x74, 0x75, 0x6e, 0x67, 0xa, 0xa, 0xd, 0x20, 0x48, 0x69, 0x6e, 0x77, 0x65, 0x69, 
+0x73, 0x3a, 0xa, 0xd, 0x20, 0x20, 0x41, 0x6c, 0x6c, 0x65, 0x20, 0x53, 0x74, 0x65, 0x6c, 0x6c, 
+0x65, 0x6e, 0x20, 0x73, 0x69, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x73, 0x73, 0x69, 0x65, 0x72, 0x62, 
+0x61, 0x72, 0x0, 0x21, 0x1e, 0x13, 0x22, 0xa0, 0xb7, 0x3e, 0x8d, 0xcd, 0x3, 0xf0, 0x0, 0xdd, 
+0x7e, 0xd, 0xfe, 0x0, 0xca, 0x1f, 0xd, 0xfe, 0xc, 0xca, 0x2d, 0xd, 0xc9, 0x3e, 0xc, 0xcd, 
+0x3, 0xf0, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0xca, 0x33, 0xd, 0xfe, 0x52, 0xc2, 0x0, 0xf0, 
+0x3e, 0x7, 0xcd, 0x3, 0xf0, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0xca, 0x46, 0xd, 0xfe, 0x41, 
+0xc2, 0x0, 0xf0, 0x3e, 0x7, 0xcd, 0x3, 0xf0, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0xca, 0x59, 
+0xd, 0xfe, 0x50, 0xc2, 0x0, 0xf0, 0xcd, 0x3, 0xf0, 0x23, 0x7, 0x7, 0x7, 0xc, 0xa, 0x20, 
+0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d, 0x20, 0x66, 0x72, 0x65, 0x69, 0x67, 0x65, 0x67, 
+0x65, 0x62, 0x65, 0x6e, 0xa, 0xa, 0xd, 0x25, 0x53, 0x41, 0x56, 0x45, 0x20, 0x32, 0x30, 0x30, 
+0x20, 0x33, 0x30, 0x30, 0x30, 0x20, 0x46, 0x39, 0x45, 0x0, 0x3e, 0x0, 0xdd, 0x77, 0x7, 0x3e, 
+0x7f, 0xdd, 0x77, 0x9, 0xcd, 0x3, 0xf0, 0x2c, 0xcd, 0x3, 0xf0, 0x12, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xfd, 
+0xdd, 0x77, 0x9, 0xdd, 0x77, 0x7, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 0x5f, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 
+0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 
+0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 
+0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 
+0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 
+0x50, 0x12, 0x12, 0x24, 0x24, 0x9, 0x9, 0x50, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x20, 0x20, 0xa0, 0xa4, 0xa8, 0xa8, 0xa5, 0xa1, 0x20, 0xa0, 0xa4, 0xa8, 0xa8, 0xa5, 0xa1, 
+0x20, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x20, 0x5b, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x20, 0x20, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x20, 0xac, 0xad, 0x20, 0x20, 0xaa, 0xab, 0x20, 
+0x5b, 0xa8, 0xa8, 0xa8, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x20, 0x20, 0xa2, 0xa6, 0xa9, 0xa9, 0xa7, 0xa3, 0x20, 0x5b, 0xa8, 0xa8, 0xa8, 0xa8, 0x5b, 
+0x20, 0x20, 0xac, 0xa6, 0xa7, 0xab, 0x20, 0x20, 0x5b, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x20, 0x20, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x4d, 0x61, 0x64, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x62, 0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x53, 0x4f, 0x57, 0x41, 0x43, 0x4f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x61, 0x63, 0x68, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x69, 0x6e, 0x65, 0x6d, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5a, 0x58, 0x2d, 0x38, 0x31, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 
+0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x6d, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x55, 0x4e, 0x4b, 
+0x54, 0x45, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x45, 0x4b, 0x4f, 0x52, 
+0x44, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 
+0x7, 0x1f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0xf8, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x1f, 0x7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xf8, 0xe0, 
+0xff, 0xff, 0xff, 0xf8, 0xe0, 0xc0, 0x80, 0x0, 0xff, 0xff, 0xff, 0x1f, 0x7, 0x3, 0x1, 0x0, 
+0x0, 0x80, 0xc0, 0xe0, 0xf8, 0xff, 0xff, 0xff, 0x0, 0x1, 0x3, 0x7, 0x1f, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 
+0x0, 0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x0, 
+0x7f, 0x3f, 0x1f, 0xf, 0x7, 0x3, 0x1, 0x0, 0x0, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x4, 0x0, 0x0, 0x3, 0x10, 0x48, 0x30, 0xf, 0x98, 0xc0, 0x78, 0xf, 0x8, 0xe0, 0x3c, 
+0x3c, 0xc, 0xe0, 0x18, 0x71, 0xfe, 0xe1, 0x88, 0x40, 0xeb, 0xaf, 0x0, 0x0, 0x59, 0x34, 0x0, 
+0x0, 0x41, 0x8, 0x0, 0x10, 0x30, 0x38, 0x8, 0x0, 0x39, 0x98, 0x10, 0x4f, 0x3, 0xcc, 0x22, 
+0x1, 0xf1, 0x86, 0x0, 0x0, 0x20, 0x1a, 0x8, 0x20, 0x41, 0x4b, 0x80, 0x0, 0xdb, 0x64, 0x18, 
+0x0, 0xfd, 0x54, 0x58, 0x49, 0xd8, 0xec, 0x48, 0x13, 0x10, 0xc6, 0x6, 0x0, 0x9, 0x83, 0x40, 
+0x8, 0x0, 0x1, 0x10, 0x7, 0xe2, 0x40, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0xe0, 0x4, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x14, 0x0, 0x14, 0x0, 0x13, 0x1, 0x13, 0x2, 0x13, 0x2, 0x12, 0x2, 0x12, 0x5, 0x12, 
+0x4, 0x12, 0x4, 0x11, 0x3, 0x11, 0x3, 0xf, 0x3, 0xc, 0x4, 0xa, 0x3, 0x9, 0x2, 0x7, 
+0x1, 0x9, 0x0, 0xc, 0x2, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xe, 0x4, 0xf, 0x4, 0xf, 
+0x9, 0x10, 0x6, 0x14, 0x5, 0x14, 0x3, 0x12, 0x3, 0xd, 0x4, 0x12, 0x1, 0x12, 0x1, 0x12, 
+0x0, 0x13, 0x0, 0x13, 0x0, 0x14, 0x1, 0x14, 0x2, 0x10, 0x3, 0xe, 0x4, 0x6, 0x4, 0x7, 
+0x4, 0x8, 0x4, 0x8, 0x4, 0x8, 0x4, 0x8, 0x6, 0x9, 0x3, 0xe, 0x2, 0x13, 0x3, 0x9, 
+0x3, 0x9, 0x3, 0x8, 0x3, 0x7, 0x3, 0x7, 0x2, 0x5, 0x1, 0x7, 0x1, 0x8, 0x0, 0x8, 
+0x0, 0x9, 0x0, 0xa, 0x0, 0xb, 0x1, 0x9, 0x4, 0x6, 0x3, 0x9, 0x2, 0x9, 0x3, 0x9, 
+0x3, 0xa, 0x3, 0xb, 0x4, 0xc, 0x5, 0xd, 0x1, 0xe, 0x4, 0x11, 0x4, 0x13, 0x5, 0x13, 
+0x5, 0x13, 0x6, 0x13, 0xf, 0x11, 0xb, 0x11, 0xc, 0x11, 0xd, 0x11, 0xc, 0x11, 0xa, 0x13, 
+0xd, 0xf, 0x9, 0x14, 0xc, 0x14, 0x4, 0x14, 0x4, 0x13, 0x3, 0xe, 0x3, 0x12, 0x5, 0x14, 
+0x1, 0x13, 0x1, 0x10, 0x1, 0xf, 0x0, 0xf, 0x1, 0x9, 0x4, 0x7, 0x0, 0xd, 0x3, 0xd, 
+0x5, 0xa, 0x4, 0xd, 0x4, 0xd, 0x5, 0xb, 0x7, 0x9, 0x7, 0x9, 0x7, 0xa, 0x6, 0xa, 
+0x3, 0xa, 0x7, 0xb, 0x8, 0xb, 0x3, 0xc, 0x2, 0xc, 0x2, 0x10, 0x1, 0x11, 0x1, 0x12, 
+0x1, 0x9, 0x1, 0xe, 0x1, 0xf, 0x2, 0x10, 0x2, 0x12, 0x4, 0x13, 0x3, 0x13, 0x3, 0x13, 
+0x2, 0x13, 0x0, 0x13, 0x0, 0x12, 0x0, 0x13, 0x4, 0x13, 0xa, 0x13, 0x2, 0x11, 0x1, 0x10, 
+0x0, 0x10, 0x5, 0x10, 0x2, 0x10, 0x1, 0x10, 0x6, 0x10, 0xc, 0x11, 0x6, 0x11, 0x4, 0x11, 
+0x2, 0x12, 0x3, 0x12, 0x1, 0x13, 0x0, 0x13, 0x2, 0x14, 0x1, 0x14, 0x1, 0x14, 0x1, 0x11, 
+0x1, 0x10, 0x0, 0xf, 0x0, 0x7, 0x0, 0x6, 0x0, 0x5, 0x0, 0x3, 0x0, 0x3, 0x0, 0x3, 
+0x0, 0x3, 0x1, 0x3, 0x1, 0x3, 0x0, 0x4, 0x1, 0x4, 0x1, 0x4, 0x1, 0x4, 0x1, 0x4, 
+0x2, 0x4, 0x0, 0x6, 0x0, 0x8, 0x0, 0xb, 0x0, 0xc, 0x1, 0xc, 0x3, 0xd, 0x2, 0xd, 
+0x2, 0xd, 0x1, 0xd, 0x1, 0xd, 0x3, 0xf, 0x3, 0x10, 0x2, 0x10, 0x1, 0x10, 0x0, 0x10, 
+0x1, 0xf, 0x1, 0xe, 0x2, 0x11, 0x4, 0x10, 0xb, 0xd, 0x2, 0x13, 0x1, 0x12, 0x1, 0x10, 
+0x1, 0x11, 0x2, 0xd, 0x2, 0xf, 0x4, 0xe, 0x7, 0x9, 0x1, 0x14, 0x2, 0x11, 0x3, 0x10, 
+0x6, 0x8, 0x5, 0xf, 0x2, 0x12, 0x1, 0x11, 0x5, 0xc, 0x7, 0x10, 0x0, 0x11, 0x1, 0x10, 
+0x2, 0x12, 0x5, 0x12, 0x7, 0x11, 0xe, 0x10, 0x2, 0x11, 0x4, 0x11, 0x5, 0x11, 0xb, 0x11, 
+0x3, 0x11, 0x4, 0x11, 0x1, 0x10, 0x8, 0x10, 0x4, 0xf, 0x3, 0xe, 0x4, 0xe, 0x6, 0xa, 
+0x3, 0x13, 0x4, 0x10, 0x5, 0xf, 0x6, 0xf, 0x7, 0xe, 0x8, 0xe, 0x9, 0xd, 0xa, 0xd, 
+0xb, 0xd, 0xb, 0xd, 0xb, 0xd, 0x7, 0xd, 0x5, 0xe, 0x4, 0xe, 0x4, 0xf, 0x4, 0x10, 
+0x4, 0x11, 0x4, 0x11, 0x5, 0x12, 0x8, 0x13, 0x9, 0x13, 0xa, 0x13, 0xb, 0x13, 0xf, 0x13, 
+0x10, 0x12, 0x10, 0x13, 0xf, 0x14, 0xe, 0x14, 0x10, 0x13, 0x11, 0x13, 0xd, 0x13, 0x8, 0x13, 
+0x7, 0x13, 0x6, 0x13, 0x6, 0x12, 0x3, 0x11, 0x1, 0x10, 0x2, 0xf, 0x3, 0xe, 0x5, 0xd, 
+0xb, 0xe, 0x3, 0xe, 0x1, 0xe, 0x5, 0xe, 0xc, 0x12, 0x3, 0x14, 0x1, 0x14, 0x2, 0x13, 
+0x1, 0x12, 0x0, 0x10, 0x4, 0xd, 0x1, 0x13, 0x0, 0x14, 0x1, 0xb, 0x1, 0x8, 0x2, 0x6, 
+0x3, 0x6, 0x4, 0x6, 0x4, 0x6, 0x4, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x5, 
+0x3, 0x5, 0x2, 0x6, 0x1, 0x7, 0x1, 0x8, 0x3, 0x9, 0x2, 0xa, 0x4, 0x13, 0x4, 0x13, 
+0x3, 0x13, 0x2, 0x12, 0x0, 0x12, 0x0, 0x11, 0x1, 0xf, 0x2, 0xe, 0x2, 0xf, 0x3, 0xf, 
+0x5, 0x10, 0x5, 0x11, 0x5, 0x11, 0x7, 0x12, 0x8, 0x13, 0x9, 0x14, 0x9, 0x13, 0x6, 0x13, 
+0x5, 0x13, 0x5, 0x13, 0x3, 0x12, 0x2, 0x13, 0x2, 0x13, 0x1, 0x12, 0x1, 0x11, 0x0, 0x11, 
+0x0, 0x10, 0x0, 0x12, 0x1, 0x13, 0x3, 0x13, 0x9, 0x14, 0x3, 0x14, 0x1, 0x13, 0x1, 0x13, 
+0x1, 0x12, 0x1, 0x11, 0x0, 0xe, 0x0, 0xf, 0x1, 0x10, 0x1, 0xf, 0x1, 0x10, 0x1, 0x10, 
+0x2, 0x11, 0x3, 0x12, 0x4, 0x13, 0x4, 0x14, 0x5, 0x13, 0x6, 0x12, 0xb, 0x11, 0xc, 0x10, 
+0xc, 0xf, 0xb, 0xe, 0xa, 0xe, 0xc, 0xe, 0xc, 0xf, 0xa, 0x10, 0x8, 0x11, 0x7, 0x14, 
+0x7, 0x14, 0x7, 0x14, 0x6, 0x13, 0x2, 0x11, 0x8, 0x12, 0x8, 0x13, 0x9, 0x14, 0xb, 0x14, 
+0x11, 0x14, 0x12, 0x14, 0x3, 0x14, 0x2, 0x14, 0x7, 0x14, 0x8, 0x14, 0x10, 0x12, 0x8, 0x13, 
+0xe, 0x13, 0x0, 0x12, 0x2, 0x14, 0x1, 0x13, 0xa, 0x12, 0x4, 0xe, 0x7, 0xe, 0xb, 0xd, 
+0xa, 0x11, 0x9, 0x10, 0x9, 0xe, 0x6, 0x12, 0x0, 0xb, 0x1, 0xe, 0x9, 0xc, 0x2, 0x14, 
+0x3, 0xf, 0x6, 0xe, 0x1, 0xd, 0x0, 0xe, 0x1, 0x10, 0x0, 0x11, 0x0, 0x12, 0x1, 0x12, 
+0x0, 0x12, 0x0, 0x13, 0x0, 0xe, 0x0, 0x2, 0x0, 0x7, 0x0, 0x11, 0x0, 0x13, 0x1, 0x14, 
+0x2, 0xa, 0x2, 0xb, 0x3, 0xc, 0x3, 0xe, 0x4, 0x10, 0x6, 0xa, 0x8, 0xb, 0x3, 0x11, 
+0x1, 0xd, 0x9, 0xb, 0x8, 0xb, 0x7, 0xb, 0x6, 0xc, 0x6, 0xc, 0x6, 0xc, 0x6, 0xa, 
+0x6, 0xd, 0x6, 0xc, 0x7, 0x9, 0x3, 0xa, 0x1, 0xb, 0x0, 0xb, 0x8, 0xc, 0x1, 0xf, 
+0x0, 0xf, 0x1, 0xf, 0x1, 0x10, 0x5, 0x10, 0x3, 0x12, 0xe, 0x11, 0xc, 0x11, 0xf, 0x12, 
+0x8, 0x12, 0x4, 0x11, 0x7, 0x11, 0xe, 0x10, 0x3, 0x11, 0x2, 0x12, 0x0, 0x13, 0xb, 0x12, 
+0x5, 0x10, 0x6, 0xd, 0x9, 0x14, 0x4, 0xf, 0x8, 0xb, 0x4, 0xd, 0x2, 0x12, 0x1, 0xa, 
+0x2, 0x13, 0x4, 0x13, 0x6, 0x12, 0x7, 0x12, 0x7, 0x11, 0x8, 0x11, 0xc, 0x10, 0xd, 0x10, 
+0xe, 0x10, 0xe, 0x10, 0xe, 0x10, 0xe, 0x10, 0xe, 0x10, 0xd, 0x10, 0x5, 0x10, 0xb, 0x10, 
+0xc, 0xf, 0x8, 0xe, 0x7, 0xe, 0x6, 0xe, 0x4, 0xe, 0x3, 0xf, 0x2, 0x12, 0x3, 0x13, 
+0x5, 0x14, 0x6, 0x13, 0xa, 0xc, 0x2, 0x12, 0x1, 0x13, 0x0, 0x14, 0x1, 0xf, 0x8, 0xa, 
+0x3, 0x13, 0x2, 0x11, 0x3, 0x10, 0x4, 0xd, 0x6, 0x8, 0x3, 0x11, 0x1, 0x13, 0x4, 0x14, 
+0x7, 0x9, 0x6, 0x10, 0x3, 0xe, 0x1, 0x14, 0x8, 0x13, 0x5, 0x11, 0x2, 0xc, 0xa, 0xf, 
+0x3, 0x12, 0x0, 0x13, 0x2, 0x13, 0xc, 0x14, 0x4, 0xf, 0x8, 0x13, 0x3, 0x13, 0x2, 0x14, 
+0x1, 0x12, 0x0, 0xf, 0x0, 0x13, 0x0, 0x12, 0x5, 0xa, 0x2, 0x13, 0x8, 0x11, 0x0, 0x14, 
+0x1, 0x11, 0x6, 0x10, 0x4, 0xf, 0x7, 0x13, 0xd, 0x14, 0xa, 0x14, 0xa, 0x14, 0xd, 0x13, 
+0x10, 0x12, 0xb, 0x14, 0x2, 0x14, 0x1, 0x14, 0x0, 0x13, 0xe, 0x10, 0xe, 0x10, 0xe, 0x10, 
+0xe, 0x10, 0xd, 0x10, 0xc, 0x10, 0xb, 0x10, 0xa, 0x10, 0xa, 0xf, 0xa, 0xe, 0xa, 0xd, 
+0xa, 0xc, 0xa, 0xc, 0xa, 0xc, 0xa, 0xc, 0xa, 0xc, 0xa, 0xc, 0xa, 0xc, 0xa, 0xc, 
+0x9, 0xc, 0x9, 0xc, 0x9, 0xc, 0x9, 0xb, 0x9, 0xb, 0x7, 0xc, 0x6, 0xd, 0x6, 0xf, 
+0x6, 0x10, 0x5, 0x10, 0x4, 0x11, 0x3, 0x11, 0x1, 0x11, 0x0, 0x13, 0x0, 0x13, 0x0, 0x12, 
+0x0, 0x11, 0x0, 0xe, 0x0, 0x14, 0x0, 0x13, 0x1, 0x13, 0x1, 0x12, 0x1, 0x12, 0x1, 0x13, 
+0x2, 0x14, 0x2, 0x14, 0x2, 0xc, 0x4, 0x10, 0x5, 0x14, 0x6, 0x14, 0x7, 0x14, 0x8, 0x13, 
+0x9, 0x12, 0xb, 0x12, 0xd, 0x12, 0xd, 0x12, 0xf, 0x13, 0x10, 0x12, 0x10, 0x12, 0xf, 0x12, 
+0xf, 0x13, 0x9, 0x14, 0x2, 0x13, 0x6, 0x14, 0xc, 0x13, 0x7, 0x12, 0x1, 0xe, 0x5, 0x13, 
+0x9, 0x12, 0x4, 0xf, 0xd, 0x13, 0x7, 0x14, 0x2, 0x12, 0xa, 0x11, 0x0, 0x13, 0x1, 0x12, 
+0x1, 0x10, 0x5, 0xb, 0x2, 0xa, 0x3, 0xb, 0x4, 0xb, 0x5, 0xb, 0x9, 0xc, 0x0, 0x11, 
+0x5, 0x13, 0xa, 0x12, 0x6, 0xf, 0xc, 0x12, 0x5, 0x13, 0x9, 0x11, 0xe, 0x12, 0xb, 0x14, 
+0x6, 0x14, 0x9, 0x13, 0x4, 0x12, 0xb, 0xe, 0x5, 0xd, 0x1, 0x11, 0xa, 0xe, 0x9, 0x10, 
+0xc, 0x14, 0x4, 0x12, 0x2, 0xf, 0x0, 0x13, 0x8, 0xd, 0x4, 0x11, 0xb, 0x12, 0x5, 0x13, 
+0x3, 0x11, 0xa, 0x14, 0x4, 0x12, 0xf, 0x13, 0x2, 0x14, 0x8, 0x13, 0x11, 0x13, 0x4, 0x13, 
+0xa, 0x14, 0x11, 0x13, 0x7, 0x13, 0x4, 0x13, 0xa, 0x13, 0x2, 0x12, 0x2, 0x11, 0x4, 0x10, 
+0x5, 0xf, 0x1, 0xf, 0x3, 0xf, 0x0, 0xf, 0x0, 0xf, 0x5, 0xe, 0x0, 0xd, 0x1, 0xc, 
+0x1, 0xc, 0x0, 0xb, 0x0, 0xc, 0x0, 0xd, 0x0, 0xf, 0x0, 0x2, 0x0, 0xa, 0x0, 0xb, 
+0x0, 0xd, 0x0, 0x6, 0x1, 0x7, 0x1, 0x7, 0x4, 0x8, 0x1, 0xc, 0x2, 0xd, 0x6, 0x10, 
+0x1, 0x12, 0x5, 0xd, 0x2, 0xc, 0x1, 0x7, 0x1, 0x9, 0x2, 0xb, 0x1, 0x8, 0x0, 0x4, 
+0x0, 0x5, 0x0, 0x3, 0x0, 0xc, 0x1, 0xf, 0x1, 0x11, 0x2, 0xa, 0x3, 0x7, 0x2, 0x5, 
+0x1, 0xf, 0x0, 0xb, 0x1, 0x7, 0x2, 0xb, 0x5, 0xf, 0x1, 0x12, 0x0, 0x12, 0x7, 0x11, 
+0x1, 0x10, 0x9, 0xb, 0x5, 0xf, 0x1, 0x10, 0x3, 0x11, 0x4, 0x12, 0x0, 0x13, 0x5, 0x12, 
+0x1, 0x11, 0x0, 0x7, 0x2, 0xc, 0x4, 0x12, 0x3, 0x13, 0x2, 0x14, 0x1, 0x12, 0x1, 0x11, 
+0x0, 0xd, 0x2, 0x12, 0xb, 0x11, 0x5, 0x13, 0x4, 0x12, 0x3, 0x11, 0x1, 0xc, 0x2, 0x10, 
+0xa, 0x11, 0x3, 0x13, 0x9, 0x12, 0x3, 0x14, 0x2, 0xb, 0x1, 0x13, 0x1, 0x12, 0x1, 0x11, 
+0x2, 0x8, 0x3, 0xf, 0x4, 0x10, 0x4, 0x12, 0x5, 0x13, 0x8, 0x12, 0x5, 0xa, 0x4, 0x10, 
+0x3, 0x12, 0x2, 0x14, 0x0, 0x9, 0x0, 0xa, 0x0, 0xd, 0x0, 0xf, 0x0, 0xf, 0x1, 0xf, 
+0x1, 0xf, 0x2, 0xf, 0x4, 0x10, 0x5, 0x11, 0x7, 0x11, 0xe, 0x11, 0xf, 0x11, 0x5, 0x12, 
+0x4, 0x13, 0xc, 0x13, 0x10, 0x13, 0x11, 0x13, 0x11, 0x13, 0x10, 0x13, 0x11, 0x14, 0x11, 0x13, 
+0x11, 0x13, 0x11, 0x13, 0x10, 0x13, 0xf, 0x13, 0xe, 0x14, 0xd, 0x14, 0xc, 0x13, 0xb, 0x12, 
+0x8, 0x12, 0x8, 0x12, 0x4, 0x12, 0x2, 0x13, 0x1, 0x14, 0x0, 0x11, 0x1, 0xe, 0x2, 0x8, 
+0x1, 0xc, 0x0, 0x10, 0x3, 0x11, 0x0, 0x12, 0x1, 0x11, 0x4, 0x13, 0x5, 0x12, 0xb, 0xf, 
+0x1, 0x12, 0x6, 0x11, 0x0, 0x10, 0x7, 0xc, 0x4, 0x11, 0x1, 0x12, 0x2, 0x14, 0xb, 0xe, 
+0x8, 0x12, 0xc, 0x12, 0x5, 0x13, 0xd, 0x12, 0x4, 0x11, 0xf, 0x12, 0xb, 0x13, 0x7, 0x14, 
+0x3, 0x12, 0x5, 0x13, 0xb, 0x12, 0x4, 0x12, 0x3, 0xd, 0x2, 0x11, 0x8, 0xd, 0x2, 0xf, 
+0x1, 0xa, 0x0, 0xd, 0x2, 0x9, 0x4, 0x11, 0x7, 0xe, 0x1, 0x9, 0x5, 0xa, 0x1, 0xb, 
+0x0, 0x10, 0x4, 0x10, 0x5, 0x11, 0x6, 0xe, 0xb, 0x13, 0x3, 0x12, 0xc, 0x10, 0x0, 0x14, 
+0xe, 0x14, 0x9, 0x13, 0x8, 0x12, 0x10, 0x12, 0xf, 0x13, 0xe, 0x13, 0xd, 0x13, 0x11, 0x14, 
+0xe, 0x14, 0xd, 0x14, 0xa, 0x14, 0x9, 0x13, 0x8, 0x13, 0x7, 0x12, 0x5, 0x11, 0x5, 0x10, 
+0x4, 0xf, 0x3, 0x10, 0x2, 0x11, 0x1, 0x11, 0x1, 0x11, 0x1, 0x12, 0x1, 0x12, 0x1, 0x13, 
+0x1, 0x13, 0x1, 0x14, 0x1, 0x14, 0x2, 0x13, 0x3, 0x12, 0x0, 0x11, 0x1, 0x5, 0x1, 0xb, 
+0x1, 0xc, 0x2, 0xd, 0x1, 0xe, 0x2, 0x11, 0x6, 0xe, 0x3, 0xa, 0x2, 0xd, 0x4, 0xc, 
+0x1, 0xb, 0x0, 0x6, 0x3, 0x6, 0x2, 0x5, 0x1, 0x6, 0x2, 0x9, 0x3, 0xa, 0x4, 0x9, 
+0x5, 0x8, 0x6, 0x8, 0x5, 0xc, 0x1, 0xf, 0x6, 0x10, 0x2, 0x11, 0x3, 0x13, 0x1, 0x11, 
+0x2, 0xd, 0xb, 0x11, 0x4, 0x12, 0x7, 0x13, 0xc, 0x12, 0x1, 0xe, 0x4, 0x11, 0x5, 0x12, 
+0x9, 0x11, 0x3, 0xf, 0x2, 0xb, 0x1, 0xd, 0x1, 0x10, 0x0, 0xf, 0x4, 0x8, 0x2, 0xf, 
+0x6, 0xe, 0x2, 0xd, 0x7, 0x9, 0x4, 0xf, 0x0, 0xe, 0x3, 0xd, 0x2, 0x8, 0x4, 0x9, 
+0x1, 0x6, 0x1, 0x8, 0x1, 0x9, 0x0, 0xa, 0x5, 0xa, 0x2, 0xa, 0x3, 0xb, 0x8, 0xe, 
+0x1, 0xd, 0x0, 0xd, 0x4, 0xd, 0xb, 0xe, 0x4, 0xe, 0x3, 0xe, 0xc, 0xe, 0x7, 0xf, 
+0x4, 0x11, 0x2, 0x11, 0x1, 0x11, 0x2, 0x10, 0x3, 0xf, 0x6, 0xe, 0x2, 0xd, 0x4, 0x8, 
+0x3, 0x9, 0x2, 0xb, 0x0, 0xc, 0x1, 0xe, 0x2, 0x11, 0x4, 0x13, 0x7, 0x11, 0xa, 0x10, 
+0x5, 0xe, 0x8, 0x12, 0x6, 0x14, 0x7, 0x13, 0xd, 0x12, 0x5, 0x13, 0x5, 0xf, 0x5, 0x11, 
+0x4, 0xe, 0x6, 0x12, 0x7, 0x13, 0xb, 0x12, 0x6, 0x14, 0x4, 0x14, 0x3, 0x13, 0x4, 0x13, 
+0x5, 0x12, 0x6, 0x11, 0x5, 0xf, 0x4, 0x8, 0x3, 0xc, 0x2, 0x12, 0x4, 0x11, 0x7, 0x10, 
+0x6, 0xf, 0x9, 0xb, 0x4, 0xf, 0x6, 0xc, 0x7, 0x12, 0xa, 0x10, 0x5, 0xe, 0x7, 0x11, 
+0xc, 0x12, 0x6, 0x13, 0x4, 0x14, 0x3, 0x12, 0xf, 0x13, 0x8, 0x11, 0x7, 0x11, 0x5, 0x12, 
+0x2, 0x13, 0x3, 0x14, 0x8, 0x11, 0x4, 0xd, 0x3, 0xf, 0x5, 0x10, 0x6, 0x12, 0xc, 0x11, 
+0x7, 0x10, 0x4, 0x10, 0x3, 0x11, 0x2, 0x11, 0x3, 0x12, 0x4, 0x13, 0x5, 0x13, 0x6, 0x12, 
+0x7, 0x12, 0xb, 0x12, 0xc, 0x11, 0xf, 0x11, 0xf, 0x11, 0xe, 0x11, 0xd, 0x11, 0xd, 0x11, 
+0xd, 0x10, 0xd, 0xf, 0xc, 0x10, 0xb, 0x11, 0xc, 0x11, 0xb, 0x11, 0xa, 0x12, 0x9, 0x11, 
+0xa, 0x10, 0xb, 0xe, 0xb, 0xd, 0xb, 0xd, 0x8, 0xe, 0x6, 0xf, 0x4, 0x11, 0x2, 0x13, 
+0x1, 0x10, 0x2, 0xf, 0x7, 0x9, 0x1, 0xe, 0x0, 0xb, 0x3, 0xe, 0x6, 0xf, 0x2, 0xc, 
+0x3, 0xe, 0xa, 0x11, 0x4, 0xe, 0x6, 0x11, 0xc, 0x13, 0x8, 0x11, 0x4, 0xf, 0xa, 0x13, 
+0x0, 0x14, 0x2, 0xc, 0x3, 0xf, 0x8, 0xd, 0x1, 0xa, 0x3, 0xf, 0x2, 0xd, 0x3, 0x11, 
+0x5, 0xc, 0xa, 0x10, 0x7, 0x11, 0x5, 0x13, 0x3, 0xc, 0x7, 0x12, 0x1, 0x11, 0x4, 0xf, 
+0x7, 0x9, 0x2, 0xe, 0x5, 0xc, 0x4, 0xb, 0x6, 0xe, 0x9, 0x11, 0x4, 0x13, 0xa, 0xf, 
+0x3, 0x11, 0x4, 0xe, 0x6, 0x14, 0x7, 0x11, 0x8, 0xa, 0x7, 0xf, 0x6, 0xe, 0x5, 0x10, 
+0x9, 0xc, 0x4, 0xd, 0x6, 0x11, 0x8, 0xf, 0x3, 0xd, 0x2, 0xa, 0x0, 0xe, 0x8, 0xe, 
+0x1, 0xf, 0x1, 0x10, 0x2, 0x11, 0x3, 0x9, 0x4, 0xe, 0x3, 0xa, 0x2, 0x9, 0x3, 0x8, 
+0x3, 0x5, 0x1, 0x5, 0x2, 0x5, 0x2, 0x6, 0x1, 0x7, 0x3, 0x8, 0x4, 0x9, 0x5, 0xa, 
+0x6, 0xb, 0x5, 0xe, 0x3, 0x10, 0x1, 0x13, 0x0, 0x14, 0x0, 0x14, 0x0, 0x12, 0x0, 0x10, 
+0x0, 0xe, 0x0, 0xa, 0x0, 0x2, 0x0, 0x8, 0x0, 0xc, 0x0, 0xe, 0x0, 0xe, 0x0, 0xf, 
+0x1, 0xf, 0x2, 0xf, 0x3, 0xe, 0x2, 0xb, 0x1, 0xc, 0x0, 0xf, 0x5, 0x13, 0x1, 0x14, 
+0x0, 0x12, 0x3, 0x13, 0x1, 0x14, 0x0, 0x13, 0x0, 0x14, 0x1, 0x14, 0x6, 0x14, 0x12, 0x14, 
+0x10, 0x14, 0x9, 0x14, 0x5, 0x14, 0x2, 0x14, 0x4, 0x13, 0xe, 0x12, 0xd, 0x10, 0x7, 0x12, 
+0x1, 0x13, 0xa, 0x14, 0x5, 0x11, 0x4, 0xd, 0x3, 0x11, 0x5, 0x13, 0x6, 0xf, 0x8, 0x12, 
+0xd, 0x13, 0x4, 0x13, 0x6, 0x14, 0xb, 0x14, 0x4, 0x14, 0x9, 0x14, 0x12, 0x14, 0xe, 0x14, 
+0x4, 0x14, 0x2, 0x14, 0x3, 0x13, 0x4, 0x12, 0x5, 0x11, 0x7, 0x10, 0xd, 0xf, 0x8, 0x10, 
+0x4, 0x11, 0x3, 0x12, 0x2, 0x14, 0x7, 0x14, 0x8, 0x14, 0x9, 0x13, 0x8, 0x13, 0xa, 0x12, 
+0xb, 0x11, 0xd, 0xf, 0xb, 0x10, 0xa, 0x10, 0x8, 0x10, 0x7, 0x11, 0x5, 0x11, 0x0, 0x12, 
+0x2, 0x12, 0x1, 0x13, 0x2, 0x13, 0x3, 0x14, 0x0, 0x14, 0x1, 0x13, 0x1, 0x12, 0x0, 0xc, 
+0x0, 0x3, 0x0, 0x3, 0x0, 0x2, 0x0, 0x3, 0x0, 0x6, 0x0, 0x7, 0x0, 0x9, 0x0, 0x9, 
+0x1, 0x8, 0x3, 0x9, 0x4, 0x8, 0x6, 0xd, 0x5, 0xc, 0x5, 0xb, 0x5, 0xe, 0x6, 0xc, 
+0x9, 0xf, 0x7, 0xe, 0x8, 0xd, 0xb, 0xe, 0x9, 0xd, 0x7, 0xd, 0x6, 0xd, 0x6, 0xc, 
+0x6, 0xb, 0x6, 0xa, 0x6, 0x9, 0x6, 0xc, 0x7, 0xd, 0x7, 0xe, 0x8, 0xd, 0x7, 0xc, 
+0x6, 0xc, 0x5, 0xb, 0x5, 0x9, 0x5, 0xb, 0x5, 0xa, 0x4, 0xb, 0x4, 0xa, 0x3, 0x9, 
+0x2, 0x8, 0x0, 0x7, 0x3, 0x5, 0x2, 0x8, 0x1, 0x9, 0x3, 0xb, 0x4, 0xc, 0x1, 0xf, 
+0x3, 0xd, 0x6, 0xe, 0x8, 0xf, 0x7, 0x10, 0xa, 0x12, 0x9, 0x11, 0x2, 0xf, 0x3, 0x10, 
+0x5, 0xb, 0x8, 0xa, 0x4, 0xb, 0x3, 0xc, 0x5, 0xe, 0x7, 0xf, 0x6, 0xe, 0x8, 0xd, 
+0x9, 0xc, 0x9, 0xb, 0x8, 0xc, 0x8, 0xd, 0x9, 0xe, 0xa, 0x10, 0xb, 0x11, 0xc, 0x13, 
+0xd, 0x14, 0xc, 0x14, 0xb, 0x14, 0xb, 0x14, 0xa, 0x14, 0x9, 0x14, 0x8, 0x14, 0x7, 0x14, 
+0x7, 0x14, 0x7, 0x14, 0x6, 0x14, 0x5, 0x14, 0x5, 0x14, 0x4, 0x14, 0x2, 0x14, 0x1, 0x14, 
+0x2, 0x14, 0x3, 0x14, 0x2, 0x14, 0x1, 0x14, 0x1, 0x14, 0x0, 0x14, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x55, 0x0, 0x44, 0x46, 0x46, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+};
+unsigned char dump_house[12928] = {
+0x48, 0x4f, 0x55, 0x53, 0x45, 0x2b, 0x20, 0x20, 0x43, 0x4f, 0x4d, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x3, 0x0, 0x2, 0xe0, 0x33, 0xfc, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x14, 0xa0, 0x42, 0x11, 0x4a, 0x11, 0x14, 0xad, 0x15, 0xad, 0x0, 0xf5, 0xc5, 0xd5, 0xe5, 0x22, 
+0x0, 0x2, 0xed, 0x53, 0x2, 0x2, 0xed, 0x43, 0x4, 0x2, 0x32, 0xa, 0x2, 0xcd, 0x3, 0xf0, 
+0x34, 0xed, 0x53, 0x6, 0x2, 0x3a, 0xa, 0x2, 0xfe, 0x0, 0xcc, 0x70, 0x2, 0xfe, 0x1, 0xcc, 
+0x9e, 0x2, 0x2a, 0x0, 0x2, 0x2c, 0xcd, 0x3, 0xf0, 0x34, 0xed, 0x53, 0x8, 0x2, 0x3a, 0xa, 
+0x2, 0xfe, 0x0, 0xcc, 0x70, 0x2, 0xfe, 0x1, 0xcc, 0x9e, 0x2, 0x2a, 0x6, 0x2, 0x3a, 0xa, 
+0x2, 0xfe, 0x0, 0xcc, 0x87, 0x2, 0xfe, 0x1, 0xcc, 0xb3, 0x2, 0x2a, 0x8, 0x2, 0x3a, 0xa, 
+0x2, 0xfe, 0x0, 0xcc, 0x87, 0x2, 0xfe, 0x1, 0xcc, 0xb3, 0x2, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 
+0x6, 0x10, 0xc5, 0xed, 0x5b, 0x2, 0x2, 0xeb, 0xed, 0xa0, 0xeb, 0xed, 0x53, 0x2, 0x2, 0x11, 
+0x1f, 0x0, 0x19, 0xc1, 0x10, 0xec, 0xc9, 0x6, 0x4, 0xc5, 0xed, 0x5b, 0x4, 0x2, 0xeb, 0xed, 
+0xa0, 0xeb, 0xed, 0x53, 0x4, 0x2, 0x11, 0x1f, 0x0, 0x19, 0xc1, 0x10, 0xec, 0xc9, 0x6, 0x10, 
+0xc5, 0xed, 0x5b, 0x2, 0x2, 0xed, 0xa0, 0xed, 0x53, 0x2, 0x2, 0x11, 0x1f, 0x0, 0x19, 0xc1, 
+0x10, 0xee, 0xc9, 0x6, 0x4, 0xc5, 0xed, 0x5b, 0x2, 0x2, 0xed, 0xa0, 0xed, 0x53, 0x2, 0x2, 
+0x11, 0x1f, 0x0, 0x19, 0xc1, 0x10, 0xee, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0xc6, 0xff, 0xff, 0x6, 0x80, 0xff, 0x6, 0x0, 0xf5, 0xc5, 0xd5, 0xe5, 0x2a, 0x0, 0x3, 0x22, 
+0x27, 0x3, 0x22, 0x2f, 0x3, 0x21, 0x2, 0x3, 0x11, 0x5, 0x3, 0x1, 0x3, 0x0, 0xed, 0xb0, 
+0xcd, 0x3, 0xf0, 0x35, 0x3a, 0x82, 0xb7, 0xc6, 0xff, 0x32, 0x82, 0xb7, 0x3a, 0x84, 0xb7, 0xc6, 
+0xff, 0x32, 0x84, 0xb7, 0x3a, 0x5, 0x3, 0x47, 0x10, 0xfe, 0x3a, 0x6, 0x3, 0x3d, 0x32, 0x6, 
+0x3, 0xfe, 0x0, 0xc2, 0x34, 0x3, 0x3a, 0x3, 0x3, 0x32, 0x6, 0x3, 0x3a, 0x7, 0x3, 0x3d, 
+0x32, 0x7, 0x3, 0xfe, 0x0, 0xc2, 0x20, 0x3, 0x21, 0x82, 0xb7, 0x36, 0x0, 0x23, 0x23, 0x36, 
+0x0, 0xcd, 0x3, 0xf0, 0x35, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x4, 0xe0, 0x40, 0x2b, 0x80, 0x0, 0x29, 0x22, 0x40, 0x22, 0x60, 0x22, 0x80, 0xfe, 0x0, 0xfe, 
+0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x9, 0x8, 0xa, 0xb, 0x20, 0x20, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x70, 0x0, 0xc6, 0xf, 0xff, 0x4, 0xff, 0x0, 
+0x0, 0x30, 0x0, 0x0, 0x0, 0xc6, 0xfa, 0xff, 0x3, 0x4, 0x40, 0x0, 0x30, 0x0, 0x0, 0x0, 
+0xed, 0x44, 0xff, 0x18, 0x7, 0x40, 0x0, 0x70, 0x0, 0x0, 0x0, 0xd6, 0x5, 0xff, 0x6, 0x4, 
+0x40, 0x0, 0x50, 0x0, 0x0, 0x0, 0xc6, 0xc, 0xff, 0x4, 0x20, 0x0, 0x0, 0x8, 0x0, 0x0, 
+0x0, 0xc6, 0x10, 0xff, 0x6, 0x10, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0xc6, 0x1, 0xff, 0x2, 
+0x10, 0x40, 0x0, 0x20, 0x0, 0x0, 0x0, 0xc6, 0x7f, 0xff, 0x3, 0x80, 0x80, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x47, 0x41, 0x4d, 0x45, 0x20, 0x4f, 0x56, 0x45, 0x52, 0x0, 0x3e, 0x20, 0x54, 0x4f, 
+0x50, 0x2d, 0x46, 0x49, 0x56, 0x45, 0x20, 0x3c, 0x0, 0x9, 0x31, 0x2e, 0x20, 0x9, 0x0, 0x9, 
+0x32, 0x2e, 0x20, 0x9, 0x0, 0x9, 0x33, 0x2e, 0x20, 0x9, 0x0, 0x9, 0x34, 0x2e, 0x20, 0x9, 
+0x0, 0x9, 0x35, 0x2e, 0x20, 0x9, 0x0, 0x2a, 0x20, 0x4e, 0x45, 0x57, 0x20, 0x52, 0x45, 0x43, 
+0x4f, 0x52, 0x44, 0x20, 0x2a, 0x0, 0x3e, 0x7, 0x21, 0x0, 0x0, 0x11, 0x28, 0x20, 0xcd, 0x3, 
+0xf0, 0x3c, 0x21, 0x50, 0x4, 0x11, 0x0, 0x0, 0x1, 0x2f, 0x0, 0xed, 0xb0, 0x3a, 0x50, 0x0, 
+0x32, 0x1f, 0x0, 0x3e, 0x7, 0xcd, 0x3, 0xf0, 0x3d, 0xcd, 0x3, 0xf0, 0x23, 0x10, 0x11, 0x0, 
+0x21, 0x0, 0x27, 0x22, 0xaa, 0xb7, 0x21, 0x0, 0x22, 0x11, 0x0, 0x1d, 0x6, 0x20, 0xc5, 0x6, 
+0x28, 0xc5, 0x1a, 0x32, 0xa3, 0xb7, 0x7e, 0xcd, 0x3, 0xf0, 0x0, 0x23, 0x13, 0xc1, 0x10, 0xf1, 
+0xc1, 0x10, 0xeb, 0x3e, 0xa0, 0xcd, 0x3, 0xf0, 0x14, 0xc3, 0x7a, 0x5, 0x40, 0x0, 0x20, 0x0, 
+0x0, 0x7, 0x10, 0x0, 0x8, 0x0, 0x0, 0x4, 0xa, 0xc0, 0x3e, 0x20, 0x32, 0x79, 0x5, 0x21, 
+0x6c, 0x5, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x3, 0xf0, 0x35, 0x1, 0x0, 
+0x0, 0xed, 0x5f, 0xcb, 0x47, 0xc2, 0x9e, 0x5, 0xcb, 0x4f, 0xc2, 0x9f, 0x5, 0x4, 0x4, 0x4, 
+0x4, 0xc, 0xc5, 0x21, 0x72, 0x5, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x3, 
+0xf0, 0x35, 0xed, 0x5f, 0xcb, 0xbf, 0xcb, 0xb7, 0xcb, 0xaf, 0xcb, 0xa7, 0x87, 0xfe, 0x1a, 0xda, 
+0xc4, 0x5, 0x3e, 0x1a, 0xc6, 0x6, 0x32, 0x78, 0x5, 0x2a, 0x78, 0x5, 0x6, 0x3, 0xc5, 0x11, 
+0xa0, 0x2a, 0x1, 0x58, 0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x3e, 0x10, 0x84, 0x67, 0xc1, 0x10, 
+0xed, 0xc1, 0x10, 0xbe, 0x3a, 0x79, 0x5, 0xc6, 0x20, 0xfe, 0xe0, 0xc2, 0x7c, 0x5, 0x2a, 0x0, 
+0x0, 0x11, 0x70, 0x3, 0x1, 0x90, 0x3, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x2a, 0x7, 0x0, 0x11, 
+0x98, 0x3, 0x1, 0xb8, 0x3, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x2a, 0x9, 0x0, 0x11, 0xc0, 0x3, 
+0x1, 0xe0, 0x3, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x2a, 0xb, 0x0, 0x11, 0xe8, 0x3, 0x1, 0x8, 
+0x4, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x2a, 0x0, 0x0, 0xed, 0x5b, 0x5, 0x0, 0xed, 0x4b, 0x2, 
+0x0, 0x97, 0xcd, 0xb, 0x2, 0x2a, 0x7, 0x0, 0x11, 0x0, 0x2a, 0x1, 0x50, 0x2b, 0x97, 0xcd, 
+0xb, 0x2, 0x2a, 0x9, 0x0, 0xcd, 0xb, 0x2, 0x2a, 0xb, 0x0, 0xcd, 0xb, 0x2, 0x21, 0x7a, 
+0x4, 0x11, 0x0, 0x3, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 
+0xb0, 0xcd, 0x8, 0x3, 0x3e, 0x20, 0x32, 0xa3, 0xb7, 0x21, 0xb, 0x1f, 0x22, 0xa0, 0xb7, 0x3a, 
+0x16, 0x0, 0xcd, 0x3, 0xf0, 0x1c, 0x21, 0x16, 0x1f, 0x22, 0xa0, 0xb7, 0x2a, 0x24, 0x0, 0xcd, 
+0x3, 0xf0, 0x1a, 0x21, 0x23, 0x1f, 0x22, 0xa0, 0xb7, 0x2a, 0x80, 0x2b, 0xcd, 0x3, 0xf0, 0x1a, 
+0x3a, 0x1f, 0x0, 0xcd, 0x3, 0xf0, 0x14, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0xca, 0x2e, 0xc, 0xf5, 
+0x2a, 0x0, 0x0, 0x11, 0x70, 0x3, 0x1, 0x90, 0x3, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x3a, 0x4, 
+0x0, 0xc6, 0x40, 0x32, 0x4, 0x0, 0xf1, 0x21, 0x1b, 0x0, 0xbe, 0xca, 0x2f, 0x7, 0x21, 0x1a, 
+0x0, 0xbe, 0xca, 0x74, 0x7, 0x21, 0x1c, 0x0, 0xbe, 0xca, 0xb9, 0x7, 0x21, 0x1d, 0x0, 0xbe, 
+0xca, 0xfd, 0x7, 0x21, 0x1e, 0x0, 0xbe, 0xca, 0x41, 0x9, 0x2a, 0x0, 0x0, 0x11, 0x70, 0x3, 
+0x1, 0x98, 0x3, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x2a, 0x0, 0x0, 0x3e, 0xe0, 0xbc, 0xc2, 0xf7, 
+0x6, 0x3e, 0x2, 0xbd, 0xca, 0x7e, 0x8, 0x2a, 0x0, 0x0, 0x3e, 0x20, 0xbc, 0xc2, 0x6, 0x7, 
+0x3e, 0x2, 0xbd, 0xca, 0x41, 0x8, 0x2a, 0x0, 0x0, 0xed, 0x5b, 0x5, 0x0, 0xed, 0x4b, 0x2, 
+0x0, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x21, 0x85, 0x4, 0x11, 0x0, 0x3, 0x1, 0x5, 0x0, 0xed, 
+0xb0, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 0xc3, 0x34, 0xc, 0x2a, 
+0x0, 0x0, 0x2d, 0x2d, 0xcd, 0x3, 0xf0, 0x34, 0x1a, 0xfe, 0x16, 0xca, 0x5a, 0x7, 0xfe, 0x7, 
+0xca, 0x5a, 0x7, 0x2a, 0x0, 0x0, 0x2d, 0x2d, 0x22, 0x0, 0x0, 0xcd, 0x3, 0xf0, 0x34, 0x1a, 
+0xfe, 0x77, 0xca, 0xcc, 0xb, 0x3e, 0xfa, 0x32, 0x86, 0x4, 0x3a, 0x4, 0x0, 0xfe, 0x80, 0xda, 
+0x6b, 0x7, 0x21, 0x40, 0x29, 0x22, 0x5, 0x0, 0xc3, 0xda, 0x6, 0x21, 0x60, 0x29, 0x22, 0x5, 
+0x0, 0xc3, 0xda, 0x6, 0x2a, 0x0, 0x0, 0x2c, 0x2c, 0xcd, 0x3, 0xf0, 0x34, 0x1a, 0xfe, 0x16, 
+0xca, 0x9f, 0x7, 0xfe, 0x7, 0xca, 0x9f, 0x7, 0x2a, 0x0, 0x0, 0x2c, 0x2c, 0x22, 0x0, 0x0, 
+0xcd, 0x3, 0xf0, 0x34, 0x1a, 0xfe, 0x77, 0xca, 0xcc, 0xb, 0x3e, 0xfa, 0x32, 0x86, 0x4, 0x3a, 
+0x4, 0x0, 0xfe, 0x80, 0xda, 0xb0, 0x7, 0x21, 0x0, 0x29, 0x22, 0x5, 0x0, 0xc3, 0xda, 0x6, 
+0x21, 0x20, 0x29, 0x22, 0x5, 0x0, 0xc3, 0xda, 0x6, 0x2a, 0x0, 0x0, 0x3e, 0x10, 0x84, 0x67, 
+0xcd, 0x3, 0xf0, 0x34, 0x1a, 0xfe, 0x57, 0xc2, 0xe3, 0x7, 0x2a, 0x0, 0x0, 0x3e, 0x10, 0x84, 
+0x67, 0x22, 0x0, 0x0, 0xcd, 0x3, 0xf0, 0x34, 0x1a, 0xfe, 0x77, 0xca, 0xcc, 0xb, 0x3e, 0x6, 
+0x32, 0x86, 0x4, 0x3a, 0x4, 0x0, 0xfe, 0x80, 0xda, 0xf4, 0x7, 0x21, 0xc0, 0x29, 0x22, 0x5, 
+0x0, 0xc3, 0xda, 0x6, 0x21, 0xe0, 0x29, 0x22, 0x5, 0x0, 0xc3, 0xda, 0x6, 0x2a, 0x0, 0x0, 
+0x3e, 0xf0, 0x84, 0x67, 0xcd, 0x3, 0xf0, 0x34, 0x1a, 0xfe, 0x57, 0xc2, 0x27, 0x8, 0x2a, 0x0, 
+0x0, 0x3e, 0xf0, 0x84, 0x67, 0x22, 0x0, 0x0, 0xcd, 0x3, 0xf0, 0x34, 0x1a, 0xfe, 0x77, 0xca, 
+0xcc, 0xb, 0x3e, 0x6, 0x32, 0x86, 0x4, 0x3a, 0x4, 0x0, 0xfe, 0x80, 0xda, 0x38, 0x8, 0x21, 
+0x80, 0x29, 0x22, 0x5, 0x0, 0xc3, 0xda, 0x6, 0x21, 0xa0, 0x29, 0x22, 0x5, 0x0, 0xc3, 0xda, 
+0x6, 0x2a, 0x0, 0x0, 0x11, 0x70, 0x3, 0x1, 0x90, 0x3, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x1, 
+0x48, 0x2b, 0xed, 0x43, 0x2, 0x0, 0x11, 0x0, 0x29, 0xed, 0x53, 0x5, 0x0, 0x2a, 0x0, 0x0, 
+0x3e, 0x0, 0xcd, 0xb, 0x2, 0x21, 0x90, 0x4, 0x11, 0x0, 0x3, 0x1, 0x5, 0x0, 0xed, 0xb0, 
+0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 0xc3, 0x90, 0x6, 0x2a, 0x0, 
+0x0, 0x11, 0x70, 0x3, 0x1, 0x90, 0x3, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x3a, 0x2, 0x0, 0xfe, 
+0x40, 0xca, 0xf7, 0x6, 0x2a, 0x24, 0x0, 0x3a, 0x51, 0x0, 0xed, 0x44, 0xc6, 0xa, 0x57, 0xe, 
+0x10, 0xe5, 0xcd, 0x3, 0xf0, 0x41, 0xe1, 0x85, 0x27, 0x6f, 0xd2, 0xb5, 0x8, 0x3e, 0x1, 0x84, 
+0x27, 0x67, 0xda, 0x30, 0xe, 0x22, 0x24, 0x0, 0x2a, 0x26, 0x0, 0x22, 0xa0, 0xb7, 0x3a, 0x28, 
+0x0, 0x32, 0xa3, 0xb7, 0x3e, 0x5b, 0xcd, 0x3, 0xf0, 0x0, 0x3e, 0x5b, 0xcd, 0x3, 0xf0, 0x0, 
+0x3a, 0x26, 0x0, 0xfe, 0x26, 0xc2, 0xf8, 0x8, 0x3a, 0x28, 0x0, 0xd6, 0x8, 0x32, 0x28, 0x0, 
+0xfe, 0x40, 0xc2, 0xf6, 0x8, 0x3a, 0x25, 0x0, 0xc6, 0x5, 0x27, 0xda, 0x30, 0xe, 0x32, 0x25, 
+0x0, 0x3e, 0x70, 0x32, 0x28, 0x0, 0x3e, 0xfe, 0x3c, 0x3c, 0x32, 0x26, 0x0, 0x1, 0x40, 0x2b, 
+0xed, 0x43, 0x2, 0x0, 0x11, 0x0, 0x29, 0xed, 0x53, 0x5, 0x0, 0x2a, 0x0, 0x0, 0x3e, 0x0, 
+0xcd, 0xb, 0x2, 0x21, 0x90, 0x4, 0x11, 0x0, 0x3, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x11, 0x82, 
+0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 0x3e, 0x20, 0x32, 0xa3, 0xb7, 0x21, 0x16, 
+0x1f, 0x22, 0xa0, 0xb7, 0x2a, 0x24, 0x0, 0xcd, 0x3, 0xf0, 0x1a, 0xc3, 0x90, 0x6, 0x2, 0x1e, 
+0x20, 0x21, 0x0, 0x0, 0x3e, 0x2, 0xbe, 0xc2, 0x51, 0x9, 0x23, 0x3e, 0x20, 0xbe, 0xca, 0xf7, 
+0x6, 0x3a, 0x2, 0x0, 0xfe, 0x40, 0xca, 0xf7, 0x6, 0x3a, 0x5, 0x0, 0xfe, 0x0, 0xca, 0x73, 
+0x9, 0xfe, 0x20, 0xca, 0x73, 0x9, 0xfe, 0x40, 0xca, 0x7b, 0x9, 0xfe, 0x60, 0xca, 0x7b, 0x9, 
+0xc3, 0xf7, 0x6, 0x3e, 0x2, 0x32, 0x3e, 0x9, 0xc3, 0x80, 0x9, 0x3e, 0xfe, 0x32, 0x3e, 0x9, 
+0x1, 0x40, 0x2b, 0xed, 0x43, 0x2, 0x0, 0x2a, 0x0, 0x0, 0xed, 0x5b, 0x5, 0x0, 0x3e, 0x0, 
+0xcd, 0xb, 0x2, 0x2a, 0x0, 0x0, 0x22, 0x3f, 0x9, 0x11, 0x10, 0x4, 0x1, 0x30, 0x4, 0x3e, 
+0x1, 0xcd, 0xb, 0x2, 0x2a, 0x3f, 0x9, 0x11, 0x10, 0x4, 0x1, 0x30, 0x4, 0x3e, 0x0, 0xcd, 
+0xb, 0x2, 0x2a, 0x3f, 0x9, 0x3a, 0x3e, 0x9, 0x85, 0x6f, 0x22, 0x3f, 0x9, 0xcd, 0x3, 0xf0, 
+0x34, 0x1a, 0xfe, 0x7, 0xca, 0x1b, 0xa, 0xfe, 0x16, 0xca, 0x1b, 0xa, 0xfe, 0x77, 0xca, 0x34, 
+0xa, 0x2a, 0x3f, 0x9, 0x11, 0x10, 0x4, 0x1, 0x30, 0x4, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x2a, 
+0x3f, 0x9, 0x11, 0xc0, 0x2a, 0x1, 0x60, 0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0xcd, 0x4, 0xa, 
+0x2a, 0x3f, 0x9, 0x11, 0xe0, 0x2a, 0x1, 0x68, 0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0xcd, 0x4, 
+0xa, 0xc3, 0xa4, 0x9, 0x21, 0x9b, 0x4, 0x11, 0x0, 0x3, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x11, 
+0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 0xc9, 0x21, 0xa6, 0x4, 0x11, 0x0, 
+0x3, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 
+0x3, 0xc3, 0xf7, 0x6, 0xcd, 0x3d, 0xb, 0x2a, 0x3f, 0x9, 0x11, 0x40, 0x2a, 0x1, 0x50, 0x2b, 
+0x3e, 0x0, 0xcd, 0xb, 0x2, 0xcd, 0x3d, 0xb, 0x2a, 0x3f, 0x9, 0x11, 0x60, 0x2a, 0x1, 0x50, 
+0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0xcd, 0x3d, 0xb, 0x2a, 0x3f, 0x9, 0x11, 0x80, 0x2a, 0x1, 
+0x50, 0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x3e, 0x58, 0xcd, 0x3, 0xf0, 0x14, 0x2a, 0x0, 0x0, 
+0x11, 0x70, 0x3, 0x1, 0x90, 0x3, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x21, 0x3f, 0x9, 0x3a, 0x7, 
+0x0, 0xbe, 0xc2, 0xbd, 0xa, 0x23, 0x3a, 0x8, 0x0, 0xbe, 0xc2, 0xbd, 0xa, 0x21, 0x22, 0x40, 
+0x22, 0x7, 0x0, 0x3e, 0x20, 0x32, 0x13, 0x0, 0x2a, 0x3f, 0x9, 0x11, 0x98, 0x3, 0x1, 0xb8, 
+0x3, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x21, 0x98, 0x3, 0x11, 0x99, 0x3, 0x1, 0x20, 0x0, 0x36, 
+0x0, 0xed, 0xb0, 0x1, 0x7, 0x0, 0x36, 0x4f, 0xed, 0xb0, 0xc3, 0x2a, 0xb, 0x21, 0x3f, 0x9, 
+0x3a, 0x9, 0x0, 0xbe, 0xc2, 0xff, 0xa, 0x23, 0x3a, 0xa, 0x0, 0xbe, 0xc2, 0xff, 0xa, 0x21, 
+0x22, 0x60, 0x22, 0x9, 0x0, 0x3e, 0x20, 0x32, 0x14, 0x0, 0x2a, 0x3f, 0x9, 0x11, 0xc0, 0x3, 
+0x1, 0xe0, 0x3, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x21, 0xc0, 0x3, 0x11, 0xc1, 0x3, 0x1, 0x20, 
+0x0, 0x36, 0x0, 0xed, 0xb0, 0x1, 0x7, 0x0, 0x36, 0x4f, 0xed, 0xb0, 0xc3, 0x2a, 0xb, 0x21, 
+0x22, 0x80, 0x22, 0xb, 0x0, 0x3e, 0x20, 0x32, 0x15, 0x0, 0x2a, 0x3f, 0x9, 0x11, 0xe8, 0x3, 
+0x1, 0x8, 0x4, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x21, 0xe8, 0x3, 0x11, 0xe9, 0x3, 0x1, 0x20, 
+0x0, 0x36, 0x0, 0xed, 0xb0, 0x1, 0x7, 0x0, 0x36, 0x4f, 0x2a, 0x0, 0x0, 0xed, 0x5b, 0x5, 
+0x0, 0xed, 0x4b, 0x2, 0x0, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0xc3, 0xf7, 0x6, 0x21, 0xb1, 0x4, 
+0x11, 0x0, 0x3, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 
+0xcd, 0x8, 0x3, 0xc9, 0x0, 0x3e, 0x5, 0x32, 0x54, 0xb, 0xcd, 0xad, 0xb, 0x2a, 0x0, 0x0, 
+0x11, 0x0, 0x2b, 0x1, 0x70, 0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0xcd, 0xad, 0xb, 0x1, 0x78, 
+0x2b, 0xcd, 0xb, 0x2, 0xcd, 0xad, 0xb, 0x11, 0x20, 0x2b, 0xcd, 0xb, 0x2, 0xcd, 0xad, 0xb, 
+0x11, 0x0, 0x2b, 0xcd, 0xb, 0x2, 0x3a, 0x54, 0xb, 0x3d, 0x32, 0x54, 0xb, 0xc2, 0x5a, 0xb, 
+0x21, 0xc7, 0x4, 0x11, 0x0, 0x3, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x11, 0x82, 0xb7, 0x1, 0x6, 
+0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 0x3e, 0x80, 0xcd, 0x3, 0xf0, 0x14, 0xc9, 0xf5, 0xc5, 0xd5, 
+0xe5, 0x21, 0xbc, 0x4, 0x11, 0x0, 0x3, 0x1, 0x5, 0x0, 0xed, 0xb0, 0x11, 0x82, 0xb7, 0x1, 
+0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xcd, 0x55, 0xb, 0x2a, 
+0x7, 0x0, 0x11, 0x98, 0x3, 0x1, 0xb8, 0x3, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x2a, 0x9, 0x0, 
+0x11, 0xc0, 0x3, 0x1, 0xe0, 0x3, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x2a, 0xb, 0x0, 0x11, 0xe8, 
+0x3, 0x1, 0x8, 0x4, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x21, 0x4, 0xe0, 0x22, 0x0, 0x0, 0x21, 
+0x22, 0x40, 0x22, 0x7, 0x0, 0x21, 0x22, 0x60, 0x22, 0x9, 0x0, 0x21, 0x22, 0x80, 0x22, 0xb, 
+0x0, 0x21, 0x40, 0x2b, 0x22, 0x2, 0x0, 0x21, 0x0, 0x29, 0x22, 0x5, 0x0, 0x3a, 0x16, 0x0, 
+0xd6, 0x0, 0x27, 0x32, 0x16, 0x0, 0xfe, 0x0, 0xca, 0x30, 0xe, 0xc3, 0xee, 0x5, 0x3e, 0x6, 
+0xcd, 0x3, 0xf0, 0x14, 0x3a, 0x19, 0x0, 0x3c, 0x32, 0x19, 0x0, 0xfe, 0x1, 0xca, 0x52, 0xc, 
+0xfe, 0x2, 0xca, 0x79, 0xc, 0xfe, 0x3, 0xca, 0xa0, 0xc, 0x3e, 0x0, 0x32, 0x19, 0x0, 0xc3, 
+0x90, 0x6, 0x2a, 0x7, 0x0, 0x22, 0x30, 0x0, 0x2a, 0xd, 0x0, 0x22, 0x32, 0x0, 0x3a, 0x13, 
+0x0, 0x32, 0x34, 0x0, 0x3a, 0x20, 0x0, 0x32, 0x39, 0x0, 0x21, 0x98, 0x3, 0x22, 0x35, 0x0, 
+0x21, 0xb8, 0x3, 0x22, 0x37, 0x0, 0xc3, 0xc7, 0xc, 0x2a, 0x9, 0x0, 0x22, 0x30, 0x0, 0x2a, 
+0xf, 0x0, 0x22, 0x32, 0x0, 0x3a, 0x14, 0x0, 0x32, 0x34, 0x0, 0x3a, 0x21, 0x0, 0x32, 0x39, 
+0x0, 0x21, 0xc0, 0x3, 0x22, 0x35, 0x0, 0x21, 0xe0, 0x3, 0x22, 0x37, 0x0, 0xc3, 0xc7, 0xc, 
+0x2a, 0xb, 0x0, 0x22, 0x30, 0x0, 0x2a, 0x11, 0x0, 0x22, 0x32, 0x0, 0x3a, 0x15, 0x0, 0x32, 
+0x34, 0x0, 0x3a, 0x22, 0x0, 0x32, 0x39, 0x0, 0x21, 0xe8, 0x3, 0x22, 0x35, 0x0, 0x21, 0x8, 
+0x4, 0x22, 0x37, 0x0, 0xc3, 0xc7, 0xc, 0x3a, 0x34, 0x0, 0xfe, 0x0, 0xca, 0xd6, 0xc, 0x3d, 
+0x32, 0x34, 0x0, 0xc3, 0x42, 0xd, 0x2a, 0x30, 0x0, 0xed, 0x5b, 0x35, 0x0, 0xed, 0x4b, 0x37, 
+0x0, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x2a, 0x30, 0x0, 0x3a, 0x32, 0x0, 0x85, 0x6f, 0x3a, 0x33, 
+0x0, 0x84, 0x67, 0xe5, 0xcd, 0x3, 0xf0, 0x34, 0x1a, 0xfe, 0x16, 0xca, 0xc2, 0xd, 0xfe, 0x7, 
+0xca, 0xd6, 0xd, 0xfe, 0x57, 0xca, 0xf3, 0xd, 0xfe, 0x77, 0xca, 0xc2, 0xd, 0xfe, 0x67, 0xca, 
+0x1b, 0xe, 0xe1, 0x22, 0x30, 0x0, 0x2a, 0x30, 0x0, 0xed, 0x5b, 0x35, 0x0, 0xed, 0x4b, 0x37, 
+0x0, 0x3e, 0x1, 0xcd, 0xb, 0x2, 0x3a, 0x39, 0x0, 0xc6, 0x40, 0x32, 0x39, 0x0, 0xfe, 0x0, 
+0xcc, 0xa0, 0xd, 0xfe, 0x40, 0xcc, 0xa0, 0xd, 0xfe, 0x80, 0xcc, 0xb1, 0xd, 0xfe, 0xc0, 0xcc, 
+0xb1, 0xd, 0x3a, 0x19, 0x0, 0xfe, 0x1, 0xca, 0x85, 0xd, 0xfe, 0x2, 0xca, 0x6a, 0xd, 0x2a, 
+0x30, 0x0, 0x22, 0xb, 0x0, 0x2a, 0x32, 0x0, 0x22, 0x11, 0x0, 0x3a, 0x34, 0x0, 0x32, 0x15, 
+0x0, 0x3a, 0x39, 0x0, 0x32, 0x22, 0x0, 0xc3, 0x34, 0xc, 0x2a, 0x30, 0x0, 0x22, 0x9, 0x0, 
+0x2a, 0x32, 0x0, 0x22, 0xf, 0x0, 0x3a, 0x34, 0x0, 0x32, 0x14, 0x0, 0x3a, 0x39, 0x0, 0x32, 
+0x21, 0x0, 0xc3, 0x34, 0xc, 0x2a, 0x30, 0x0, 0x22, 0x7, 0x0, 0x2a, 0x32, 0x0, 0x22, 0xd, 
+0x0, 0x3a, 0x34, 0x0, 0x32, 0x13, 0x0, 0x3a, 0x39, 0x0, 0x32, 0x20, 0x0, 0xc3, 0x34, 0xc, 
+0xf5, 0x2a, 0x30, 0x0, 0x11, 0x0, 0x2a, 0x1, 0x50, 0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0xf1, 
+0xc9, 0xf5, 0x2a, 0x30, 0x0, 0x11, 0x20, 0x2a, 0x1, 0x50, 0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 
+0xf1, 0xc9, 0xe1, 0x3a, 0x32, 0x0, 0xed, 0x44, 0x32, 0x32, 0x0, 0x3a, 0x33, 0x0, 0xed, 0x44, 
+0x32, 0x33, 0x0, 0xc3, 0x16, 0xd, 0xe1, 0x3e, 0x0, 0x32, 0x33, 0x0, 0xed, 0x5f, 0xfe, 0x38, 
+0xda, 0xeb, 0xd, 0x3e, 0xfe, 0x32, 0x32, 0x0, 0xc3, 0x16, 0xd, 0x3e, 0x2, 0x32, 0x32, 0x0, 
+0xc3, 0x16, 0xd, 0x3a, 0x1, 0x0, 0xed, 0x4b, 0x30, 0x0, 0xb8, 0xca, 0x12, 0xd, 0xda, 0xe, 
+0xe, 0x3e, 0x10, 0x32, 0x33, 0x0, 0x3e, 0x0, 0x32, 0x32, 0x0, 0xc3, 0x12, 0xd, 0x3e, 0xf0, 
+0x32, 0x33, 0x0, 0x3e, 0x0, 0x32, 0x32, 0x0, 0xc3, 0x12, 0xd, 0xe1, 0xcd, 0x55, 0xb, 0x2a, 
+0x0, 0x0, 0x11, 0x70, 0x3, 0x1, 0x90, 0x3, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0xc3, 0xcf, 0xb, 
+0x2a, 0x80, 0x2b, 0xed, 0x5b, 0x24, 0x0, 0xed, 0x52, 0xda, 0x73, 0xe, 0xca, 0x73, 0xe, 0x2a, 
+0x90, 0x2b, 0xed, 0x52, 0xda, 0x97, 0xe, 0xca, 0x97, 0xe, 0x2a, 0xa0, 0x2b, 0xed, 0x52, 0xda, 
+0xbb, 0xe, 0xca, 0xbb, 0xe, 0x2a, 0xb0, 0x2b, 0xed, 0x52, 0xda, 0xdf, 0xe, 0xca, 0xdf, 0xe, 
+0x2a, 0xc0, 0x2b, 0xed, 0x52, 0xda, 0x3, 0xf, 0xca, 0x3, 0xf, 0x3e, 0x0, 0x32, 0x2a, 0x0, 
+0xc3, 0x24, 0xf, 0x21, 0xc0, 0x2b, 0x11, 0xd0, 0x2b, 0x1, 0x50, 0x0, 0xed, 0xb8, 0x2a, 0x24, 
+0x0, 0x22, 0x80, 0x2b, 0x21, 0x40, 0x0, 0x11, 0x82, 0x2b, 0x1, 0xb, 0x0, 0xed, 0xb0, 0x3e, 
+0x1, 0x32, 0x2a, 0x0, 0xc3, 0x24, 0xf, 0x21, 0xc0, 0x2b, 0x11, 0xd0, 0x2b, 0x1, 0x40, 0x0, 
+0xed, 0xb8, 0x2a, 0x24, 0x0, 0x22, 0x90, 0x2b, 0x21, 0x40, 0x0, 0x11, 0x92, 0x2b, 0x1, 0xb, 
+0x0, 0xed, 0xb0, 0x3e, 0x2, 0x32, 0x2a, 0x0, 0xc3, 0x24, 0xf, 0x21, 0xc0, 0x2b, 0x11, 0xd0, 
+0x2b, 0x1, 0x30, 0x0, 0xed, 0xb8, 0x2a, 0x24, 0x0, 0x22, 0xa0, 0x2b, 0x21, 0x40, 0x0, 0x11, 
+0xa2, 0x2b, 0x1, 0xb, 0x0, 0xed, 0xb0, 0x3e, 0x3, 0x32, 0x2a, 0x0, 0xc3, 0x24, 0xf, 0x21, 
+0xc0, 0x2b, 0x11, 0xd0, 0x2b, 0x1, 0x20, 0x0, 0xed, 0xb8, 0x2a, 0x24, 0x0, 0x22, 0xb0, 0x2b, 
+0x21, 0x40, 0x0, 0x11, 0xb2, 0x2b, 0x1, 0xb, 0x0, 0xed, 0xb0, 0x3e, 0x4, 0x32, 0x2a, 0x0, 
+0xc3, 0x24, 0xf, 0x21, 0xc0, 0x2b, 0x11, 0xd0, 0x2b, 0x1, 0x10, 0x0, 0xed, 0xb8, 0x2a, 0x24, 
+0x0, 0x22, 0xc0, 0x2b, 0x21, 0x40, 0x0, 0x11, 0xc2, 0x2b, 0x1, 0xb, 0x0, 0xed, 0xb0, 0x3e, 
+0x5, 0x32, 0x2a, 0x0, 0x21, 0xb, 0x10, 0x22, 0xa0, 0xb7, 0x3e, 0x77, 0x32, 0xa3, 0xb7, 0x21, 
+0xd2, 0x4, 0xcd, 0x10, 0x11, 0x3e, 0xff, 0xcd, 0x3, 0xf0, 0x14, 0x21, 0x0, 0xa8, 0x11, 0x1, 
+0xa8, 0x1, 0x0, 0xf, 0x36, 0x0, 0xed, 0xb0, 0x21, 0x0, 0x80, 0x11, 0x1, 0x80, 0x1, 0x0, 
+0x28, 0x36, 0x0, 0xed, 0xb0, 0x21, 0x7, 0x2, 0x22, 0xa0, 0xb7, 0x3e, 0x28, 0x32, 0xa3, 0xb7, 
+0x21, 0xdc, 0x4, 0xcd, 0x10, 0x11, 0x21, 0x0, 0x0, 0x22, 0xa0, 0xb7, 0x3e, 0x0, 0x32, 0xa3, 
+0xb7, 0x2a, 0x80, 0x2b, 0xcd, 0x3, 0xf0, 0x1a, 0x3a, 0x2a, 0x0, 0xfe, 0x1, 0xca, 0x85, 0xf, 
+0x3e, 0x10, 0xc3, 0x87, 0xf, 0x3e, 0x90, 0x32, 0xa3, 0xb7, 0x21, 0x0, 0x8, 0x22, 0xa0, 0xb7, 
+0x21, 0xe9, 0x4, 0xcd, 0x10, 0x11, 0x21, 0x0, 0xb2, 0xcd, 0x10, 0x11, 0x3a, 0xa0, 0xb7, 0xc6, 
+0x2, 0x32, 0xa0, 0xb7, 0x21, 0x82, 0x2b, 0xcd, 0x10, 0x11, 0x21, 0x0, 0x0, 0x22, 0xa0, 0xb7, 
+0x3e, 0x0, 0x32, 0xa3, 0xb7, 0x2a, 0x90, 0x2b, 0xcd, 0x3, 0xf0, 0x1a, 0x3a, 0x2a, 0x0, 0xfe, 
+0x2, 0xca, 0xc9, 0xf, 0x3e, 0x30, 0xc3, 0xcb, 0xf, 0x3e, 0xb0, 0x32, 0xa3, 0xb7, 0x21, 0x0, 
+0xc, 0x22, 0xa0, 0xb7, 0x21, 0xef, 0x4, 0xcd, 0x10, 0x11, 0x21, 0x0, 0xb2, 0xcd, 0x10, 0x11, 
+0x3a, 0xa0, 0xb7, 0xc6, 0x2, 0x32, 0xa0, 0xb7, 0x21, 0x92, 0x2b, 0xcd, 0x10, 0x11, 0x21, 0x0, 
+0x0, 0x22, 0xa0, 0xb7, 0x3e, 0x0, 0x32, 0xa3, 0xb7, 0x2a, 0xa0, 0x2b, 0xcd, 0x3, 0xf0, 0x1a, 
+0x3a, 0x2a, 0x0, 0xfe, 0x3, 0xca, 0xd, 0x10, 0x3e, 0x30, 0xc3, 0xf, 0x10, 0x3e, 0xb0, 0x32, 
+0xa3, 0xb7, 0x21, 0x0, 0x10, 0x22, 0xa0, 0xb7, 0x21, 0xf5, 0x4, 0xcd, 0x10, 0x11, 0x21, 0x0, 
+0xb2, 0xcd, 0x10, 0x11, 0x3a, 0xa0, 0xb7, 0xc6, 0x2, 0x32, 0xa0, 0xb7, 0x21, 0xa2, 0x2b, 0xcd, 
+0x10, 0x11, 0x21, 0x0, 0x0, 0x22, 0xa0, 0xb7, 0x3e, 0x0, 0x32, 0xa3, 0xb7, 0x2a, 0xb0, 0x2b, 
+0xcd, 0x3, 0xf0, 0x1a, 0x3a, 0x2a, 0x0, 0xfe, 0x4, 0xca, 0x51, 0x10, 0x3e, 0x30, 0xc3, 0x53, 
+0x10, 0x3e, 0xb0, 0x32, 0xa3, 0xb7, 0x21, 0x0, 0x14, 0x22, 0xa0, 0xb7, 0x21, 0xfb, 0x4, 0xcd, 
+0x10, 0x11, 0x21, 0x0, 0xb2, 0xcd, 0x10, 0x11, 0x3a, 0xa0, 0xb7, 0xc6, 0x2, 0x32, 0xa0, 0xb7, 
+0x21, 0xb2, 0x2b, 0xcd, 0x10, 0x11, 0x21, 0x0, 0x0, 0x22, 0xa0, 0xb7, 0x3e, 0x0, 0x32, 0xa3, 
+0xb7, 0x2a, 0xc0, 0x2b, 0xcd, 0x3, 0xf0, 0x1a, 0x3a, 0x2a, 0x0, 0xfe, 0x5, 0xca, 0x95, 0x10, 
+0x3e, 0x30, 0xc3, 0x97, 0x10, 0x3e, 0xb0, 0x32, 0xa3, 0xb7, 0x21, 0x0, 0x18, 0x22, 0xa0, 0xb7, 
+0x21, 0x1, 0x5, 0xcd, 0x10, 0x11, 0x21, 0x0, 0xb2, 0xcd, 0x10, 0x11, 0x3a, 0xa0, 0xb7, 0xc6, 
+0x2, 0x32, 0xa0, 0xb7, 0x21, 0xc2, 0x2b, 0xcd, 0x10, 0x11, 0x3a, 0x2a, 0x0, 0xfe, 0x1, 0xc2, 
+0xd3, 0x10, 0x21, 0x6, 0x1c, 0x22, 0xa0, 0xb7, 0x3e, 0x58, 0x32, 0xa3, 0xb7, 0x21, 0x7, 0x5, 
+0xcd, 0x10, 0x11, 0x21, 0x26, 0x1e, 0x22, 0xa0, 0xb7, 0x3e, 0x70, 0x32, 0xa3, 0xb7, 0x3e, 0x8d, 
+0xcd, 0x3, 0xf0, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0xd, 0xc2, 0xe4, 0x10, 0xe1, 0x21, 0x4c, 0x15, 
+0xe5, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x7e, 0xfe, 0x0, 0xc8, 0xe5, 0xcd, 0x4a, 0x11, 0xe1, 0x23, 0xc3, 0x10, 0x11, 0x4e, 0x78, 0xef, 
+0x14, 0xa0, 0x0, 0x3f, 0x3c, 0x3c, 0x0, 0x3f, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x0, 0x3c, 0x3c, 
+0x3c, 0x0, 0x0, 0xf, 0x3f, 0xf, 0x0, 0xf, 0x3f, 0xf, 0xf, 0xcf, 0xf, 0x0, 0xf, 0xcf, 
+0xf, 0x0, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x32, 0x1d, 0x11, 0x21, 0x22, 0x11, 
+0x11, 0x23, 0x11, 0x1, 0x20, 0x0, 0x36, 0x0, 0xed, 0xb0, 0x21, 0x42, 0x11, 0x11, 0x43, 0x11, 
+0x1, 0x7, 0x0, 0x3a, 0xa3, 0xb7, 0x77, 0xed, 0xb0, 0x3a, 0x1d, 0x11, 0xfe, 0x20, 0xda, 0xb5, 
+0x11, 0xfe, 0x60, 0xda, 0x91, 0x11, 0xfe, 0x80, 0xda, 0x99, 0x11, 0xfe, 0xa0, 0xda, 0xa5, 0x11, 
+0xfe, 0xe0, 0xda, 0xad, 0x11, 0xd6, 0xe0, 0x2a, 0xac, 0xb7, 0x11, 0x0, 0x1, 0x19, 0xc3, 0xba, 
+0x11, 0xd6, 0x20, 0x2a, 0xa6, 0xb7, 0xc3, 0xba, 0x11, 0xd6, 0x60, 0x2a, 0xa8, 0xb7, 0x11, 0x0, 
+0x1, 0x19, 0xc3, 0xba, 0x11, 0xd6, 0x80, 0x2a, 0xac, 0xb7, 0xc3, 0xba, 0x11, 0xd6, 0xa0, 0x2a, 
+0xaa, 0xb7, 0xc3, 0xba, 0x11, 0xcd, 0x3, 0xf0, 0x0, 0xc9, 0xe5, 0x4f, 0x3e, 0x8, 0x57, 0xcd, 
+0x3, 0xf0, 0x41, 0x50, 0x5f, 0xe1, 0x19, 0x22, 0x1e, 0x11, 0x2a, 0xa0, 0xb7, 0x7d, 0x32, 0x20, 
+0x11, 0x54, 0x3e, 0x8, 0x4f, 0xcd, 0x3, 0xf0, 0x41, 0x32, 0x21, 0x11, 0x3e, 0x9, 0xcd, 0x3, 
+0xf0, 0x0, 0xcd, 0x3, 0xf0, 0x0, 0x21, 0x22, 0x11, 0xcd, 0x7, 0x12, 0x23, 0xcd, 0x7, 0x12, 
+0x23, 0xcd, 0x7, 0x12, 0x23, 0xcd, 0x7, 0x12, 0x2a, 0x20, 0x11, 0x11, 0x22, 0x11, 0x1, 0x42, 
+0x11, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0xc9, 0xe5, 0x11, 0x4, 0x0, 0xcd, 0x22, 0x12, 0xcd, 0x33, 
+0x12, 0x19, 0xcd, 0x33, 0x12, 0xcd, 0x22, 0x12, 0x19, 0xcd, 0x33, 0x12, 0x19, 0xcd, 0x33, 0x12, 
+0xe1, 0xc9, 0xc5, 0xd5, 0xe5, 0x2a, 0x1e, 0x11, 0x7e, 0x23, 0x22, 0x1e, 0x11, 0xe1, 0xd1, 0xc1, 
+0xc9, 0x31, 0x11, 0xf5, 0xc5, 0xd5, 0xe5, 0x22, 0x31, 0x12, 0xcb, 0x47, 0xc4, 0x67, 0x12, 0xcb, 
+0x4f, 0xc4, 0x6f, 0x12, 0xcb, 0x57, 0xc4, 0x77, 0x12, 0xcb, 0x5f, 0xc4, 0x7f, 0x12, 0xcb, 0x67, 
+0xc4, 0x87, 0x12, 0xcb, 0x6f, 0xc4, 0x8f, 0x12, 0xcb, 0x77, 0xc4, 0x97, 0x12, 0xcb, 0x7f, 0xc4, 
+0x9f, 0x12, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xf5, 0x3e, 0x3, 0xcd, 0xa7, 0x12, 0xf1, 0xc9, 0xf5, 
+0x3e, 0xc, 0xcd, 0xa7, 0x12, 0xf1, 0xc9, 0xf5, 0x3e, 0x30, 0xcd, 0xa7, 0x12, 0xf1, 0xc9, 0xf5, 
+0x3e, 0xc0, 0xcd, 0xa7, 0x12, 0xf1, 0xc9, 0xf5, 0x3e, 0x3, 0xcd, 0xb1, 0x12, 0xf1, 0xc9, 0xf5, 
+0x3e, 0xc, 0xcd, 0xb1, 0x12, 0xf1, 0xc9, 0xf5, 0x3e, 0x30, 0xcd, 0xb1, 0x12, 0xf1, 0xc9, 0xf5, 
+0x3e, 0xc0, 0xcd, 0xb1, 0x12, 0xf1, 0xc9, 0x2a, 0x31, 0x12, 0x11, 0x10, 0x0, 0x19, 0xb6, 0x77, 
+0xc9, 0x2a, 0x31, 0x12, 0xb6, 0x77, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x7e, 0xfe, 0x0, 0xc8, 0xcd, 0x3, 0xf0, 0x0, 0x23, 0xe5, 0x21, 0x7f, 0x13, 0x11, 0x0, 0x3, 
+0x1, 0x5, 0x0, 0xed, 0xb0, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 
+0xe1, 0xc3, 0x0, 0x13, 0xf5, 0xc5, 0xd5, 0xe5, 0x21, 0x8a, 0x13, 0x11, 0x0, 0x3, 0x1, 0x5, 
+0x0, 0xed, 0xb0, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 0xe1, 0xd1, 
+0xc1, 0xf1, 0xc9, 0x0, 0x0, 0x28, 0x7, 0x0, 0x0, 0x0, 0xf, 0x37, 0xf8, 0x2, 0x8, 0x10, 
+0xe, 0x0, 0x0, 0x0, 0x7, 0x7d, 0xf7, 0x15, 0x8, 0x11, 0x4, 0x0, 0x0, 0x0, 0x7, 0x37, 
+0xf8, 0x1a, 0xa, 0xa, 0x1, 0x0, 0x0, 0x0, 0x5, 0x37, 0xf8, 0x15, 0xe, 0x11, 0x8, 0x0, 
+0x0, 0x0, 0x30, 0x37, 0xf8, 0x0, 0x0, 0x28, 0x20, 0x0, 0x0, 0x0, 0x0, 0x37, 0xf8, 0xc6, 
+0xc, 0xff, 0x4, 0x8, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0xc, 0xff, 0x3, 0x30, 0x10, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0xc6, 0xff, 0xff, 0x6, 0x80, 0x80, 0x0, 0xb0, 0x0, 0x0, 0x0, 
+0x53, 0x4f, 0x57, 0x41, 0x43, 0x4f, 0x20, 0x50, 0x52, 0x45, 0x53, 0x45, 0x4e, 0x54, 0x53, 0x3a, 
+0x0, 0x61, 0x6e, 0x20, 0x41, 0x2e, 0x57, 0x45, 0x49, 0x53, 0x53, 0x46, 0x4c, 0x4f, 0x47, 0x2d, 
+0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0, 0x3e, 0x3e, 0x3e, 0x20, 0x41, 
+0x43, 0x54, 0x4f, 0x52, 0x53, 0x20, 0x3c, 0x3c, 0x3c, 0x0, 0x43, 0x52, 0x41, 0x57, 0x4c, 0x45, 
+0x52, 0x0, 0x54, 0x48, 0x52, 0x45, 0x45, 0x20, 0x4d, 0x4f, 0x4e, 0x53, 0x54, 0x45, 0x52, 0x53, 
+0x0, 0x49, 0x4e, 0x0, 0x7f, 0x7f, 0x48, 0x4f, 0x55, 0x53, 0x45, 0x1, 0x3e, 0xbb, 0xdd, 0x77, 
+0x9, 0x21, 0x0, 0xee, 0x22, 0xa6, 0xb7, 0x22, 0xaa, 0xb7, 0x21, 0x0, 0xfe, 0x22, 0xa8, 0xb7, 
+0x22, 0xac, 0xb7, 0x21, 0xd4, 0xf5, 0x22, 0xb0, 0xb7, 0x3e, 0x20, 0x32, 0x50, 0x0, 0x3e, 0x9, 
+0x32, 0x51, 0x0, 0x3e, 0x7, 0x21, 0x0, 0x0, 0x11, 0x28, 0x20, 0xcd, 0x3, 0xf0, 0x3c, 0x3e, 
+0x7, 0xcd, 0x3, 0xf0, 0x3d, 0x21, 0x0, 0xa8, 0x11, 0x1, 0xa8, 0x1, 0xff, 0x9, 0x36, 0x0, 
+0xed, 0xb0, 0x21, 0x0, 0x80, 0x11, 0x1, 0x80, 0x1, 0xff, 0x27, 0x36, 0x0, 0xed, 0xb0, 0x21, 
+0x0, 0xa8, 0x11, 0x1, 0xa8, 0x1, 0xff, 0x9, 0x36, 0x7, 0xed, 0xb0, 0x3e, 0x37, 0x32, 0xa3, 
+0xb7, 0x3e, 0x11, 0xcd, 0x3, 0xf0, 0x0, 0x21, 0x4, 0x2, 0x22, 0xa0, 0xb7, 0x21, 0xa0, 0x13, 
+0xcd, 0x10, 0x11, 0x3e, 0xff, 0xcd, 0x3, 0xf0, 0x14, 0x3e, 0xf, 0x32, 0xa3, 0xb7, 0x21, 0x8, 
+0x6, 0x22, 0xa0, 0xb7, 0x21, 0xb1, 0x13, 0xcd, 0x0, 0x13, 0x3e, 0xb0, 0xcd, 0x3, 0xf0, 0x14, 
+0x21, 0xd, 0x9, 0x22, 0xa0, 0xb7, 0x21, 0xcb, 0x13, 0xcd, 0x0, 0x13, 0x3e, 0x80, 0xcd, 0x3, 
+0xf0, 0x14, 0x21, 0x10, 0xd, 0x22, 0xa0, 0xb7, 0x21, 0xda, 0x13, 0xcd, 0x0, 0x13, 0x3e, 0x50, 
+0xcd, 0x3, 0xf0, 0x14, 0x21, 0x10, 0x11, 0x22, 0xa0, 0xb7, 0x21, 0xe2, 0x13, 0xcd, 0x0, 0x13, 
+0x3e, 0xff, 0xcd, 0x3, 0xf0, 0x14, 0x21, 0x7, 0x60, 0x11, 0xc0, 0x29, 0x1, 0x40, 0x2b, 0x3e, 
+0x0, 0xcd, 0xb, 0x2, 0xcd, 0x24, 0x13, 0x3e, 0x80, 0xcd, 0x3, 0xf0, 0x14, 0x21, 0x3, 0x80, 
+0x6, 0x3, 0xc5, 0x11, 0x0, 0x2a, 0x1, 0x50, 0x2b, 0x3e, 0x0, 0xcd, 0xb, 0x2, 0x23, 0x23, 
+0x23, 0x23, 0xcd, 0x24, 0x13, 0xc1, 0x10, 0xea, 0x3e, 0x37, 0x32, 0xa3, 0xb7, 0x21, 0x12, 0x14, 
+0x22, 0xa0, 0xb7, 0x21, 0xf1, 0x13, 0xcd, 0x10, 0x11, 0x21, 0x95, 0x13, 0x11, 0x0, 0x3, 0x1, 
+0x5, 0x0, 0xed, 0xb0, 0x11, 0x82, 0xb7, 0x1, 0x6, 0x0, 0xed, 0xb0, 0xcd, 0x8, 0x3, 0x21, 
+0xf0, 0x2c, 0x22, 0xaa, 0xb7, 0x21, 0x0, 0x17, 0x22, 0xa0, 0xb7, 0x21, 0x68, 0x2e, 0x11, 0x0, 
+0x2d, 0x1a, 0x32, 0xa3, 0xb7, 0x7e, 0xfe, 0x0, 0xca, 0x44, 0x15, 0xcd, 0x3, 0xf0, 0x0, 0x23, 
+0x13, 0xc3, 0x31, 0x15, 0xdd, 0x7e, 0xd, 0xfe, 0x0, 0xca, 0x44, 0x15, 0x21, 0x0, 0xa8, 0x11, 
+0x1, 0xa8, 0x1, 0xff, 0x9, 0x36, 0x0, 0xed, 0xb0, 0x21, 0x0, 0x80, 0x11, 0x1, 0x80, 0x1, 
+0xff, 0x27, 0x36, 0x0, 0xed, 0xb0, 0x21, 0x43, 0x13, 0x11, 0xa6, 0xb9, 0x1, 0x3c, 0x0, 0xed, 
+0xb0, 0x3e, 0x6, 0xcd, 0x3, 0xf0, 0x3d, 0x21, 0x0, 0x17, 0x22, 0xa0, 0xb7, 0x21, 0xf0, 0x2c, 
+0x22, 0xaa, 0xb7, 0x21, 0x68, 0x2e, 0x11, 0x0, 0x2d, 0x1a, 0x32, 0xa3, 0xb7, 0x7e, 0xfe, 0x0, 
+0xca, 0x9c, 0x15, 0xcd, 0x3, 0xf0, 0x0, 0x23, 0x13, 0xc3, 0x89, 0x15, 0x3e, 0x1, 0xf5, 0xcd, 
+0x3, 0xf0, 0x3d, 0x3e, 0xc, 0xcd, 0x3, 0xf0, 0x0, 0xf1, 0x3c, 0xfe, 0x4, 0xc2, 0x9e, 0x15, 
+0x3e, 0x5, 0xcd, 0x3, 0xf0, 0x3d, 0xcd, 0x3, 0xf0, 0x23, 0x10, 0x54, 0x52, 0x41, 0x49, 0x4e, 
+0x45, 0x52, 0x20, 0x49, 0x4e, 0x20, 0x27, 0x38, 0x38, 0xa, 0xd, 0x42, 0x59, 0x20, 0x54, 0x48, 
+0x45, 0x20, 0x42, 0x52, 0x41, 0x49, 0x4e, 0x26, 0x43, 0x4f, 0x2e, 0x20, 0xa, 0xa, 0xd, 0x41, 
+0x2e, 0x57, 0x65, 0x69, 0x73, 0x73, 0x66, 0x6c, 0x6f, 0x67, 0xa, 0xd, 0x4b, 0x61, 0x72, 0x6c, 
+0x73, 0x62, 0x61, 0x64, 0x65, 0x72, 0x20, 0x53, 0x74, 0x72, 0x2e, 0x31, 0x33, 0x45, 0x52, 0x4c, 
+0x41, 0xa, 0xd, 0x20, 0x39, 0x34, 0x33, 0x35, 0x0, 0x3e, 0x1, 0xcd, 0x3, 0xf0, 0x3d, 0xcd, 
+0x3, 0xf0, 0x23, 0x10, 0xa, 0x20, 0x53, 0x50, 0x45, 0x45, 0x44, 0x3a, 0xa, 0xa, 0xd, 0x20, 
+0x39, 0x2d, 0x31, 0xa, 0xd, 0x20, 0x39, 0x3d, 0x4d, 0x49, 0x4e, 0x49, 0x4d, 0x55, 0x4d, 0xa, 
+0xd, 0x20, 0x31, 0x3d, 0x4d, 0x41, 0x58, 0x49, 0x4d, 0x55, 0x4d, 0x0, 0x21, 0x8, 0x1, 0x22, 
+0xa0, 0xb7, 0x3a, 0x51, 0x0, 0xcd, 0x3, 0xf0, 0x1c, 0x21, 0xc, 0x1, 0x22, 0xa0, 0xb7, 0xcd, 
+0x3, 0xf0, 0x23, 0x52, 0x49, 0x47, 0x48, 0x54, 0x3a, 0x20, 0x3e, 0x20, 0x3c, 0xa, 0x8, 0x8, 
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x4c, 0x45, 0x46, 0x54, 0x20, 0x3a, 0x20, 0x3e, 
+0x20, 0x3c, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x44, 0x4f, 0x57, 
+0x4e, 0x20, 0x3a, 0x20, 0x3e, 0x20, 0x3c, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 
+0x8, 0x8, 0x55, 0x50, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x3e, 0x20, 0x3c, 0xa, 0x8, 0x8, 0x8, 
+0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x53, 0x48, 0x4f, 0x54, 0x20, 0x3a, 0x20, 0x3e, 0x20, 
+0x3c, 0x0, 0x21, 0xa2, 0xb7, 0xcb, 0xde, 0x21, 0x14, 0x1, 0x11, 0x6a, 0x4, 0x6, 0x5, 0x22, 
+0xa0, 0xb7, 0x1a, 0xcd, 0x3, 0xf0, 0x0, 0x24, 0x13, 0x10, 0xf4, 0x21, 0xa2, 0xb7, 0xcb, 0x9e, 
+0x21, 0x18, 0x1, 0x22, 0xa0, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x52, 0x45, 0x43, 0x4f, 0x52, 0x44, 
+0x3a, 0xa, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x0, 0x21, 0x82, 0x2b, 0xcd, 0x3, 0xf0, 
+0x45, 0x21, 0x1b, 0x4, 0x22, 0xa0, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x57, 0x49, 0x54, 0x48, 0xa, 
+0x8, 0x8, 0x8, 0x0, 0x2a, 0x80, 0x2b, 0xcd, 0x3, 0xf0, 0x1a, 0xcd, 0x3, 0xf0, 0x23, 0x50, 
+0x4f, 0x49, 0x4e, 0x54, 0x53, 0x0, 0x3e, 0x2, 0xcd, 0x3, 0xf0, 0x3d, 0xcd, 0x3, 0xf0, 0x23, 
+0xa, 0x20, 0x20, 0x3e, 0x3e, 0x3e, 0x20, 0x4d, 0x45, 0x4e, 0x55, 0x20, 0x3c, 0x3c, 0x3c, 0xa, 
+0xa, 0xd, 0x0, 0xcd, 0x3, 0xf0, 0x46, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x3, 
+0xcd, 0x3, 0xf0, 0x3d, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0xa, 0x20, 0x59, 0x4f, 0x55, 0x52, 0x20, 
+0x4e, 0x41, 0x4d, 0x45, 0x3a, 0x0, 0x3e, 0x4, 0xcd, 0x3, 0xf0, 0x3d, 0x3e, 0xc, 0xcd, 0x3, 
+0xf0, 0x0, 0xcd, 0x3, 0xf0, 0x4, 0xfe, 0xd, 0xca, 0x72, 0x17, 0xcd, 0x3, 0xf0, 0x0, 0xc3, 
+0x62, 0x17, 0x21, 0xaa, 0xb3, 0x11, 0x40, 0x0, 0x1, 0xb, 0x0, 0xed, 0xb0, 0x21, 0x0, 0xa8, 
+0x11, 0x1, 0xa8, 0x1, 0xff, 0x9, 0x36, 0x0, 0xed, 0xb0, 0xc3, 0x16, 0x5, 0x0, 0x0, 0x1, 
+0xc9, 0xbb, 0xbb, 0x4d, 0x45, 0x4e, 0x55, 0x1, 0xe1, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0xa, 0x20, 
+0x20, 0x3e, 0x3e, 0x3e, 0x20, 0x4d, 0x45, 0x4e, 0x55, 0x20, 0x3c, 0x3c, 0x3c, 0xa, 0xa, 0xd, 
+0x0, 0xcd, 0x3, 0xf0, 0x46, 0xbb, 0xbb, 0x49, 0x4e, 0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 0x49, 
+0x4f, 0x4e, 0x53, 0x1, 0x3e, 0x6, 0xcd, 0x3, 0xf0, 0x3d, 0x21, 0x0, 0xa8, 0x11, 0x1, 0xa8, 
+0x1, 0xff, 0x9, 0x36, 0x0, 0xed, 0xb0, 0x21, 0x0, 0x80, 0x11, 0x1, 0x80, 0x1, 0xff, 0x27, 
+0x36, 0x0, 0xed, 0xb0, 0x21, 0x0, 0xa8, 0x11, 0x1, 0xa8, 0x1, 0xff, 0x9, 0x36, 0x7, 0xed, 
+0xb0, 0x3e, 0x7, 0x32, 0xa3, 0xb7, 0x21, 0x1d, 0x1, 0x22, 0xa0, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 
+0x50, 0x41, 0x47, 0x45, 0x20, 0x31, 0xa, 0xd, 0x20, 0x49, 0x4e, 0x53, 0x54, 0x52, 0x55, 0x43, 
+0x54, 0x49, 0x4f, 0x4e, 0x53, 0x20, 0x74, 0x6f, 0x20, 0x48, 0x4f, 0x55, 0x53, 0x45, 0xa, 0xa, 
+0xd, 0x20, 0x20, 0x20, 0x20, 0x28, 0x67, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x20, 0x74, 0x72, 0x61, 
+0x6e, 0x73, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0xa, 0xd, 0x0, 0x6, 0x28, 0x3e, 0x5f, 
+0xcd, 0x3, 0xf0, 0x0, 0x10, 0xf8, 0xcd, 0x3, 0xf0, 0x23, 0xa, 0xa, 0xd, 0x20, 0x3e, 0x3e, 
+0x3e, 0x20, 0x4d, 0x65, 0x6e, 0x7d, 0x65, 0x72, 0x6b, 0x6c, 0x7b, 0x72, 0x75, 0x6e, 0x67, 0x20, 
+0x3c, 0x3c, 0x3c, 0xa, 0xa, 0xd, 0x20, 0x20, 0x47, 0x41, 0x4d, 0x45, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x75, 0x65, 0x73, 0x20, 0x53, 0x70, 0x69, 
+0x65, 0x6c, 0xa, 0xa, 0xd, 0x20, 0x20, 0x4d, 0x45, 0x4e, 0x55, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x65, 0x6e, 0x7d, 0x20, 0x61, 0x6e, 0x7a, 0x65, 0x69, 
+0x67, 0x65, 0x6e, 0xa, 0xa, 0xd, 0x20, 0x20, 0x49, 0x4e, 0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 
+0x49, 0x4f, 0x4e, 0x53, 0x20, 0x20, 0x20, 0x41, 0x6e, 0x6c, 0x65, 0x69, 0x74, 0x75, 0x6e, 0x67, 
+0xa, 0xa, 0xd, 0x20, 0x20, 0x43, 0x53, 0x41, 0x56, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x6d, 0x20, 0x61, 0x75, 0x66, 
+0x20, 0x4b, 0x61, 0x73, 0x73, 0x65, 0x74, 0x74, 0x65, 0xa, 0xa, 0xd, 0x20, 0x20, 0x4b, 0x45, 
+0x59, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x75, 
+0x65, 0x20, 0x54, 0x61, 0x73, 0x74, 0x65, 0x6e, 0x20, 0x7a, 0x75, 0x72, 0xa, 0xd, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 
+0x74, 0x65, 0x75, 0x65, 0x72, 0x75, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x73, 0x20, 0x43, 0x72, 0x61, 
+0x77, 0x6c, 0x65, 0x72, 0x73, 0xa, 0xa, 0xd, 0x20, 0x20, 0x53, 0x50, 0x45, 0x45, 0x44, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x75, 0x65, 0x20, 0x53, 0x70, 
+0x69, 0x65, 0x6c, 0x2d, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x67, 0x65, 0x73, 0x63, 0x68, 
+0x77, 0x69, 0x6e, 0x64, 0x69, 0x67, 0x6b, 0x65, 0x69, 0x74, 0xa, 0xa, 0xd, 0x20, 0x20, 0x54, 
+0x41, 0x42, 0x53, 0x41, 0x56, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x65, 
+0x73, 0x74, 0x65, 0x6e, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x20, 0x61, 0x75, 0x66, 0x20, 0x4b, 0x61, 
+0x73, 0x73, 0x2e, 0xa, 0xa, 0xd, 0x20, 0x20, 0x54, 0x41, 0x42, 0x4c, 0x4f, 0x41, 0x44, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x42, 0x65, 0x73, 0x74, 0x65, 0x6e, 0x6c, 0x69, 0x73, 
+0x74, 0x65, 0x20, 0x76, 0x6f, 0x6e, 0x20, 0x4b, 0x61, 0x73, 0x73, 0x2e, 0xa, 0xa, 0xa, 0xd, 
+0x20, 0x20, 0x53, 0x54, 0x4f, 0x50, 0x20, 0x89, 0x20, 0x4d, 0x45, 0x4e, 0x7d, 0x20, 0x20, 0x20, 
+0x45, 0x4e, 0x54, 0x45, 0x52, 0x20, 0x89, 0x20, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x65, 0x72, 0x6b, 
+0x6c, 0x7b, 0x72, 0x75, 0x6e, 0x67, 0x0, 0xdd, 0x7e, 0xd, 0xfe, 0x13, 0xca, 0xf7, 0x19, 0xfe, 
+0xd, 0xca, 0x2, 0x1a, 0xc3, 0xe7, 0x19, 0x3e, 0x0, 0x32, 0xa3, 0xb7, 0xe1, 0x21, 0x4c, 0x15, 
+0xe5, 0xc9, 0x21, 0x0, 0x80, 0x11, 0x1, 0x80, 0x1, 0xff, 0x27, 0x36, 0x0, 0xed, 0xb0, 0x21, 
+0x1d, 0x1, 0x22, 0xa0, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x50, 0x41, 0x47, 0x45, 0x20, 0x32, 0xa, 
+0xd, 0x20, 0x49, 0x4e, 0x53, 0x54, 0x52, 0x55, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x53, 0x20, 0x74, 
+0x6f, 0x20, 0x48, 0x4f, 0x55, 0x53, 0x45, 0xa, 0xa, 0xd, 0x20, 0x20, 0x20, 0x20, 0x28, 0x67, 
+0x65, 0x72, 0x6d, 0x61, 0x6e, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c, 0x61, 0x74, 0x69, 0x6f, 
+0x6e, 0x29, 0xa, 0xd, 0x0, 0x6, 0x28, 0x3e, 0x5f, 0xcd, 0x3, 0xf0, 0x0, 0x10, 0xf8, 0x21, 
+0x0, 0x6, 0x22, 0xa0, 0xb7, 0x21, 0xe0, 0x2f, 0xcd, 0x3, 0xf0, 0x45, 0xdd, 0x7e, 0xd, 0xfe, 
+0x0, 0xca, 0x6c, 0x1a, 0x3e, 0x0, 0x32, 0xa3, 0xb7, 0xe1, 0x21, 0x4c, 0x15, 0xe5, 0xc9, 0x48, 
+0x4f, 0x55, 0x53, 0x45, 0x2b, 0x20, 0x20, 0x43, 0x4f, 0x4d, 0x3, 0x0, 0x2, 0xe0, 0x33, 0xfc, 
+0x13, 0xbb, 0xbb, 0x43, 0x53, 0x41, 0x56, 0x45, 0x1, 0x3e, 0x3, 0xcd, 0x3, 0xf0, 0x3d, 0x3e, 
+0xc, 0xcd, 0x3, 0xf0, 0x0, 0x21, 0x8a, 0x1a, 0x11, 0x81, 0xb7, 0x1, 0x7, 0x0, 0xed, 0xb0, 
+0x21, 0x7f, 0x1a, 0xcd, 0x3, 0xf0, 0x36, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0xa, 0x20, 0x56, 0x45, 
+0x52, 0x49, 0x46, 0x59, 0x28, 0x59, 0x29, 0x3f, 0x0, 0xcd, 0x3, 0xf0, 0x4, 0xfe, 0x59, 0xc2, 
+0xdc, 0x1a, 0x3e, 0xc, 0xcd, 0x3, 0xf0, 0x0, 0xcd, 0x3, 0xf0, 0x11, 0x3e, 0x2, 0xcd, 0x3, 
+0xf0, 0x3d, 0xc9, 0xbb, 0xbb, 0x4b, 0x45, 0x59, 0x53, 0x1, 0x3e, 0x1, 0xcd, 0x3, 0xf0, 0x3d, 
+0x21, 0xa2, 0xb7, 0xcb, 0xde, 0x21, 0x14, 0x1, 0x11, 0x6a, 0x4, 0x6, 0x5, 0xc5, 0xe5, 0xd5, 
+0x22, 0xa0, 0xb7, 0xcd, 0x3, 0xf0, 0x4, 0xcd, 0x3, 0xf0, 0x0, 0xd1, 0x12, 0x13, 0xe1, 0x24, 
+0xc1, 0x10, 0xea, 0x21, 0xa2, 0xb7, 0xcb, 0x9e, 0x3e, 0x2, 0xcd, 0x3, 0xf0, 0x3d, 0xc9, 0xbb, 
+0xbb, 0x53, 0x50, 0x45, 0x45, 0x44, 0x1, 0x3e, 0x3, 0xcd, 0x3, 0xf0, 0x3d, 0xcd, 0x3, 0xf0, 
+0x23, 0xc, 0xa, 0x20, 0x53, 0x50, 0x45, 0x45, 0x44, 0x20, 0x28, 0x39, 0x2d, 0x31, 0x29, 0x3f, 
+0x0, 0x3e, 0x7, 0xcd, 0x3, 0xf0, 0x0, 0xcd, 0x3, 0xf0, 0x4, 0xfe, 0x31, 0xda, 0x47, 0x1b, 
+0xfe, 0x3a, 0xd2, 0x47, 0x1b, 0xd6, 0x30, 0x32, 0x51, 0x0, 0x87, 0x27, 0xc6, 0x2, 0x27, 0x32, 
+0x50, 0x0, 0x3e, 0x7, 0xcd, 0x3, 0xf0, 0x0, 0x3e, 0x1, 0xcd, 0x3, 0xf0, 0x3d, 0x21, 0x8, 
+0x1, 0x22, 0xa0, 0xb7, 0x3a, 0x51, 0x0, 0xcd, 0x3, 0xf0, 0x1c, 0x3e, 0x2, 0xcd, 0x3, 0xf0, 
+0x3d, 0xc9, 0xbb, 0xbb, 0x54, 0x41, 0x42, 0x53, 0x41, 0x56, 0x45, 0x1, 0x3e, 0x74, 0x21, 0xf0, 
+0x2b, 0x77, 0x23, 0x77, 0x23, 0x77, 0xdb, 0x88, 0xcb, 0xef, 0xd3, 0x88, 0xdd, 0x36, 0x5, 0x80, 
+0xdd, 0x36, 0x6, 0x2b, 0x1, 0x0, 0x12, 0xcd, 0x3, 0xf0, 0x1, 0xcd, 0x3, 0xf0, 0xb, 0xdb, 
+0x88, 0xcb, 0xaf, 0xd3, 0x88, 0xdd, 0x36, 0x5, 0x0, 0xdd, 0x36, 0x6, 0xb7, 0xc9, 0xbb, 0xbb, 
+0x54, 0x41, 0x42, 0x4c, 0x4f, 0x41, 0x44, 0x1, 0x3e, 0x3, 0xcd, 0x3, 0xf0, 0x3d, 0xdd, 0x36, 
+0x5, 0x0, 0xdd, 0x36, 0x6, 0xb7, 0xdd, 0x36, 0x7, 0x0, 0xcd, 0x3, 0xf0, 0x5, 0xdd, 0x36, 
+0x7, 0xc0, 0xda, 0x1e, 0x1c, 0x3e, 0x74, 0x21, 0x70, 0xb7, 0xbe, 0xc2, 0x1e, 0x1c, 0x23, 0xbe, 
+0xc2, 0x1e, 0x1c, 0x23, 0xbe, 0xc2, 0x1e, 0x1c, 0x21, 0x0, 0xb7, 0x11, 0x80, 0x2b, 0x1, 0x7f, 
+0x0, 0xed, 0xb0, 0xcd, 0x3, 0xf0, 0xb, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0xa, 0x20, 0x41, 0x4c, 
+0x4c, 0x52, 0x49, 0x47, 0x48, 0x54, 0x0, 0x3e, 0x2, 0xcd, 0x3, 0xf0, 0x3d, 0xc9, 0x3e, 0x17, 
+0x32, 0xa3, 0xb7, 0x3e, 0x7, 0xcd, 0x3, 0xf0, 0x0, 0xcd, 0x3, 0xf0, 0x23, 0xc, 0xa, 0x20, 
+0x21, 0x21, 0x21, 0x20, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x20, 0x21, 0x21, 0x21, 0xa, 0xd, 0x0, 
+0x3e, 0x7, 0x32, 0xa3, 0xb7, 0xcd, 0x3, 0xf0, 0x23, 0x20, 0x50, 0x4c, 0x45, 0x41, 0x53, 0x45, 
+0x20, 0x52, 0x45, 0x50, 0x45, 0x41, 0x54, 0x20, 0x21, 0x0, 0xcd, 0x3, 0xf0, 0xb, 0x3e, 0x2, 
+0xcd, 0x3, 0xf0, 0x3d, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0xdd, 0x36, 0x7, 0xc1, 0xdd, 0x36, 0x9, 0xbc, 0x3a, 0x45, 0x3, 0xfe, 0x3, 0xc4, 0x0, 0xf0, 
+0x3a, 0x80, 0x1c, 0xfe, 0xdd, 0xc4, 0x0, 0xf0, 0x3a, 0x56, 0x14, 0xfe, 0xff, 0xc4, 0x0, 0xf0, 
+0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
+0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
+0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
+0x16, 0x16, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x16, 0x16, 0x16, 0x16, 0x6f, 0x6f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0xf, 0xf, 0xf, 0xf, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0xf, 0xf, 0xf, 0x1f, 0x1f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0xf, 0x4f, 0x1f, 0x1f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x17, 0x17, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x17, 0x17, 0x17, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 
+0x27, 0x27, 0x17, 0x17, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x17, 0x17, 0x4f, 0x4f, 0x4f, 0x4f, 0xff, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x17, 0x17, 0x17, 0x17, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x27, 0x27, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x4f, 0x4f, 0x17, 0x17, 0x17, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x27, 0x27, 0x27, 0x4f, 0x27, 0x27, 0x27, 0x27, 
+0x27, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x17, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x27, 0x27, 0x27, 0x27, 0x27, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0xf, 0xf, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x4f, 0x4f, 0x4f, 0xf, 0xf, 0xf, 0x4f, 0xf, 0xf, 0xf, 0xf, 0xf, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0xf, 0xf, 0xf, 0xf, 0xf, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x17, 0x17, 0x17, 0x17, 
+0x17, 0x17, 0x17, 0x17, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x16, 0x16, 0x16, 0x16, 0x6f, 0x6f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x17, 0x17, 0x27, 0x27, 0x1f, 0x1f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x17, 0x17, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x17, 0x17, 0x27, 0x27, 0x1f, 0x1f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x17, 0x17, 0x17, 0x4f, 0x4f, 0x16, 0x16, 0x16, 0x16, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 
+0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x16, 0x16, 
+0x16, 0x16, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 
+0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x16, 0x16, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 
+0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 
+0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 
+0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0xa1, 0xa0, 0xa5, 0xa6, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa7, 0xa8, 0xa9, 0xaa, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0xab, 0xac, 0xad, 0xb4, 0xb5, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xae, 0x20, 0xb6, 0xb7, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0xaf, 0xb0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xb1, 0xb2, 0xb3, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 
+0xc6, 0xc7, 0xb4, 0xb5, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xb6, 0xb7, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0xa7, 0xa8, 0xa9, 0xaa, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0xc8, 0xc9, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0x20, 0x20, 0xab, 0xac, 0xad, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xca, 0xcb, 0xcc, 0x20, 0xcd, 0xce, 0xcf, 0xd0, 
+0xd1, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0xae, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0xc8, 0xc9, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0x20, 0x20, 0x20, 0xca, 0xcb, 0xcc, 0x20, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xc0, 0xc1, 0xc2, 0xc3, 
+0xc4, 0xc5, 0xc6, 0xc7, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0xa1, 0xa0, 0xa5, 0xa6, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xb4, 0xb5, 0xb4, 0xb5, 0xb4, 0xb5, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xaf, 0xb0, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0xb6, 0xb7, 0xb6, 0xb7, 0xb6, 0xb7, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0xb1, 0xb2, 0xb3, 0x20, 0x20, 0xa0, 0xa1, 0xa1, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa1, 0xa0, 
+0xa0, 0xa1, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa4, 0xa3, 
+0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa3, 0xa0, 0xa1, 0x20, 0x43, 0x52, 0x41, 0x57, 0x4c, 0x45, 0x52, 
+0x53, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4f, 0x49, 0x4e, 0x54, 0x53, 0x3a, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x52, 0x45, 0x43, 0x4f, 0x52, 0x44, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x0, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x0, 0x0, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0xff, 0xff, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0x0, 0x80, 0x80, 0xc0, 0xe0, 0xf8, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0x31, 
+0x0, 0x0, 0x0, 0x20, 0x18, 0x14, 0x13, 0x10, 0x3c, 0x40, 0x41, 0x42, 0x44, 0x40, 0x20, 0x90, 
+0x0, 0x0, 0x80, 0x40, 0x20, 0x30, 0x28, 0xc0, 0x40, 0x80, 0x41, 0x21, 0x22, 0x15, 0x10, 0x8, 
+0x90, 0x93, 0xc, 0x8, 0x8, 0xc8, 0x20, 0x10, 0x4f, 0x20, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x8, 0x8, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x3f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3f, 
+0x2, 0x86, 0x8c, 0x98, 0xf0, 0xfe, 0xfe, 0xff, 0x0, 0x4, 0x9, 0xe, 0x18, 0xe, 0x0, 0x0, 
+0x27, 0x1f, 0xbf, 0x3f, 0x7f, 0x70, 0x80, 0x0, 0xfe, 0xfe, 0xfc, 0xf8, 0xf0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x3, 0xf, 0x1f, 0x3e, 0xfc, 0x8, 0x30, 0xe0, 0xc0, 0xff, 0xe0, 0x0, 0x0, 
+0x2, 0x4, 0xd, 0x1f, 0x3e, 0x7f, 0x0, 0x0, 0xf, 0x7c, 0xe0, 0x0, 0x0, 0x80, 0x0, 0x0, 
+0x0, 0x1f, 0x26, 0x6, 0x6, 0xe, 0xc, 0xc, 0x0, 0xc0, 0xf1, 0x18, 0x18, 0x38, 0xf0, 0xe0, 
+0x0, 0xfc, 0x6, 0x43, 0x63, 0x63, 0xe3, 0xc6, 0x0, 0x3, 0x7, 0xe, 0xc, 0xc, 0x1f, 0x1f, 
+0x0, 0xf8, 0xf0, 0x0, 0x0, 0x0, 0xc1, 0x81, 0x0, 0x30, 0x78, 0xd8, 0xd8, 0xd8, 0x98, 0x8c, 
+0x0, 0x4, 0xe, 0xc, 0xc, 0x1d, 0x1f, 0x1f, 0x0, 0xc, 0x18, 0x38, 0x70, 0xe0, 0xc0, 0x80, 
+0xc, 0x18, 0x10, 0x20, 0x41, 0x1f, 0x0, 0x0, 0x70, 0x30, 0x31, 0x61, 0xe3, 0xc2, 0x0, 0x0, 
+0xfc, 0xf0, 0xb8, 0x9c, 0xf, 0x2, 0x0, 0x0, 0x18, 0x38, 0x30, 0x30, 0x3f, 0x1f, 0x0, 0x0, 
+0x3, 0x3, 0x7, 0x6, 0xe, 0xc, 0x0, 0x0, 0x8c, 0x1c, 0xfc, 0xe, 0xe, 0x6, 0x0, 0x0, 
+0x1e, 0x3f, 0x3b, 0x31, 0x70, 0x60, 0x0, 0x0, 0x0, 0x0, 0x80, 0xc0, 0xc0, 0xe0, 0x60, 0x0, 
+0x0, 0x0, 0x3, 0x7c, 0x4, 0x4, 0x4, 0x4, 0x0, 0x0, 0xe0, 0x0, 0x20, 0x20, 0x20, 0x20, 
+0x8, 0x8, 0x8, 0x8, 0x8, 0x10, 0x10, 0x0, 0x4c, 0x54, 0x64, 0xc4, 0x88, 0x88, 0x0, 0x0, 
+0xe, 0x12, 0x22, 0x4c, 0xb0, 0x80, 0x70, 0x0, 0x0, 0x0, 0x61, 0x63, 0xc3, 0xc3, 0xc3, 0xc3, 
+0x0, 0x0, 0xe, 0x1f, 0x19, 0x33, 0x23, 0x63, 0x0, 0x0, 0x33, 0x33, 0x33, 0x33, 0x73, 0x62, 
+0x0, 0x0, 0x1e, 0x3f, 0x63, 0x60, 0x3c, 0xe, 0x0, 0x0, 0x3f, 0x7e, 0x60, 0x60, 0x60, 0x7c, 
+0xf3, 0xff, 0xcf, 0xc3, 0xc2, 0x86, 0x4, 0x0, 0x63, 0x66, 0x66, 0xec, 0xcc, 0xf8, 0x70, 0x0, 
+0x66, 0x66, 0x66, 0x64, 0x74, 0x3c, 0x18, 0x0, 0x6, 0x3, 0x3, 0xc3, 0xe7, 0x7e, 0x3c, 0x0, 
+0x78, 0x60, 0x60, 0x60, 0x60, 0xff, 0xff, 0x0, 0x0, 0x63, 0x63, 0x6b, 0x6b, 0x7f, 0x36, 0x0, 
+0x0, 0x66, 0x3c, 0x18, 0x18, 0x3c, 0x66, 0x0, 0x0, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x0, 
+0x0, 0x7e, 0xc, 0x18, 0x30, 0x60, 0x7e, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0x0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0, 0x0, 0x7e, 0x6, 0x6, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x8, 0x1c, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 
+0x1c, 0x7, 0x7e, 0x7, 0x7, 0x1f, 0x7e, 0x33, 0x3, 0x3e, 0x7f, 0x57, 0x3, 0x7e, 0x3f, 0x8c, 
+0xe0, 0xe0, 0x5f, 0x80, 0x80, 0x30, 0x1a, 0x30, 0x0, 0x1a, 0x30, 0xa8, 0x0, 0xdf, 0xe0, 0xc4, 
+0x0, 0x7, 0x7e, 0x7, 0x7, 0x1f, 0x7e, 0x3, 0xb, 0x3e, 0x7f, 0x87, 0x13, 0x7e, 0x3f, 0x7c, 
+0x0, 0xe0, 0x5f, 0x80, 0x80, 0x30, 0x1a, 0x0, 0x60, 0x1a, 0x30, 0x84, 0x0, 0xdf, 0xe0, 0xf8, 
+0x7, 0x7, 0xfa, 0x1, 0x1, 0xc, 0x58, 0xc, 0x0, 0x58, 0xc, 0x15, 0x0, 0xfb, 0x7, 0x27, 
+0x38, 0xe0, 0x7e, 0xe0, 0xe0, 0xf8, 0x7e, 0xcc, 0xc0, 0x7c, 0xfe, 0xea, 0xc0, 0x7e, 0xfc, 0x39, 
+0x0, 0x7, 0xfa, 0x1, 0x1, 0xc, 0x58, 0x0, 0x6, 0x58, 0xc, 0x21, 0x0, 0xfb, 0x7, 0x1f, 
+0x0, 0xe0, 0x7e, 0xe0, 0xe0, 0xf8, 0x7e, 0xc0, 0xd0, 0x7c, 0xfe, 0xe1, 0xc8, 0x7e, 0xfc, 0x3e, 
+0xe, 0x1f, 0xff, 0x3, 0x3, 0x7f, 0xff, 0x19, 0x1, 0x7f, 0x7f, 0xab, 0x1, 0xff, 0x1f, 0x4e, 
+0x70, 0xf8, 0xff, 0xc0, 0xc0, 0xfe, 0xff, 0x98, 0x80, 0xfe, 0xfe, 0xd5, 0x80, 0xff, 0xf8, 0x72, 
+0x0, 0x1f, 0xff, 0x3, 0x3, 0x7f, 0xff, 0x1, 0xd, 0xff, 0x7f, 0x3, 0x1, 0xff, 0x1f, 0xfe, 
+0x0, 0xf8, 0xff, 0xc0, 0xc0, 0xfe, 0xff, 0x80, 0xb0, 0xff, 0xfe, 0xc0, 0x80, 0xff, 0xf8, 0x7f, 
+0xe, 0x1f, 0xe9, 0x2, 0x3, 0x73, 0xe3, 0x19, 0x1, 0xe1, 0x73, 0xab, 0x1, 0xec, 0x1d, 0x4e, 
+0x70, 0xf8, 0x97, 0x40, 0xc0, 0xce, 0xc7, 0x98, 0x80, 0x87, 0xce, 0xd5, 0x80, 0x37, 0xb8, 0x72, 
+0x0, 0x1f, 0xe9, 0x2, 0x3, 0x73, 0xe3, 0x1, 0xd, 0xe1, 0x73, 0x3, 0x1, 0xec, 0x1d, 0xfe, 
+0x0, 0xf8, 0x97, 0x40, 0x60, 0xce, 0xc7, 0x80, 0xb0, 0x87, 0xce, 0xc0, 0x80, 0x37, 0xb8, 0x7f, 
+0x18, 0xc, 0xe0, 0x1f, 0x26, 0x3, 0xe6, 0x43, 0xc1, 0x1f, 0xe4, 0xb1, 0xc1, 0x71, 0x71, 0x8e, 
+0x18, 0x30, 0x7, 0xf8, 0x64, 0xc0, 0x67, 0xc2, 0x83, 0xf8, 0x27, 0x8d, 0x83, 0x8e, 0x8e, 0x71, 
+0xf8, 0xc, 0xe0, 0x1f, 0xc6, 0x3, 0xe6, 0x3, 0x1, 0x1f, 0xe4, 0x81, 0x1, 0x71, 0x71, 0x7e, 
+0x1f, 0x30, 0x7, 0xf8, 0x63, 0xc0, 0x67, 0xc0, 0x80, 0xf8, 0x27, 0x81, 0x80, 0x8e, 0x8e, 0x7e, 
+0x18, 0x4, 0x80, 0x17, 0x2, 0x3, 0xc6, 0x42, 0xc1, 0xd, 0x24, 0xb1, 0x40, 0x60, 0x51, 0x8e, 
+0x10, 0x30, 0x3, 0x38, 0x48, 0x40, 0x66, 0x82, 0x81, 0xa8, 0x25, 0x8d, 0x83, 0x8c, 0x82, 0x71, 
+0x0, 0x1, 0xb, 0x8, 0x10, 0x10, 0x0, 0x3, 0x4, 0x4, 0x15, 0xf, 0x0, 0x28, 0x1, 0x3f, 
+0x0, 0x0, 0x8, 0xc0, 0x8, 0x0, 0x50, 0x40, 0x0, 0xc0, 0x48, 0xf0, 0x20, 0x20, 0x0, 0xfc, 
+0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0xf, 0x0, 0x0, 0x1, 0x1f, 0x0, 0x0, 0x3, 0x7f, 
+0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xc0, 0xfc, 0x0, 0x0, 0xe0, 0xff, 
+0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xff, 0x60, 0xff, 
+0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0xff, 0x6, 0xff, 
+0x0, 0xf, 0xc, 0x1, 0x1, 0x67, 0xf, 0x1, 0x11, 0x1e, 0x19, 0x1, 0xd, 0xc, 0x21, 0x0, 
+0x0, 0x60, 0xfe, 0x0, 0x0, 0xc0, 0xf8, 0x0, 0x0, 0x80, 0x80, 0x0, 0x0, 0xe0, 0x80, 0x0, 
+0x0, 0x63, 0x3, 0x8, 0x2, 0x3f, 0x3, 0x0, 0x3, 0x1e, 0x6, 0x0, 0xc3, 0xe, 0xc, 0x0, 
+0x0, 0x70, 0xe0, 0xe, 0x4, 0xe0, 0xf0, 0x0, 0xc, 0x40, 0x78, 0x0, 0x38, 0x40, 0x3c, 0x0, 
+0x7c, 0x28, 0x2, 0x28, 0x88, 0x20, 0x9, 0x26, 0x46, 0x10, 0x14, 0x2c, 0x51, 0x14, 0x14, 0x11, 
+0x38, 0x25, 0x10, 0x12, 0x44, 0x42, 0x24, 0x2a, 0x85, 0x84, 0x42, 0x44, 0x15, 0x0, 0x22, 0x80, 
+0x1, 0x4, 0x6, 0x16, 0x2, 0xe, 0x20, 0x2c, 0x4, 0x31, 0xd, 0x34, 0x4, 0x46, 0x0, 0x3, 
+0x80, 0x88, 0x21, 0x40, 0x5c, 0x9c, 0xe, 0x40, 0x64, 0x12, 0xf0, 0x80, 0x44, 0x21, 0x40, 0x0, 
+0x67, 0xf, 0xf, 0xf, 0x67, 0xf, 0xf, 0xf, 0x67, 0x2f, 0x2f, 0x2f, 0x67, 0x2f, 0x2f, 0x2f, 
+0x77, 0x17, 0x17, 0x17, 0x77, 0x17, 0x17, 0x17, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 
+0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 
+0xf, 0x7, 0x17, 0x17, 0x17, 0xf, 0xf, 0x77, 0x17, 0x17, 0xf, 0xf, 0xf, 0x77, 0x67, 0x17, 
+0x99, 0x99, 0x54, 0x48, 0x45, 0x20, 0x42, 0x52, 0x41, 0x49, 0x4e, 0x0, 0x0, 0x77, 0x67, 0x17, 
+0x50, 0x1, 0x4b, 0x4d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x67, 0x17, 
+0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x67, 0x17, 
+0x0, 0x0, 0x48, 0x45, 0x52, 0x52, 0x4d, 0x41, 0x4e, 0x4e, 0x20, 0x0, 0x0, 0x77, 0x67, 0x17, 
+0x0, 0x0, 0x53, 0x49, 0x4d, 0x4f, 0x4e, 0x45, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0x67, 0x17, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x24, 0x24, 0x0, 0x20, 0x20, 0x24, 
+0x0, 0x0, 0x20, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x20, 0x24, 0x24, 0x0, 0x20, 0x24, 0x24, 
+0x0, 0x0, 0x20, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x20, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 
+0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x20, 0x74, 0x74, 0x74, 0x74, 0x24, 0x24, 
+0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x20, 0x74, 0x74, 0x74, 0x74, 0x4, 0x0, 
+0x0, 0x74, 0x74, 0x74, 0x74, 0x74, 0x4, 0x0, 0x0, 0x74, 0x74, 0x24, 0x24, 0x74, 0x74, 0x24, 
+0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 
+0x0, 0x74, 0x74, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x74, 0x74, 0x24, 0x24, 0x24, 0x0, 0x0, 
+0x0, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 
+0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x0, 0x74, 0x74, 0x74, 0x74, 0x24, 0x24, 
+0x0, 0x74, 0x74, 0x74, 0x74, 0x4, 0x0, 0x0, 0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 
+0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 
+0x0, 0x20, 0x24, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x0, 0x74, 0x74, 0x24, 0x24, 0x74, 0x74, 0x4, 
+0x0, 0x74, 0x74, 0x24, 0x24, 0x74, 0x74, 0x4, 0x0, 0x74, 0x74, 0x24, 0x24, 0x74, 0x74, 0x4, 
+0x0, 0x74, 0x74, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x74, 0x74, 0x4, 0x0, 0x74, 0x74, 0x4, 
+0x0, 0x0, 0x74, 0x74, 0x74, 0x74, 0x4, 0x0, 0x0, 0x0, 0x74, 0x74, 0x74, 0x74, 0x4, 0x0, 
+0x0, 0x0, 0x74, 0x74, 0x74, 0x74, 0x4, 0x0, 0x0, 0x74, 0x74, 0x74, 0x74, 0x74, 0x4, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0xa0, 0x5b, 0xa1, 0x20, 0xa0, 0x5b, 0xa1, 0x20, 0x20, 0xa0, 0x5b, 0x5b, 0x5b, 0xa1, 0x20, 
+0x20, 0xa0, 0x5b, 0xa1, 0x20, 0xa0, 0x5b, 0xa1, 0x20, 0x20, 0xa0, 0x5b, 0x5b, 0x5b, 0xa1, 0x20, 
+0x20, 0xa0, 0x5b, 0x5b, 0x5b, 0x5b, 0xa1, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 
+0x20, 0xa0, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0xa1, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 
+0x20, 0xa0, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 
+0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 
+0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0xa1, 0x20, 
+0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0xa1, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x20, 
+0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 
+0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0xa1, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 
+0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 
+0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0xa0, 0x5b, 0xa1, 0x20, 0x5b, 0x5b, 0x20, 
+0x20, 0x5b, 0x5b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x20, 0x20, 0x5b, 0x5b, 0x20, 
+0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x5b, 0xa0, 
+0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x5b, 0x5b, 0xa0, 0x5b, 0x5b, 0xa1, 0x20, 
+0x20, 0x5b, 0x5b, 0xa0, 0x20, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 
+0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 
+0x20, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x3e, 0x3e, 0x3e, 0x20, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x65, 0x72, 0x6b, 0x6c, 0x7b, 0x72, 
+0x75, 0x6e, 0x67, 0x20, 0x3c, 0x3c, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x48, 0x4f, 0x55, 0x53, 0x45, 0x20, 0x69, 0x73, 0x74, 0x20, 0x65, 0x69, 0x6e, 0x20, 0x43, 
+0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x72, 0x73, 0x70, 0x69, 0x65, 0x6c, 0x20, 0x66, 0x7d, 0x72, 
+0x20, 0x64, 0x65, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4b, 0x43, 0x20, 0x38, 0x35, 0x2f, 0x33, 
+0x2e, 0x20, 0x44, 0x69, 0x65, 0x20, 0x41, 0x75, 0x66, 0x67, 0x61, 0x62, 0x65, 0x20, 0x62, 0x65, 
+0x73, 0x74, 0x65, 0x68, 0x74, 0x20, 0x64, 0x61, 0x72, 0x69, 0x6e, 0x2c, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x64, 0x65, 0x6e, 0x20, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x20, 0x7d, 0x62, 0x65, 
+0x72, 0x20, 0x64, 0x61, 0x73, 0x20, 0x53, 0x70, 0x69, 0x65, 0x6c, 0x66, 0x65, 0x6c, 0x64, 0x20, 
+0x7a, 0x75, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x65, 0x75, 0x65, 0x72, 0x6e, 
+0x20, 0x75, 0x6e, 0x64, 0x20, 0x64, 0x61, 0x62, 0x65, 0x69, 0x20, 0x22, 0x45, 0x6e, 0x65, 0x72, 
+0x67, 0x69, 0x65, 0x22, 0x20, 0x7a, 0x75, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x65, 0x72, 0x65, 0x6e, 0x2e, 
+0x20, 0x44, 0x61, 0x62, 0x65, 0x69, 0x20, 0x69, 0x73, 0x74, 0x20, 0x64, 0x65, 0x6e, 0x20, 0x4d, 
+0x6f, 0x6e, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x20, 0x61, 0x75, 0x73, 0x7a, 0x75, 0x77, 0x65, 
+0x69, 0x63, 0x68, 0x65, 0x6e, 0x2e, 0x20, 0x44, 0x69, 0x65, 0x20, 0x45, 0x6e, 0x65, 0x72, 0x67, 
+0x69, 0x65, 0x20, 0x77, 0x69, 0x72, 0x64, 0x20, 0x61, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x64, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x6e, 0x20, 0x57, 0x61, 0x6e, 0x64, 
+0x20, 0x64, 0x65, 0x72, 0x20, 0x6f, 0x62, 0x65, 0x72, 0x73, 0x74, 0x65, 0x6e, 0x20, 0x45, 0x74, 
+0x61, 0x67, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x62, 0x67, 0x65, 0x68, 0x6f, 0x6c, 
+0x74, 0x20, 0x28, 0x64, 0x61, 0x62, 0x65, 0x69, 0x20, 0x76, 0x65, 0x72, 0x66, 0x7b, 0x72, 0x62, 
+0x74, 0x20, 0x73, 0x69, 0x63, 0x68, 0x20, 0x64, 0x65, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x20, 0x74, 0x7d, 0x72, 0x6b, 0x69, 0x73, 0x29, 
+0x2e, 0x20, 0x49, 0x6d, 0x20, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x74, 0x65, 0x6e, 0x20, 0x20, 
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x6f, 0x63, 0x6b, 0x77, 0x65, 
+0x72, 0x6b, 0x20, 0x77, 0x69, 0x72, 0x64, 0x20, 0x64, 0x69, 0x65, 0x20, 0x22, 0x45, 0x6e, 0x65, 
+0x72, 0x67, 0x69, 0x65, 0x22, 0x20, 0x77, 0x69, 0x65, 0x64, 0x65, 0x72, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x61, 0x62, 0x67, 0x65, 0x6c, 0x69, 0x65, 0x66, 0x65, 0x72, 0x74, 0x20, 0x28, 0x43, 0x72, 
+0x61, 0x77, 0x6c, 0x65, 0x72, 0x20, 0x77, 0x69, 0x72, 0x64, 0x20, 0x77, 0x69, 0x65, 0x64, 0x65, 
+0x72, 0x20, 0x62, 0x6c, 0x61, 0x75, 0x29, 0x2e, 0x20, 0x20, 0x44, 0x65, 0x72, 0x20, 0x43, 0x72, 
+0x61, 0x77, 0x6c, 0x65, 0x72, 0x20, 0x68, 0x61, 0x74, 0x20, 0x64, 0x69, 0x65, 0x20, 0x4d, 0x7c, 
+0x67, 0x6c, 0x69, 0x63, 0x68, 0x6b, 0x65, 0x69, 0x74, 0x2c, 0x20, 0x64, 0x69, 0x65, 0x20, 0x20, 
+0x20, 0x4d, 0x6f, 0x6e, 0x73, 0x74, 0x65, 0x72, 0x20, 0x66, 0x7d, 0x72, 0x20, 0x65, 0x69, 0x6e, 
+0x69, 0x67, 0x65, 0x20, 0x5a, 0x65, 0x69, 0x74, 0x20, 0x61, 0x75, 0x73, 0x7a, 0x75, 0x73, 0x63, 
+0x68, 0x61, 0x6c, 0x74, 0x65, 0x6e, 0x3a, 0x20, 0x20, 0x20, 0x57, 0x65, 0x6e, 0x6e, 0x20, 0x64, 
+0x65, 0x72, 0x20, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x20, 0x67, 0x65, 0x72, 0x61, 0x64, 
+0x65, 0x20, 0x22, 0x45, 0x6e, 0x65, 0x72, 0x67, 0x69, 0x65, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x67, 0x65, 0x73, 0x70, 0x65, 0x69, 0x63, 0x68, 0x65, 0x72, 0x74, 0x20, 0x68, 0x61, 0x74, 
+0x2c, 0x20, 0x6b, 0x61, 0x6e, 0x6e, 0x20, 0x6d, 0x69, 0x74, 0x20, 0x65, 0x69, 0x6e, 0x65, 0x72, 
+0x20, 0x54, 0x61, 0x73, 0x74, 0x65, 0x20, 0x20, 0x20, 0x28, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 
+0x3a, 0x20, 0x4c, 0x65, 0x65, 0x72, 0x74, 0x61, 0x73, 0x74, 0x65, 0x29, 0x20, 0x65, 0x69, 0x6e, 
+0x20, 0x22, 0x45, 0x6e, 0x65, 0x72, 0x67, 0x69, 0x65, 0x2d, 0x42, 0x6c, 0x69, 0x74, 0x7a, 0x22, 
+0x20, 0x28, 0x53, 0x48, 0x4f, 0x54, 0x29, 0x20, 0x61, 0x75, 0x73, 0x67, 0x65, 0x6c, 0x7c, 0x73, 
+0x74, 0x20, 0x77, 0x65, 0x72, 0x64, 0x65, 0x6e, 0x2e, 0x20, 0x44, 0x69, 0x65, 0x20, 0x22, 0x45, 
+0x6e, 0x65, 0x72, 0x67, 0x69, 0x65, 0x22, 0x20, 0x20, 0x67, 0x65, 0x68, 0x74, 0x20, 0x64, 0x61, 
+0x6e, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x66, 0x6c, 
+0x7c, 0x74, 0x65, 0x6e, 0x20, 0x75, 0x6e, 0x64, 0x20, 0x6d, 0x75, 0x7e, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x6e, 0x65, 0x75, 0x20, 0x61, 0x62, 0x67, 0x65, 0x68, 0x6f, 0x6c, 0x74, 0x20, 0x77, 0x65, 
+0x72, 0x64, 0x65, 0x6e, 0x2e, 0x20, 0x44, 0x65, 0x72, 0x20, 0x42, 0x6c, 0x69, 0x74, 0x7a, 0x20, 
+0x67, 0x65, 0x68, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x20, 0x64, 0x69, 0x65, 0x20, 0x52, 0x69, 0x63, 
+0x68, 0x74, 0x75, 0x6e, 0x67, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x69, 0x65, 0x20, 0x64, 0x65, 
+0x72, 0x20, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+0x20, 0x67, 0x65, 0x72, 0x61, 0x64, 0x65, 0x20, 0x67, 0x75, 0x63, 0x6b, 0x74, 0x2e, 0x20, 0x0, 
+0x0, 0xbb, 0xbb, 0x47, 0x41, 0x4d, 0x45, 0x1, 0x3e, 0x1, 0x32, 0x21, 0xc, 0xc3, 0x3e, 0x17, 
+0xbb, 0xbb, 0x54, 0x52, 0x41, 0x49, 0x4e, 0x45, 0x52, 0x1, 0x3e, 0x0, 0x32, 0x21, 0xc, 0xc3, 
+0x3e, 0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+};
+unsigned char dump_digger3[20269] = {
+0xc3, 0x4b, 0x43, 0x2d, 0x54, 0x41, 0x50, 0x45, 0x20, 0x62, 0x79, 0x20, 0x41, 0x46, 0x2e, 0x20, 
+0x1, 0x44, 0x49, 0x47, 0x47, 0x45, 0x52, 0x20, 0x20, 0x43, 0x4f, 0x4d, 0x1, 0x0, 0x0, 0x0, 
+0x0, 0x3, 0x0, 0x2, 0x0, 0x50, 0x3d, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x18, 0x18, 
+0x18, 0x0, 0x0, 0x0, 0x34, 0x0, 0x34, 0x0, 0x0, 0x0, 0x0, 0x34, 0x34, 0x7e, 0x7e, 0x34, 
+0x34, 0x0, 0x0, 0x7e, 0x8, 0xa, 0x7e, 0x7e, 0x68, 0x8, 0x0, 0x10, 0x62, 0x26, 0x64, 0x46, 
+0x8, 0x0, 0x18, 0x6a, 0x64, 0xc4, 0x68, 0xca, 0x11, 0x71, 0x0, 0x0, 0x8, 0x0, 0x10, 0x0, 
+0x0, 0x0, 0x0, 0x18, 0x4, 0x8, 0x8, 0x4, 0x18, 0x0, 0x0, 0x18, 0x20, 0x10, 0x10, 0x20, 
+0x18, 0x0, 0x0, 0x7e, 0x0, 0x18, 0x24, 0x24, 0x18, 0x0, 0x0, 0x7e, 0x0, 0x18, 0x18, 0x18, 
+0x18, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x4, 0x0, 0x8, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x18, 0x0, 0x0, 0x0, 0x10, 0x2, 0x20, 0x4, 0x40, 
+0x8, 0x0, 0x3, 0x0, 0xd2, 0x7c, 0xe2, 0xc6, 0x7c, 0xca, 0x0, 0x0, 0x18, 0x38, 0x18, 0x68, 
+0x7e, 0x18, 0x0, 0x0, 0x7c, 0x7c, 0xc0, 0xc2, 0xfe, 0x6, 0x0, 0x0, 0x6, 0x7c, 0xc2, 0xc2, 
+0x7c, 0x1c, 0x0, 0x0, 0xc8, 0x18, 0xfe, 0x38, 0x18, 0x68, 0x0, 0x0, 0x6, 0xfe, 0xc2, 0xc0, 
+0x7c, 0xfc, 0x0, 0x0, 0xc2, 0x7c, 0xc2, 0xc0, 0x7c, 0xfc, 0x0, 0x0, 0x18, 0xfe, 0x30, 0x6, 
+0x30, 0xc, 0x0, 0x0, 0xc2, 0x7c, 0xc2, 0xc2, 0x7c, 0x7c, 0x0, 0x0, 0x7e, 0x7c, 0x6, 0xc2, 
+0x7c, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 
+0x18, 0x18, 0x60, 0x0, 0x30, 0x0, 0x18, 0xc, 0xc, 0x18, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 
+0x0, 0x3e, 0x0, 0x0, 0xc, 0x0, 0x18, 0x30, 0x30, 0x18, 0x0, 0x0, 0x18, 0x7c, 0x0, 0xc2, 
+0x18, 0xc, 0x0, 0x4, 0x7c, 0xc9, 0xc2, 0xc9, 0x81, 0xc9, 0x35, 0x36, 0x0, 0xfe, 0x7c, 0xc2, 
+0xc2, 0xc2, 0xc2, 0x0, 0x0, 0xc2, 0xfc, 0xc2, 0xc2, 0xfc, 0xfc, 0x0, 0x0, 0xc0, 0x7c, 0xc2, 
+0xc2, 0x7c, 0xc0, 0x0, 0x0, 0xc2, 0xf8, 0xc4, 0xc4, 0xf8, 0xc2, 0x0, 0x0, 0xc0, 0xfe, 0xc0, 
+0xc0, 0xfe, 0xfc, 0x0, 0x0, 0xc0, 0xfe, 0xc0, 0xc0, 0xc0, 0xfc, 0x0, 0x0, 0xce, 0x7c, 0xc2, 
+0xc2, 0x7c, 0xc0, 0x0, 0x0, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xfe, 0x0, 0x0, 0x18, 0x7e, 0x18, 
+0x18, 0x7e, 0x18, 0x0, 0x0, 0xc2, 0x6, 0xc2, 0x6, 0x7c, 0x6, 0x0, 0x0, 0xc8, 0xc4, 0xc4, 
+0xc8, 0xc2, 0xf0, 0x0, 0x0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xc0, 0x0, 0x0, 0xc2, 0xc2, 0xc2, 
+0xe6, 0xc2, 0xda, 0x0, 0x0, 0xca, 0xc2, 0xc6, 0xe2, 0xc2, 0xd2, 0x0, 0x0, 0xc2, 0x7c, 0xc2, 
+0xc2, 0x7c, 0xc2, 0x0, 0x5, 0x0, 0xfc, 0xfc, 0xc0, 0xc2, 0xc0, 0xc2, 0x0, 0x0, 0xd2, 0x7c, 
+0xca, 0xc2, 0x7c, 0xc2, 0x2, 0x0, 0xfc, 0xfc, 0xc4, 0xc2, 0xc2, 0xc2, 0x0, 0x0, 0x6, 0x7e, 
+0xc2, 0xc0, 0x7c, 0x7c, 0x0, 0x0, 0x30, 0xfe, 0x30, 0x30, 0x30, 0x30, 0x0, 0x0, 0xc2, 0xc2, 
+0xc2, 0xc2, 0x7c, 0xc2, 0x0, 0x0, 0xc2, 0xc2, 0x64, 0xc2, 0x38, 0xc2, 0x0, 0x0, 0xc2, 0xc2, 
+0xda, 0xc2, 0x64, 0xc2, 0x0, 0x0, 0x38, 0xc2, 0x64, 0x64, 0xc2, 0x38, 0x0, 0x0, 0x30, 0x82, 
+0x30, 0xc4, 0x30, 0x68, 0x0, 0x0, 0x30, 0xfe, 0x60, 0xc, 0xfe, 0x18, 0x0, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0, 0xff, 0x0, 
+0xff, 0xff, 0x0, 0xff, 0x0, 0x0, 0x8, 0x8, 0x8, 0x1c, 0x8, 0x2a, 0x0, 0xf, 0xf, 0xf, 
+0xf, 0xf, 0xf, 0xf, 0xf, 0x6, 0x7e, 0xa1, 0x81, 0x99, 0x99, 0x81, 0xa1, 0x7e, 0x0, 0x7c, 
+0x0, 0xc4, 0x78, 0x7c, 0xc, 0x0, 0x0, 0x64, 0x60, 0x64, 0x60, 0x78, 0x78, 0x0, 0x0, 0x60, 
+0x0, 0x60, 0x3c, 0x3c, 0x60, 0x0, 0x0, 0xc4, 0xc, 0xc4, 0xc, 0x7c, 0x7c, 0x0, 0x0, 0xf8, 
+0x0, 0xc0, 0x78, 0x7c, 0xc4, 0x0, 0x0, 0x38, 0x1c, 0x30, 0x30, 0x30, 0x30, 0x0, 0x0, 0xc4, 
+0x0, 0x7c, 0x7c, 0xc, 0xc4, 0x78, 0x0, 0xc4, 0xc0, 0xc4, 0xc0, 0xc4, 0xf8, 0x0, 0x0, 0x30, 
+0x30, 0x30, 0x0, 0x78, 0x70, 0x0, 0x0, 0xc, 0xc, 0xc, 0x0, 0x64, 0xc, 0x38, 0x0, 0x70, 
+0x60, 0x68, 0x68, 0x64, 0x70, 0x0, 0x0, 0x30, 0x30, 0x30, 0x30, 0x1c, 0x30, 0x0, 0x0, 0xd4, 
+0x0, 0xd4, 0xe8, 0xd4, 0xd4, 0x0, 0x0, 0xc4, 0x0, 0xc4, 0xf8, 0xc4, 0xc4, 0x0, 0x0, 0xc4, 
+0x0, 0xc4, 0x78, 0x78, 0xc4, 0x0, 0x7, 0x0, 0xc4, 0x0, 0xf8, 0xf8, 0xc0, 0xc4, 0xc0, 0x0, 
+0xc4, 0x0, 0x7c, 0x7c, 0xc, 0xc4, 0xe, 0x0, 0x60, 0x0, 0x60, 0x3c, 0x60, 0x60, 0x0, 0x0, 
+0x78, 0x0, 0xc, 0x7c, 0xf8, 0xc0, 0x0, 0x0, 0x30, 0x30, 0x30, 0x78, 0x1c, 0x30, 0x0, 0x0, 
+0xc4, 0x0, 0xc4, 0xc4, 0x78, 0xc4, 0x0, 0x0, 0x68, 0x0, 0x68, 0xc4, 0x30, 0xc4, 0x0, 0x0, 
+0xd4, 0x0, 0xd4, 0xc4, 0x68, 0xd4, 0x0, 0x0, 0x30, 0x0, 0x68, 0xc4, 0xc4, 0x68, 0x0, 0x0, 
+0xc4, 0x0, 0x7c, 0xc4, 0xc, 0xc4, 0x78, 0x0, 0x30, 0x0, 0x60, 0xfc, 0xfc, 0x18, 0x0, 0x28, 
+0x7c, 0x0, 0xc4, 0x78, 0x7c, 0xc, 0x0, 0x28, 0xc4, 0x0, 0xc4, 0x78, 0x78, 0xc4, 0x0, 0x28, 
+0xc4, 0x0, 0xc4, 0xc4, 0x78, 0xc4, 0x0, 0x0, 0x64, 0x38, 0x78, 0x64, 0x60, 0x78, 0x60, 0xff, 
+0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xff, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x22, 0x1a, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe, 0xe, 
+0xe, 0x57, 0x45, 0x4c, 0x4c, 0x0, 0x44, 0x4f, 0x4e, 0x45, 0xc, 0x0, 0x50, 0x4c, 0x45, 0x41, 
+0x53, 0x45, 0x0, 0x45, 0x4e, 0x54, 0x45, 0x52, 0x0, 0x59, 0x4f, 0x55, 0x52, 0x0, 0x4e, 0x41, 
+0x4d, 0x45, 0x0, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf, 0x99, 
+0x0, 0x50, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x8, 0x9, 0xa, 0xb, 0xa, 
+0xd, 0xc, 0xd, 0xe, 0xf, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 
+0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x2, 0x3, 
+0x2, 0x0, 0x0, 0x2, 0x3, 0x2, 0x0, 0x2, 0x3, 0x2, 0x0, 0xd5, 0x11, 0x60, 0x0, 0x19, 
+0xd1, 0x3a, 0xf3, 0x5, 0xc9, 0x21, 0x60, 0x0, 0x19, 0x54, 0x5d, 0x21, 0x90, 0x7, 0xc9, 0xd5, 
+0x11, 0x60, 0x0, 0x19, 0xd1, 0x32, 0xfb, 0x5, 0xc9, 0x28, 0x29, 0x27, 0x28, 0x33, 0x23, 0x2f, 
+0x32, 0x25, 0x0, 0x1a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x10, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe5, 0x2a, 
+0xfb, 0x5, 0xcd, 0x70, 0x29, 0x22, 0xfb, 0x5, 0xe1, 0xc9, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x2, 0xcd, 0x80, 0x14, 
+0xcd, 0x13, 0x21, 0xc9, 0xcd, 0xcd, 0x30, 0x3a, 0xfa, 0x5, 0xa7, 0xc2, 0xc1, 0x9, 0xcd, 0x14, 
+0x31, 0xc9, 0x21, 0x12, 0x1, 0x22, 0xfb, 0x5, 0x3e, 0x10, 0xcd, 0xd3, 0x14, 0x3e, 0x13, 0x32, 
+0xfb, 0x5, 0x3e, 0x10, 0xcd, 0xd3, 0x14, 0xc9, 0x24, 0x29, 0x27, 0x27, 0x25, 0x32, 0x3d, 0x3d, 
+0x3d, 0x3d, 0x3d, 0x3d, 0x30, 0x32, 0x25, 0x33, 0x33, 0x0, 0x21, 0x2e, 0x39, 0x0, 0x2b, 0x25, 
+0x39, 0x0, 0x34, 0x2f, 0x0, 0x22, 0x25, 0x27, 0x29, 0x2e, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x12, 0xf5, 0xc5, 0xe5, 0x97, 0x21, 0x0, 0x80, 0x1, 0x28, 0x0, 0x77, 0x23, 0x10, 0xfc, 
+0xd, 0xc2, 0xa, 0xa, 0x3a, 0x86, 0x9, 0x21, 0x0, 0xa8, 0x1, 0xa, 0x0, 0x77, 0x23, 0x10, 
+0xfc, 0xd, 0xc2, 0x1b, 0xa, 0xe1, 0xc1, 0xf1, 0xc9, 0xd9, 0x47, 0x26, 0x0, 0x87, 0x87, 0x80, 
+0x87, 0x87, 0xcb, 0x14, 0x87, 0xcb, 0x14, 0x6f, 0x11, 0x0, 0xd, 0x19, 0x3a, 0xfb, 0x5, 0x87, 
+0xd6, 0x20, 0xd2, 0x51, 0xa, 0xc6, 0x20, 0x5f, 0x3a, 0xfc, 0x5, 0x87, 0xf6, 0x80, 0x57, 0x7b, 
+0xc3, 0x65, 0xa, 0x5f, 0x3a, 0xfc, 0x5, 0x47, 0xcb, 0x2f, 0xf6, 0xa0, 0xe6, 0xa6, 0x57, 0x78, 
+0x87, 0x87, 0x87, 0x83, 0xe6, 0x1f, 0x5f, 0xd5, 0x6, 0x20, 0xe, 0xff, 0xed, 0xa0, 0xed, 0xa0, 
+0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 
+0xed, 0xa0, 0x13, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 
+0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0xcb, 0xc2, 0x80, 0x5f, 0xed, 
+0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 
+0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 
+0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0xc1, 0xcb, 0x68, 
+0xc2, 0xe0, 0xa, 0x97, 0xcb, 0x38, 0xcb, 0x38, 0xcb, 0x1f, 0x81, 0x5f, 0x78, 0xf6, 0xa8, 0x57, 
+0xc3, 0xef, 0xa, 0x97, 0xcb, 0x38, 0xcb, 0x38, 0xcb, 0x1f, 0x81, 0x5f, 0x78, 0xf6, 0xb0, 0xe6, 
+0xb1, 0x57, 0x7b, 0x6, 0x20, 0xe, 0xff, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 
+0xa0, 0x80, 0x5f, 0x14, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x8, 0xd9, 
+0xc9, 0xd9, 0x47, 0x26, 0x0, 0x87, 0x87, 0x80, 0x87, 0x87, 0xcb, 0x14, 0x87, 0xcb, 0x14, 0x6f, 
+0x11, 0x80, 0xf, 0x19, 0x3a, 0xfb, 0x5, 0x87, 0xd6, 0x20, 0xd2, 0x37, 0xb, 0xc6, 0x20, 0x5f, 
+0x3a, 0xfc, 0x5, 0x87, 0xf6, 0x80, 0x57, 0x7b, 0xc3, 0x4b, 0xb, 0x5f, 0x3a, 0xfc, 0x5, 0x47, 
+0xcb, 0x2f, 0xf6, 0xa0, 0xe6, 0xa6, 0x57, 0x78, 0x87, 0x87, 0x87, 0x83, 0xe6, 0x1f, 0x5f, 0xd5, 
+0x6, 0x20, 0xe, 0xff, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 
+0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 
+0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 
+0xed, 0xa0, 0xcb, 0xc2, 0x15, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 
+0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 
+0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 
+0x5f, 0xed, 0xa0, 0xed, 0xa0, 0xc1, 0xcb, 0x68, 0xc2, 0xc6, 0xb, 0x97, 0xcb, 0x38, 0xcb, 0x38, 
+0xcb, 0x1f, 0x81, 0x5f, 0x78, 0xf6, 0xa8, 0x57, 0xc3, 0xd5, 0xb, 0x97, 0xcb, 0x38, 0xcb, 0x38, 
+0xcb, 0x1f, 0x81, 0x5f, 0x78, 0xf6, 0xb0, 0xe6, 0xb1, 0x57, 0x7b, 0x6, 0x20, 0xe, 0xff, 0xed, 
+0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 
+0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x8, 0xd9, 0xc9, 0xd9, 0x47, 0x26, 0x0, 0x87, 0x87, 0x80, 0x87, 
+0x87, 0xcb, 0x14, 0x87, 0xcb, 0x16, 0x14, 0x6f, 0x11, 0x0, 0x12, 0x19, 0x3a, 0xfb, 0x5, 0x87, 
+0xd6, 0x20, 0xd2, 0x1d, 0xc, 0xc6, 0x20, 0x5f, 0x3a, 0xfc, 0x5, 0x87, 0xf6, 0x80, 0x57, 0x7b, 
+0xc3, 0x31, 0xc, 0x5f, 0x3a, 0xfc, 0x5, 0x47, 0xcb, 0x2f, 0xf6, 0xa0, 0xe6, 0xa6, 0x57, 0x78, 
+0x87, 0x87, 0x87, 0x83, 0xe6, 0x1f, 0x5f, 0xd5, 0x6, 0x20, 0xe, 0xff, 0xed, 0xa0, 0xed, 0xa0, 
+0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 
+0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 
+0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0xcb, 0xc2, 0x80, 0x5f, 0xed, 0xa0, 
+0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 
+0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0x17, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 
+0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0xc1, 0xcb, 0x68, 
+0xc2, 0xac, 0xc, 0x97, 0xcb, 0x38, 0xcb, 0x38, 0xcb, 0x1f, 0x81, 0x5f, 0x78, 0xf6, 0xa8, 0x57, 
+0xc3, 0xbb, 0xc, 0x97, 0xcb, 0x38, 0xcb, 0x38, 0xcb, 0x1f, 0x81, 0x5f, 0x78, 0xf6, 0xb0, 0xe6, 
+0xb1, 0x57, 0x7b, 0x6, 0x20, 0xe, 0xff, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 
+0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x80, 0x5f, 0xed, 0xa0, 0xed, 0xa0, 0x8, 0xd9, 0xc9, 
+0x2e, 0x25, 0x37, 0x0, 0x27, 0x21, 0x2d, 0x25, 0x0, 0x1f, 0x0, 0x8, 0x39, 0xf, 0x2e, 0x9, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x3f, 0xf8, 0xff, 0xfa, 0x3d, 0x68, 0x3, 0x80, 0x7f, 0xfc, 0xff, 0xee, 0x17, 0xb0, 
+0xf, 0xe0, 0x7f, 0xfc, 0x7f, 0xf4, 0xe, 0xe0, 0x1f, 0xf0, 0xff, 0xfe, 0x7f, 0xdc, 0x3, 0x80, 
+0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x96, 0xaa, 0xb, 0x14, 0x51, 0x54, 0xaa, 0x8c, 
+0x55, 0x55, 0x95, 0x54, 0x2d, 0xaa, 0x22, 0x2d, 0xe2, 0x82, 0x55, 0x6c, 0x68, 0xb6, 0x99, 0x72, 
+0x6a, 0xe1, 0xa8, 0x65, 0xa3, 0x5d, 0xd, 0x53, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 
+0x3e, 0x7c, 0x9, 0x90, 0x7, 0xe0, 0x7, 0xe0, 0x19, 0x3, 0xc0, 0x9, 0x90, 0x3f, 0xfc, 0x1f, 
+0xf8, 0x5, 0xa0, 0x4, 0x20, 0x27, 0xe4, 0x18, 0x18, 0xb, 0xd0, 0x3, 0xc0, 0x77, 0xee, 0x78, 
+0x1e, 0x10, 0x10, 0x10, 0x10, 0x70, 0x70, 0x68, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x1f, 0xf0, 0xff, 0xfe, 0x1f, 0xf0, 0x3, 0x80, 0x3f, 0xf8, 0xff, 0xfe, 0x8, 
+0x20, 0x7, 0xc0, 0x7f, 0xfc, 0x40, 0x4, 0x7, 0xc0, 0x8, 0x20, 0xc0, 0x2, 0x3f, 0xf8, 0x3, 
+0x80, 0xb0, 0xb0, 0xd0, 0xd0, 0xb0, 0xb0, 0xd0, 0xd0, 0xc, 0xfe, 0xcd, 0xee, 0xfc, 0xfe, 0xec, 
+0xf7, 0xee, 0xfc, 0xef, 0xcc, 0xfe, 0xfc, 0xce, 0xe7, 0x1a, 0xcc, 0x7e, 0xca, 0xae, 0x5c, 0xaa, 
+0xe4, 0xf2, 0xee, 0x0, 0x0, 0xc, 0xe, 0x0, 0x40, 0x20, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 
+0x38, 0x38, 0x3e, 0x7c, 0x9, 0x90, 0x7, 0xe0, 0x7, 0xe0, 0x3, 0xc0, 0x9, 0x90, 0x3f, 0xfc, 
+0x1f, 0xf8, 0x5, 0xa0, 0x4, 0x20, 0x27, 0xe4, 0x18, 0x18, 0xb, 0xd0, 0x3, 0xc0, 0x77, 0xee, 
+0x78, 0x1e, 0x10, 0x10, 0x10, 0x10, 0x70, 0x70, 0x68, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xcc, 0x1f, 
+0xf8, 0x1f, 0xf8, 0x0, 0x0, 0x33, 0xcc, 0x27, 0xe4, 0x1f, 0xf8, 0xc, 0x30, 0xf, 0xf0, 0x1f, 
+0xf8, 0x18, 0x18, 0xf, 0xf0, 0x0, 0x0, 0x7, 0xe0, 0x78, 0x1e, 0x50, 0x50, 0x50, 0x50, 0x28, 
+0x28, 0x18, 0x18, 0x3e, 0x7c, 0x9, 0x90, 0x7, 0xe0, 0x7, 0xe0, 0x3, 0xc0, 0x9, 0x90, 0x3f, 
+0xfc, 0x1f, 0xf8, 0x5, 0xa0, 0x4, 0x20, 0x27, 0xe4, 0x18, 0x18, 0xb, 0xd0, 0x3, 0xc0, 0x77, 
+0xee, 0x78, 0x1e, 0x10, 0x10, 0x10, 0x10, 0x70, 0x70, 0x68, 0x68, 0x80, 0x1, 0x58, 0x1a, 0x55, 
+0xaa, 0x5f, 0xfa, 0x7f, 0xfe, 0x57, 0xea, 0x56, 0x6a, 0x60, 0x6, 0x60, 0x6, 0x56, 0x6a, 0x57, 
+0xea, 0x7f, 0xfe, 0x5f, 0xfa, 0x55, 0xaa, 0x58, 0x1a, 0x80, 0x1, 0x1c, 0x21, 0x21, 0x21, 0x21, 
+0x21, 0x21, 0x21, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe7, 0xe7, 0x3c, 0x3c, 
+0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0x3c, 0x3c, 0xcb, 0xcb, 0xff, 0xff, 0x7e, 0x7e, 0x7e, 0x7e, 
+0xc3, 0xc3, 0x7e, 0x7e, 0xbc, 0xbc, 0xff, 0xff, 0xc3, 0xc3, 0xbc, 0xbc, 0xf, 0xf, 0xf, 0xf, 
+0xf, 0xf, 0xf, 0xf, 0x3e, 0x7c, 0x9, 0x90, 0x7, 0xe0, 0x7, 0xe0, 0x3, 0xc0, 0x9, 0x90, 
+0x3f, 0xfc, 0x1f, 0xf8, 0x5, 0xa0, 0x4, 0x20, 0x27, 0xe4, 0x18, 0x18, 0xb, 0xd0, 0x3, 0xc0, 
+0x77, 0xee, 0x78, 0x1e, 0x10, 0x10, 0x10, 0x10, 0x70, 0x70, 0x68, 0x68, 0x1d, 0x0, 0x0, 0x33, 
+0xcc, 0x1f, 0xf8, 0x1f, 0xf8, 0x0, 0x0, 0x33, 0xcc, 0x27, 0xe4, 0x1f, 0xf8, 0xc, 0x30, 0xf, 
+0xf0, 0x1f, 0xf8, 0x18, 0x18, 0xf, 0xf0, 0x0, 0x0, 0x7, 0xe0, 0x78, 0x1e, 0x50, 0x50, 0x50, 
+0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0x33, 0xcc, 0x1f, 0xf8, 0x1f, 0xf8, 0x0, 0x0, 0x33, 
+0xcc, 0x27, 0xe4, 0x1f, 0xf8, 0xc, 0x30, 0xf, 0xf0, 0x1f, 0xf8, 0x78, 0x18, 0xf, 0xf0, 0x0, 
+0x0, 0x7, 0xe0, 0x0, 0x1e, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0x3f, 
+0xfc, 0x1f, 0xf8, 0x1f, 0xf8, 0x0, 0x0, 0x33, 0xcc, 0x27, 0xe4, 0x1f, 0xf8, 0xc, 0x30, 0xf, 
+0xf0, 0x1f, 0xf8, 0x18, 0x18, 0xf, 0xf0, 0x0, 0x0, 0x7, 0xe0, 0x78, 0x1e, 0x50, 0x50, 0x50, 
+0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0x3f, 0xfc, 0x1f, 0xf8, 0x1f, 0xf8, 0x1e, 0x0, 0x0, 
+0x3f, 0xfc, 0x27, 0xe4, 0x1f, 0xf8, 0xc, 0x30, 0xf, 0xf0, 0x1f, 0xf8, 0x18, 0x18, 0xf, 0xf0, 
+0x0, 0x0, 0x7, 0xe0, 0x78, 0x1e, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 
+0x33, 0xcc, 0x1f, 0xf8, 0x1f, 0xf8, 0x0, 0x0, 0x33, 0xcc, 0x27, 0xe6, 0x1f, 0xf8, 0xc, 0x30, 
+0xf, 0xf0, 0x1f, 0xe0, 0x78, 0x18, 0xf, 0xf0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x1e, 0x50, 0x50, 
+0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0x33, 0xcc, 0x1f, 0xf8, 0x1f, 0xf8, 0x0, 0x0, 
+0x33, 0xcc, 0x67, 0xe4, 0x1f, 0xf8, 0xc, 0x30, 0xf, 0xf0, 0x7, 0xf8, 0x18, 0x1e, 0xf, 0xf0, 
+0x0, 0x0, 0x7, 0xe0, 0x78, 0x0, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 
+0x3f, 0xfc, 0x1f, 0xf8, 0x1f, 0xf8, 0x0, 0x0, 0x3f, 0xfc, 0x27, 0xe6, 0x1f, 0xf8, 0x1f, 0xc, 
+0x30, 0xf, 0xf0, 0x1f, 0xe0, 0x78, 0x18, 0xf, 0xf0, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x1e, 0x50, 
+0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0x3f, 0xfc, 0x1f, 0xf8, 0x1f, 0xf8, 0x0, 
+0x0, 0x3f, 0xfc, 0x67, 0xe4, 0x1f, 0xf8, 0xc, 0x30, 0xf, 0xf0, 0x7, 0xf8, 0x18, 0x1e, 0xf, 
+0xf0, 0x0, 0x0, 0x7, 0xe0, 0x78, 0x0, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 
+0x0, 0xf, 0xcc, 0x3, 0xc0, 0x2, 0x0, 0x3, 0xc0, 0xf, 0xf0, 0x3, 0xf0, 0x2, 0x0, 0xf, 
+0xf0, 0x3, 0xc0, 0x3, 0xc0, 0x2, 0x0, 0xf, 0xcc, 0x0, 0x0, 0x3, 0xc0, 0x3, 0xc0, 0x50, 
+0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0xf, 0xcc, 0x3, 0xc0, 0xf, 0x80, 0x3, 
+0xc0, 0xf, 0xf0, 0x3, 0xf0, 0x8, 0x80, 0xf, 0xf0, 0x3, 0xc0, 0x3, 0xc0, 0x8, 0x80, 0x20, 
+0xf, 0xcc, 0x0, 0x0, 0x3, 0xc0, 0x8, 0xf0, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 
+0x0, 0x0, 0xf, 0xcc, 0x3, 0xc0, 0x3f, 0xc0, 0x0, 0x0, 0xf, 0xcc, 0x3, 0xf0, 0x20, 0x20, 
+0x3, 0xc0, 0xf, 0xf0, 0x3, 0xc0, 0x20, 0x20, 0xf, 0xf0, 0x0, 0x0, 0x3, 0xc0, 0x20, 0x3c, 
+0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0xf, 0xcc, 0x3, 0xc0, 0xff, 0xf0, 
+0x0, 0x0, 0xf, 0xcc, 0x3, 0xf0, 0x80, 0x8, 0x3, 0xc0, 0xf, 0xf0, 0x3, 0xc0, 0x80, 0x8, 
+0xf, 0xf0, 0x0, 0x0, 0x3, 0xc0, 0x80, 0xf, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 
+0x0, 0x0, 0x33, 0xf0, 0x3, 0xc0, 0x0, 0x40, 0x3, 0xc0, 0xf, 0xf0, 0xf, 0xc0, 0x0, 0x40, 
+0xf, 0xf0, 0x3, 0xc0, 0x3, 0xc0, 0x0, 0x40, 0x33, 0xf0, 0x0, 0x0, 0x3, 0xc0, 0x3, 0xc0, 
+0x21, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0x33, 0xf0, 0x3, 0xc0, 0x1, 
+0xf0, 0x3, 0xc0, 0xf, 0xf0, 0xf, 0xc0, 0x1, 0x10, 0xf, 0xf0, 0x3, 0xc0, 0x3, 0xc0, 0x1, 
+0x10, 0x33, 0xf0, 0x0, 0x0, 0x3, 0xc0, 0xf, 0x10, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 
+0x18, 0x0, 0x0, 0x33, 0xf0, 0x3, 0xc0, 0x3, 0xfc, 0x0, 0x0, 0x33, 0xf0, 0xf, 0xc0, 0x4, 
+0x4, 0x3, 0xc0, 0xf, 0xf0, 0x3, 0xc0, 0x4, 0x4, 0xf, 0xf0, 0x0, 0x0, 0x3, 0xc0, 0x3c, 
+0x4, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 0x18, 0x0, 0x0, 0x33, 0xf0, 0x3, 0xc0, 0xf, 
+0xff, 0x0, 0x0, 0x33, 0xf0, 0xf, 0xc0, 0x10, 0x1, 0x3, 0xc0, 0xf, 0xf0, 0x3, 0xc0, 0x10, 
+0x1, 0xf, 0xf0, 0x0, 0x0, 0x3, 0xc0, 0xf0, 0x1, 0x50, 0x50, 0x50, 0x50, 0x28, 0x28, 0x18, 
+0x18, 0x22, 0x3e, 0x7c, 0x9, 0x90, 0x7, 0xe0, 0x7, 0xe0, 0x3, 0xc0, 0x9, 0x90, 0x3f, 0xfc, 
+0x1f, 0xf8, 0x5, 0xa0, 0x4, 0x20, 0x27, 0xe4, 0x18, 0x18, 0xb, 0xd0, 0x3, 0xc0, 0x77, 0xee, 
+0x78, 0x1e, 0x10, 0x10, 0x10, 0x10, 0x70, 0x70, 0x68, 0x68, 0x3e, 0x7c, 0xf, 0xf0, 0x7, 0xe0, 
+0x7, 0xe0, 0x3, 0xc0, 0xf, 0xf0, 0x3f, 0xfc, 0x1f, 0xf8, 0x7, 0xe0, 0x7, 0xe0, 0x27, 0xe4, 
+0x18, 0x18, 0xf, 0xf0, 0x3, 0xc0, 0x77, 0xee, 0x78, 0x1e, 0x10, 0x10, 0x10, 0x10, 0x70, 0x70, 
+0x68, 0x68, 0xf0, 0x0, 0x33, 0x6, 0xf, 0x80, 0xf, 0x80, 0xc, 0x0, 0x30, 0x0, 0x7f, 0xf0, 
+0x3f, 0xe0, 0x3b, 0xf8, 0x30, 0x0, 0x4f, 0x90, 0x30, 0x60, 0x3f, 0x1e, 0x3e, 0x0, 0xef, 0xb8, 
+0xf0, 0x78, 0x10, 0x58, 0x10, 0x58, 0x70, 0x70, 0x68, 0x68, 0x0, 0xf, 0x60, 0xcc, 0x1, 0xf0, 
+0x1, 0xf0, 0x23, 0x0, 0x30, 0x0, 0xc, 0xf, 0xfe, 0x7, 0xfc, 0x1f, 0xdc, 0x0, 0xc, 0x9, 
+0xf2, 0x6, 0xc, 0x78, 0xfc, 0x0, 0x7c, 0x1d, 0xf7, 0x1e, 0xf, 0x58, 0x10, 0x58, 0x10, 0x70, 
+0x70, 0x68, 0x68, 0x0, 0x0, 0x2, 0xc0, 0x3e, 0xf8, 0x1a, 0xdc, 0x1, 0xc0, 0x1f, 0xfc, 0x2, 
+0xc0, 0x37, 0xee, 0x2, 0xc0, 0x2f, 0xfc, 0x2, 0xc0, 0x5d, 0xbf, 0x2, 0xc0, 0x31, 0xc4, 0xf, 
+0xf8, 0x0, 0x0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x24, 0x3e, 0x39, 0x32, 0x86, 0x9, 0xcd, 0x0, 0xa, 0xcd, 0x95, 0x38, 0xc9, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x3a, 0xa9, 0x9, 0xa7, 0xca, 0x2c, 0x13, 0x97, 0x32, 0xf8, 0x5, 0xc9, 
+0x3a, 0xf8, 0x5, 0xe6, 0x1, 0x32, 0xf8, 0x5, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0xc2, 0x80, 0x31, 0xcd, 0x65, 0x3d, 0xcd, 0x65, 0x3d, 0xcd, 0x96, 0x18, 
+0xc3, 0x92, 0x31, 0x0, 0xcd, 0x96, 0x18, 0x1, 0x0, 0x78, 0x21, 0xa, 0x5, 0x7e, 0xe6, 0xf0, 
+0xfe, 0x80, 0xc2, 0x65, 0x13, 0x7e, 0xe6, 0xf, 0x77, 0x7e, 0xe6, 0xf, 0xfe, 0x8, 0xc2, 0x71, 
+0x13, 0x7e, 0xe6, 0xf0, 0x77, 0x23, 0x5, 0xc2, 0x59, 0x13, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x25, 0xcd, 0x4, 0x18, 0xcd, 0x98, 0x14, 0xc9, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0xcd, 0x0, 0xa, 0x3e, 0x5, 0xd3, 0x8e, 0x3e, 0x21, 0xd3, 
+0x8e, 0xcd, 0xf9, 0x3b, 0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0x8, 0xd9, 0x11, 0x0, 0x5, 0x2a, 0xe3, 0x5, 0x1, 
+0x8c, 0x0, 0xed, 0xb0, 0x11, 0xe0, 0x5, 0x1, 0x10, 0x0, 0xed, 0xb0, 0x8, 0xd9, 0xc9, 0xf5, 
+0xc5, 0xd5, 0xe5, 0x21, 0x0, 0x5, 0x11, 0x0, 0x2, 0x1, 0x14, 0xe, 0x7e, 0x7, 0x7, 0x7, 
+0x7, 0xe6, 0xf, 0xed, 0x53, 0xfb, 0x5, 0xcd, 0x27, 0xa, 0xd, 0x1c, 0x7e, 0xe6, 0xf, 0xed, 
+0x53, 0xfb, 0x5, 0xcd, 0x27, 0xa, 0x23, 0x1c, 0xd, 0xc2, 0xa5, 0x14, 0xe, 0x14, 0x1e, 0x0, 
+0x14, 0x5, 0xc2, 0xa5, 0x14, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xd9, 0x26, 0x0, 0x87, 0xcb, 0x14, 
+0x87, 0xcb, 0x14, 0x87, 0xcb, 0x14, 0x6f, 0x7c, 0xc6, 0x2, 0x67, 0x3a, 0xfb, 0x5, 0xd6, 0x20, 
+0xd2, 0x2, 0x15, 0xc6, 0x20, 0x4f, 0x3a, 0xfc, 0x5, 0x47, 0xf, 0xf, 0xe6, 0x40, 0x81, 0x5f, 
+0x78, 0xe6, 0x9e, 0xf6, 0x80, 0x57, 0xc3, 0x28, 0x1e, 0x15, 0x1e, 0x0, 0x4f, 0x3a, 0xfc, 0x5, 
+0x47, 0xf, 0xcb, 0x1b, 0xcb, 0x3b, 0x87, 0x87, 0x87, 0xe6, 0x18, 0x83, 0x81, 0x5f, 0x78, 0xf, 
+0xf, 0xe6, 0x6, 0xf6, 0xa0, 0x57, 0x7b, 0xed, 0xa0, 0xc6, 0x20, 0x5f, 0xed, 0xa0, 0xc6, 0x60, 
+0x5f, 0xed, 0xa0, 0xc6, 0x20, 0x5f, 0xed, 0xa0, 0xcb, 0xc2, 0xc6, 0x60, 0x5f, 0xed, 0xa0, 0xc6, 
+0x20, 0x5f, 0xed, 0xa0, 0xc6, 0x60, 0x5f, 0xed, 0xa0, 0xc6, 0x20, 0x5f, 0xed, 0xa0, 0xd9, 0xc9, 
+0xd9, 0x47, 0x3a, 0xfb, 0x5, 0xd6, 0x20, 0xd2, 0x71, 0x15, 0x2e, 0x0, 0xc6, 0x20, 0x4f, 0x3a, 
+0xfc, 0x5, 0xcb, 0x2f, 0xcb, 0x1d, 0xcb, 0x2f, 0xcb, 0x1d, 0xcb, 0x2f, 0xcb, 0x1d, 0xe6, 0xaf, 
+0xf6, 0xa8, 0x67, 0x7d, 0x81, 0x6f, 0xc3, 0xa2, 0x15, 0x4f, 0x16, 0x0, 0x5a, 0x3a, 0xfc, 0x5, 
+0xcb, 0x2f, 0xcb, 0x1a, 0xcb, 0x2f, 0xcb, 0x1a, 0x29, 0xb7, 0xcb, 0x1a, 0xcb, 0x2f, 0xcb, 0x1b, 
+0xcb, 0x2f, 0xcb, 0x1b, 0xb7, 0xcb, 0x1b, 0xcb, 0x1b, 0xcb, 0x2f, 0xcb, 0x1b, 0xcb, 0x2f, 0xcb, 
+0x14, 0x7b, 0x82, 0x81, 0x6f, 0x7c, 0xe6, 0x1, 0xf6, 0xb0, 0x67, 0x70, 0xd9, 0xc9, 0xf5, 0xc5, 
+0xd5, 0xe5, 0x7e, 0xcd, 0x48, 0x15, 0x23, 0xb, 0x78, 0xb1, 0xca, 0xd1, 0x15, 0x3a, 0xfb, 0x5, 
+0xd6, 0x27, 0xca, 0xc4, 0x15, 0xc6, 0x28, 0x32, 0xfb, 0x5, 0xc3, 0xa9, 0x15, 0x32, 0xfb, 0x5, 
+0x3a, 0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x5, 0xc3, 0xa9, 0x15, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xf5, 
+0xc5, 0xd5, 0xe5, 0x7e, 0xcd, 0xd3, 0x14, 0x23, 0xb, 0x78, 0xb1, 0xca, 0x2, 0x16, 0x3a, 0xfb, 
+0x5, 0xd6, 0x27, 0xca, 0xf5, 0x15, 0xc6, 0x28, 0x32, 0xfb, 0x5, 0xc3, 0xda, 0x15, 0x32, 0xfb, 
+0x5, 0x3a, 0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x5, 0xc3, 0x2a, 0xda, 0x15, 0xe1, 0xd1, 0xc1, 0xf1, 
+0xc9, 0xc5, 0x47, 0xe6, 0xf0, 0x3c, 0x7, 0x7, 0x7, 0x7, 0xcd, 0xd3, 0x14, 0x3a, 0xfb, 0x5, 
+0x3c, 0x32, 0xfb, 0x5, 0x78, 0xe6, 0xf, 0xc6, 0x10, 0xcd, 0xd3, 0x14, 0xc1, 0xc9, 0x3d, 0x3d, 
+0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 
+0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 
+0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x0, 0x32, 0x2f, 0x2f, 0x2d, 0x1a, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x34, 0x29, 0x2d, 0x25, 0x1a, 0x0, 0x0, 0x10, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 
+0x29, 0x21, 0x2d, 0x2f, 0x2e, 0x24, 0x33, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 
+0x29, 0x36, 0x25, 0x33, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x33, 0x2b, 0x23, 0x2f, 0x32, 0x25, 0x1a, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x2f, 0x2c, 0x2c, 0x25, 0x23, 0x34, 0x25, 
+0x24, 0x1a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 
+0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 
+0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2c, 0x29, 0x29, 0x29, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x2d, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 
+0x3a, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 
+0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x2e, 0x29, 0x29, 
+0x29, 0x29, 0xc5, 0xe5, 0xf5, 0x21, 0x0, 0x0, 0x22, 0xfb, 0x5, 0x21, 0xc4, 0x16, 0x1, 0x40, 
+0x1, 0xcd, 0xa5, 0x15, 0x21, 0x0, 0x0, 0x22, 0xfb, 0x5, 0x21, 0x24, 0x16, 0x1, 0xa0, 0x0, 
+0xcd, 0xd6, 0x15, 0x3e, 0x8, 0x32, 0xfb, 0x5, 0x3e, 0x1, 0x32, 0xfc, 0x5, 0x3a, 0xe0, 0x5, 
+0xcd, 0x7, 0x16, 0x3e, 0x14, 0x32, 0xfb, 0x5, 0x3a, 0x82, 0x8, 0xcd, 0x7, 0x16, 0x3e, 0x16, 
+0x32, 0xfb, 0x5, 0x3a, 0x81, 0x8, 0xcd, 0x7, 0x16, 0x3e, 0x24, 0x32, 0xfb, 0x5, 0x3a, 0xe7, 
+0x5, 0xcd, 0x7, 0x16, 0x3e, 0x8, 0x32, 0xfb, 0x5, 0x3e, 0x2, 0x32, 0xfc, 0x5, 0x3a, 0xf6, 
+0x5, 0xcd, 0x7, 0x16, 0x3e, 0x12, 0x32, 0xfb, 0x5, 0x3a, 0xf3, 0x5, 0xcd, 0x7, 0x16, 0x3e, 
+0x14, 0x32, 0xfb, 0x5, 0x3a, 0xf2, 0x5, 0xcd, 0x7, 0x16, 0x3e, 0x16, 0x32, 0xfb, 0x2f, 0x5, 
+0x3a, 0xf1, 0x5, 0xcd, 0x7, 0x16, 0x3e, 0x24, 0x32, 0xfb, 0x5, 0x3a, 0xf7, 0x5, 0xcd, 0x7, 
+0x16, 0xf1, 0xe1, 0xc1, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0x1, 0x0, 0x78, 0x11, 0xfd, 0x5, 0x21, 
+0xa, 0x5, 0x7e, 0xcb, 0x67, 0xca, 0xcb, 0x18, 0xcb, 0x6f, 0xc2, 0xcb, 0x18, 0xf5, 0xe5, 0x7d, 
+0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xca, 0xfb, 0x18, 0xd6, 0x10, 0xca, 0x16, 0x19, 0xd6, 0x40, 
+0xca, 0x16, 0x19, 0xd6, 0x90, 0xca, 0x71, 0x19, 0xe1, 0xf1, 0xcb, 0x47, 0xca, 0xf1, 0x18, 0xcb, 
+0x4f, 0xc2, 0xf1, 0x18, 0xf5, 0xe5, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xca, 0x90, 0x19, 
+0x3d, 0xca, 0xaa, 0x19, 0xd6, 0x4, 0xca, 0xaa, 0x19, 0xd6, 0x9, 0xca, 0xff, 0x19, 0xe1, 0xf1, 
+0x2c, 0x10, 0xaf, 0x97, 0x12, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xe1, 0x7d, 0x12, 0x13, 0xf1, 0x30, 
+0xf5, 0xcb, 0x77, 0xc2, 0xe, 0x19, 0x3e, 0x1, 0x12, 0x13, 0xf1, 0xc3, 0xcb, 0x18, 0x3e, 0x3, 
+0x12, 0x13, 0xf1, 0xc3, 0xcb, 0x18, 0x2d, 0x7e, 0xe6, 0xf, 0xc2, 0x42, 0x19, 0x7d, 0xd6, 0xa, 
+0x6f, 0x7e, 0xe6, 0xf, 0xc2, 0x42, 0x19, 0xe1, 0x7d, 0x12, 0x13, 0xf1, 0xf5, 0xcb, 0x77, 0xc2, 
+0x3a, 0x19, 0x3e, 0x9, 0x12, 0x13, 0xf1, 0xc3, 0xcb, 0x18, 0x3e, 0xb, 0x12, 0x13, 0xf1, 0xc3, 
+0xcb, 0x18, 0xe1, 0xe5, 0x7e, 0xe6, 0xf, 0xc2, 0xc9, 0x18, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 
+0xf, 0xc2, 0xc9, 0x18, 0xcb, 0xde, 0xe1, 0x7d, 0x12, 0x13, 0xf1, 0xf5, 0xcb, 0x77, 0xc2, 0x69, 
+0x19, 0x3e, 0x5, 0x12, 0x13, 0xf1, 0xc3, 0xcb, 0x18, 0x3e, 0x7, 0x12, 0x13, 0xf1, 0xc3, 0xcb, 
+0x18, 0xe1, 0xf1, 0xf5, 0xe5, 0xcb, 0x77, 0xc2, 0xc9, 0x18, 0x7d, 0xc6, 0x14, 0x6f, 0x7e, 0xe6, 
+0x31, 0xf0, 0xc2, 0xc9, 0x18, 0xe1, 0x7d, 0x12, 0x13, 0x3e, 0xd, 0x12, 0x13, 0xf1, 0xc3, 0xcb, 
+0x18, 0xe1, 0x7d, 0x12, 0x13, 0xf1, 0xf5, 0xcb, 0x57, 0xc2, 0xa2, 0x19, 0x97, 0x12, 0x13, 0xf1, 
+0xc3, 0xf1, 0x18, 0x3e, 0x2, 0x12, 0x13, 0xf1, 0xc3, 0xf1, 0x18, 0x7e, 0xe6, 0xf0, 0xc2, 0xd2, 
+0x19, 0x7d, 0xd6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xc2, 0xd2, 0x19, 0xe1, 0x7d, 0x12, 0x13, 0xf1, 
+0xcb, 0x57, 0xc2, 0xcb, 0x19, 0x3e, 0x8, 0x12, 0x13, 0xc3, 0xf1, 0x18, 0x3e, 0xa, 0x12, 0x13, 
+0xc3, 0xf1, 0x18, 0xe1, 0xe5, 0x2c, 0x7e, 0xe6, 0xf0, 0xc2, 0xef, 0x18, 0x7d, 0xc6, 0xa, 0x6f, 
+0x7e, 0xe6, 0xf0, 0xc2, 0xef, 0x18, 0xcb, 0xfe, 0xe1, 0x7d, 0x12, 0x13, 0xf1, 0xcb, 0x57, 0xc2, 
+0xf8, 0x19, 0x3e, 0x4, 0x12, 0x13, 0xc3, 0xf1, 0x18, 0x3e, 0x6, 0x12, 0x13, 0xc3, 0xf1, 0x18, 
+0xe1, 0x32, 0xf1, 0xf5, 0xe5, 0xcb, 0x57, 0xc2, 0xef, 0x18, 0x7d, 0xc6, 0x14, 0x6f, 0x7e, 0xe6, 
+0xf, 0xc2, 0xef, 0x18, 0xe1, 0x7d, 0x12, 0x13, 0x3e, 0xc, 0x12, 0x13, 0xf1, 0xc3, 0xf1, 0x18, 
+0xf5, 0xc5, 0xd5, 0xe5, 0x11, 0xfd, 0x5, 0x26, 0x5, 0x1a, 0xa7, 0xc2, 0x31, 0x1a, 0xe1, 0xd1, 
+0xc1, 0xf1, 0xc9, 0x6f, 0x6, 0x0, 0x4, 0xd6, 0xa, 0xd2, 0x34, 0x1a, 0xc6, 0xa, 0x4, 0x4f, 
+0x13, 0x1a, 0xf, 0x3f, 0x79, 0x8f, 0x32, 0xfb, 0x5, 0x78, 0x32, 0xfc, 0x5, 0x1a, 0x13, 0xf, 
+0xf, 0xda, 0x96, 0x1c, 0xf, 0xda, 0x71, 0x1b, 0xf, 0xda, 0xe1, 0x1a, 0x3a, 0xfb, 0x5, 0xf, 
+0xda, 0x99, 0x1a, 0xcb, 0xa6, 0x7d, 0xc6, 0xa, 0x6f, 0xcb, 0xe6, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 
+0xf0, 0xfe, 0xa0, 0xc2, 0x7f, 0x1a, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0xce, 
+0x1a, 0xfe, 0x33, 0x30, 0xc2, 0xce, 0x1a, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 
+0x4b, 0xfb, 0x5, 0x4, 0x4, 0xed, 0x43, 0x84, 0x8, 0xc3, 0xce, 0x1a, 0xcb, 0x86, 0x7d, 0xc6, 
+0xa, 0x6f, 0xcb, 0xc6, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 0xc2, 0xb7, 0x1a, 0x3a, 
+0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0xce, 0x1a, 0xfe, 0x3, 0xc2, 0xce, 0x1a, 0x3a, 
+0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 0x4, 0xed, 0x43, 0x84, 
+0x8, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x5, 0x3e, 0x1, 0xcd, 0x27, 
+0xa, 0xc3, 0x27, 0x1a, 0x3a, 0xfb, 0x5, 0xf, 0xda, 0x21, 0x1b, 0xcb, 0xa6, 0x7d, 0xc6, 0x9, 
+0x6f, 0xcb, 0xc6, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 0xc2, 0x6, 0x1b, 0x3a, 0xf8, 
+0x5, 0xf6, 0x1, 0x34, 0x32, 0xf8, 0x5, 0xc3, 0x57, 0x1b, 0xfe, 0x3, 0xc2, 0x57, 0x1b, 0x3a, 
+0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 0x4, 0xd, 0xed, 0x43, 
+0x84, 0x8, 0xc3, 0x57, 0x1b, 0xcb, 0x86, 0x7d, 0xc6, 0xa, 0x6f, 0xcb, 0xe6, 0xc6, 0xa, 0x6f, 
+0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0x3f, 0x1b, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 
+0xc3, 0x57, 0x1b, 0xfe, 0x30, 0xc2, 0x57, 0x1b, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 
+0xed, 0x4b, 0xfb, 0x5, 0x4, 0x4, 0xd, 0xed, 0x43, 0x84, 0x8, 0x97, 0xcd, 0x92, 0x20, 0x3a, 
+0xfb, 0x5, 0x3d, 0x32, 0xfb, 0x5, 0x3a, 0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x5, 0x3e, 0x1, 0xcd, 
+0x27, 0xa, 0xc3, 0x27, 0x1a, 0xf, 0xda, 0x9, 0x1c, 0x3a, 0xfb, 0x5, 0xf, 0xda, 0xb7, 0x1b, 
+0xcb, 0xa6, 0x7d, 0xc6, 0x35, 0xa, 0x6f, 0xcb, 0xc6, 0xcb, 0x9e, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 
+0xf, 0xfe, 0xa, 0xc2, 0x9c, 0x1b, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0xef, 
+0x1b, 0xfe, 0x3, 0xc2, 0xef, 0x1b, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 
+0xfb, 0x5, 0x4, 0x4, 0xc, 0xed, 0x43, 0x84, 0x8, 0xc3, 0xef, 0x1b, 0xcb, 0x86, 0x7d, 0xc6, 
+0xb, 0x6f, 0xcb, 0xe6, 0xcb, 0xbe, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0xd7, 
+0x1b, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0xef, 0x1b, 0xfe, 0x30, 0xc2, 0xef, 
+0x1b, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 0x4, 0xc, 
+0xed, 0x43, 0x84, 0x8, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfb, 0x5, 0x3c, 0x32, 0xfb, 0x5, 0x3a, 
+0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x36, 0x5, 0x3e, 0x1, 0xcd, 0x27, 0xa, 0xc3, 0x27, 0x1a, 0x3a, 
+0xfb, 0x5, 0xf, 0xda, 0x4a, 0x1c, 0xcb, 0xa6, 0x7d, 0xc6, 0x14, 0x6f, 0xcb, 0xe6, 0xcb, 0xf6, 
+0xc6, 0x6f, 0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0x2f, 0x1c, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 
+0xf8, 0x5, 0xc3, 0x82, 0x1c, 0xfe, 0x30, 0xc2, 0x82, 0x1c, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 
+0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 0x4, 0x4, 0xed, 0x43, 0x84, 0x8, 0xc3, 0x82, 0x1c, 
+0xcb, 0x86, 0x7d, 0xc6, 0x14, 0x6f, 0xcb, 0xc6, 0xcb, 0xd6, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 
+0xfe, 0xa, 0xc2, 0x6a, 0x1c, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0x82, 0x1c, 
+0xfe, 0x3, 0xc2, 0x82, 0x1c, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 
+0x5, 0x4, 0x4, 0x4, 0xed, 0x43, 0x37, 0x84, 0x8, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfc, 0x5, 
+0xc6, 0x2, 0x32, 0xfc, 0x5, 0x3e, 0x5, 0xcd, 0x27, 0xa, 0xc3, 0x27, 0x1a, 0xf, 0xda, 0xc5, 
+0x1d, 0xf, 0xda, 0x2d, 0x1d, 0x3a, 0xfb, 0x5, 0xf, 0xda, 0xe1, 0x1c, 0xcb, 0xa6, 0xcb, 0xb6, 
+0x7d, 0xc6, 0xa, 0x6f, 0xcb, 0xe6, 0xcb, 0xf6, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 
+0xc2, 0xc7, 0x1c, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0x1a, 0x1d, 0xfe, 0x30, 
+0xc2, 0x1a, 0x1d, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 
+0x4, 0xed, 0x43, 0x84, 0x8, 0xc3, 0x1a, 0x1d, 0xcb, 0x86, 0xcb, 0x96, 0x7d, 0xc6, 0xa, 0x6f, 
+0xcb, 0xc6, 0xcb, 0xd6, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 0xc2, 0x3, 0x1d, 0x3a, 
+0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x38, 0xc3, 0x1a, 0x1d, 0xfe, 0x3, 0xc2, 0x1a, 0x1d, 
+0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 0x4, 0xed, 0x43, 
+0x84, 0x8, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x5, 0x3e, 0x5, 0xcd, 
+0x27, 0xa, 0xc3, 0x27, 0x1a, 0x3a, 0xfb, 0x5, 0xf, 0xda, 0x71, 0x1d, 0xcb, 0xa6, 0xcb, 0xb6, 
+0x7d, 0xc6, 0x9, 0x6f, 0xcb, 0xc6, 0xcb, 0xd6, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 
+0xc2, 0x56, 0x1d, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0xab, 0x1d, 0xfe, 0x3, 
+0xc2, 0xab, 0x1d, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 
+0x4, 0xd, 0xed, 0x43, 0x84, 0x8, 0xc3, 0xab, 0x1d, 0xcb, 0x86, 0xcb, 0x96, 0x7d, 0xc6, 0xa, 
+0x6f, 0xcb, 0xe6, 0xcb, 0xf6, 0xc6, 0xa, 0x6f, 0x39, 0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0x93, 
+0x1d, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0xab, 0x1d, 0xfe, 0x30, 0xc2, 0xab, 
+0x1d, 0x3a, 0xf8, 0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 0x4, 0xd, 
+0xed, 0x43, 0x84, 0x8, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfb, 0x5, 0x3d, 0x32, 0xfb, 0x5, 0x3a, 
+0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x5, 0x3e, 0x5, 0xcd, 0x27, 0xa, 0xc3, 0x27, 0x1a, 0x3a, 0xfb, 
+0x5, 0xf, 0xda, 0xb, 0x1e, 0xcb, 0xa6, 0xcb, 0xb6, 0x7d, 0xc6, 0xa, 0x6f, 0xcb, 0xc6, 0xcb, 
+0xd6, 0xcb, 0x9e, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 0xc2, 0xf0, 0x1d, 0x3a, 0xf8, 
+0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0x47, 0x1e, 0xfe, 0x3, 0xc2, 0x47, 0x1e, 0x3a, 0xf8, 
+0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x3a, 0x5, 0x4, 0x4, 0xc, 0xed, 0x43, 
+0x84, 0x8, 0xc3, 0x47, 0x1e, 0xcb, 0x86, 0xcb, 0x96, 0x7d, 0xc6, 0xb, 0x6f, 0xcb, 0xe6, 0xcb, 
+0xf6, 0xcb, 0xbe, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0x2f, 0x1e, 0x3a, 0xf8, 
+0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xc3, 0x47, 0x1e, 0xfe, 0x30, 0xc2, 0x47, 0x1e, 0x3a, 0xf8, 
+0x5, 0xf6, 0x2, 0x32, 0xf8, 0x5, 0xed, 0x4b, 0xfb, 0x5, 0x4, 0x4, 0xc, 0xed, 0x43, 0x84, 
+0x8, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfb, 0x5, 0x3c, 0x32, 0xfb, 0x5, 0x3a, 0xfc, 0x5, 0x3c, 
+0x32, 0xfc, 0x5, 0x3e, 0x5, 0xcd, 0x27, 0xa, 0xc3, 0x27, 0x1a, 0xe5, 0x3a, 0xfb, 0x5, 0xf, 
+0xda, 0xba, 0x1e, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xca, 0x85, 0x1e, 0xfe, 0xa0, 0xca, 
+0x7a, 0x1e, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0x3b, 0xf8, 0x5, 0x97, 0xe1, 0xc9, 
+0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0x99, 0x1e, 0x3a, 0xf8, 0x5, 0xf6, 
+0x1, 0x32, 0xf8, 0x5, 0x7d, 0xd6, 0xa, 0x6f, 0xcb, 0xe6, 0xcb, 0xee, 0xd6, 0xa, 0x6f, 0xcb, 
+0xa6, 0xcb, 0xae, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x5, 0x97, 0xcd, 
+0xf3, 0xb, 0x97, 0xe1, 0xc9, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xca, 0xd6, 0x1e, 0xfe, 
+0xa, 0xca, 0xcb, 0x1e, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0xe1, 
+0xc9, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 0xc2, 0xea, 0x1e, 0x3a, 0xf8, 0x5, 
+0xf6, 0x1, 0x32, 0xf8, 0x5, 0x7d, 0xd6, 0xa, 0x6f, 0xcb, 0xc6, 0xcb, 0xce, 0xd6, 0xa, 0x6f, 
+0xcb, 0x86, 0xcb, 0x8e, 0xc3, 0xa8, 0x1e, 0xe5, 0x3a, 0xfb, 0x5, 0x3c, 0xf, 0xda, 0x56, 0x1f, 
+0x7d, 0xd6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xca, 0x20, 0x1f, 0xfe, 0xa0, 0xca, 0x15, 0x1f, 0xe1, 
+0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0xe1, 0xc9, 0x7d, 0xd6, 0xa, 0x6f, 
+0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0x34, 0x1f, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 
+0x7d, 0xc6, 0xa, 0x6f, 0xcb, 0xe6, 0xcb, 0xee, 0xc6, 0xa, 0x6f, 0xcb, 0xa6, 0xcb, 0xae, 0x97, 
+0xcd, 0x92, 0x20, 0x3a, 0xfc, 0x5, 0x3d, 0x32, 0xfc, 0x5, 0x3e, 0x1, 0xcd, 0xf3, 0xb, 0x97, 
+0xe1, 0xc9, 0x7d, 0xd6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xca, 0x72, 0x1f, 0xfe, 0xa, 0xca, 0x67, 
+0x1f, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0xe1, 0xc9, 0x7d, 0xd6, 
+0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 0xc2, 0x86, 0x1f, 0x3a, 0xf8, 0x3d, 0x5, 0xf6, 0x1, 
+0x32, 0xf8, 0x5, 0x7d, 0xc6, 0xa, 0x6f, 0xcb, 0xc6, 0xcb, 0xce, 0xc6, 0xa, 0x6f, 0xcb, 0x86, 
+0xcb, 0x8e, 0xc3, 0x43, 0x1f, 0xe5, 0x3a, 0xfb, 0x5, 0xf, 0xda, 0xe0, 0x1f, 0x7e, 0xe6, 0xf, 
+0xca, 0xb8, 0x1f, 0xfe, 0xa, 0xca, 0xad, 0x1f, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 
+0xf8, 0x5, 0x97, 0xe1, 0xc9, 0x2c, 0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0xc9, 0x1f, 0x3a, 0xf8, 
+0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x2d, 0x3e, 0x3, 0x77, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfb, 
+0x5, 0x3c, 0x32, 0xfb, 0x5, 0x3e, 0x2, 0xcd, 0xf3, 0xb, 0x97, 0xe1, 0xc9, 0x2c, 0x7e, 0xe6, 
+0xf0, 0xca, 0xf9, 0x1f, 0xfe, 0xa0, 0xca, 0xee, 0x1f, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 
+0x32, 0xf8, 0x5, 0x97, 0xe1, 0xc9, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 0xc2, 0x9, 0x3e, 0x20, 0x3a, 
+0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xcb, 0xe6, 0xcb, 0xee, 0x2d, 0xcb, 0x86, 0xcb, 0x8e, 
+0xc3, 0xcd, 0x1f, 0xe5, 0x3a, 0xfb, 0x5, 0xf, 0xda, 0x62, 0x20, 0x2d, 0x7e, 0xe6, 0xf, 0xca, 
+0x36, 0x20, 0xfe, 0xa, 0xca, 0x2b, 0x20, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 
+0x5, 0x97, 0xe1, 0xc9, 0x7e, 0xe6, 0xf0, 0xfe, 0xa0, 0xc2, 0x46, 0x20, 0x3a, 0xf8, 0x5, 0xf6, 
+0x1, 0x32, 0xf8, 0x5, 0xcb, 0xc6, 0xcb, 0xce, 0x2c, 0xcb, 0xa6, 0xcb, 0xae, 0x97, 0xcd, 0x92, 
+0x20, 0x3a, 0xfb, 0x5, 0x3d, 0x32, 0xfb, 0x5, 0x3e, 0x3, 0xcd, 0xf3, 0xb, 0x97, 0xe1, 0xc9, 
+0x7e, 0xe6, 0xf0, 0xca, 0x7a, 0x20, 0xfe, 0xa0, 0xca, 0x6f, 0x20, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 
+0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0xe1, 0xc9, 0x2d, 0x7e, 0xe6, 0xf, 0xfe, 0xa, 0x3f, 0xc2, 
+0x8b, 0x20, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x2c, 0x3e, 0x30, 0x77, 0xc3, 0x4f, 
+0x20, 0xd9, 0x4f, 0x3a, 0xfb, 0x5, 0x87, 0xd6, 0x20, 0xd2, 0xab, 0x20, 0xc6, 0x20, 0x6f, 0x3a, 
+0xfc, 0x5, 0x87, 0xf6, 0x80, 0x67, 0x7d, 0xc3, 0xbf, 0x20, 0x6f, 0x3a, 0xfc, 0x5, 0x47, 0xcb, 
+0x2f, 0xf6, 0xa0, 0xe6, 0xa6, 0x67, 0x78, 0x87, 0x87, 0x87, 0x85, 0xe6, 0x1f, 0x6f, 0x6, 0x20, 
+0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 
+0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 
+0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0xcb, 0xc4, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 
+0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 0x40, 
+0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 0x71, 0x80, 0x6f, 0x71, 0x2c, 
+0x71, 0xd9, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0x21, 0x0, 0x5, 0x11, 0x0, 0x9, 0x1, 0x0, 0x8b, 
+0x97, 0x32, 0x86, 0x8, 0xcb, 0x66, 0xca, 0x79, 0x21, 0xcb, 0x6e, 0xca, 0x79, 0x21, 0x7d, 0xe, 
+0x0, 0xc, 0xd6, 0xa, 0xd2, 0x31, 0x21, 0xc6, 0xa, 0xc, 0x87, 0x12, 0x1c, 0x79, 0x12, 0x1c, 
+0x7d, 0x12, 0x1c, 0x7e, 0xcb, 0xb6, 0xcb, 0xbe, 0x7, 0x7, 0xe6, 0x3, 0x12, 0xe5, 0x26, 0x5, 
+0x3a, 0x86, 0x8, 0x3c, 0x32, 0x86, 0x8, 0x3d, 0x1f, 0xda, 0x69, 0x21, 0xe6, 0xf, 0xc6, 0xe8, 
+0x6f, 0x7e, 0xf, 0xf, 0xf, 0xf, 0xc3, 0x6f, 0x21, 0xe6, 0xf, 0xc6, 0xe8, 0x6f, 0x7e, 0x7, 
+0x7, 0xe6, 0xc, 0x4f, 0x1a, 0xb1, 0x12, 0x1c, 0xe1, 0xcb, 0x46, 0xca, 0xcf, 0x21, 0xcb, 0x4e, 
+0x41, 0xca, 0xcf, 0x21, 0x7d, 0xe, 0x0, 0xc, 0xd6, 0xa, 0xd2, 0x86, 0x21, 0xc6, 0xa, 0xc, 
+0x37, 0x8f, 0x12, 0x1c, 0x79, 0x12, 0x1c, 0x7d, 0x12, 0x1c, 0x7e, 0xcb, 0x96, 0xcb, 0x9e, 0xf, 
+0xf, 0xe6, 0x3, 0x12, 0xe5, 0x26, 0x5, 0x3a, 0x86, 0x8, 0x3c, 0x32, 0x86, 0x8, 0x3d, 0x1f, 
+0xda, 0xbf, 0x21, 0xe6, 0xf, 0xc6, 0xe8, 0x6f, 0x7e, 0xf, 0xf, 0xf, 0xf, 0xc3, 0xc5, 0x21, 
+0xe6, 0xf, 0xc6, 0xe8, 0x6f, 0x7e, 0x7, 0x7, 0xe6, 0xc, 0x4f, 0x1a, 0xb1, 0x12, 0x1c, 0xe1, 
+0x2c, 0x5, 0xc2, 0x24, 0x21, 0x97, 0x12, 0x1c, 0x12, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0xf5, 0xc5, 
+0xd5, 0xe5, 0x11, 0x0, 0x9, 0x26, 0x5, 0x1a, 0x32, 0xfb, 0x5, 0x1c, 0x1a, 0x32, 0xfc, 0x5, 
+0x1c, 0xa7, 0xc2, 0xf9, 0x21, 0xe1, 0xd1, 0xc1, 0xf1, 0xc9, 0x1a, 0x6f, 0x1c, 0x1a, 0xf, 0xda, 
+0x5, 0x42, 0x24, 0xf, 0xda, 0x85, 0x22, 0xf, 0xda, 0x58, 0x22, 0xf, 0xda, 0x43, 0x22, 0xf, 
+0xc3, 0x2f, 0x22, 0x3a, 0xfb, 0x5, 0x1d, 0x1d, 0x1d, 0x12, 0x1c, 0xcb, 0x3f, 0x47, 0x3a, 0xfc, 
+0x5, 0x12, 0x1c, 0xd6, 0x2, 0x87, 0x4f, 0x87, 0x87, 0x80, 0x81, 0x12, 0x1c, 0x1c, 0xc3, 0xe6, 
+0x21, 0xcd, 0x61, 0x1e, 0xc2, 0x3a, 0x22, 0x97, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0xfc, 0x1e, 0x3e, 
+0x4, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 0x1f, 0xc2, 0x4f, 0x22, 0x3e, 0x8, 0x12, 0xc3, 0x11, 
+0x22, 0xcd, 0x15, 0x20, 0x3e, 0xc, 0x12, 0xc3, 0x11, 0x22, 0xf, 0xda, 0x70, 0x22, 0xcd, 0xfc, 
+0x1e, 0xc2, 0x68, 0x22, 0x3e, 0x4, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x61, 0x1e, 0x97, 0x12, 0xc3, 
+0x11, 0x22, 0xcd, 0x15, 0x20, 0xc2, 0x7c, 0x22, 0x3e, 0xc, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 
+0x1f, 0x3e, 0x43, 0x8, 0x12, 0xc3, 0x11, 0x22, 0xf, 0xda, 0x47, 0x23, 0xf, 0xda, 0xea, 0x22, 
+0x47, 0xcd, 0x61, 0x1e, 0xc2, 0x9d, 0x22, 0x1a, 0xe6, 0x10, 0xf6, 0x2, 0x12, 0xc3, 0x11, 0x22, 
+0x78, 0xf, 0xda, 0xc6, 0x22, 0xcd, 0x98, 0x1f, 0xc2, 0xae, 0x22, 0x3e, 0x1a, 0x12, 0xc3, 0x11, 
+0x22, 0xcd, 0x15, 0x20, 0xc2, 0xba, 0x22, 0x3e, 0xe, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0xfc, 0x1e, 
+0x1a, 0xe6, 0x10, 0xf6, 0x6, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x15, 0x20, 0xc2, 0xd2, 0x22, 0x3e, 
+0xe, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 0x1f, 0xc2, 0xde, 0x22, 0x3e, 0x1a, 0x12, 0xc3, 0x11, 
+0x22, 0xcd, 0xfc, 0x1e, 0x1a, 0xe6, 0x10, 0xf6, 0x6, 0x12, 0xc3, 0x11, 0x22, 0x47, 0xcd, 0x98, 
+0x1f, 0xc2, 0xfa, 0x22, 0x1a, 0xe6, 0x10, 0xf6, 0xa, 0x12, 0xc3, 0x11, 0x22, 0x78, 0xf, 0xda, 
+0x23, 0x23, 0xcd, 0x44, 0xfc, 0x1e, 0xc2, 0xb, 0x23, 0x3e, 0x16, 0x12, 0xc3, 0x11, 0x22, 0xcd, 
+0x61, 0x1e, 0xc2, 0x17, 0x23, 0x3e, 0x2, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x15, 0x20, 0x1a, 0xe6, 
+0x10, 0xf6, 0xe, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x61, 0x1e, 0xc2, 0x2f, 0x23, 0x3e, 0x2, 0x12, 
+0xc3, 0x11, 0x22, 0xcd, 0xfc, 0x1e, 0xc2, 0x3b, 0x23, 0x3e, 0x16, 0x12, 0xc3, 0x11, 0x22, 0xcd, 
+0x15, 0x20, 0x1a, 0xe6, 0x10, 0xf6, 0xe, 0x12, 0xc3, 0x11, 0x22, 0xf, 0xda, 0xa8, 0x23, 0x47, 
+0xcd, 0xfc, 0x1e, 0xc2, 0x5b, 0x23, 0x1a, 0xe6, 0x10, 0xf6, 0x6, 0x12, 0xc3, 0x11, 0x22, 0x78, 
+0xf, 0xda, 0x84, 0x23, 0xcd, 0x15, 0x20, 0xc2, 0x6c, 0x23, 0x3e, 0x1e, 0x12, 0xc3, 0x11, 0x22, 
+0xcd, 0x98, 0x1f, 0xc2, 0x78, 0x23, 0x3e, 0xa, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x61, 0x1e, 0x1a, 
+0xe6, 0x10, 0xf6, 0x2, 0x45, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 0x1f, 0xc2, 0x90, 0x23, 0x3e, 
+0xa, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x15, 0x20, 0xc2, 0x9c, 0x23, 0x3e, 0x1e, 0x12, 0xc3, 0x11, 
+0x22, 0xcd, 0x61, 0x1e, 0x1a, 0xe6, 0x10, 0xf6, 0x2, 0x12, 0xc3, 0x11, 0x22, 0x47, 0xcd, 0x15, 
+0x20, 0xc2, 0xb8, 0x23, 0x1a, 0xe6, 0x10, 0xf6, 0xe, 0x12, 0xc3, 0x11, 0x22, 0x78, 0xf, 0xda, 
+0xe1, 0x23, 0xcd, 0x61, 0x1e, 0xc2, 0xc9, 0x23, 0x3e, 0x12, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0xfc, 
+0x1e, 0xc2, 0xd5, 0x23, 0x3e, 0x6, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 0x1f, 0x1a, 0xe6, 0x10, 
+0xf6, 0xa, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0xfc, 0x1e, 0xc2, 0xed, 0x23, 0x3e, 0x6, 0x12, 0xc3, 
+0x11, 0x22, 0xcd, 0x61, 0x1e, 0xc2, 0xf9, 0x23, 0x3e, 0x12, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 
+0x1f, 0x1a, 0xe6, 0x10, 0xf6, 0x46, 0xa, 0x12, 0xc3, 0x11, 0x22, 0xf, 0xda, 0xc9, 0x24, 0xf, 
+0xda, 0x6b, 0x24, 0xf, 0xda, 0x3e, 0x24, 0xcd, 0x61, 0x1e, 0xc2, 0x1d, 0x24, 0x3e, 0x1, 0x12, 
+0xc3, 0x11, 0x22, 0xcd, 0x98, 0x1f, 0xc2, 0x29, 0x24, 0x3e, 0x9, 0x12, 0xc3, 0x11, 0x22, 0xcd, 
+0x15, 0x20, 0xc2, 0x35, 0x24, 0x3e, 0xd, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0xfc, 0x1e, 0x3e, 0x5, 
+0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 0x1f, 0xc2, 0x4a, 0x24, 0x3e, 0x9, 0x12, 0xc3, 0x11, 0x22, 
+0xcd, 0xfc, 0x1e, 0xc2, 0x56, 0x24, 0x3e, 0x5, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x61, 0x1e, 0xc2, 
+0x62, 0x24, 0x3e, 0x1, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x15, 0x20, 0x3e, 0xd, 0x12, 0xc3, 0x11, 
+0x22, 0xf, 0xda, 0x9c, 0x24, 0xcd, 0xfc, 0x1e, 0xc2, 0x7b, 0x24, 0x3e, 0x5, 0x12, 0xc3, 0x11, 
+0x22, 0xcd, 0x15, 0x20, 0xc2, 0x87, 0x47, 0x24, 0x3e, 0xd, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 
+0x1f, 0xc2, 0x93, 0x24, 0x3e, 0x9, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x61, 0x1e, 0x3e, 0x1, 0x12, 
+0xc3, 0x11, 0x22, 0xcd, 0x15, 0x20, 0xc2, 0xa8, 0x24, 0x3e, 0xd, 0x12, 0xc3, 0x11, 0x22, 0xcd, 
+0x61, 0x1e, 0xc2, 0xb4, 0x24, 0x3e, 0x1, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0xfc, 0x1e, 0xc2, 0xc0, 
+0x24, 0x3e, 0x5, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 0x1f, 0x3e, 0x9, 0x12, 0xc3, 0x11, 0x22, 
+0xf, 0xda, 0x2b, 0x25, 0xf, 0xda, 0xfe, 0x24, 0xcd, 0x61, 0x1e, 0xc2, 0xdd, 0x24, 0x3e, 0x3, 
+0x12, 0xc3, 0x11, 0x22, 0xcd, 0x15, 0x20, 0xc2, 0xe9, 0x24, 0x3e, 0xf, 0x12, 0xc3, 0x11, 0x22, 
+0xcd, 0x98, 0x1f, 0xc2, 0xf5, 0x24, 0x3e, 0xb, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0xfc, 0x1e, 0x3e, 
+0x7, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x98, 0x48, 0x1f, 0xc2, 0xa, 0x25, 0x3e, 0xb, 0x12, 0xc3, 
+0x11, 0x22, 0xcd, 0x61, 0x1e, 0xc2, 0x16, 0x25, 0x3e, 0x3, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0xfc, 
+0x1e, 0xc2, 0x22, 0x25, 0x3e, 0x7, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x15, 0x20, 0x3e, 0xf, 0x12, 
+0xc3, 0x11, 0x22, 0xf, 0xda, 0x5c, 0x25, 0xcd, 0xfc, 0x1e, 0xc2, 0x3b, 0x25, 0x3e, 0x7, 0x12, 
+0xc3, 0x11, 0x22, 0xcd, 0x98, 0x1f, 0xc2, 0x47, 0x25, 0x3e, 0xb, 0x12, 0xc3, 0x11, 0x22, 0xcd, 
+0x15, 0x20, 0xc2, 0x53, 0x25, 0x3e, 0xf, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x61, 0x1e, 0x3e, 0x3, 
+0x12, 0xc3, 0x11, 0x22, 0xcd, 0x15, 0x20, 0xc2, 0x68, 0x25, 0x3e, 0xf, 0x12, 0xc3, 0x11, 0x22, 
+0xcd, 0xfc, 0x1e, 0xc2, 0x74, 0x25, 0x3e, 0x7, 0x12, 0xc3, 0x11, 0x22, 0xcd, 0x61, 0x1e, 0xc2, 
+0x80, 0x25, 0x3e, 0x3, 0x12, 0xc3, 0x11, 0x22, 0x49, 0xcd, 0x98, 0x1f, 0x3e, 0xb, 0x12, 0xc3, 
+0x11, 0x22, 0xe5, 0x67, 0x3a, 0xf1, 0x5, 0x84, 0x27, 0x32, 0xf1, 0x5, 0xd2, 0xab, 0x25, 0x3a, 
+0xf2, 0x5, 0xc6, 0x1, 0x27, 0x32, 0xf2, 0x5, 0xd2, 0xab, 0x25, 0x3a, 0xf3, 0x5, 0xc6, 0x1, 
+0x27, 0x32, 0xf3, 0x5, 0x21, 0x12, 0x2, 0x22, 0xfb, 0x5, 0x3a, 0xf3, 0x5, 0xcd, 0x7, 0x16, 
+0x3e, 0x14, 0x32, 0xfb, 0x5, 0x3a, 0xf2, 0x5, 0xcd, 0x7, 0x16, 0x3e, 0x16, 0x32, 0xfb, 0x5, 
+0x3a, 0xf1, 0x5, 0xcd, 0x7, 0x16, 0xe1, 0xc9, 0x1, 0x42, 0x0, 0x21, 0x0, 0x9, 0x7b, 0xbe, 
+0xca, 0xe1, 0x25, 0x2c, 0x2c, 0x2c, 0x2c, 0xc3, 0xd6, 0x25, 0x2c, 0x7a, 0xbe, 0xca, 0xed, 0x25, 
+0x2c, 0x2c, 0x2c, 0xc3, 0xd5, 0x25, 0x2d, 0x54, 0x5d, 0x7d, 0xc6, 0x4, 0x6f, 0xed, 0xb0, 0xc9, 
+0xd5, 0xed, 0x53, 0xfb, 0x5, 0x7a, 0xfe, 0x2, 0xca, 0x4a, 0x40, 0x26, 0xfe, 0xf, 0xca, 0x40, 
+0x26, 0x7b, 0xa7, 0xca, 0x40, 0x26, 0xfe, 0x13, 0xca, 0x40, 0x26, 0x97, 0xcd, 0x27, 0xa, 0x26, 
+0x5, 0x7a, 0xd6, 0x2, 0x87, 0x47, 0x87, 0x87, 0x80, 0x4f, 0x7b, 0xcb, 0x3f, 0x81, 0x6f, 0x7b, 
+0xf, 0xda, 0x51, 0x26, 0x7e, 0x47, 0xe6, 0xf, 0x77, 0x78, 0xe6, 0xf0, 0xfe, 0x30, 0xc2, 0x42, 
+0x26, 0xcd, 0xcf, 0x25, 0x3a, 0x80, 0x8, 0xcd, 0x89, 0x25, 0xd1, 0xc9, 0xfe, 0xa0, 0xc2, 0x40, 
+0x26, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0xd1, 0xc9, 0x7e, 0x47, 0xe6, 0xf0, 0x77, 
+0x78, 0xe6, 0xf, 0xfe, 0x3, 0xc2, 0x69, 0x26, 0xcd, 0xcf, 0x25, 0x3a, 0x80, 0x8, 0xcd, 0x89, 
+0x25, 0xd1, 0xc9, 0xfe, 0xa, 0xc2, 0x67, 0x26, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 
+0xd1, 0xc9, 0xf5, 0xc5, 0xd5, 0xe5, 0xed, 0x5b, 0x84, 0x8, 0x4b, 0xcd, 0xf7, 0x25, 0x1c, 0xcd, 
+0xf7, 0x25, 0x14, 0xcd, 0xf7, 0x25, 0x1d, 0xcd, 0xf7, 0x25, 0x1d, 0xcd, 0xf7, 0x25, 0x15, 0xcd, 
+0xf7, 0x25, 0x15, 0xcd, 0xf7, 0x25, 0x1c, 0xcd, 0xf7, 0x25, 0x1c, 0xcd, 0xf7, 0x25, 0xe1, 0xd1, 
+0xc1, 0xf1, 0xc9, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfc, 0x5, 0x3c, 0x32, 0xfc, 0x5, 0x3a, 0xf0, 
+0x5, 0xa7, 0xca, 0xc4, 0x26, 0x97, 0x32, 0xf0, 0x5, 0x32, 0x87, 0x8, 0xc3, 0xcf, 0x26, 0x3a, 
+0x87, 0x8, 0xa7, 0xca, 0xd5, 0x26, 0x97, 0x32, 0x87, 0x8, 0x3e, 0x4, 0xcd, 0xd, 0xb, 0xc9, 
+0x3e, 0x1, 0x32, 0x87, 0x8, 0x3e, 0x5, 0xcd, 0xd, 0xb, 0xc9, 0x3a, 0xf0, 0x5, 0xa7, 0xca, 
+0xf1, 0x26, 0x97, 0x32, 0xf0, 0x5, 0x32, 0x87, 0x8, 0xc3, 0xfc, 0x26, 0x3a, 0x87, 0x8, 0xa7, 
+0xca, 0x2, 0x27, 0x97, 0x32, 0x87, 0x8, 0x3e, 0x4, 0xcd, 0xd, 0x4c, 0xb, 0xc9, 0x3e, 0x1, 
+0x32, 0x87, 0x8, 0x3e, 0x5, 0xcd, 0xd, 0xb, 0xc9, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfc, 0x5, 
+0x3d, 0x32, 0xfc, 0x5, 0x3a, 0xf0, 0x5, 0xfe, 0x1, 0xca, 0x2c, 0x27, 0x3e, 0x1, 0x32, 0xf0, 
+0x5, 0x97, 0x32, 0x88, 0x8, 0xc3, 0x37, 0x27, 0x3a, 0x88, 0x8, 0xa7, 0xca, 0x3d, 0x27, 0x97, 
+0x32, 0x88, 0x8, 0x3e, 0x7, 0xcd, 0xd, 0xb, 0xc9, 0x3e, 0x1, 0x32, 0x88, 0x8, 0x3e, 0x6, 
+0xcd, 0xd, 0xb, 0xc9, 0x3a, 0xf0, 0x5, 0xfe, 0x1, 0xca, 0x5c, 0x27, 0x3e, 0x1, 0x32, 0xf0, 
+0x5, 0x97, 0x32, 0x88, 0x8, 0xc3, 0x67, 0x27, 0x3a, 0x88, 0x8, 0xa7, 0xca, 0x6d, 0x27, 0x97, 
+0x32, 0x88, 0x8, 0x3e, 0x7, 0xcd, 0xd, 0xb, 0xc9, 0x3e, 0x1, 0x32, 0x88, 0x8, 0x3e, 0x6, 
+0xcd, 0xd, 0xb, 0xc9, 0xe5, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfb, 0x5, 0x4d, 0x3c, 0x32, 0xfb, 
+0x5, 0x3a, 0xf0, 0x5, 0xfe, 0x2, 0xca, 0x94, 0x27, 0x3e, 0x2, 0x32, 0xf0, 0x5, 0xc3, 0x9c, 
+0x27, 0x3a, 0x89, 0x8, 0xfe, 0x6, 0xc2, 0xa0, 0x27, 0x97, 0x32, 0x89, 0x8, 0x3a, 0x89, 0x8, 
+0xc6, 0x8b, 0x6f, 0x26, 0x8, 0x7e, 0xcd, 0xd, 0xb, 0x3a, 0x89, 0x8, 0x3c, 0x32, 0x89, 0x8, 
+0xe1, 0xc9, 0xe5, 0x3a, 0xf0, 0x5, 0xfe, 0x2, 0xca, 0xc6, 0x27, 0x3e, 0x2, 0x32, 0xf0, 0x5, 
+0xc3, 0xce, 0x27, 0x3a, 0x89, 0x8, 0xfe, 0x6, 0xc2, 0xd2, 0x27, 0x97, 0x32, 0x89, 0x8, 0x3a, 
+0x89, 0x8, 0xc6, 0x8b, 0x6f, 0x26, 0x8, 0x7e, 0xcd, 0xd, 0xb, 0x3a, 0x89, 0x8, 0x3c, 0x32, 
+0x89, 0x8, 0xe1, 0xc9, 0xe5, 0x97, 0xcd, 0x92, 0x20, 0x3a, 0xfb, 0x5, 0x3d, 0x32, 0xfb, 0x5, 
+0x3a, 0xf0, 0x5, 0xfe, 0x3, 0xca, 0x3, 0x28, 0x3e, 0x3, 0x32, 0xf0, 0x5, 0x4e, 0xc3, 0xb, 
+0x28, 0x3a, 0x8a, 0x8, 0xfe, 0x6, 0xc2, 0xf, 0x28, 0x97, 0x32, 0x8a, 0x8, 0x3a, 0x8a, 0x8, 
+0xc6, 0x91, 0x6f, 0x26, 0x8, 0x7e, 0xcd, 0xd, 0xb, 0x3a, 0x8a, 0x8, 0x3c, 0x32, 0x8a, 0x8, 
+0xe1, 0xc9, 0xe5, 0x3a, 0xf0, 0x5, 0xfe, 0x3, 0xca, 0x35, 0x28, 0x3e, 0x3, 0x32, 0xf0, 0x5, 
+0xc3, 0x3d, 0x28, 0x3a, 0x8a, 0x8, 0xfe, 0x6, 0xc2, 0x41, 0x28, 0x97, 0x32, 0x8a, 0x8, 0x3a, 
+0x8a, 0x8, 0xc6, 0x91, 0x6f, 0x26, 0x8, 0x7e, 0xcd, 0xd, 0xb, 0x3a, 0x8a, 0x8, 0x3c, 0x32, 
+0x8a, 0x8, 0xe1, 0xc9, 0xe5, 0x26, 0x8, 0x3a, 0xf0, 0x5, 0xfe, 0x4, 0xca, 0x79, 0x28, 0x3e, 
+0x4, 0x32, 0xf0, 0x5, 0x3a, 0x87, 0x9, 0xe6, 0x7, 0xd6, 0x2, 0xd2, 0x71, 0x28, 0x97, 0x32, 
+0x97, 0x8, 0xc6, 0x98, 0x6f, 0x36, 0x0, 0x3a, 0x97, 0x8, 0xa7, 0xca, 0xa5, 0x28, 0x4f, 0x3d, 
+0xca, 0xb7, 0x28, 0x3d, 0xca, 0xcc, 0x28, 0x3d, 0xca, 0xe1, 0x28, 0x3d, 0xca, 0xf6, 0x28, 0x3a, 
+0x9d, 0x8, 0xfe, 0x9, 0xca, 0x66, 0x28, 0x3c, 0x32, 0x9d, 0x8, 0xc6, 0xc2, 0x6f, 0x7e, 0xcd, 
+0xd, 0xb, 0xe1, 0xc9, 0x3a, 0x98, 0x8, 0xfe, 0x2, 0xca, 0x66, 0x28, 0x3c, 0x32, 0x98, 0x8, 
+0x97, 0xcd, 0xd, 0xb, 0xe1, 0xc9, 0x3a, 0x99, 0x8, 0xfe, 0x6, 0xca, 0x66, 0x28, 0x3c, 0x32, 
+0x99, 0x8, 0xc6, 0x9f, 0x6f, 0x7e, 0xcd, 0xd, 0xb, 0xe1, 0xc9, 0x3a, 0x9a, 0x8, 0xfe, 0xa, 
+0xca, 0x66, 0x28, 0x3c, 0x32, 0x9a, 0x8, 0xc6, 0xa5, 0x6f, 0x7e, 0xcd, 0xd, 0xb, 0xe1, 0xc9, 
+0x3a, 0x9b, 0x8, 0xfe, 0xe, 0xca, 0x66, 0x28, 0x3c, 0x32, 0x9b, 0x8, 0xc6, 0xaf, 0x6f, 0x7e, 
+0xcd, 0xd, 0xb, 0xe1, 0xc9, 0x3a, 0x9c, 0x8, 0xfe, 0x5, 0xca, 0x66, 0x28, 0x3c, 0x32, 0x50, 
+0x9c, 0x8, 0xc6, 0xbd, 0x6f, 0x7e, 0xcd, 0xd, 0xb, 0xe1, 0xc9, 0xf3, 0xf5, 0x3a, 0x88, 0x9, 
+0x3d, 0xca, 0x1b, 0x29, 0x32, 0x88, 0x9, 0xf1, 0xfb, 0xed, 0x4d, 0x3e, 0x3, 0xd3, 0x8c, 0xf1, 
+0xfb, 0xed, 0x4d, 0xf3, 0xf5, 0x3a, 0x88, 0x9, 0x3d, 0xca, 0x3c, 0x29, 0x32, 0x88, 0x9, 0x3e, 
+0x85, 0xd3, 0x8c, 0x3a, 0x88, 0x9, 0xd3, 0x8c, 0xf1, 0xfb, 0xed, 0x4d, 0x3e, 0x3, 0xd3, 0x8c, 
+0xf1, 0xfb, 0xed, 0x4d, 0xe5, 0x21, 0xb, 0x29, 0x22, 0xe8, 0x1, 0x3e, 0x2, 0x32, 0x88, 0x9, 
+0x3e, 0xa5, 0xd3, 0x8c, 0x3e, 0x40, 0xd3, 0x8c, 0xe1, 0xc9, 0xe5, 0x21, 0x23, 0x29, 0x22, 0xe8, 
+0x1, 0x3e, 0x40, 0x32, 0x88, 0x9, 0x3e, 0x85, 0xd3, 0x8c, 0x3e, 0x40, 0xd3, 0x8c, 0xe1, 0xc9, 
+0xe5, 0x3a, 0x7f, 0x8, 0xcd, 0x89, 0x25, 0x3a, 0xf7, 0x5, 0xc6, 0x1, 0x27, 0x32, 0xf7, 0x5, 
+0x51, 0x21, 0x24, 0x2, 0x22, 0xfb, 0x5, 0xcd, 0x7, 0x16, 0xe1, 0xc9, 0x3a, 0x8c, 0x9, 0xa7, 
+0xc8, 0xe5, 0xd6, 0x2, 0x87, 0x6f, 0x87, 0x87, 0x85, 0x6f, 0x3a, 0x8b, 0x9, 0x67, 0xcb, 0x3f, 
+0x85, 0x6f, 0x7c, 0xf, 0x26, 0x5, 0x7e, 0xda, 0xae, 0x29, 0xe6, 0xf, 0x77, 0xe1, 0xc9, 0xe6, 
+0xf0, 0x77, 0xe1, 0xc9, 0xe5, 0x3a, 0x8c, 0x9, 0xd6, 0x2, 0x87, 0x6f, 0x87, 0x87, 0x85, 0x6f, 
+0x3a, 0x8b, 0x9, 0x67, 0xcb, 0x3f, 0x85, 0x6f, 0x7c, 0xf, 0x26, 0x5, 0x7e, 0xda, 0xd6, 0x29, 
+0xe6, 0xf, 0xf6, 0x40, 0x77, 0xe1, 0xc9, 0xe6, 0xf0, 0xf6, 0x4, 0x77, 0xe1, 0xc9, 0xe5, 0xcd, 
+0x8b, 0x29, 0x2a, 0xe5, 0x5, 0x22, 0xfb, 0x5, 0x97, 0x32, 0x89, 0x9, 0x32, 0x8a, 0x9, 0x7c, 
+0x65, 0xd6, 0x2, 0x87, 0x6f, 0x87, 0x87, 0x85, 0x6f, 0x7c, 0xcb, 0x3f, 0x85, 0x6f, 0x7c, 0x26, 
+0x5, 0x52, 0xf, 0xda, 0xaa, 0x2a, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0xca, 0x13, 0x2a, 
+0xfe, 0x20, 0xc2, 0x36, 0x2a, 0xcd, 0x44, 0x29, 0x7e, 0xe6, 0xf, 0xf6, 0xa0, 0x77, 0x7d, 0xd6, 
+0xa, 0x6f, 0x7e, 0xe6, 0xf, 0x77, 0xcd, 0xa8, 0x26, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x25, 
+0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0xfe, 0x10, 0xca, 0x45, 0x2a, 0xfe, 0x60, 0xca, 
+0x45, 0x2a, 0xfe, 0xe0, 0xc2, 0x4e, 0x2a, 0xcd, 0xe0, 0x26, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 
+0xfe, 0x30, 0xc2, 0x61, 0x2a, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0x32, 0x8c, 
+0x9, 0xe1, 0xc9, 0xfe, 0x50, 0xc2, 0x8c, 0x2a, 0xcd, 0x5a, 0x29, 0xcd, 0x8d, 0x9, 0x7e, 0xe6, 
+0xf, 0xf6, 0xa0, 0x77, 0x7d, 0xd6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0x77, 0xcd, 0xa8, 0x26, 0x2a, 
+0xfb, 0x5, 0x53, 0x22, 0xe5, 0x5, 0x25, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0x3a, 
+0xe7, 0x5, 0x67, 0x3a, 0xf7, 0x5, 0x94, 0xd2, 0xa0, 0x2a, 0xcd, 0xe0, 0x26, 0x97, 0x32, 0x8c, 
+0x9, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x4, 0x32, 0xf8, 0x5, 0xe1, 0xc9, 0x7d, 0xc6, 0xa, 
+0x6f, 0x7e, 0xe6, 0xf, 0xca, 0xb9, 0x2a, 0xfe, 0x2, 0xc2, 0xdc, 0x2a, 0xcd, 0x44, 0x29, 0x7e, 
+0xe6, 0xf0, 0xf6, 0xa, 0x77, 0x7d, 0xd6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0x77, 0xcd, 0xa8, 0x26, 
+0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x25, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0xfe, 
+0x1, 0xca, 0xeb, 0x2a, 0xfe, 0x6, 0xca, 0xeb, 0x2a, 0xfe, 0xe, 0xc2, 0xf4, 0x2a, 0xcd, 0xe0, 
+0x26, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x3, 0xc2, 0x7, 0x2b, 0x3a, 0xf8, 0x5, 0xf6, 
+0x1, 0x32, 0xf8, 0x54, 0x5, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x5, 0xc2, 0x32, 0x2b, 
+0xcd, 0x5a, 0x29, 0xcd, 0x8d, 0x9, 0x7e, 0xe6, 0xf0, 0xf6, 0xa, 0x77, 0x7d, 0xd6, 0xa, 0x6f, 
+0x7e, 0xe6, 0xf0, 0x77, 0xcd, 0xa8, 0x26, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x25, 0x22, 0x8b, 
+0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0x3a, 0xe7, 0x5, 0x67, 0x3a, 0xf7, 0x5, 0x94, 0xd2, 0x46, 
+0x2b, 0xcd, 0xe0, 0x26, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x4, 0x32, 
+0xf8, 0x5, 0xe1, 0xc9, 0xe5, 0xcd, 0x8b, 0x29, 0x2a, 0xe5, 0x5, 0x22, 0xfb, 0x5, 0x97, 0x32, 
+0x89, 0x9, 0x32, 0x8a, 0x9, 0x7c, 0x65, 0xd6, 0x2, 0x87, 0x6f, 0x87, 0x87, 0x85, 0x6f, 0x7c, 
+0xcb, 0x3f, 0x85, 0x6f, 0x7c, 0x26, 0x5, 0xf, 0xda, 0x1d, 0x2c, 0x7d, 0xd6, 0xa, 0x6f, 0x7e, 
+0xe6, 0xf0, 0xca, 0x86, 0x55, 0x2b, 0xfe, 0x20, 0xc2, 0xa9, 0x2b, 0xcd, 0x44, 0x29, 0x7e, 0xe6, 
+0xf, 0xf6, 0xa0, 0x77, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0x77, 0xcd, 0xd, 0x27, 0x2a, 
+0xfb, 0x5, 0x22, 0xe5, 0x5, 0x24, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0xfe, 0x10, 
+0xca, 0xb8, 0x2b, 0xfe, 0x60, 0xca, 0xb8, 0x2b, 0xfe, 0xe0, 0xc2, 0xc1, 0x2b, 0xcd, 0x48, 0x27, 
+0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x30, 0xc2, 0xd4, 0x2b, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 
+0x32, 0xf8, 0x5, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x50, 0xc2, 0xff, 0x2b, 0xcd, 0x5a, 
+0x29, 0xcd, 0x8d, 0x9, 0x7e, 0xe6, 0xf, 0xf6, 0xa0, 0x77, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 
+0xf, 0x77, 0xcd, 0xd, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x24, 0x22, 0x8b, 0x9, 0xcd, 
+0xb3, 0x29, 0xe1, 0xc9, 0x3a, 0x56, 0xe7, 0x5, 0x67, 0x3a, 0xf7, 0x5, 0x94, 0xd2, 0x13, 0x2c, 
+0xcd, 0x48, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x4, 0x32, 0xf8, 
+0x5, 0xe1, 0xc9, 0x7d, 0xd6, 0xa, 0x6f, 0x7e, 0xe6, 0xf, 0xca, 0x2c, 0x2c, 0xfe, 0x2, 0xc2, 
+0x4f, 0x2c, 0xcd, 0x44, 0x29, 0x7e, 0xe6, 0xf0, 0xf6, 0xa, 0x77, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 
+0xe6, 0xf0, 0x77, 0xcd, 0xd, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x24, 0x22, 0x8b, 0x9, 
+0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0xfe, 0x1, 0xca, 0x5e, 0x2c, 0xfe, 0x6, 0xca, 0x5e, 0x2c, 0xfe, 
+0xe, 0xc2, 0x67, 0x2c, 0xcd, 0x48, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x3, 0xc2, 
+0x7a, 0x2c, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 
+0xfe, 0x5, 0xc2, 0xa5, 0x2c, 0xcd, 0x57, 0x5a, 0x29, 0xcd, 0x8d, 0x9, 0x7e, 0xe6, 0xf0, 0xf6, 
+0xa, 0x77, 0x7d, 0xc6, 0xa, 0x6f, 0x7e, 0xe6, 0xf0, 0x77, 0xcd, 0xd, 0x27, 0x2a, 0xfb, 0x5, 
+0x22, 0xe5, 0x5, 0x24, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0x3a, 0xe7, 0x5, 0x67, 
+0x3a, 0xf7, 0x5, 0x94, 0xd2, 0xb9, 0x2c, 0xcd, 0x48, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 
+0x3a, 0xf8, 0x5, 0xf6, 0x4, 0x32, 0xf8, 0x5, 0xe1, 0xc9, 0xe5, 0xcd, 0x8b, 0x29, 0x2a, 0xe5, 
+0x5, 0x22, 0xfb, 0x5, 0x97, 0x32, 0x89, 0x9, 0x7c, 0x65, 0xd6, 0x2, 0x87, 0x6f, 0x87, 0x87, 
+0x85, 0x6f, 0x7c, 0xcb, 0x3f, 0x85, 0x6f, 0x7c, 0x26, 0x5, 0xf, 0xda, 0xbe, 0x2d, 0x7e, 0xe6, 
+0xf, 0xca, 0xf2, 0x2c, 0xfe, 0x2, 0xc2, 0x9, 0x2d, 0xcd, 0x44, 0x29, 0x36, 0xa, 0xcd, 0x78, 
+0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x58, 0x2d, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0xe1, 
+0xc9, 0xfe, 0x6, 0xca, 0x13, 0x2d, 0xfe, 0xe, 0xc2, 0x1c, 0x2d, 0xcd, 0xb5, 0x27, 0x97, 0x32, 
+0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x1, 0xc2, 0x6e, 0x2d, 0x2c, 0x7e, 0xe6, 0xf0, 0xca, 0x31, 0x2d, 
+0xcd, 0xb5, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x3a, 0x8a, 0x9, 0xa7, 0xc2, 0x46, 0x2d, 
+0x3e, 0x1, 0x32, 0x8a, 0x9, 0xcd, 0xb5, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xcd, 0x44, 
+0x29, 0x97, 0x32, 0x8a, 0x9, 0xcb, 0xe6, 0x2d, 0x36, 0xa, 0xcd, 0x78, 0x27, 0x2a, 0xfb, 0x5, 
+0x22, 0xe5, 0x5, 0x2d, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0x2c, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 
+0x1, 0xcd, 0x27, 0xa, 0xe1, 0xc9, 0xfe, 0x3, 0xc2, 0x81, 0x2d, 0x3a, 0xf8, 0x5, 0xf6, 0x1, 
+0x32, 0xf8, 0x5, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0x59, 0xc9, 0xfe, 0x5, 0xc2, 0xa0, 0x2d, 0xcd, 
+0x5a, 0x29, 0xcd, 0x8d, 0x9, 0x36, 0xa, 0xcd, 0x78, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 
+0x2d, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0x3a, 0xe7, 0x5, 0x67, 0x3a, 0xf7, 0x5, 
+0x94, 0xd2, 0xb4, 0x2d, 0xcd, 0xb5, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 
+0xf6, 0x4, 0x32, 0xf8, 0x5, 0xe1, 0xc9, 0x2c, 0x7e, 0xe6, 0xf0, 0xca, 0xca, 0x2d, 0xfe, 0x20, 
+0xc2, 0xea, 0x2d, 0xcd, 0x44, 0x29, 0x7e, 0xe6, 0xf, 0xf6, 0xa0, 0x77, 0x2d, 0x7e, 0xe6, 0xf0, 
+0x77, 0xcd, 0x78, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x2d, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 
+0x29, 0xe1, 0xc9, 0xfe, 0x60, 0xca, 0xf4, 0x2d, 0xfe, 0xe0, 0xc2, 0xfd, 0x2d, 0xcd, 0xb5, 0x27, 
+0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x10, 0xc2, 0x5a, 0x50, 0x2e, 0x7e, 0xe6, 0xf, 0xca, 
+0x11, 0x2e, 0xcd, 0xb5, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x3a, 0x8a, 0x9, 0xa7, 0xc2, 
+0x26, 0x2e, 0x3e, 0x1, 0x32, 0x8a, 0x9, 0xcd, 0xb5, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 
+0xcd, 0x44, 0x29, 0x97, 0x32, 0x8a, 0x9, 0x36, 0xa1, 0x2d, 0x7e, 0xe6, 0xf0, 0x77, 0xcd, 0x78, 
+0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x2d, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0x2c, 0x2c, 
+0x22, 0xfb, 0x5, 0x3e, 0x1, 0xcd, 0x27, 0xa, 0xe1, 0xc9, 0xfe, 0x30, 0xc2, 0x63, 0x2e, 0x3a, 
+0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x50, 0xc2, 
+0x8b, 0x2e, 0xcd, 0x5a, 0x29, 0xcd, 0x8d, 0x9, 0x7e, 0xe6, 0xf, 0xf6, 0xa0, 0x77, 0x2d, 0x7e, 
+0xe6, 0xf0, 0x77, 0xcd, 0x78, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0x5b, 0xe5, 0x5, 0x2d, 0x22, 0x8b, 
+0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0x3a, 0xe7, 0x5, 0x67, 0x3a, 0xf7, 0x5, 0x94, 0xd2, 0x9f, 
+0x2e, 0xcd, 0xb5, 0x27, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x4, 0x32, 
+0xf8, 0x5, 0xe1, 0xc9, 0xe5, 0xcd, 0x8b, 0x29, 0x2a, 0xe5, 0x5, 0x22, 0xfb, 0x5, 0x97, 0x32, 
+0x8a, 0x9, 0x7c, 0x65, 0xd6, 0x2, 0x87, 0x6f, 0x87, 0x87, 0x85, 0x6f, 0x7c, 0xcb, 0x3f, 0x85, 
+0x6f, 0x7c, 0x26, 0x5, 0xf, 0xda, 0xb6, 0x2f, 0x2d, 0x7e, 0xe6, 0xf, 0xca, 0xd9, 0x2e, 0xfe, 
+0x2, 0xc2, 0xf9, 0x2e, 0xcd, 0x44, 0x29, 0x7e, 0xe6, 0xf0, 0xf6, 0xa, 0x77, 0x2c, 0x7e, 0xe6, 
+0xf, 0x77, 0xcd, 0xe7, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x2c, 0x22, 0x8b, 0x9, 0xcd, 
+0xb3, 0x29, 0xe1, 0xc9, 0xfe, 0x6, 0xca, 0x3, 0x2f, 0xfe, 0xe, 0x5c, 0xc2, 0xc, 0x2f, 0xcd, 
+0x24, 0x28, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x1, 0xc2, 0x5f, 0x2f, 0x7e, 0xe6, 0xf0, 
+0xca, 0x20, 0x2f, 0xcd, 0x24, 0x28, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x3a, 0x89, 0x9, 0xa7, 
+0xc2, 0x35, 0x2f, 0x3e, 0x1, 0x32, 0x89, 0x9, 0xcd, 0x24, 0x28, 0x97, 0x32, 0x8c, 0x9, 0xe1, 
+0xc9, 0xcd, 0x44, 0x29, 0x97, 0x32, 0x89, 0x9, 0x36, 0x1a, 0x2c, 0x7e, 0xe6, 0xf, 0x77, 0xcd, 
+0xe7, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x2c, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0x2d, 
+0x2d, 0x22, 0xfb, 0x5, 0x3e, 0x1, 0xcd, 0x27, 0xa, 0xe1, 0xc9, 0xc2, 0x70, 0x2f, 0x3a, 0xf8, 
+0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x5, 0xc2, 0x98, 
+0x2f, 0xcd, 0x5a, 0x29, 0xcd, 0x8d, 0x9, 0x7e, 0xe6, 0xf0, 0xf6, 0xa, 0x5d, 0x77, 0x2c, 0x7e, 
+0xe6, 0xf, 0x77, 0xcd, 0xe7, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x2c, 0x22, 0x8b, 0x9, 
+0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0x3a, 0xe7, 0x5, 0x67, 0x3a, 0xf7, 0x5, 0x94, 0xd2, 0xac, 0x2f, 
+0xcd, 0x24, 0x28, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x4, 0x32, 0xf8, 
+0x5, 0xe1, 0xc9, 0x7e, 0xe6, 0xf0, 0xca, 0xc1, 0x2f, 0xfe, 0x20, 0xc2, 0xd8, 0x2f, 0xcd, 0x44, 
+0x29, 0x36, 0xa0, 0xcd, 0xe7, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x2c, 0x22, 0x8b, 0x9, 
+0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0xfe, 0x60, 0xca, 0xe2, 0x2f, 0xfe, 0xe0, 0xc2, 0xeb, 0x2f, 0xcd, 
+0x24, 0x28, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x10, 0xc2, 0x3d, 0x30, 0x2d, 0x7e, 0xe6, 
+0xf, 0xca, 0x0, 0x30, 0xcd, 0x24, 0x28, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0x5e, 0x3a, 0x89, 
+0x9, 0xa7, 0xc2, 0x15, 0x30, 0x3e, 0x1, 0x32, 0x89, 0x9, 0xcd, 0x24, 0x28, 0x97, 0x32, 0x8c, 
+0x9, 0xe1, 0xc9, 0xcd, 0x44, 0x29, 0x97, 0x32, 0x89, 0x9, 0xcb, 0xc6, 0x2c, 0x36, 0xa0, 0xcd, 
+0xe7, 0x27, 0x2a, 0xfb, 0x5, 0x22, 0xe5, 0x5, 0x2c, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0x2d, 
+0x2d, 0x22, 0xfb, 0x5, 0x3e, 0x1, 0xcd, 0x27, 0xa, 0xe1, 0xc9, 0xfe, 0x30, 0xc2, 0x50, 0x30, 
+0x3a, 0xf8, 0x5, 0xf6, 0x1, 0x32, 0xf8, 0x5, 0x97, 0x32, 0x8c, 0x9, 0xe1, 0xc9, 0xfe, 0x50, 
+0xc2, 0x6f, 0x30, 0xcd, 0x5a, 0x29, 0xcd, 0x8d, 0x9, 0x36, 0xa0, 0xcd, 0xe7, 0x27, 0x2a, 0xfb, 
+0x5, 0x22, 0xe5, 0x5, 0x2c, 0x22, 0x8b, 0x9, 0xcd, 0xb3, 0x29, 0xe1, 0xc9, 0x3a, 0xe7, 0x5, 
+0x67, 0x3a, 0xf7, 0x5, 0x94, 0xd2, 0x83, 0x30, 0xcd, 0x24, 0x28, 0x97, 0x32, 0x8c, 0x5f, 0x9, 
+0xe1, 0xc9, 0x3a, 0xf8, 0x5, 0xf6, 0x4, 0x32, 0xf8, 0x5, 0xe1, 0xc9, 0x3a, 0xa0, 0x9, 0xa7, 
+0xc0, 0x3a, 0xfd, 0x1, 0xd6, 0x8, 0xc2, 0x9e, 0x30, 0xcd, 0xa9, 0x2e, 0xc9, 0x3d, 0xc2, 0xa6, 
+0x30, 0xcd, 0xc3, 0x2c, 0xc9, 0x3d, 0xc2, 0xae, 0x30, 0xcd, 0xdd, 0x29, 0xc9, 0x3d, 0xc2, 0xb6, 
+0x30, 0xcd, 0x50, 0x2b, 0xc9, 0xcd, 0x8b, 0x29, 0x97, 0x32, 0x89, 0x9, 0x32, 0x8a, 0x9, 0x32, 
+0x8c, 0x9, 0x2a, 0xe5, 0x5, 0x22, 0xfb, 0x5, 0xcd, 0x56, 0x28, 0xc9, 0xe5, 0x3a, 0xf4, 0x5, 
+0x67, 0x3a, 0xf5, 0x5, 0xb4, 0xc2, 0xe0, 0x30, 0x3c, 0x32, 0xfa, 0x5, 0xc3, 0xf3, 0x30, 0x7c, 
+0xd6, 0x1, 0x27, 0x32, 0xf4, 0x5, 0xd2, 0xf3, 0x30, 0x3a, 0xf5, 0x5, 0xd6, 0x1, 0x27, 0x32, 
+0xf5, 0x5, 0x2a, 0xfb, 0x5, 0xe5, 0x21, 0x14, 0x1, 0x22, 0xfb, 0x5, 0x3a, 0xf5, 0x5, 0x60, 
+0xcd, 0x7, 0x16, 0x3e, 0x16, 0x32, 0xfb, 0x5, 0x3a, 0xf4, 0x5, 0xcd, 0x7, 0x16, 0xe1, 0x22, 
+0xfb, 0x5, 0xe1, 0xc9, 0x2a, 0xf4, 0x5, 0x11, 0x0, 0xf0, 0x19, 0xd8, 0x3a, 0xa2, 0x9, 0xa7, 
+0xca, 0x37, 0x31, 0x21, 0x12, 0x1, 0x22, 0xfb, 0x5, 0x21, 0xa3, 0x9, 0x1, 0x6, 0x0, 0xcd, 
+0xd6, 0x15, 0x97, 0x32, 0xa2, 0x9, 0xc9, 0x3c, 0x32, 0xa2, 0x9, 0x21, 0x12, 0x1, 0x22, 0xfb, 
+0x5, 0x3e, 0x10, 0xcd, 0xd3, 0x14, 0x3e, 0x13, 0x32, 0xfb, 0x5, 0x3e, 0x10, 0xcd, 0xd3, 0x14, 
+0xc9, 0x3e, 0x5, 0x32, 0xf0, 0x5, 0x2a, 0x81, 0x8, 0x22, 0xf4, 0x5, 0x97, 0x32, 0xf7, 0x5, 
+0x32, 0xf8, 0x5, 0x32, 0xfa, 0x5, 0x32, 0x89, 0x9, 0x32, 0x8a, 0x9, 0x32, 0x8c, 0x9, 0x32, 
+0xa0, 0x9, 0xcd, 0xac, 0x9, 0xcd, 0x4, 0x18, 0xcd, 0x98, 0x14, 0x21, 0xff, 0xff, 0x6, 0x8, 
+0x61, 0x3a, 0xfd, 0x1, 0xd6, 0xd, 0xca, 0x43, 0x13, 0x2b, 0x7c, 0xb5, 0xc2, 0x80, 0x31, 0x5, 
+0xc3, 0x40, 0x13, 0x3a, 0xfd, 0x1, 0xd6, 0x3, 0xc2, 0xa0, 0x31, 0x3e, 0x1, 0x32, 0xf8, 0x5, 
+0xc9, 0x3a, 0x9d, 0x9, 0xe6, 0x2, 0xca, 0xdc, 0x31, 0x3a, 0xfd, 0x1, 0xfe, 0x10, 0xc2, 0xb6, 
+0x31, 0x3e, 0x4, 0x32, 0xf8, 0x5, 0xc9, 0xfe, 0x1a, 0xc2, 0xc3, 0x31, 0x3e, 0x1, 0x32, 0xa9, 
+0x9, 0xc3, 0xdc, 0x31, 0xfe, 0x1f, 0xc2, 0xcf, 0x31, 0x97, 0x32, 0xa9, 0x9, 0xc3, 0xdc, 0x31, 
+0xfe, 0x13, 0xc2, 0xdc, 0x31, 0x3a, 0xfd, 0x1, 0xfe, 0xd, 0xc2, 0xd4, 0x31, 0xcd, 0x8d, 0x30, 
+0x3a, 0xf8, 0x5, 0xe6, 0x4, 0xc0, 0x3a, 0xf8, 0x5, 0xe6, 0x1, 0xca, 0x7, 0x32, 0x97, 0xcd, 
+0x20, 0x13, 0x3a, 0xa9, 0x9, 0xa7, 0xc2, 0x7, 0x32, 0x3c, 0x32, 0xa0, 0x9, 0x2a, 0xe5, 0x5, 
+0x22, 0x62, 0xfb, 0x5, 0x3e, 0x4, 0xcd, 0xf3, 0xb, 0xcd, 0xcd, 0x30, 0x3a, 0xfa, 0x5, 0xa7, 
+0xca, 0x2a, 0x32, 0x3a, 0xa9, 0x9, 0xa7, 0xc2, 0x2a, 0x32, 0x3c, 0x32, 0xa0, 0x9, 0x2a, 0xe5, 
+0x5, 0x22, 0xfb, 0x5, 0x3e, 0x4, 0xcd, 0xf3, 0xb, 0xc3, 0x2d, 0x32, 0xcd, 0x14, 0x31, 0xc3, 
+0x36, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xb3, 0x9, 0xcd, 0x96, 0x18, 0xcd, 0x71, 
+0x3d, 0x3a, 0xf8, 0x5, 0xe6, 0x2, 0xca, 0x4a, 0x32, 0xcd, 0x78, 0x26, 0x3a, 0xf8, 0x5, 0xe6, 
+0x1, 0xca, 0x68, 0x32, 0x3a, 0xa9, 0x9, 0xa7, 0xc2, 0x68, 0x32, 0x3c, 0x32, 0xa0, 0x9, 0x2a, 
+0xe5, 0x5, 0x22, 0xfb, 0x5, 0x3e, 0x4, 0xcd, 0xf3, 0xb, 0x97, 0xcd, 0x20, 0x13, 0xed, 0x5f, 
+0x32, 0x87, 0x9, 0xcd, 0xdd, 0x21, 0x3a, 0xf8, 0x5, 0xe6, 0x1, 0xca, 0x96, 0x32, 0x97, 0xcd, 
+0x20, 0x13, 0x63, 0x3a, 0xa9, 0x9, 0xa7, 0xc2, 0x96, 0x32, 0x3c, 0x32, 0xa0, 0x9, 0x2a, 0xe5, 
+0x5, 0x22, 0xfb, 0x5, 0x3e, 0x4, 0xcd, 0xf3, 0xb, 0x3a, 0xa0, 0x9, 0xa7, 0xc2, 0xbf, 0x32, 
+0x3a, 0xf0, 0x5, 0xfe, 0x2, 0xc2, 0xb1, 0x32, 0x2a, 0xe5, 0x5, 0x22, 0xfb, 0x5, 0xcd, 0xb5, 
+0x27, 0xc3, 0xbf, 0x32, 0xfe, 0x3, 0xc2, 0xbf, 0x32, 0x2a, 0xe5, 0x5, 0x22, 0xfb, 0x5, 0xcd, 
+0x24, 0x28, 0xcd, 0x65, 0x3d, 0xc3, 0x92, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x97, 0x32, 
+0xf1, 0x5, 0x32, 0xf2, 0x5, 0x32, 0xf3, 0x5, 0x3a, 0x83, 0x8, 0x32, 0xf6, 0x5, 0x3e, 0x3a, 
+0x32, 0x86, 0x9, 0xcd, 0x0, 0xa, 0x21, 0x11, 0x8, 0x22, 0xfb, 0x5, 0x21, 0xd7, 0x9, 0x1, 
+0x6, 0x0, 0xcd, 0xd6, 0x15, 0x21, 0x11, 0x9, 0x22, 0xfb, 0x5, 0x2e, 0xdd, 0xcd, 0xd6, 0x15, 
+0x21, 0x8, 0xe, 0x64, 0x22, 0xfb, 0x5, 0x21, 0xe3, 0x9, 0x1, 0x18, 0x0, 0xcd, 0xd6, 0x15, 
+0x3a, 0xfd, 0x1, 0xa7, 0xca, 0xc, 0x33, 0x2a, 0x99, 0x9, 0x22, 0xe3, 0x5, 0xcd, 0x51, 0x31, 
+0x3a, 0xf8, 0x5, 0xe6, 0x4, 0xc2, 0x40, 0x33, 0x3a, 0x9d, 0x9, 0xe6, 0x8, 0xc2, 0x37, 0x33, 
+0x3a, 0xf6, 0x5, 0xd6, 0x1, 0x27, 0x32, 0xf6, 0x5, 0xa7, 0xc8, 0x2a, 0xe1, 0x5, 0x22, 0xe3, 
+0x5, 0xc3, 0x19, 0x33, 0x2a, 0xe3, 0x5, 0x7c, 0xb5, 0xc2, 0x19, 0x33, 0xc9, 0xe5, 0x97, 0xf5, 
+0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xd2, 0x5c, 0x33, 0x26, 0x7, 0xc3, 0x5e, 0x33, 
+0x26, 0x6, 0x6f, 0xcd, 0xcc, 0x8, 0xbe, 0xda, 0x82, 0x33, 0xc2, 0x7c, 0x33, 0x2c, 0x3a, 0xf2, 
+0x5, 0xbe, 0xda, 0x82, 0x33, 0xc2, 0x7c, 0x33, 0x2c, 0x3a, 0xf1, 0x5, 0xbe, 0xda, 0x82, 0x33, 
+0xf1, 0x32, 0xfb, 0x9, 0x65, 0xe1, 0xc9, 0xf1, 0x3c, 0xfe, 0x14, 0xc2, 0x4b, 0x33, 0x32, 0xfb, 
+0x9, 0xe1, 0xc9, 0xc5, 0xd5, 0xe5, 0x3a, 0xfb, 0x9, 0xfe, 0x14, 0xca, 0xe1, 0x33, 0xfe, 0x13, 
+0xca, 0xc7, 0x33, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xd2, 0xae, 0x33, 0x16, 0x7, 
+0xc3, 0xb0, 0x33, 0x16, 0x6, 0x5f, 0xcd, 0xd6, 0x8, 0x37, 0x3f, 0xed, 0x52, 0x44, 0x4d, 0xd5, 
+0x11, 0x9f, 0x7, 0x21, 0x8f, 0x7, 0xed, 0xb8, 0xe1, 0xc3, 0xca, 0x33, 0x21, 0x90, 0x7, 0x3a, 
+0xf3, 0x5, 0x77, 0x2c, 0x3a, 0xf2, 0x5, 0x77, 0x2c, 0x3a, 0xf1, 0x5, 0x77, 0x6, 0xd, 0x2c, 
+0x36, 0x0, 0x5, 0xc2, 0xda, 0x33, 0xe1, 0xd1, 0xc1, 0xc9, 0xc5, 0xe5, 0x97, 0xf5, 0xc6, 0x7, 
+0x32, 0xfc, 0x5, 0xd6, 0x7, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 0xd2, 0x0, 0x34, 
+0x26, 0x7, 0xc3, 0x2, 0x34, 0x66, 0x26, 0x6, 0x6f, 0x3e, 0xa, 0xcd, 0xe0, 0x8, 0x7e, 0xcd, 
+0x7, 0x16, 0x3e, 0xc, 0x32, 0xfb, 0x5, 0x2c, 0x7e, 0xcd, 0x7, 0x16, 0x3e, 0xe, 0x32, 0xfb, 
+0x5, 0x2c, 0x7e, 0xcd, 0x7, 0x16, 0x3e, 0x12, 0x32, 0xfb, 0x5, 0x2c, 0x1, 0xd, 0x0, 0xcd, 
+0xd6, 0x15, 0xf1, 0x3c, 0xfe, 0x14, 0xc2, 0xe8, 0x33, 0xe1, 0xc1, 0xc9, 0x3a, 0xfb, 0x9, 0xfe, 
+0x14, 0xc8, 0xc6, 0x7, 0x32, 0xfc, 0x5, 0xe5, 0xd6, 0x7, 0xcb, 0x27, 0xcb, 0x27, 0xcb, 0x27, 
+0xcb, 0x27, 0xd2, 0x54, 0x34, 0x26, 0x7, 0xc3, 0x56, 0x34, 0x26, 0x6, 0x6f, 0xd5, 0x11, 0x63, 
+0x0, 0x19, 0xd1, 0x97, 0xf5, 0xc6, 0x12, 0x32, 0xfb, 0x5, 0x3e, 0x5f, 0xcd, 0xd3, 0x14, 0x3a, 
+0xfd, 0x1, 0xa7, 0xc2, 0x69, 0x34, 0x3a, 0xfd, 0x1, 0xa7, 0xca, 0x70, 0x34, 0xfe, 0x20, 0xd2, 
+0x89, 0x34, 0xfe, 0xd, 0xc2, 0x70, 0x67, 0x34, 0xf1, 0x97, 0xcd, 0xd3, 0x14, 0xc3, 0xa6, 0x34, 
+0xfe, 0x5b, 0xda, 0x98, 0x34, 0xfe, 0x61, 0xda, 0x70, 0x34, 0xfe, 0x7b, 0xd2, 0x70, 0x34, 0xd6, 
+0x20, 0x77, 0x2c, 0xcd, 0xd3, 0x14, 0xf1, 0x3c, 0xfe, 0xd, 0xc2, 0x5e, 0x34, 0xe1, 0xc9, 0xe5, 
+0xc5, 0x3e, 0x8f, 0xd3, 0x89, 0xcd, 0x4e, 0x3d, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xcb, 0x32, 
+0xcd, 0x49, 0x33, 0xcd, 0x8e, 0x33, 0x3e, 0x35, 0x32, 0x86, 0x9, 0xcd, 0x0, 0xa, 0x3a, 0xfb, 
+0x9, 0xfe, 0x14, 0xca, 0xde, 0x34, 0x21, 0x1, 0x2, 0x22, 0xfb, 0x5, 0x21, 0x0, 0x8, 0x1, 
+0x26, 0x0, 0xcd, 0xd6, 0x15, 0x21, 0x8, 0x4, 0x22, 0xfb, 0x5, 0x21, 0xea, 0x8, 0x1, 0xb, 
+0x0, 0xcd, 0xd6, 0x15, 0x21, 0x8, 0x5, 0x22, 0xfb, 0x5, 0x21, 0xf5, 0x8, 0xcd, 0xd6, 0x15, 
+0xcd, 0xe5, 0x33, 0xcd, 0x36, 0x34, 0x21, 0x68, 0xc, 0x1d, 0x22, 0xfb, 0x5, 0x21, 0xd9, 0xc, 
+0x1, 0x10, 0x0, 0xcd, 0xd6, 0x15, 0x3a, 0xfd, 0x1, 0xa7, 0xc2, 0xe, 0x35, 0x3a, 0xfd, 0x1, 
+0xfe, 0x59, 0xca, 0xb6, 0x34, 0xfe, 0x4e, 0xc2, 0x15, 0x35, 0xc1, 0xe1, 0xc9, 0x44, 0x49, 0x47, 
+0x47, 0x45, 0x52, 0x20, 0x20, 0x43, 0x4f, 0x4d, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x2, 
+0x0, 0x50, 0x3d, 0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x69, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc5, 0xd5, 
+0xe5, 0x2a, 0x38, 0x35, 0x11, 0x0, 0xfe, 0x19, 0x7d, 0xe6, 0x7f, 0xca, 0xbd, 0x35, 0x7d, 0xe6, 
+0x80, 0x6f, 0x11, 0x80, 0x0, 0x19, 0xcb, 0x3c, 0xcb, 0x1d, 0xcb, 0x3c, 0xcb, 0x1d, 0xcb, 0x3c, 
+0xcb, 0x1d, 0xcb, 0x3c, 0xcb, 0x1d, 0x29, 0xcb, 0x3c, 0xcb, 0x1d, 0xcb, 0x3c, 0xcb, 0x1d, 0xcb, 
+0x3c, 0xcb, 0x1d, 0xcb, 0x3c, 0xcb, 0x1d, 0x7d, 0x3d, 0xf5, 0xdd, 0x36, 0x5, 0x25, 0xdd, 0x36, 
+0x6, 0x35, 0x1, 0x0, 0x20, 0x21, 0xa5, 0x35, 0xcd, 0x3, 0xf0, 0x8, 0x11, 0x80, 0x0, 0x1, 
+0xa0, 0x0, 0xf1, 0x21, 0x0, 0x2, 0xdd, 0x75, 0x5, 0x6a, 0xdd, 0x74, 0x6, 0x19, 0xf5, 0xc5, 
+0xd5, 0xe5, 0xcd, 0x3, 0xf0, 0x1, 0xe1, 0xd1, 0xc1, 0xf1, 0x3d, 0xc2, 0xfd, 0x35, 0xdd, 0x75, 
+0x5, 0xdd, 0x74, 0x6, 0x19, 0xcd, 0x3, 0xf0, 0x9, 0xe1, 0xd1, 0xc1, 0xc9, 0x7, 0x7f, 0x1f, 
+0xff, 0x3f, 0xff, 0x7f, 0xff, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0x80, 0xff, 0x80, 0xf0, 0x1f, 0xfc, 
+0xf, 0xfe, 0x7, 0xff, 0x3, 0x0, 0x80, 0x0, 0xc0, 0x0, 0xe0, 0x0, 0xf0, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1, 
+0x0, 0x1, 0x0, 0x1, 0x0, 0xf8, 0xfe, 0xfc, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0x3c, 0xff, 0x7e, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x7f, 0xf, 0x7f, 0x1f, 0x7f, 0x3f, 0xff, 0xff, 0xf0, 0xff, 
+0xc0, 0xff, 0x80, 0xff, 0x80, 0xff, 0xf, 0xff, 0x3, 0xff, 0x6b, 0x1, 0xff, 0x1, 0x80, 0xfe, 
+0xf0, 0xfe, 0xf8, 0xfe, 0xfc, 0xff, 0xff, 0x0, 0xff, 0x0, 0xff, 0x0, 0xff, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0xff, 0x0, 0xff, 0x0, 0xff, 0x0, 0xff, 0xff, 0x0, 0xff, 0x0, 0x0, 0xfe, 
+0x0, 0xfe, 0xfe, 0x0, 0xfe, 0x0, 0xff, 0xf, 0xff, 0x3, 0xff, 0x1, 0xff, 0x1, 0x0, 0xf8, 
+0xc0, 0xfc, 0xe0, 0xfe, 0xf0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0xfe, 0xfe, 
+0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x0, 0xff, 0x0, 0xff, 0xff, 0x3, 0xff, 0x1, 0x3, 0xff, 
+0xf, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xfc, 0xc0, 0xf8, 0x0, 0xf0, 0x0, 0xe0, 0x0, 0xff, 0x3f, 
+0xff, 0x1f, 0x7f, 0x1f, 0x7f, 0xf, 0x0, 0xc0, 0x0, 0xe0, 0x80, 0xe0, 0x80, 0xf0, 0xf, 0x1, 
+0x7, 0x0, 0x3, 0x0, 0x3, 0x0, 0xf0, 0xfe, 0xf8, 0xff, 0xfc, 0x6c, 0xff, 0xfc, 0xff, 0xff, 
+0xc0, 0xff, 0xc0, 0xc0, 0xc3, 0xc0, 0xc3, 0xff, 0x0, 0xff, 0x0, 0x0, 0xff, 0x0, 0xff, 0xff, 
+0x3, 0xff, 0x3, 0x3, 0xc3, 0x3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 
+0xff, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x0, 0xff, 0x0, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x9f, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x3f, 0x6, 0x7f, 0xf, 0x99, 0x19, 0x99, 0x1f, 0x99, 0x0, 
+0xfc, 0xc, 0x98, 0x92, 0x98, 0x92, 0x98, 0x7f, 0x7f, 0x11, 0x91, 0x11, 0x91, 0x11, 0x60, 0xfc, 
+0xfc, 0x1a, 0x10, 0x1a, 0x10, 0x1e, 0xe0, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0xd9, 0xcb, 0x7f, 0xc2, 0x1d, 0x38, 0x26, 0x0, 0x87, 0xcb, 0x14, 0x87, 0xcb, 0x14, 0x87, 0xcb, 
+0x14, 0x6f, 0x11, 0x23, 0x36, 0x19, 0x3a, 0xfb, 0x5, 0xd6, 0x20, 0xd2, 0xd7, 0x37, 0xc6, 0x20, 
+0x4f, 0x3a, 0xfc, 0x5, 0x47, 0xf, 0xf, 0xe6, 0x40, 0x81, 0x5f, 0x78, 0xe6, 0x9e, 0xf6, 0x80, 
+0x57, 0xc3, 0xf3, 0x37, 0x1e, 0x0, 0x4f, 0x3a, 0xfc, 0x5, 0x47, 0xf, 0xcb, 0x1b, 0xcb, 0x3b, 
+0x87, 0x87, 0x87, 0xe6, 0x18, 0x83, 0x81, 0x5f, 0x78, 0xf, 0xf, 0xe6, 0x6, 0xf6, 0xa0, 0x57, 
+0x7b, 0xed, 0xa0, 0xc6, 0x20, 0x5f, 0xed, 0xa0, 0xc6, 0x60, 0x5f, 0xed, 0xa0, 0x6e, 0xc6, 0x20, 
+0x5f, 0xed, 0xa0, 0xcb, 0xc2, 0xc6, 0x60, 0x5f, 0xed, 0xa0, 0xc6, 0x20, 0x5f, 0xed, 0xa0, 0xc6, 
+0x60, 0x5f, 0xed, 0xa0, 0xc6, 0x20, 0x5f, 0xed, 0xa0, 0xd9, 0xc9, 0x26, 0x0, 0xcb, 0xbf, 0x87, 
+0xcb, 0x14, 0x87, 0xcb, 0x14, 0x87, 0xcb, 0x14, 0x6f, 0x11, 0x2a, 0x36, 0x19, 0x3a, 0xfb, 0x5, 
+0xd6, 0x20, 0xd2, 0x4d, 0x38, 0xc6, 0x20, 0x4f, 0x3a, 0xfc, 0x5, 0x47, 0xf, 0xf, 0xe6, 0x40, 
+0x81, 0x5f, 0x78, 0xe6, 0x9e, 0xf6, 0x80, 0x57, 0xc3, 0x69, 0x38, 0x1e, 0x0, 0x4f, 0x3a, 0xfc, 
+0x5, 0x47, 0xf, 0xcb, 0x1b, 0xcb, 0x3b, 0x87, 0x87, 0x87, 0xe6, 0x18, 0x83, 0x81, 0x5f, 0x78, 
+0xf, 0xf, 0xe6, 0x6, 0xf6, 0xa0, 0x57, 0x7b, 0xed, 0xa8, 0x0, 0x0, 0xc6, 0x20, 0x5f, 0xed, 
+0xa8, 0xc6, 0x60, 0x5f, 0xed, 0xa8, 0xc6, 0x20, 0x5f, 0xed, 0xa8, 0xcb, 0xc2, 0xc6, 0x6f, 0x60, 
+0x5f, 0xed, 0xa8, 0xc6, 0x20, 0x5f, 0xed, 0xa8, 0xc6, 0x60, 0x5f, 0xed, 0xa8, 0xc6, 0x20, 0x5f, 
+0xed, 0xa8, 0xd9, 0xc9, 0xc5, 0xe5, 0x21, 0x0, 0x0, 0x22, 0xfb, 0x5, 0x3e, 0x1c, 0xcd, 0xa3, 
+0x37, 0x6, 0x26, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x1d, 0xcd, 0xa3, 0x37, 0x5, 0xc2, 0xa4, 0x38, 
+0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x1e, 0xcd, 0xa3, 0x37, 0x21, 0x1, 0x1, 0x22, 0xfb, 0x5, 0x3e, 
+0x20, 0xcd, 0xa3, 0x37, 0x6, 0x24, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x21, 0xcd, 0xa3, 0x37, 0x5, 
+0xc2, 0xc7, 0x38, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x22, 0xcd, 0xa3, 0x37, 0x21, 0x2, 0x2, 0x22, 
+0xfb, 0x5, 0x3e, 0x1c, 0xcd, 0xa3, 0x37, 0x6, 0x22, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x1d, 0xcd, 
+0xa3, 0x37, 0x5, 0xc2, 0xea, 0x38, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x1e, 0xcd, 0xa3, 0x37, 0x70, 
+0x21, 0x0, 0x0, 0x6, 0x1e, 0x24, 0x22, 0xfb, 0x5, 0x3e, 0x1f, 0xcd, 0xa3, 0x37, 0x5, 0xc2, 
+0x5, 0x39, 0x21, 0x1, 0x1, 0x6, 0x1c, 0x24, 0x22, 0xfb, 0x5, 0x3e, 0x23, 0xcd, 0xa3, 0x37, 
+0x5, 0xc2, 0x17, 0x39, 0x21, 0x2, 0x2, 0x6, 0x1a, 0x24, 0x22, 0xfb, 0x5, 0x3e, 0x1f, 0xcd, 
+0xa3, 0x37, 0x5, 0xc2, 0x29, 0x39, 0x21, 0x27, 0x0, 0x6, 0x1e, 0x24, 0x22, 0xfb, 0x5, 0x3e, 
+0x1f, 0xcd, 0xa3, 0x37, 0x5, 0xc2, 0x3b, 0x39, 0x21, 0x26, 0x1, 0x6, 0x1e, 0x24, 0x22, 0xfb, 
+0x5, 0x3e, 0x29, 0xcd, 0xa3, 0x37, 0x5, 0xc2, 0x4d, 0x39, 0x21, 0x25, 0x2, 0x6, 0x1a, 0x24, 
+0x22, 0xfb, 0x5, 0x3e, 0x1f, 0xcd, 0xa3, 0x37, 0x5, 0xc2, 0x5f, 0x39, 0x21, 0x2, 0x1d, 0x22, 
+0xfb, 0x5, 0x3e, 0x9c, 0xcd, 0xa3, 0x37, 0x6, 0x22, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x1d, 0xcd, 
+0x71, 0xa3, 0x37, 0x5, 0xc2, 0x79, 0x39, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x9e, 0xcd, 0xa3, 0x37, 
+0x21, 0x1, 0x1e, 0x22, 0xfb, 0x5, 0x3e, 0xa0, 0xcd, 0xa3, 0x37, 0x6, 0x24, 0x2c, 0x22, 0xfb, 
+0x5, 0x3e, 0xa1, 0xcd, 0xa3, 0x37, 0x5, 0xc2, 0x9c, 0x39, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0xa2, 
+0xcd, 0xa3, 0x37, 0x21, 0x0, 0x1f, 0x22, 0xfb, 0x5, 0x3e, 0x9c, 0xcd, 0xa3, 0x37, 0x6, 0x26, 
+0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x1d, 0xcd, 0xa3, 0x37, 0x5, 0xc2, 0xbf, 0x39, 0x2c, 0x22, 0xfb, 
+0x5, 0x3e, 0x9e, 0xcd, 0xa3, 0x37, 0xe1, 0xc1, 0xc9, 0xe5, 0xc5, 0x7e, 0xcd, 0xa3, 0x37, 0x23, 
+0xb, 0x78, 0xb1, 0xca, 0xef, 0x39, 0x3a, 0xfb, 0x5, 0x3c, 0x32, 0xfb, 0x5, 0xc3, 0xda, 0x39, 
+0xc1, 0xe1, 0xc9, 0x0, 0x1, 0x2, 0x3, 0x5, 0x8, 0x5, 0x9, 0xa, 0xb, 0xc, 0x5, 0x9, 
+0xa, 0x72, 0xb, 0xc, 0x5, 0x0, 0x1, 0xd, 0xd, 0x5, 0x4, 0xd, 0x11, 0x12, 0x4, 0x5, 
+0x6, 0x7, 0x5, 0x4, 0x5, 0x4, 0x5, 0x5, 0xd, 0x5, 0x4, 0x5, 0x5, 0xd, 0x5, 0x4, 
+0x5, 0x5, 0x5, 0x5, 0x4, 0x5, 0x13, 0x14, 0x4, 0x5, 0x5, 0x4, 0x5, 0x4, 0x5, 0x4, 
+0x5, 0x24, 0xe, 0x5, 0x4, 0x5, 0x24, 0xe, 0x5, 0x4, 0xf, 0x10, 0x5, 0x5, 0x4, 0x15, 
+0x16, 0x17, 0x4, 0x5, 0x86, 0x87, 0x5, 0x4, 0x5, 0x4, 0x5, 0xa4, 0x4, 0x5, 0x4, 0x5, 
+0xa4, 0x4, 0x5, 0x4, 0x5, 0x5, 0x5, 0x5, 0x4, 0x5, 0x18, 0x19, 0x80, 0x81, 0x82, 0x83, 
+0x5, 0x88, 0x5, 0x89, 0x8a, 0x8b, 0x8c, 0x5, 0x89, 0x8a, 0x8b, 0x8c, 0x5, 0x80, 0x81, 0x8d, 
+0x8d, 0x5, 0x4, 0x5, 0x1a, 0x1b, 0xc5, 0xe5, 0x21, 0x7, 0x6, 0x22, 0xfb, 0x5, 0x21, 0xf2, 
+0x39, 0x1, 0x73, 0x1a, 0x0, 0xcd, 0xd8, 0x39, 0x21, 0x7, 0x7, 0x22, 0xfb, 0x5, 0x21, 0xc, 
+0x3a, 0xcd, 0xd8, 0x39, 0x21, 0x7, 0x8, 0x22, 0xfb, 0x5, 0x21, 0x26, 0x3a, 0xcd, 0xd8, 0x39, 
+0x21, 0x7, 0x9, 0x22, 0xfb, 0x5, 0x21, 0x40, 0x3a, 0xcd, 0xd8, 0x39, 0x21, 0x7, 0xa, 0x22, 
+0xfb, 0x5, 0x21, 0x5a, 0x3a, 0xcd, 0xd8, 0x39, 0xe1, 0xc1, 0xc9, 0x37, 0x32, 0x29, 0x34, 0x34, 
+0x25, 0x2e, 0x0, 0x22, 0x39, 0x0, 0x0, 0x21, 0x2c, 0x25, 0x38, 0x21, 0x2e, 0x24, 0x25, 0x32, 
+0x0, 0x2c, 0x21, 0x2e, 0x27, 0x27, 0x32, 0x21, 0x30, 0x28, 0x29, 0x38, 0x0, 0x22, 0x39, 0x0, 
+0x0, 0x33, 0x34, 0x25, 0x26, 0x21, 0x2e, 0x0, 0x0, 0x24, 0x21, 0x28, 0x2c, 0x2b, 0x25, 0x30, 
+0x1a, 0x0, 0x30, 0x2c, 0x21, 0x39, 0x33, 0x1a, 0x0, 0x33, 0x21, 0x36, 0x25, 0x2c, 0x1a, 0x0, 
+0x21, 0x0, 0x2c, 0x74, 0x2f, 0x2f, 0x2b, 0x0, 0x21, 0x34, 0x0, 0x34, 0x28, 0x25, 0x0, 0x32, 
+0x2f, 0x2f, 0x2d, 0x33, 0x28, 0x35, 0x2d, 0x22, 0x2f, 0x2c, 0x24, 0x34, 0xd, 0x35, 0x2e, 0x29, 
+0x36, 0x25, 0x32, 0x33, 0x29, 0x34, 0x39, 0x22, 0x25, 0x32, 0x2c, 0x29, 0x2e, 0x30, 0x2c, 0x25, 
+0x21, 0x33, 0x25, 0x0, 0x25, 0x2e, 0x34, 0x25, 0x32, 0x0, 0x34, 0x28, 0x25, 0x0, 0x23, 0x2f, 
+0x24, 0x25, 0x0, 0x1, 0x40, 0x0, 0x11, 0x19, 0x18, 0x18, 0xc5, 0xe5, 0x21, 0x7, 0xd, 0x22, 
+0xfb, 0x5, 0x21, 0xb8, 0x3a, 0x1, 0x1a, 0x0, 0xcd, 0xd6, 0x15, 0x21, 0x7, 0xf, 0x22, 0xfb, 
+0x5, 0x21, 0xd2, 0x3a, 0xcd, 0xd6, 0x15, 0x21, 0x7, 0x11, 0x22, 0xfb, 0x5, 0x21, 0x10, 0x3b, 
+0x1, 0x13, 0x0, 0xcd, 0xd6, 0x15, 0x21, 0x10, 0x12, 0x22, 0xfb, 0x5, 0x21, 0x23, 0x3b, 0x1, 
+0x6, 0x0, 0xcd, 0xd6, 0x75, 0x15, 0x21, 0x1f, 0x11, 0x22, 0xfb, 0x5, 0x3e, 0x25, 0xcd, 0xa3, 
+0x37, 0x2c, 0x22, 0xfb, 0x5, 0x3e, 0x26, 0xcd, 0xa3, 0x37, 0x24, 0x22, 0xfb, 0x5, 0x3e, 0x28, 
+0xcd, 0xa3, 0x37, 0x2d, 0x22, 0xfb, 0x5, 0x3e, 0x27, 0xcd, 0xa3, 0x37, 0x21, 0xb, 0x14, 0x22, 
+0xfb, 0x5, 0x21, 0xec, 0x3a, 0x1, 0x7, 0x0, 0xcd, 0xd6, 0x15, 0x3a, 0x4, 0x0, 0xa7, 0xca, 
+0xcc, 0x3b, 0x21, 0x16, 0x14, 0x22, 0xfb, 0x5, 0x21, 0xf3, 0x3a, 0x1, 0x7, 0x0, 0xcd, 0xd6, 
+0x15, 0x21, 0x9, 0x16, 0x22, 0xfb, 0x5, 0x21, 0xfa, 0x3a, 0x1, 0x16, 0x0, 0xcd, 0xd6, 0x15, 
+0x21, 0x1d, 0x19, 0x22, 0xfb, 0x5, 0x21, 0x40, 0x3b, 0x1, 0x6, 0x0, 0xcd, 0xd6, 0x15, 0x21, 
+0x1d, 0x1a, 0x22, 0xfb, 0x5, 0x21, 0x23, 0x3b, 0xcd, 0xd6, 0x15, 0xe1, 0xc1, 0xc9, 0xe5, 0x2a, 
+0x99, 0x9, 0x22, 0xe3, 0x5, 0x76, 0xcd, 0x80, 0x14, 0xcd, 0x80, 0x13, 0x3a, 0xfd, 0x1, 0xfe, 
+0xd, 0xc2, 0x6, 0x3c, 0x2a, 0xe3, 0x5, 0x7c, 0xb5, 0xc2, 0x0, 0x3c, 0xe1, 0xc9, 0xe5, 0x21, 
+0x5, 0x1a, 0x22, 0xfb, 0x5, 0x21, 0x29, 0x3b, 0x1, 0x17, 0x0, 0xcd, 0xd6, 0x15, 0x3a, 0xfd, 
+0x1, 0xa7, 0xc2, 0x28, 0x3c, 0x3a, 0xfd, 0x1, 0xa7, 0xca, 0x2f, 0x3c, 0xfe, 0xf, 0xc2, 0x0, 
+0xf0, 0xe1, 0xc9, 0x3e, 0xc9, 0x32, 0x3, 0x0, 0x3a, 0xfc, 0x9, 0x32, 0x4, 0x0, 0x3a, 0xfd, 
+0x9, 0x32, 0xfc, 0x9, 0xcd, 0x0, 0x13, 0xcd, 0x74, 0x3a, 0xcd, 0x46, 0x3b, 0x3a, 0xfd, 0x1, 
+0xa7, 0xca, 0x57, 0x3c, 0xfe, 0x50, 0xc2, 0x6d, 0x3c, 0xcd, 0xa8, 0x34, 0x97, 0x32, 0x4, 0x0, 
+0xc3, 0x4e, 0x3c, 0xfe, 0x4c, 0xc2, 0x78, 0x3c, 0xcd, 0x0, 0x14, 0xc3, 0x4e, 0x3c, 0xfe, 0x53, 
+0xc2, 0x8a, 0x3c, 0x3a, 0x4, 0x0, 0x77, 0xa7, 0xca, 0x57, 0x3c, 0xcd, 0xa5, 0x35, 0xc3, 0x57, 
+0x3c, 0xfe, 0x63, 0xca, 0x18, 0x3c, 0xfe, 0x51, 0xc2, 0x57, 0x3c, 0xcd, 0x0, 0x0, 0xc3, 0x4e, 
+0x3c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf3, 0xf5, 0x3a, 0xfe, 0x9, 
+0x3d, 0xca, 0x11, 0x3d, 0x32, 0xfe, 0x9, 0x78, 0x3e, 0x85, 0xd3, 0x8d, 0x3a, 0xff, 0x9, 0x3c, 
+0x32, 0xff, 0x9, 0xd3, 0x8d, 0xf1, 0xfb, 0xed, 0x4d, 0x3e, 0x3, 0xd3, 0x8d, 0xf1, 0xfb, 0xed, 
+0x4d, 0xe5, 0x21, 0xf4, 0x3c, 0x22, 0xea, 0x1, 0x3e, 0x14, 0x32, 0xfe, 0x9, 0x3e, 0x85, 0xd3, 
+0x8d, 0x3e, 0xff, 0x32, 0xff, 0x9, 0xd3, 0x8d, 0xe1, 0xc9, 0xf3, 0xf5, 0xe5, 0x2a, 0xc5, 0x32, 
+0x2b, 0x7c, 0xb6, 0xc2, 0x46, 0x3d, 0x3e, 0x1, 0x32, 0xf9, 0x5, 0x2a, 0xaa, 0x9, 0x22, 0xc5, 
+0x32, 0xe1, 0xf1, 0xfb, 0xed, 0x4d, 0xe5, 0x21, 0x32, 0x3d, 0x22, 0xec, 0x1, 0x2a, 0xaa, 0x9, 
+0x22, 0xc5, 0x32, 0x3e, 0x85, 0xd3, 0x8e, 0x3e, 0x21, 0xd3, 0x8e, 0xe1, 0xc9, 0x3a, 0xf9, 0x5, 
+0xa7, 0xca, 0x65, 0x3d, 0x97, 0x32, 0xf9, 0x5, 0xc9, 0xcd, 0x1e, 0x1a, 0x3a, 0xf8, 0x5, 0xf5, 
+0xc5, 0xd5, 0xe5, 0x1, 0x5a, 0x0, 0x11, 0x9a, 0x79, 0x3c, 0x21, 0xfd, 0x5, 0xed, 0xb0, 0xcd, 
+0x50, 0x13, 0x21, 0x9a, 0x3c, 0x7e, 0xa7, 0xc2, 0x99, 0x3d, 0xe1, 0xd1, 0xc1, 0xf1, 0x32, 0xf8, 
+0x5, 0xc9, 0x2c, 0x7e, 0xcb, 0x5f, 0xca, 0xc5, 0x3d, 0xcb, 0x57, 0xca, 0xb1, 0x3d, 0xe6, 0x1, 
+0x47, 0x2d, 0x7e, 0xc6, 0x14, 0x4f, 0xe5, 0xc3, 0xe7, 0x3d, 0xe6, 0x1, 0xf, 0x47, 0x2d, 0x7e, 
+0xe5, 0x68, 0x67, 0x11, 0x80, 0x9, 0x19, 0x45, 0x4c, 0xcb, 0x0, 0xc3, 0xe7, 0x3d, 0xcb, 0x57, 
+0xca, 0xde, 0x3d, 0xe6, 0x1, 0xf, 0x47, 0x2d, 0x7e, 0xe5, 0x68, 0x67, 0x11, 0x80, 0xa, 0x19, 
+0x45, 0x4c, 0xcb, 0x0, 0xc3, 0xe7, 0x3d, 0xe6, 0x1, 0x47, 0x2d, 0x7e, 0xc6, 0xa, 0x4f, 0xe5, 
+0x21, 0xfd, 0x5, 0x7e, 0xa7, 0xc2, 0xfb, 0x3d, 0xcd, 0x19, 0x3d, 0xe1, 0xe1, 0xd1, 0xc1, 0xf1, 
+0x32, 0xf8, 0x5, 0xc9, 0xb9, 0xc2, 0xc, 0x3e, 0x23, 0x7a, 0x7e, 0xa8, 0xe6, 0xfd, 0x0, 0x0, 
+0xc2, 0xd, 0x3e, 0xc3, 0x11, 0x3e, 0x23, 0x23, 0xc3, 0xea, 0x3d, 0xe1, 0x2c, 0x2c, 0xc3, 0x8c, 
+0x3d, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x22, 0x22, 0x22, 0x1c, 0x12, 0x62, 0x22, 
+0x26, 0x56, 0x60, 0x12, 0x66, 0x62, 0x11, 0x12, 0x62, 0x22, 0x26, 0x56, 0x60, 0x22, 0x65, 0x62, 
+0x11, 0x12, 0x62, 0x66, 0x66, 0x56, 0x60, 0x25, 0x65, 0x66, 0x22, 0x22, 0x52, 0x62, 0x22, 0x56, 
+0x60, 0x25, 0x55, 0x56, 0x66, 0x52, 0x22, 0x62, 0x21, 0x56, 0x66, 0x66, 0x66, 0x55, 0x56, 0x56, 
+0x66, 0x62, 0x22, 0x56, 0x61, 0x11, 0x12, 0x55, 0x56, 0x56, 0x65, 0x52, 0x21, 0x56, 0x66, 0x15, 
+0x20, 0x56, 0x56, 0x56, 0x62, 0x52, 0x21, 0x56, 0x61, 0x15, 0xa0, 0x66, 0x56, 0x56, 0x62, 0x52, 
+0x21, 0x56, 0x66, 0x15, 0x20, 0x65, 0x56, 0x56, 0x62, 0x52, 0x21, 0x56, 0x61, 0x15, 0x20, 0x65, 
+0x52, 0x12, 0x55, 0x52, 0x21, 0x56, 0x66, 0x15, 0x21, 0x65, 0x52, 0x12, 0x55, 0x52, 0x7f, 0x22, 
+0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x1, 0x0, 0x40, 0x9c, 0x40, 
+0x4, 0xb, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x6a, 0x1, 0x2, 0x22, 0x22, 0x22, 0x22, 0x0, 0x1, 0x16, 0x66, 
+0x66, 0x2, 0x26, 0x66, 0x61, 0x62, 0x55, 0x55, 0x56, 0x62, 0x22, 0x2, 0x26, 0x55, 0x61, 0x62, 
+0x22, 0x22, 0x26, 0x62, 0x51, 0x51, 0x26, 0x55, 0x61, 0x62, 0x0, 0x1, 0x16, 0x62, 0x26, 0x56, 
+0x66, 0x55, 0x61, 0x62, 0x55, 0x55, 0x56, 0x62, 0x26, 0x55, 0x56, 0x55, 0x51, 0x62, 0x22, 0x22, 
+0x26, 0x62, 0x26, 0x56, 0x56, 0x55, 0x61, 0x62, 0x22, 0x22, 0x26, 0x62, 0x26, 0x55, 0x66, 0x66, 
+0x61, 0x62, 0x22, 0x22, 0x26, 0x62, 0x26, 0x65, 0x55, 0x6c, 0x21, 0x22, 0x22, 0x22, 0x26, 0x80, 
+0x62, 0x22, 0x66, 0x56, 0x22, 0x26, 0x66, 0x66, 0x22, 0x16, 0x62, 0x22, 0x26, 0x66, 0x22, 0x22, 
+0x22, 0x22, 0x21, 0x16, 0x62, 0x20, 0x2, 0x22, 0x21, 0x11, 0x55, 0x55, 0x55, 0x56, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x2, 0x9c, 0x40, 0x38, 0x41, 0x1, 0x3, 0x42, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x61, 0x11, 0x16, 0x60, 0x2, 0x22, 0x22, 
+0x22, 0x22, 0x22, 0x61, 0x11, 0x16, 0x60, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6e, 0xee, 0xe6, 
+0x60, 0x2, 0x66, 0x22, 0x22, 0x22, 0x21, 0x22, 0x22, 0xa6, 0x60, 0x2, 0x22, 0x26, 0x22, 0x22, 
+0x25, 0x25, 0x22, 0xc6, 0x60, 0x2, 0x22, 0x22, 0x22, 0x12, 0x22, 0x21, 0x25, 0x56, 0x6e, 0x22, 
+0x81, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x60, 0x6, 0x56, 0x56, 0x15, 0x56, 0x66, 
+0x66, 0x66, 0x66, 0x60, 0x6, 0x6, 0x56, 0x15, 0x56, 0x0, 0x0, 0x0, 0x56, 0x60, 0x6, 0x6, 
+0x56, 0x65, 0x66, 0x0, 0x0, 0x0, 0x56, 0x60, 0x0, 0x6, 0x6, 0x65, 0x60, 0x0, 0x0, 0x0, 
+0x56, 0x60, 0x0, 0x0, 0x6, 0x65, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x3, 0x38, 0x41, 0xd4, 0x41, 0x12, 0x6, 0x36, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 
+0x55, 0x55, 0x55, 0x65, 0x15, 0x15, 0x15, 0x15, 0x16, 0x60, 0x0, 0x70, 0x0, 0x60, 0x7, 0x0, 
+0x0, 0x0, 0x6, 0x61, 0x11, 0x11, 0x11, 0x62, 0x22, 0x22, 0x22, 0x22, 0xc6, 0x61, 0x11, 0x11, 
+0x11, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x6e, 0xee, 0xee, 0xe2, 0x22, 0x22, 0x11, 0x11, 
+0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x15, 0x15, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 
+0x12, 0x22, 0x66, 0x66, 0x22, 0x26, 0x61, 0x11, 0x11, 0x21, 0x12, 0x22, 0x22, 0x26, 0x22, 0x16, 
+0x62, 0x22, 0x2a, 0x22, 0x11, 0x12, 0x22, 0x16, 0x12, 0x56, 0x66, 0x66, 0x66, 0x22, 0x12, 0x22, 
+0x25, 0x56, 0x52, 0x26, 0x62, 0x21, 0x21, 0x22, 0x12, 0x22, 0x52, 0x26, 0x22, 0x16, 0x65, 0x12, 
+0x22, 0x21, 0x12, 0x21, 0x11, 0x16, 0x22, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x4, 0xd4, 0x41, 0x70, 0x42, 0x5, 0xb, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 
+0x15, 0x55, 0x83, 0x56, 0xbb, 0xbb, 0xc6, 0x62, 0x22, 0x22, 0x22, 0xe5, 0x55, 0x56, 0xbb, 0xbb, 
+0xb6, 0x63, 0x0, 0x0, 0x0, 0x15, 0x55, 0x56, 0xb, 0xbb, 0xb6, 0x62, 0x22, 0x22, 0x22, 0xe5, 
+0x55, 0x56, 0x0, 0x0, 0x6, 0x62, 0x22, 0x22, 0x22, 0x15, 0x55, 0x56, 0x10, 0x0, 0x6, 0x62, 
+0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x16, 0x66, 0x66, 0x63, 0x10, 0x2, 0x22, 0x22, 0x22, 0x22, 
+0x12, 0x22, 0x26, 0x61, 0x12, 0x22, 0x20, 0x22, 0x22, 0x22, 0x12, 0x22, 0x26, 0x61, 0x12, 0x52, 
+0x20, 0x22, 0x22, 0x22, 0x12, 0x22, 0x26, 0x61, 0x15, 0x55, 0x20, 0x22, 0x22, 0x22, 0x12, 0x22, 
+0x26, 0x61, 0x11, 0x11, 0x20, 0x22, 0x22, 0x22, 0x12, 0x22, 0x26, 0x62, 0xa2, 0x22, 0x23, 0x22, 
+0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x5, 
+0x70, 0x42, 0xc, 0x84, 0x43, 0x2, 0xe, 0x26, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x6b, 0x0, 
+0x0, 0x0, 0x0, 0x6, 0x63, 0x0, 0x30, 0x5, 0x66, 0x60, 0x66, 0x66, 0x3, 0x6, 0x62, 0x22, 
+0x26, 0x26, 0x60, 0x0, 0x0, 0x6, 0x0, 0x6, 0x60, 0x0, 0x36, 0xb6, 0x66, 0x26, 0x66, 0x6, 
+0x30, 0x6, 0x62, 0x22, 0x26, 0x6, 0x30, 0x0, 0x6, 0x6, 0x3, 0x6, 0x60, 0x3, 0x6, 0x6, 
+0x55, 0x55, 0x56, 0x6, 0x0, 0x6, 0x62, 0x22, 0x26, 0x6, 0x55, 0x55, 0x36, 0x6, 0x30, 0x6, 
+0x60, 0x30, 0x6, 0x6, 0x55, 0x55, 0x56, 0x6, 0x3, 0x6, 0x62, 0x22, 0x26, 0x6, 0x66, 0x66, 
+0x66, 0x6, 0x0, 0x6, 0x63, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x6, 0x30, 0x6, 0x62, 0x22, 
+0x26, 0x66, 0x66, 0x66, 0x85, 0x66, 0x66, 0x0, 0x6, 0x6a, 0x22, 0x26, 0xc0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6, 0xc, 0x43, 
+0xa8, 0x43, 0x1, 0xe, 0x15, 0x22, 0x20, 0x30, 0x2, 0x2, 0x30, 0x20, 0x20, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x22, 
+0x26, 0x62, 0x12, 0x12, 0x12, 0x12, 0x12, 0x22, 0x22, 0x22, 0x26, 0x61, 0x21, 0x21, 0x21, 0x21, 
+0x21, 0x22, 0x22, 0x22, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x2, 0xe2, 0x22, 0x26, 0x62, 
+0x11, 0x11, 0x11, 0x11, 0x11, 0xe6, 0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6, 
+0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x20, 0x6, 0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 
+0x22, 0x22, 0x0, 0x6, 0x22, 0x86, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x20, 0x0, 0x6, 0x22, 
+0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 
+0x22, 0x21, 0x16, 0x66, 0x66, 0x26, 0x6a, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2c, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7, 0xa8, 0x43, 0x44, 0x44, 0x1, 
+0xe, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x62, 0x22, 
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
+0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 
+0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x87, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
+0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 
+0x22, 0x22, 0x22, 0x22, 0x26, 0x6b, 0xbb, 0xbb, 0xbb, 0xb0, 0x0, 0x0, 0x21, 0x22, 0x26, 0x6b, 
+0xbb, 0xbb, 0xbb, 0xb0, 0x0, 0x0, 0x1, 0x12, 0x26, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
+0x52, 0x22, 0x26, 0x6c, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x22, 0xa6, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x8, 0x44, 0x44, 0xe0, 0x44, 0x12, 0xe, 0x27, 0x22, 
+0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x62, 0x11, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x26, 0x16, 0x62, 0x22, 0x22, 0x22, 0x22, 
+0x22, 0x22, 0x22, 0x26, 0x16, 0x62, 0x22, 0x88, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x16, 
+0x6a, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x26, 0x62, 0x21, 0x21, 0x21, 0x6, 0x22, 
+0x22, 0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x6, 0x22, 0x62, 0x22, 0x22, 0x26, 0x62, 0x22, 
+0x22, 0x22, 0x26, 0x22, 0x62, 0x0, 0x20, 0x26, 0x62, 0x22, 0x21, 0x21, 0x26, 0x22, 0x6e, 0xee, 
+0xee, 0xe6, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x60, 0x0, 0x0, 0x6, 0x60, 0x3, 0x3, 0x0, 
+0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x66, 0x60, 0x0, 0x3, 0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 
+0x6c, 0x65, 0x5, 0x22, 0x22, 0x25, 0x60, 0x0, 0x0, 0x6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x9, 0xe0, 0x44, 0x7c, 0x45, 0x1, 0x6, 0x12, 0x32, 0x20, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x89, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 
+0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x16, 0x61, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 
+0x21, 0x21, 0x16, 0x62, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x66, 0x61, 0x21, 0x21, 
+0x21, 0x21, 0x21, 0x21, 0x21, 0x22, 0x66, 0x62, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x22, 
+0x66, 0x61, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x26, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 
+0x22, 0x22, 0x22, 0x22, 0x26, 0x62, 0x22, 0x22, 0x26, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x62, 
+0x22, 0x22, 0x26, 0x60, 0x22, 0x22, 0x22, 0x0, 0xb6, 0x62, 0x22, 0x22, 0x26, 0x60, 0x66, 0x22, 
+0x22, 0x22, 0x26, 0x6a, 0x22, 0x22, 0x26, 0x60, 0x6e, 0x22, 0x22, 0x22, 0x26, 0x6c, 0x22, 0x22, 
+0x26, 0x60, 0x62, 0x22, 0x22, 0x22, 0x26, 0x66, 0x66, 0x8a, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x10, 0x7c, 0x45, 0x18, 0x46, 0x1, 0xd, 0x20, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0xb, 0x0, 0x2, 
+0x2, 0x2, 0x2, 0x2, 0x2, 0x56, 0x65, 0x55, 0x55, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x56, 
+0x66, 0x66, 0x66, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x56, 0x60, 0x0, 0x0, 0x6, 0x32, 0x32, 
+0x32, 0x32, 0x32, 0x56, 0x60, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x56, 0x60, 0x0, 
+0x0, 0x6, 0x6c, 0x55, 0x22, 0x22, 0x62, 0x26, 0x66, 0x66, 0x66, 0x0, 0x66, 0x66, 0x22, 0x22, 
+0x62, 0x26, 0x60, 0x0, 0x0, 0x6, 0x65, 0x55, 0x20, 0x0, 0x62, 0x26, 0x60, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x20, 0xb0, 0x62, 0x26, 0x60, 0x0, 0x0, 0xa6, 0x8b, 0x55, 0x55, 0x20, 0x0, 0x62, 
+0x26, 0x66, 0x66, 0x66, 0x6, 0x66, 0x66, 0x20, 0xb0, 0x62, 0x26, 0x60, 0x0, 0x0, 0x6, 0x55, 
+0x55, 0x20, 0x0, 0x62, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 
+0x18, 0x46, 0xb4, 0x46, 0x6, 0xc, 0x23, 0x22, 0x11, 0x11, 0x12, 0x30, 0x0, 0x0, 0x0, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x0, 0x2, 0x55, 0x12, 0x22, 0x12, 
+0x12, 0x12, 0x16, 0x61, 0x22, 0x2, 0x55, 0x52, 0x2, 0x12, 0x12, 0x21, 0x26, 0x65, 0x12, 0x0, 
+0x55, 0x52, 0x22, 0x12, 0x12, 0x21, 0x26, 0x61, 0x12, 0x0, 0x56, 0x66, 0x22, 0x12, 0x12, 0x12, 
+0x16, 0x61, 0x12, 0x5, 0x66, 0x22, 0x22, 0x12, 0x12, 0x12, 0x16, 0x66, 0x60, 0x6, 0x65, 0x22, 
+0x22, 0x22, 0x22, 0x22, 0x26, 0x61, 0x60, 0x15, 0x15, 0x60, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x6, 
+0x61, 0x60, 0x66, 0x66, 0x55, 0x63, 0x0, 0x30, 0x0, 0x36, 0x60, 0xa0, 0x65, 0x56, 0x55, 0x66, 
+0x3, 0x30, 0x30, 0x6, 0x66, 0x63, 0x66, 0x56, 0x55, 0x56, 0x3, 0x3, 0x33, 0x6, 0x66, 0x3, 
+0x6, 0x56, 0x66, 0x56, 0x30, 0x3, 0x0, 0x36, 0x66, 0xcc, 0xc6, 0x55, 0x55, 0x56, 0x30, 0x0, 
+0x0, 0x6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x12, 0xb4, 0x46, 0x50, 
+0x47, 0x2, 0xb, 0x30, 0x22, 0x33, 0x33, 0x22, 0x23, 0x22, 0x33, 0x32, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x16, 0x21, 0x11, 0x11, 0x12, 0x26, 
+0x62, 0x22, 0x22, 0x22, 0x26, 0x21, 0x11, 0x11, 0x12, 0x26, 0x6b, 0x0, 0x2, 0x25, 0x56, 0x22, 
+0x22, 0x22, 0x22, 0x26, 0x6b, 0x22, 0x22, 0x26, 0x66, 0x22, 0x22, 0x22, 0x8d, 0x22, 0x26, 0x66, 
+0x66, 0x66, 0x25, 0x56, 0x22, 0x66, 0x66, 0x22, 0x26, 0x62, 0x22, 0x22, 0x26, 0x66, 0x62, 0x6b, 
+0xb6, 0x26, 0x26, 0x62, 0x22, 0x20, 0x16, 0x55, 0x22, 0x6b, 0xb6, 0x26, 0x6, 0x62, 0x22, 0x0, 
+0x16, 0x55, 0x52, 0x60, 0x6, 0x26, 0x6, 0x62, 0x20, 0x0, 0x16, 0x66, 0x62, 0x6b, 0xb6, 0x26, 
+0x6, 0x62, 0x0, 0x0, 0x16, 0x30, 0x0, 0x65, 0x56, 0x26, 0x6, 0x60, 0x0, 0x0, 0x16, 0x55, 
+0x55, 0x65, 0x56, 0x26, 0x6, 0x60, 0xa, 0x0, 0x16, 0x55, 0x55, 0xc5, 0x5c, 0x26, 0xb6, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x13, 0x50, 0x47, 0xec, 0x47, 0x3, 0xe, 
+0x20, 0x20, 0x11, 0x11, 0x11, 0x21, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x62, 0x15, 0x11, 0x22, 0x61, 0x16, 0x22, 0x21, 0x22, 0x56, 0x8e, 0x62, 0x15, 
+0x22, 0x22, 0xa2, 0x20, 0x0, 0x2, 0x66, 0x66, 0x62, 0x15, 0x66, 0x12, 0x0, 0x60, 0x0, 0x2, 
+0x21, 0x56, 0x62, 0x11, 0x16, 0x10, 0x1, 0x60, 0x22, 0x22, 0x21, 0x26, 0x62, 0x21, 0x56, 0x60, 
+0x22, 0x62, 0x22, 0x30, 0x2, 0x16, 0x66, 0x66, 0x12, 0x5, 0x15, 0x65, 0x62, 0x3, 0x1, 0x26, 
+0x62, 0x22, 0x12, 0x51, 0x11, 0x65, 0x62, 0x0, 0x32, 0x16, 0x62, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x62, 0x3, 0x1, 0x26, 0x61, 0x21, 0x11, 0x1, 0x25, 0x55, 0x11, 0x22, 0x22, 0x26, 0x6e, 0x11, 
+0x22, 0x22, 0x22, 0x52, 0x22, 0x22, 0x21, 0x26, 0x65, 0x25, 0x30, 0x0, 0x0, 0x10, 0x0, 0x12, 
+0x15, 0x16, 0x65, 0x1, 0x12, 0x52, 0x21, 0x20, 0xc, 0x21, 0x51, 0x56, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x14, 0xec, 0x47, 0x88, 0x48, 0x8, 0x4, 0x20, 0x8f, 0x23, 
+0x23, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x62, 0x21, 0x11, 0x0, 0x2, 0x21, 0x22, 0x21, 0x0, 0x16, 0x61, 0x21, 0x11, 0x12, 0x22, 
+0x26, 0x12, 0x16, 0x2, 0x26, 0x61, 0x25, 0x55, 0x51, 0x11, 0x26, 0x21, 0x26, 0x52, 0x16, 0x62, 
+0x26, 0x66, 0x66, 0x66, 0x26, 0x22, 0x21, 0x22, 0x16, 0x60, 0x0, 0x0, 0x61, 0x11, 0x26, 0x22, 
+0x16, 0x66, 0x66, 0x60, 0x60, 0x60, 0x62, 0x22, 0x22, 0x22, 0x16, 0x0, 0x6, 0x60, 0x67, 0x60, 
+0x62, 0x66, 0x61, 0x12, 0x26, 0x76, 0x66, 0x60, 0x66, 0x60, 0x62, 0x65, 0x11, 0x22, 0x26, 0x0, 
+0x66, 0x60, 0x67, 0x60, 0x62, 0x66, 0x61, 0x22, 0x26, 0x66, 0x66, 0x60, 0x60, 0x60, 0x62, 0x52, 
+0x61, 0x56, 0x70, 0x0, 0x56, 0x60, 0x60, 0x60, 0x62, 0x66, 0x61, 0x16, 0x2, 0x20, 0x26, 0x90, 
+0x6a, 0x5, 0x0, 0x62, 0x22, 0x15, 0x56, 0x0, 0x7, 0x56, 0x66, 0x66, 0x66, 0x66, 0x6c, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x15, 0x88, 0x48, 0x24, 0x49, 0x1, 0xe, 0x7, 0x11, 0x10, 0x10, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 
+0x61, 0x11, 0x62, 0x22, 0x2c, 0x11, 0x11, 0x16, 0x62, 0xa2, 0x61, 0x11, 0x60, 0x3, 0x6, 0x11, 
+0x11, 0x16, 0x62, 0x2, 0x61, 0x11, 0x60, 0x0, 0x36, 0x66, 0x55, 0x56, 0x62, 0x2, 0x61, 0x11, 
+0x60, 0x3, 0x6, 0x55, 0x55, 0x56, 0x62, 0x2, 0x61, 0x11, 0x60, 0x30, 0x6, 0x22, 0x22, 0x26, 
+0x62, 0x22, 0x66, 0x16, 0x63, 0x0, 0x6, 0x25, 0x22, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 
+0x22, 0x22, 0x52, 0x26, 0x62, 0x25, 0x55, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x56, 0x62, 0x22, 
+0x91, 0x22, 0x22, 0x12, 0x12, 0x22, 0x52, 0x52, 0x26, 0x62, 0x22, 0x22, 0x22, 0x12, 0x12, 0x22, 
+0x22, 0x25, 0x26, 0x66, 0x66, 0x66, 0x66, 0x62, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x0, 0x0, 
+0x0, 0x0, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x16, 0x24, 0x49, 0xc0, 0x49, 0x2, 0x4, 0x20, 0x22, 0x33, 0x33, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x11, 0x11, 
+0x12, 0x25, 0x15, 0x12, 0x26, 0x62, 0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0x16, 0x21, 0x26, 0x62, 
+0x22, 0x22, 0x22, 0x22, 0x26, 0xb6, 0x16, 0xb2, 0x26, 0x6a, 0x52, 0x52, 0x52, 0x52, 0x26, 0x66, 
+0x16, 0x55, 0x26, 0x62, 0x6e, 0xee, 0x62, 0x62, 0x26, 0x56, 0x16, 0x66, 0x26, 0x63, 0x60, 0x0, 
+0x62, 0x92, 0x62, 0x2, 0x22, 0x22, 0x22, 0x26, 0x62, 0x60, 0x0, 0x62, 0x62, 0x2, 0x52, 0x12, 
+0x52, 0x26, 0x62, 0x66, 0x66, 0x62, 0x62, 0x2, 0x52, 0x12, 0x22, 0x26, 0x62, 0x65, 0x55, 0x62, 
+0x62, 0x2, 0x22, 0x12, 0x22, 0x26, 0x62, 0x65, 0x55, 0x62, 0x62, 0x32, 0x52, 0x12, 0x22, 0x26, 
+0x62, 0x65, 0x55, 0x62, 0x66, 0x66, 0x62, 0x12, 0x21, 0x56, 0x62, 0x22, 0x22, 0x23, 0x25, 0x22, 
+0x32, 0x12, 0x25, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xc6, 0x66, 0x66, 0x17, 0xc0, 
+0x49, 0x5c, 0x4a, 0x1, 0x6, 0x31, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x26, 0x56, 0x22, 0x20, 0x23, 0x22, 0x22, 
+0x22, 0x16, 0x62, 0x26, 0x66, 0x22, 0x20, 0x20, 0x22, 0x66, 0x66, 0x26, 0x61, 0x16, 0x22, 0x22, 
+0x23, 0x20, 0x93, 0x22, 0x63, 0x0, 0x26, 0x62, 0x26, 0x22, 0x22, 0x20, 0x20, 0x22, 0x62, 0x22, 
+0x26, 0x62, 0x21, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x62, 0x26, 0x2, 0x21, 0x21, 
+0x21, 0x21, 0x22, 0x11, 0x26, 0x62, 0x26, 0x2, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0x66, 0x26, 0x62, 
+0x16, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x62, 0x26, 0x62, 0x26, 0x55, 0x15, 0x16, 0xb6, 0x15, 
+0xb, 0x62, 0x26, 0x62, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6e, 0x66, 0x60, 0x0, 0x0, 
+0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x6, 0x6c, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 
+0x6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 0x5c, 0x4a, 0xf8, 0x4a, 
+0x2, 0xe, 0x1, 0x0, 0x2, 0x0, 0x23, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x94, 0x66, 0x66, 0x61, 0x11, 0x11, 0x6b, 0x1, 0x11, 0x22, 0x21, 0x21, 0xc6, 
+0x61, 0x11, 0x11, 0x60, 0x1, 0x11, 0x22, 0x21, 0x22, 0x26, 0x61, 0x11, 0x11, 0x60, 0x2, 0x22, 
+0x22, 0x66, 0x66, 0x66, 0x61, 0x11, 0x11, 0x62, 0x22, 0x22, 0x21, 0x11, 0x11, 0x16, 0x6e, 0xee, 
+0xee, 0x62, 0x22, 0x5b, 0x0, 0x0, 0x0, 0x6, 0x62, 0x22, 0x22, 0x22, 0x26, 0x66, 0x22, 0x22, 
+0x22, 0x26, 0x63, 0x0, 0x0, 0x5, 0x51, 0x16, 0x0, 0x30, 0x0, 0x6, 0x62, 0x22, 0x22, 0x22, 
+0x22, 0x26, 0x30, 0x0, 0x0, 0x6, 0x63, 0x0, 0x0, 0x0, 0x1, 0x16, 0x0, 0x0, 0x30, 0x6, 
+0x62, 0x22, 0x22, 0x25, 0x22, 0x16, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x26, 
+0x21, 0x21, 0x21, 0x26, 0x6a, 0x22, 0x22, 0x22, 0x22, 0x26, 0x22, 0x52, 0x52, 0x56, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x95, 0x66, 0x66, 0x66, 0x66, 0x19, 0xf8, 0x4a, 0x94, 0x4b, 0x1, 0xe, 
+0x27, 0x20, 0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x65, 0x11, 0x15, 0x51, 0x21, 0x11, 0x12, 0x22, 0x22, 0x6, 0x65, 0x11, 0x65, 
+0x11, 0x62, 0x22, 0x61, 0x12, 0xc6, 0x6, 0x66, 0x61, 0x12, 0x61, 0x51, 0x62, 0x12, 0x62, 0x11, 
+0x6, 0x60, 0x11, 0x65, 0x11, 0x61, 0x11, 0x62, 0x22, 0x66, 0x6, 0x6b, 0x61, 0x15, 0x62, 0x12, 
+0x62, 0x12, 0x62, 0x11, 0x6, 0x60, 0x51, 0x61, 0x51, 0x62, 0x22, 0x62, 0x12, 0x66, 0x6, 0x66, 
+0x62, 0x51, 0x61, 0x22, 0x62, 0x22, 0x62, 0x11, 0x6, 0x60, 0xb2, 0x61, 0x11, 0x62, 0x22, 0x62, 
+0x22, 0x66, 0x6, 0x60, 0x62, 0x22, 0x62, 0x22, 0x61, 0x22, 0x62, 0x11, 0x6, 0x60, 0x2, 0x62, 
+0x22, 0x62, 0x22, 0x62, 0x12, 0x96, 0x22, 0x6, 0x66, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 
+0x22, 0x6, 0x6a, 0x2b, 0x0, 0xb0, 0xb, 0x0, 0x0, 0x0, 0x0, 0x6, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x20, 0x94, 0x4b, 0x30, 0x4c, 0x1, 0xe, 0x9, 0x20, 0x22, 
+0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x61, 0x22, 0x11, 0x16, 0x25, 0x51, 0x60, 0x0, 0x7, 0x66, 0x61, 0x22, 0x22, 0x66, 0x21, 0x51, 
+0x60, 0x55, 0x55, 0x6, 0x62, 0x22, 0x22, 0x2a, 0x25, 0xbc, 0x60, 0x66, 0x66, 0x6, 0x62, 0x52, 
+0x0, 0x66, 0xe6, 0x66, 0x60, 0x0, 0x0, 0x6, 0x66, 0x26, 0x66, 0x66, 0x2, 0x22, 0x22, 0x22, 
+0x22, 0x26, 0x63, 0x0, 0x0, 0x66, 0x0, 0x0, 0x0, 0x0, 0x36, 0x66, 0x66, 0x22, 0x22, 0x66, 
+0x0, 0x0, 0x3, 0x0, 0x0, 0x6, 0x97, 0x63, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x62, 0x22, 0x22, 0x26, 0x32, 0x60, 0x0, 0x30, 0x0, 0x6, 0x66, 0x66, 0x66, 0x66, 0x2, 
+0x62, 0x62, 0x26, 0x26, 0x26, 0x60, 0x11, 0x12, 0x22, 0x2, 0x62, 0x66, 0x66, 0x66, 0x26, 0x61, 
+0x51, 0x50, 0x0, 0x0, 0x30, 0x6c, 0x22, 0x22, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x21, 0x30, 0x4c, 0xcc, 0x4c, 0x7, 0x5, 0x9, 0x30, 0x23, 0x32, 0x3, 0x20, 
+0x0, 0x0, 0x0, 0x66, 0x6c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x12, 0x22, 
+0x11, 0x55, 0x56, 0x16, 0xb5, 0xb5, 0xb6, 0x66, 0x31, 0x61, 0x11, 0x55, 0x62, 0x26, 0x5b, 0x5b, 
+0x56, 0x61, 0x21, 0x61, 0x11, 0x55, 0x56, 0x36, 0xb5, 0xb5, 0xb6, 0x61, 0x21, 0x65, 0x55, 0x55, 
+0x56, 0x6, 0x5b, 0x5b, 0x56, 0x61, 0x21, 0x98, 0x66, 0x66, 0x66, 0x66, 0x6, 0x66, 0x66, 0x66, 
+0x61, 0x21, 0x60, 0x0, 0x0, 0x6, 0x0, 0x11, 0x11, 0x16, 0x65, 0x55, 0x50, 0x0, 0x0, 0x0, 
+0x0, 0x22, 0x55, 0x56, 0x62, 0x62, 0x62, 0x22, 0x22, 0x22, 0x6, 0x66, 0x66, 0x66, 0x62, 0x22, 
+0x22, 0xb0, 0x1, 0x12, 0x0, 0x0, 0x0, 0x6, 0x66, 0x66, 0x61, 0x11, 0x11, 0x22, 0x6, 0x66, 
+0x66, 0x6, 0x60, 0x11, 0x22, 0x22, 0x22, 0x12, 0x0, 0x0, 0x0, 0x6, 0x61, 0x51, 0xa2, 0x52, 
+0x25, 0x22, 0x0, 0x7, 0x0, 0x6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x22, 0xcc, 0x4c, 0x68, 0x4d, 0x4, 0xe, 0x17, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6c, 0x61, 0x11, 0x11, 0x21, 0x12, 
+0x22, 0x25, 0xb6, 0xb6, 0x60, 0x62, 0x22, 0x22, 0x99, 0x22, 0x62, 0x22, 0x25, 0x56, 0x26, 0x60, 
+0x61, 0x22, 0x22, 0x22, 0x62, 0x22, 0x22, 0x23, 0x26, 0x60, 0x66, 0x11, 0x11, 0x22, 0x62, 0x22, 
+0x22, 0x20, 0x6, 0x60, 0xa6, 0x22, 0x22, 0x22, 0x62, 0x22, 0x22, 0x20, 0x6, 0x60, 0x66, 0x22, 
+0x22, 0x22, 0x62, 0x22, 0x22, 0x20, 0x6, 0x60, 0x60, 0x0, 0xb, 0x20, 0x22, 0x22, 0x66, 0x66, 
+0x6, 0x60, 0x60, 0x55, 0x50, 0x20, 0x25, 0x22, 0x65, 0x56, 0x6, 0x60, 0x60, 0x22, 0x20, 0x20, 
+0x23, 0x55, 0x62, 0x26, 0xf6, 0x60, 0x6b, 0x0, 0x0, 0x2b, 0x22, 0x5b, 0x65, 0x56, 0x6, 0x60, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x23, 0x68, 0x4d, 
+0x4, 0x4e, 0x2, 0x7, 0x10, 0x0, 0x3, 0x0, 0x21, 0x9a, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6b, 0x0, 0x0, 0x6, 0x0, 0xb, 0x0, 0x65, 
+0x55, 0x6, 0x60, 0x66, 0x65, 0x0, 0xb6, 0x66, 0x50, 0x66, 0x66, 0x6, 0x60, 0x0, 0x6, 0x6, 
+0x0, 0x0, 0x60, 0x0, 0x0, 0x6, 0x60, 0x5, 0x0, 0x5, 0x66, 0x60, 0x2, 0x22, 0x22, 0x56, 
+0x66, 0x66, 0x66, 0x62, 0x22, 0x12, 0x22, 0x52, 0x55, 0x56, 0x62, 0x22, 0x22, 0x66, 0x62, 0x22, 
+0x22, 0x11, 0x21, 0x26, 0x60, 0x3, 0x0, 0x10, 0x0, 0x0, 0x0, 0xa1, 0x21, 0x26, 0x62, 0x52, 
+0x25, 0x60, 0x26, 0x6, 0x66, 0x66, 0x26, 0x66, 0x6a, 0x22, 0x52, 0x62, 0x26, 0x6, 0x30, 0x0, 
+0x0, 0x6, 0x66, 0x66, 0x66, 0x60, 0x6, 0xc6, 0x22, 0x22, 0x22, 0x66, 0x60, 0xb0, 0x0, 0x25, 
+0x55, 0x6b, 0xb0, 0x0, 0x0, 0x56, 0x60, 0x0, 0xb0, 0x55, 0x9b, 0x55, 0x60, 0x0, 0x0, 0x55, 
+0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x24, 0x4, 0x4e, 0xa0, 0x4e, 
+0x1, 0xb, 0x26, 0x3, 0x22, 0x32, 0x20, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x0, 0x0, 0xb6, 0x60, 
+0x66, 0x66, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6, 0x60, 0x61, 0x51, 0x22, 0x92, 0x60, 0x5, 
+0x0, 0x36, 0x6, 0x60, 0x66, 0x66, 0x22, 0x92, 0x66, 0x6, 0x66, 0x66, 0x6, 0x6b, 0x65, 0xa2, 
+0x52, 0x25, 0x25, 0x22, 0x52, 0x16, 0x6, 0x60, 0x66, 0x66, 0x22, 0x2, 0x22, 0x22, 0x25, 0x56, 
+0x6, 0x60, 0x60, 0x6, 0x12, 0x2, 0x2, 0x2, 0x15, 0x56, 0x6, 0x60, 0x60, 0x0, 0x52, 0x2, 
+0x20, 0x25, 0x51, 0x16, 0xb6, 0x60, 0x60, 0x0, 0x22, 0x32, 0x22, 0x9c, 0x51, 0x15, 0x56, 0x6, 
+0x60, 0x60, 0xbb, 0x25, 0x52, 0x25, 0x15, 0x55, 0x56, 0x6, 0x60, 0x66, 0x66, 0x66, 0x66, 0x66, 
+0x62, 0x66, 0x66, 0x6, 0x6b, 0x0, 0x0, 0x0, 0xb0, 0x0, 0x0, 0xb, 0x0, 0x6, 0x66, 0x66, 
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x25, 0xa0, 0x4e, 0x0, 0x0, 0x4, 0x7, 0x23, 
+0x33, 0x33, 0x1, 0x21, 0x12, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 
+};
+} // namespace YAKC
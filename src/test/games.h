@@ -0,0 +1,9 @@
+#pragma once
+// #version:3#
+// machine generated, do not edit!
+namespace YAKC {
+extern unsigned char dump_pengo[16000];
+extern unsigned char dump_cave[11904];
+extern unsigned char dump_house[12928];
+extern unsigned char dump_digger3[20269];
+} // namespace YAKC
@@ -2,6 +2,7 @@
 //  mem_test.cc
 //------------------------------------------------------------------------------
 #include "UnitTest++/src/UnitTest++.h"
+#include "yakc/yakc.h"
 #include "yakc/memory.h"
 #include <string.h>
 
@@ -105,3 +106,303 @@ TEST(memory) {
 
 }
 
+
+TEST(memory_shared) {
+    memory mem;
+    const int size = 0x4000;
+    static ubyte src[size];
+    static ubyte ram[size];
+    memset(src, 1, sizeof(src));
+    memset(ram, 0, sizeof(ram));
+    mem.map(0, 0x4000, size, ram, true);
+    mem.share(ram, src, size);
+    CHECK(mem.num_shared_pages() == 16);
+    CHECK(mem.r8(0x4000) == 1);
+    CHECK(mem.r8(0x7FFF) == 1);
+    CHECK(mem.layer(0x4000) == 0);
+
+    // first write copies the page
+    mem.w8(0x4401, 2);
+    CHECK(mem.num_shared_pages() == 15);
+    CHECK(mem.r8(0x4400) == 1);
+    CHECK(mem.r8(0x4401) == 2);
+    CHECK(ram[0x0400] == 1);
+    CHECK(ram[0x0401] == 2);
+    CHECK(ram[0x0800] == 0);
+    CHECK(src[0x0401] == 1);
+
+    // bank switching must keep copy-on-write pages
+    mem.unmap(0, 0x4000, size);
+    CHECK(mem.r8(0x4000) == 0xFF);
+    mem.map(0, 0x8000, size, ram, true);
+    CHECK(mem.r8(0x8000) == 1);
+    CHECK(mem.r8(0x8401) == 2);
+    mem.a8(0x8000) = 3;
+    CHECK(mem.num_shared_pages() == 14);
+    CHECK(ram[0x0000] == 3);
+    CHECK(src[0x0000] == 1);
+
+    // unsharing copies the remaining pages
+    mem.unshare();
+    CHECK(mem.num_shared_pages() == 0);
+    CHECK(mem.num_shared_ranges == 0);
+    CHECK(ram[0x3FFF] == 1);
+    CHECK(mem.r8(0x8401) == 2);
+    mem.w8(0x8800, 4);
+    CHECK(ram[0x0800] == 4);
+}
+
+TEST(memory_dirty) {
+    memory mem;
+    const int size = 0x4000;
+    static ubyte ram[size];
+    static ubyte src[size];
+    memset(ram, 0, sizeof(ram));
+    memset(src, 1, sizeof(src));
+    // the same RAM visible at 2 addresses
+    mem.map(0, 0x0000, size, ram, true);
+    mem.map(0, 0x8000, size, ram, true);
+    CHECK(mem.dirty_pages(ram, size) == 0xFFFF);
+
+    // a new tracked range starts dirty, clean pages are read-only
+    mem.track(ram, size);
+    CHECK(mem.num_tracked_ranges == 1);
+    CHECK(mem.dirty_pages(ram, size) == 0xFFFF);
+    CHECK(mem.is_writable(0x0400));
+    mem.clear_dirty();
+    CHECK(mem.dirty_pages(ram, size) == 0);
+    CHECK(!mem.is_writable(0x0400));
+    CHECK(!mem.is_writable(0x8400));
+
+    // the first write marks the page dirty, and makes it writable at both addresses
+    mem.w8(0x0401, 2);
+    CHECK(ram[0x0401] == 2);
+    CHECK(mem.dirty_pages(ram, size) == 0x0002);
+    CHECK(mem.is_writable(0x0400));
+    CHECK(mem.is_writable(0x8400));
+    CHECK(!mem.is_writable(0x0800));
+    mem.a8(0x8800) = 3;
+    CHECK(ram[0x0800] == 3);
+    CHECK(mem.dirty_pages(ram, size) == 0x0006);
+
+    // write traps still see the write, and mark the page dirty
+    struct trap_count {
+        int num = 0;
+        static void func(void* userdata, uword, bool) {
+            ((trap_count*)userdata)->num++;
+        }
+    } traps;
+    mem.set_traps(0, uint64_t(1)<<3, trap_count::func, &traps);
+    mem.w8(0x0C00, 4);
+    CHECK((traps.num == 1) && (ram[0x0C00] == 4));
+    CHECK(mem.dirty_pages(ram, size) == 0x000E);
+    CHECK(!mem.is_writable(0x0C00));
+    mem.set_traps(0, 0, nullptr, nullptr);
+
+    // a copy-on-write page is read from its source until first written
+    mem.clear_dirty();
+    mem.share(ram, src, size);
+    CHECK(mem.page_content(ram + 0x1000) == src + 0x1000);
+    CHECK(mem.r8(0x1000) == 1);
+    mem.w8(0x1001, 5);
+    CHECK(mem.page_content(ram + 0x1000) == ram + 0x1000);
+    CHECK((ram[0x1000] == 1) && (ram[0x1001] == 5));
+    CHECK(mem.dirty_pages(ram, size) == 0x0010);
+    CHECK(mem.is_writable(0x1000));
+    mem.unshare();
+
+    // without tracking all pages are dirty and writable
+    mem.untrack();
+    CHECK(mem.num_tracked_ranges == 0);
+    CHECK(mem.dirty_pages(ram, size) == 0xFFFF);
+    CHECK(mem.is_writable(0x2000));
+}
+
+TEST(memory_traps) {
+    static memory mem;
+    static ubyte ram[0x4000];
+    static ubyte rom[0x4000];
+    memset(ram, 0, sizeof(ram));
+    memset(rom, 3, sizeof(rom));
+    mem.map(0, 0x0000, sizeof(ram), ram, true);
+    mem.map(0, 0xC000, sizeof(rom), rom, false);
+
+    struct trap_log {
+        int num = 0;
+        uword addr = 0;
+        bool write = false;
+        static void func(void* userdata, uword addr, bool write) {
+            trap_log* log = (trap_log*) userdata;
+            log->num++;
+            log->addr = addr;
+            log->write = write;
+        }
+    } log;
+
+    // trap reads on page 1, writes on pages 2 and 48 (ROM)
+    mem.set_traps(uint64_t(1)<<1, (uint64_t(1)<<2)|(uint64_t(1)<<48), trap_log::func, &log);
+    CHECK(mem.r8(0x0000) == 0);
+    mem.w8(0x0401, 1);
+    CHECK(log.num == 0);
+    CHECK(mem.r8(0x0401) == 1);
+    CHECK((log.num == 1) && (log.addr == 0x0401) && !log.write);
+    CHECK(!mem.is_writable(0x0800));
+    mem.w8(0x0801, 2);
+    CHECK((log.num == 2) && (log.addr == 0x0801) && log.write);
+    CHECK(ram[0x0801] == 2);
+    CHECK(mem.r8(0x0801) == 2);
+    CHECK(log.num == 2);
+    mem.w8(0xC000, 4);
+    CHECK((log.num == 3) && (log.addr == 0xC000) && log.write);
+    CHECK(rom[0] == 3);
+
+    // bank switching keeps the traps
+    mem.unmap(0, 0x0000, sizeof(ram));
+    mem.map(0, 0x0000, sizeof(ram), ram, true);
+    mem.w8(0x0802, 5);
+    CHECK((log.num == 4) && (ram[0x0802] == 5));
+
+    // removing the traps restores the fast path
+    mem.set_traps(0, 0, nullptr, nullptr);
+    CHECK(mem.is_writable(0x0800));
+    mem.w8(0x0803, 6);
+    CHECK(mem.r8(0x0401) == 1);
+    CHECK((log.num == 4) && (ram[0x0803] == 6));
+}
+
+TEST(memory_counters) {
+    static memory mem;
+    static ubyte ram[0x4000];
+    static ubyte rom[0x4000];
+    memset(ram, 0, sizeof(ram));
+    memset(rom, 3, sizeof(rom));
+    mem.map(0, 0x0000, sizeof(ram), ram, true);
+    mem.map(0, 0xC000, sizeof(rom), rom, false);
+
+    // nothing is counted on the fast path
+    mem.w8(0x0000, 1);
+    CHECK(mem.r8(0x0000) == 1);
+    CHECK(mem.x8(0x0000) == 1);
+    CHECK(mem.counters[0].reads == 0);
+
+    // while counting, all accesses go through the slow path
+    mem.set_counting(true);
+    CHECK(!mem.is_writable(0x0000));
+    mem.w8(0x0001, 2);
+    mem.w16(0x0402, 0x1234);
+    CHECK((ram[0x0001] == 2) && (mem.r16(0x0402) == 0x1234));
+    CHECK(mem.x8(0x0001) == 2);
+    mem.w8(0xC000, 4);
+    CHECK((mem.r8(0xC000) == 3) && (rom[0] == 3));
+    CHECK((mem.counters[0].reads == 0) && (mem.counters[0].writes == 1) && (mem.counters[0].execs == 1));
+    CHECK((mem.counters[1].reads == 2) && (mem.counters[1].writes == 2) && (mem.counters[1].execs == 0));
+    CHECK((mem.counters[48].reads == 1) && (mem.counters[48].writes == 1));
+
+    // the trap callback is only called for trapped pages
+    struct trap_log {
+        int num = 0;
+        static void func(void* userdata, uword addr, bool write) {
+            ((trap_log*)userdata)->num++;
+        }
+    } log;
+    mem.set_traps(uint64_t(1)<<1, 0, trap_log::func, &log);
+    mem.r8(0x0000);
+    mem.w8(0x0400, 5);
+    CHECK(log.num == 0);
+    mem.x8(0x0400);
+    CHECK(log.num == 1);
+    CHECK((mem.counters[0].reads == 1) && (mem.counters[1].writes == 3) && (mem.counters[1].execs == 1));
+
+    // counting survives bank switching, stopping restores the fast path
+    mem.unmap(0, 0x0000, sizeof(ram));
+    mem.map(0, 0x0000, sizeof(ram), ram, true);
+    mem.w8(0x0000, 6);
+    CHECK((ram[0] == 6) && (mem.counters[0].writes == 2));
+    mem.set_traps(0, 0, nullptr, nullptr);
+    mem.set_counting(false);
+    CHECK(mem.is_writable(0x0000));
+    mem.w8(0x0000, 7);
+    CHECK(mem.counters[0].writes == 2);
+    mem.clear_counters();
+    CHECK((mem.counters[1].reads == 0) && (mem.counters[1].writes == 0) && (mem.counters[1].execs == 0));
+}
+
+TEST(memory_counters_kc85) {
+    static yakc emu;
+    emu.init(ext_funcs(), sound_funcs());
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    for (int i = 0; i < 100; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+
+    // each opcode fetch is counted as execute
+    memory& mem = emu.board.cpu.mem;
+    opstats& ops = emu.board.ops;
+    mem.clear_counters();
+    mem.set_counting(true);
+    ops.reset();
+    ops.enabled = true;
+    for (int i = 0; i < 10; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    ops.enabled = false;
+    mem.set_counting(false);
+    uint64_t execs = 0;
+    for (int i = 0; i < memory::num_pages; i++) {
+        execs += mem.counters[i].execs;
+    }
+    uint64_t fetches = 0;
+    for (int i = 0; i < opstats::num_tables; i++) {
+        fetches += ops.table_count(i);
+    }
+    CHECK((execs > 0) && (execs == fetches));
+
+    // the CAOS idle loop runs in ROM
+    uint64_t rom_execs = 0;
+    for (int i = 0xE000>>memory::page::shift; i < memory::num_pages; i++) {
+        rom_execs += mem.counters[i].execs;
+    }
+    CHECK(rom_execs > 0);
+    emu.poweroff();
+}
+
+TEST(memory_counters_block) {
+    static yakc emu;
+    emu.init(ext_funcs(), sound_funcs());
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    z80& cpu = emu.board.cpu;
+    memory& mem = cpu.mem;
+    const ubyte prog[] = {
+        0xF3,                       // DI
+        0x21, 0x00, 0x10,           // LD HL,1000h
+        0x01, 0x00, 0x02,           // LD BC,0200h
+        0x3E, 0xAA,                 // LD A,AAh
+        0xED, 0xB1,                 // CPIR
+        0x18, 0xFE,                 // JR $
+    };
+    mem.write(0x0200, prog, sizeof(prog));
+    memset(&emu.kc85.ram[0][0x1000], 0, 0x200);
+
+    // single-stepped outside of onframe()
+    mem.clear_counters();
+    mem.set_counting(true);
+    cpu.PC = 0x0200;
+    while (cpu.PC != 0x020B) {
+        cpu.step();
+    }
+    const uint64_t step_reads = mem.counters[0x1000>>memory::page::shift].reads;
+    CHECK(step_reads == 0x200);
+
+    // block instructions don't run in bulk while counting
+    mem.clear_counters();
+    cpu.PC = 0x0200;
+    emu.onframe(1, 20000, 0, 0);
+    CHECK(cpu.PC == 0x020B);
+    CHECK(mem.counters[0x1000>>memory::page::shift].reads == step_reads);
+    mem.set_counting(false);
+    emu.poweroff();
+}
@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+//  movie_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/movie.h"
+#include "test/testemu.h"
+#include <string.h>
+
+using namespace YAKC;
+
+// run a frame with jittery host frame times, like the app does
+static void run_frame(yakc& emu, int i) {
+    const int micro_secs = 16000 + ((i * 7919) % 9000);
+    emu.onframe(1, micro_secs, 0, 0);
+}
+
+static void type_keys(yakc& emu, int i, const char* str) {
+    const int len = int(strlen(str));
+    if ((i / 4) < len) {
+        emu.put_key((i & 2) ? 0 : str[i / 4]);
+    }
+    else {
+        emu.put_key(0);
+    }
+}
+
+TEST(movie_kc85) {
+    static yakc emu;
+    init_test_emu(emu);
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+
+    // start recording right after power-on, record the boot process,
+    // keyboard input, a module change and a reset
+    static movie rec;
+    rec.start_recording(emu);
+    CHECK(rec.recording());
+    CHECK(emu.movie_recorder == &rec);
+    const int num_frames = 400;
+    static uint64_t hashes[num_frames];
+    for (int i = 0; i < num_frames; i++) {
+        if (i >= 150) {
+            type_keys(emu, i - 150, "BASIC\r");
+        }
+        else {
+            emu.put_key(0);
+        }
+        if (i == 100) {
+            emu.insert_module(0x08, kc85_exp::m022_16kbyte);
+        }
+        if (i == 120) {
+            emu.reset();
+        }
+        if (i == 140) {
+            emu.remove_module(0x08);
+        }
+        run_frame(emu, i);
+        hashes[i] = test_state_hash(emu);
+    }
+    rec.stop_recording(emu);
+    CHECK(!rec.recording());
+    CHECK(nullptr == emu.movie_recorder);
+    // the first frame after power-on isn't recorded
+    CHECK(rec.num_frames() == (num_frames - 1));
+
+    // save and load into another movie
+    snapshot::membuf buf;
+    CHECK(rec.save(snapshot::membuf::write, &buf));
+    static movie play;
+    CHECK(play.load(snapshot::membuf::read, &buf));
+    CHECK(play.num_frames() == rec.num_frames());
+
+    // a corrupt log size must be rejected (offset of header_t::log_size)
+    static movie bad;
+    const uint32_t huge = 0xFFFFFFF0;
+    memcpy(buf.ptr + 32, &huge, sizeof(huge));
+    buf.pos = 0;
+    CHECK(!bad.load(snapshot::membuf::read, &buf));
+    CHECK(!bad.valid());
+    buf.discard();
+
+    // replay on a switched-off emulator must produce identical states
+    emu.poweroff();
+    emu.kc85.exp.insert_module(0x08, kc85_exp::none);
+    CHECK(play.start_replay(emu));
+    CHECK(emu.is_device(device::kc85_3));
+    int num_mismatches = 0;
+    while (play.replay_frame(emu)) {
+        if (hashes[play.replay_pos()] != test_state_hash(emu)) {
+            num_mismatches++;
+        }
+    }
+    CHECK(play.replay_done());
+    CHECK(play.replay_pos() == rec.num_frames());
+    CHECK(play.num_desyncs() == 0);
+    CHECK(num_mismatches == 0);
+
+    // replay again, from a running emulator
+    CHECK(play.start_replay(emu));
+    while (play.replay_frame(emu)) { }
+    CHECK(hashes[num_frames - 1] == test_state_hash(emu));
+    CHECK(play.num_desyncs() == 0);
+    emu.poweroff();
+}
+
+TEST(movie_z9001) {
+    static yakc emu;
+    init_test_emu(emu);
+    emu.poweron(device::z9001, os_rom::z9001_os_1_2);
+    for (int i = 0; i < 100; i++) {
+        run_frame(emu, i);
+    }
+    // start recording in the middle of a running session, with
+    // key input pending in the keyboard buffer
+    emu.put_key('A');
+    run_frame(emu, 100);
+    static movie rec;
+    rec.start_recording(emu);
+    const int num_frames = 200;
+    for (int i = 0; i < num_frames; i++) {
+        type_keys(emu, i, "PRINT 1+2\r");
+        run_frame(emu, i);
+    }
+    rec.stop_recording(emu);
+    CHECK(rec.num_frames() == num_frames);
+    const uint64_t h0 = test_state_hash(emu);
+    const uint64_t cycles0 = emu.cycle_count();
+
+    emu.poweroff();
+    CHECK(rec.start_replay(emu));
+    while (rec.replay_frame(emu)) { }
+    CHECK(rec.num_desyncs() == 0);
+    CHECK(emu.cycle_count() == cycles0);
+    CHECK(h0 == test_state_hash(emu));
+    emu.poweroff();
+}
@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+//  opstats_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/yakc.h"
+#include "yakc/snapshot.h"
+#include "yakc/z80bus.h"
+
+using namespace YAKC;
+
+static ubyte ram[0x10000];
+
+TEST(opstats) {
+    static z80bus bus;
+    static z80 cpu;
+    memset(ram, 0, sizeof(ram));
+    cpu.mem.map(0, 0x0000, sizeof(ram), ram, true);
+    cpu.init(&bus);
+    ubyte prog[] = {
+        0x06, 0x03,                 // LD B,3
+        0xDD, 0x21, 0x00, 0x10,     // LD IX,1000h
+        0xDD, 0xCB, 0x01, 0x46,     // loop: BIT 0,(IX+1)
+        0xCB, 0x07,                 // RLC A
+        0xED, 0x44,                 // NEG
+        0x10, 0xF6,                 // DJNZ loop
+        0x76,                       // HALT
+    };
+    cpu.mem.write(0x0000, prog, sizeof(prog));
+
+    // the counters only exist after enabling
+    static opstats ops;
+    ops.reset();
+    CHECK(ops.num_instructions() == 0);
+    CHECK(ops.analyze() == 0);
+    ops.enabled = true;
+    ops.begin_run(cpu);
+    CHECK(cpu.stats == &ops);
+    while (!cpu.HALT) {
+        cpu.step();
+    }
+    ops.end_run(cpu);
+    CHECK(cpu.stats == nullptr);
+
+    // prefixes are counted in the table they appear in
+    CHECK(ops.get_count(opstats::main_table, 0x06) == 1);
+    CHECK(ops.get_count(opstats::main_table, 0xDD) == 4);
+    CHECK(ops.get_count(opstats::dd_table, 0x21) == 1);
+    CHECK(ops.get_count(opstats::dd_table, 0xCB) == 3);
+    CHECK(ops.get_count(opstats::ddcb_table, 0x46) == 3);
+    CHECK(ops.get_count(opstats::cb_table, 0x07) == 3);
+    CHECK(ops.get_count(opstats::ed_table, 0x44) == 3);
+    CHECK(ops.table_count(opstats::main_table) == 15);
+    CHECK(ops.num_instructions() == 15);
+
+    // taken conditional jumps
+    CHECK(ops.get_count(opstats::main_table, 0x10) == 3);
+    CHECK(ops.get_taken(opstats::main_table, 0x10) == 2);
+    CHECK(opstats::is_conditional(opstats::main_table, 0x10));
+    CHECK(opstats::is_conditional(opstats::fd_table, 0x38));
+    CHECK(opstats::is_conditional(opstats::main_table, 0xFC));
+    CHECK(!opstats::is_conditional(opstats::main_table, 0x18));
+    CHECK(!opstats::is_conditional(opstats::main_table, 0xC9));
+    CHECK(!opstats::is_conditional(opstats::cb_table, 0x10));
+
+    // the instruction names come from the generated decoder
+    CHECK(0 == strcmp(z80::op_name(opstats::main_table, 0x10), "DJNZ"));
+    CHECK(0 == strcmp(z80::op_name(opstats::ddcb_table, 0x46), "BIT 0,(IX+d)"));
+    CHECK(0 == strcmp(z80::op_name(opstats::fd_table, 0x21), "LD IY,nn"));
+    CHECK(0 == strcmp(z80::op_name(opstats::ed_table, 0x71), "OUT (C)"));
+    CHECK(z80::op_name(opstats::main_table, 0xDD) == nullptr);
+    CHECK(z80::op_name(opstats::ed_table, 0x00) == nullptr);
+
+    // the analysis is sorted by count, without prefixes
+    CHECK(ops.analyze() == 7);
+    const opstats::entry& e0 = ops.get_entry(0);
+    CHECK((e0.table == opstats::main_table) && (e0.op == 0x10) && (e0.count == 3) && (e0.taken == 2));
+    CHECK((ops.get_entry(3).table == opstats::ddcb_table) && (ops.get_entry(3).op == 0x46));
+    CHECK(ops.get_entry(6).count == 1);
+
+    // the text report
+    snapshot::membuf buf;
+    CHECK(ops.save(snapshot::membuf::write, &buf));
+    const char* header = "# 15 instructions, 7 opcodes\n";
+    CHECK((buf.size > int(strlen(header))) && (0 == memcmp(buf.ptr, header, strlen(header))));
+    buf.discard();
+
+    ops.reset();
+    CHECK(ops.num_instructions() == 0);
+    CHECK(ops.num_entries() == 0);
+
+    // not counted when disabled
+    ops.enabled = false;
+    ops.begin_run(cpu);
+    CHECK(cpu.stats == nullptr);
+    ops.discard();
+    CHECK(!ops.enabled && (ops.num_instructions() == 0));
+}
+
+TEST(opstats_kc85) {
+    static yakc emu;
+    emu.init(ext_funcs(), sound_funcs());
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    for (int i = 0; i < 100; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+
+    // the statistics count the same instructions as the profiler
+    opstats& ops = emu.board.ops;
+    profiler& prof = emu.board.prof;
+    ops.reset();
+    ops.enabled = true;
+    prof.enabled = true;
+    for (int i = 0; i < 10; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    ops.enabled = false;
+    prof.enabled = false;
+    CHECK(emu.board.cpu.stats == nullptr);
+    CHECK(ops.num_instructions() > 0);
+    CHECK(ops.num_instructions() == prof.total_count());
+
+    const int num_entries = ops.analyze();
+    CHECK(num_entries > 1);
+    bool valid = true;
+    for (int i = 0; i < num_entries; i++) {
+        const opstats::entry& e = ops.get_entry(i);
+        valid &= (i == 0) || (ops.get_entry(i - 1).count >= e.count);
+        valid &= e.taken <= e.count;
+        valid &= (e.taken == 0) || opstats::is_conditional(e.table, e.op);
+        valid &= nullptr != z80::op_name(e.table, e.op);
+    }
+    CHECK(valid);
+    prof.discard();
+    emu.poweroff();
+}
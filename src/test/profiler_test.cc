@@ -0,0 +1,159 @@
+//------------------------------------------------------------------------------
+//  profiler_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/yakc.h"
+#include "yakc/snapshot.h"
+#include "yakc/z80bus.h"
+
+using namespace YAKC;
+
+static ubyte ram[0x10000];
+
+TEST(profiler_blocks) {
+    static z80bus bus;
+    static z80 cpu;
+    memset(ram, 0, sizeof(ram));
+    cpu.mem.map(0, 0x0000, sizeof(ram), ram, true);
+    cpu.init(&bus);
+    ubyte prog[] = {
+        0x06, 0x0A,         // LD B,10
+        0x00,               // loop: NOP
+        0x10, 0xFD,         // DJNZ loop
+        0x76,               // HALT
+    };
+    cpu.mem.write(0x0000, prog, sizeof(prog));
+
+    profiler prof;
+    prof.enabled = true;
+    while (!cpu.HALT) {
+        const uword pc = cpu.PC;
+        prof.record(cpu.mem, pc, cpu.step());
+    }
+    CHECK(prof.num_pages() == 1);
+    CHECK(prof.total_count() == 22);
+    CHECK(prof.total_cycles() == 7 + 10*4 + 9*13 + 8 + 4);
+    CHECK(prof.get(cpu.mem, 0x0002).count == 10);
+    CHECK(prof.get(cpu.mem, 0x0003).cycles == 9*13 + 8);
+    CHECK(prof.get(cpu.mem, 0x0004).count == 0);
+
+    // the loop body is the most expensive block
+    CHECK(prof.analyze(cpu.mem) == 3);
+    const profiler::block& b0 = prof.get_block(0);
+    CHECK((b0.addr == 0x0002) && (b0.bank == 0) && (b0.num_instrs == 2) && (b0.num_bytes == 3));
+    CHECK((b0.count == 10) && (b0.cycles == 10*4 + 9*13 + 8));
+    CHECK(prof.get_block_counter(b0, 1).cycles == 9*13 + 8);
+    CHECK(prof.is_mapped(cpu.mem, b0));
+    CHECK((prof.get_block(1).addr == 0x0000) && (prof.get_block(1).cycles == 7));
+    CHECK((prof.get_block(2).addr == 0x0005) && (prof.get_block(2).num_instrs == 1));
+
+    // the text report
+    snapshot::membuf buf;
+    CHECK(prof.save(snapshot::membuf::write, &buf));
+    const char* header = "# 176 T-states, 22 instructions, 3 blocks\n";
+    CHECK((buf.size > int(strlen(header))) && (0 == memcmp(buf.ptr, header, strlen(header))));
+    buf.discard();
+
+    prof.reset();
+    CHECK(prof.total_count() == 0);
+    CHECK(prof.num_blocks() == 0);
+    CHECK(prof.num_pages() == 1);
+    prof.discard();
+    CHECK(prof.num_pages() == 0);
+    CHECK(!prof.enabled);
+}
+
+TEST(profiler_banks) {
+    const int size = 0x4000;
+    static ubyte bank0[size];
+    static ubyte bank1[size];
+    static ubyte src[size];
+    memset(bank0, 0, sizeof(bank0));
+    memset(bank1, 0, sizeof(bank1));
+    memset(src, 0, sizeof(src));
+    memory mem;
+    profiler prof;
+    prof.enabled = true;
+
+    // the same address in different banks is counted separately
+    mem.map(0, 0x8000, size, bank0, true);
+    prof.record(mem, 0x8010, 4);
+    mem.map(0, 0x8000, size, bank1, true);
+    prof.record(mem, 0x8010, 7);
+    prof.record(mem, 0x8010, 7);
+    CHECK(prof.get(mem, 0x8010).count == 2);
+    CHECK(prof.get(mem, 0x8010).cycles == 14);
+    mem.map(0, 0x8000, size, bank0, true);
+    CHECK(prof.get(mem, 0x8010).count == 1);
+    CHECK(prof.get(mem, 0x8010).cycles == 4);
+    CHECK(prof.num_pages() == 2);
+
+    // a copy-on-write page is counted in its host page, before and after unsharing
+    mem.share(bank0, src, size);
+    prof.record(mem, 0x8010, 4);
+    mem.unshare();
+    prof.record(mem, 0x8010, 4);
+    CHECK(prof.get(mem, 0x8010).count == 3);
+    CHECK(prof.num_pages() == 2);
+
+    // the analysis tells the banks apart
+    CHECK(prof.analyze(mem) == 2);
+    const profiler::block& b0 = prof.get_block(1);
+    const profiler::block& b1 = prof.get_block(0);
+    CHECK((b0.addr == 0x8010) && (b0.bank == 0) && (b0.cycles == 12));
+    CHECK((b1.addr == 0x8010) && (b1.bank == 1) && (b1.cycles == 14));
+    CHECK(prof.is_mapped(mem, b0));
+    CHECK(!prof.is_mapped(mem, b1));
+}
+
+static void count_entry(void* userdata, const tracer::entry& e) {
+    (*(uint64_t*)userdata)++;
+}
+
+TEST(profiler_kc85) {
+    static yakc emu;
+    emu.init(ext_funcs(), sound_funcs());
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    for (int i = 0; i < 100; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+
+    // the profiler counts the same instructions as the tracer
+    profiler& prof = emu.board.prof;
+    tracer& trace = emu.board.trace;
+    prof.enabled = true;
+    trace.setup(256, false);
+    const uint64_t start_cycle_count = emu.cycle_count();
+    for (int i = 0; i < 10; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    prof.enabled = false;
+    snapshot::membuf buf;
+    trace.save(snapshot::membuf::write, &buf);
+    trace.discard();
+    uint64_t num_entries = 0;
+    int pos = sizeof(tracer::file_header);
+    while (pos < buf.size) {
+        tracer::decode_block(buf.ptr + pos, count_entry, &num_entries);
+        tracer::block_header hdr;
+        memcpy(&hdr, buf.ptr + pos, sizeof(hdr));
+        pos += hdr.num_bytes;
+    }
+    buf.discard();
+    CHECK(prof.total_count() == num_entries);
+    CHECK(prof.total_cycles() > 0);
+    CHECK(prof.total_cycles() <= (emu.cycle_count() - start_cycle_count));
+
+    // blocks are sorted by cost
+    const int num_blocks = prof.analyze(emu.board.cpu.mem);
+    CHECK(num_blocks > 1);
+    bool sorted = true;
+    for (int i = 1; i < num_blocks; i++) {
+        sorted &= prof.get_block(i - 1).cycles >= prof.get_block(i).cycles;
+    }
+    CHECK(sorted);
+    prof.discard();
+    emu.poweroff();
+}
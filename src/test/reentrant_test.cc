@@ -0,0 +1,165 @@
+//------------------------------------------------------------------------------
+//  reentrant_test.cc
+//
+//  Run several emulator instances concurrently on different threads, each
+//  with its own memory allocation functions, and check that the results
+//  are identical to running the same machines one after another.
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "test/testemu.h"
+#include "yakc/forkpoint.h"
+#include "yakc/rewinder.h"
+#include <thread>
+#include <string.h>
+#include <stdio.h>
+
+using namespace YAKC;
+
+static const int num_instances = 8;
+static const int num_frames = 300;
+
+// a separate allocator per instance, counting the live allocations
+static int live_allocs[num_instances];
+template<int INDEX> static void* counting_malloc(size_t s) {
+    live_allocs[INDEX]++;
+    return malloc(s);
+}
+template<int INDEX> static void counting_free(void* p) {
+    live_allocs[INDEX]--;
+    free(p);
+}
+// the same assert callback for all instances
+static void test_assertmsg(const char* cond, const char* msg, const char* file, int line, const char* func) {
+    fprintf(stderr, "\n-- ASSERT: '%s' failed in %s (%s:%d)\n", cond, func, file, line);
+}
+static void other_assertmsg(const char* cond, const char* msg, const char* file, int line, const char* func) { }
+
+template<int INDEX> static ext_funcs counting_funcs() {
+    ext_funcs funcs;
+    funcs.assertmsg_func = test_assertmsg;
+    funcs.malloc_func = counting_malloc<INDEX>;
+    funcs.free_func = counting_free<INDEX>;
+    return funcs;
+}
+
+struct config {
+    device model;
+    os_rom os;
+};
+static const config configs[] = {
+    { device::kc85_3, os_rom::caos_3_1 },
+    { device::kc85_4, os_rom::caos_4_2 },
+    { device::z1013_64, os_rom::z1013_mon_a2 },
+    { device::z9001, os_rom::z9001_os_1_2 },
+};
+static const int num_configs = int(sizeof(configs) / sizeof(configs[0]));
+
+//------------------------------------------------------------------------------
+static uint64_t
+run_machine(yakc& emu, const config& cfg) {
+    emu.poweron(cfg.model, cfg.os);
+    const char* keys = "HELP\r";
+    const int num_keys = int(strlen(keys));
+    for (int i = 0; i < num_frames; i++) {
+        const int k = (i - 200) / 4;
+        if ((k >= 0) && (k < num_keys) && (i & 2)) {
+            emu.put_key(keys[k]);
+        }
+        else {
+            emu.put_key(0);
+        }
+        emu.onframe(1, 20000, 0, 0);
+    }
+    uint64_t h = test_state_hash(emu);
+    // also compress a snapshot, which allocates through the instance's functions
+    snapshot::membuf buf;
+    buf.funcs = emu.funcs;
+    snapshot::write_stream(emu, snapshot::membuf::write, &buf);
+    h = hash(buf.ptr, buf.size, h);
+    buf.discard();
+    emu.poweroff();
+    return h;
+}
+
+//------------------------------------------------------------------------------
+TEST(reentrant) {
+    static yakc emus[num_instances];
+    const ext_funcs funcs[num_instances] = {
+        counting_funcs<0>(), counting_funcs<1>(), counting_funcs<2>(), counting_funcs<3>(),
+        counting_funcs<4>(), counting_funcs<5>(), counting_funcs<6>(), counting_funcs<7>(),
+    };
+    // init the instances concurrently too, this also installs the assert callback
+    int init_allocs[num_instances];
+    std::thread init_threads[num_instances];
+    for (int i = 0; i < num_instances; i++) {
+        init_threads[i] = std::thread([i, &funcs] {
+            init_test_emu(emus[i], kc85_exp::m022_16kbyte, sound_funcs(), funcs[i]);
+        });
+    }
+    for (int i = 0; i < num_instances; i++) {
+        init_threads[i].join();
+        // ROM copies and the 16 KByte RAM module were allocated through the instance's functions
+        init_allocs[i] = live_allocs[i];
+        CHECK(init_allocs[i] > 0);
+    }
+    // the assert callback is installed once
+    CHECK(install_assertmsg_func(test_assertmsg));
+    CHECK(!install_assertmsg_func(other_assertmsg));
+
+    // reference results, running one machine after another on the main thread
+    static yakc refs[num_configs];
+    uint64_t expected[num_configs];
+    for (int i = 0; i < num_configs; i++) {
+        init_test_emu(refs[i], kc85_exp::m022_16kbyte);
+        expected[i] = run_machine(refs[i], configs[i]);
+        refs[i].kc85.exp.remove_module(0x08, refs[i].board.cpu.mem);
+    }
+
+    // now run all instances at the same time
+    uint64_t results[num_instances] = { };
+    std::thread threads[num_instances];
+    for (int i = 0; i < num_instances; i++) {
+        threads[i] = std::thread([i, &results] {
+            results[i] = run_machine(emus[i], configs[i % num_configs]);
+        });
+    }
+    for (int i = 0; i < num_instances; i++) {
+        threads[i].join();
+    }
+    for (int i = 0; i < num_instances; i++) {
+        CHECK(results[i] == expected[i % num_configs]);
+        // no allocation leaked into another instance's allocator
+        CHECK(live_allocs[i] == init_allocs[i]);
+    }
+    for (int i = 0; i < num_instances; i++) {
+        // the module memory goes back into the instance's pool, and
+        // is handed out again when a module is re-inserted
+        kc85_exp& exp = emus[i].kc85.exp;
+        const ubyte* mod_ptr = exp.slot_by_addr(0x08).mod.mem_ptr;
+        exp.remove_module(0x08, emus[i].board.cpu.mem);
+        CHECK(live_allocs[i] == init_allocs[i]);
+        CHECK(exp.num_pooled_blocks() == 1);
+        exp.insert_module(0x08, kc85_exp::m022_16kbyte);
+        CHECK(exp.slot_by_addr(0x08).mod.mem_ptr == mod_ptr);
+        CHECK(exp.num_pooled_blocks() == 0);
+        CHECK(live_allocs[i] == init_allocs[i]);
+        exp.remove_module(0x08, emus[i].board.cpu.mem);
+        exp.release_pool();
+        CHECK(live_allocs[i] == (init_allocs[i] - 1));
+    }
+
+    // the helper objects allocate through the functions of the emulator they work on
+    yakc& emu = emus[0];
+    emu.poweron(configs[0].model, configs[0].os);
+    const int allocs = live_allocs[0];
+    static forkpoint fp;
+    static rewinder rw;
+    fp.capture(emu);
+    CHECK(live_allocs[0] == (allocs + 1));
+    fp.discard();
+    CHECK(live_allocs[0] == allocs);
+    rw.record(emu);
+    CHECK(live_allocs[0] > allocs);
+    rw.clear();
+    emu.poweroff();
+}
@@ -0,0 +1,200 @@
+//------------------------------------------------------------------------------
+//  reverser_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/reverser.h"
+#include "test/testemu.h"
+
+using namespace YAKC;
+
+static yakc emu;
+static yakc ref_emu;
+static reverser rv;
+
+// the instructions of the last frames, traced on the reference emulator
+static const int max_entries = 32 * 1024;
+static tracer::entry entries[max_entries];
+static int num_entries = 0;
+
+static void store_entry(void* userdata, const tracer::entry& e) {
+    if (num_entries < max_entries) {
+        entries[num_entries++] = e;
+    }
+}
+
+// check the emulator state against a traced instruction
+static bool matches(const tracer::entry& e) {
+    const z80& cpu = emu.board.cpu;
+    return (emu.cycle_count() == e.cycle_count) &&
+           (cpu.PC == e.pc) &&
+           (cpu.AF == e.regs[tracer::reg_AF]) &&
+           (cpu.BC == e.regs[tracer::reg_BC]) &&
+           (cpu.DE == e.regs[tracer::reg_DE]) &&
+           (cpu.HL == e.regs[tracer::reg_HL]) &&
+           (cpu.IX == e.regs[tracer::reg_IX]) &&
+           (cpu.SP == e.regs[tracer::reg_SP]);
+}
+
+// run both emulators with the same input, trace the last frames on the reference,
+// and pause at the end
+static void run() {
+    yakc* emus[2] = { &emu, &ref_emu };
+    for (yakc* e : emus) {
+        if (!e->switchedon()) {
+            init_test_emu(*e);
+        }
+        else {
+            e->poweroff();
+        }
+        e->board.dbg = z80dbg();
+        e->poweron(device::kc85_3, os_rom::caos_3_1);
+    }
+    rv.clear();
+    rv.checkpoint_interval = 1;
+    emu.reverse_debugger = &rv;
+
+    const int num_frames = 120;
+    snapshot::membuf buf;
+    for (int i = 0; i < num_frames; i++) {
+        if (i == (num_frames - 3)) {
+            ref_emu.board.trace.setup(256, true);
+        }
+        for (yakc* e : emus) {
+            if ((i == 100) || (i == (num_frames - 4))) {
+                e->put_key('A');
+            }
+            else if ((i == 102) || (i == (num_frames - 2))) {
+                e->put_key(0);
+            }
+            e->onframe(1, 20000, 0, 0);
+        }
+    }
+    // a short frame, so that stepping back soon crosses a frame boundary
+    for (yakc* e : emus) {
+        e->onframe(1, 1000, 0, 0);
+        e->board.dbg.paused = true;
+        for (int i = 0; i < 5; i++) {
+            e->onframe(1, 20000, 0, 0);
+        }
+    }
+    tracer& trace = ref_emu.board.trace;
+    trace.save(snapshot::membuf::write, &buf);
+    trace.discard();
+    num_entries = 0;
+    int pos = sizeof(tracer::file_header);
+    while (pos < buf.size) {
+        tracer::decode_block(buf.ptr + pos, store_entry, nullptr);
+        tracer::block_header hdr;
+        memcpy(&hdr, buf.ptr + pos, sizeof(hdr));
+        pos += hdr.num_bytes;
+    }
+    buf.discard();
+}
+
+TEST(reverser_step_back) {
+    run();
+    CHECK(num_entries > 3 * 2000);
+    CHECK(emu.cycle_count() == ref_emu.cycle_count());
+    CHECK(rv.num_checkpoints() > 10);
+
+    // step back instruction by instruction, across frames and checkpoints
+    int index = num_entries - 1;
+    const int num_steps = 1500;
+    bool ok = true;
+    for (int i = 0; i < num_steps; i++, index--) {
+        ok &= rv.step_back(emu);
+        ok &= matches(entries[index]);
+        ok &= emu.board.dbg.paused;
+    }
+    CHECK(ok);
+    CHECK(emu.board.dbg.get_pc_history(z80dbg::pc_history_size - 1) == entries[index].pc);
+
+    // step forward again, then back to the same states
+    static uint64_t hashes[100];
+    for (int i = 0; i < 100; i++) {
+        hashes[i] = test_state_hash(emu);
+        index++;
+        ok &= matches(entries[index]);
+        rv.step(emu);
+    }
+    CHECK(ok);
+    for (int i = 99; i >= 0; i--) {
+        ok &= rv.step_back(emu);
+        ok &= (hashes[i] == test_state_hash(emu));
+    }
+    CHECK(ok);
+    CHECK(rv.num_desyncs() == 0);
+
+    // not possible after the state was changed from the outside
+    emu.board.cpu.PC++;
+    rv.clear();
+    CHECK(!rv.step_back(emu));
+    emu.reverse_debugger = nullptr;
+}
+
+TEST(reverser_continue) {
+    run();
+    z80dbg& dbg = emu.board.dbg;
+
+    // find an instruction which was executed twice, the first time a few frames ago
+    uword bp_addr = 0;
+    int hits[2] = { };
+    int num_hits = 0;
+    for (int start = num_entries - 200; (start >= 0) && ((num_hits < 2) || ((num_entries - hits[1]) < 1000)); start--) {
+        bp_addr = entries[start].pc;
+        num_hits = 0;
+        for (int i = num_entries - 1; (i >= 0) && (num_hits < 2); i--) {
+            if (entries[i].pc == bp_addr) {
+                hits[num_hits++] = i;
+            }
+        }
+    }
+    CHECK(num_hits == 2);
+
+    dbg.add_breakpoint(bp_addr);
+    CHECK(rv.reverse_continue(emu));
+    CHECK(matches(entries[hits[0]]));
+    CHECK(dbg.paused && (dbg.break_reason == z80dbg::break_pc) && (dbg.break_addr == bp_addr));
+    CHECK(rv.reverse_continue(emu));
+    CHECK(matches(entries[hits[1]]));
+    CHECK(dbg.break_cycle == entries[hits[1]].cycle_count);
+
+    // stepping forward from a breakpoint doesn't stop on it
+    rv.step(emu);
+    CHECK(matches(entries[hits[1] + 1]));
+
+    // without a hit in the history, nothing changes
+    dbg.remove_breakpoint(bp_addr);
+    const uint64_t hash = test_state_hash(emu);
+    const uint64_t cycle_count = emu.cycle_count();
+    CHECK(!rv.reverse_continue(emu));
+    CHECK(emu.cycle_count() == cycle_count);
+    CHECK(hash == test_state_hash(emu));
+    CHECK(dbg.paused);
+
+    // a watchpoint hit stops after the instruction which wrote the address,
+    // find the most recent push in the trace
+    int push = hits[1];
+    while ((push > 0) && (entries[push].regs[tracer::reg_SP] != (entries[push - 1].regs[tracer::reg_SP] - 2))) {
+        push--;
+    }
+    CHECK(push > 0);
+    dbg.add_watchpoint(entries[push].regs[tracer::reg_SP], 2, z80dbg::access_write);
+    CHECK(rv.reverse_continue(emu));
+    CHECK(dbg.break_reason == z80dbg::break_mem_write);
+    CHECK((emu.cycle_count() >= entries[push].cycle_count) && (emu.cycle_count() < cycle_count));
+    int index = push;
+    while (entries[index].cycle_count < emu.cycle_count()) {
+        index++;
+    }
+    CHECK(matches(entries[index]));
+    dbg.clear_watchpoints();
+    CHECK(rv.num_desyncs() == 0);
+
+    // continuing records a new future
+    dbg.paused = false;
+    emu.onframe(1, 20000, 0, 0);
+    CHECK(rv.step_back(emu));
+    CHECK(rv.num_desyncs() == 0);
+    emu.reverse_debugger = nullptr;
+}
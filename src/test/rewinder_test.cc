@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+//  rewinder_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/rewinder.h"
+#include "yakc/forkpoint.h"
+#include "test/testemu.h"
+
+using namespace YAKC;
+
+static yakc emu;
+static rewinder rw;
+
+static void init_emu() {
+    static bool initialized = false;
+    if (!initialized) {
+        initialized = true;
+        init_test_emu(emu, kc85_exp::m022_16kbyte);
+    }
+    if (emu.switchedon()) {
+        emu.poweroff();
+    }
+    rw.clear();
+}
+
+TEST(rewinder_step_back) {
+    init_emu();
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    emu.rewind_buffer = &rw;
+
+    // record a few seconds, with keyboard input in between
+    const int num_frames = 200;
+    static uint64_t hashes[num_frames];
+    int delta_bytes = 0;
+    int num_deltas = 0;
+    for (int i = 0; i < num_frames; i++) {
+        if ((i % 20) == 10) {
+            emu.put_key('A' + (i / 20));
+        }
+        else if ((i % 20) == 12) {
+            emu.put_key(0);
+        }
+        emu.onframe(1, 20000, 0, 0);
+        hashes[i] = test_state_hash(emu);
+        if ((i % rw.keyframe_interval) != 0) {
+            delta_bytes += rw.last_frame_size();
+            num_deltas++;
+        }
+    }
+    CHECK(rw.num_frames() == num_frames);
+    const int avg_delta = delta_bytes / num_deltas;
+    CHECK(avg_delta < int(sizeof(snapshot::state_t) / 64));
+
+    // step back frame by frame, across keyframes
+    emu.rewind_buffer = nullptr;
+    for (int i = num_frames - 2; i >= 0; i--) {
+        CHECK(rw.step_back(emu));
+        CHECK(hashes[i] == test_state_hash(emu));
+    }
+    CHECK(!rw.step_back(emu));
+    CHECK(rw.num_frames() == 1);
+
+    // the restored system must keep running and recording
+    emu.rewind_buffer = &rw;
+    for (int i = 0; i < 20; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    CHECK(rw.num_frames() == 21);
+    CHECK(rw.step_back(emu));
+    emu.rewind_buffer = nullptr;
+    emu.poweroff();
+}
+
+TEST(rewinder_system_switch) {
+    init_emu();
+    emu.poweron(device::z1013_64, os_rom::none);
+    emu.rewind_buffer = &rw;
+    for (int i = 0; i < 30; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    const uint64_t h0 = test_state_hash(emu);
+    emu.poweroff();
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    for (int i = 0; i < 30; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    emu.rewind_buffer = nullptr;
+    for (int i = 0; i < 30; i++) {
+        CHECK(rw.step_back(emu));
+    }
+    CHECK(emu.z1013.on && !emu.kc85.on);
+    CHECK(emu.is_device(device::z1013_64));
+    CHECK(h0 == test_state_hash(emu));
+    emu.poweroff();
+}
+
+TEST(rewinder_budget) {
+    init_emu();
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    const int default_budget = rw.budget;
+    const int default_keyframe_interval = rw.keyframe_interval;
+    rw.budget = 64 * 1024;
+    rw.keyframe_interval = 10;
+    emu.rewind_buffer = &rw;
+    for (int i = 0; i < 500; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    CHECK(rw.num_bytes() <= rw.budget);
+    CHECK(rw.num_frames() < 500);
+    CHECK(rw.num_frames() >= rw.keyframe_interval);
+    // must be able to go back to the oldest frame
+    emu.rewind_buffer = nullptr;
+    while (rw.step_back(emu)) { }
+    CHECK(rw.num_frames() == 1);
+    emu.poweroff();
+    rw.budget = default_budget;
+    rw.keyframe_interval = default_keyframe_interval;
+    rw.clear();
+}
+
+// like test_state_hash(), but without ending copy-on-write sharing
+static uint64_t shared_state_hash(yakc& emu) {
+    const memory& mem = emu.board.cpu.mem;
+    snapshot::bank_t banks[snapshot::max_banks];
+    const int num_banks = snapshot::enumerate_banks(emu, banks, snapshot::max_banks, false);
+    snapshot::sys_t sys;
+    snapshot::write_sys_state(emu, sys);
+    uint64_t h = hash(&sys, sizeof(sys));
+    for (int i = 0; i < num_banks; i++) {
+        for (int offset = 0; offset < banks[i].size; offset += memory::page::size) {
+            h = hash(mem.page_content(banks[i].ptr + offset), memory::page::size, h);
+        }
+    }
+    return h;
+}
+
+TEST(rewinder_forkpoint) {
+    init_emu();
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    for (int i = 0; i < 100; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+    static forkpoint fp;
+    fp.capture(emu);
+    fp.clone(emu);
+    memory& mem = emu.board.cpu.mem;
+    const int num_shared = mem.num_shared_pages();
+    CHECK(num_shared > 0);
+
+    // recording doesn't end copy-on-write sharing, and tracks the written pages
+    emu.rewind_buffer = &rw;
+    const int num_frames = 60;
+    static uint64_t hashes[num_frames];
+    for (int i = 0; i < num_frames; i++) {
+        emu.onframe(1, 20000, 0, 0);
+        CHECK(mem.num_shared_pages() > 0);
+        snapshot::bank_t banks[snapshot::max_banks];
+        CHECK(mem.num_tracked_ranges == snapshot::enumerate_banks(emu, banks, snapshot::max_banks, false));
+        hashes[i] = shared_state_hash(emu);
+    }
+    emu.rewind_buffer = nullptr;
+    for (int i = num_frames - 2; i >= 0; i--) {
+        CHECK(rw.step_back(emu));
+        CHECK(hashes[i] == shared_state_hash(emu));
+    }
+    fp.discard();
+    emu.poweroff();
+}
@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+//  runahead_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/runahead.h"
+#include "test/testemu.h"
+#include <string.h>
+
+using namespace YAKC;
+
+static int num_sound_events = 0;
+
+static void cb_sound(void* userdata, uint64_t cycle_pos, int channel, int hz) {
+    num_sound_events++;
+}
+static void cb_stop(void* userdata, uint64_t cycle_pos, int channel) {
+    num_sound_events++;
+}
+static void cb_volume(void* userdata, uint64_t cycle_pos, int vol) {
+    num_sound_events++;
+}
+
+TEST(runahead) {
+    static yakc emu;
+    sound_funcs snd;
+    snd.sound = cb_sound;
+    snd.stop = cb_stop;
+    snd.volume = cb_volume;
+    init_test_emu(emu, kc85_exp::none, snd);
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    const int frame_micro_secs = 20000;
+    for (int i = 0; i < 100; i++) {
+        emu.onframe(1, frame_micro_secs, 0, 0);
+    }
+
+    // type a key and run ahead 2 frames
+    emu.put_key('A');
+    emu.onframe(1, frame_micro_secs, 0, 0);
+    const uint64_t h0 = test_state_hash(emu);
+    const uint64_t cycles0 = emu.cycle_count();
+    runahead ra;
+    CHECK(!ra.run(emu, frame_micro_secs));
+    ra.num_frames = 2;
+    num_sound_events = 0;
+    // breakpoints are ignored, and the PC history isn't changed
+    z80dbg& dbg = emu.board.dbg;
+    const uword pc_history0 = dbg.get_pc_history(z80dbg::pc_history_size - 1);
+    dbg.add_breakpoint(emu.board.cpu.PC);
+    CHECK(ra.run(emu, frame_micro_secs));
+    dbg.remove_breakpoint(emu.board.cpu.PC);
+    CHECK(!dbg.paused && !dbg.suspended);
+    CHECK(dbg.get_pc_history(z80dbg::pc_history_size - 1) == pc_history0);
+    CHECK(num_sound_events == 0);
+    CHECK(ra.num_emulated_frames == 2);
+    static unsigned int future[320*256];
+    memcpy(future, emu.kc85.video.rgba8_buffer, sizeof(future));
+
+    // the machine must be back in the present
+    CHECK(emu.cycle_count() == cycles0);
+    CHECK(h0 == test_state_hash(emu));
+
+    // ...and running the next 2 frames must produce the displayed future
+    emu.onframe(1, frame_micro_secs, 0, 0);
+    emu.onframe(1, frame_micro_secs, 0, 0);
+    CHECK(0 == memcmp(future, emu.kc85.video.rgba8_buffer, sizeof(future)));
+    CHECK(emu.cycle_count() > cycles0);
+
+    // no run-ahead when the debugger is active
+    dbg.paused = true;
+    CHECK(!ra.run(emu, frame_micro_secs));
+    dbg.paused = false;
+    emu.poweroff();
+}
@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+//  snapshot_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/snapshot.h"
+#include "test/testemu.h"
+#include "zlib.h"
+#include <string.h>
+
+using namespace YAKC;
+
+static yakc emu;
+
+static void init_emu() {
+    static bool initialized = false;
+    if (!initialized) {
+        initialized = true;
+        init_test_emu(emu, kc85_exp::m022_16kbyte);
+    }
+    if (emu.switchedon()) {
+        emu.poweroff();
+    }
+}
+
+static void run(int num_frames) {
+    for (int i = 0; i < num_frames; i++) {
+        emu.onframe(1, 20000, 0, 0);
+    }
+}
+
+static uint64_t mem_hash() {
+    snapshot::bank_t banks[snapshot::max_banks];
+    const int num_banks = snapshot::enumerate_banks(emu, banks, snapshot::max_banks);
+    uint64_t h = hash(nullptr, 0);
+    for (int i = 0; i < num_banks; i++) {
+        h = hash(banks[i].ptr, banks[i].size, h);
+    }
+    return h;
+}
+
+TEST(snapshot_banks) {
+    init_emu();
+    snapshot::bank_t banks[snapshot::max_banks];
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    CHECK(snapshot::enumerate_banks(emu, banks, snapshot::max_banks) == 3);
+    CHECK(banks[2].type == snapshot::bank_module);
+    CHECK(banks[2].index == 0x08);
+    CHECK(banks[2].size == 0x4000);
+    emu.poweroff();
+    emu.poweron(device::kc85_4, os_rom::caos_4_2);
+    CHECK(snapshot::enumerate_banks(emu, banks, snapshot::max_banks) == 9);
+    emu.poweroff();
+    emu.poweron(device::z1013_01, os_rom::none);
+    CHECK(snapshot::enumerate_banks(emu, banks, snapshot::max_banks) == 2);
+    CHECK(banks[0].size == 0x4000);
+    emu.poweroff();
+    emu.poweron(device::kc87, os_rom::kc87_os_2);
+    CHECK(snapshot::enumerate_banks(emu, banks, snapshot::max_banks) == 3);
+    CHECK(banks[0].size == 0xC000);
+    emu.poweroff();
+}
+
+TEST(snapshot_stream) {
+    init_emu();
+    emu.poweron(device::kc85_4, os_rom::caos_4_2);
+    run(100);
+
+    snapshot::membuf buf;
+    CHECK(snapshot::write_stream(emu, snapshot::membuf::write, &buf));
+    CHECK(buf.size < int(sizeof(snapshot::state_t) / 4));
+    const uint64_t h0 = mem_hash();
+    const uword pc0 = emu.board.cpu.PC;
+    const uword sp0 = emu.board.cpu.SP;
+    const ubyte pio_a0 = emu.kc85.pio_a;
+
+    // continue running, and restore
+    run(50);
+    emu.kc85.exp.slot_by_addr(0x08).mod.mem_ptr[0x1234] = 0x55;
+    CHECK(h0 != mem_hash());
+    CHECK(snapshot::read_stream(snapshot::membuf::read, &buf, emu));
+    CHECK(h0 == mem_hash());
+    CHECK(pc0 == emu.board.cpu.PC);
+    CHECK(sp0 == emu.board.cpu.SP);
+    CHECK(pio_a0 == emu.kc85.pio_a);
+    CHECK(emu.kc85.on && emu.is_device(device::kc85_4));
+    run(50);
+
+    // a truncated stream must fail, and leave the system untouched
+    const uint64_t h2 = mem_hash();
+    const uword pc2 = emu.board.cpu.PC;
+    const ubyte pio_a2 = emu.kc85.pio_a;
+    buf.pos = 0;
+    buf.size /= 2;
+    CHECK(!snapshot::read_stream(snapshot::membuf::read, &buf, emu));
+    CHECK(h2 == mem_hash());
+    CHECK(pc2 == emu.board.cpu.PC);
+    CHECK(pio_a2 == emu.kc85.pio_a);
+    buf.discard();
+
+    // switch system through snapshot
+    emu.poweroff();
+    emu.poweron(device::z1013_64, os_rom::none);
+    run(50);
+    CHECK(snapshot::write_stream(emu, snapshot::membuf::write, &buf));
+    const uint64_t h1 = mem_hash();
+    emu.poweroff();
+    emu.poweron(device::z9001, os_rom::z9001_os_1_2);
+    buf.pos = 0;
+    CHECK(snapshot::read_stream(snapshot::membuf::read, &buf, emu));
+    CHECK(emu.z1013.on && emu.is_device(device::z1013_64));
+    CHECK(h1 == mem_hash());
+    buf.discard();
+    emu.poweroff();
+}
+
+TEST(snapshot_import_v1) {
+    init_emu();
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    run(100);
+    static snapshot::state_t state;
+    snapshot::take_snapshot(emu, state);
+    const uint64_t h0 = mem_hash();
+    const uword pc0 = emu.board.cpu.PC;
+    run(50);
+
+    snapshot::membuf buf;
+    snapshot::membuf::write(&buf, &state, sizeof(state));
+    CHECK(snapshot::read_stream(snapshot::membuf::read, &buf, emu));
+    CHECK(h0 == mem_hash());
+    CHECK(pc0 == emu.board.cpu.PC);
+    buf.discard();
+    emu.poweroff();
+}
+
+// decompress a version 2 stream, let a function rewrite the chunks, and compress it again
+static ubyte raw_in[0x80000];
+static ubyte raw_out[0x80000];
+typedef int (*rewrite_func)(uint32_t id, const ubyte* chunk, int chunk_size, ubyte* dst);
+static void rewrite_chunks(snapshot::membuf& buf, rewrite_func fn) {
+    uLongf raw_size = sizeof(raw_in);
+    CHECK(Z_OK == uncompress(raw_in, &raw_size, buf.ptr + 8, buf.size - 8));
+    int out_size = 0;
+    for (int pos = 0; pos < int(raw_size); ) {
+        uint32_t hdr[3];
+        memcpy(hdr, raw_in + pos, sizeof(hdr));
+        const int chunk_size = sizeof(hdr) + hdr[2];
+        out_size += fn(hdr[0], raw_in + pos, chunk_size, raw_out + out_size);
+        pos += chunk_size;
+    }
+    uLongf comp_size = compressBound(out_size);
+    ubyte* comp = (ubyte*) malloc(8 + comp_size);
+    memcpy(comp, buf.ptr, 8);
+    CHECK(Z_OK == compress(comp + 8, &comp_size, raw_out, out_size));
+    buf.discard();
+    snapshot::membuf::write(&buf, comp, int(8 + comp_size));
+    free(comp);
+}
+
+// add an unknown chunk, and give the CTC chunk a newer version
+static int future_chunks(uint32_t id, const ubyte* chunk, int chunk_size, ubyte* dst) {
+    int num = 0;
+    if ('END ' == id) {
+        const uint32_t hdr[3] = { 'XTRA', 1, 5 };
+        memcpy(dst, hdr, sizeof(hdr));
+        memcpy(dst + sizeof(hdr), "hello", 5);
+        num = sizeof(hdr) + 5;
+    }
+    memcpy(dst + num, chunk, chunk_size);
+    if ('CTC ' == id) {
+        const uint32_t version = 2;
+        memcpy(dst + num + 4, &version, sizeof(version));
+    }
+    return num + chunk_size;
+}
+
+// drop the required emulator chunk
+static int no_emu_chunk(uint32_t id, const ubyte* chunk, int chunk_size, ubyte* dst) {
+    if ('EMU ' == id) {
+        return 0;
+    }
+    memcpy(dst, chunk, chunk_size);
+    return chunk_size;
+}
+
+TEST(snapshot_chunks) {
+    init_emu();
+    emu.poweron(device::kc85_3, os_rom::caos_3_1);
+    run(100);
+    snapshot::membuf buf;
+    CHECK(snapshot::write_stream(emu, snapshot::membuf::write, &buf));
+    const uint64_t h0 = mem_hash();
+    const uword pc0 = emu.board.cpu.PC;
+    run(50);
+
+    // unknown chunks and subsystem versions are skipped one by one,
+    // the skipped subsystem keeps its current state
+    rewrite_chunks(buf, future_chunks);
+    snapshot::sys_t sys_before;
+    snapshot::write_sys_state(emu, sys_before);
+    CHECK(snapshot::read_stream(snapshot::membuf::read, &buf, emu));
+    snapshot::sys_t sys_after;
+    snapshot::write_sys_state(emu, sys_after);
+    CHECK(h0 == mem_hash());
+    CHECK(pc0 == emu.board.cpu.PC);
+    CHECK(0 == memcmp(&sys_before.ctc, &sys_after.ctc, sizeof(sys_before.ctc)));
+
+    // without the emulator chunk the stream is rejected
+    run(50);
+    const uword pc1 = emu.board.cpu.PC;
+    buf.pos = 0;
+    rewrite_chunks(buf, no_emu_chunk);
+    CHECK(!snapshot::read_stream(snapshot::membuf::read, &buf, emu));
+    CHECK(pc1 == emu.board.cpu.PC);
+    buf.discard();
+    emu.poweroff();
+}
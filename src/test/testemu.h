@@ -0,0 +1,41 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    Shared emulator setup for the unit tests.
+*/
+#include "yakc/yakc.h"
+#include "yakc/snapshot.h"
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+/// init an emulator with the KC85 ROMs, and a module in expansion slot 08
+inline void
+init_test_emu(yakc& emu, kc85_exp::module_type slot08=kc85_exp::none, const sound_funcs& snd=sound_funcs(), const ext_funcs& funcs=ext_funcs()) {
+    emu.init(funcs, snd);
+    emu.kc85.roms.add(kc85_roms::caos31, dump_caos31, sizeof(dump_caos31));
+    emu.kc85.roms.add(kc85_roms::basic_rom, dump_basic_c0, sizeof(dump_basic_c0));
+    emu.kc85.roms.add(kc85_roms::caos42c, dump_caos42c, sizeof(dump_caos42c));
+    emu.kc85.roms.add(kc85_roms::caos42e, dump_caos42e, sizeof(dump_caos42e));
+    emu.kc85.exp.register_none_module("NO MODULE", "");
+    emu.kc85.exp.register_ram_module(kc85_exp::m022_16kbyte, 0xC0, 0x4000, "");
+    emu.kc85.exp.insert_module(0x08, slot08);
+    emu.kc85.exp.insert_module(0x0C, kc85_exp::none);
+}
+
+//------------------------------------------------------------------------------
+/// hash the non-memory state and all memory banks of an emulator
+inline uint64_t
+test_state_hash(yakc& emu) {
+    snapshot::bank_t banks[snapshot::max_banks];
+    const int num_banks = snapshot::enumerate_banks(emu, banks, snapshot::max_banks);
+    snapshot::sys_t sys;
+    snapshot::write_sys_state(emu, sys);
+    uint64_t h = hash(&sys, sizeof(sys));
+    for (int i = 0; i < num_banks; i++) {
+        h = hash(banks[i].ptr, banks[i].size, h);
+    }
+    return h;
+}
+
+} // namespace YAKC
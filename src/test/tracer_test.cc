@@ -0,0 +1,228 @@
+//------------------------------------------------------------------------------
+//  tracer_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/snapshot.h"
+#include "yakc/z80bus.h"
+#include "test/testemu.h"
+
+using namespace YAKC;
+
+static ubyte ram[0x10000];
+
+// a reference trace recorded while stepping
+struct ref_entry {
+    uword pc;
+    uint64_t cycle_count;
+    uword hl;
+};
+static const int num_ref_entries = 20000;
+static ref_entry ref[num_ref_entries];
+
+struct decode_state {
+    const memory* mem = nullptr;
+    int first = -1;         // index of the first decoded entry in ref
+    int num = 0;
+    uint64_t last_cycle = 0;
+    bool ok = true;
+};
+
+static void check_entry(void* userdata, const tracer::entry& e) {
+    decode_state* state = (decode_state*) userdata;
+    if (state->first < 0) {
+        // find the first decoded entry in the reference trace by its cycle count
+        state->first = 0;
+        while ((state->first < num_ref_entries) && (ref[state->first].cycle_count != e.cycle_count)) {
+            state->first++;
+        }
+    }
+    const int i = state->first + state->num++;
+    if ((i >= num_ref_entries) ||
+        (ref[i].pc != e.pc) ||
+        (ref[i].cycle_count != e.cycle_count) ||
+        !e.has_regs ||
+        (ref[i].hl != e.regs[tracer::reg_HL]) ||
+        (e.num_op_bytes != tracer::instr_length(*state->mem, e.pc)) ||
+        (e.op[0] != ram[e.pc])) {
+        state->ok = false;
+    }
+}
+
+static void check_cycles(void* userdata, const tracer::entry& e) {
+    decode_state* state = (decode_state*) userdata;
+    if (e.has_regs || ((state->num > 0) && (e.cycle_count <= state->last_cycle))) {
+        state->ok = false;
+    }
+    state->last_cycle = e.cycle_count;
+    state->num++;
+}
+
+// decode an exported trace stream, return number of blocks or -1 on error
+static int decode_stream(const snapshot::membuf& buf, tracer::entry_func fn, decode_state& state) {
+    tracer::file_header hdr;
+    if ((buf.size < int(sizeof(hdr))) || (0 != memcmp(buf.ptr, hdr.magic, sizeof(hdr.magic)))) {
+        return -1;
+    }
+    int pos = sizeof(hdr);
+    int num_blocks = 0;
+    uint64_t next_seq = 0;
+    while (pos < buf.size) {
+        tracer::block_header block;
+        memcpy(&block, buf.ptr + pos, sizeof(block));
+        if ((num_blocks > 0) && (block.seq != next_seq)) {
+            return -1;
+        }
+        next_seq = block.seq + 1;
+        if (tracer::decode_block(buf.ptr + pos, fn, &state) != int(block.num_records)) {
+            return -1;
+        }
+        pos += block.num_bytes;
+        num_blocks++;
+    }
+    return (pos == buf.size) ? num_blocks : -1;
+}
+
+TEST(tracer_instr_length) {
+    memory mem;
+    mem.map(0, 0x0000, sizeof(ram), ram, true);
+    static const struct {
+        ubyte bytes[2];
+        int len;
+    } instrs[] = {
+        { { 0x00, 0x00 }, 1 },  // NOP
+        { { 0x3E, 0x00 }, 2 },  // LD A,n
+        { { 0x18, 0x00 }, 2 },  // JR e
+        { { 0x21, 0x00 }, 3 },  // LD HL,nn
+        { { 0x3A, 0x00 }, 3 },  // LD A,(nn)
+        { { 0xCD, 0x00 }, 3 },  // CALL nn
+        { { 0xD3, 0x00 }, 2 },  // OUT (n),A
+        { { 0xCB, 0x47 }, 2 },  // BIT 0,A
+        { { 0xED, 0xB0 }, 2 },  // LDIR
+        { { 0xED, 0x43 }, 4 },  // LD (nn),BC
+        { { 0xED, 0x7B }, 4 },  // LD SP,(nn)
+        { { 0xDD, 0x21 }, 4 },  // LD IX,nn
+        { { 0xDD, 0x36 }, 4 },  // LD (IX+d),n
+        { { 0xDD, 0x7E }, 3 },  // LD A,(IX+d)
+        { { 0xFD, 0x34 }, 3 },  // INC (IY+d)
+        { { 0xFD, 0xE9 }, 2 },  // JP (IY)
+        { { 0xDD, 0xCB }, 4 },  // BIT 0,(IX+d)
+    };
+    for (const auto& instr : instrs) {
+        ram[0x1000] = instr.bytes[0];
+        ram[0x1001] = instr.bytes[1];
+        CHECK(tracer::instr_length(mem, 0x1000) == instr.len);
+    }
+}
+
+TEST(tracer) {
+    static z80bus bus;
+    static z80 cpu;
+    memset(ram, 0, sizeof(ram));
+    cpu.mem.map(0, 0x0000, sizeof(ram), ram, true);
+    cpu.init(&bus);
+    ubyte prog[] = {
+        0x21, 0x00, 0x40,           // LD HL,0x4000
+        0x06, 0x20,                 // LD B,0x20
+        0x23,                       // loop: INC HL
+        0x77,                       // LD (HL),A
+        0x10, 0xFC,                 // DJNZ loop
+        0xDD, 0x21, 0x34, 0x12,     // LD IX,0x1234
+        0xDD, 0x77, 0x05,           // LD (IX+5),A
+        0x01, 0x10, 0x00,           // LD BC,0x0010
+        0x11, 0x00, 0x50,           // LD DE,0x5000
+        0xED, 0xB0,                 // LDIR
+        0x3C,                       // INC A
+        0xC3, 0x00, 0x00,           // JP 0x0000
+    };
+    cpu.mem.write(0x0000, prog, sizeof(prog));
+
+    // a small ring buffer which wraps around
+    tracer trace;
+    trace.setup(4, true);
+    CHECK(trace.is_valid() && trace.enabled);
+    uint64_t cycle_count = 1000;
+    for (int i = 0; i < num_ref_entries; i++) {
+        ref[i].pc = cpu.PC;
+        ref[i].cycle_count = cycle_count;
+        ref[i].hl = cpu.HL;
+        trace.record(cpu, cycle_count);
+        cycle_count += cpu.step();
+    }
+    snapshot::membuf buf;
+    CHECK(trace.save(snapshot::membuf::write, &buf));
+    CHECK(trace.num_lost_blocks > 0);
+
+    // the ring buffer contains the most recent history up to the last instruction
+    decode_state state;
+    state.mem = &cpu.mem;
+    const int num_blocks = decode_stream(buf, check_entry, state);
+    CHECK(num_blocks == 3);
+    CHECK(state.ok);
+    CHECK(state.first > 0);
+    CHECK((state.first + state.num) == num_ref_entries);
+    // with registers, the changed values are stored
+    CHECK((buf.size / state.num) < 12);
+
+    // a truncated block must be rejected, without reading past its end
+    tracer::block_header block;
+    memcpy(&block, buf.ptr + sizeof(tracer::file_header), sizeof(block));
+    bool rejected = true;
+    for (uint32_t num_bytes = sizeof(block); num_bytes < block.num_bytes; num_bytes++) {
+        ubyte* copy = (ubyte*) malloc(num_bytes);
+        memcpy(copy, buf.ptr + sizeof(tracer::file_header), num_bytes);
+        ((tracer::block_header*)copy)->num_bytes = num_bytes;
+        decode_state trunc_state;
+        rejected &= -1 == tracer::decode_block(copy, check_cycles, &trunc_state);
+        free(copy);
+    }
+    CHECK(rejected);
+    buf.discard();
+
+    // nothing left to save
+    CHECK(trace.save(snapshot::membuf::write, &buf));
+    CHECK(buf.size == int(sizeof(tracer::file_header)));
+    buf.discard();
+    trace.discard();
+    CHECK(!trace.is_valid() && !trace.enabled);
+}
+
+TEST(tracer_export) {
+    static yakc emu;
+    static yakc ref_emu;
+    yakc* emus[2] = { &emu, &ref_emu };
+    for (yakc* e : emus) {
+        init_test_emu(*e);
+        e->poweron(device::kc85_3, os_rom::caos_3_1);
+    }
+
+    // stream the trace of the boot sequence on a background thread
+    tracer& trace = emu.board.trace;
+    trace.setup(tracer::default_num_blocks, false);
+    snapshot::membuf buf;
+    CHECK(trace.start_export(snapshot::membuf::write, &buf));
+    CHECK(trace.exporting());
+    for (int i = 0; i < 50; i++) {
+        emu.onframe(1, 20000, 0, 0);
+        ref_emu.onframe(1, 20000, 0, 0);
+    }
+    CHECK(trace.stop_export());
+    CHECK(!trace.exporting());
+    CHECK(trace.num_lost_blocks == 0);
+
+    decode_state state;
+    const int num_blocks = decode_stream(buf, check_cycles, state);
+    CHECK(num_blocks == int(trace.num_blocks_written()));
+    CHECK(state.ok);
+    CHECK(state.num > 50 * 2000);
+    CHECK(state.last_cycle < emu.cycle_count());
+    // without registers, a few bytes per instruction
+    CHECK((double(buf.size) / state.num) < 4.0);
+
+    // tracing doesn't change the emulation
+    CHECK(emu.cycle_count() == ref_emu.cycle_count());
+    CHECK(emu.board.cpu.PC == ref_emu.board.cpu.PC);
+    buf.discard();
+    trace.discard();
+    emu.poweroff();
+    ref_emu.poweroff();
+}
@@ -2127,6 +2127,82 @@ TEST(CPDR) {
     CHECK(cpu.test_flags(z80::NF|z80::CF));
 }
 
+// bulk execution of LDIR/LDDR/CPIR/CPDR must give the same results as
+// executing one iteration per step
+class bulkTestBus : public cpuTestBus {
+public:
+    int budget = 0;
+    int block_cycles(uword pc) {
+        return this->budget;
+    }
+};
+
+static ubyte bulk_ram[2][0x4000];
+static ubyte bulk_rom[0x400];
+
+static uint32_t run_block_op(z80& cpu, ubyte op, uword hl, uword de, uword bc, ubyte a) {
+    cpu.mem.w8(0x0000, 0xED);
+    cpu.mem.w8(0x0001, op);
+    cpu.PC = 0x0000;
+    cpu.HL = hl; cpu.DE = de; cpu.BC = bc; cpu.A = a;
+    cpu.F = z80::CF|z80::SF; cpu.R = 0x7E; cpu.WZ = 0x1234;
+    uint32_t t = 0;
+    while (cpu.PC != 0x0002) {
+        t += cpu.step();
+    }
+    return t;
+}
+
+TEST(block_bulk) {
+    static const struct {
+        ubyte op; uword hl, de, bc; ubyte a;
+    } cases[] = {
+        { 0xB0, 0x1010, 0x2C07, 0x0900, 0x00 },     // LDIR across pages
+        { 0xB0, 0x1000, 0x1001, 0x0800, 0x11 },     // LDIR memory fill
+        { 0xB0, 0x1010, 0x1000, 0x0500, 0x22 },     // LDIR overlapping down
+        { 0xB0, 0x1000, 0x4100, 0x0300, 0x33 },     // LDIR into ROM
+        { 0xB0, 0x3F00, 0xFF80, 0x0200, 0x44 },     // LDIR wrapping around, overwriting itself
+        { 0xB8, 0x18FF, 0x28F0, 0x0900, 0x55 },     // LDDR across pages
+        { 0xB8, 0x1800, 0x17FF, 0x0800, 0x66 },     // LDDR memory fill
+        { 0xB8, 0x1800, 0x1810, 0x0500, 0x77 },     // LDDR overlapping up
+        { 0xB1, 0x1000, 0x0000, 0x1000, 0xA5 },     // CPIR found
+        { 0xB1, 0x1000, 0x0000, 0x0300, 0xEE },     // CPIR not found
+        { 0xB9, 0x2FFF, 0x0000, 0x1000, 0xA5 },     // CPDR found
+        { 0xB9, 0x2FFF, 0x0000, 0x0300, 0xEE },     // CPDR not found
+    };
+    static const int budgets[] = { 1<<30, 1000, 100, 22, 21 };
+    for (const auto& c : cases) {
+        for (int budget : budgets) {
+            z80 cpu[2];
+            bulkTestBus bus[2];
+            bus[1].budget = budget;
+            for (int i = 0; i < 2; i++) {
+                uint32_t x = 0x12345678;
+                for (int a = 0; a < 0x4000; a++) {
+                    x ^= x<<13; x ^= x>>17; x ^= x<<5;
+                    bulk_ram[i][a] = ubyte(x);
+                }
+                bulk_ram[i][0x1A33] = 0xA5;
+                bulk_ram[i][0x2C11] = 0xA5;
+                cpu[i].mem.map(0, 0x0000, sizeof(bulk_ram[i]), bulk_ram[i], true);
+                cpu[i].mem.map(0, 0x4000, sizeof(bulk_rom), bulk_rom, false);
+                cpu[i].mem.map(0, 0xC000, sizeof(bulk_ram[i]), bulk_ram[i], true);
+                cpu[i].init(&bus[i]);
+            }
+            const uint32_t t0 = run_block_op(cpu[0], c.op, c.hl, c.de, c.bc, c.a);
+            const uint32_t t1 = run_block_op(cpu[1], c.op, c.hl, c.de, c.bc, c.a);
+            CHECK(t0 == t1);
+            CHECK(cpu[0].AF == cpu[1].AF);
+            CHECK(cpu[0].BC == cpu[1].BC);
+            CHECK(cpu[0].DE == cpu[1].DE);
+            CHECK(cpu[0].HL == cpu[1].HL);
+            CHECK(cpu[0].WZ == cpu[1].WZ);
+            CHECK(cpu[0].R == cpu[1].R);
+            CHECK(0 == memcmp(bulk_ram[0], bulk_ram[1], sizeof(bulk_ram[0])));
+        }
+    }
+}
+
 TEST(DAA) {
     z80 cpu = init_z80();
 
@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+//  z80dbg_test.cc
+//------------------------------------------------------------------------------
+#include "UnitTest++/src/UnitTest++.h"
+#include "yakc/z80dbg.h"
+#include "yakc/z80expr.h"
+#include "yakc/z80bus.h"
+
+using namespace YAKC;
+
+static ubyte ram[0x4000];
+static uint64_t cycle_count = 0;
+
+// run like the onframe() loop of the emulated systems, return number of steps
+static int run(z80& cpu, z80dbg& dbg, int max_steps) {
+    int steps = 0;
+    dbg.begin_run(cpu);
+    while (steps < max_steps) {
+        if (dbg.check_break(cpu, cycle_count)) {
+            dbg.paused = true;
+            break;
+        }
+        cycle_count += cpu.step();
+        steps++;
+    }
+    dbg.end_run(cpu);
+    return steps;
+}
+
+TEST(z80dbg) {
+    static z80bus bus;
+    static z80 cpu;
+    static z80dbg dbg;
+    memset(ram, 0, sizeof(ram));
+    cpu.mem.map(0, 0x0000, sizeof(ram), ram, true);
+    cpu.init(&bus);
+
+    ubyte prog[] = {
+        0x21, 0x00, 0x10,       // LD HL,0x1000
+        0x7E,                   // LD A,(HL)
+        0x23,                   // INC HL
+        0x77,                   // LD (HL),A
+        0xD3, 0x88,             // OUT (0x88),A
+        0xDB, 0x89,             // IN A,(0x89)
+        0x18, 0xF4,             // JR -12 (to LD HL,0x1000)
+    };
+    cpu.mem.write(0x0000, prog, sizeof(prog));
+
+    // lots of PC breakpoints, only one is on the program path
+    for (int addr = 0x2000; addr < 0x3000; addr++) {
+        dbg.add_breakpoint(addr);
+    }
+    dbg.add_breakpoint(0x0004);
+    CHECK(dbg.num_breakpoints() == 0x1001);
+    CHECK(run(cpu, dbg, 100) == 2);
+    CHECK(dbg.break_reason == z80dbg::break_pc);
+    CHECK(dbg.break_addr == 0x0004);
+    dbg.clear_breakpoints();
+    CHECK(dbg.num_breakpoints() == 0);
+    CHECK(!dbg.is_breakpoint(0x2345));
+
+    // the indexed breakpoints use the same bitmap
+    dbg.enable_breakpoint(0, 0x0006);
+    CHECK(dbg.is_breakpoint(0x0006));
+    dbg.toggle_breakpoint(0, 0x0006);
+    CHECK(!dbg.is_breakpoint(0x0006));
+    CHECK(!dbg.breakpoint_enabled(0));
+    dbg.toggle_breakpoint(0, 0x0008);
+    CHECK(dbg.is_breakpoint(0x0008) && dbg.breakpoint_enabled(0));
+    dbg.disable_breakpoint(0);
+    CHECK(dbg.num_breakpoints() == 0);
+
+    // a write watchpoint stops before the next instruction
+    cpu.PC = 0x0000;
+    dbg.add_watchpoint(0x1001, 1, z80dbg::access_write);
+    CHECK(dbg.is_watchpoint(0x1001, z80dbg::access_write));
+    CHECK(!dbg.is_watchpoint(0x1001, z80dbg::access_read));
+    CHECK(run(cpu, dbg, 100) == 4);
+    CHECK(dbg.break_reason == z80dbg::break_mem_write);
+    CHECK(dbg.break_addr == 0x1001);
+    CHECK(cpu.PC == 0x0006);
+    // the traps are removed outside of run()
+    CHECK(cpu.mem.is_writable(0x1001));
+    dbg.clear_watchpoints();
+
+    // a read watchpoint
+    cpu.PC = 0x0000;
+    dbg.add_watchpoint(0x0FF0, 0x20, z80dbg::access_read);
+    CHECK(run(cpu, dbg, 100) == 2);
+    CHECK(dbg.break_reason == z80dbg::break_mem_read);
+    CHECK(dbg.break_addr == 0x1000);
+    dbg.remove_watchpoint(0x0FF0, 0x20, z80dbg::access_read);
+    CHECK(!dbg.is_watchpoint(0x1000, z80dbg::access_rw));
+
+    // I/O breakpoints
+    dbg.add_io_breakpoint(0x89, z80dbg::access_read);
+    CHECK(run(cpu, dbg, 100) == 4);
+    CHECK(dbg.break_reason == z80dbg::break_io_in);
+    CHECK((dbg.break_addr & 0xFF) == 0x89);
+    dbg.add_io_breakpoint(0x88, z80dbg::access_write);
+    CHECK(run(cpu, dbg, 100) == 6);
+    CHECK(dbg.break_reason == z80dbg::break_io_out);
+    CHECK((dbg.break_addr & 0xFF) == 0x88);
+    dbg.clear_io_breakpoints();
+    CHECK(run(cpu, dbg, 100) == 100);
+    CHECK(cpu.io_trap == nullptr);
+}
+
+TEST(z80expr) {
+    static z80bus bus;
+    static z80 cpu;
+    memset(ram, 0, sizeof(ram));
+    cpu.mem.map(0, 0x0000, sizeof(ram), ram, true);
+    cpu.init(&bus);
+    cpu.PC = 0x0213;
+    cpu.A = 0x1F;
+    cpu.IX = 0x1000;
+    cpu.HL_ = 0x1234;
+    ram[0x1008] = 0x81;
+
+    z80expr expr;
+    CHECK(!expr.is_valid());
+    CHECK(expr.compile("PC==0x0213 && A==0x1F && (IX+8)&1"));
+    CHECK(expr.is_valid());
+    CHECK(expr.eval(cpu, 0) == 1);
+    ram[0x1008] = 0x80;
+    CHECK(expr.eval(cpu, 0) == 0);
+
+    // precedence, grouping, number formats and register names
+    CHECK(expr.compile("1+2*3") && (expr.eval(cpu, 0) == 7));
+    CHECK(expr.compile("[1+2]*3") && (expr.eval(cpu, 0) == 9));
+    CHECK(expr.compile("$10 + 0x10 + 10") && (expr.eval(cpu, 0) == 42));
+    CHECK(expr.compile("1 << 4 | 1") && (expr.eval(cpu, 0) == 0x11));
+    CHECK(expr.compile("a == $1f && !f") && (expr.eval(cpu, 0) == 1));
+    CHECK(expr.compile("HL' - 0x34 == 0x1200") && (expr.eval(cpu, 0) == 1));
+    CHECK(expr.compile("-1 < 0 && ~0 == -1") && (expr.eval(cpu, 0) == 1));
+    CHECK(expr.compile("(IX+8) ^ 0x80 || 0") && (expr.eval(cpu, 0) == 0));
+    CHECK(expr.compile("CYC >= 100000") && (expr.eval(cpu, 99999) == 0) && (expr.eval(cpu, 100000) == 1));
+    CHECK(expr.compile("0xFFFFFFFF == 4294967295") && (expr.eval(cpu, 0) == 1));
+
+    // syntax errors
+    CHECK(!expr.compile("") && expr.error);
+    CHECK(!expr.compile("A ==") && expr.error);
+    CHECK(!expr.compile("(HL") && !expr.is_valid());
+    CHECK(!expr.compile("XY == 1"));
+    CHECK(!expr.compile("12AB"));
+    CHECK(!expr.compile("0x100000000"));
+    CHECK(!expr.compile("A == 1 )"));
+    CHECK(!expr.compile("[[[[[[[[[[[[[[[[[1+2]]]]]]]]]]]]]]]] + [[[[[[[[[[[[[[[[[3+4]]]]]]]]]]]]]]]]"));
+}
+
+TEST(z80dbg_conditions) {
+    static z80bus bus;
+    static z80 cpu;
+    static z80dbg dbg;
+    memset(ram, 0, sizeof(ram));
+    cpu.mem.map(0, 0x0000, sizeof(ram), ram, true);
+    cpu.init(&bus);
+
+    ubyte prog[] = {
+        0x06, 0x00,             // LD B,0
+        0x04,                   // loop: INC B
+        0x78,                   // LD A,B
+        0x32, 0x00, 0x10,       // LD (0x1000),A
+        0xD3, 0x88,             // OUT (0x88),A
+        0x18, 0xF7,             // JR loop
+    };
+    cpu.mem.write(0x0000, prog, sizeof(prog));
+
+    // a conditional PC breakpoint
+    dbg.add_breakpoint(0x0004);
+    CHECK(dbg.set_condition(z80dbg::break_pc, 0x0004, "A == 5", 0));
+    CHECK(dbg.has_condition(z80dbg::break_pc, 0x0004));
+    run(cpu, dbg, 1000);
+    CHECK(dbg.paused && (cpu.PC == 0x0004) && (cpu.A == 5));
+    CHECK(dbg.hit_count(z80dbg::break_pc, 0x0004) == 1);
+    dbg.paused = false;
+
+    // an ignore count without a condition
+    CHECK(dbg.set_condition(z80dbg::break_pc, 0x0004, nullptr, 3));
+    cpu.step();
+    run(cpu, dbg, 1000);
+    CHECK(cpu.A == 9);
+    CHECK(dbg.hit_count(z80dbg::break_pc, 0x0004) == 4);
+    dbg.remove_condition(z80dbg::break_pc, 0x0004);
+    CHECK(!dbg.has_condition(z80dbg::break_pc, 0x0004));
+    dbg.clear_breakpoints();
+
+    // a conditional write watchpoint, reading memory in the condition
+    dbg.add_watchpoint(0x1000, 1, z80dbg::access_write);
+    CHECK(dbg.set_condition(z80dbg::break_mem_write, 0x1000, "(0x1000) & 0x10", 0));
+    run(cpu, dbg, 1000);
+    CHECK(dbg.break_reason == z80dbg::break_mem_write);
+    CHECK(ram[0x1000] == 0x10);
+    dbg.clear_watchpoints();
+
+    // a conditional I/O breakpoint with ignore count, and a cycle count condition
+    dbg.add_io_breakpoint(0x88, z80dbg::access_write);
+    CHECK(dbg.set_condition(z80dbg::break_io_out, 0x1288, "[A & 3] == 0", 2));
+    run(cpu, dbg, 1000);
+    CHECK(dbg.break_reason == z80dbg::break_io_out);
+    CHECK(cpu.A == 0x18);
+    const uint64_t cyc = cycle_count + 500;
+    char str[64];
+    snprintf(str, sizeof(str), "CYC >= %d", int(cyc));
+    CHECK(dbg.set_condition(z80dbg::break_io_out, 0x88, str, 0));
+    run(cpu, dbg, 1000);
+    CHECK((cycle_count >= cyc) && (cycle_count < cyc + 50));
+    dbg.clear_io_breakpoints();
+    dbg.clear_conditions();
+
+    // invalid conditions are rejected
+    CHECK(!dbg.set_condition(z80dbg::break_pc, 0x0000, "A ==", 0));
+    CHECK(dbg.condition_error != nullptr);
+    CHECK(!dbg.has_condition(z80dbg::break_pc, 0x0000));
+}
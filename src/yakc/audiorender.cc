@@ -0,0 +1,250 @@
+//------------------------------------------------------------------------------
+//  audiorender.cc
+//------------------------------------------------------------------------------
+#include "audiorender.h"
+#include <stdio.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+audiorender::~audiorender() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::init(int max_frames_) {
+    YAKC_ASSERT(nullptr == this->buffer);
+    YAKC_ASSERT(max_frames_ > 0);
+    this->max_frames = max_frames_;
+    this->buffer = (int16_t*) YAKC_MALLOC(this->funcs, max_frames_ * num_channels * sizeof(int16_t));
+    this->reset();
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::discard() {
+    if (this->buffer) {
+        YAKC_FREE(this->funcs, this->buffer);
+        this->buffer = nullptr;
+    }
+    this->max_frames = 0;
+    this->cur_frame = 0;
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::reset() {
+    for (auto& chn : this->channels) {
+        chn = channel();
+    }
+    this->volume_queue = channel();
+    this->volume_queue.cur.vol = 0x1F;
+    this->num_events = 0;
+    this->num_dropped_events = 0;
+    this->sample_cycle_pos = 0;
+    this->cur_frame = 0;
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::set_cpu_freq(int khz) {
+    YAKC_ASSERT(khz > 0);
+    this->cpu_freq_khz = khz;
+}
+
+//------------------------------------------------------------------------------
+sound_funcs
+audiorender::callbacks() {
+    sound_funcs funcs;
+    funcs.userdata = this;
+    funcs.sound = cb_sound;
+    funcs.stop = cb_stop;
+    funcs.volume = cb_volume;
+    return funcs;
+}
+
+//------------------------------------------------------------------------------
+bool
+audiorender::push(channel& chn, uint64_t cycle_pos, int hz, int vol) {
+    this->num_events++;
+    if (((chn.write_pos + 1) & (channel::size-1)) == chn.read_pos) {
+        // queue is full, render up to the new event to make room
+        if (this->cpu_freq_khz > 0) {
+            this->render(cycle_pos);
+        }
+        if (((chn.write_pos + 1) & (channel::size-1)) == chn.read_pos) {
+            // nothing was consumed (the sample buffer is full, or the
+            // queued events are all ahead of the new event), drop it
+            this->num_dropped_events++;
+            return false;
+        }
+    }
+    op& o = chn.ops[chn.write_pos];
+    o.cycle_pos = cycle_pos;
+    o.hz = hz;
+    o.vol = vol;
+    chn.write_pos = (chn.write_pos + 1) & (channel::size-1);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::render(uint64_t cycle_count) {
+    YAKC_ASSERT(this->cpu_freq_khz > 0);
+    if (!this->buffer) {
+        return;
+    }
+    const uint64_t cycles_per_sample = (uint64_t(this->cpu_freq_khz*1000)<<precision) / sample_rate;
+    while (((this->sample_cycle_pos>>precision) < cycle_count) && (this->cur_frame < this->max_frames)) {
+        const uint64_t cur_cycle = this->sample_cycle_pos>>precision;
+        int16_t* dst = &this->buffer[this->cur_frame * num_channels];
+        auto& vq = this->volume_queue;
+        while ((vq.read_pos != vq.write_pos) && (vq.ops[vq.read_pos].cycle_pos <= cur_cycle)) {
+            vq.cur = vq.ops[vq.read_pos];
+            vq.read_pos = (vq.read_pos + 1) & (channel::size-1);
+        }
+        const int amp = this->honor_volume ? (0x3FFF * vq.cur.vol) / 0x1F : 0x3FFF;
+        for (int i = 0; i < num_channels; i++) {
+            auto& chn = this->channels[i];
+            // apply all pending events up to the current sample position
+            while ((chn.read_pos != chn.write_pos) && (chn.ops[chn.read_pos].cycle_pos <= cur_cycle)) {
+                chn.cur = chn.ops[chn.read_pos];
+                chn.read_pos = (chn.read_pos + 1) & (channel::size-1);
+            }
+            if ((chn.cur.vol > 0) && (chn.cur.hz > 0)) {
+                uint16_t phase_add = uint16_t((0x10000 * chn.cur.hz) / sample_rate);
+                chn.phase_counter = (chn.phase_counter + phase_add) & 0xFFFF;
+                dst[i] = int16_t(chn.phase_counter < 0x8000 ? amp : -amp);
+            }
+            else {
+                dst[i] = 0;
+            }
+        }
+        this->cur_frame++;
+        this->sample_cycle_pos += cycles_per_sample;
+    }
+}
+
+//------------------------------------------------------------------------------
+const int16_t*
+audiorender::samples() const {
+    return this->buffer;
+}
+
+//------------------------------------------------------------------------------
+int
+audiorender::num_frames() const {
+    return this->cur_frame;
+}
+
+//------------------------------------------------------------------------------
+bool
+audiorender::full() const {
+    return this->cur_frame >= this->max_frames;
+}
+
+//------------------------------------------------------------------------------
+int
+audiorender::wav_size() const {
+    return wav_header_size + this->cur_frame * num_channels * sizeof(int16_t);
+}
+
+//------------------------------------------------------------------------------
+static ubyte*
+put32(ubyte* ptr, uint32_t val) {
+    *ptr++ = ubyte(val);
+    *ptr++ = ubyte(val>>8);
+    *ptr++ = ubyte(val>>16);
+    *ptr++ = ubyte(val>>24);
+    return ptr;
+}
+
+//------------------------------------------------------------------------------
+static ubyte*
+put16(ubyte* ptr, uword val) {
+    *ptr++ = ubyte(val);
+    *ptr++ = ubyte(val>>8);
+    return ptr;
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::write_wav_header(ubyte* dst) const {
+    const uint32_t data_size = this->cur_frame * num_channels * sizeof(int16_t);
+    const uword block_align = num_channels * sizeof(int16_t);
+    ubyte* ptr = dst;
+    memcpy(ptr, "RIFF", 4); ptr += 4;
+    ptr = put32(ptr, 36 + data_size);
+    memcpy(ptr, "WAVE", 4); ptr += 4;
+    memcpy(ptr, "fmt ", 4); ptr += 4;
+    ptr = put32(ptr, 16);                           // fmt chunk size
+    ptr = put16(ptr, 1);                            // PCM
+    ptr = put16(ptr, num_channels);
+    ptr = put32(ptr, sample_rate);
+    ptr = put32(ptr, sample_rate * block_align);    // bytes per second
+    ptr = put16(ptr, block_align);
+    ptr = put16(ptr, 16);                           // bits per sample
+    memcpy(ptr, "data", 4); ptr += 4;
+    ptr = put32(ptr, data_size);
+    YAKC_ASSERT((ptr - dst) == wav_header_size);
+}
+
+//------------------------------------------------------------------------------
+int
+audiorender::write_wav(ubyte* dst, int dst_size) const {
+    YAKC_ASSERT(dst);
+    const int size = this->wav_size();
+    if (dst_size < size) {
+        return 0;
+    }
+    this->write_wav_header(dst);
+    ubyte* ptr = dst + wav_header_size;
+    const int num_samples = this->cur_frame * num_channels;
+    for (int i = 0; i < num_samples; i++) {
+        ptr = put16(ptr, uword(this->buffer[i]));
+    }
+    return size;
+}
+
+//------------------------------------------------------------------------------
+bool
+audiorender::write_wav_file(const char* path) const {
+    YAKC_ASSERT(path);
+    const int size = this->wav_size();
+    ubyte* data = (ubyte*) YAKC_MALLOC(this->funcs, size);
+    this->write_wav(data, size);
+    bool success = false;
+    FILE* fp = fopen(path, "wb");
+    if (fp) {
+        success = (fwrite(data, 1, size, fp) == size_t(size));
+        fclose(fp);
+    }
+    YAKC_FREE(this->funcs, data);
+    return success;
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::cb_sound(void* userdata, uint64_t cycle_count, int channel, int hz) {
+    audiorender* self = (audiorender*) userdata;
+    YAKC_ASSERT((channel >= 0) && (channel < num_channels));
+    self->push(self->channels[channel], cycle_count, hz, 0x1F);
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::cb_stop(void* userdata, uint64_t cycle_count, int channel) {
+    audiorender* self = (audiorender*) userdata;
+    YAKC_ASSERT((channel >= 0) && (channel < num_channels));
+    self->push(self->channels[channel], cycle_count, 0, 0);
+}
+
+//------------------------------------------------------------------------------
+void
+audiorender::cb_volume(void* userdata, uint64_t cycle_count, int vol) {
+    audiorender* self = (audiorender*) userdata;
+    self->push(self->volume_queue, cycle_count, 0, vol & 0x1F);
+}
+
+} // namespace YAKC
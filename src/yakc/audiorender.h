@@ -0,0 +1,115 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::audiorender
+    @brief headless offline audio renderer
+
+    Consumes the sound/stop/volume events emitted through the sound_funcs
+    callbacks (by kc85_audio or the Z9001 CTC0 beeper) and synthesizes
+    16-bit stereo PCM samples into a memory buffer, which can then be
+    written as a WAV file. This doesn't need an audio device and runs
+    as fast as the host CPU allows, so it can be used for audio regression
+    tests and synthesis benchmarks on headless machines.
+
+    The waveform generation is the same as in the SoLoud-based AudioSource
+    (a simple square wave oscillator per channel), channel 0 goes to the
+    left, channel 1 to the right output channel.
+
+    Usage:
+    - call init() with the max number of sample frames to record
+    - pass the result of callbacks() to yakc::init()
+    - after poweron, call set_cpu_freq() with the emulator clock frequency
+    - after each yakc::onframe(), call render() with the current
+      absolute CPU cycle count
+    - call write_wav() or write_wav_file() to get the result
+*/
+#include "yakc/core.h"
+
+namespace YAKC {
+
+class audiorender {
+public:
+    /// destructor
+    ~audiorender();
+
+    /// output sample rate
+    static const int sample_rate = 44100;
+    /// number of output channels (interleaved)
+    static const int num_channels = 2;
+    /// size of the WAV file header in bytes
+    static const int wav_header_size = 44;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+    /// allocate the sample buffer (max number of stereo sample frames)
+    void init(int max_frames);
+    /// free the sample buffer
+    void discard();
+    /// clear recorded samples and pending events
+    void reset();
+    /// set the CPU clock frequency, must be called after poweron
+    void set_cpu_freq(int khz);
+    /// get a sound_funcs struct which feeds events into this renderer
+    sound_funcs callbacks();
+    /// render samples up to an absolute CPU cycle count
+    void render(uint64_t cycle_count);
+
+    /// get pointer to interleaved sample frames
+    const int16_t* samples() const;
+    /// get number of recorded sample frames
+    int num_frames() const;
+    /// return true if the sample buffer is full
+    bool full() const;
+
+    /// get size of a WAV file with all recorded samples in bytes
+    int wav_size() const;
+    /// write WAV file into memory buffer, return number of bytes written
+    int write_wav(ubyte* dst, int dst_size) const;
+    /// write WAV file to the host file system, return false on error
+    bool write_wav_file(const char* path) const;
+
+    /// callback to start sound or change frequency
+    static void cb_sound(void* userdata, uint64_t cycle_count, int channel, int hz);
+    /// callback to stop sound
+    static void cb_stop(void* userdata, uint64_t cycle_count, int channel);
+    /// callback to change volume
+    static void cb_volume(void* userdata, uint64_t cycle_count, int vol);
+
+    /// scale output by the volume set through cb_volume (live playback ignores volume)
+    bool honor_volume = false;
+    /// number of events which have been received
+    int num_events = 0;
+    /// number of events which were dropped because their queue was full
+    int num_dropped_events = 0;
+
+private:
+    struct channel;
+    /// push an event into a queue, return false if the queue is full
+    bool push(channel& chn, uint64_t cycle_pos, int hz, int vol);
+    /// write the WAV header
+    void write_wav_header(ubyte* dst) const;
+
+    static const int precision = 16;
+    struct op {
+        uint64_t cycle_pos = 0;
+        int hz = 0;
+        int vol = 0;
+    };
+    struct channel {
+        static const int size = 256;    // must be 2^N
+        uint32_t write_pos = 0;
+        uint32_t read_pos = 0;
+        uint16_t phase_counter = 0;
+        op cur;
+        op ops[size];
+    } channels[num_channels];
+    channel volume_queue;               // only the vol member of the ops is used
+
+    int cpu_freq_khz = 0;
+    uint64_t sample_cycle_pos = 0;      // fixed-point cycle pos of next sample
+    int16_t* buffer = nullptr;
+    int max_frames = 0;
+    int cur_frame = 0;
+};
+
+} // namespace YAKC
@@ -0,0 +1,277 @@
+//------------------------------------------------------------------------------
+//  batchrunner.cc
+//------------------------------------------------------------------------------
+#include "batchrunner.h"
+#include <new>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+batchrunner::~batchrunner() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+batchrunner::setup(int num_workers, setup_func setup_fn, void* userdata) {
+    YAKC_ASSERT(!this->is_valid() && setup_fn);
+    if (0 == num_workers) {
+        num_workers = int(std::thread::hardware_concurrency());
+        if (0 == num_workers) {
+            num_workers = 1;
+        }
+    }
+    if (num_workers > max_workers) {
+        num_workers = max_workers;
+    }
+    this->num = num_workers;
+    for (int i = 0; i < this->num; i++) {
+        yakc* emu = (yakc*) YAKC_MALLOC(this->funcs, sizeof(yakc));
+        new (emu) yakc();
+        setup_fn(*emu, userdata);
+        this->workers[i].emu = emu;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+batchrunner::discard() {
+    for (int i = 0; i < this->num; i++) {
+        yakc* emu = this->workers[i].emu;
+        if (emu->switchedon()) {
+            emu->poweroff();
+        }
+        emu->~yakc();
+        YAKC_FREE(this->funcs, emu);
+        this->workers[i].emu = nullptr;
+    }
+    this->num = 0;
+}
+
+//------------------------------------------------------------------------------
+bool
+batchrunner::is_valid() const {
+    return this->num > 0;
+}
+
+//------------------------------------------------------------------------------
+int
+batchrunner::num_workers() const {
+    return this->num;
+}
+
+//------------------------------------------------------------------------------
+void
+batchrunner::run(const job* jobs, result* results, int num_jobs) {
+    YAKC_ASSERT(this->is_valid() && jobs && results && (num_jobs >= 0));
+    if (0 == num_jobs) {
+        return;
+    }
+    this->cur_jobs = jobs;
+    this->cur_results = results;
+
+    // deal the jobs round-robin into the worker queues, each queue is
+    // a contiguous range in the job index array
+    this->job_indices = (int*) YAKC_MALLOC(this->funcs, num_jobs * sizeof(int));
+    int pos = 0;
+    for (int w = 0; w < this->num; w++) {
+        queue& q = this->workers[w].jobs;
+        q.items = this->job_indices + pos;
+        q.head = 0;
+        q.tail = 0;
+        for (int i = w; i < num_jobs; i += this->num) {
+            q.items[q.tail++] = i;
+        }
+        pos += q.tail;
+        this->workers[w].steals = 0;
+    }
+
+    // the calling thread works as the first worker
+    std::thread threads[max_workers];
+    for (int w = 1; w < this->num; w++) {
+        threads[w] = std::thread(&batchrunner::worker_loop, this, w);
+    }
+    this->worker_loop(0);
+    this->num_steals = this->workers[0].steals;
+    for (int w = 1; w < this->num; w++) {
+        threads[w].join();
+        this->num_steals += this->workers[w].steals;
+    }
+
+    YAKC_FREE(this->funcs, this->job_indices);
+    this->job_indices = nullptr;
+    this->cur_jobs = nullptr;
+    this->cur_results = nullptr;
+}
+
+//------------------------------------------------------------------------------
+int
+batchrunner::next_job(int worker_index) {
+    // first try own queue from the front...
+    {
+        queue& q = this->workers[worker_index].jobs;
+        std::lock_guard<std::mutex> guard(q.lock);
+        if (q.head < q.tail) {
+            return q.items[q.head++];
+        }
+    }
+    // ...then steal from the back of the other queues
+    for (int i = 1; i < this->num; i++) {
+        queue& q = this->workers[(worker_index + i) % this->num].jobs;
+        std::lock_guard<std::mutex> guard(q.lock);
+        if (q.head < q.tail) {
+            this->workers[worker_index].steals++;
+            return q.items[--q.tail];
+        }
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+void
+batchrunner::worker_loop(int worker_index) {
+    yakc& emu = *this->workers[worker_index].emu;
+    int job_index;
+    while ((job_index = this->next_job(worker_index)) >= 0) {
+        result& res = this->cur_results[job_index];
+        run_job(emu, this->cur_jobs[job_index], res);
+        res.worker = worker_index;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+batchrunner::run_job(yakc& emu, const job& j, result& res) {
+    // the exit address and settled video output are optional,
+    // the cycle budget guarantees that the job terminates
+    YAKC_ASSERT(j.max_cycles > 0);
+    res = result();
+
+    if (emu.switchedon()) {
+        emu.poweroff();
+    }
+    emu.poweron(j.model, j.os);
+    for (int i = 0; i < j.boot_frames; i++) {
+        emu.onframe(1, frame_micro_secs, 0, 0);
+    }
+    if (j.data && !load_program(emu, j.data, j.size)) {
+        res.reason = exit_load_error;
+        res.pc = emu.board.cpu.PC;
+        emu.poweroff();
+        return;
+    }
+
+    z80dbg& dbg = emu.board.dbg;
+    if (j.exit_pc >= 0) {
+        dbg.enable_breakpoint(0, uword(j.exit_pc));
+    }
+    const uint64_t start_cycles = emu.cycle_count();
+    const uint64_t end_cycles = start_cycles + j.max_cycles;
+    uint64_t last_hash = screen_hash(emu);
+    int num_settled = 0;
+    while (exit_none == res.reason) {
+        emu.onframe(1, frame_micro_secs, 0, end_cycles);
+        if (dbg.paused) {
+            res.reason = exit_pc;
+        }
+        else if (emu.cycle_count() >= end_cycles) {
+            res.reason = exit_budget;
+        }
+        else if (j.settle_frames > 0) {
+            const uint64_t h = screen_hash(emu);
+            if (h == last_hash) {
+                if (++num_settled >= j.settle_frames) {
+                    res.reason = exit_settled;
+                }
+            }
+            else {
+                num_settled = 0;
+                last_hash = h;
+            }
+        }
+    }
+    res.pc = emu.board.cpu.PC;
+    res.cycles = emu.cycle_count() - start_cycles;
+    res.screen_hash = screen_hash(emu);
+    dbg.paused = false;
+    dbg.disable_breakpoint(0);
+    emu.poweroff();
+}
+
+//------------------------------------------------------------------------------
+bool
+batchrunner::load_program(yakc& emu, const ubyte* data, int size) {
+    // a TAP file has an additional 16-byte signature before the KCC header,
+    // and 1 lead byte before each 128-byte block
+    const bool is_tap = (size > 17) && (0 == memcmp(data, "\xC3KC-TAPE", 8));
+    const ubyte* hdr = is_tap ? data + 17 : data;
+    if ((hdr + 128) > (data + size)) {
+        return false;
+    }
+    const uword load_addr = hdr[17] | hdr[18]<<8;
+    const uword end_addr = hdr[19] | hdr[20]<<8;
+    const uword exec_addr = hdr[21] | hdr[22]<<8;
+    const bool has_exec_addr = hdr[16] > 2;
+    const ubyte* ptr = hdr + 128;
+    const ubyte* end_ptr = data + size;
+    z80& cpu = emu.board.cpu;
+    uword addr = load_addr;
+    while (addr < end_addr) {
+        if (is_tap) {
+            // skip block lead byte
+            ptr++;
+        }
+        for (int i = 0; (i < 128) && (addr < end_addr); i++) {
+            if (ptr >= end_ptr) {
+                return false;
+            }
+            cpu.mem.w8(addr++, *ptr++);
+        }
+    }
+
+    // same start sequence as FileLoader::start()
+    if (has_exec_addr) {
+        cpu.A = 0x00;
+        cpu.F = 0x10;
+        cpu.BC = cpu.BC_ = 0x0000;
+        cpu.DE = cpu.DE_ = 0x0000;
+        cpu.HL = cpu.HL_ = 0x0000;
+        cpu.AF_ = 0x0000;
+        if (emu.is_device(device::any_kc85)) {
+            cpu.SP = 0x01C2;
+            for (uword a = 0xb200; a < 0xb700; a++) {
+                cpu.mem.w8(a, 0);
+            }
+            cpu.mem.w8(0xb7a0, 0);
+            if (emu.model == device::kc85_3) {
+                cpu.out(0x89, 0x9f);
+                cpu.mem.w16(cpu.SP, 0xf15c);
+            }
+            else if (emu.model == device::kc85_4) {
+                cpu.out(0x89, 0xFF);
+                cpu.mem.w16(cpu.SP, 0xf17e);
+            }
+        }
+        cpu.PC = exec_addr;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+batchrunner::screen_hash(const yakc& emu) {
+    if (emu.kc85.on) {
+        return hash(emu.kc85.video.rgba8_buffer, kc85_video::rgba8_buffer_size);
+    }
+    else if (emu.z1013.on) {
+        return hash(emu.z1013.rgba8_buffer, z1013::rgba8_buffer_size);
+    }
+    else if (emu.z9001.on) {
+        return hash(emu.z9001.rgba8_buffer, z9001::rgba8_buffer_size);
+    }
+    else {
+        return 0;
+    }
+}
+
+} // namespace YAKC
@@ -0,0 +1,125 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::batchrunner
+    @brief run many headless emulator jobs in parallel
+
+    The batchrunner owns one emulator instance per worker thread, and
+    distributes a list of jobs over the workers. A job switches on a
+    system, lets the OS boot, optionally loads and starts a KCC or TAP
+    program image (like the FileLoader in the app does), and runs until
+    one of the exit conditions is met:
+
+    - the cycle budget is used up (each job must have one, so that jobs
+      always terminate)
+    - optionally, the CPU is about to execute an instruction at a given address
+    - optionally, the video output didn't change for a number of frames
+
+    The result of each job is the exit reason, the final PC, the number
+    of cycles executed after start, and a hash over the RGBA8 video
+    output, which can be compared against known-good results.
+
+    Jobs are initially dealt round-robin into per-worker queues. A worker
+    takes jobs from the front of its own queue, and when its queue is
+    empty, steals jobs from the back of the other workers' queues, so that
+    long-running jobs don't leave cores idle.
+
+    The emulator instances are initialized by a user-provided setup
+    function (which must call yakc::init() and register ROMs and
+    expansion modules), called from the thread calling setup().
+*/
+#include "yakc/yakc.h"
+#include <thread>
+#include <mutex>
+
+namespace YAKC {
+
+class batchrunner {
+public:
+    /// why a job has stopped
+    enum exit_reason {
+        exit_none = 0,      // job hasn't run
+        exit_budget,        // cycle budget used up
+        exit_pc,            // exit address reached
+        exit_settled,       // video output hasn't changed for settle_frames
+        exit_load_error,    // program image couldn't be loaded
+    };
+    /// a job description
+    struct job {
+        /// system to switch on
+        device model = device::kc85_3;
+        os_rom os = os_rom::caos_3_1;
+        /// KCC or TAP program image (not owned), or nullptr to only boot the OS
+        const ubyte* data = nullptr;
+        int size = 0;
+        /// number of frames to run before the program is loaded
+        int boot_frames = 150;
+        /// cycle budget after program start (must be > 0)
+        uint64_t max_cycles = 100000000;
+        /// stop before executing the instruction at this address (-1 to disable)
+        int exit_pc = -1;
+        /// stop if video output doesn't change for this many frames (0 to disable)
+        int settle_frames = 0;
+    };
+    /// the result of a job
+    struct result {
+        exit_reason reason = exit_none;
+        uword pc = 0;
+        uint64_t cycles = 0;
+        uint64_t screen_hash = 0;
+        int worker = -1;
+    };
+    /// emulator setup callback
+    typedef void (*setup_func)(yakc& emu, void* userdata);
+    /// length of one emulated frame
+    static const int frame_micro_secs = 20000;
+
+    /// destructor
+    ~batchrunner();
+    /// create emulator instances for worker threads (num_workers 0: one per host core)
+    void setup(int num_workers, setup_func setup_fn, void* userdata);
+    /// destroy emulator instances
+    void discard();
+    /// return true if setup
+    bool is_valid() const;
+    /// get number of workers
+    int num_workers() const;
+    /// run jobs and block until all are done, results must have room for num_jobs items
+    void run(const job* jobs, result* results, int num_jobs);
+    /// run a single job on an emulator instance (called from worker threads)
+    static void run_job(yakc& emu, const job& j, result& res);
+    /// number of jobs stolen from other workers in the last run
+    int num_steals = 0;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+private:
+    /// worker thread entry
+    void worker_loop(int worker_index);
+    /// get next job index for a worker, -1 when all queues are empty
+    int next_job(int worker_index);
+    /// load and start a KCC or TAP program image
+    static bool load_program(yakc& emu, const ubyte* data, int size);
+    /// hash the video output of the current system
+    static uint64_t screen_hash(const yakc& emu);
+
+    struct queue {
+        std::mutex lock;
+        int* items = nullptr;   // points into job_indices
+        int head = 0;
+        int tail = 0;
+    };
+    struct worker {
+        yakc* emu = nullptr;
+        queue jobs;
+        int steals = 0;
+    };
+    static const int max_workers = 64;
+    worker workers[max_workers];
+    int num = 0;
+    const job* cur_jobs = nullptr;
+    result* cur_results = nullptr;
+    int* job_indices = nullptr;
+};
+
+} // namespace YAKC
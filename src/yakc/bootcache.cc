@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+//  bootcache.cc
+//------------------------------------------------------------------------------
+#include "bootcache.h"
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+bootcache::~bootcache() {
+    this->clear();
+}
+
+//------------------------------------------------------------------------------
+void
+bootcache::clear() {
+    for (auto& e : this->entries) {
+        if (e.state) {
+            YAKC_FREE(this->funcs, e.state);
+        }
+        e = entry();
+    }
+    this->next_entry = 0;
+}
+
+//------------------------------------------------------------------------------
+int
+bootcache::find(device model, os_rom os, uint64_t rom_hash) const {
+    for (int i = 0; i < max_entries; i++) {
+        const entry& e = this->entries[i];
+        if (e.state && (e.model == model) && (e.os == os) && (e.rom_hash == rom_hash)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+bool
+bootcache::has(const yakc& emu) const {
+    return this->find(emu.model, emu.os, rom_hash(emu)) >= 0;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+bootcache::rom_hash(const yakc& emu) {
+    uint64_t h = hash(nullptr, 0);
+    if (emu.kc85.on) {
+        // the KC85 ROMs are bank-switched, so not all of them are mapped
+        // at power-on, also include the expansion modules
+        const kc85& kc = emu.kc85;
+        if (kc.caos_e_ptr) {
+            h = hash(kc.caos_e_ptr, kc.caos_e_size, h);
+        }
+        if (kc.caos_c_ptr) {
+            h = hash(kc.caos_c_ptr, kc.caos_c_size, h);
+        }
+        // the BASIC ROM which is banked in at C000 is the built-in dump
+        // (see kc85::update_bank_switching()), not the registered basic_rom
+        if (emu.is_device(device::kc85_3) || emu.is_device(device::kc85_4)) {
+            h = hash(dump_basic_c0, sizeof(dump_basic_c0), h);
+        }
+        for (const auto& slot : kc.exp.slots) {
+            const ubyte type = slot.mod.type;
+            h = hash(&type, sizeof(type), h);
+            if (slot.mod.mem_ptr && !slot.mod.mem_owned) {
+                h = hash(slot.mod.mem_ptr, slot.mod.mem_size, h);
+            }
+        }
+    }
+    else {
+        // all other systems have their ROMs statically mapped
+        const memory& mem = emu.board.cpu.mem;
+        for (int layer = 0; layer < memory::num_layers; layer++) {
+            for (int page = 0; page < memory::num_pages; page++) {
+                const memory::page& p = mem.layers[layer][page];
+                if (p.ptr && !p.writable) {
+                    h = hash(p.ptr, memory::page::size, h);
+                }
+            }
+        }
+    }
+    return h;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+bootcache::video_hash(const yakc& emu) {
+    if (emu.kc85.on) {
+        return hash(emu.kc85.video.irm, kc85_video::irm_size);
+    }
+    else if (emu.z1013.on) {
+        return hash(emu.z1013.irm, z1013::irm_size);
+    }
+    else if (emu.z9001.on) {
+        uint64_t h = hash(emu.z9001.video_ram, z9001::video_ram_size);
+        return hash(emu.z9001.color_ram, z9001::color_ram_size, h);
+    }
+    else {
+        return 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+bootcache::run_until_settled(yakc& emu) const {
+    uint64_t last_hash = video_hash(emu);
+    bool changed = false;
+    int stable_frames = 0;
+    for (int i = 0; i < this->max_frames; i++) {
+        emu.onframe(1, frame_micro_secs, 0, 0);
+        if (emu.board.dbg.paused) {
+            // a breakpoint was hit during boot, don't cache
+            return false;
+        }
+        const uint64_t h = video_hash(emu);
+        if (h != last_hash) {
+            last_hash = h;
+            changed = true;
+            stable_frames = 0;
+        }
+        else if (changed && (++stable_frames >= this->settle_frames)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void
+bootcache::restart_cycle_count(yakc& emu) {
+    if (emu.kc85.on) {
+        emu.kc85.abs_cycle_count = 0;
+        emu.kc85.overflow_cycles = 0;
+    }
+    else if (emu.z1013.on) {
+        emu.z1013.abs_cycle_count = 0;
+        emu.z1013.overflow_cycles = 0;
+    }
+    else if (emu.z9001.on) {
+        emu.z9001.abs_cycle_count = 0;
+        emu.z9001.overflow_cycles = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+bootcache::boot(yakc& emu) {
+    YAKC_ASSERT(emu.switchedon());
+    const uint64_t h = rom_hash(emu);
+    int index = this->find(emu.model, emu.os, h);
+    if (index >= 0) {
+        this->num_hits++;
+        snapshot::apply_snapshot(*this->entries[index].state, emu);
+        restart_cycle_count(emu);
+        return true;
+    }
+    this->num_misses++;
+
+    // cold-boot the OS with muted sound output, without recording the
+    // boot frames and without instrumentation, breakpoints stay active
+    // so that the boot code can still be debugged
+    quietscope quiet;
+    quiet.begin(emu, false);
+    const bool settled = this->run_until_settled(emu);
+    quiet.end(emu);
+
+    if (settled) {
+        if (emu.funcs.free_func != this->funcs.free_func) {
+            // allocate through the emulator's memory functions
+            this->clear();
+            this->funcs = emu.funcs;
+        }
+        entry& e = this->entries[this->next_entry];
+        this->next_entry = (this->next_entry + 1) % max_entries;
+        if (nullptr == e.state) {
+            e.state = (snapshot::state_t*) YAKC_MALLOC(this->funcs, sizeof(snapshot::state_t));
+        }
+        e.model = emu.model;
+        e.os = emu.os;
+        e.rom_hash = h;
+        snapshot::take_snapshot(emu, *e.state);
+        // apply the snapshot right away, so that the resulting state
+        // is identical to a cache hit
+        snapshot::apply_snapshot(*e.state, emu);
+    }
+    // the cycles spent booting don't count, on a hit and a miss the
+    // machine starts at cycle 0 like after power-on, so that the audio
+    // clock and anything keyed on the cycle count (movies, reverser
+    // history) start in sync
+    restart_cycle_count(emu);
+    return false;
+}
+
+} // namespace YAKC
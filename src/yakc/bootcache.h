@@ -0,0 +1,75 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::bootcache
+    @brief cache machine snapshots taken right after the OS cold-start
+
+    The first time a model/OS combination is switched on, the bootcache
+    runs the emulator quietly (see quietscope) until the OS has finished its
+    cold-start and sits in the keyboard-wait loop, and takes a snapshot
+    of that state. On subsequent power-ons the snapshot is applied
+    directly after the hardware has been initialized, skipping the
+    complete ROM boot sequence.
+
+    The boot point is detected as the video memory not changing anymore
+    for a number of frames. Cache entries are keyed by model, OS and
+    a hash over the ROMs (and KC85 expansion modules) which are visible to
+    the OS at boot, so changed ROMs or modules will invalidate the entry.
+
+    To enable, set the yakc::boot_cache pointer, yakc::poweron() will
+    then call bootcache::boot() after the hardware has been initialized.
+*/
+#include "yakc/snapshot.h"
+#include "yakc/quietscope.h"
+
+namespace YAKC {
+
+class bootcache {
+public:
+    /// destructor
+    ~bootcache();
+
+    /// max number of cached boot states
+    static const int max_entries = 8;
+    /// length of one emulated frame during capture
+    static const int frame_micro_secs = 20000;
+    /// number of frames with unchanged video memory to detect the boot point
+    int settle_frames = 25;
+    /// give up capturing after this many frames
+    int max_frames = 50 * 20;
+
+    /// boot a switched-on emulator, return true if restored from cache
+    bool boot(yakc& emu);
+    /// return true if a cached boot state exists for the current emulator config
+    bool has(const yakc& emu) const;
+    /// drop all cached boot states
+    void clear();
+    /// compute the hash over all ROMs visible to the current system
+    static uint64_t rom_hash(const yakc& emu);
+
+    /// number of boots restored from cache
+    int num_hits = 0;
+    /// number of boots which needed a cold start
+    int num_misses = 0;
+
+private:
+    /// find matching entry index, or -1
+    int find(device model, os_rom os, uint64_t rom_hash) const;
+    /// run emulator until the OS has finished booting, return false on failure
+    bool run_until_settled(yakc& emu) const;
+    /// compute a hash over the video memory of the current system
+    static uint64_t video_hash(const yakc& emu);
+    /// reset the cycle counters of the current system to 0
+    static void restart_cycle_count(yakc& emu);
+
+    struct entry {
+        device model = device::none;
+        os_rom os = os_rom::none;
+        uint64_t rom_hash = 0;
+        snapshot::state_t* state = nullptr;
+    } entries[max_entries];
+    int next_entry = 0;
+    ext_funcs funcs;    // taken from the booted emulator
+};
+
+} // namespace YAKC
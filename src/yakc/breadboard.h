@@ -10,6 +10,12 @@
 #include "yakc/z80dbg.h"
 #include "yakc/z80pio.h"
 #include "yakc/z80ctc.h"
+#include "yakc/tracer.h"
+#include "yakc/profiler.h"
+#include "yakc/callgraph.h"
+#include "yakc/opstats.h"
+#include "yakc/frametimes.h"
+#include "yakc/coverage.h"
 
 namespace YAKC {
 
@@ -21,6 +27,12 @@ public:
     z80pio pio2;        // Z9001 has 2 PIOs
     z80ctc ctc;
     z80dbg dbg;
+    tracer trace;
+    profiler prof;
+    callgraph calls;
+    opstats ops;
+    frametimes times;
+    coverage cov;
 };
 
 } // namespace YAKC
@@ -0,0 +1,320 @@
+//------------------------------------------------------------------------------
+//  callgraph.cc
+//------------------------------------------------------------------------------
+#include "callgraph.h"
+#include <algorithm>
+#include <stdio.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+callgraph::~callgraph() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::reset() {
+    this->nodes_count = 0;
+    this->stack_depth = 0;
+    this->num_analyzed = 0;
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::discard() {
+    if (this->nodes) {
+        YAKC_FREE(this->funcs, this->nodes);
+        this->nodes = nullptr;
+    }
+    if (this->targets) {
+        YAKC_FREE(this->funcs, this->targets);
+        this->targets = nullptr;
+    }
+    this->nodes_capacity = 0;
+    this->targets_capacity = 0;
+    this->reset();
+    this->enabled = false;
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::begin_run(z80& cpu) {
+    if (this->enabled) {
+        cpu.irq_trap = irq_trap;
+        cpu.irq_trap_userdata = this;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::end_run(z80& cpu) {
+    cpu.irq_trap = nullptr;
+    cpu.irq_trap_userdata = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::irq_trap(void* userdata, uword sp, uword addr) {
+    callgraph* self = (callgraph*) userdata;
+    if (self->enabled) {
+        if (0 == self->nodes_count) {
+            self->init_root();
+        }
+        self->push(sp, addr, no_func, true);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::init_root() {
+    if (!this->nodes) {
+        this->nodes_capacity = 1024;
+        this->nodes = (node*) YAKC_MALLOC(this->funcs, this->nodes_capacity * sizeof(node));
+    }
+    this->nodes[0] = node();
+    this->nodes_count = 1;
+    this->stack_depth = 0;
+}
+
+//------------------------------------------------------------------------------
+int
+callgraph::child(uword addr, int func, bool irq) {
+    const int parent = this->stack_depth > 0 ? this->stack[this->stack_depth - 1].node : 0;
+    int index = this->nodes[parent].first_child;
+    while (index >= 0) {
+        const node& n = this->nodes[index];
+        if ((n.addr == addr) && (n.func == func) && (n.irq == irq)) {
+            return index;
+        }
+        index = n.next_sibling;
+    }
+    // a new call stack
+    if (this->nodes_count == max_nodes) {
+        return -1;
+    }
+    if (this->nodes_count == this->nodes_capacity) {
+        const int capacity = this->nodes_capacity * 2;
+        node* new_nodes = (node*) YAKC_MALLOC(this->funcs, capacity * sizeof(node));
+        memcpy(new_nodes, this->nodes, this->nodes_count * sizeof(node));
+        YAKC_FREE(this->funcs, this->nodes);
+        this->nodes = new_nodes;
+        this->nodes_capacity = capacity;
+    }
+    index = this->nodes_count++;
+    node& n = this->nodes[index];
+    n = node();
+    n.addr = addr;
+    n.func = func;
+    n.irq = irq;
+    n.parent = parent;
+    n.next_sibling = this->nodes[parent].first_child;
+    this->nodes[parent].first_child = index;
+    return index;
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::push(uword sp, uword addr, int func, bool irq) {
+    // frames at or below the new return address are gone
+    while ((this->stack_depth > 0) && (this->stack[this->stack_depth - 1].sp <= sp)) {
+        this->stack_depth--;
+    }
+    if (this->stack_depth < max_depth) {
+        const int index = this->child(addr, func, irq);
+        if (index >= 0) {
+            this->nodes[index].count++;
+            frame& f = this->stack[this->stack_depth++];
+            f.node = index;
+            f.sp = sp;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::pop(uword sp) {
+    while ((this->stack_depth > 0) && (this->stack[this->stack_depth - 1].sp < sp)) {
+        this->stack_depth--;
+    }
+}
+
+//------------------------------------------------------------------------------
+int
+callgraph::depth() const {
+    return this->stack_depth;
+}
+
+//------------------------------------------------------------------------------
+int
+callgraph::num_nodes() const {
+    return this->nodes_count;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+callgraph::total_cycles() const {
+    uint64_t cycles = 0;
+    for (int i = 0; i < this->nodes_count; i++) {
+        cycles += this->nodes[i].cycles;
+    }
+    return cycles;
+}
+
+//------------------------------------------------------------------------------
+int
+callgraph::analyze() {
+    this->num_analyzed = 0;
+    if (0 == this->nodes_count) {
+        return 0;
+    }
+    // inclusive cycles of each node, children always come after their parent
+    uint64_t* incl = (uint64_t*) YAKC_MALLOC(this->funcs, this->nodes_count * sizeof(uint64_t));
+    clear(incl, this->nodes_count * sizeof(uint64_t));
+    for (int i = this->nodes_count - 1; i >= 0; i--) {
+        incl[i] += this->nodes[i].cycles;
+        if (this->nodes[i].parent >= 0) {
+            incl[this->nodes[i].parent] += incl[i];
+        }
+    }
+    for (int i = 1; i < this->nodes_count; i++) {
+        const node& n = this->nodes[i];
+        int t;
+        for (t = 0; t < this->num_analyzed; t++) {
+            const target& tgt = this->targets[t];
+            if ((tgt.addr == n.addr) && (tgt.func == n.func) && (tgt.irq == n.irq)) {
+                break;
+            }
+        }
+        if (t == this->num_analyzed) {
+            if (this->num_analyzed == this->targets_capacity) {
+                const int capacity = this->targets_capacity ? this->targets_capacity * 2 : 256;
+                target* new_targets = (target*) YAKC_MALLOC(this->funcs, capacity * sizeof(target));
+                if (this->targets) {
+                    memcpy(new_targets, this->targets, this->num_analyzed * sizeof(target));
+                    YAKC_FREE(this->funcs, this->targets);
+                }
+                this->targets = new_targets;
+                this->targets_capacity = capacity;
+            }
+            target& tgt = this->targets[this->num_analyzed++];
+            tgt = target();
+            tgt.addr = n.addr;
+            tgt.func = n.func;
+            tgt.irq = n.irq;
+        }
+        target& tgt = this->targets[t];
+        tgt.count += n.count;
+        tgt.excl_cycles += n.cycles;
+        // with recursion, only the outermost call counts for the inclusive cycles
+        bool recursive = false;
+        for (int p = n.parent; (p > 0) && !recursive; p = this->nodes[p].parent) {
+            const node& pn = this->nodes[p];
+            recursive = (pn.addr == n.addr) && (pn.func == n.func) && (pn.irq == n.irq);
+        }
+        if (!recursive) {
+            tgt.incl_cycles += incl[i];
+        }
+    }
+    YAKC_FREE(this->funcs, incl);
+    std::sort(this->targets, this->targets + this->num_analyzed, [](const target& t0, const target& t1) {
+        return t0.incl_cycles > t1.incl_cycles;
+    });
+    return this->num_analyzed;
+}
+
+//------------------------------------------------------------------------------
+int
+callgraph::num_targets() const {
+    return this->num_analyzed;
+}
+
+//------------------------------------------------------------------------------
+const callgraph::target&
+callgraph::get_target(int index) const {
+    YAKC_ASSERT((index >= 0) && (index < this->num_analyzed));
+    return this->targets[index];
+}
+
+//------------------------------------------------------------------------------
+void
+callgraph::target_name(const symbols* syms, uword addr, int func, bool irq, char* buf, int buf_size) {
+    YAKC_ASSERT(buf && (buf_size > 0));
+    const char* name = syms ? syms->lookup(addr) : nullptr;
+    char addr_str[8];
+    if (!name) {
+        snprintf(addr_str, sizeof(addr_str), "%04X", addr);
+        name = addr_str;
+    }
+    if (func != no_func) {
+        snprintf(buf, buf_size, "%s%s#%02X", irq ? "irq:" : "", name, func);
+    }
+    else {
+        snprintf(buf, buf_size, "%s%s", irq ? "irq:" : "", name);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+callgraph::save_folded(write_func write_fn, void* userdata, const symbols* syms) const {
+    YAKC_ASSERT(write_fn);
+    int path[max_depth + 1];
+    char name[symbols::max_name_length + 16];
+    for (int i = 0; i < this->nodes_count; i++) {
+        const node& n = this->nodes[i];
+        if (0 == n.cycles) {
+            continue;
+        }
+        if (0 == i) {
+            // code which runs outside of any recorded call
+            const char* top = "(top)";
+            if (!write_fn(userdata, top, int(strlen(top)))) {
+                return false;
+            }
+        }
+        else {
+            int depth = 0;
+            for (int p = i; p > 0; p = this->nodes[p].parent) {
+                path[depth++] = p;
+            }
+            for (int d = depth - 1; d >= 0; d--) {
+                const node& pn = this->nodes[path[d]];
+                target_name(syms, pn.addr, pn.func, pn.irq, name, sizeof(name));
+                if (d < (depth - 1)) {
+                    if (!write_fn(userdata, ";", 1)) {
+                        return false;
+                    }
+                }
+                if (!write_fn(userdata, name, int(strlen(name)))) {
+                    return false;
+                }
+            }
+        }
+        const int len = snprintf(name, sizeof(name), " %llu\n", (unsigned long long) n.cycles);
+        if (!write_fn(userdata, name, len)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static bool
+write_to_file(void* userdata, const void* ptr, int num_bytes) {
+    return fwrite(ptr, 1, num_bytes, (FILE*)userdata) == size_t(num_bytes);
+}
+
+//------------------------------------------------------------------------------
+bool
+callgraph::write_folded_file(const char* path, const symbols* syms) const {
+    YAKC_ASSERT(path);
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        return false;
+    }
+    const bool success = this->save_folded(write_to_file, fp, syms);
+    fclose(fp);
+    return success;
+}
+
+} // namespace YAKC
@@ -0,0 +1,182 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::callgraph
+    @brief a call-graph profiler with a shadow call stack
+
+    When enabled, the emulated systems call record() after each
+    instruction, like the profiler. The call graph keeps a shadow call
+    stack which is pushed when a CALL (or a taken conditional CALL) or
+    RST is executed, or an interrupt is accepted (via the z80::irq_trap
+    callback installed by begin_run()), and popped on RET, RETI and RETN.
+
+    The T-states of each instruction are added to a node in a calling
+    context tree (one node per distinct call stack), which gives the
+    exclusive cycles of each call stack, and the inclusive cycles of
+    each call target after analyze().
+
+    Z80 code often doesn't return to its caller in an orderly fashion
+    (it pops return addresses and jumps, or reloads SP). So each stack
+    entry remembers where its return address is on the stack, a RET pops
+    all entries whose return address was at or below the popped slot,
+    and a push drops entries which are at or below the new slot.
+
+    On the KC85, the CAOS system calls all go through the PV1 dispatcher
+    (CALL 0F003H followed by the function number), yakc::poweron() sets
+    dispatch_addr to 0xF003 so that each function number is counted
+    separately (and drops the call graph of the previous system).
+
+    The calling context tree can be written in the folded-stack format
+    of flame graph tools (one line per call stack with the names of the
+    call targets separated by semicolons, followed by the exclusive
+    T-states), names are looked up in an optional symbol table. Targets
+    are identified by address only (a call into a different bank at the
+    same address counts as the same target).
+
+    The cost when disabled is a single branch per instruction in the
+    emulation loop.
+*/
+#include "yakc/core.h"
+#include "yakc/z80.h"
+#include "yakc/symbols.h"
+
+namespace YAKC {
+
+class callgraph {
+public:
+    /// max depth of the shadow call stack
+    static const int max_depth = 256;
+    /// max number of nodes in the calling context tree
+    static const int max_nodes = 1<<16;
+    /// no dispatcher function number
+    static const int no_func = -1;
+    /// a call target in the analysis
+    struct target {
+        uword addr = 0;             // call target address
+        int func = no_func;         // dispatcher function number or no_func
+        bool irq = false;           // an interrupt handler
+        uint64_t count = 0;         // number of calls
+        uint64_t incl_cycles = 0;   // T-states including callees
+        uint64_t excl_cycles = 0;   // T-states without callees
+    };
+    /// stream output callback (same as snapshot::write_func), must return false on error
+    typedef bool (*write_func)(void* userdata, const void* ptr, int num_bytes);
+
+    /// set to true to start recording
+    bool enabled = false;
+    /// address of a dispatcher which takes a function number in the byte after the CALL, or 0
+    uword dispatch_addr = 0;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+    /// destructor
+    ~callgraph();
+    /// drop the recorded call graph and the shadow stack
+    void reset();
+    /// free all memory and disable recording
+    void discard();
+    /// install the interrupt trap before running the CPU (only if enabled)
+    void begin_run(z80& cpu);
+    /// remove the interrupt trap after running the CPU
+    void end_run(z80& cpu);
+    /// record an executed instruction (called by the emulated systems after each instruction)
+    void record(const z80& cpu, uword pc, int cycles);
+
+    /// current depth of the shadow call stack
+    int depth() const;
+    /// number of nodes in the calling context tree
+    int num_nodes() const;
+    /// total number of recorded T-states
+    uint64_t total_cycles() const;
+
+    /// collect the call targets sorted by inclusive T-states, return number of targets
+    int analyze();
+    /// number of targets found by the last analyze()
+    int num_targets() const;
+    /// get a target from the last analyze()
+    const target& get_target(int index) const;
+    /// get the name of a call target (symbol, or hex address), with dispatcher function and interrupt marker
+    static void target_name(const symbols* syms, uword addr, int func, bool irq, char* buf, int buf_size);
+
+    /// write the call stacks in folded-stack format
+    bool save_folded(write_func write_fn, void* userdata, const symbols* syms) const;
+    /// write the call stacks in folded-stack format to a file
+    bool write_folded_file(const char* path, const symbols* syms) const;
+
+private:
+    struct node {
+        uword addr = 0;
+        int func = no_func;
+        bool irq = false;
+        int parent = -1;
+        int first_child = -1;
+        int next_sibling = -1;
+        uint64_t count = 0;
+        uint64_t cycles = 0;        // exclusive T-states
+    };
+    struct frame {
+        int node = 0;
+        uword sp = 0;               // where the return address is on the stack
+    };
+    /// push a call target, sp points to the return address
+    void push(uword sp, uword addr, int func, bool irq);
+    /// pop all frames whose return address is below an address
+    void pop(uword sp);
+    /// find or create the child node of the current node, -1 if the tree is full
+    int child(uword addr, int func, bool irq);
+    /// create the root node
+    void init_root();
+    /// the interrupt trap callback
+    static void irq_trap(void* userdata, uword sp, uword addr);
+
+    node* nodes = nullptr;
+    int nodes_capacity = 0;
+    int nodes_count = 0;
+    frame stack[max_depth];
+    int stack_depth = 0;
+    target* targets = nullptr;
+    int targets_capacity = 0;
+    int num_analyzed = 0;
+};
+
+//------------------------------------------------------------------------------
+inline void
+callgraph::record(const z80& cpu, uword pc, int cycles) {
+    if (0 == this->nodes_count) {
+        this->init_root();
+    }
+    // the instruction belongs to the current function (a CALL belongs to the caller)
+    const int cur = this->stack_depth > 0 ? this->stack[this->stack_depth - 1].node : 0;
+    this->nodes[cur].cycles += cycles;
+    const ubyte op = cpu.mem.ptr(pc)[pc & memory::page::mask];
+    if ((op == 0xCD) || ((op & 0xC7) == 0xC4)) {
+        // CALL nn, CALL cc,nn (if taken)
+        if (cpu.PC != uword(pc + 3)) {
+            int func = no_func;
+            if ((cpu.PC == this->dispatch_addr) && (0 != this->dispatch_addr)) {
+                const uword arg = uword(pc + 3);
+                func = cpu.mem.ptr(arg)[arg & memory::page::mask];
+            }
+            this->push(cpu.SP, cpu.PC, func, false);
+        }
+    }
+    else if ((op & 0xC7) == 0xC7) {
+        // RST
+        this->push(cpu.SP, cpu.PC, no_func, false);
+    }
+    else if ((op == 0xC9) || ((op & 0xC7) == 0xC0)) {
+        // RET, RET cc (if taken)
+        if (cpu.PC != uword(pc + 1)) {
+            this->pop(cpu.SP);
+        }
+    }
+    else if (op == 0xED) {
+        // RETI, RETN
+        const uword pc1 = uword(pc + 1);
+        if ((cpu.mem.ptr(pc1)[pc1 & memory::page::mask] & 0xC7) == 0x45) {
+            this->pop(cpu.SP);
+        }
+    }
+}
+
+} // namespace YAKC
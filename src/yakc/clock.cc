@@ -51,4 +51,16 @@ clock::update(z80bus* bus, int num_cycles) {
     }
 }
 
+//------------------------------------------------------------------------------
+int
+clock::cycles_to_next_timer() const {
+    int cycles = 0x7FFFFFFF;
+    for (const auto& t : this->timers) {
+        if ((t.freq_hz != 0) && (t.value < cycles)) {
+            cycles = t.value;
+        }
+    }
+    return cycles;
+}
+
 } // namespace YAKC
@@ -26,6 +26,8 @@ public:
     void config_timer(int index, int hz);
     /// advance the timers by a number of cycles
     void update(z80bus* bus, int num_cycles);
+    /// get number of cycles until the next timer triggers
+    int cycles_to_next_timer() const;
 
     /// the clock main frequency in KHz
     int base_freq_khz = 0;
@@ -4,10 +4,35 @@
 #include "core.h"
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <atomic>
 
 namespace YAKC {
 
-ext_funcs func;
+// YAKC_ASSERT has no emulator instance to get the callback from, so
+// this is the only process-wide state in the core, it's written once
+static std::atomic<assertmsg_func_t> assertmsg_func(nullptr);
+
+//------------------------------------------------------------------------------
+bool
+install_assertmsg_func(assertmsg_func_t func) {
+    YAKC_ASSERT(func);
+    assertmsg_func_t expected = nullptr;
+    return assertmsg_func.compare_exchange_strong(expected, func) || (expected == func);
+}
+
+//------------------------------------------------------------------------------
+void
+assertmsg(const char* cond, const char* msg, const char* file, int line, const char* func) {
+    const assertmsg_func_t assert_fn = assertmsg_func.load();
+    if (assert_fn) {
+        assert_fn(cond, msg, file, line, func);
+        return;
+    }
+    fprintf(stderr, "\n-- ASSERT: '%s' failed\n  msg: %s\n  file: %s\n  line: %d\n  func: %s\n",
+        cond, msg ? msg : "none", file, line, func);
+    fflush(stderr);
+}
 
 //------------------------------------------------------------------------------
 void
@@ -20,23 +45,29 @@ void
 fill_random(void* ptr, int num_bytes) {
     YAKC_ASSERT((num_bytes & 0x03) == 0);
 
-    // RAND_MAX in Visual Studio is (1<<15)
-    if (RAND_MAX <= (1<<16)) {
-        unsigned short* uptr = (unsigned short*)ptr;
-        int num_ushorts = num_bytes >> 1;
-        for (int i = 0; i < num_ushorts; i++) {
-            unsigned short r = rand();
-            *uptr++ = r;
-        }
+    // xorshift32 with a fixed seed instead of rand(), so that power-on
+    // noise is reproducible and no state is shared between emulators
+    uint32_t x = 0x2463534;
+    uint32_t* uptr = (uint32_t*)ptr;
+    int num_uints = num_bytes >> 2;
+    for (int i = 0; i < num_uints; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        *uptr++ = x;
     }
-    else {
-        unsigned int* uptr = (unsigned int*)ptr;
-        int num_uints = num_bytes >> 2;
-        for (int i = 0; i < num_uints; i++) {
-            unsigned int r = rand();
-            *uptr++ = r;
-        }
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+hash(const void* ptr, int num_bytes, uint64_t seed) {
+    const ubyte* bytes = (const ubyte*) ptr;
+    uint64_t h = seed;
+    for (int i = 0; i < num_bytes; i++) {
+        h ^= bytes[i];
+        h *= 0x100000001b3ULL;
     }
+    return h;
 }
 
 } // namespace YAKC
@@ -15,18 +15,26 @@ typedef int8_t byte;
 typedef uint16_t uword;
 typedef int16_t word;
 
+/// assert message callback
+typedef void (*assertmsg_func_t)(const char* cond, const char* msg, const char* file, int line, const char* func);
+/// called by YAKC_ASSERT, forwards to the installed assert callback, or prints to stderr
+extern void assertmsg(const char* cond, const char* msg, const char* file, int line, const char* func);
+/// install the process-wide assert callback once (thread-safe), return false if another callback is already installed
+extern bool install_assertmsg_func(assertmsg_func_t func);
+
+/// externally provided functions (default is the C runtime for memory allocation)
 struct ext_funcs {
-    void (*assertmsg_func)(const char* cond, const char* msg, const char* file, int line, const char* func) = nullptr;
-    void* (*malloc_func)(size_t) = nullptr;
-    void (*free_func)(void*) = nullptr;
+    assertmsg_func_t assertmsg_func = nullptr;
+    void* (*malloc_func)(size_t) = malloc;
+    void (*free_func)(void*) = free;
 };
 
-/// jump table for externally provided functions
-extern struct ext_funcs func;
 /// helper to clear a chunk of memory
 extern void clear(void* ptr, int num_bytes);
-/// helper to fill a chunk of memory with random noise
+/// helper to fill a chunk of memory with pseudo-random noise (always the same sequence)
 extern void fill_random(void* ptr, int num_bytes);
+/// helper to compute a 64-bit FNV-1a hash over a chunk of memory, can be chained via seed
+extern uint64_t hash(const void* ptr, int num_bytes, uint64_t seed=0xcbf29ce484222325ULL);
 
 /// sound callback functions
 struct sound_funcs {
@@ -40,8 +48,8 @@ struct sound_funcs {
     void (*volume)(void* userdata, uint64_t cycle_count, int vol) = nullptr;
 };
 
-#define YAKC_MALLOC(s) func.malloc_func(s)
-#define YAKC_FREE(p) func.free_func(p)
+#define YAKC_MALLOC(funcs,s) (funcs).malloc_func(s)
+#define YAKC_FREE(funcs,p) (funcs).free_func(p)
 
 #if __clang_analyzer__
 #include <assert.h>
@@ -51,7 +59,7 @@ struct sound_funcs {
 // on Visual Studio, replace __PRETTY_FUNCTION__ with __FUNCSIG__
 #define __PRETTY_FUNCTION__ __FUNCSIG__
 #endif
-#define YAKC_ASSERT(cond) do { if(!(cond)) { func.assertmsg_func(#cond,nullptr,__FILE__,__LINE__,__PRETTY_FUNCTION__); abort(); } } while(0)
+#define YAKC_ASSERT(cond) do { if(!(cond)) { YAKC::assertmsg(#cond,nullptr,__FILE__,__LINE__,__PRETTY_FUNCTION__); abort(); } } while(0)
 #endif
 
 enum class device {
@@ -0,0 +1,213 @@
+//------------------------------------------------------------------------------
+//  coverage.cc
+//------------------------------------------------------------------------------
+#include "coverage.h"
+#include "yakc/z80.h"
+#include <stdio.h>
+#include <string.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+coverage::~coverage() {
+    this->clear_banks();
+}
+
+//------------------------------------------------------------------------------
+void
+coverage::add_bank(const char* name, uword addr, const ubyte* ptr, int size) {
+    YAKC_ASSERT(name && ptr);
+    YAKC_ASSERT((size > 0) && (size <= max_bank_size));
+    YAKC_ASSERT(this->num < max_banks);
+    bank& b = this->banks[this->num++];
+    strncpy(b.name, name, sizeof(b.name) - 1);
+    b.addr = addr;
+    b.ptr = ptr;
+    b.size = size;
+    const int num_bytes = (size + 7) / 8;
+    for (auto& bits : b.bits) {
+        bits = (ubyte*) YAKC_MALLOC(this->funcs, num_bytes);
+        clear(bits, num_bytes);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+coverage::clear_banks() {
+    for (int i = 0; i < this->num; i++) {
+        for (auto& bits : this->banks[i].bits) {
+            YAKC_FREE(this->funcs, bits);
+        }
+        this->banks[i] = bank();
+    }
+    this->num = 0;
+    this->last = 0;
+}
+
+//------------------------------------------------------------------------------
+void
+coverage::reset() {
+    for (int i = 0; i < this->num; i++) {
+        const int num_bytes = (this->banks[i].size + 7) / 8;
+        for (auto& bits : this->banks[i].bits) {
+            clear(bits, num_bytes);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+coverage::begin_run(z80& cpu) {
+    if (this->enabled && (this->num > 0)) {
+        cpu.mem.set_coverage(this);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+coverage::end_run(z80& cpu) {
+    cpu.mem.set_coverage(nullptr);
+}
+
+//------------------------------------------------------------------------------
+int
+coverage::find_bank(const ubyte* ptr) const {
+    for (int i = 0; i < this->num; i++) {
+        const bank& b = this->banks[i];
+        if ((ptr >= b.ptr) && (ptr < (b.ptr + b.size))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+int
+coverage::num_banks() const {
+    return this->num;
+}
+
+//------------------------------------------------------------------------------
+const char*
+coverage::bank_name(int bank) const {
+    YAKC_ASSERT((bank >= 0) && (bank < this->num));
+    return this->banks[bank].name;
+}
+
+//------------------------------------------------------------------------------
+uword
+coverage::bank_addr(int bank) const {
+    YAKC_ASSERT((bank >= 0) && (bank < this->num));
+    return this->banks[bank].addr;
+}
+
+//------------------------------------------------------------------------------
+int
+coverage::bank_size(int bank) const {
+    YAKC_ASSERT((bank >= 0) && (bank < this->num));
+    return this->banks[bank].size;
+}
+
+//------------------------------------------------------------------------------
+int
+coverage::get(int bank, int offset) const {
+    YAKC_ASSERT((bank >= 0) && (bank < this->num));
+    YAKC_ASSERT((offset >= 0) && (offset < this->banks[bank].size));
+    const auto& bits = this->banks[bank].bits;
+    const ubyte mask = 1<<(offset & 7);
+    int flags = 0;
+    if (bits[0][offset>>3] & mask) {
+        flags |= exec;
+    }
+    if (bits[1][offset>>3] & mask) {
+        flags |= read;
+    }
+    if (bits[2][offset>>3] & mask) {
+        flags |= write;
+    }
+    return flags;
+}
+
+//------------------------------------------------------------------------------
+int
+coverage::find(const ubyte* ptr) const {
+    const int b = this->find_bank(ptr);
+    if (b < 0) {
+        return 0;
+    }
+    return this->get(b, int(ptr - this->banks[b].ptr));
+}
+
+//------------------------------------------------------------------------------
+int
+coverage::count(int bank, int kind) const {
+    YAKC_ASSERT((bank >= 0) && (bank < this->num));
+    int n = 0;
+    for (int i = 0; i < this->banks[bank].size; i++) {
+        if (this->get(bank, i) & kind) {
+            n++;
+        }
+    }
+    return n;
+}
+
+//------------------------------------------------------------------------------
+bool
+coverage::save(write_func write_fn, void* userdata) const {
+    YAKC_ASSERT(write_fn);
+    char line[128];
+    for (int i = 0; i < this->num; i++) {
+        const bank& b = this->banks[i];
+        int len = snprintf(line, sizeof(line), "# %s %04X-%04X: %d executed, %d read, %d written\n",
+            b.name, b.addr, (b.addr + b.size - 1) & 0xFFFF,
+            this->count(i, exec), this->count(i, read), this->count(i, write));
+        if (!write_fn(userdata, line, len)) {
+            return false;
+        }
+        // runs of executed bytes are code, runs of only read bytes are data
+        int offset = 0;
+        while (offset < b.size) {
+            const int flags = this->get(i, offset);
+            const int type = (flags & exec) ? exec : ((flags & read) ? read : 0);
+            int end = offset + 1;
+            while (end < b.size) {
+                const int f = this->get(i, end);
+                if (type != ((f & exec) ? exec : ((f & read) ? read : 0))) {
+                    break;
+                }
+                end++;
+            }
+            if (type != 0) {
+                len = snprintf(line, sizeof(line), "%s %04X %04X %s\n",
+                    b.name, (b.addr + offset) & 0xFFFF, (b.addr + end - 1) & 0xFFFF,
+                    type == exec ? "code" : "data");
+                if (!write_fn(userdata, line, len)) {
+                    return false;
+                }
+            }
+            offset = end;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static bool
+write_to_file(void* userdata, const void* ptr, int num_bytes) {
+    return fwrite(ptr, 1, num_bytes, (FILE*)userdata) == size_t(num_bytes);
+}
+
+//------------------------------------------------------------------------------
+bool
+coverage::write_file(const char* path) const {
+    YAKC_ASSERT(path);
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        return false;
+    }
+    const bool success = this->save(write_to_file, fp);
+    fclose(fp);
+    return success;
+}
+
+} // namespace YAKC
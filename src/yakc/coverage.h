@@ -0,0 +1,122 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::coverage
+    @brief executed/read/written bitmaps per memory bank
+
+    The emulated systems register their ROM banks (and the main RAM) at
+    power-on, each bank with a name and the CPU address it is mapped
+    to. While enabled, the CPU loop installs the coverage in the CPU
+    memory (see memory::set_coverage()), which then sets a bit per byte
+    of host memory in an executed, read or written bitmap of the bank
+    the byte belongs to. Like the memory access counters, this uses
+    the memory trap slow path, so there is no overhead when disabled.
+
+    Opcode fetches and the instruction operands which immediately
+    follow them (displacements and immediate values) are marked as
+    executed, all other reads as read.
+
+    The discovered code and data regions of all banks can be written
+    as text, one region per line:
+
+        caos_e E000 E0A5 code
+        caos_e E0A6 E0C3 data
+
+    A code region contains only executed bytes, a data region only
+    bytes which were read but never executed, bytes which were not
+    accessed at all are left out.
+*/
+#include "yakc/core.h"
+
+namespace YAKC {
+
+class z80;
+
+class coverage {
+public:
+    /// access flags
+    enum kind {
+        exec = (1<<0),
+        read = (1<<1),
+        write = (1<<2),
+    };
+    /// max number of banks
+    static const int max_banks = 8;
+    /// max size of a bank
+    static const int max_bank_size = 1<<16;
+    /// stream output callback (same as snapshot::write_func), must return false on error
+    typedef bool (*write_func)(void* userdata, const void* ptr, int num_bytes);
+
+    /// set to true to start recording
+    bool enabled = false;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+    /// destructor
+    ~coverage();
+    /// add a bank of host memory mapped at a CPU address
+    void add_bank(const char* name, uword addr, const ubyte* ptr, int size);
+    /// remove all banks
+    void clear_banks();
+    /// clear the bitmaps of all banks
+    void reset();
+    /// called before the CPU loop, installs the coverage in the CPU memory if enabled
+    void begin_run(z80& cpu);
+    /// called after the CPU loop
+    void end_run(z80& cpu);
+    /// mark a byte of host memory
+    void mark(const ubyte* ptr, int kind);
+
+    /// number of banks
+    int num_banks() const;
+    /// get the name of a bank
+    const char* bank_name(int bank) const;
+    /// get the CPU address of a bank
+    uword bank_addr(int bank) const;
+    /// get the size of a bank
+    int bank_size(int bank) const;
+    /// get the access flags of a byte in a bank
+    int get(int bank, int offset) const;
+    /// get the access flags of a byte of host memory, 0 if not in a bank
+    int find(const ubyte* ptr) const;
+    /// count the bytes of a bank with an access flag
+    int count(int bank, int kind) const;
+
+    /// write the code and data regions of all banks as text
+    bool save(write_func write_fn, void* userdata) const;
+    /// write the code and data regions to a file
+    bool write_file(const char* path) const;
+
+private:
+    struct bank {
+        char name[16] = { };
+        uword addr = 0;
+        const ubyte* ptr = nullptr;
+        int size = 0;
+        ubyte* bits[3] = { };       // executed, read, written
+    };
+    /// find the bank of a host memory pointer, or -1
+    int find_bank(const ubyte* ptr) const;
+
+    bank banks[max_banks];
+    int num = 0;
+    int last = 0;
+};
+
+//------------------------------------------------------------------------------
+inline void
+coverage::mark(const ubyte* ptr, int kind) {
+    int b = this->last;
+    if ((b >= this->num) || (ptr < this->banks[b].ptr) || (ptr >= (this->banks[b].ptr + this->banks[b].size))) {
+        b = this->find_bank(ptr);
+        if (b < 0) {
+            return;
+        }
+        this->last = b;
+    }
+    const int offset = int(ptr - this->banks[b].ptr);
+    const int index = (kind == exec) ? 0 : ((kind == read) ? 1 : 2);
+    this->banks[b].bits[index][offset>>3] |= 1<<(offset & 7);
+}
+
+} // namespace YAKC
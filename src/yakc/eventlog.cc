@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+//  eventlog.cc
+//------------------------------------------------------------------------------
+#include "eventlog.h"
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+void
+eventlog::discard() {
+    this->data.discard();
+    this->last_cycle_count = 0;
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_byte(ubyte val) {
+    snapshot::membuf::write(&this->data, &val, 1);
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_varint(uint64_t val) {
+    // LEB128: 7 bits per byte, high bit set if more bytes follow
+    ubyte buf[10];
+    int num = 0;
+    do {
+        ubyte b = val & 0x7F;
+        val >>= 7;
+        if (val) {
+            b |= 0x80;
+        }
+        buf[num++] = b;
+    }
+    while (val);
+    snapshot::membuf::write(&this->data, buf, num);
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_event(uint64_t cycle_count, event_type type) {
+    YAKC_ASSERT(cycle_count >= this->last_cycle_count);
+    this->write_byte(type);
+    this->write_varint(cycle_count - this->last_cycle_count);
+    this->last_cycle_count = cycle_count;
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_frame(const yakc& emu) {
+    this->write_event(emu.cycle_count(), event_frame);
+    this->write_varint(overflow_cycles(emu));
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_key(const yakc& emu, ubyte ascii) {
+    this->write_event(emu.cycle_count(), event_key);
+    this->write_byte(ascii);
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_insert_module(const yakc& emu, ubyte slot_addr, kc85_exp::module_type type) {
+    this->write_event(emu.cycle_count(), event_insert_module);
+    this->write_byte(slot_addr);
+    this->write_byte(ubyte(type));
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_remove_module(const yakc& emu, ubyte slot_addr) {
+    this->write_event(emu.cycle_count(), event_remove_module);
+    this->write_byte(slot_addr);
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_reset(const yakc& emu) {
+    this->write_event(emu.cycle_count(), event_reset);
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::write_paused_frames(int num_frames) {
+    YAKC_ASSERT(num_frames > 0);
+    this->write_event(this->last_cycle_count, event_paused_frames);
+    this->write_varint(num_frames);
+}
+
+//------------------------------------------------------------------------------
+bool
+eventlog::read_byte(int& pos, ubyte& val) const {
+    if (pos < this->data.size) {
+        val = this->data.ptr[pos++];
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+eventlog::read_varint(int& pos, uint64_t& val) const {
+    val = 0;
+    int shift = 0;
+    ubyte b;
+    do {
+        if (!this->read_byte(pos, b)) {
+            return false;
+        }
+        val |= uint64_t(b & 0x7F) << shift;
+        shift += 7;
+    }
+    while ((b & 0x80) && (shift < 64));
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+eventlog::read(int& pos, uint64_t prev_cycle_count, event& out) const {
+    ubyte type;
+    uint64_t delta;
+    if (!this->read_byte(pos, type) || !this->read_varint(pos, delta)) {
+        return false;
+    }
+    out = event();
+    out.type = (event_type) type;
+    out.cycle_count = prev_cycle_count + delta;
+    uint64_t val;
+    switch (out.type) {
+        case event_frame:
+            if (!this->read_varint(pos, val) || (val > out.cycle_count)) {
+                return false;
+            }
+            out.end_cycle_count = out.cycle_count - val;
+            return true;
+        case event_key:
+            return this->read_byte(pos, out.key);
+        case event_insert_module:
+            {
+                ubyte mod_type;
+                if (!this->read_byte(pos, out.slot_addr) || !this->read_byte(pos, mod_type)) {
+                    return false;
+                }
+                out.module_type = (kc85_exp::module_type) mod_type;
+            }
+            return true;
+        case event_remove_module:
+            return this->read_byte(pos, out.slot_addr);
+        case event_reset:
+            return true;
+        case event_paused_frames:
+            if (!this->read_varint(pos, val)) {
+                return false;
+            }
+            out.num_frames = int(val);
+            return true;
+        default:
+            // unknown event type, corrupt log
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+eventlog::apply_input(yakc& emu, const event& e) {
+    switch (e.type) {
+        case event_key:
+            emu.put_key(e.key);
+            return true;
+        case event_insert_module:
+            emu.insert_module(e.slot_addr, e.module_type);
+            return true;
+        case event_remove_module:
+            emu.remove_module(e.slot_addr);
+            return true;
+        case event_reset:
+            emu.reset();
+            return true;
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+eventlog::run_to(yakc& emu, uint64_t cycle_count) {
+    emu.onframe(1, 0, cycle_count, cycle_count);
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+eventlog::overflow_cycles(const yakc& emu) {
+    if (emu.kc85.on) {
+        return emu.kc85.overflow_cycles;
+    }
+    else if (emu.z1013.on) {
+        return emu.z1013.overflow_cycles;
+    }
+    else if (emu.z9001.on) {
+        return emu.z9001.overflow_cycles;
+    }
+    else {
+        return 0;
+    }
+}
+
+} // namespace YAKC
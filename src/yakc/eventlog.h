@@ -0,0 +1,92 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::eventlog
+    @brief encoding and replay of timestamped emulator input events
+
+    The common event log of the movie recorder and the reverse debugger.
+    Each event is a type byte, followed by the cycle count delta to the
+    previous event and the event payload. Cycle count deltas and other
+    integers are written as variable-length unsigned integers (LEB128),
+    since most of them are small.
+
+    Events are read back into an event struct with read(), input events
+    (key, module changes and reset) are applied with apply_input(), how
+    frames are replayed is up to the owner of the log.
+*/
+#include "yakc/snapshot.h"
+
+namespace YAKC {
+
+class eventlog {
+public:
+    /// event types (the values are part of the movie file format)
+    enum event_type : ubyte {
+        event_frame = 0,        // payload: overflow cycles (varint)
+        event_key,              // payload: ASCII code
+        event_insert_module,    // payload: slot address, module type
+        event_remove_module,    // payload: slot address
+        event_reset,            // no payload
+        event_paused_frames,    // payload: number of frames (varint)
+    };
+    /// a decoded event
+    struct event {
+        event_type type = event_frame;
+        /// absolute cycle count of the event
+        uint64_t cycle_count = 0;
+        /// event_frame: the cycle count the frame ran up to (without overflow cycles)
+        uint64_t end_cycle_count = 0;
+        /// event_paused_frames: number of frames
+        int num_frames = 0;
+        /// event_key: ASCII code
+        ubyte key = 0;
+        /// event_insert_module, event_remove_module: slot address
+        ubyte slot_addr = 0;
+        /// event_insert_module: module type
+        kc85_exp::module_type module_type = kc85_exp::none;
+    };
+
+    /// the encoded events
+    snapshot::membuf data;
+    /// cycle count of the last written event
+    uint64_t last_cycle_count = 0;
+
+    /// free the log memory (keeps the memory allocation functions)
+    void discard();
+
+    /// write the end of a frame
+    void write_frame(const yakc& emu);
+    /// write a key input
+    void write_key(const yakc& emu, ubyte ascii);
+    /// write a KC85 module insertion
+    void write_insert_module(const yakc& emu, ubyte slot_addr, kc85_exp::module_type type);
+    /// write a KC85 module removal
+    void write_remove_module(const yakc& emu, ubyte slot_addr);
+    /// write a reset
+    void write_reset(const yakc& emu);
+    /// write frames which ran while the debugger was paused, at the cycle count of the last event
+    void write_paused_frames(int num_frames);
+
+    /// decode the event at a log position and advance the position, false at end of log or if corrupt
+    bool read(int& pos, uint64_t prev_cycle_count, event& out) const;
+    /// apply an input event (key, module change or reset), false if not an input event
+    static bool apply_input(yakc& emu, const event& e);
+    /// run the emulator in a single frame exactly up to a cycle count
+    static void run_to(yakc& emu, uint64_t cycle_count);
+    /// get the cycles the current frame of the running system has run past its end
+    static uint32_t overflow_cycles(const yakc& emu);
+
+private:
+    /// write an event header (type and cycle count delta)
+    void write_event(uint64_t cycle_count, event_type type);
+    /// write a variable-length unsigned integer
+    void write_varint(uint64_t val);
+    /// write a byte
+    void write_byte(ubyte val);
+    /// read a variable-length unsigned integer, false at end of log
+    bool read_varint(int& pos, uint64_t& val) const;
+    /// read a byte, false at end of log
+    bool read_byte(int& pos, ubyte& val) const;
+};
+
+} // namespace YAKC
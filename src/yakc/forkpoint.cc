@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+//  forkpoint.cc
+//------------------------------------------------------------------------------
+#include "forkpoint.h"
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+forkpoint::~forkpoint() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+forkpoint::discard() {
+    if (this->data) {
+        YAKC_FREE(this->funcs, this->data);
+        this->data = nullptr;
+    }
+    this->capacity = 0;
+    this->num_banks = 0;
+    this->model = device::none;
+    this->os = os_rom::none;
+}
+
+//------------------------------------------------------------------------------
+bool
+forkpoint::valid() const {
+    return nullptr != this->data;
+}
+
+//------------------------------------------------------------------------------
+int
+forkpoint::num_bytes() const {
+    return this->capacity;
+}
+
+//------------------------------------------------------------------------------
+bool
+forkpoint::find_clean_pages(const yakc& emu, const snapshot::bank_t* src_banks, int num, uint64_t* out_clean_pages) const {
+    const memory& mem = emu.board.cpu.mem;
+    if (!this->data || (0 == mem.num_shared_ranges) ||
+        (emu.funcs.free_func != this->funcs.free_func) || (num != this->num_banks)) {
+        return false;
+    }
+    int num_ranges = 0;
+    for (int i = 0; i < num; i++) {
+        const snapshot::bank_t& src = src_banks[i];
+        const snapshot::bank_t& cur = this->banks[i];
+        if ((src.type != cur.type) || (src.index != cur.index) || (src.size != cur.size)) {
+            return false;
+        }
+        out_clean_pages[i] = mem.shared_pages(src.ptr, cur.ptr);
+        if (out_clean_pages[i]) {
+            num_ranges++;
+        }
+    }
+    // any memory shared with another source must be unshared first
+    return num_ranges == mem.num_shared_ranges;
+}
+
+//------------------------------------------------------------------------------
+void
+forkpoint::capture(yakc& emu) {
+    YAKC_ASSERT(emu.switchedon());
+    snapshot::bank_t src_banks[snapshot::max_banks];
+    const int num = snapshot::enumerate_banks(emu, src_banks, snapshot::max_banks, false);
+    // when recapturing a clone of this forkpoint, the pages which are
+    // still shared are unchanged and don't need to be copied, otherwise
+    // sharing must end before the data buffer is overwritten
+    uint64_t clean_pages[snapshot::max_banks] = { };
+    if (!this->find_clean_pages(emu, src_banks, num, clean_pages)) {
+        emu.board.cpu.mem.unshare();
+        clear(clean_pages, sizeof(clean_pages));
+    }
+    int size = 0;
+    for (int i = 0; i < num; i++) {
+        size += src_banks[i].size;
+    }
+    if (emu.funcs.free_func != this->funcs.free_func) {
+        // allocate through the emulator's memory functions
+        this->discard();
+        this->funcs = emu.funcs;
+    }
+    if (size > this->capacity) {
+        this->discard();
+        this->data = (ubyte*) YAKC_MALLOC(this->funcs, size);
+        this->capacity = size;
+    }
+    this->model = emu.model;
+    this->os = emu.os;
+    snapshot::write_sys_state(emu, this->sys);
+    this->num_banks = num;
+    ubyte* dst = this->data;
+    for (int i = 0; i < num; i++) {
+        this->banks[i] = src_banks[i];
+        if (clean_pages[i]) {
+            for (int offset = 0; offset < src_banks[i].size; offset += memory::page::size) {
+                if (0 == (clean_pages[i] & (uint64_t(1) << (offset>>memory::page::shift)))) {
+                    memcpy(dst + offset, src_banks[i].ptr + offset, memory::page::size);
+                }
+            }
+        }
+        else {
+            memcpy(dst, src_banks[i].ptr, src_banks[i].size);
+        }
+        this->banks[i].ptr = dst;
+        dst += src_banks[i].size;
+    }
+
+    // state which isn't part of snapshots
+    if (emu.kc85.on) {
+        this->abs_cycle_count = emu.kc85.abs_cycle_count;
+        this->overflow_cycles = emu.kc85.overflow_cycles;
+        this->kc85_key_code = emu.kc85.key_code;
+    }
+    else if (emu.z1013.on) {
+        this->abs_cycle_count = emu.z1013.abs_cycle_count;
+        this->overflow_cycles = emu.z1013.overflow_cycles;
+    }
+    else if (emu.z9001.on) {
+        this->abs_cycle_count = emu.z9001.abs_cycle_count;
+        this->overflow_cycles = emu.z9001.overflow_cycles;
+        this->z9001_keybuf = emu.z9001.keybuf;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+forkpoint::clone(yakc& dst) const {
+    YAKC_ASSERT(this->valid());
+    if (!dst.switchedon() || (dst.model != this->model) || (dst.os != this->os)) {
+        if (dst.switchedon()) {
+            dst.poweroff();
+        }
+        bootcache* boot_cache = dst.boot_cache;
+        dst.boot_cache = nullptr;
+        dst.poweron(this->model, this->os);
+        dst.boot_cache = boot_cache;
+    }
+    memory& mem = dst.board.cpu.mem;
+    mem.drop_shared();
+    snapshot::apply_sys_state(this->sys, dst);
+    snapshot::bank_t dst_banks[snapshot::max_banks];
+    const int num = snapshot::enumerate_banks(dst, dst_banks, snapshot::max_banks);
+    YAKC_ASSERT(num == this->num_banks);
+    for (int i = 0; i < num; i++) {
+        const snapshot::bank_t& src = this->banks[i];
+        YAKC_ASSERT((src.type == dst_banks[i].type) && (src.size == dst_banks[i].size));
+        if ((src.type == snapshot::bank_ram) || (src.type == snapshot::bank_module)) {
+            mem.share(dst_banks[i].ptr, src.ptr, src.size);
+        }
+        else {
+            memcpy(dst_banks[i].ptr, src.ptr, src.size);
+        }
+    }
+    snapshot::after_apply(dst);
+    if (dst.kc85.on) {
+        dst.kc85.abs_cycle_count = this->abs_cycle_count;
+        dst.kc85.overflow_cycles = this->overflow_cycles;
+        dst.kc85.key_code = this->kc85_key_code;
+    }
+    else if (dst.z1013.on) {
+        dst.z1013.abs_cycle_count = this->abs_cycle_count;
+        dst.z1013.overflow_cycles = this->overflow_cycles;
+    }
+    else if (dst.z9001.on) {
+        dst.z9001.abs_cycle_count = this->abs_cycle_count;
+        dst.z9001.overflow_cycles = this->overflow_cycles;
+        dst.z9001.keybuf = this->z9001_keybuf;
+    }
+}
+
+} // namespace YAKC
@@ -0,0 +1,72 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::forkpoint
+    @brief capture a machine state once and cheaply fork it many times
+
+    A forkpoint holds a read-only copy of the complete machine state,
+    including the CPU cycle counter and pending keyboard input, so that
+    a clone is an exact continuation of the captured machine. Cloning it
+    into another emulator instance only copies the CPU and chip registers
+    and the video memory, while the system RAM and the RAM of KC85
+    expansion modules are shared copy-on-write at memory page granularity
+    (see memory::share()): a clone only gets a private copy of a 1 KByte
+    page when it writes to it the first time.
+
+    Video memory is always copied since it is read directly by the
+    video decoders, it's small (except on the KC85/4).
+
+    The emulator instance receiving the clone must have been initialized
+    with the same ROMs and module types as the source emulator. If it
+    isn't switched on with the same model and OS, it will be switched on
+    first (without running the boot cache).
+
+    The forkpoint must outlive all clones which still share memory with
+    it, to end sharing call memory::unshare() on the clone (this also
+    happens implicitly when taking a snapshot of the clone, or when the
+    clone is switched off). Capturing a clone of the same forkpoint again
+    (like the run-ahead does every frame) only copies the pages which the
+    clone has written to, no other clones may share memory with the
+    forkpoint at that time.
+*/
+#include "yakc/snapshot.h"
+
+namespace YAKC {
+
+class forkpoint {
+public:
+    /// destructor
+    ~forkpoint();
+
+    /// capture the current state of a running emulator
+    void capture(yakc& emu);
+    /// release the captured state
+    void discard();
+    /// return true if a state has been captured
+    bool valid() const;
+    /// clone the captured state into an emulator
+    void clone(yakc& dst) const;
+    /// size of the memory allocated for the captured state in bytes
+    int num_bytes() const;
+
+    /// model and OS of the captured state
+    device model = device::none;
+    os_rom os = os_rom::none;
+
+private:
+    /// find the pages of a recaptured clone which are still shared with the captured state
+    bool find_clean_pages(const yakc& emu, const snapshot::bank_t* src_banks, int num, uint64_t* out_clean_pages) const;
+
+    ext_funcs funcs;    // taken from the captured emulator
+    snapshot::sys_t sys;
+    snapshot::bank_t banks[snapshot::max_banks];
+    int num_banks = 0;
+    ubyte* data = nullptr;
+    int capacity = 0;
+    uint64_t abs_cycle_count = 0;
+    uint32_t overflow_cycles = 0;
+    ubyte kc85_key_code = 0;
+    keybuffer z9001_keybuf;
+};
+
+} // namespace YAKC
@@ -0,0 +1,267 @@
+//------------------------------------------------------------------------------
+//  frametimes.cc
+//------------------------------------------------------------------------------
+#include "frametimes.h"
+#include <chrono>
+#include <stdio.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+frametimes::frametimes() {
+    this->reset();
+}
+
+//------------------------------------------------------------------------------
+frametimes::~frametimes() {
+    if (this->events) {
+        YAKC_FREE(this->funcs, this->events);
+        this->events = nullptr;
+    }
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+frametimes::now() {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+//------------------------------------------------------------------------------
+void
+frametimes::reset() {
+    clear(this->cur_ns, sizeof(this->cur_ns));
+    clear(this->cur_calls, sizeof(this->cur_calls));
+    this->depth = 0;
+    this->sample_count = 0;
+    this->sampling = false;
+    this->history_pos = 0;
+    this->history_count = 0;
+
+    // the overhead of reading the clock, this is removed from sampled
+    // sections since it would be scaled up with the sampled time
+    this->overhead = ~uint64_t(0);
+    for (int i = 0; i < 16; i++) {
+        const uint64_t t0 = now();
+        const uint64_t t1 = now();
+        if ((t1 - t0) < this->overhead) {
+            this->overhead = t1 - t0;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+frametimes::push(int s) {
+    YAKC_ASSERT((s >= 0) && (s < num_sections));
+    YAKC_ASSERT(this->depth < max_depth);
+    const uint64_t t = now();
+    if (this->depth > 0) {
+        this->stack[this->depth - 1].excl += t - this->mark;
+    }
+    stack_entry& e = this->stack[this->depth++];
+    e.section = s;
+    e.start = t;
+    e.excl = 0;
+    e.sampled = this->sampling;
+    this->sampling = false;
+    this->cur_calls[s]++;
+    this->mark = t;
+}
+
+//------------------------------------------------------------------------------
+void
+frametimes::pop() {
+    const uint64_t t = now();
+    stack_entry& e = this->stack[--this->depth];
+    e.excl += t - this->mark;
+    this->mark = t;
+    int64_t excl = e.excl;
+    if (e.sampled) {
+        // the time of the calls which weren't sampled went into the enclosing section
+        excl -= int64_t(this->overhead);
+        if (excl < 0) {
+            excl = 0;
+        }
+        const int64_t extra = excl * (sample_interval - 1);
+        excl += extra;
+        if (this->depth > 0) {
+            this->stack[this->depth - 1].excl -= extra;
+        }
+    }
+    if (excl > 0) {
+        this->cur_ns[e.section] += excl;
+    }
+    if (this->capture) {
+        this->add_event(e.section, e.start, t - e.start);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+frametimes::next_frame() {
+    if (!this->enabled) {
+        return;
+    }
+    frame& f = this->history[this->history_pos];
+    for (int s = 0; s < num_sections; s++) {
+        f.ns[s] = this->cur_ns[s] > 0 ? uint64_t(this->cur_ns[s]) : 0;
+        f.calls[s] = this->cur_calls[s];
+    }
+    clear(this->cur_ns, sizeof(this->cur_ns));
+    clear(this->cur_calls, sizeof(this->cur_calls));
+    this->history_pos = (this->history_pos + 1) % history_size;
+    if (this->history_count < history_size) {
+        this->history_count++;
+    }
+    // drop sections which were left open
+    this->depth = 0;
+    if (this->capture) {
+        this->add_event(-1, now(), 0);
+    }
+}
+
+//------------------------------------------------------------------------------
+int
+frametimes::num_frames() const {
+    return this->history_count;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+frametimes::get_ns(int frame, int s) const {
+    YAKC_ASSERT((frame >= 0) && (frame < this->history_count));
+    YAKC_ASSERT((s >= 0) && (s < num_sections));
+    const int index = (this->history_pos - 1 - frame + history_size) % history_size;
+    return this->history[index].ns[s];
+}
+
+//------------------------------------------------------------------------------
+int
+frametimes::get_calls(int frame, int s) const {
+    YAKC_ASSERT((frame >= 0) && (frame < this->history_count));
+    YAKC_ASSERT((s >= 0) && (s < num_sections));
+    const int index = (this->history_pos - 1 - frame + history_size) % history_size;
+    return this->history[index].calls[s];
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+frametimes::average_ns(int s) const {
+    if (0 == this->history_count) {
+        return 0;
+    }
+    uint64_t ns = 0;
+    for (int i = 0; i < this->history_count; i++) {
+        ns += this->get_ns(i, s);
+    }
+    return ns / this->history_count;
+}
+
+//------------------------------------------------------------------------------
+const char*
+frametimes::section_name(int s) {
+    YAKC_ASSERT((s >= 0) && (s < num_sections));
+    static const char* names[num_sections] = {
+        "cpu", "clocks", "video", "audio", "banks", "snapshot", "render", "ui"
+    };
+    return names[s];
+}
+
+//------------------------------------------------------------------------------
+void
+frametimes::start_capture(int num) {
+    YAKC_ASSERT(num > 0);
+    if (this->max_events != num) {
+        if (this->events) {
+            YAKC_FREE(this->funcs, this->events);
+        }
+        this->events = (event*) YAKC_MALLOC(this->funcs, num * sizeof(event));
+        this->max_events = num;
+    }
+    this->events_count = 0;
+    this->capture_start = now();
+    this->capture = true;
+}
+
+//------------------------------------------------------------------------------
+void
+frametimes::stop_capture() {
+    this->capture = false;
+}
+
+//------------------------------------------------------------------------------
+bool
+frametimes::capturing() const {
+    return this->capture;
+}
+
+//------------------------------------------------------------------------------
+int
+frametimes::num_events() const {
+    return this->events_count;
+}
+
+//------------------------------------------------------------------------------
+void
+frametimes::add_event(int s, uint64_t start, uint64_t duration) {
+    if (this->events_count < this->max_events) {
+        event& e = this->events[this->events_count++];
+        e.section = s;
+        e.start = start;
+        e.duration = duration;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+frametimes::save_trace(write_func write_fn, void* userdata) const {
+    YAKC_ASSERT(write_fn);
+    char line[160];
+    int len = snprintf(line, sizeof(line), "{\"traceEvents\":[\n");
+    if (!write_fn(userdata, line, len)) {
+        return false;
+    }
+    for (int i = 0; i < this->events_count; i++) {
+        const event& e = this->events[i];
+        // timestamps are in microseconds since the start of the capture
+        const double ts = (e.start >= this->capture_start) ? (e.start - this->capture_start) / 1000.0 : 0.0;
+        const char* sep = (i + 1) < this->events_count ? "," : "";
+        if (e.section < 0) {
+            len = snprintf(line, sizeof(line),
+                "{\"name\":\"frame\",\"cat\":\"yakc\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":1,\"ts\":%.3f}%s\n",
+                ts, sep);
+        }
+        else {
+            len = snprintf(line, sizeof(line),
+                "{\"name\":\"%s\",\"cat\":\"yakc\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+                section_name(e.section), ts, e.duration / 1000.0, sep);
+        }
+        if (!write_fn(userdata, line, len)) {
+            return false;
+        }
+    }
+    len = snprintf(line, sizeof(line), "],\"displayTimeUnit\":\"ms\"}\n");
+    return write_fn(userdata, line, len);
+}
+
+//------------------------------------------------------------------------------
+static bool
+write_to_file(void* userdata, const void* ptr, int num_bytes) {
+    return fwrite(ptr, 1, num_bytes, (FILE*)userdata) == size_t(num_bytes);
+}
+
+//------------------------------------------------------------------------------
+bool
+frametimes::write_trace_file(const char* path) const {
+    YAKC_ASSERT(path);
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        return false;
+    }
+    const bool success = this->save_trace(write_to_file, fp);
+    fclose(fp);
+    return success;
+}
+
+} // namespace YAKC
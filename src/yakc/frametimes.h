@@ -0,0 +1,183 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::frametimes
+    @brief host time and call counts per frame for each emulator subsystem
+
+    When enabled, the emulated systems bracket the work of their
+    subsystems with begin() and end(): the CPU loop, the clock and CTC
+    timer updates, video decoding, audio events, bank switching and the
+    per-frame snapshot work (rewind buffer, movie recorder and reverse
+    debugger). The app brackets its own work (rendering the emulator
+    display and the UI) the same way, and calls next_frame() once per
+    host frame, which moves the host nanoseconds and call counts of the
+    frame into a history ring.
+
+    Sections can be nested, each section only gets its exclusive time
+    (for instance the video decoding which is called from the CPU loop
+    is not counted as CPU time). A section with 2 clock reads per
+    instruction would slow down the emulation a lot, so the clock and
+    CTC updates (which run after each instruction) are only timed every
+    sample_interval calls (see sample()), the measured time (minus the
+    cost of a clock read) is scaled up and moved from the enclosing
+    section.
+
+    Optionally, each begin/end pair (and each next_frame()) is captured
+    as an event with its start time and duration, and the captured
+    events can be written in the Chrome trace event JSON format (for
+    chrome://tracing or similar tools). Sampled sections only produce
+    events for the sampled calls.
+
+    The sections are disabled during run-ahead and reverse debugger
+    replays, like the profiler, but the app measures the run-ahead time
+    separately. The cost when disabled is a single branch per section.
+*/
+#include "yakc/core.h"
+
+namespace YAKC {
+
+class frametimes {
+public:
+    /// the measured sections
+    enum section {
+        cpu = 0,        // the CPU loop (without the other sections)
+        clocks,         // clock and CTC timer updates
+        video,          // video decoding
+        audio,          // audio events
+        banks,          // bank switching
+        snapshot,       // snapshot work (rewind buffer, movie, reverse debugger)
+        render,         // host: rendering the emulator display
+        ui,             // host: the debugging UI
+
+        num_sections
+    };
+    /// number of frames in the history ring
+    static const int history_size = 128;
+    /// a sampled section is timed once per this many calls
+    static const int sample_interval = 64;
+    /// max nesting depth of sections
+    static const int max_depth = 8;
+    /// stream output callback (same as snapshot::write_func), must return false on error
+    typedef bool (*write_func)(void* userdata, const void* ptr, int num_bytes);
+
+    /// set to true to start measuring
+    bool enabled = false;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+    /// constructor
+    frametimes();
+    /// destructor
+    ~frametimes();
+    /// clear the current frame and the history
+    void reset();
+    /// begin a section
+    void begin(int s);
+    /// end the current section
+    void end();
+    /// for sections which are called very often, returns true if this call should be timed
+    bool sample(int s);
+    /// close the current frame and store it in the history
+    void next_frame();
+
+    /// number of frames in the history
+    int num_frames() const;
+    /// get the host nanoseconds of a section in a frame (0 is the last completed frame)
+    uint64_t get_ns(int frame, int s) const;
+    /// get the number of calls of a section in a frame (0 is the last completed frame)
+    int get_calls(int frame, int s) const;
+    /// get the average host nanoseconds of a section over the history
+    uint64_t average_ns(int s) const;
+    /// get the name of a section
+    static const char* section_name(int s);
+
+    /// start capturing events (drops previously captured events)
+    void start_capture(int max_events);
+    /// stop capturing events
+    void stop_capture();
+    /// true while capturing events
+    bool capturing() const;
+    /// number of captured events
+    int num_events() const;
+    /// write the captured events as Chrome trace JSON
+    bool save_trace(write_func write_fn, void* userdata) const;
+    /// write the captured events as Chrome trace JSON to a file
+    bool write_trace_file(const char* path) const;
+
+    /// get the current host time in nanoseconds
+    static uint64_t now();
+
+private:
+    struct frame {
+        uint64_t ns[num_sections] = { };
+        int calls[num_sections] = { };
+    };
+    struct stack_entry {
+        int section = 0;
+        uint64_t start = 0;
+        int64_t excl = 0;           // exclusive time so far
+        bool sampled = false;
+    };
+    struct event {
+        int section = 0;            // -1 for a frame marker
+        uint64_t start = 0;
+        uint64_t duration = 0;
+    };
+    /// push a section
+    void push(int s);
+    /// pop the current section
+    void pop();
+    /// add a captured event
+    void add_event(int s, uint64_t start, uint64_t duration);
+
+    int64_t cur_ns[num_sections] = { };
+    int cur_calls[num_sections] = { };
+    stack_entry stack[max_depth];
+    int depth = 0;
+    uint64_t mark = 0;
+    uint64_t overhead = 0;          // cost of a clock read
+    int sample_count = 0;
+    bool sampling = false;
+    frame history[history_size];
+    int history_pos = 0;
+    int history_count = 0;
+
+    event* events = nullptr;
+    int max_events = 0;
+    int events_count = 0;
+    uint64_t capture_start = 0;
+    bool capture = false;
+};
+
+//------------------------------------------------------------------------------
+inline void
+frametimes::begin(int s) {
+    if (this->enabled) {
+        this->push(s);
+    }
+}
+
+//------------------------------------------------------------------------------
+inline void
+frametimes::end() {
+    if (this->enabled && (this->depth > 0)) {
+        this->pop();
+    }
+}
+
+//------------------------------------------------------------------------------
+inline bool
+frametimes::sample(int s) {
+    if (this->enabled) {
+        if (++this->sample_count < sample_interval) {
+            this->cur_calls[s]++;
+            return false;
+        }
+        this->sample_count = 0;
+        this->sampling = true;
+        return true;
+    }
+    return false;
+}
+
+} // namespace YAKC
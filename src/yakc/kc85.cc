@@ -7,8 +7,11 @@ namespace YAKC {
 
 //------------------------------------------------------------------------------
 void
-kc85::init(breadboard* b) {
+kc85::init(breadboard* b, const ext_funcs& funcs) {
     this->board = b;
+    this->funcs = funcs;
+    this->exp.funcs = funcs;
+    this->roms.funcs = funcs;
     this->exp.init();
 }
 
@@ -43,18 +46,34 @@ kc85::poweron(device m, os_rom os) {
     this->pio_a = 0;
     this->pio_b = 0;
 
+    this->update_buffers();
+
     // fill RAM banks with noise (but not on KC85/4? at least the 4
     // doesn't have the random-color-pattern when switching it on)
     if (device::kc85_4 == m) {
-        clear(this->ram, sizeof(this->ram));
+        clear(this->ram, ram_size);
     }
     else {
-        fill_random(this->ram, sizeof(this->ram));
+        fill_random(this->ram, ram_size);
     }
 
     // set operating system pointers
     this->update_rom_pointers();
 
+    // the memory banks for the execution coverage
+    coverage& cov = this->board->cov;
+    cov.clear_banks();
+    cov.add_bank("ram", 0x0000, this->ram[0], 0x4000);
+    if ((device::kc85_3 == m) || (device::kc85_4 == m)) {
+        cov.add_bank("basic", 0xC000, dump_basic_c0, 0x2000);
+    }
+    if (this->caos_c_ptr) {
+        cov.add_bank("caos_c", 0xC000, this->caos_c_ptr, this->caos_c_size);
+    }
+    if (this->caos_e_ptr) {
+        cov.add_bank("caos_e", 0xE000, this->caos_e_ptr, this->caos_e_size);
+    }
+
     // initialize the clock, the 85/4 runs at 1.77 MHz, the others at 1.75 MHz
     this->board->clck.init((m == device::kc85_4) ? 1770 : 1750);
 
@@ -92,7 +111,28 @@ kc85::poweroff() {
     YAKC_ASSERT(this->on);
     this->audio.reset();
     this->board->cpu.mem.unmap_all();
+    this->board->cov.clear_banks();
     this->on = false;
+    this->update_buffers();
+}
+
+//------------------------------------------------------------------------------
+void
+kc85::update_buffers() {
+    if (this->on && !this->ram) {
+        // RAM, video memory and the RGBA8 buffer live in one chunk
+        ubyte* ptr = (ubyte*) YAKC_MALLOC(this->funcs, ram_size + kc85_video::irm_size + kc85_video::rgba8_buffer_size);
+        this->ram = (ubyte(*)[0x4000]) ptr;
+        this->video.irm = (ubyte(*)[0x4000]) (ptr + ram_size);
+        this->video.rgba8_buffer = (unsigned int*) (ptr + ram_size + kc85_video::irm_size);
+        clear(this->video.rgba8_buffer, kc85_video::rgba8_buffer_size);
+    }
+    else if (!this->on && this->ram) {
+        YAKC_FREE(this->funcs, this->ram);
+        this->ram = nullptr;
+        this->video.irm = nullptr;
+        this->video.rgba8_buffer = nullptr;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -166,13 +206,18 @@ kc85::update_rom_pointers() {
 //------------------------------------------------------------------------------
 void
 kc85::onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, uint64_t max_cycle_count) {
-    // FIXME: the speed multiplier isn't currently working because of the min/max cycle count limiter!
     YAKC_ASSERT(speed_multiplier > 0);
     this->cpu_ahead = false;
     this->cpu_behind = false;
     this->handle_keyboard_input();
     z80& cpu = this->board->cpu;
     z80dbg& dbg = this->board->dbg;
+    tracer& trace = this->board->trace;
+    profiler& prof = this->board->prof;
+    callgraph& calls = this->board->calls;
+    opstats& ops = this->board->ops;
+    frametimes& times = this->board->times;
+    coverage& cov = this->board->cov;
     z80ctc& ctc = this->board->ctc;
     clock& clk = this->board->clck;
 
@@ -192,20 +237,49 @@ kc85::onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, ui
             this->cpu_behind = true;
         }
 
+        this->end_cycle_count = abs_end_cycles;
+        dbg.begin_run(cpu);
+        calls.begin_run(cpu);
+        ops.begin_run(cpu);
+        cov.begin_run(cpu);
+        times.begin(frametimes::cpu);
         while (this->abs_cycle_count < abs_end_cycles) {
-            if (dbg.check_break(cpu)) {
+            if (dbg.check_break(cpu, this->abs_cycle_count)) {
                 dbg.paused = true;
                 this->overflow_cycles = 0;
                 break;
             }
             dbg.store_pc_history(cpu); // FIXME: only if debug window open?
+            if (trace.enabled) {
+                trace.record(cpu, this->abs_cycle_count);
+            }
+            const uword pc = cpu.PC;
             int cycles_step = cpu.step();
+            if (prof.enabled) {
+                prof.record(cpu.mem, pc, cycles_step);
+            }
+            if (calls.enabled) {
+                calls.record(cpu, pc, cycles_step);
+            }
             cycles_step += cpu.handle_irq();
+            const bool timed = times.sample(frametimes::clocks);
+            if (timed) {
+                times.begin(frametimes::clocks);
+            }
             clk.update(this, cycles_step);
             ctc.update_timers(this, cycles_step);
+            if (timed) {
+                times.end();
+            }
             this->audio.update_cycles(this->abs_cycle_count);
             this->abs_cycle_count += cycles_step;
         }
+        times.end();
+        dbg.end_run(cpu);
+        calls.end_run(cpu);
+        ops.end_run(cpu);
+        cov.end_run(cpu);
+        this->end_cycle_count = 0;
         this->overflow_cycles = uint32_t(this->abs_cycle_count - abs_end_cycles);
     }
 }
@@ -371,7 +445,9 @@ kc85::cpu_in(uword port) {
 void
 kc85::ctc_write(int ctc_id, int chn_id) {
     if (chn_id < 2) {
+        this->board->times.begin(frametimes::audio);
         this->audio.ctc_write(chn_id);
+        this->board->times.end();
     }
 }
 
@@ -399,8 +475,33 @@ kc85::pio_out(int pio_id, int port_id, ubyte val) {
     else {
         this->pio_b = val;
         this->video.pio_blink_enable(0 != (val & PIO_B_BLINK_ENABLED));
+        this->board->times.begin(frametimes::audio);
         this->audio.update_volume(val & PIO_B_VOLUME_MASK);
+        this->board->times.end();
+    }
+}
+
+//------------------------------------------------------------------------------
+int
+kc85::block_cycles(uword pc) {
+    // block instructions only run in bulk inside onframe(), and must
+    // stop at breakpoints and watchpoints like when single-stepping, the
+    // memory access counters and the coverage also need each single access
+    if ((0 == this->end_cycle_count) ||
+        this->board->dbg.single_step_block(pc) ||
+        this->board->cpu.mem.instrumented()) {
+        return 0;
+    }
+    int64_t cycles = this->end_cycle_count - this->abs_cycle_count;
+    const int clk_cycles = this->board->clck.cycles_to_next_timer();
+    if (clk_cycles < cycles) {
+        cycles = clk_cycles;
+    }
+    const int ctc_cycles = this->board->ctc.ticks_to_next_timer();
+    if (ctc_cycles < cycles) {
+        cycles = ctc_cycles;
     }
+    return int(cycles);
 }
 
 //------------------------------------------------------------------------------
@@ -422,7 +523,9 @@ kc85::timer(int timer_id) {
         case 1:
             // timer 1 triggers every PAL line (64ns) for the video scanline
             // decoder callback
+            this->board->times.begin(frametimes::video);
             this->video.pal_line();
+            this->board->times.end();
             break;
     }
 }
@@ -431,6 +534,7 @@ kc85::timer(int timer_id) {
 void
 kc85::update_bank_switching() {
     z80& cpu = this->board->cpu;
+    this->board->times.begin(frametimes::banks);
     cpu.mem.unmap_layer(0);
 
     if ((device::kc85_2 == this->cur_model) || (device::kc85_3 == this->cur_model)) {
@@ -502,6 +606,7 @@ kc85::update_bank_switching() {
 
     // map modules in base-device expansion slots
     this->exp.update_memory_mappings(cpu.mem);
+    this->board->times.end();
 }
 
 //------------------------------------------------------------------------------
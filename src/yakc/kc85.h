@@ -16,8 +16,12 @@ namespace YAKC {
 
 class kc85 : public z80bus {
 public:
-    /// ram banks
-    ubyte ram[4][0x4000];
+    /// ram banks (allocated at power-on)
+    ubyte (*ram)[0x4000] = nullptr;
+    /// size of all ram banks in bytes
+    static const int ram_size = 4 * 0x4000;
+    /// memory allocation functions for RAM, video memory and ROMs
+    ext_funcs funcs;
 
     /// IO bits
     enum {
@@ -60,12 +64,14 @@ public:
     ubyte io86 = 0;         // special KC85/4 io register
 
     /// one-time init
-    void init(breadboard* board);
+    void init(breadboard* board, const ext_funcs& funcs);
 
     /// power-on the device
     void poweron(device m, os_rom os);
     /// power-off the device
     void poweroff();
+    /// allocate or free the RAM and video buffers to match the power state (called from poweron/poweroff or snapshot restore)
+    void update_buffers();
     /// reset the device
     void reset();
     /// get the KC model
@@ -100,6 +106,8 @@ public:
     virtual void irq() override;
     /// clock timer-trigger callback
     virtual void timer(int timer_id) override;
+    /// bulk block instruction callback
+    virtual int block_cycles(uword pc) override;
 
     /// update module/memory mapping
     void update_bank_switching();
@@ -113,6 +121,7 @@ public:
     bool cpu_behind = false;                // cpu would have been behind of min_cycle_count
     uint64_t abs_cycle_count = 0;           // total CPU cycle count
     uint32_t overflow_cycles = 0;           // cycles that have overflowed from last frame
+    uint64_t end_cycle_count = 0;           // end of the current onframe() run, 0 outside onframe()
     ubyte key_code = 0;
     const ubyte* caos_c_ptr = nullptr;
     int caos_c_size = 0;
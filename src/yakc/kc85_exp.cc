@@ -5,6 +5,17 @@
 
 namespace YAKC {
 
+//------------------------------------------------------------------------------
+kc85_exp::~kc85_exp() {
+    for (auto& slot : this->slots) {
+        if (slot.mod.mem_owned && slot.mod.mem_ptr) {
+            YAKC_FREE(this->funcs, slot.mod.mem_ptr);
+            slot.mod.mem_ptr = nullptr;
+        }
+    }
+    this->release_pool();
+}
+
 //------------------------------------------------------------------------------
 void
 kc85_exp::init() {
@@ -177,7 +188,7 @@ kc85_exp::insert_module(ubyte slot_addr, module_type type) {
     slot.mod = this->registry[type];
     if (slot.mod.mem_owned && slot.mod.mem_size > 0) {
         YAKC_ASSERT(nullptr == slot.mod.mem_ptr);
-        slot.mod.mem_ptr = (ubyte*) YAKC_MALLOC(slot.mod.mem_size);
+        slot.mod.mem_ptr = this->alloc_module_mem(slot.mod.mem_size);
         clear(slot.mod.mem_ptr, slot.mod.mem_size);
     }
 }
@@ -187,10 +198,12 @@ void
 kc85_exp::remove_module(ubyte slot_addr, memory& mem) {
     YAKC_ASSERT(this->slot_occupied(slot_addr));
     mem.unmap_layer(this->memory_layer_by_slot_addr(slot_addr));
+    // the module memory is cleared when it's handed out again
+    mem.untrack();
     auto& slot = this->slot_by_addr(slot_addr);
     slot.addr = 0x0000;
     if (slot.mod.mem_owned && slot.mod.mem_ptr) {
-        YAKC_FREE(slot.mod.mem_ptr);
+        this->free_module_mem(slot.mod.mem_ptr, slot.mod.mem_size);
         slot.mod.mem_ptr = 0;
     }
     slot.mod = module();
@@ -240,4 +253,63 @@ kc85_exp::update_memory_mappings(memory& mem) {
     }
 }
 
+//------------------------------------------------------------------------------
+unsigned int
+kc85_exp::block_size(unsigned int mem_size) {
+    if (mem_size <= 0x4000) {
+        return 0x4000;
+    }
+    else if (mem_size <= 0x10000) {
+        return 0x10000;
+    }
+    else {
+        return mem_size;
+    }
+}
+
+//------------------------------------------------------------------------------
+ubyte*
+kc85_exp::alloc_module_mem(unsigned int mem_size) {
+    const unsigned int size = block_size(mem_size);
+    for (int i = 0; i < this->num_pool; i++) {
+        if (this->pool[i].size == size) {
+            ubyte* ptr = this->pool[i].ptr;
+            this->pool[i] = this->pool[--this->num_pool];
+            this->pool[this->num_pool] = pool_block();
+            return ptr;
+        }
+    }
+    return (ubyte*) YAKC_MALLOC(this->funcs, size);
+}
+
+//------------------------------------------------------------------------------
+void
+kc85_exp::free_module_mem(ubyte* ptr, unsigned int mem_size) {
+    YAKC_ASSERT(ptr);
+    if (this->num_pool < max_pool_blocks) {
+        pool_block& block = this->pool[this->num_pool++];
+        block.ptr = ptr;
+        block.size = block_size(mem_size);
+    }
+    else {
+        YAKC_FREE(this->funcs, ptr);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+kc85_exp::release_pool() {
+    for (int i = 0; i < this->num_pool; i++) {
+        YAKC_FREE(this->funcs, this->pool[i].ptr);
+        this->pool[i] = pool_block();
+    }
+    this->num_pool = 0;
+}
+
+//------------------------------------------------------------------------------
+int
+kc85_exp::num_pooled_blocks() const {
+    return this->num_pool;
+}
+
 } // namespace YAKC
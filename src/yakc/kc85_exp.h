@@ -3,6 +3,11 @@
 /**
     @class YAKC::kc85_exp
     @brief emulate the KC85 expansion slot system
+
+    RAM module memory is allocated in 16 or 64 KByte blocks. Blocks of
+    removed modules are kept in a small per-instance pool and handed out
+    again on the next insert, so that module swaps and snapshot restores
+    don't go through the memory allocation functions each time.
 */
 #include "yakc/core.h"
 #include "yakc/memory.h"
@@ -44,6 +49,16 @@ public:
         ubyte control_byte = 0;
     };
 
+    /// memory allocation functions for module RAM
+    ext_funcs funcs;
+
+    /// default constructor
+    kc85_exp() = default;
+    /// destructor, frees module memory and pooled blocks
+    ~kc85_exp();
+    /// not copyable, the module memory and pooled blocks are owned
+    kc85_exp(const kc85_exp&) = delete;
+    kc85_exp& operator=(const kc85_exp&) = delete;
     /// initialize the expansion system
     void init();
     /// reset the expansion system
@@ -89,10 +104,30 @@ public:
 
     /// convert a slot address to a memory layer
     int memory_layer_by_slot_addr(ubyte slot_addr) const;
+    /// free all pooled module memory blocks
+    void release_pool();
+    /// number of module memory blocks currently in the pool
+    int num_pooled_blocks() const;
 
     module registry[num_module_types];
     static const int num_slots = 2;
     module_slot slots[num_slots];
+
+private:
+    /// get block size for a module memory size (16 or 64 KByte)
+    static unsigned int block_size(unsigned int mem_size);
+    /// get module memory from the pool, or allocate a new block
+    ubyte* alloc_module_mem(unsigned int mem_size);
+    /// return module memory to the pool, or free it if the pool is full
+    void free_module_mem(ubyte* ptr, unsigned int mem_size);
+
+    struct pool_block {
+        ubyte* ptr = nullptr;
+        unsigned int size = 0;
+    };
+    static const int max_pool_blocks = 2 * num_slots;
+    pool_block pool[max_pool_blocks];
+    int num_pool = 0;
 };
 
 } // namespace YAKC
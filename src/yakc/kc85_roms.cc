@@ -5,31 +5,40 @@
 
 namespace YAKC {
 
+//------------------------------------------------------------------------------
+kc85_roms::~kc85_roms() {
+    for (auto& item : this->roms) {
+        if (item.ptr) {
+            YAKC_FREE(this->funcs, item.ptr);
+            item.ptr = nullptr;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 void
 kc85_roms::add(rom type, const ubyte* ptr, int size) {
     YAKC_ASSERT((type >= 0) && (type < num_roms));
     YAKC_ASSERT(!this->has(type));
-    YAKC_ASSERT((cur_pos + size) <= buf_size);
+    YAKC_ASSERT(size > 0);
 
-    memcpy(&this->buffer[cur_pos], ptr, size);
-    this->roms[type].pos = this->cur_pos;
+    this->roms[type].ptr = (ubyte*) YAKC_MALLOC(this->funcs, size);
+    memcpy(this->roms[type].ptr, ptr, size);
     this->roms[type].size = size;
-    this->cur_pos += size;
 }
 
 //------------------------------------------------------------------------------
 bool
 kc85_roms::has(rom type) const {
     YAKC_ASSERT((type >= 0) && (type < num_roms));
-    return -1 != this->roms[type].pos;
+    return nullptr != this->roms[type].ptr;
 }
 
 //------------------------------------------------------------------------------
 const ubyte*
 kc85_roms::ptr(rom type) const {
     YAKC_ASSERT(this->has(type));
-    return &this->buffer[this->roms[type].pos];
+    return this->roms[type].ptr;
 }
 
 //------------------------------------------------------------------------------
@@ -29,7 +29,12 @@ public:
         num_roms
     };
 
-    /// add a ROM blob
+    /// memory allocation functions for the ROM copies
+    ext_funcs funcs;
+
+    /// destructor
+    ~kc85_roms();
+    /// add a ROM blob (the data is copied)
     void add(rom type, const ubyte* ptr, int size);
     /// test if a ROM blob had been added
     bool has(rom type) const;
@@ -40,14 +45,10 @@ public:
 
 private:
     struct item {
-        item() : pos(-1), size(0) { };
-        int pos;
+        item() : ptr(nullptr), size(0) { };
+        ubyte* ptr;
         int size;
     } roms[num_roms];
-
-    static const int buf_size = 256 * 1024;
-    int cur_pos = 0;
-    ubyte buffer[buf_size];
 };
 
 } // namespace YAKC
@@ -10,12 +10,15 @@ void
 kc85_video::init(device m) {
     this->model = m;
     this->irm_control = 0;
+    this->pio_blink_flag = true;
+    this->ctc_blink_flag = true;
+    this->cur_pal_line = 0;
 
     if (m == device::kc85_4) {
-        clear(this->irm, sizeof(this->irm));
+        clear(this->irm, irm_size);
     }
     else {
-        fill_random(this->irm, sizeof(this->irm));
+        fill_random(this->irm, irm_size);
     }
 
     // setup foreground color palette
@@ -10,8 +10,10 @@ namespace YAKC {
 
 class kc85_video {
 public:
-    /// video memory banks
-    ubyte irm[4][0x4000];
+    /// video memory banks (allocated by kc85 at power-on)
+    ubyte (*irm)[0x4000] = nullptr;
+    /// size of all video memory banks in bytes
+    static const int irm_size = 4 * 0x4000;
 
     /// initialize the video hardware
     void init(device m);
@@ -32,8 +34,10 @@ public:
     /// decode the next line
     void decode_one_line(unsigned int* ptr, int y, bool blink_bg);
 
-    /// decoded linear RGBA8 video buffer
-    unsigned int rgba8_buffer[320*256];
+    /// decoded linear RGBA8 video buffer (allocated by kc85 at power-on)
+    unsigned int* rgba8_buffer = nullptr;
+    /// size of the RGBA8 video buffer in bytes
+    static const int rgba8_buffer_size = 320 * 256 * sizeof(unsigned int);
 
     device model = device::kc85_3;
     ubyte irm_control = 0;
@@ -2,6 +2,7 @@
 //  memory.cc
 //------------------------------------------------------------------------------
 #include "memory.h"
+#include "yakc/coverage.h"
 
 namespace YAKC {
 
@@ -68,6 +69,8 @@ memory::unmap_all() {
             p = page();
         }
     }
+    this->num_shared_ranges = 0;
+    this->num_tracked_ranges = 0;
     this->update_mapping();
 }
 
@@ -87,26 +90,388 @@ memory::update_mapping() {
         // set the CPU-visible mapping
         if (layer_index != num_layers) {
             // a valid mapping exists for this page
-            this->pages[page_index] = this->layers[layer_index][page_index];
+            page& p = this->pages[page_index];
+            p = this->layers[layer_index][page_index];
+            if ((this->num_shared_ranges > 0) && p.writable) {
+                const ubyte* src = this->shared_src(p.ptr);
+                if (src) {
+                    // a copy-on-write page, read from the source until first written
+                    p.ptr = (ubyte*) src;
+                    p.writable = false;
+                }
+            }
+            if ((this->num_tracked_ranges > 0) && p.writable && this->clean_page(p.ptr)) {
+                // a clean tracked page, read-only until first written
+                p.writable = false;
+            }
         }
         else {
             // no mapping exists, set to the special 'unmapped page'
             this->pages[page_index].ptr = this->unmapped_page;
             this->pages[page_index].writable = false;
         }
+        // trapped pages, write-trapped pages are mapped read-only
+        page& p = this->pages[page_index];
+        const uint64_t bit = uint64_t(1)<<page_index;
+        p.read_trap = this->instrumented() || (0 != (this->read_trap_pages & bit));
+        p.write_trap = this->instrumented() || (0 != (this->write_trap_pages & bit));
+        if (p.write_trap) {
+            p.writable = false;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+memory::set_traps(uint64_t read_pages, uint64_t write_pages, trap_func func, void* userdata) {
+    YAKC_ASSERT(func || ((0 == read_pages) && (0 == write_pages)));
+    this->trap_fn = func;
+    this->trap_userdata = userdata;
+    if ((read_pages != this->read_trap_pages) || (write_pages != this->write_trap_pages)) {
+        this->read_trap_pages = read_pages;
+        this->write_trap_pages = write_pages;
+        this->update_mapping();
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+memory::set_counting(bool b) {
+    if (b != this->counting) {
+        this->counting = b;
+        this->update_mapping();
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+memory::clear_counters() {
+    for (auto& c : this->counters) {
+        c = page_counters();
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+memory::set_coverage(coverage* c) {
+    if (c != this->cov) {
+        this->cov = c;
+        this->update_mapping();
+    }
+}
+
+//------------------------------------------------------------------------------
+const ubyte*
+memory::layer_ptr(uword addr) const {
+    // the CPU-visible page pointer might point to a copy-on-write source
+    const int layer_index = this->layer(addr);
+    if (layer_index < 0) {
+        return nullptr;
+    }
+    return this->layers[layer_index][addr>>page::shift].ptr + (addr & page::mask);
+}
+
+//------------------------------------------------------------------------------
+void
+memory::trapped_read(uword addr, bool fetch) const {
+    const int page_index = addr>>page::shift;
+    memory* self = const_cast<memory*>(this);
+    if (this->counting) {
+        page_counters& c = self->counters[page_index];
+        if (fetch) {
+            c.execs++;
+        }
+        else {
+            c.reads++;
+        }
+    }
+    if (this->cov) {
+        // operands directly following an opcode fetch count as executed
+        const bool exec = fetch || (addr == this->fetch_next);
+        if (exec) {
+            self->fetch_next = addr + 1;
+        }
+        const ubyte* ptr = this->layer_ptr(addr);
+        if (ptr) {
+            this->cov->mark(ptr, exec ? coverage::exec : coverage::read);
+        }
+    }
+    if (this->trap_fn && (this->read_trap_pages & (uint64_t(1)<<page_index))) {
+        this->trap_fn(this->trap_userdata, addr, false);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+memory::trapped_write(uword addr, ubyte b) {
+    const int page_index = addr>>page::shift;
+    if (this->counting) {
+        this->counters[page_index].writes++;
+    }
+    if (this->cov) {
+        const ubyte* ptr = this->layer_ptr(addr);
+        if (ptr) {
+            this->cov->mark(ptr, coverage::write);
+        }
+    }
+    if (this->trap_fn && (this->write_trap_pages & (uint64_t(1)<<page_index))) {
+        this->trap_fn(this->trap_userdata, addr, true);
+    }
+    // the write-trapped page is mapped read-only, write through
+    // the actual mapping, and unshare a copy-on-write page first
+    const int layer_index = this->layer(addr);
+    if ((layer_index >= 0) && this->layers[layer_index][addr>>page::shift].writable) {
+        if ((this->num_shared_ranges > 0) || (this->num_tracked_ranges > 0)) {
+            this->make_writable(addr);
+        }
+        this->pages[addr>>page::shift].ptr[addr & page::mask] = b;
     }
 }
 
 //------------------------------------------------------------------------------
 int
 memory::layer(uword addr) const {
+    // NOTE: don't compare against the CPU-visible page pointer, since
+    // this may point to the source of a copy-on-write page
     const int page_index = addr>>page::shift;
     for (int layer_index = 0; layer_index < num_layers; layer_index++) {
-        if (this->pages[page_index].ptr == this->layers[layer_index][page_index].ptr) {
+        if (this->layers[layer_index][page_index].ptr) {
             return layer_index;
         }
     }
     return -1;
 }
 
+//------------------------------------------------------------------------------
+void
+memory::share(ubyte* ptr, const ubyte* src, unsigned int size) {
+    YAKC_ASSERT(ptr && src);
+    YAKC_ASSERT((size & page::mask) == 0);
+    YAKC_ASSERT((size > 0) && (size <= max_shared_size));
+    YAKC_ASSERT(this->num_shared_ranges < max_shared_ranges);
+    shared_range& r = this->shared_ranges[this->num_shared_ranges++];
+    r.ptr = ptr;
+    r.src = src;
+    r.num_pages = size>>page::shift;
+    r.shared_mask = (r.num_pages == 64) ? ~uint64_t(0) : ((uint64_t(1)<<r.num_pages) - 1);
+    this->update_mapping();
+}
+
+//------------------------------------------------------------------------------
+void
+memory::unshare() {
+    if (this->num_shared_ranges > 0) {
+        for (int i = 0; i < this->num_shared_ranges; i++) {
+            const shared_range& r = this->shared_ranges[i];
+            for (int p = 0; p < r.num_pages; p++) {
+                if (r.shared_mask & (uint64_t(1)<<p)) {
+                    memcpy(r.ptr + p*page::size, r.src + p*page::size, page::size);
+                }
+            }
+        }
+        this->drop_shared();
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+memory::drop_shared() {
+    for (auto& r : this->shared_ranges) {
+        r = shared_range();
+    }
+    this->num_shared_ranges = 0;
+    this->update_mapping();
+}
+
+//------------------------------------------------------------------------------
+int
+memory::num_shared_pages() const {
+    int num = 0;
+    for (int i = 0; i < this->num_shared_ranges; i++) {
+        for (uint64_t mask = this->shared_ranges[i].shared_mask; mask; mask >>= 1) {
+            num += int(mask & 1);
+        }
+    }
+    return num;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+memory::shared_pages(const ubyte* ptr, const ubyte* src) const {
+    for (int i = 0; i < this->num_shared_ranges; i++) {
+        const shared_range& r = this->shared_ranges[i];
+        if ((r.ptr == ptr) && (r.src == src)) {
+            return r.shared_mask;
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+const ubyte*
+memory::shared_src(const ubyte* ptr) const {
+    for (int i = 0; i < this->num_shared_ranges; i++) {
+        const shared_range& r = this->shared_ranges[i];
+        if ((ptr >= r.ptr) && (ptr < (r.ptr + r.num_pages*page::size))) {
+            const int offset = int(ptr - r.ptr);
+            YAKC_ASSERT((offset & page::mask) == 0);
+            if (r.shared_mask & (uint64_t(1)<<(offset>>page::shift))) {
+                return r.src + offset;
+            }
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+bool
+memory::unshare_page(const ubyte* ptr) {
+    for (int i = 0; i < this->num_shared_ranges; i++) {
+        shared_range& r = this->shared_ranges[i];
+        if ((ptr >= r.ptr) && (ptr < (r.ptr + r.num_pages*page::size))) {
+            const int page_index = int(ptr - r.ptr) >> page::shift;
+            const uint64_t bit = uint64_t(1)<<page_index;
+            if (0 == (r.shared_mask & bit)) {
+                return false;
+            }
+            memcpy(r.ptr + page_index*page::size, r.src + page_index*page::size, page::size);
+            r.shared_mask &= ~bit;
+            if (0 == r.shared_mask) {
+                // range completely unshared, remove it
+                r = this->shared_ranges[--this->num_shared_ranges];
+                this->shared_ranges[this->num_shared_ranges] = shared_range();
+            }
+            this->update_mapping();
+            return true;
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+bool
+memory::make_writable(uword addr) {
+    const int page_index = addr>>page::shift;
+    for (int layer_index = 0; layer_index < num_layers; layer_index++) {
+        const page& p = this->layers[layer_index][page_index];
+        if (p.ptr) {
+            if (p.writable) {
+                // mark dirty first, so that the mapping update after
+                // unsharing doesn't map the page read-only again
+                this->mark_dirty(p.ptr);
+                this->unshare_page(p.ptr);
+            }
+            return p.writable;
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+const ubyte*
+memory::page_content(const ubyte* ptr) const {
+    const ubyte* src = this->shared_src(ptr);
+    return src ? src : ptr;
+}
+
+//------------------------------------------------------------------------------
+void
+memory::track(const ubyte* ptr, unsigned int size) {
+    YAKC_ASSERT(ptr);
+    YAKC_ASSERT((size & page::mask) == 0);
+    YAKC_ASSERT(size > 0);
+    const int num = size>>page::shift;
+    const uint64_t all_pages = (num >= 64) ? ~uint64_t(0) : ((uint64_t(1)<<num) - 1);
+    for (int i = 0; i < this->num_tracked_ranges; i++) {
+        tracked_range& r = this->tracked_ranges[i];
+        if (r.ptr == ptr) {
+            if (r.num_pages != num) {
+                r.num_pages = num;
+                r.dirty_mask = all_pages;
+            }
+            return;
+        }
+    }
+    // a range which can't be tracked is reported as all dirty
+    if ((size <= max_tracked_size) && (this->num_tracked_ranges < max_tracked_ranges)) {
+        // all pages start dirty (thus writable), so the mapping doesn't change
+        tracked_range& r = this->tracked_ranges[this->num_tracked_ranges++];
+        r.ptr = ptr;
+        r.num_pages = num;
+        r.dirty_mask = all_pages;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+memory::untrack() {
+    if (this->num_tracked_ranges > 0) {
+        this->num_tracked_ranges = 0;
+        this->update_mapping();
+    }
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+memory::dirty_pages(const ubyte* ptr, unsigned int size) const {
+    const int num = size>>page::shift;
+    for (int i = 0; i < this->num_tracked_ranges; i++) {
+        const tracked_range& r = this->tracked_ranges[i];
+        if ((r.ptr == ptr) && (r.num_pages == num)) {
+            return r.dirty_mask;
+        }
+    }
+    return (num >= 64) ? ~uint64_t(0) : ((uint64_t(1)<<num) - 1);
+}
+
+//------------------------------------------------------------------------------
+void
+memory::clear_dirty() {
+    if (this->num_tracked_ranges > 0) {
+        for (int i = 0; i < this->num_tracked_ranges; i++) {
+            this->tracked_ranges[i].dirty_mask = 0;
+        }
+        this->update_mapping();
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+memory::clean_page(const ubyte* ptr) const {
+    for (int i = 0; i < this->num_tracked_ranges; i++) {
+        const tracked_range& r = this->tracked_ranges[i];
+        if ((ptr >= r.ptr) && (ptr < (r.ptr + r.num_pages*page::size))) {
+            return 0 == (r.dirty_mask & (uint64_t(1)<<((ptr - r.ptr)>>page::shift)));
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+bool
+memory::mark_dirty(const ubyte* ptr) {
+    for (int i = 0; i < this->num_tracked_ranges; i++) {
+        tracked_range& r = this->tracked_ranges[i];
+        if ((ptr >= r.ptr) && (ptr < (r.ptr + r.num_pages*page::size))) {
+            const uint64_t bit = uint64_t(1)<<((ptr - r.ptr)>>page::shift);
+            if (r.dirty_mask & bit) {
+                return false;
+            }
+            r.dirty_mask |= bit;
+            // this happens on the first write to a page in each frame, so
+            // only update the CPU-visible pages of this host memory page
+            // instead of calling update_mapping()
+            for (int page_index = 0; page_index < num_pages; page_index++) {
+                page& p = this->pages[page_index];
+                if ((p.ptr == ptr) && !p.write_trap) {
+                    p.writable = this->layers[this->layer(page_index<<page::shift)][page_index].writable;
+                }
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
 } // namespace YAKC
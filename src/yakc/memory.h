@@ -31,11 +31,38 @@
     and a 16 KByte part of the 64 KByte expansion module is visible at
     the hole 4000-7FFF. 3/4 of the 64KByte expansion memory remains
     culled and is not visible to the CPU.
+
+    Mapped host memory can also be shared copy-on-write with a
+    read-only source (see the forkpoint class): the CPU will read the
+    pages of a shared range from the source, and only on the first
+    write to a page, the page content is copied from the source into
+    the mapped host memory. The pages of a shared range are mapped
+    as read-only, so the fast path of memory writes is unaffected.
+
+    Writes to host memory ranges can be tracked per page (used by the
+    rewinder to find the pages which changed since the previous frame):
+    a clean page of a tracked range is mapped read-only, the first write
+    goes through the slow path, marks the page as dirty and makes it
+    writable again. Host memory written around the memory class (e.g.
+    applying a snapshot) must stop the tracking with untrack().
+
+    Reads and writes of single pages can be trapped (used for debugger
+    watchpoints): a trap callback is called before each access to a
+    trapped page. Write-trapped pages are mapped as read-only, so that
+    writes to other pages stay on the fast path.
+
+    Optionally, reads, writes and opcode fetches (see x8()) can be
+    counted per CPU-visible page. This uses the same slow path as the
+    traps (all pages are trapped and mapped read-only while counting),
+    so there is no overhead when counting is off. The same slow path
+    records the execution coverage (see the coverage class).
 */
 #include "yakc/core.h"
 
 namespace YAKC {
 
+class coverage;
+
 class memory {
 public:
     /// 64 kByte addressable memory
@@ -49,6 +76,8 @@ public:
         static const uword mask = size - 1;
         ubyte* ptr = nullptr;
         bool writable = false;
+        bool read_trap = false;
+        bool write_trap = false;
     };
     /// number of pages
     static const int num_pages = addr_range / page::size;
@@ -63,6 +92,60 @@ public:
     /// a dummy page for currently unmapped memory
     ubyte unmapped_page[page::size];
 
+    /// a host memory range shared copy-on-write with a source range
+    struct shared_range {
+        ubyte* ptr = nullptr;           // the mapped host memory
+        const ubyte* src = nullptr;     // the shared source memory
+        int num_pages = 0;
+        uint64_t shared_mask = 0;       // one bit per page still shared
+    };
+    /// max number of copy-on-write ranges
+    static const int max_shared_ranges = 8;
+    /// max size of a copy-on-write range
+    static const int max_shared_size = 64 * page::size;
+    /// copy-on-write ranges
+    shared_range shared_ranges[max_shared_ranges];
+    /// number of valid copy-on-write ranges
+    int num_shared_ranges = 0;
+
+    /// a host memory range with dirty page tracking
+    struct tracked_range {
+        const ubyte* ptr = nullptr;
+        int num_pages = 0;
+        uint64_t dirty_mask = 0;        // one bit per page written since clear_dirty()
+    };
+    /// max number of tracked ranges
+    static const int max_tracked_ranges = 16;
+    /// max size of a tracked range
+    static const int max_tracked_size = 64 * page::size;
+    /// tracked ranges
+    tracked_range tracked_ranges[max_tracked_ranges];
+    /// number of valid tracked ranges
+    int num_tracked_ranges = 0;
+
+    /// memory access trap callback
+    typedef void (*trap_func)(void* userdata, uword addr, bool write);
+    /// pages with trapped reads, one bit per page
+    uint64_t read_trap_pages = 0;
+    /// pages with trapped writes, one bit per page
+    uint64_t write_trap_pages = 0;
+    /// the trap callback and its userdata
+    trap_func trap_fn = nullptr;
+    void* trap_userdata = nullptr;
+
+    /// access counters of a CPU-visible page
+    struct page_counters {
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+        uint64_t execs = 0;
+    };
+    /// access counters per page (only updated while counting)
+    page_counters counters[num_pages];
+    /// true while counting accesses (see set_counting())
+    bool counting = false;
+    /// the installed execution coverage, or nullptr (see set_coverage())
+    coverage* cov = nullptr;
+
     /// constructor
     memory();
     /// map a range of memory
@@ -71,8 +154,38 @@ public:
     void unmap(int layer, uword addr, unsigned int size);
     /// unmap all memory pages in a mapping layer
     void unmap_layer(int layer);
-    /// unmap all memory pages
+    /// unmap all memory pages (also ends copy-on-write sharing and write tracking)
     void unmap_all();
+    /// share a range of host memory copy-on-write with a read-only source
+    void share(ubyte* ptr, const ubyte* src, unsigned int size);
+    /// copy all still shared pages into host memory and end sharing
+    void unshare();
+    /// end sharing without copying, content of still shared pages is undefined
+    void drop_shared();
+    /// get number of pages which are still shared
+    int num_shared_pages() const;
+    /// get the still shared pages (one bit per page) of a host memory range shared with a source, 0 if none
+    uint64_t shared_pages(const ubyte* ptr, const ubyte* src) const;
+    /// get the current content of a host memory page, which may still be shared with a copy-on-write source
+    const ubyte* page_content(const ubyte* ptr) const;
+    /// start tracking writes to a host memory range, a new range starts with all pages dirty
+    void track(const ubyte* ptr, unsigned int size);
+    /// stop tracking writes to all host memory ranges
+    void untrack();
+    /// get the pages (one bit per page) of a host memory range written since clear_dirty(), all pages if not tracked
+    uint64_t dirty_pages(const ubyte* ptr, unsigned int size) const;
+    /// mark all pages of the tracked ranges as clean
+    void clear_dirty();
+    /// trap reads and writes of pages (one bit per page), all-zero masks remove the traps
+    void set_traps(uint64_t read_pages, uint64_t write_pages, trap_func func, void* userdata);
+    /// start or stop counting accesses per page
+    void set_counting(bool b);
+    /// reset the access counters
+    void clear_counters();
+    /// true if all accesses must go through the slow path (no bulk block instructions)
+    bool instrumented() const;
+    /// install or remove (nullptr) the execution coverage
+    void set_coverage(coverage* c);
     /// get the layer index a memory page is mapped to, -1 if unmapped
     int layer(uword addr) const;
     /// map a Z80 address to host memory pointer (read/write)
@@ -84,22 +197,43 @@ public:
     bool is_writable(uword addr) const;
     /// read a byte at cpu address
     ubyte r8(uword addr) const;
+    /// read an opcode byte at cpu address (counted as execute)
+    ubyte x8(uword addr) const;
     /// read a signed byte at cpu address
     byte rs8(uword addr) const;
     /// write a byte to cpu address
-    void w8(uword addr, ubyte b) const;
+    void w8(uword addr, ubyte b);
     /// read/write access to byte
     ubyte& a8(uword addr);
     /// read a word at cpu address
     uword r16(uword addr) const;
     /// write a word to cpu address
-    void w16(uword addr, uword w) const;
+    void w16(uword addr, uword w);
     /// write a byte range
-    void write(uword addr, const ubyte* src, int num) const;
+    void write(uword addr, const ubyte* src, int num);
 
 private:
     /// update the CPU-visible mapping
     void update_mapping();
+    /// find the shared source page of a host memory page, or nullptr
+    const ubyte* shared_src(const ubyte* ptr) const;
+    /// copy a shared page into host memory, return false if not shared
+    bool unshare_page(const ubyte* ptr);
+    /// test if a host memory page is tracked and hasn't been written since clear_dirty()
+    bool clean_page(const ubyte* ptr) const;
+    /// mark a tracked host memory page as dirty, return false if not tracked or already dirty
+    bool mark_dirty(const ubyte* ptr);
+    /// unshare and mark dirty the page mapped at a CPU address before writing, return false if not writable
+    bool make_writable(uword addr);
+    /// count a read or opcode fetch and call the trap callback
+    void trapped_read(uword addr, bool fetch) const;
+    /// call the trap callback and perform a write to a write-trapped page
+    void trapped_write(uword addr, ubyte b);
+    /// get the host memory pointer of a CPU address from the mapping layers, or nullptr
+    const ubyte* layer_ptr(uword addr) const;
+
+    /// address after the last opcode or operand fetch, for the coverage
+    uword fetch_next = 0;
 };
 
 //------------------------------------------------------------------------------
@@ -114,6 +248,12 @@ memory::ptr(uword addr) const {
     return this->pages[addr>>page::shift].ptr;
 }
 
+//------------------------------------------------------------------------------
+inline bool
+memory::instrumented() const {
+    return this->counting || (nullptr != this->cov);
+}
+
 //------------------------------------------------------------------------------
 inline bool
 memory::is_writable(uword addr) const {
@@ -123,18 +263,35 @@ memory::is_writable(uword addr) const {
 //------------------------------------------------------------------------------
 inline ubyte
 memory::r8(uword addr) const {
-    return this->pages[addr>>page::shift].ptr[addr&page::mask];
+    const auto& page = this->pages[addr>>page::shift];
+    if (page.read_trap) {
+        this->trapped_read(addr, false);
+    }
+    return page.ptr[addr&page::mask];
+}
+
+//------------------------------------------------------------------------------
+inline ubyte
+memory::x8(uword addr) const {
+    const auto& page = this->pages[addr>>page::shift];
+    if (page.read_trap) {
+        this->trapped_read(addr, true);
+    }
+    return page.ptr[addr&page::mask];
 }
 
 //------------------------------------------------------------------------------
 inline byte
 memory::rs8(uword addr) const {
-    return (byte) this->pages[addr>>page::shift].ptr[addr&page::mask];
+    return (byte) this->r8(addr);
 }
 
 //------------------------------------------------------------------------------
 inline ubyte&
 memory::a8(uword addr) {
+    if (((this->num_shared_ranges > 0) || (this->num_tracked_ranges > 0)) && !this->pages[addr>>page::shift].writable) {
+        this->make_writable(addr);
+    }
     return this->pages[addr>>page::shift].ptr[addr&page::mask];
 }
 
@@ -149,23 +306,32 @@ memory::r16(uword addr) const {
 
 //------------------------------------------------------------------------------
 inline void
-memory::w8(uword addr, ubyte b) const {
+memory::w8(uword addr, ubyte b) {
     const auto& page = this->pages[addr>>page::shift];
     if (page.writable) {
         page.ptr[addr & page::mask] = b;
     }
+    else if (page.write_trap) {
+        this->trapped_write(addr, b);
+    }
+    else if ((this->num_shared_ranges > 0) || (this->num_tracked_ranges > 0)) {
+        // unsharing a copy-on-write page doesn't change the visible memory content
+        if (this->make_writable(addr)) {
+            this->pages[addr>>page::shift].ptr[addr & page::mask] = b;
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
 inline void
-memory::w16(uword addr, uword w) const {
+memory::w16(uword addr, uword w) {
     this->w8(addr, w & 0xFF);
     this->w8(addr + 1, (w>>8));
 }
 
 //------------------------------------------------------------------------------
 inline void
-memory::write(uword addr, const ubyte* src, int num) const {
+memory::write(uword addr, const ubyte* src, int num) {
     for (int i = 0; i < num; i++) {
         this->w8(addr++, src[i]);
     }
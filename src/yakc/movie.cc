@@ -0,0 +1,322 @@
+//------------------------------------------------------------------------------
+//  movie.cc
+//------------------------------------------------------------------------------
+#include "movie.h"
+#include <string.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+static bool
+read_all(snapshot::read_func read_fn, void* userdata, void* ptr, int num_bytes) {
+    ubyte* dst = (ubyte*) ptr;
+    while (num_bytes > 0) {
+        const int num_read = read_fn(userdata, dst, num_bytes);
+        if (0 == num_read) {
+            return false;
+        }
+        dst += num_read;
+        num_bytes -= num_read;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+movie::~movie() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+movie::discard() {
+    YAKC_ASSERT(!this->is_recording);
+    this->start.discard();
+    this->log.discard();
+    clear(&this->header, sizeof(this->header));
+    this->start_pending = false;
+    this->last_key = -1;
+    this->replay_cycle_count = 0;
+    this->cur_frame = 0;
+    this->desyncs = 0;
+}
+
+//------------------------------------------------------------------------------
+bool
+movie::valid() const {
+    return this->start.size > 0;
+}
+
+//------------------------------------------------------------------------------
+void
+movie::capture(yakc& emu) {
+    header_t& hdr = this->header;
+    hdr.magic = magic;
+    hdr.version = cur_version;
+    hdr.model = (uword) emu.model;
+    hdr.os = (uword) emu.os;
+    hdr.num_frames = 0;
+    hdr.start_cycle_count = emu.cycle_count();
+    hdr.start_overflow_cycles = eventlog::overflow_cycles(emu);
+    hdr.kc85_key_code = emu.kc85.key_code;
+    const keybuffer& kb = emu.z9001.keybuf;
+    hdr.z9001_keybuf_advance_count = kb.advance_count;
+    hdr.z9001_keybuf_write_pos = kb.write_pos;
+    hdr.z9001_keybuf_read_pos = kb.read_pos;
+    memcpy(hdr.z9001_keybuf, kb.buf, sizeof(hdr.z9001_keybuf));
+    snapshot::write_stream(emu, snapshot::membuf::write, &this->start);
+    hdr.start_size = this->start.size;
+    this->log.last_cycle_count = hdr.start_cycle_count;
+}
+
+//------------------------------------------------------------------------------
+void
+movie::start_recording(yakc& emu) {
+    YAKC_ASSERT(emu.switchedon() && !this->is_recording);
+    this->discard();
+    this->start.funcs = emu.funcs;
+    this->log.data.funcs = emu.funcs;
+    this->is_recording = true;
+    emu.movie_recorder = this;
+    if (emu.cycle_count() > 0) {
+        this->capture(emu);
+    }
+    else {
+        // just switched on, the first frame doesn't run from a
+        // defined cycle count, so start after the first frame
+        this->start_pending = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+movie::stop_recording(yakc& emu) {
+    YAKC_ASSERT(this->is_recording);
+    this->is_recording = false;
+    this->start_pending = false;
+    this->header.log_size = this->log.data.size;
+    if (emu.movie_recorder == this) {
+        emu.movie_recorder = nullptr;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+movie::recording() const {
+    return this->is_recording;
+}
+
+//------------------------------------------------------------------------------
+void
+movie::on_frame(yakc& emu) {
+    if (!this->is_recording) {
+        return;
+    }
+    if (this->start_pending) {
+        if (emu.cycle_count() > 0) {
+            this->start_pending = false;
+            this->capture(emu);
+        }
+        return;
+    }
+    this->log.write_frame(emu);
+    this->header.num_frames++;
+    this->header.log_size = this->log.data.size;
+}
+
+//------------------------------------------------------------------------------
+void
+movie::on_key(const yakc& emu, ubyte ascii) {
+    // the app calls put_key() each frame, only record changes
+    if (!this->is_recording || (ascii == this->last_key)) {
+        return;
+    }
+    this->last_key = ascii;
+    if (!this->start_pending) {
+        this->log.write_key(emu, ascii);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+movie::on_insert_module(const yakc& emu, ubyte slot_addr, kc85_exp::module_type type) {
+    if (this->is_recording && !this->start_pending) {
+        this->log.write_insert_module(emu, slot_addr, type);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+movie::on_remove_module(const yakc& emu, ubyte slot_addr) {
+    if (this->is_recording && !this->start_pending) {
+        this->log.write_remove_module(emu, slot_addr);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+movie::on_reset(const yakc& emu) {
+    if (this->is_recording) {
+        // reset clears the key buffers, so the next key must be recorded
+        this->last_key = -1;
+        if (!this->start_pending) {
+            this->log.write_reset(emu);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+movie::start_replay(yakc& emu) {
+    YAKC_ASSERT(this->valid() && !this->is_recording);
+    const header_t& hdr = this->header;
+    const device model = (device) hdr.model;
+    const os_rom os = (os_rom) hdr.os;
+    if (!emu.switchedon() || (emu.model != model) || (emu.os != os)) {
+        if (emu.switchedon()) {
+            emu.poweroff();
+        }
+        bootcache* boot_cache = emu.boot_cache;
+        emu.boot_cache = nullptr;
+        emu.poweron(model, os);
+        emu.boot_cache = boot_cache;
+    }
+    this->start.pos = 0;
+    if (!snapshot::read_stream(snapshot::membuf::read, &this->start, emu)) {
+        return false;
+    }
+    // state which isn't part of snapshots
+    if (emu.kc85.on) {
+        emu.kc85.abs_cycle_count = hdr.start_cycle_count;
+        emu.kc85.overflow_cycles = hdr.start_overflow_cycles;
+        emu.kc85.key_code = hdr.kc85_key_code;
+    }
+    else if (emu.z1013.on) {
+        emu.z1013.abs_cycle_count = hdr.start_cycle_count;
+        emu.z1013.overflow_cycles = hdr.start_overflow_cycles;
+    }
+    else if (emu.z9001.on) {
+        emu.z9001.abs_cycle_count = hdr.start_cycle_count;
+        emu.z9001.overflow_cycles = hdr.start_overflow_cycles;
+        keybuffer& kb = emu.z9001.keybuf;
+        kb.advance_count = hdr.z9001_keybuf_advance_count;
+        kb.write_pos = hdr.z9001_keybuf_write_pos;
+        kb.read_pos = hdr.z9001_keybuf_read_pos;
+        memcpy(kb.buf, hdr.z9001_keybuf, sizeof(kb.buf));
+    }
+    this->log.data.pos = 0;
+    this->replay_cycle_count = hdr.start_cycle_count;
+    this->cur_frame = 0;
+    this->desyncs = 0;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+movie::replay_frame(yakc& emu) {
+    YAKC_ASSERT(!this->is_recording);
+    while (!this->replay_done()) {
+        eventlog::event e;
+        if (!this->log.read(this->log.data.pos, this->replay_cycle_count, e)) {
+            // corrupt event log
+            this->desyncs++;
+            this->log.data.pos = this->log.data.size;
+            break;
+        }
+        this->replay_cycle_count = e.cycle_count;
+        if (eventlog::event_frame == e.type) {
+            // run exactly up to the recorded end of the frame
+            eventlog::run_to(emu, e.end_cycle_count);
+            if (emu.cycle_count() != e.cycle_count) {
+                this->desyncs++;
+            }
+            this->cur_frame++;
+            return true;
+        }
+        if ((emu.cycle_count() != e.cycle_count) || !eventlog::apply_input(emu, e)) {
+            this->desyncs++;
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+bool
+movie::replay_done() const {
+    return this->log.data.pos >= this->log.data.size;
+}
+
+//------------------------------------------------------------------------------
+int
+movie::replay_pos() const {
+    return this->cur_frame;
+}
+
+//------------------------------------------------------------------------------
+int
+movie::num_desyncs() const {
+    return this->desyncs;
+}
+
+//------------------------------------------------------------------------------
+int
+movie::num_frames() const {
+    return this->header.num_frames;
+}
+
+//------------------------------------------------------------------------------
+int
+movie::log_size() const {
+    return this->log.data.size;
+}
+
+//------------------------------------------------------------------------------
+int
+movie::start_size() const {
+    return this->start.size;
+}
+
+//------------------------------------------------------------------------------
+bool
+movie::save(snapshot::write_func write_fn, void* userdata) const {
+    YAKC_ASSERT(write_fn && this->valid());
+    header_t hdr = this->header;
+    hdr.log_size = this->log.data.size;
+    return write_fn(userdata, &hdr, sizeof(hdr)) &&
+           write_fn(userdata, this->start.ptr, this->start.size) &&
+           ((0 == this->log.data.size) || write_fn(userdata, this->log.data.ptr, this->log.data.size));
+}
+
+//------------------------------------------------------------------------------
+bool
+movie::load(snapshot::read_func read_fn, void* userdata) {
+    YAKC_ASSERT(read_fn);
+    this->discard();
+    header_t hdr;
+    if (!read_all(read_fn, userdata, &hdr, sizeof(hdr))) {
+        return false;
+    }
+    if ((hdr.magic != magic) || (hdr.version != cur_version) || (0 == hdr.start_size)) {
+        return false;
+    }
+    // the sizes come from the file, so a corrupt movie could ask for
+    // huge or overflowing allocations
+    if ((hdr.start_size > max_start_size) || (hdr.log_size > max_log_size)) {
+        return false;
+    }
+    ubyte* buf = (ubyte*) YAKC_MALLOC(this->log.data.funcs, hdr.start_size + hdr.log_size);
+    if (nullptr == buf) {
+        return false;
+    }
+    bool success = read_all(read_fn, userdata, buf, hdr.start_size + hdr.log_size);
+    if (success) {
+        snapshot::membuf::write(&this->start, buf, hdr.start_size);
+        if (hdr.log_size > 0) {
+            snapshot::membuf::write(&this->log.data, buf + hdr.start_size, hdr.log_size);
+        }
+        this->header = hdr;
+    }
+    YAKC_FREE(this->log.data.funcs, buf);
+    return success;
+}
+
+} // namespace YAKC
@@ -0,0 +1,131 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::movie
+    @brief deterministic recording and replay of emulator input
+
+    A movie consists of a start state of the machine and a log of input
+    events, each timestamped with the absolute CPU cycle count:
+
+    - key input through yakc::put_key() (only changes are logged)
+    - KC85 module insertion and removal through yakc::insert_module()
+      and yakc::remove_module()
+    - reset through yakc::reset()
+    - the end of each emulated frame, since the systems poll the
+      keyboard state once per frame, a frame event stores where
+      the frame ended
+
+    The start state is a compressed snapshot, plus the state which isn't
+    part of snapshots (the absolute cycle counter and pending key input).
+    Replaying a movie runs each frame to exactly the same cycle count as
+    the recorded frame, so the replayed session is bit-identical to the
+    recorded one, independent from host timing.
+
+    start_recording() hooks the movie into yakc::movie_recorder, which
+    is cleared by stop_recording() or when the emulator is switched off.
+    If the emulator has just been switched on, recording starts after the
+    first frame. Applying snapshots, rewinding or stepping in the debugger
+    while recording isn't supported (the replay would go out of sync),
+    a replay which diverges from the recording is detected and counted
+    in num_desyncs().
+
+    Movies can be written to and read from streams with save() and load()
+    using the same stream callbacks as snapshots. The event log is
+    encoded by the eventlog class, which is shared with the reverser.
+*/
+#include "yakc/eventlog.h"
+
+namespace YAKC {
+
+class movie {
+public:
+    /// max size of the compressed start state accepted by load()
+    static const uint32_t max_start_size = 4 * 1024 * 1024;
+    /// max size of the event log accepted by load()
+    static const uint32_t max_log_size = 256 * 1024 * 1024;
+
+    /// destructor
+    ~movie();
+    /// release all data
+    void discard();
+    /// return true if the movie contains a start state
+    bool valid() const;
+
+    /// start recording a new movie from the current state of a running emulator
+    void start_recording(yakc& emu);
+    /// stop recording
+    void stop_recording(yakc& emu);
+    /// return true if currently recording
+    bool recording() const;
+
+    /// called from yakc::onframe() after a frame
+    void on_frame(yakc& emu);
+    /// called from yakc::put_key()
+    void on_key(const yakc& emu, ubyte ascii);
+    /// called from yakc::insert_module()
+    void on_insert_module(const yakc& emu, ubyte slot_addr, kc85_exp::module_type type);
+    /// called from yakc::remove_module()
+    void on_remove_module(const yakc& emu, ubyte slot_addr);
+    /// called from yakc::reset()
+    void on_reset(const yakc& emu);
+
+    /// restore the start state into an emulator and rewind the replay
+    bool start_replay(yakc& emu);
+    /// replay the events of the next frame and the frame itself, false at end of movie
+    bool replay_frame(yakc& emu);
+    /// return true if the replay has reached the end of the movie
+    bool replay_done() const;
+    /// number of frames replayed since start_replay()
+    int replay_pos() const;
+    /// number of events which didn't happen at the recorded cycle count during replay
+    int num_desyncs() const;
+
+    /// number of recorded frames
+    int num_frames() const;
+    /// size of the event log in bytes
+    int log_size() const;
+    /// size of the compressed start state in bytes
+    int start_size() const;
+
+    /// write the movie to a stream
+    bool save(snapshot::write_func write_fn, void* userdata) const;
+    /// read a movie from a stream, return false if it's invalid or truncated
+    bool load(snapshot::read_func read_fn, void* userdata);
+
+private:
+    /// capture the start state
+    void capture(yakc& emu);
+
+    static const uint32_t magic = 'YKMV';
+    static const uint32_t cur_version = 1;
+    #pragma pack(push,1)
+    struct header_t {
+        uint32_t magic;
+        uint32_t version;
+        uword model;
+        uword os;
+        uint32_t num_frames;
+        uint64_t start_cycle_count;
+        uint32_t start_overflow_cycles;
+        uint32_t start_size;            // size of the start snapshot stream
+        uint32_t log_size;              // size of the event log
+        ubyte kc85_key_code;
+        ubyte pad[3];
+        int32_t z9001_keybuf_advance_count;
+        int32_t z9001_keybuf_write_pos;
+        int32_t z9001_keybuf_read_pos;
+        ubyte z9001_keybuf[keybuffer::num_entries];
+    };
+    #pragma pack(pop)
+    header_t header;
+    snapshot::membuf start;
+    eventlog log;
+    bool is_recording = false;
+    bool start_pending = false;
+    int last_key = -1;
+    uint64_t replay_cycle_count = 0;
+    int cur_frame = 0;
+    int desyncs = 0;
+};
+
+} // namespace YAKC
@@ -0,0 +1,223 @@
+//------------------------------------------------------------------------------
+//  opstats.cc
+//------------------------------------------------------------------------------
+#include "opstats.h"
+#include "yakc/z80.h"
+#include <algorithm>
+#include <stdio.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+opstats::~opstats() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+opstats::reset() {
+    if (this->stats) {
+        clear(this->stats, sizeof(counters));
+    }
+    this->num_analyzed = 0;
+}
+
+//------------------------------------------------------------------------------
+void
+opstats::discard() {
+    if (this->stats) {
+        YAKC_FREE(this->funcs, this->stats);
+        this->stats = nullptr;
+    }
+    if (this->entries) {
+        YAKC_FREE(this->funcs, this->entries);
+        this->entries = nullptr;
+    }
+    this->num_analyzed = 0;
+    this->enabled = false;
+}
+
+//------------------------------------------------------------------------------
+void
+opstats::begin_run(z80& cpu) {
+    if (this->enabled) {
+        if (nullptr == this->stats) {
+            this->stats = (counters*) YAKC_MALLOC(this->funcs, sizeof(counters));
+            clear(this->stats, sizeof(counters));
+        }
+        cpu.stats = this;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+opstats::end_run(z80& cpu) {
+    cpu.stats = nullptr;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+opstats::get_count(int table, ubyte op) const {
+    YAKC_ASSERT((table >= 0) && (table < num_tables));
+    return this->stats ? this->stats->counts[table][op] : 0;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+opstats::get_taken(int table, ubyte op) const {
+    YAKC_ASSERT((table >= 0) && (table < num_tables));
+    return this->stats ? this->stats->taken[table][op] : 0;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+opstats::table_count(int table) const {
+    YAKC_ASSERT((table >= 0) && (table < num_tables));
+    uint64_t count = 0;
+    for (int op = 0; op < 256; op++) {
+        count += this->get_count(table, ubyte(op));
+    }
+    return count;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+opstats::num_instructions() const {
+    uint64_t count = 0;
+    for (int table = 0; table < num_tables; table++) {
+        for (int op = 0; op < 256; op++) {
+            if (!is_prefix(table, op)) {
+                count += this->get_count(table, ubyte(op));
+            }
+        }
+    }
+    return count;
+}
+
+//------------------------------------------------------------------------------
+bool
+opstats::is_prefix(int table, ubyte op) {
+    switch (table) {
+        case main_table:
+            return (op == 0xCB) || (op == 0xDD) || (op == 0xED) || (op == 0xFD);
+        case dd_table:
+        case fd_table:
+            return op == 0xCB;
+        default:
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+opstats::is_conditional(int table, ubyte op) {
+    if ((table == main_table) || (table == dd_table) || (table == fd_table)) {
+        return (op == 0x10) ||                  // DJNZ
+               ((op & 0xE7) == 0x20) ||         // JR cc
+               ((op & 0xC7) == 0xC0) ||         // RET cc
+               ((op & 0xC7) == 0xC2) ||         // JP cc
+               ((op & 0xC7) == 0xC4);           // CALL cc
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+const char*
+opstats::table_name(int table) {
+    YAKC_ASSERT((table >= 0) && (table < num_tables));
+    static const char* names[num_tables] = { "", "CB", "ED", "DD", "FD", "DDCB", "FDCB" };
+    return names[table];
+}
+
+//------------------------------------------------------------------------------
+int
+opstats::analyze() {
+    this->num_analyzed = 0;
+    if (nullptr == this->stats) {
+        return 0;
+    }
+    if (nullptr == this->entries) {
+        this->entries = (entry*) YAKC_MALLOC(this->funcs, num_tables * 256 * sizeof(entry));
+    }
+    for (int table = 0; table < num_tables; table++) {
+        for (int op = 0; op < 256; op++) {
+            if ((this->stats->counts[table][op] > 0) && !is_prefix(table, op)) {
+                entry& e = this->entries[this->num_analyzed++];
+                e.table = table;
+                e.op = ubyte(op);
+                e.count = this->stats->counts[table][op];
+                e.taken = this->stats->taken[table][op];
+            }
+        }
+    }
+    std::stable_sort(this->entries, this->entries + this->num_analyzed, [](const entry& e0, const entry& e1) {
+        return e0.count > e1.count;
+    });
+    return this->num_analyzed;
+}
+
+//------------------------------------------------------------------------------
+int
+opstats::num_entries() const {
+    return this->num_analyzed;
+}
+
+//------------------------------------------------------------------------------
+const opstats::entry&
+opstats::get_entry(int index) const {
+    YAKC_ASSERT((index >= 0) && (index < this->num_analyzed));
+    return this->entries[index];
+}
+
+//------------------------------------------------------------------------------
+bool
+opstats::save(write_func write_fn, void* userdata) const {
+    YAKC_ASSERT(write_fn);
+    char line[128];
+    const uint64_t total = this->num_instructions();
+    int len = snprintf(line, sizeof(line), "# %llu instructions, %d opcodes\n",
+        (unsigned long long) total, this->num_analyzed);
+    if (!write_fn(userdata, line, len)) {
+        return false;
+    }
+    len = snprintf(line, sizeof(line), "#         count       %%  opcode   instruction         taken\n");
+    if (!write_fn(userdata, line, len)) {
+        return false;
+    }
+    for (int i = 0; i < this->num_analyzed; i++) {
+        const entry& e = this->entries[i];
+        const double percent = total > 0 ? (100.0 * e.count) / total : 0.0;
+        const char* name = z80::op_name(e.table, e.op);
+        len = snprintf(line, sizeof(line), "%14llu %6.2f%%  %4s %02X  %-18s",
+            (unsigned long long) e.count, percent, table_name(e.table), e.op, name ? name : "?");
+        if (is_conditional(e.table, e.op)) {
+            len += snprintf(line + len, sizeof(line) - len, "  %6.2f%%", (100.0 * e.taken) / e.count);
+        }
+        len += snprintf(line + len, sizeof(line) - len, "\n");
+        if (!write_fn(userdata, line, len)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static bool
+write_to_file(void* userdata, const void* ptr, int num_bytes) {
+    return fwrite(ptr, 1, num_bytes, (FILE*)userdata) == size_t(num_bytes);
+}
+
+//------------------------------------------------------------------------------
+bool
+opstats::write_file(const char* path) const {
+    YAKC_ASSERT(path);
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        return false;
+    }
+    const bool success = this->save(write_to_file, fp);
+    fclose(fp);
+    return success;
+}
+
+} // namespace YAKC
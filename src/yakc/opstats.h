@@ -0,0 +1,135 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::opstats
+    @brief an instruction-mix histogram of the executed Z80 opcodes
+
+    When enabled, begin_run() hooks the statistics into the CPU, and the
+    generated instruction decoder (see z80_opcodes.py) counts each opcode
+    byte it fetches in the table it is decoded from: the main table, the
+    CB, ED, DD and FD prefix tables, and the DD CB and FD CB tables (the
+    last byte of a 4-byte index bit instruction). A prefix byte is
+    counted in the table it appears in (e.g. main 0xDD counts all IX
+    instructions), the number of executed instructions is the sum of
+    all counters which aren't prefixes.
+
+    For conditional jumps, calls and returns (JR cc, DJNZ, JP cc,
+    CALL cc, RET cc, also in the DD and FD tables) the decoder also
+    counts how often the condition was true, the not-taken count is
+    the difference to the execution count.
+
+    analyze() collects the executed instructions sorted by execution
+    count, save() writes them as a text report with instruction names
+    from z80::op_name().
+
+    Notes:
+    - a HALT instruction is counted in each step while the CPU is halted
+    - a block instruction (LDIR etc.) which runs several iterations in
+      one step is counted once
+    - the statistics are disabled during run-ahead and reverse debugger
+      replays, like the profiler
+
+    The counters are allocated by the first begin_run() after the
+    statistics have been enabled. The cost when disabled is a single
+    branch per fetched opcode byte.
+*/
+#include "yakc/core.h"
+
+namespace YAKC {
+
+class z80;
+
+class opstats {
+public:
+    /// the opcode tables
+    enum table {
+        main_table = 0,
+        cb_table,
+        ed_table,
+        dd_table,
+        fd_table,
+        ddcb_table,
+        fdcb_table,
+
+        num_tables
+    };
+    /// an executed instruction in the analysis
+    struct entry {
+        int table = main_table;     // the opcode table
+        ubyte op = 0;               // the opcode byte in the table
+        uint64_t count = 0;         // number of executions
+        uint64_t taken = 0;         // conditional instructions: number of times the condition was true
+    };
+    /// stream output callback (same as snapshot::write_func), must return false on error
+    typedef bool (*write_func)(void* userdata, const void* ptr, int num_bytes);
+
+    /// set to true to start counting
+    bool enabled = false;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+    /// destructor
+    ~opstats();
+    /// clear all counters
+    void reset();
+    /// free all memory and disable counting
+    void discard();
+    /// connect to the CPU before running it (only if enabled, allocates the counters)
+    void begin_run(z80& cpu);
+    /// disconnect from the CPU after running it
+    void end_run(z80& cpu);
+    /// count a fetched opcode byte (called by the instruction decoder)
+    void record(int table, ubyte op);
+    /// count a conditional instruction whose condition was true (called by the instruction decoder)
+    void record_taken(int table, ubyte op);
+
+    /// get the execution count of an opcode
+    uint64_t get_count(int table, ubyte op) const;
+    /// get the number of times a conditional instruction was taken
+    uint64_t get_taken(int table, ubyte op) const;
+    /// get the sum of all counters in a table
+    uint64_t table_count(int table) const;
+    /// get the number of executed instructions (without prefixes)
+    uint64_t num_instructions() const;
+    /// true if an opcode is a prefix in a table
+    static bool is_prefix(int table, ubyte op);
+    /// true if an opcode is a conditional jump, call or return
+    static bool is_conditional(int table, ubyte op);
+    /// get the prefix bytes of a table as text (empty for the main table)
+    static const char* table_name(int table);
+
+    /// collect the executed instructions sorted by count, return number of entries
+    int analyze();
+    /// number of entries found by the last analyze()
+    int num_entries() const;
+    /// get an entry from the last analyze()
+    const entry& get_entry(int index) const;
+
+    /// write the executed instructions as text report (call analyze() first)
+    bool save(write_func write_fn, void* userdata) const;
+    /// write the text report to a file
+    bool write_file(const char* path) const;
+
+private:
+    struct counters {
+        uint64_t counts[num_tables][256];
+        uint64_t taken[num_tables][256];
+    };
+    counters* stats = nullptr;
+    entry* entries = nullptr;
+    int num_analyzed = 0;
+};
+
+//------------------------------------------------------------------------------
+inline void
+opstats::record(int table, ubyte op) {
+    this->stats->counts[table][op]++;
+}
+
+//------------------------------------------------------------------------------
+inline void
+opstats::record_taken(int table, ubyte op) {
+    this->stats->taken[table][op]++;
+}
+
+} // namespace YAKC
@@ -0,0 +1,330 @@
+//------------------------------------------------------------------------------
+//  profiler.cc
+//------------------------------------------------------------------------------
+#include "profiler.h"
+#include "yakc/tracer.h"
+#include <algorithm>
+#include <stdio.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+profiler::~profiler() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+profiler::reset() {
+    for (int i = 0; i < this->num_host_pages; i++) {
+        clear(this->pages[i].counters, sizeof(counter) * memory::page::size);
+    }
+    if (this->overflow) {
+        clear(this->overflow, sizeof(counter) * memory::page::size);
+    }
+    this->num_analyzed = 0;
+}
+
+//------------------------------------------------------------------------------
+void
+profiler::discard() {
+    for (int i = 0; i < this->num_host_pages; i++) {
+        YAKC_FREE(this->funcs, this->pages[i].counters);
+    }
+    this->num_host_pages = 0;
+    if (this->pages) {
+        YAKC_FREE(this->funcs, this->pages);
+        this->pages = nullptr;
+    }
+    if (this->overflow) {
+        YAKC_FREE(this->funcs, this->overflow);
+        this->overflow = nullptr;
+    }
+    for (int i = 0; i < memory::num_pages; i++) {
+        this->cache_ptr[i] = nullptr;
+        this->cache[i] = nullptr;
+    }
+    if (this->blocks) {
+        YAKC_FREE(this->funcs, this->blocks);
+        this->blocks = nullptr;
+    }
+    this->blocks_capacity = 0;
+    this->num_analyzed = 0;
+    this->enabled = false;
+}
+
+//------------------------------------------------------------------------------
+const ubyte*
+profiler::host_ptr(const memory& mem, uword addr) {
+    // NOTE: the CPU-visible page may be the source of a copy-on-write page
+    const int layer = mem.layer(addr);
+    if (layer < 0) {
+        return mem.unmapped_page;
+    }
+    return mem.layers[layer][addr>>memory::page::shift].ptr;
+}
+
+//------------------------------------------------------------------------------
+int
+profiler::find_page(const ubyte* ptr) const {
+    for (int i = 0; i < this->num_host_pages; i++) {
+        if (this->pages[i].ptr == ptr) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+profiler::counter*
+profiler::lookup(const memory& mem, int page_index) {
+    const uword addr = uword(page_index << memory::page::shift);
+    const ubyte* ptr = host_ptr(mem, addr);
+    counter* counters = nullptr;
+    int index = this->find_page(ptr);
+    if ((index < 0) && (this->num_host_pages < max_pages)) {
+        if (nullptr == this->pages) {
+            this->pages = (host_page*) YAKC_MALLOC(this->funcs, sizeof(host_page) * max_pages);
+        }
+        index = this->num_host_pages++;
+        host_page& hp = this->pages[index];
+        hp.ptr = ptr;
+        hp.counters = (counter*) YAKC_MALLOC(this->funcs, sizeof(counter) * memory::page::size);
+        clear(hp.counters, sizeof(counter) * memory::page::size);
+        hp.addr = addr;
+        hp.bank = 0;
+        for (int i = 0; i < index; i++) {
+            if (this->pages[i].addr == addr) {
+                hp.bank++;
+            }
+        }
+    }
+    if (index >= 0) {
+        counters = this->pages[index].counters;
+    }
+    else {
+        if (nullptr == this->overflow) {
+            this->overflow = (counter*) YAKC_MALLOC(this->funcs, sizeof(counter) * memory::page::size);
+            clear(this->overflow, sizeof(counter) * memory::page::size);
+        }
+        counters = this->overflow;
+    }
+    this->cache_ptr[page_index] = mem.pages[page_index].ptr;
+    this->cache[page_index] = counters;
+    return counters;
+}
+
+//------------------------------------------------------------------------------
+profiler::counter
+profiler::get(const memory& mem, uword addr) const {
+    const int index = this->find_page(host_ptr(mem, addr));
+    if (index >= 0) {
+        return this->pages[index].counters[addr & memory::page::mask];
+    }
+    return counter();
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+profiler::total_cycles() const {
+    uint64_t cycles = 0;
+    for (int i = 0; i < this->num_host_pages; i++) {
+        for (int j = 0; j < memory::page::size; j++) {
+            cycles += this->pages[i].counters[j].cycles;
+        }
+    }
+    return cycles;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+profiler::total_count() const {
+    uint64_t count = 0;
+    for (int i = 0; i < this->num_host_pages; i++) {
+        for (int j = 0; j < memory::page::size; j++) {
+            count += this->pages[i].counters[j].count;
+        }
+    }
+    return count;
+}
+
+//------------------------------------------------------------------------------
+int
+profiler::num_pages() const {
+    return this->num_host_pages;
+}
+
+//------------------------------------------------------------------------------
+bool
+profiler::ends_block(const ubyte* op) {
+    switch (op[0]) {
+        case 0x10:  // DJNZ
+        case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:  // JR
+        case 0x76:  // HALT
+        case 0xC3:  // JP
+        case 0xC9:  // RET
+        case 0xCD:  // CALL
+        case 0xE9:  // JP (HL)
+            return true;
+        case 0xED:
+            // RETN, RETI
+            return (op[1] & 0xC7) == 0x45;
+        case 0xDD:
+        case 0xFD:
+            // JP (IX), JP (IY)
+            return op[1] == 0xE9;
+        default: {
+            // RET cc, JP cc, CALL cc, RST
+            const ubyte x = op[0] & 0xC7;
+            return (x == 0xC0) || (x == 0xC2) || (x == 0xC4) || (x == 0xC7);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+int
+profiler::analyze(memory& mem) {
+    // decoding instructions needs the content of copy-on-write pages in host memory
+    mem.unshare();
+    this->num_analyzed = 0;
+    for (int page_index = 0; page_index < this->num_host_pages; page_index++) {
+        const host_page& hp = this->pages[page_index];
+        int cur = -1;
+        int next_offset = 0;
+        bool ended = true;
+        for (int offset = 0; offset < memory::page::size; offset++) {
+            const counter& c = hp.counters[offset];
+            if (0 == c.count) {
+                continue;
+            }
+            if (ended || (offset != next_offset) || (c.count != this->blocks[cur].count)) {
+                // start a new block
+                if (this->num_analyzed == this->blocks_capacity) {
+                    const int capacity = this->blocks_capacity ? this->blocks_capacity * 2 : 1024;
+                    block* blocks = (block*) YAKC_MALLOC(this->funcs, capacity * sizeof(block));
+                    if (this->blocks) {
+                        memcpy(blocks, this->blocks, this->num_analyzed * sizeof(block));
+                        YAKC_FREE(this->funcs, this->blocks);
+                    }
+                    this->blocks = blocks;
+                    this->blocks_capacity = capacity;
+                }
+                cur = this->num_analyzed++;
+                block& b = this->blocks[cur];
+                b = block();
+                b.addr = uword(hp.addr + offset);
+                b.bank = hp.bank;
+                b.count = c.count;
+                b.page = page_index;
+                b.offset = offset;
+            }
+            // an instruction at the end of the page continues in another page
+            ubyte op[4] = { };
+            for (int i = 0; (i < 4) && ((offset + i) < memory::page::size); i++) {
+                op[i] = hp.ptr[offset + i];
+            }
+            const int len = tracer::instr_length(op);
+            block& b = this->blocks[cur];
+            b.num_instrs++;
+            b.num_bytes += len;
+            b.cycles += c.cycles;
+            next_offset = offset + len;
+            ended = ends_block(op);
+        }
+    }
+    std::sort(this->blocks, this->blocks + this->num_analyzed, [](const block& b0, const block& b1) {
+        return b0.cycles > b1.cycles;
+    });
+    return this->num_analyzed;
+}
+
+//------------------------------------------------------------------------------
+int
+profiler::num_blocks() const {
+    return this->num_analyzed;
+}
+
+//------------------------------------------------------------------------------
+const profiler::block&
+profiler::get_block(int index) const {
+    YAKC_ASSERT((index >= 0) && (index < this->num_analyzed));
+    return this->blocks[index];
+}
+
+//------------------------------------------------------------------------------
+profiler::counter
+profiler::get_block_counter(const block& b, int byte_offset) const {
+    YAKC_ASSERT((byte_offset >= 0) && (byte_offset < b.num_bytes));
+    const int offset = b.offset + byte_offset;
+    if (offset < memory::page::size) {
+        return this->pages[b.page].counters[offset];
+    }
+    return counter();
+}
+
+//------------------------------------------------------------------------------
+bool
+profiler::is_mapped(const memory& mem, const block& b) const {
+    return host_ptr(mem, b.addr) == this->pages[b.page].ptr;
+}
+
+//------------------------------------------------------------------------------
+bool
+profiler::save(write_func write_fn, void* userdata) const {
+    YAKC_ASSERT(write_fn);
+    char line[128];
+    const uint64_t total = this->total_cycles();
+    int len = snprintf(line, sizeof(line), "# %llu T-states, %llu instructions, %d blocks\n",
+        (unsigned long long) total, (unsigned long long) this->total_count(), this->num_analyzed);
+    if (!write_fn(userdata, line, len)) {
+        return false;
+    }
+    len = snprintf(line, sizeof(line), "#     T-states       %%        count  addr:bank\n");
+    if (!write_fn(userdata, line, len)) {
+        return false;
+    }
+    for (int i = 0; i < this->num_analyzed; i++) {
+        const block& b = this->blocks[i];
+        const double percent = total > 0 ? (100.0 * b.cycles) / total : 0.0;
+        len = snprintf(line, sizeof(line), "%14llu %6.2f%% %12llu  %04X:%d\n",
+            (unsigned long long) b.cycles, percent, (unsigned long long) b.count, b.addr, b.bank);
+        if (!write_fn(userdata, line, len)) {
+            return false;
+        }
+        // the instructions of the block
+        const host_page& hp = this->pages[b.page];
+        const int end = std::min(b.offset + b.num_bytes, int(memory::page::size));
+        for (int offset = b.offset; offset < end; offset++) {
+            const counter& c = hp.counters[offset];
+            if (c.count > 0) {
+                len = snprintf(line, sizeof(line), "%14llu %21s  %04X\n",
+                    (unsigned long long) c.cycles, "", uword(hp.addr + offset));
+                if (!write_fn(userdata, line, len)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static bool
+write_to_file(void* userdata, const void* ptr, int num_bytes) {
+    return fwrite(ptr, 1, num_bytes, (FILE*)userdata) == size_t(num_bytes);
+}
+
+//------------------------------------------------------------------------------
+bool
+profiler::write_file(const char* path) const {
+    YAKC_ASSERT(path);
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        return false;
+    }
+    const bool success = this->save(write_to_file, fp);
+    fclose(fp);
+    return success;
+}
+
+} // namespace YAKC
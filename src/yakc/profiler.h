@@ -0,0 +1,154 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::profiler
+    @brief count executed T-states and instructions per address
+
+    When enabled, the emulated systems call record() after each
+    instruction with its PC and the T-states it took, the profiler
+    adds them to a counter for the instruction's address.
+
+    The counters are bank-aware: instead of a flat 64K array indexed
+    by the CPU address, there's an array of 1 KByte counters for each
+    host memory page the CPU executed code from (the page which is
+    mapped at the address, see the memory class). On the KC85 the same
+    address can map different RAM banks, ROMs or module memory, and
+    these are counted separately. The counter array of a CPU page is
+    cached until the memory mapping at that page changes, so recording
+    is an array access after a single pointer compare.
+
+    To tell the host memory pages apart in reports, each page gets a
+    bank number: the CPU page address where it was first executed, and
+    an index which counts the different host pages seen at that address.
+    For instance, on a KC85/4 the RAM8 block 0 at 8000 becomes bank 0,
+    and RAM8 block 1 becomes bank 1 when it's switched in later.
+
+    analyze() groups the counted instructions into basic blocks and
+    sorts them by cost (T-states). A basic block is a run of consecutive
+    instructions with the same execution count, it ends after jumps,
+    calls, returns and halt. Instruction lengths are decoded from the
+    current memory content, so code which was overwritten since it
+    was executed can produce odd blocks.
+
+    Notes:
+    - interrupt acknowledge cycles are not counted, since they don't
+      belong to an instruction
+    - a block instruction (LDIR etc.) which runs several iterations in
+      one step is counted once, with the T-states of all iterations
+    - the profiler is disabled during run-ahead and reverse debugger
+      replays, like the tracer
+
+    All memory is allocated on first use, the cost when disabled is a
+    single branch per instruction in the emulation loop.
+*/
+#include "yakc/core.h"
+#include "yakc/memory.h"
+
+namespace YAKC {
+
+class profiler {
+public:
+    /// max number of distinct host memory pages
+    static const int max_pages = 512;
+    /// counters of an instruction address
+    struct counter {
+        uint64_t cycles = 0;        // T-states
+        uint64_t count = 0;         // number of executions
+    };
+    /// a basic block in the analysis
+    struct block {
+        uword addr = 0;             // CPU address of the first instruction
+        int bank = 0;               // bank number at this address
+        int num_instrs = 0;
+        int num_bytes = 0;
+        uint64_t count = 0;         // number of executions
+        uint64_t cycles = 0;        // T-states of all executions
+        int page = 0;               // internal: host page index
+        int offset = 0;             // internal: offset in host page
+    };
+    /// stream output callback (same as snapshot::write_func), must return false on error
+    typedef bool (*write_func)(void* userdata, const void* ptr, int num_bytes);
+
+    /// set to true to start counting
+    bool enabled = false;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+    /// destructor
+    ~profiler();
+    /// zero all counters and drop the analysis
+    void reset();
+    /// free all counters and disable counting
+    void discard();
+    /// count an executed instruction (called by the emulated systems after each instruction)
+    void record(const memory& mem, uword pc, int cycles);
+
+    /// get the counters of the instruction at an address in the current memory mapping
+    counter get(const memory& mem, uword addr) const;
+    /// get total number of counted T-states
+    uint64_t total_cycles() const;
+    /// get total number of counted instructions
+    uint64_t total_count() const;
+    /// get number of host memory pages with counters
+    int num_pages() const;
+
+    /// group the counters into basic blocks sorted by T-states, return number of blocks
+    int analyze(memory& mem);
+    /// number of blocks found by the last analyze()
+    int num_blocks() const;
+    /// get a block from the last analyze(), sorted by T-states
+    const block& get_block(int index) const;
+    /// get the counters of an instruction in an analyzed block
+    counter get_block_counter(const block& b, int byte_offset) const;
+    /// return true if a block's bank is currently mapped at its address
+    bool is_mapped(const memory& mem, const block& b) const;
+
+    /// write the analyzed blocks and their instructions as a text report
+    bool save(write_func write_fn, void* userdata) const;
+    /// write the text report to a file
+    bool write_file(const char* path) const;
+
+private:
+    /// a host memory page with counters
+    struct host_page {
+        const ubyte* ptr = nullptr;     // the host memory page
+        counter* counters = nullptr;    // memory::page::size counters
+        uword addr = 0;                 // CPU address where it was first executed
+        int bank = 0;                   // index among the pages first executed at addr
+    };
+    /// find or create the counters of the host page mapped at a CPU page
+    counter* lookup(const memory& mem, int page_index);
+    /// find a host page, -1 if not found
+    int find_page(const ubyte* ptr) const;
+    /// host page mapped at an address (pages mapped copy-on-write resolve to the destination)
+    static const ubyte* host_ptr(const memory& mem, uword addr);
+    /// return true if an instruction ends a basic block
+    static bool ends_block(const ubyte* op);
+
+    host_page* pages = nullptr;         // max_pages entries
+    int num_host_pages = 0;
+    // cached counters per CPU page, valid while the visible page pointer doesn't change
+    const ubyte* cache_ptr[memory::num_pages] = { };
+    counter* cache[memory::num_pages] = { };
+    // counters for host pages beyond max_pages (not reported)
+    counter* overflow = nullptr;
+    // the analysis
+    block* blocks = nullptr;
+    int blocks_capacity = 0;
+    int num_analyzed = 0;
+};
+
+//------------------------------------------------------------------------------
+inline void
+profiler::record(const memory& mem, uword pc, int cycles) {
+    const int page_index = pc >> memory::page::shift;
+    counter* c = this->cache[page_index];
+    if (mem.pages[page_index].ptr != this->cache_ptr[page_index]) {
+        c = this->lookup(mem, page_index);
+    }
+    c += pc & memory::page::mask;
+    c->cycles += cycles;
+    c->count++;
+}
+
+} // namespace YAKC
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+//  quietscope.cc
+//------------------------------------------------------------------------------
+#include "quietscope.h"
+#include <string.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+void
+quietscope::begin(yakc& emu, bool suspend_dbg) {
+    YAKC_ASSERT(!this->is_active);
+    this->is_active = true;
+    breadboard& board = emu.board;
+    this->kc85_snd = emu.kc85.audio.funcs;
+    this->z9001_snd = emu.z9001.sound_cb;
+    this->rewind_buffer = emu.rewind_buffer;
+    this->movie_recorder = emu.movie_recorder;
+    this->reverse_debugger = emu.reverse_debugger;
+    this->trace_enabled = board.trace.enabled;
+    this->prof_enabled = board.prof.enabled;
+    this->calls_enabled = board.calls.enabled;
+    this->ops_enabled = board.ops.enabled;
+    this->cov_enabled = board.cov.enabled;
+    this->times_enabled = board.times.enabled;
+    this->mem_counting = board.cpu.mem.counting;
+    emu.kc85.audio.funcs = sound_funcs();
+    emu.z9001.sound_cb = sound_funcs();
+    emu.rewind_buffer = nullptr;
+    emu.movie_recorder = nullptr;
+    emu.reverse_debugger = nullptr;
+    board.trace.enabled = false;
+    board.prof.enabled = false;
+    board.calls.enabled = false;
+    board.ops.enabled = false;
+    board.cov.enabled = false;
+    board.times.enabled = false;
+    board.cpu.mem.set_counting(false);
+
+    // the debugger's PC history is restored in end(), so it
+    // doesn't show the instructions which ran in between
+    this->dbg_suspended = suspend_dbg && !board.dbg.suspended;
+    if (this->dbg_suspended) {
+        memcpy(this->pc_history, board.dbg.pc_history, sizeof(this->pc_history));
+        this->pc_history_pos = board.dbg.pc_history_pos;
+        board.dbg.suspended = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+quietscope::end(yakc& emu) {
+    YAKC_ASSERT(this->is_active);
+    this->is_active = false;
+    breadboard& board = emu.board;
+    emu.kc85.audio.funcs = this->kc85_snd;
+    emu.z9001.sound_cb = this->z9001_snd;
+    emu.rewind_buffer = this->rewind_buffer;
+    emu.movie_recorder = this->movie_recorder;
+    emu.reverse_debugger = this->reverse_debugger;
+    board.trace.enabled = this->trace_enabled;
+    board.prof.enabled = this->prof_enabled;
+    board.calls.enabled = this->calls_enabled;
+    board.ops.enabled = this->ops_enabled;
+    board.cov.enabled = this->cov_enabled;
+    board.times.enabled = this->times_enabled;
+    board.cpu.mem.set_counting(this->mem_counting);
+    if (this->dbg_suspended) {
+        memcpy(board.dbg.pc_history, this->pc_history, sizeof(this->pc_history));
+        board.dbg.pc_history_pos = this->pc_history_pos;
+        board.dbg.suspended = false;
+        this->dbg_suspended = false;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+quietscope::active() const {
+    return this->is_active;
+}
+
+} // namespace YAKC
@@ -0,0 +1,52 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::quietscope
+    @brief run the emulator without side effects outside the machine state
+
+    Between begin() and end() the emulator runs with muted sound, without
+    recording into the rewind buffer, a movie or the reverse debugger,
+    and with all instrumentation on the breadboard (trace, profiler, call
+    graph, opstats, coverage, frame times and memory access counters)
+    switched off. end() restores everything to the state before begin().
+
+    This is used for frames which aren't part of the visible timeline:
+    the run-ahead frames, the cold boot of the boot cache, and the
+    replays of the reverse debugger.
+
+    Optionally the debugger is suspended as well: breakpoints and
+    watchpoints are ignored, and the PC history is left untouched.
+*/
+#include "yakc/yakc.h"
+
+namespace YAKC {
+
+class quietscope {
+public:
+    /// start running quietly, optionally also ignore breakpoints
+    void begin(yakc& emu, bool suspend_dbg);
+    /// restore sound output, recorders and instrumentation
+    void end(yakc& emu);
+    /// return true between begin() and end()
+    bool active() const;
+
+private:
+    bool is_active = false;
+    sound_funcs kc85_snd;
+    sound_funcs z9001_snd;
+    rewinder* rewind_buffer = nullptr;
+    movie* movie_recorder = nullptr;
+    reverser* reverse_debugger = nullptr;
+    bool trace_enabled = false;
+    bool prof_enabled = false;
+    bool calls_enabled = false;
+    bool ops_enabled = false;
+    bool cov_enabled = false;
+    bool times_enabled = false;
+    bool mem_counting = false;
+    bool dbg_suspended = false;
+    int pc_history_pos = 0;
+    uword pc_history[z80dbg::pc_history_size] = { };
+};
+
+} // namespace YAKC
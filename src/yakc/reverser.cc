@@ -0,0 +1,425 @@
+//------------------------------------------------------------------------------
+//  reverser.cc
+//------------------------------------------------------------------------------
+#include "reverser.h"
+#include <string.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+static void
+restore_dbg(z80dbg& dbg, const z80dbg& saved) {
+    // restore the debugger settings, but keep the PC history of the replay
+    uword pc_history[z80dbg::pc_history_size];
+    memcpy(pc_history, dbg.pc_history, sizeof(pc_history));
+    const int pc_history_pos = dbg.pc_history_pos;
+    dbg = saved;
+    memcpy(dbg.pc_history, pc_history, sizeof(pc_history));
+    dbg.pc_history_pos = pc_history_pos;
+}
+
+//------------------------------------------------------------------------------
+reverser::~reverser() {
+    this->clear();
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::clear() {
+    for (auto& c : this->checkpoints) {
+        c.state.discard();
+    }
+    this->first = 0;
+    this->num = 0;
+    this->log.discard();
+    this->frames_since_checkpoint = 0;
+    this->paused_frames = 0;
+    this->last_key = -1;
+    this->desyncs = 0;
+    this->scratch.discard();
+}
+
+//------------------------------------------------------------------------------
+reverser::checkpoint&
+reverser::cp(int index) {
+    YAKC_ASSERT((index >= 0) && (index < max_checkpoints));
+    return this->checkpoints[(this->first + index) % max_checkpoints];
+}
+
+//------------------------------------------------------------------------------
+int
+reverser::checkpoint_limit() const {
+    const int interval = this->checkpoint_interval > 0 ? this->checkpoint_interval : 1;
+    int limit = this->history_frames / interval + 1;
+    if (limit < 2) {
+        limit = 2;
+    }
+    else if (limit > max_checkpoints) {
+        limit = max_checkpoints;
+    }
+    return limit;
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::add_checkpoint(yakc& emu) {
+    this->flush_paused_frames();
+    while (this->num >= this->checkpoint_limit()) {
+        this->drop_oldest();
+    }
+    checkpoint& c = this->cp(this->num++);
+    c.state.capture(emu);
+    c.cycle_count = emu.cycle_count();
+    c.log_pos = this->log.data.size;
+    this->frames_since_checkpoint = 0;
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::drop_oldest() {
+    YAKC_ASSERT(this->num > 0);
+    this->cp(0).state.discard();
+    this->first = (this->first + 1) % max_checkpoints;
+    this->num--;
+    // the log before the new oldest checkpoint can't be replayed anymore
+    snapshot::membuf& data = this->log.data;
+    const int num_bytes = (this->num > 0) ? this->cp(0).log_pos : data.size;
+    if (num_bytes > 0) {
+        memmove(data.ptr, data.ptr + num_bytes, data.size - num_bytes);
+        data.size -= num_bytes;
+        for (int i = 0; i < this->num; i++) {
+            this->cp(i).log_pos -= num_bytes;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::flush_paused_frames() {
+    // consecutive paused frames are written as a single event
+    if (this->paused_frames > 0) {
+        this->log.write_paused_frames(this->paused_frames);
+        this->paused_frames = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::begin_frame(yakc& emu) {
+    const uint64_t cycle_count = emu.cycle_count();
+    if (!emu.switchedon() || (0 == cycle_count)) {
+        // just switched on, the first frame doesn't start at a defined cycle count
+        if (this->num > 0) {
+            this->clear();
+        }
+        return;
+    }
+    if ((0 == this->num) || (cycle_count != this->log.last_cycle_count)) {
+        // start a new history, allocated through the emulator's memory functions
+        this->clear();
+        this->log.data.funcs = emu.funcs;
+        this->log.last_cycle_count = cycle_count;
+        this->add_checkpoint(emu);
+    }
+    this->frame_paused = emu.board.dbg.paused;
+    if (!this->frame_paused && (this->frames_since_checkpoint >= this->checkpoint_interval)) {
+        this->add_checkpoint(emu);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::end_frame(const yakc& emu) {
+    if (0 == this->num) {
+        return;
+    }
+    if (this->frame_paused) {
+        this->paused_frames++;
+    }
+    else {
+        this->flush_paused_frames();
+        this->log.write_frame(emu);
+        this->frames_since_checkpoint++;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::on_key(const yakc& emu, ubyte ascii) {
+    // the app calls put_key() each frame, only log changes
+    if (ascii == this->last_key) {
+        return;
+    }
+    this->last_key = ascii;
+    if (this->num > 0) {
+        this->flush_paused_frames();
+        this->log.write_key(emu, ascii);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::on_insert_module(const yakc& emu, ubyte slot_addr, kc85_exp::module_type type) {
+    if (this->num > 0) {
+        this->flush_paused_frames();
+        this->log.write_insert_module(emu, slot_addr, type);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::on_remove_module(const yakc& emu, ubyte slot_addr) {
+    if (this->num > 0) {
+        this->flush_paused_frames();
+        this->log.write_remove_module(emu, slot_addr);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::on_reset(const yakc& emu) {
+    // reset clears the key buffers, so the next key must be logged
+    this->last_key = -1;
+    if (this->num > 0) {
+        this->flush_paused_frames();
+        this->log.write_reset(emu);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+reverser::can_reverse(const yakc& emu) const {
+    return emu.switchedon() && (this->num > 0) && (emu.cycle_count() == this->log.last_cycle_count);
+}
+
+//------------------------------------------------------------------------------
+int
+reverser::find_checkpoint(uint64_t cycle_count) const {
+    for (int i = this->num - 1; i >= 0; i--) {
+        if (this->checkpoints[(this->first + i) % max_checkpoints].cycle_count < cycle_count) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::begin_replay(yakc& emu) {
+    // replay with muted sound and without recording anything, the
+    // breakpoints must stay active for reverse_continue()
+    this->quiet.begin(emu, false);
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::end_replay(yakc& emu) {
+    // the emulator must not share memory with a checkpoint which might be dropped
+    emu.board.cpu.mem.unshare();
+    this->quiet.end(emu);
+}
+
+//------------------------------------------------------------------------------
+int
+reverser::replay(yakc& emu, int index, uint64_t cycle_count) {
+    const checkpoint& c = this->cp(index);
+    c.state.clone(emu);
+    z80dbg& dbg = emu.board.dbg;
+    uint64_t cur_cycle_count = c.cycle_count;
+    int pos = c.log_pos;
+    while (pos < this->log.data.size) {
+        const int event_pos = pos;
+        eventlog::event e;
+        if (!this->log.read(pos, cur_cycle_count, e)) {
+            // corrupt log
+            YAKC_ASSERT(false);
+            this->desyncs++;
+            pos = this->log.data.size;
+            break;
+        }
+        if (e.cycle_count > cycle_count) {
+            if (eventlog::event_frame == e.type) {
+                // the target is inside this frame, stop there
+                dbg.paused = false;
+                eventlog::run_to(emu, cycle_count);
+                if (emu.cycle_count() != cycle_count) {
+                    this->desyncs++;
+                }
+            }
+            pos = event_pos;
+            break;
+        }
+        if (eventlog::event_frame == e.type) {
+            // run exactly up to the logged end of the frame
+            dbg.paused = false;
+            eventlog::run_to(emu, e.end_cycle_count);
+            if (emu.cycle_count() != e.cycle_count) {
+                this->desyncs++;
+            }
+        }
+        else if (eventlog::event_paused_frames == e.type) {
+            dbg.paused = true;
+            for (int i = 0; i < e.num_frames; i++) {
+                emu.onframe(1, 0, 0, 0);
+            }
+        }
+        else if (!eventlog::apply_input(emu, e)) {
+            this->desyncs++;
+        }
+        cur_cycle_count = e.cycle_count;
+    }
+    this->replay_cycle_count = cur_cycle_count;
+    return pos;
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::go_to(yakc& emu, int index, uint64_t cycle_count) {
+    YAKC_ASSERT(cycle_count < this->log.last_cycle_count);
+    emu.board.dbg = z80dbg();
+    const int pos = this->replay(emu, index, cycle_count);
+
+    // continue the history from here, the partially replayed
+    // frame is replaced with a frame which ends at the target
+    this->log.data.size = pos;
+    this->log.last_cycle_count = this->replay_cycle_count;
+    while ((this->num > 1) && (this->cp(this->num - 1).log_pos > pos)) {
+        this->cp(--this->num).state.discard();
+    }
+    this->log.write_frame(emu);
+    this->frames_since_checkpoint = 0;
+    this->last_key = -1;
+}
+
+//------------------------------------------------------------------------------
+bool
+reverser::step_back(yakc& emu) {
+    if (!this->can_reverse(emu)) {
+        return false;
+    }
+    this->flush_paused_frames();
+    const uint64_t cur_cycle_count = emu.cycle_count();
+    const int index = this->find_checkpoint(cur_cycle_count);
+    if (index < 0) {
+        return false;
+    }
+    z80dbg& dbg = emu.board.dbg;
+    const z80dbg saved_dbg = dbg;
+    this->begin_replay(emu);
+
+    // find the previous instruction with a non-stopping breakpoint on every address
+    dbg = z80dbg();
+    dbg.stop_on_break = false;
+    for (int addr = 0; addr < (1<<16); addr++) {
+        dbg.add_breakpoint(uword(addr));
+    }
+    this->replay(emu, index, cur_cycle_count);
+    YAKC_ASSERT(dbg.break_reason == z80dbg::break_pc);
+    const uint64_t prev_cycle_count = dbg.break_cycle;
+
+    // ...and go there
+    this->go_to(emu, index, prev_cycle_count);
+    restore_dbg(dbg, saved_dbg);
+    dbg.paused = true;
+    dbg.break_reason = z80dbg::break_none;
+    this->end_replay(emu);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+reverser::reverse_continue(yakc& emu) {
+    if (!this->can_reverse(emu)) {
+        return false;
+    }
+    this->flush_paused_frames();
+    const uint64_t cur_cycle_count = emu.cycle_count();
+    z80dbg& dbg = emu.board.dbg;
+    const z80dbg saved_dbg = dbg;
+    this->scratch.capture(emu);
+    this->begin_replay(emu);
+
+    // search the segments between checkpoints from newest to oldest,
+    // with the debugger's breakpoints recording hits without stopping
+    bool found = false;
+    for (int i = this->find_checkpoint(cur_cycle_count); (i >= 0) && !found; i--) {
+        uint64_t end_cycle_count = cur_cycle_count;
+        if ((i + 1) < this->num) {
+            const uint64_t next_cycle_count = this->cp(i + 1).cycle_count;
+            if (next_cycle_count < end_cycle_count) {
+                end_cycle_count = next_cycle_count;
+            }
+        }
+        dbg = saved_dbg;
+        dbg.stop_on_break = false;
+        dbg.break_reason = z80dbg::break_none;
+        this->replay(emu, i, end_cycle_count);
+        if (dbg.break_reason != z80dbg::break_none) {
+            // the last hit in the segment is the one we're looking for
+            const z80dbg::break_type reason = dbg.break_reason;
+            const uword addr = dbg.break_addr;
+            const uint64_t hit_cycle_count = dbg.break_cycle;
+            this->go_to(emu, i, hit_cycle_count);
+            restore_dbg(dbg, saved_dbg);
+            dbg.break_reason = reason;
+            dbg.break_addr = addr;
+            dbg.break_cycle = hit_cycle_count;
+            dbg.paused = true;
+            found = true;
+        }
+    }
+    if (!found) {
+        // no hit in the whole history, back to the present
+        this->scratch.clone(emu);
+        dbg = saved_dbg;
+    }
+    this->end_replay(emu);
+    this->scratch.discard();
+    return found;
+}
+
+//------------------------------------------------------------------------------
+void
+reverser::step(yakc& emu) {
+    YAKC_ASSERT(emu.switchedon());
+    // run the machine for a single cycle, this executes exactly one
+    // instruction, without stopping at a breakpoint on it
+    z80dbg& dbg = emu.board.dbg;
+    const z80dbg saved_dbg = dbg;
+    dbg.stop_on_break = false;
+    dbg.paused = false;
+    const uint64_t end_cycle_count = emu.cycle_count() + 1;
+    emu.onframe(1, 0, end_cycle_count, end_cycle_count);
+    restore_dbg(dbg, saved_dbg);
+    dbg.paused = true;
+}
+
+//------------------------------------------------------------------------------
+int
+reverser::num_checkpoints() const {
+    return this->num;
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+reverser::oldest_cycle_count() const {
+    return (this->num > 0) ? this->checkpoints[this->first].cycle_count : 0;
+}
+
+//------------------------------------------------------------------------------
+int
+reverser::num_bytes() const {
+    int bytes = this->log.data.capacity;
+    for (int i = 0; i < this->num; i++) {
+        bytes += this->checkpoints[(this->first + i) % max_checkpoints].state.num_bytes();
+    }
+    return bytes;
+}
+
+//------------------------------------------------------------------------------
+int
+reverser::num_desyncs() const {
+    return this->desyncs;
+}
+
+} // namespace YAKC
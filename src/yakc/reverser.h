@@ -0,0 +1,139 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::reverser
+    @brief reverse stepping and reverse-continue for the debugger
+
+    When hooked into the emulator (yakc::reverse_debugger), the reverser
+    captures a checkpoint of the machine state (a forkpoint) every
+    checkpoint_interval frames, and logs everything which happens
+    between checkpoints in the same event log format as a movie (see
+    the eventlog class): where each frame ended, frames which ran while
+    the debugger was paused (the systems still poll the keyboard), key
+    input, KC85 module changes and reset.
+
+    Since the emulation is deterministic, any earlier instruction can be
+    reached again by restoring the nearest checkpoint before it and
+    replaying the log up to its cycle count:
+
+    - step_back() goes back to the previous instruction, it replays from
+      the checkpoint once to find the cycle count of the previous
+      instruction (with a breakpoint on every address), and once more
+      to stop there
+    - reverse_continue() goes back to the most recent breakpoint,
+      watchpoint or I/O breakpoint hit, it replays the segments between
+      checkpoints from newest to oldest with the debugger's breakpoints
+      (without stopping) until a segment contains a hit
+    - step() goes forward one instruction, unlike z80dbg::step_pc_modified()
+      this runs the whole machine (clock, timers and cycle counter), so
+      that it can be logged and replayed
+
+    Going back truncates the log, continuing from there records a new
+    future. Block instructions (LDIR etc.) count one step per iteration.
+
+    The checkpoints cover history_frames frames, so a shorter checkpoint
+    interval means more checkpoints and memory, but less replay on each
+    reverse step (reverse-continue has to replay up to the whole history
+    if there's no breakpoint hit).
+
+    The log only contains input, so the machine state must not be changed
+    from outside the emulation while the reverser is hooked in (loading
+    files, editing memory or registers, applying snapshots or rewinding),
+    call clear() afterwards to start a new history. A history is also
+    started whenever the cycle counter doesn't continue the log (e.g.
+    after switching systems).
+*/
+#include "yakc/forkpoint.h"
+#include "yakc/quietscope.h"
+#include "yakc/eventlog.h"
+
+namespace YAKC {
+
+class reverser {
+public:
+    /// max number of checkpoints
+    static const int max_checkpoints = 256;
+    /// a checkpoint is captured every N running frames
+    int checkpoint_interval = 50;
+    /// number of running frames to keep in the history
+    int history_frames = 50 * 60;
+
+    /// destructor
+    ~reverser();
+    /// drop the history
+    void clear();
+
+    /// go back one instruction, false if not possible
+    bool step_back(yakc& emu);
+    /// go back to the previous breakpoint hit, false if there's none in the history
+    bool reverse_continue(yakc& emu);
+    /// go forward one instruction and pause
+    void step(yakc& emu);
+
+    /// called from yakc::onframe() before a frame
+    void begin_frame(yakc& emu);
+    /// called from yakc::onframe() after a frame
+    void end_frame(const yakc& emu);
+    /// called from yakc::put_key()
+    void on_key(const yakc& emu, ubyte ascii);
+    /// called from yakc::insert_module()
+    void on_insert_module(const yakc& emu, ubyte slot_addr, kc85_exp::module_type type);
+    /// called from yakc::remove_module()
+    void on_remove_module(const yakc& emu, ubyte slot_addr);
+    /// called from yakc::reset()
+    void on_reset(const yakc& emu);
+
+    /// number of checkpoints
+    int num_checkpoints() const;
+    /// cycle count of the oldest checkpoint
+    uint64_t oldest_cycle_count() const;
+    /// memory used by the checkpoints and the log in bytes
+    int num_bytes() const;
+    /// number of replayed frames which didn't end at the logged cycle count
+    int num_desyncs() const;
+
+private:
+    struct checkpoint {
+        forkpoint state;
+        uint64_t cycle_count = 0;
+        int log_pos = 0;
+    };
+    /// get a checkpoint by age (0 is the oldest)
+    checkpoint& cp(int index);
+    /// max number of checkpoints for the current interval
+    int checkpoint_limit() const;
+    /// capture a new checkpoint, drop the oldest if needed
+    void add_checkpoint(yakc& emu);
+    /// drop the oldest checkpoint and the log before the next
+    void drop_oldest();
+    /// return true if the history can be replayed up to the current state
+    bool can_reverse(const yakc& emu) const;
+    /// index of the newest checkpoint before a cycle count, or -1
+    int find_checkpoint(uint64_t cycle_count) const;
+    /// mute sound and unhook recorders before replaying
+    void begin_replay(yakc& emu);
+    /// restore sound and recorders after replaying
+    void end_replay(yakc& emu);
+    /// restore a checkpoint and replay the log up to a cycle count (with the current debugger state),
+    /// return the log position of the frame which ended after the cycle count (or the log size)
+    int replay(yakc& emu, int index, uint64_t cycle_count);
+    /// replay up to a cycle count and continue the history from there
+    void go_to(yakc& emu, int index, uint64_t cycle_count);
+    /// write pending paused frames into the log, must be called before writing other events
+    void flush_paused_frames();
+
+    checkpoint checkpoints[max_checkpoints];
+    int first = 0;
+    int num = 0;
+    eventlog log;
+    uint64_t replay_cycle_count = 0;
+    int frames_since_checkpoint = 0;
+    int paused_frames = 0;
+    int last_key = -1;
+    int desyncs = 0;
+    bool frame_paused = false;
+    forkpoint scratch;
+    quietscope quiet;
+};
+
+} // namespace YAKC
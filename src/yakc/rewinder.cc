@@ -0,0 +1,398 @@
+//------------------------------------------------------------------------------
+//  rewinder.cc
+//------------------------------------------------------------------------------
+#include "rewinder.h"
+
+namespace YAKC {
+
+//  Recorded frame data:
+//
+//  - keyframes start with the bank layout: a ubyte bank count, followed
+//    by a bank_desc for each bank
+//  - followed by the changed segments of the state image, each a uword
+//    segment index (0 is the sys_t struct, N is the (N-1)th 1 KByte page of
+//    the memory banks) and the run-length encoded segment content as
+//    pairs of a uword zero-run length and a uword literal length followed
+//    by the literal bytes, until the segment is complete
+//  - the frame ends with the segment index end_marker
+//
+#pragma pack(push,1)
+struct bank_desc {
+    ubyte type;
+    ubyte index;
+    uword num_pages;
+};
+#pragma pack(pop)
+static const uword end_marker = 0xFFFF;
+static const int sys_size = sizeof(snapshot::sys_t);
+static_assert(sys_size <= memory::page::size, "sys_t must fit into a memory page!");
+/// min number of zero bytes to interrupt a literal run
+static const int min_zero_run = 4;
+
+//------------------------------------------------------------------------------
+static int
+segment_offset(int index) {
+    return index == 0 ? 0 : sys_size + (index - 1) * memory::page::size;
+}
+
+//------------------------------------------------------------------------------
+static int
+segment_size(int index) {
+    return index == 0 ? sys_size : memory::page::size;
+}
+
+//------------------------------------------------------------------------------
+rewinder::~rewinder() {
+    this->clear();
+    this->scratch.discard();
+    if (this->image) {
+        YAKC_FREE(this->funcs, this->image);
+        this->image = nullptr;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+rewinder::clear() {
+    while (this->count > 0) {
+        this->drop_newest();
+    }
+    this->head = 0;
+    this->frames_since_keyframe = 0;
+    this->num_banks = 0;
+    this->image_size = 0;
+}
+
+//------------------------------------------------------------------------------
+int
+rewinder::num_frames() const {
+    return this->count;
+}
+
+//------------------------------------------------------------------------------
+int
+rewinder::num_bytes() const {
+    return this->total_size;
+}
+
+//------------------------------------------------------------------------------
+int
+rewinder::last_frame_size() const {
+    if (this->count > 0) {
+        return this->frames[(this->head + this->count - 1) % max_frames].size;
+    }
+    else {
+        return 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+rewinder::frame&
+rewinder::at(int index) {
+    YAKC_ASSERT((index >= 0) && (index < this->count));
+    return this->frames[(this->head + index) % max_frames];
+}
+
+//------------------------------------------------------------------------------
+void
+rewinder::drop_newest() {
+    YAKC_ASSERT(this->count > 0);
+    frame& f = this->at(this->count - 1);
+    this->total_size -= f.size;
+    YAKC_FREE(this->funcs, f.data);
+    f = frame();
+    this->count--;
+}
+
+//------------------------------------------------------------------------------
+bool
+rewinder::drop_oldest() {
+    // find the next keyframe, the oldest frame is always a keyframe
+    int next = 1;
+    while ((next < this->count) && !this->at(next).keyframe) {
+        next++;
+    }
+    if (next >= this->count) {
+        return false;
+    }
+    for (int i = 0; i < next; i++) {
+        frame& f = this->at(0);
+        this->total_size -= f.size;
+        YAKC_FREE(this->funcs, f.data);
+        f = frame();
+        this->head = (this->head + 1) % max_frames;
+        this->count--;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+rewinder::layout_matches(const snapshot::bank_t* banks, int num) const {
+    if (num != this->num_banks) {
+        return false;
+    }
+    for (int i = 0; i < num; i++) {
+        const snapshot::bank_t& l = this->layout[i];
+        if ((l.type != banks[i].type) || (l.index != banks[i].index) || (l.size != banks[i].size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void
+rewinder::set_layout(const snapshot::bank_t* banks, int num) {
+    YAKC_ASSERT(num <= snapshot::max_banks);
+    this->num_banks = num;
+    this->image_size = sys_size;
+    for (int i = 0; i < num; i++) {
+        this->layout[i] = banks[i];
+        this->layout[i].ptr = nullptr;
+        this->image_size += banks[i].size;
+    }
+    if (this->image_size > this->image_capacity) {
+        if (this->image) {
+            YAKC_FREE(this->funcs, this->image);
+        }
+        this->image = (ubyte*) YAKC_MALLOC(this->funcs, this->image_size);
+        this->image_capacity = this->image_size;
+    }
+    memset(this->image, 0, this->image_size);
+}
+
+//------------------------------------------------------------------------------
+void
+rewinder::encode(uword index, const ubyte* cur, const ubyte* base, int len) {
+    ubyte buf[memory::page::size];
+    const ubyte* src = cur;
+    if (base) {
+        for (int i = 0; i < len; i++) {
+            buf[i] = cur[i] ^ base[i];
+        }
+        src = buf;
+    }
+    snapshot::membuf::write(&this->scratch, &index, sizeof(index));
+    int pos = 0;
+    while (pos < len) {
+        int start = pos;
+        while ((pos < len) && (0 == src[pos])) {
+            pos++;
+        }
+        const uword zero_run = uword(pos - start);
+        // the literal run ends at the next long-enough zero run
+        start = pos;
+        int zeros = 0;
+        while ((pos < len) && (zeros < min_zero_run)) {
+            zeros = src[pos++] ? 0 : zeros + 1;
+        }
+        if (zeros > 0) {
+            pos -= zeros;
+        }
+        const uword lit_len = uword(pos - start);
+        snapshot::membuf::write(&this->scratch, &zero_run, sizeof(zero_run));
+        snapshot::membuf::write(&this->scratch, &lit_len, sizeof(lit_len));
+        snapshot::membuf::write(&this->scratch, src + start, lit_len);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+rewinder::decode(const frame& f) {
+    const ubyte* ptr = f.data;
+    if (f.keyframe) {
+        ptr += 1 + ptr[0] * sizeof(bank_desc);
+    }
+    for (;;) {
+        uword index;
+        memcpy(&index, ptr, sizeof(index));
+        ptr += sizeof(index);
+        if (end_marker == index) {
+            break;
+        }
+        ubyte* dst = this->image + segment_offset(index);
+        const int len = segment_size(index);
+        YAKC_ASSERT(segment_offset(index) + len <= this->image_size);
+        int pos = 0;
+        while (pos < len) {
+            uword zero_run, lit_len;
+            memcpy(&zero_run, ptr, sizeof(zero_run));
+            memcpy(&lit_len, ptr + sizeof(zero_run), sizeof(lit_len));
+            ptr += sizeof(zero_run) + sizeof(lit_len);
+            pos += zero_run;
+            for (int i = 0; i < lit_len; i++) {
+                dst[pos++] ^= *ptr++;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+rewinder::rebuild(int index) {
+    int key = index;
+    while (!this->at(key).keyframe) {
+        key--;
+    }
+    const frame& kf = this->at(key);
+    const int num = kf.data[0];
+    snapshot::bank_t banks[snapshot::max_banks];
+    for (int i = 0; i < num; i++) {
+        bank_desc desc;
+        memcpy(&desc, kf.data + 1 + i * sizeof(desc), sizeof(desc));
+        banks[i].type = desc.type;
+        banks[i].index = desc.index;
+        banks[i].size = desc.num_pages * memory::page::size;
+    }
+    this->set_layout(banks, num);
+    for (int i = key; i <= index; i++) {
+        this->decode(this->at(i));
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+rewinder::apply(yakc& emu) const {
+    snapshot::sys_t sys;
+    memcpy(&sys, this->image, sys_size);
+    snapshot::apply_sys_state(sys, emu);
+    snapshot::bank_t banks[snapshot::max_banks];
+    const int num = snapshot::enumerate_banks(emu, banks, snapshot::max_banks);
+    YAKC_ASSERT(this->layout_matches(banks, num));
+    const ubyte* src = this->image + sys_size;
+    for (int i = 0; i < num; i++) {
+        memcpy(banks[i].ptr, src, banks[i].size);
+        src += banks[i].size;
+    }
+    snapshot::after_apply(emu);
+}
+
+//------------------------------------------------------------------------------
+void
+rewinder::record(yakc& emu) {
+    YAKC_ASSERT(this->keyframe_interval < max_frames);
+    if (!emu.switchedon()) {
+        return;
+    }
+    // don't end copy-on-write sharing, still shared pages are read from their source
+    memory& mem = emu.board.cpu.mem;
+    snapshot::bank_t banks[snapshot::max_banks];
+    const int num = snapshot::enumerate_banks(emu, banks, snapshot::max_banks, false);
+    snapshot::sys_t sys;
+    snapshot::write_sys_state(emu, sys);
+    if (&mem != this->tracked_mem) {
+        // the dirty pages of another emulator's memory don't match the state image
+        mem.untrack();
+        this->tracked_mem = &mem;
+    }
+    if (emu.funcs.free_func != this->funcs.free_func) {
+        // allocate through the emulator's memory functions
+        this->clear();
+        this->scratch.discard();
+        if (this->image) {
+            YAKC_FREE(this->funcs, this->image);
+            this->image = nullptr;
+            this->image_capacity = 0;
+        }
+        this->funcs = emu.funcs;
+    }
+
+    const bool keyframe = (0 == this->count) ||
+        (this->frames_since_keyframe >= this->keyframe_interval) ||
+        !this->layout_matches(banks, num);
+    this->scratch.funcs = this->funcs;
+    this->scratch.size = 0;
+    if (keyframe) {
+        // a keyframe is encoded against an all-zero state
+        this->set_layout(banks, num);
+        const ubyte num_descs = ubyte(num);
+        snapshot::membuf::write(&this->scratch, &num_descs, sizeof(num_descs));
+        for (int i = 0; i < num; i++) {
+            bank_desc desc;
+            desc.type = banks[i].type;
+            desc.index = banks[i].index;
+            desc.num_pages = uword(banks[i].size / memory::page::size);
+            snapshot::membuf::write(&this->scratch, &desc, sizeof(desc));
+        }
+        this->frames_since_keyframe = 0;
+    }
+    else {
+        this->frames_since_keyframe++;
+    }
+
+    // encode all segments which differ from the previous frame, only
+    // pages written since the previous frame can differ
+    const ubyte* base = keyframe ? nullptr : this->image;
+    uword index = 0;
+    ubyte* dst = this->image;
+    if (0 != memcmp(dst, &sys, sys_size)) {
+        this->encode(index, (const ubyte*)&sys, base, sys_size);
+        memcpy(dst, &sys, sys_size);
+    }
+    index++;
+    dst += sys_size;
+    for (int i = 0; i < num; i++) {
+        const int num_pages = banks[i].size >> memory::page::shift;
+        const uint64_t dirty = keyframe ? ~uint64_t(0) : mem.dirty_pages(banks[i].ptr, banks[i].size);
+        for (int page = 0; page < num_pages; page++) {
+            if (dirty & (uint64_t(1)<<page)) {
+                const ubyte* src = mem.page_content(banks[i].ptr + (page << memory::page::shift));
+                if (0 != memcmp(dst, src, memory::page::size)) {
+                    this->encode(index, src, base ? dst : nullptr, memory::page::size);
+                    memcpy(dst, src, memory::page::size);
+                }
+            }
+            index++;
+            dst += memory::page::size;
+        }
+    }
+    snapshot::membuf::write(&this->scratch, &end_marker, sizeof(end_marker));
+    for (int i = 0; i < num; i++) {
+        mem.track(banks[i].ptr, banks[i].size);
+    }
+    mem.clear_dirty();
+
+    // make room and store the new frame
+    if (this->count == max_frames) {
+        // can't fail since keyframe_interval < max_frames
+        const bool dropped = this->drop_oldest();
+        YAKC_ASSERT(dropped);
+        (void)dropped;
+    }
+    frame& f = this->frames[(this->head + this->count) % max_frames];
+    this->count++;
+    f.data = (ubyte*) YAKC_MALLOC(this->funcs, this->scratch.size);
+    memcpy(f.data, this->scratch.ptr, this->scratch.size);
+    f.size = this->scratch.size;
+    f.keyframe = keyframe;
+    this->total_size += f.size;
+    while ((this->total_size > this->budget) && this->drop_oldest()) {
+        // drop keyframes until within budget
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+rewinder::step_back(yakc& emu) {
+    if (this->count < 2) {
+        return false;
+    }
+    const frame& newest = this->at(this->count - 1);
+    if (newest.keyframe) {
+        this->rebuild(this->count - 2);
+    }
+    else {
+        // XOR deltas are symmetric, so this goes back one frame
+        this->decode(newest);
+    }
+    this->drop_newest();
+    this->frames_since_keyframe = 0;
+    while (!this->at(this->count - 1 - this->frames_since_keyframe).keyframe) {
+        this->frames_since_keyframe++;
+    }
+    this->apply(emu);
+    return true;
+}
+
+} // namespace YAKC
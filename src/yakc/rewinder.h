@@ -0,0 +1,105 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::rewinder
+    @brief continuous rewind ring buffer of keyframe and delta snapshots
+
+    When hooked into the emulator (yakc::rewind_buffer), the rewinder
+    records the machine state after each emulated frame. Every
+    keyframe_interval frames (and whenever the memory bank layout changes,
+    e.g. after switching systems or modules) a full keyframe is recorded,
+    all other frames are stored as deltas to the previous frame.
+
+    The recorded state is the snapshot::sys_t struct plus all memory
+    banks which exist on the running system, split into 1 KByte pages.
+    A delta only contains the pages which have changed since the previous
+    frame, XOR'ed with their previous content and run-length encoded, so
+    the size of a delta is proportional to what the emulated program
+    actually wrote. Only the pages written through the memory write path
+    since the previous frame are compared (see memory::track()), and
+    pages still shared copy-on-write with a forkpoint are read from their
+    source without ending the sharing. Keyframes use the same encoding against an all-zero
+    state (so that all-zero pages are skipped).
+
+    Since XOR deltas work in both directions, step_back() can go back
+    one frame by applying the newest delta to the current state, only
+    when stepping back over a keyframe the previous state must be
+    reconstructed from the keyframe before it.
+
+    When the recorded data grows above the memory budget, the oldest
+    keyframe and its deltas are dropped.
+*/
+#include "yakc/snapshot.h"
+
+namespace YAKC {
+
+class rewinder {
+public:
+    /// destructor
+    ~rewinder();
+
+    /// max number of recorded frames
+    static const int max_frames = 8192;
+    /// memory budget for recorded frames in bytes
+    int budget = 16 * 1024 * 1024;
+    /// a keyframe is recorded every N frames
+    int keyframe_interval = 50;
+
+    /// record the current state as the newest frame (no-op if switched off)
+    void record(yakc& emu);
+    /// restore the frame before the newest, return false if no more frames
+    bool step_back(yakc& emu);
+    /// drop all recorded frames
+    void clear();
+    /// number of recorded frames
+    int num_frames() const;
+    /// number of bytes used by the recorded frames
+    int num_bytes() const;
+    /// size in bytes of the most recently recorded frame
+    int last_frame_size() const;
+
+private:
+    /// a recorded frame
+    struct frame {
+        ubyte* data = nullptr;
+        int size = 0;
+        bool keyframe = false;
+    };
+    /// get frame by index, 0 is the oldest frame
+    frame& at(int index);
+    /// drop the oldest keyframe and its deltas, return false if only one keyframe left
+    bool drop_oldest();
+    /// drop the newest frame
+    void drop_newest();
+    /// set a new memory bank layout and allocate the state image
+    void set_layout(const snapshot::bank_t* banks, int num_banks);
+    /// test if the memory bank layout matches the current state image
+    bool layout_matches(const snapshot::bank_t* banks, int num_banks) const;
+    /// encode a state segment into the scratch buffer, base may be null
+    void encode(uword index, const ubyte* cur, const ubyte* base, int len);
+    /// XOR-decode the segments of a recorded frame into the state image
+    void decode(const frame& f);
+    /// rebuild the state image from the nearest keyframe
+    void rebuild(int index);
+    /// apply the state image to the emulator
+    void apply(yakc& emu) const;
+
+    frame frames[max_frames];
+    int head = 0;
+    int count = 0;
+    int total_size = 0;
+    int frames_since_keyframe = 0;
+    snapshot::membuf scratch;
+
+    /// the state image of the newest frame: sys_t followed by the memory banks
+    snapshot::bank_t layout[snapshot::max_banks];
+    int num_banks = 0;
+    ubyte* image = nullptr;
+    int image_size = 0;
+    int image_capacity = 0;
+    ext_funcs funcs;    // taken from the recorded emulator
+    /// the memory whose dirty pages are tracked since the newest frame
+    const memory* tracked_mem = nullptr;
+};
+
+} // namespace YAKC
@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+//  runahead.cc
+//------------------------------------------------------------------------------
+#include "runahead.h"
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+bool
+runahead::run(yakc& emu, int micro_secs) {
+    z80dbg& dbg = emu.board.dbg;
+    if ((this->num_frames <= 0) || !emu.switchedon() || dbg.paused) {
+        return false;
+    }
+    this->saved.capture(emu);
+
+    // run into the future quietly, and with the debugger suspended,
+    // so that breakpoints are ignored and the PC history doesn't
+    // show the future either
+    const bool cpu_ahead = emu.kc85.cpu_ahead;
+    const bool cpu_behind = emu.kc85.cpu_behind;
+    this->quiet.begin(emu, true);
+    for (int i = 0; i < this->num_frames; i++) {
+        emu.onframe(1, micro_secs, 0, 0);
+        this->num_emulated_frames++;
+    }
+
+    // ...and back to the present, this must happen with muted
+    // sound too, since applying the state resets the sound channels
+    this->saved.clone(emu);
+    this->quiet.end(emu);
+    emu.kc85.cpu_ahead = cpu_ahead;
+    emu.kc85.cpu_behind = cpu_behind;
+    return true;
+}
+
+} // namespace YAKC
@@ -0,0 +1,45 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::runahead
+    @brief reduce visible input latency by running the emulator ahead
+
+    Many programs only react to keyboard input one or more frames after
+    the key has been pressed (for instance KC85 programs which poll the
+    key-ready flag that kc85::handle_keyboard_input() patches into RAM).
+    After the regular emulator frame, run() saves the machine state into
+    a forkpoint, emulates num_frames additional frames with the current
+    input (with sound output muted and without recording into the rewind
+    buffer, a movie or the reverse debugger), and restores the saved
+    state. The video buffer isn't part of the machine state, so it still
+    contains the output of the last future frame, which is what will be
+    displayed.
+
+    Restoring the state is cheap since the forkpoint shares the RAM
+    pages copy-on-write with the running emulator, so only the pages
+    written by the run-ahead frames are copied back.
+
+    Breakpoints hit in a run-ahead frame are ignored.
+*/
+#include "yakc/forkpoint.h"
+#include "yakc/quietscope.h"
+
+namespace YAKC {
+
+class runahead {
+public:
+    /// number of frames to run ahead, 0 disables run-ahead
+    int num_frames = 0;
+
+    /// run ahead and restore, return false if run-ahead wasn't possible
+    bool run(yakc& emu, int micro_secs);
+
+    /// number of run-ahead frames emulated since start
+    uint64_t num_emulated_frames = 0;
+
+private:
+    forkpoint saved;
+    quietscope quiet;
+};
+
+} // namespace YAKC
@@ -2,6 +2,8 @@
 //  snapshot.cc
 //------------------------------------------------------------------------------
 #include "snapshot.h"
+#include "zlib.h"
+#include <stddef.h>
 
 namespace YAKC {
 
@@ -13,18 +15,14 @@ snapshot::is_snapshot(const state_t& state) {
 
 //------------------------------------------------------------------------------
 void
-snapshot::take_snapshot(const yakc& emu, state_t& state) {
-    memset(&state, 0, sizeof(state));
+snapshot::take_snapshot(yakc& emu, state_t& state) {
+    clear(state.ram, sizeof(state.ram));
+    clear(state.irm, sizeof(state.irm));
+    clear(state.ram8, sizeof(state.ram8));
+    clear(state.ramC, sizeof(state.ramC));
     state.magic = 'YAKC';
     state.version = 1;
-    write_emu_state(emu, state);
-    write_clock_state(emu, state);
-    write_cpu_state(emu, state);
-    write_ctc_state(emu, state);
-    write_pio_state(emu, state);
-    write_kc_state(emu, state);
-    write_z1013_state(emu, state);
-    write_z9001_state(emu, state);
+    write_sys_state(emu, state.sys);
     write_memory_state(emu, state);
 }
 
@@ -32,15 +30,43 @@ snapshot::take_snapshot(const yakc& emu, state_t& state) {
 void
 snapshot::apply_snapshot(const state_t& state, yakc& emu) {
     YAKC_ASSERT(is_snapshot(state));
-    apply_emu_state(state, emu);
-    apply_clock_state(state, emu);
-    apply_cpu_state(state, emu);
-    apply_ctc_state(state, emu);
-    apply_pio_state(state, emu);
-    apply_kc_state(state, emu);
-    apply_z1013_state(state, emu);
-    apply_z9001_state(state, emu);
+    apply_sys_state(state.sys, emu);
     apply_memory_state(state, emu);
+    after_apply(emu);
+}
+
+//------------------------------------------------------------------------------
+void
+snapshot::write_sys_state(const yakc& emu, sys_t& sys) {
+    sys = sys_t();
+    write_emu_state(emu, sys);
+    write_clock_state(emu, sys);
+    write_cpu_state(emu, sys);
+    write_ctc_state(emu, sys);
+    write_pio_state(emu, sys);
+    write_kc_state(emu, sys);
+    write_z1013_state(emu, sys);
+    write_z9001_state(emu, sys);
+}
+
+//------------------------------------------------------------------------------
+void
+snapshot::apply_sys_state(const sys_t& sys, yakc& emu) {
+    apply_emu_state(sys, emu);
+    apply_clock_state(sys, emu);
+    apply_cpu_state(sys, emu);
+    apply_ctc_state(sys, emu);
+    apply_pio_state(sys, emu);
+    apply_kc_state(sys, emu);
+    apply_z1013_state(sys, emu);
+    apply_z9001_state(sys, emu);
+}
+
+//------------------------------------------------------------------------------
+void
+snapshot::after_apply(yakc& emu) {
+    // the memory banks were written around the memory write path
+    emu.board.cpu.mem.untrack();
     if (emu.is_device(device::any_kc85)) {
         emu.kc85.after_apply_snapshot();
     }
@@ -52,66 +78,556 @@ snapshot::apply_snapshot(const state_t& state, yakc& emu) {
     }
 }
 
+//------------------------------------------------------------------------------
+static void
+add_bank(snapshot::bank_t* banks, int& num, int max_num, snapshot::bank_type type, int index, const void* ptr, int size) {
+    YAKC_ASSERT(num < max_num);
+    YAKC_ASSERT((size & memory::page::mask) == 0);
+    snapshot::bank_t& bank = banks[num++];
+    bank.type = ubyte(type);
+    bank.index = ubyte(index);
+    bank.ptr = (ubyte*) ptr;
+    bank.size = size;
+}
+
+//------------------------------------------------------------------------------
+int
+snapshot::enumerate_banks(yakc& emu, bank_t* out_banks, int max_num_banks, bool unshare) {
+    // the bank content must be complete, so end copy-on-write sharing
+    if (unshare) {
+        emu.board.cpu.mem.unshare();
+    }
+    int num = 0;
+    if (emu.is_device(device::any_kc85)) {
+        const kc85& kc = emu.kc85;
+        const int num_ram_banks = emu.is_device(device::kc85_4) ? 4 : 1;
+        for (int i = 0; i < num_ram_banks; i++) {
+            add_bank(out_banks, num, max_num_banks, bank_ram, i, kc.ram[i], sizeof(kc.ram[i]));
+            add_bank(out_banks, num, max_num_banks, bank_video, i, kc.video.irm[i], sizeof(kc.video.irm[i]));
+        }
+        for (const auto& slot : kc.exp.slots) {
+            if (slot.mod.mem_ptr && slot.mod.mem_owned) {
+                add_bank(out_banks, num, max_num_banks, bank_module, slot.slot_addr, slot.mod.mem_ptr, slot.mod.mem_size);
+            }
+        }
+    }
+    else if (emu.is_device(device::any_z1013)) {
+        const int ram_size = emu.is_device(device::z1013_64) ? 0x10000 : 0x4000;
+        add_bank(out_banks, num, max_num_banks, bank_ram, 0, emu.z1013.ram, ram_size);
+        add_bank(out_banks, num, max_num_banks, bank_video, 0, emu.z1013.irm, z1013::irm_size);
+    }
+    else if (emu.is_device(device::any_z9001)) {
+        const int ram_size = emu.is_device(device::kc87) ? 0xC000 : 0x8000;
+        add_bank(out_banks, num, max_num_banks, bank_ram, 0, emu.z9001.ram, ram_size);
+        add_bank(out_banks, num, max_num_banks, bank_video, 0, emu.z9001.video_ram, z9001::video_ram_size);
+        add_bank(out_banks, num, max_num_banks, bank_color, 0, emu.z9001.color_ram, z9001::color_ram_size);
+    }
+    return num;
+}
+
+//------------------------------------------------------------------------------
+void
+snapshot::membuf::discard() {
+    if (this->ptr) {
+        YAKC_FREE(this->funcs, this->ptr);
+    }
+    const ext_funcs f = this->funcs;
+    *this = membuf();
+    this->funcs = f;
+}
+
+//------------------------------------------------------------------------------
+bool
+snapshot::membuf::write(void* userdata, const void* src, int num_bytes) {
+    membuf* self = (membuf*) userdata;
+    if ((self->size + num_bytes) > self->capacity) {
+        int new_capacity = self->capacity > 0 ? self->capacity * 2 : 0x4000;
+        while (new_capacity < (self->size + num_bytes)) {
+            new_capacity *= 2;
+        }
+        ubyte* new_ptr = (ubyte*) YAKC_MALLOC(self->funcs, new_capacity);
+        if (self->ptr) {
+            memcpy(new_ptr, self->ptr, self->size);
+            YAKC_FREE(self->funcs, self->ptr);
+        }
+        self->ptr = new_ptr;
+        self->capacity = new_capacity;
+    }
+    memcpy(self->ptr + self->size, src, num_bytes);
+    self->size += num_bytes;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+int
+snapshot::membuf::read(void* userdata, void* dst, int max_bytes) {
+    membuf* self = (membuf*) userdata;
+    int num_bytes = self->size - self->pos;
+    if (num_bytes > max_bytes) {
+        num_bytes = max_bytes;
+    }
+    memcpy(dst, self->ptr + self->pos, num_bytes);
+    self->pos += num_bytes;
+    return num_bytes;
+}
+
+//------------------------------------------------------------------------------
+//  chunk ids and versions of the version 2 format
+//
+static const uint32_t chunk_bank = 'BANK';
+static const uint32_t chunk_end = 'END ';
+static const uint32_t bank_chunk_version = 1;
+
+//------------------------------------------------------------------------------
+//  the non-memory state is written as one chunk per subsystem, each
+//  with its own version, so that a reader can skip the subsystems it
+//  doesn't understand instead of rejecting the whole snapshot
+//
+struct sys_chunk {
+    uint32_t id;
+    uint32_t version;
+    int offset;             // offset of the subsystem state in sys_t
+    int size;
+};
+static const sys_chunk sys_chunks[] = {
+    { 'EMU ', 1, offsetof(snapshot::sys_t, emu), sizeof(snapshot::sys_t::emu_t) },
+    { 'CLCK', 1, offsetof(snapshot::sys_t, clock), sizeof(snapshot::sys_t::clock_t) },
+    { 'CPU ', 1, offsetof(snapshot::sys_t, cpu), sizeof(snapshot::sys_t::cpu_t) },
+    { 'CTC ', 1, offsetof(snapshot::sys_t, ctc), sizeof(snapshot::sys_t::ctc_t) },
+    { 'PIO1', 1, offsetof(snapshot::sys_t, pio1), sizeof(snapshot::sys_t::pio_t) },
+    { 'PIO2', 1, offsetof(snapshot::sys_t, pio2), sizeof(snapshot::sys_t::pio_t) },
+    { 'KC85', 1, offsetof(snapshot::sys_t, kc), sizeof(snapshot::sys_t::kc_t) },
+    { 'Z13 ', 1, offsetof(snapshot::sys_t, z1013), sizeof(snapshot::sys_t::z1013_t) },
+    { 'Z9K ', 1, offsetof(snapshot::sys_t, z9001), sizeof(snapshot::sys_t::z9001_t) },
+};
+static const int num_sys_chunks = int(sizeof(sys_chunks) / sizeof(sys_chunks[0]));
+// the emulator chunk (system model and OS) is required, all others are optional
+static const uint32_t chunk_emu = 'EMU ';
+
+#pragma pack(push,1)
+struct chunk_header {
+    uint32_t id;
+    uint32_t version;
+    uint32_t size;          // size of chunk data following the header
+};
+struct bank_header {
+    ubyte type;
+    ubyte index;
+    uword num_pages;        // followed by a page bitmap and all non-zero pages
+};
+#pragma pack(pop)
+
+//------------------------------------------------------------------------------
+static void*
+zalloc_func(void* opaque, uInt items, uInt size) {
+    return YAKC_MALLOC(*(const ext_funcs*)opaque, items * size);
+}
+
+//------------------------------------------------------------------------------
+static void
+zfree_func(void* opaque, void* ptr) {
+    YAKC_FREE(*(const ext_funcs*)opaque, ptr);
+}
+
+//------------------------------------------------------------------------------
+//  deflate data into an output stream
+//
+struct zwriter {
+    static const int buf_size = 0x4000;
+    z_stream strm;
+    snapshot::write_func write_fn = nullptr;
+    void* userdata = nullptr;
+    bool ok = false;
+    ubyte buf[buf_size];
+
+    zwriter(const ext_funcs& funcs, snapshot::write_func fn, void* ud, int level) : write_fn(fn), userdata(ud) {
+        memset(&this->strm, 0, sizeof(this->strm));
+        this->strm.zalloc = zalloc_func;
+        this->strm.zfree = zfree_func;
+        this->strm.opaque = (voidpf) &funcs;
+        this->ok = Z_OK == deflateInit(&this->strm, level);
+    };
+    ~zwriter() {
+        deflateEnd(&this->strm);
+    };
+    bool deflate_and_write(int flush) {
+        int res;
+        do {
+            this->strm.next_out = this->buf;
+            this->strm.avail_out = buf_size;
+            res = deflate(&this->strm, flush);
+            if (Z_STREAM_ERROR == res) {
+                return false;
+            }
+            const int num_bytes = buf_size - this->strm.avail_out;
+            if ((num_bytes > 0) && !this->write_fn(this->userdata, this->buf, num_bytes)) {
+                return false;
+            }
+        }
+        while (0 == this->strm.avail_out);
+        return (Z_FINISH != flush) || (Z_STREAM_END == res);
+    };
+    void write(const void* ptr, int num_bytes) {
+        if (this->ok) {
+            this->strm.next_in = (Bytef*) ptr;
+            this->strm.avail_in = num_bytes;
+            this->ok = this->deflate_and_write(Z_NO_FLUSH);
+        }
+    };
+    bool finish() {
+        if (this->ok) {
+            this->strm.next_in = nullptr;
+            this->strm.avail_in = 0;
+            this->ok = this->deflate_and_write(Z_FINISH);
+        }
+        return this->ok;
+    };
+};
+
+//------------------------------------------------------------------------------
+//  inflate data from an input stream
+//
+struct zreader {
+    static const int buf_size = 0x4000;
+    z_stream strm;
+    snapshot::read_func read_fn = nullptr;
+    void* userdata = nullptr;
+    bool ok = false;
+    bool eof = false;
+    ubyte buf[buf_size];
+
+    zreader(const ext_funcs& funcs, snapshot::read_func fn, void* ud) : read_fn(fn), userdata(ud) {
+        memset(&this->strm, 0, sizeof(this->strm));
+        this->strm.zalloc = zalloc_func;
+        this->strm.zfree = zfree_func;
+        this->strm.opaque = (voidpf) &funcs;
+        this->ok = Z_OK == inflateInit(&this->strm);
+    };
+    ~zreader() {
+        inflateEnd(&this->strm);
+    };
+    bool read(void* ptr, int num_bytes) {
+        this->strm.next_out = (Bytef*) ptr;
+        this->strm.avail_out = num_bytes;
+        while (this->ok && (this->strm.avail_out > 0)) {
+            if ((0 == this->strm.avail_in) && !this->eof) {
+                const int num_read = this->read_fn(this->userdata, this->buf, buf_size);
+                this->eof = (0 == num_read);
+                this->strm.next_in = this->buf;
+                this->strm.avail_in = num_read;
+            }
+            const int res = inflate(&this->strm, Z_NO_FLUSH);
+            if (Z_STREAM_END == res) {
+                // end of compressed data, must have all requested data
+                this->ok = (0 == this->strm.avail_out);
+            }
+            else if (Z_OK != res) {
+                this->ok = false;
+            }
+        }
+        return this->ok;
+    };
+    bool skip(int num_bytes) {
+        ubyte dummy[256];
+        while (this->ok && (num_bytes > 0)) {
+            const int n = num_bytes < int(sizeof(dummy)) ? num_bytes : int(sizeof(dummy));
+            this->read(dummy, n);
+            num_bytes -= n;
+        }
+        return this->ok;
+    };
+};
+
+//------------------------------------------------------------------------------
+static bool
+is_zero_page(const ubyte* ptr) {
+    for (int i = 0; i < memory::page::size; i++) {
+        if (ptr[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+snapshot::write_stream(yakc& emu, write_func write_fn, void* userdata, int level) {
+    YAKC_ASSERT(write_fn);
+    const int header[2] = { 'YAKC', cur_version };
+    if (!write_fn(userdata, header, sizeof(header))) {
+        return false;
+    }
+    zwriter zw(emu.funcs, write_fn, userdata, level);
+
+    // the non-memory state, one chunk per subsystem
+    chunk_header chunk;
+    sys_t sys;
+    write_sys_state(emu, sys);
+    for (int i = 0; i < num_sys_chunks; i++) {
+        const sys_chunk& sc = sys_chunks[i];
+        chunk.id = sc.id;
+        chunk.version = sc.version;
+        chunk.size = sc.size;
+        zw.write(&chunk, sizeof(chunk));
+        zw.write(((const ubyte*)&sys) + sc.offset, sc.size);
+    }
+
+    // one chunk per memory bank, without all-zero pages
+    bank_t banks[max_banks];
+    const int num_banks = enumerate_banks(emu, banks, max_banks);
+    for (int bank_index = 0; bank_index < num_banks; bank_index++) {
+        const bank_t& bank = banks[bank_index];
+        const int num_pages = bank.size >> memory::page::shift;
+        ubyte bitmap[(0x10000 >> memory::page::shift) / 8] = { };
+        YAKC_ASSERT(num_pages <= int(sizeof(bitmap) * 8));
+        const int bitmap_size = (num_pages + 7) / 8;
+        int num_used_pages = 0;
+        for (int i = 0; i < num_pages; i++) {
+            if (!is_zero_page(bank.ptr + (i << memory::page::shift))) {
+                bitmap[i >> 3] |= 1 << (i & 7);
+                num_used_pages++;
+            }
+        }
+        bank_header bhdr;
+        bhdr.type = bank.type;
+        bhdr.index = bank.index;
+        bhdr.num_pages = num_pages;
+        chunk.id = chunk_bank;
+        chunk.version = bank_chunk_version;
+        chunk.size = sizeof(bhdr) + bitmap_size + num_used_pages * memory::page::size;
+        zw.write(&chunk, sizeof(chunk));
+        zw.write(&bhdr, sizeof(bhdr));
+        zw.write(bitmap, bitmap_size);
+        for (int i = 0; i < num_pages; i++) {
+            if (bitmap[i >> 3] & (1 << (i & 7))) {
+                zw.write(bank.ptr + (i << memory::page::shift), memory::page::size);
+            }
+        }
+    }
+    chunk.id = chunk_end;
+    chunk.version = 1;
+    chunk.size = 0;
+    zw.write(&chunk, sizeof(chunk));
+    return zw.finish();
+}
+
+//------------------------------------------------------------------------------
+//  a decoded memory bank, kept until the whole stream has been validated
+//
+struct stream_bank {
+    ubyte type = 0;
+    ubyte index = 0;
+    int size = 0;
+    ubyte* ptr = nullptr;
+};
+
+//------------------------------------------------------------------------------
+static const sys_chunk*
+find_sys_chunk(uint32_t id) {
+    for (int i = 0; i < num_sys_chunks; i++) {
+        if (sys_chunks[i].id == id) {
+            return &sys_chunks[i];
+        }
+    }
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+static bool
+read_bank_chunk(zreader& zr, const chunk_header& chunk, const ext_funcs& funcs, stream_bank& bank) {
+    bank_header bhdr;
+    if ((chunk.size < sizeof(bhdr)) || !zr.read(&bhdr, sizeof(bhdr))) {
+        return false;
+    }
+    int remaining = chunk.size - sizeof(bhdr);
+    const int num_pages = bhdr.num_pages;
+    const int bitmap_size = (num_pages + 7) / 8;
+    ubyte bitmap[(0x10000 >> memory::page::shift) / 8];
+    if ((bitmap_size > int(sizeof(bitmap))) || (remaining < bitmap_size) || !zr.read(bitmap, bitmap_size)) {
+        return false;
+    }
+    remaining -= bitmap_size;
+    bank.type = bhdr.type;
+    bank.index = bhdr.index;
+    bank.size = num_pages << memory::page::shift;
+    if (bank.size > 0) {
+        bank.ptr = (ubyte*) YAKC_MALLOC(funcs, bank.size);
+    }
+    for (int i = 0; i < num_pages; i++) {
+        ubyte* dst = bank.ptr + (i << memory::page::shift);
+        if (bitmap[i >> 3] & (1 << (i & 7))) {
+            if ((remaining < memory::page::size) || !zr.read(dst, memory::page::size)) {
+                return false;
+            }
+            remaining -= memory::page::size;
+        }
+        else {
+            clear(dst, memory::page::size);
+        }
+    }
+    return zr.skip(remaining);
+}
+
+//------------------------------------------------------------------------------
+bool
+snapshot::read_stream(read_func read_fn, void* userdata, yakc& emu) {
+    YAKC_ASSERT(read_fn);
+    int header[2] = { };
+    if (read_fn(userdata, header, sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+    if (header[0] != 'YAKC') {
+        return false;
+    }
+    if (1 == header[1]) {
+        // import the old uncompressed format
+        state_t* state = (state_t*) YAKC_MALLOC(emu.funcs, sizeof(state_t));
+        state->magic = header[0];
+        state->version = header[1];
+        ubyte* dst = ((ubyte*)state) + sizeof(header);
+        int remaining = sizeof(state_t) - sizeof(header);
+        while (remaining > 0) {
+            const int num_read = read_fn(userdata, dst, remaining);
+            if (0 == num_read) {
+                break;
+            }
+            dst += num_read;
+            remaining -= num_read;
+        }
+        if (0 == remaining) {
+            apply_snapshot(*state, emu);
+        }
+        YAKC_FREE(emu.funcs, state);
+        return 0 == remaining;
+    }
+    else if (header[1] != cur_version) {
+        return false;
+    }
+
+    // decode the entire stream first, so that the running system
+    // is left untouched if the stream is truncated or corrupt
+    zreader zr(emu.funcs, read_fn, userdata);
+    // subsystems without a usable chunk keep their current state
+    sys_t sys;
+    write_sys_state(emu, sys);
+    bool emu_valid = false;
+    bool success = false;
+    stream_bank stream_banks[max_banks];
+    int num_stream_banks = 0;
+    chunk_header chunk;
+    while (zr.read(&chunk, sizeof(chunk))) {
+        if (chunk_end == chunk.id) {
+            success = emu_valid;
+            break;
+        }
+        else if (const sys_chunk* sc = find_sys_chunk(chunk.id)) {
+            if ((sc->version == chunk.version) && (uint32_t(sc->size) == chunk.size)) {
+                if (!zr.read(((ubyte*)&sys) + sc->offset, sc->size)) {
+                    break;
+                }
+                emu_valid |= (chunk_emu == chunk.id);
+            }
+            else {
+                // a subsystem version this reader doesn't know, skip
+                zr.skip(chunk.size);
+            }
+        }
+        else if ((chunk_bank == chunk.id) && (bank_chunk_version == chunk.version)) {
+            if ((num_stream_banks == max_banks) ||
+                !read_bank_chunk(zr, chunk, emu.funcs, stream_banks[num_stream_banks++])) {
+                break;
+            }
+        }
+        else {
+            // unknown chunk, skip
+            zr.skip(chunk.size);
+        }
+    }
+    if (success) {
+        apply_sys_state(sys, emu);
+        bank_t banks[max_banks];
+        const int num_banks = enumerate_banks(emu, banks, max_banks);
+        for (int i = 0; i < num_stream_banks; i++) {
+            const stream_bank& src = stream_banks[i];
+            for (int j = 0; j < num_banks; j++) {
+                // ignore banks which don't exist on the emulated system
+                bank_t& dst = banks[j];
+                if ((dst.type == src.type) && (dst.index == src.index) && (dst.size == src.size)) {
+                    memcpy(dst.ptr, src.ptr, src.size);
+                    break;
+                }
+            }
+        }
+        after_apply(emu);
+    }
+    for (int i = 0; i < num_stream_banks; i++) {
+        if (stream_banks[i].ptr) {
+            YAKC_FREE(emu.funcs, stream_banks[i].ptr);
+        }
+    }
+    return success;
+}
+
 //------------------------------------------------------------------------------
 void
-snapshot::write_emu_state(const yakc& emu, state_t& state) {
-    state.emu.model = (uword)emu.model;
-    state.emu.os = (uword)emu.os;
+snapshot::write_emu_state(const yakc& emu, sys_t& sys) {
+    sys.emu.model = (uword)emu.model;
+    sys.emu.os = (uword)emu.os;
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_emu_state(const state_t& state, yakc& emu) {
-    emu.model = (device) state.emu.model;
-    emu.os = (os_rom) state.emu.os;
+snapshot::apply_emu_state(const sys_t& sys, yakc& emu) {
+    emu.model = (device) sys.emu.model;
+    emu.os = (os_rom) sys.emu.os;
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::write_clock_state(const yakc& emu, state_t& state) {
+snapshot::write_clock_state(const yakc& emu, sys_t& sys) {
     const clock& clk = emu.board.clck;
-    state.clock.base_freq_khz = clk.base_freq_khz;
+    sys.clock.base_freq_khz = clk.base_freq_khz;
     for (int i = 0; i < 4; i++) {
-        state.clock.timers[i].freq_hz = clk.timers[i].freq_hz;
-        state.clock.timers[i].count   = clk.timers[i].count;
-        state.clock.timers[i].value   = clk.timers[i].value;
+        sys.clock.timers[i].freq_hz = clk.timers[i].freq_hz;
+        sys.clock.timers[i].count   = clk.timers[i].count;
+        sys.clock.timers[i].value   = clk.timers[i].value;
     }
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_clock_state(const state_t& state, yakc& emu) {
+snapshot::apply_clock_state(const sys_t& sys, yakc& emu) {
     clock& clk = emu.board.clck;
-    clk.base_freq_khz = state.clock.base_freq_khz;
+    clk.base_freq_khz = sys.clock.base_freq_khz;
     for (int i = 0; i < 4; i++) {
-        clk.timers[i].freq_hz = state.clock.timers[i].freq_hz;
-        clk.timers[i].count   = state.clock.timers[i].count;
-        clk.timers[i].value   = state.clock.timers[i].value;
+        clk.timers[i].freq_hz = sys.clock.timers[i].freq_hz;
+        clk.timers[i].count   = sys.clock.timers[i].count;
+        clk.timers[i].value   = sys.clock.timers[i].value;
     }
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::write_kc_state(const yakc& emu, state_t& state) {
+snapshot::write_kc_state(const yakc& emu, sys_t& sys) {
     const kc85& kc = emu.kc85;
-    state.kc.on = kc.on;
-    state.kc.model = (uword) kc.cur_model;
-    state.kc.caos  = (ubyte) kc.cur_caos;
-    state.kc.io84 = kc.io84;
-    state.kc.io86 = kc.io86;
-    state.kc.pio_a = kc.pio_a;
-    state.kc.pio_b = kc.pio_b;
-    state.kc.cur_pal_line = kc.video.cur_pal_line;
-    state.kc.irm_control = kc.video.irm_control;
-    state.kc.pio_blink_flag = kc.video.pio_blink_flag;
-    state.kc.ctc_blink_flag = kc.video.ctc_blink_flag;
-    state.kc.volume = kc.audio.volume;
+    sys.kc.on = kc.on;
+    sys.kc.model = (uword) kc.cur_model;
+    sys.kc.caos  = (ubyte) kc.cur_caos;
+    sys.kc.io84 = kc.io84;
+    sys.kc.io86 = kc.io86;
+    sys.kc.pio_a = kc.pio_a;
+    sys.kc.pio_b = kc.pio_b;
+    sys.kc.cur_pal_line = kc.video.cur_pal_line;
+    sys.kc.irm_control = kc.video.irm_control;
+    sys.kc.pio_blink_flag = kc.video.pio_blink_flag;
+    sys.kc.ctc_blink_flag = kc.video.ctc_blink_flag;
+    sys.kc.volume = kc.audio.volume;
     for (int c = 0; c < 2; c++) {
-        state.kc.chn[c].ctc_mode = kc.audio.channels[c].ctc_mode;
-        state.kc.chn[c].ctc_constant = kc.audio.channels[c].ctc_constant;
+        sys.kc.chn[c].ctc_mode = kc.audio.channels[c].ctc_mode;
+        sys.kc.chn[c].ctc_constant = kc.audio.channels[c].ctc_constant;
     }
     for (int s = 0; s < 2; s++) {
-        auto& dst = state.kc.slots[s];
+        auto& dst = sys.kc.slots[s];
         const auto& src = kc.exp.slots[s];
         dst.slot_addr = src.slot_addr;
         dst.module_type = src.mod.type;
@@ -121,153 +637,161 @@ snapshot::write_kc_state(const yakc& emu, state_t& state) {
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_kc_state(const state_t& state, yakc& emu) {
+snapshot::apply_kc_state(const sys_t& sys, yakc& emu) {
     kc85& kc = emu.kc85;
-    kc.on = 0 != state.kc.on;
-    kc.cur_model = (device) state.kc.model;
-    kc.cur_caos  = (os_rom) state.kc.caos;
-    kc.io84      = state.kc.io84;
-    kc.io86      = state.kc.io86;
-    kc.pio_a     = state.kc.pio_a;
-    kc.pio_b     = state.kc.pio_b;
-    kc.video.model = (device) state.kc.model;
-    kc.video.cur_pal_line = state.kc.cur_pal_line;
-    kc.video.irm_control = state.kc.irm_control;
-    kc.video.pio_blink_flag = 0 != state.kc.pio_blink_flag;
-    kc.video.ctc_blink_flag = 0 != state.kc.ctc_blink_flag;
+    kc.on = 0 != sys.kc.on;
+    kc.update_buffers();
+    kc.cur_model = (device) sys.kc.model;
+    kc.cur_caos  = (os_rom) sys.kc.caos;
+    kc.io84      = sys.kc.io84;
+    kc.io86      = sys.kc.io86;
+    kc.pio_a     = sys.kc.pio_a;
+    kc.pio_b     = sys.kc.pio_b;
+    kc.video.model = (device) sys.kc.model;
+    kc.video.cur_pal_line = sys.kc.cur_pal_line;
+    kc.video.irm_control = sys.kc.irm_control;
+    kc.video.pio_blink_flag = 0 != sys.kc.pio_blink_flag;
+    kc.video.ctc_blink_flag = 0 != sys.kc.ctc_blink_flag;
     kc.audio.reset();
-    kc.audio.volume = state.kc.volume;
+    kc.audio.volume = sys.kc.volume;
     for (int c = 0; c < 2; c++) {
-        kc.audio.channels[c].ctc_mode = state.kc.chn[c].ctc_mode;
-        kc.audio.channels[c].ctc_constant = state.kc.chn[c].ctc_constant;
+        kc.audio.channels[c].ctc_mode = sys.kc.chn[c].ctc_mode;
+        kc.audio.channels[c].ctc_constant = sys.kc.chn[c].ctc_constant;
     }
     for (int s = 0; s < 2; s++) {
-        const auto& slot = state.kc.slots[s];
-        if (kc.exp.slot_occupied(slot.slot_addr)) {
-            kc.exp.remove_module(slot.slot_addr, kc.board->cpu.mem);
+        const auto& slot = sys.kc.slots[s];
+        const kc85_exp::module_type type = (kc85_exp::module_type)slot.module_type;
+        // keep an already inserted module of the same type, the
+        // module memory content is restored separately
+        if (!kc.exp.slot_occupied(slot.slot_addr) || (kc.exp.slot_by_addr(slot.slot_addr).mod.type != type)) {
+            if (kc.exp.slot_occupied(slot.slot_addr)) {
+                kc.exp.remove_module(slot.slot_addr, kc.board->cpu.mem);
+            }
+            kc.exp.insert_module(slot.slot_addr, type);
         }
-        kc.exp.insert_module(slot.slot_addr, (kc85_exp::module_type)slot.module_type);
         kc.exp.update_control_byte(slot.slot_addr, slot.control_byte);
     }
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::write_z1013_state(const yakc& emu, state_t& state) {
-    state.z1013.on = emu.z1013.on;
-    state.z1013.model = (uword) emu.z1013.cur_model;
-    state.z1013.os = (ubyte) emu.z1013.cur_os;
-    state.z1013.kbd_column_nr_requested = emu.z1013.kbd_column_nr_requested;
-    state.z1013.kbd_8x8_requested = emu.z1013.kbd_8x8_requested;
-    state.z1013.next_kbd_column_bits = emu.z1013.next_kbd_column_bits;
-    state.z1013.kbd_column_bits = emu.z1013.kbd_column_bits;
+snapshot::write_z1013_state(const yakc& emu, sys_t& sys) {
+    sys.z1013.on = emu.z1013.on;
+    sys.z1013.model = (uword) emu.z1013.cur_model;
+    sys.z1013.os = (ubyte) emu.z1013.cur_os;
+    sys.z1013.kbd_column_nr_requested = emu.z1013.kbd_column_nr_requested;
+    sys.z1013.kbd_8x8_requested = emu.z1013.kbd_8x8_requested;
+    sys.z1013.next_kbd_column_bits = emu.z1013.next_kbd_column_bits;
+    sys.z1013.kbd_column_bits = emu.z1013.kbd_column_bits;
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_z1013_state(const state_t& state, yakc& emu) {
-    emu.z1013.on = 0 != state.z1013.on;
-    emu.z1013.cur_model = (device) state.z1013.model;
-    emu.z1013.cur_os = (os_rom) state.z1013.os;
-    emu.z1013.kbd_column_nr_requested = state.z1013.kbd_column_nr_requested;
-    emu.z1013.kbd_8x8_requested = 0 != state.z1013.kbd_8x8_requested;
-    emu.z1013.next_kbd_column_bits = state.z1013.next_kbd_column_bits;
-    emu.z1013.kbd_column_bits = emu.z1013.kbd_column_bits;
+snapshot::apply_z1013_state(const sys_t& sys, yakc& emu) {
+    emu.z1013.on = 0 != sys.z1013.on;
+    emu.z1013.update_buffers();
+    emu.z1013.cur_model = (device) sys.z1013.model;
+    emu.z1013.cur_os = (os_rom) sys.z1013.os;
+    emu.z1013.kbd_column_nr_requested = sys.z1013.kbd_column_nr_requested;
+    emu.z1013.kbd_8x8_requested = 0 != sys.z1013.kbd_8x8_requested;
+    emu.z1013.next_kbd_column_bits = sys.z1013.next_kbd_column_bits;
+    emu.z1013.kbd_column_bits = sys.z1013.kbd_column_bits;
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::write_z9001_state(const yakc& emu, state_t& state) {
-    state.z9001.on = 0 != emu.z9001.on;
-    state.z9001.model = (uword) emu.z9001.cur_model;
-    state.z9001.os = (ubyte) emu.z9001.cur_os;
-    state.z9001.ctc0_mode = emu.z9001.ctc0_mode;
-    state.z9001.kbd_column_mask = emu.z9001.kbd_column_mask;
-    state.z9001.kbd_line_mask = emu.z9001.kbd_line_mask;
-    state.z9001.blink_flipflop = emu.z9001.blink_flipflop;
-    state.z9001.brd_color = emu.z9001.brd_color;
-    state.z9001.key_mask = emu.z9001.key_mask;
-    state.z9001.blink_counter = emu.z9001.blink_counter;
-    state.z9001.ctc0_constant = emu.z9001.ctc0_constant;
+snapshot::write_z9001_state(const yakc& emu, sys_t& sys) {
+    sys.z9001.on = 0 != emu.z9001.on;
+    sys.z9001.model = (uword) emu.z9001.cur_model;
+    sys.z9001.os = (ubyte) emu.z9001.cur_os;
+    sys.z9001.ctc0_mode = emu.z9001.ctc0_mode;
+    sys.z9001.kbd_column_mask = emu.z9001.kbd_column_mask;
+    sys.z9001.kbd_line_mask = emu.z9001.kbd_line_mask;
+    sys.z9001.blink_flipflop = emu.z9001.blink_flipflop;
+    sys.z9001.brd_color = emu.z9001.brd_color;
+    sys.z9001.key_mask = emu.z9001.key_mask;
+    sys.z9001.blink_counter = emu.z9001.blink_counter;
+    sys.z9001.ctc0_constant = emu.z9001.ctc0_constant;
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_z9001_state(const state_t& state, yakc& emu) {
-    emu.z9001.on = 0 != state.z9001.on;
-    emu.z9001.cur_model = (device) state.z9001.model;
-    emu.z9001.cur_os = (os_rom) state.z9001.os;
-    emu.z9001.ctc0_mode = state.z9001.ctc0_mode;
-    emu.z9001.kbd_column_mask = state.z9001.kbd_column_mask;
-    emu.z9001.kbd_line_mask = state.z9001.kbd_line_mask;
-    emu.z9001.blink_flipflop = 0 != state.z9001.blink_flipflop;
-    emu.z9001.brd_color = state.z9001.brd_color;
-    emu.z9001.key_mask = state.z9001.key_mask;
-    emu.z9001.blink_counter = state.z9001.blink_counter;
-    emu.z9001.ctc0_constant = state.z9001.ctc0_constant;
+snapshot::apply_z9001_state(const sys_t& sys, yakc& emu) {
+    emu.z9001.on = 0 != sys.z9001.on;
+    emu.z9001.update_buffers();
+    emu.z9001.cur_model = (device) sys.z9001.model;
+    emu.z9001.cur_os = (os_rom) sys.z9001.os;
+    emu.z9001.ctc0_mode = sys.z9001.ctc0_mode;
+    emu.z9001.kbd_column_mask = sys.z9001.kbd_column_mask;
+    emu.z9001.kbd_line_mask = sys.z9001.kbd_line_mask;
+    emu.z9001.blink_flipflop = 0 != sys.z9001.blink_flipflop;
+    emu.z9001.brd_color = sys.z9001.brd_color;
+    emu.z9001.key_mask = sys.z9001.key_mask;
+    emu.z9001.blink_counter = sys.z9001.blink_counter;
+    emu.z9001.ctc0_constant = sys.z9001.ctc0_constant;
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::write_cpu_state(const yakc& emu, state_t& state) {
+snapshot::write_cpu_state(const yakc& emu, sys_t& sys) {
     const z80& cpu = emu.board.cpu;
-    state.cpu.AF  = cpu.AF;
-    state.cpu.BC  = cpu.BC;
-    state.cpu.DE  = cpu.DE;
-    state.cpu.HL  = cpu.HL;
-    state.cpu.WZ  = cpu.WZ;
-    state.cpu.AF_ = cpu.AF_;
-    state.cpu.BC_ = cpu.BC_;
-    state.cpu.DE_ = cpu.DE_;
-    state.cpu.HL_ = cpu.HL_;
-    state.cpu.WZ_ = cpu.WZ_;
-    state.cpu.IX  = cpu.IX;
-    state.cpu.IY  = cpu.IY;
-    state.cpu.SP  = cpu.SP;
-    state.cpu.PC  = cpu.PC;
-    state.cpu.I   = cpu.I;
-    state.cpu.R   = cpu.R;
-    state.cpu.IM  = cpu.IM;
-    state.cpu.HALT = cpu.HALT;
-    state.cpu.IFF1 = cpu.IFF1;
-    state.cpu.IFF2 = cpu.IFF2;
-    state.cpu.INV  = cpu.INV;
-    state.cpu.irq_received = cpu.irq_received;
-    state.cpu.enable_interrupt = cpu.enable_interrupt;
+    sys.cpu.AF  = cpu.AF;
+    sys.cpu.BC  = cpu.BC;
+    sys.cpu.DE  = cpu.DE;
+    sys.cpu.HL  = cpu.HL;
+    sys.cpu.WZ  = cpu.WZ;
+    sys.cpu.AF_ = cpu.AF_;
+    sys.cpu.BC_ = cpu.BC_;
+    sys.cpu.DE_ = cpu.DE_;
+    sys.cpu.HL_ = cpu.HL_;
+    sys.cpu.WZ_ = cpu.WZ_;
+    sys.cpu.IX  = cpu.IX;
+    sys.cpu.IY  = cpu.IY;
+    sys.cpu.SP  = cpu.SP;
+    sys.cpu.PC  = cpu.PC;
+    sys.cpu.I   = cpu.I;
+    sys.cpu.R   = cpu.R;
+    sys.cpu.IM  = cpu.IM;
+    sys.cpu.HALT = cpu.HALT;
+    sys.cpu.IFF1 = cpu.IFF1;
+    sys.cpu.IFF2 = cpu.IFF2;
+    sys.cpu.INV  = cpu.INV;
+    sys.cpu.irq_received = cpu.irq_received;
+    sys.cpu.enable_interrupt = cpu.enable_interrupt;
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_cpu_state(const state_t& state, yakc& emu) {
+snapshot::apply_cpu_state(const sys_t& sys, yakc& emu) {
     z80& cpu = emu.board.cpu;
-    cpu.AF = state.cpu.AF;
-    cpu.BC = state.cpu.BC;
-    cpu.DE = state.cpu.DE;
-    cpu.HL = state.cpu.HL;
-    cpu.WZ = state.cpu.WZ;
-    cpu.AF_ = state.cpu.AF_;
-    cpu.BC_ = state.cpu.BC_;
-    cpu.DE_ = state.cpu.DE_;
-    cpu.HL_ = state.cpu.HL_;
-    cpu.WZ_ = state.cpu.WZ_;
-    cpu.IX  = state.cpu.IX;
-    cpu.IY  = state.cpu.IY;
-    cpu.SP  = state.cpu.SP;
-    cpu.PC  = state.cpu.PC;
-    cpu.I   = state.cpu.I;
-    cpu.R   = state.cpu.R;
-    cpu.IM  = state.cpu.IM;
-    cpu.HALT = 0 != state.cpu.HALT;
-    cpu.IFF1 = 0 != state.cpu.IFF1;
-    cpu.IFF2 = 0 != state.cpu.IFF2;
-    cpu.INV  = 0 != state.cpu.INV;
-    cpu.irq_received = 0 != state.cpu.irq_received;
-    cpu.enable_interrupt = 0 != state.cpu.enable_interrupt;
+    cpu.AF = sys.cpu.AF;
+    cpu.BC = sys.cpu.BC;
+    cpu.DE = sys.cpu.DE;
+    cpu.HL = sys.cpu.HL;
+    cpu.WZ = sys.cpu.WZ;
+    cpu.AF_ = sys.cpu.AF_;
+    cpu.BC_ = sys.cpu.BC_;
+    cpu.DE_ = sys.cpu.DE_;
+    cpu.HL_ = sys.cpu.HL_;
+    cpu.WZ_ = sys.cpu.WZ_;
+    cpu.IX  = sys.cpu.IX;
+    cpu.IY  = sys.cpu.IY;
+    cpu.SP  = sys.cpu.SP;
+    cpu.PC  = sys.cpu.PC;
+    cpu.I   = sys.cpu.I;
+    cpu.R   = sys.cpu.R;
+    cpu.IM  = sys.cpu.IM;
+    cpu.HALT = 0 != sys.cpu.HALT;
+    cpu.IFF1 = 0 != sys.cpu.IFF1;
+    cpu.IFF2 = 0 != sys.cpu.IFF2;
+    cpu.INV  = 0 != sys.cpu.INV;
+    cpu.irq_received = 0 != sys.cpu.irq_received;
+    cpu.enable_interrupt = 0 != sys.cpu.enable_interrupt;
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::write_intctrl_state(const z80int& src, state_t::intctrl_t& dst) {
+snapshot::write_intctrl_state(const z80int& src, sys_t::intctrl_t& dst) {
     dst.enabled = src.int_enabled;
     dst.requested = src.int_requested;
     dst.request_data = src.int_request_data;
@@ -276,7 +800,7 @@ snapshot::write_intctrl_state(const z80int& src, state_t::intctrl_t& dst) {
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_intctrl_state(const state_t::intctrl_t& src, z80int& dst) {
+snapshot::apply_intctrl_state(const sys_t::intctrl_t& src, z80int& dst) {
     dst.int_enabled = 0 != src.enabled;
     dst.int_requested = 0 != src.requested;
     dst.int_request_data = src.request_data;
@@ -285,9 +809,9 @@ snapshot::apply_intctrl_state(const state_t::intctrl_t& src, z80int& dst) {
 
 //------------------------------------------------------------------------------
 void
-snapshot::write_ctc_state(const yakc& emu, state_t& state) {
+snapshot::write_ctc_state(const yakc& emu, sys_t& sys) {
     for (int c = 0; c < 4; c++) {
-        auto& dst = state.ctc.chn[c];
+        auto& dst = sys.ctc.chn[c];
         const auto& src = emu.board.ctc.channels[c];
         dst.down_counter = src.down_counter;
         dst.mode = src.mode;
@@ -300,10 +824,10 @@ snapshot::write_ctc_state(const yakc& emu, state_t& state) {
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_ctc_state(const state_t& state, yakc& emu) {
+snapshot::apply_ctc_state(const sys_t& sys, yakc& emu) {
     for (int c = 0; c < 4; c++) {
         auto& dst = emu.board.ctc.channels[c];
-        const auto& src = state.ctc.chn[c];
+        const auto& src = sys.ctc.chn[c];
         dst.down_counter = src.down_counter;
         dst.mode = src.mode;
         dst.constant = src.constant;
@@ -315,32 +839,32 @@ snapshot::apply_ctc_state(const state_t& state, yakc& emu) {
 
 //------------------------------------------------------------------------------
 void
-snapshot::write_pio_state(const yakc& emu, state_t& state) {
+snapshot::write_pio_state(const yakc& emu, sys_t& sys) {
     const z80pio& pio1 = emu.board.pio;
     for (int i = 0; i < 2; i++) {
-        state.pio1.port[i] = pio1.port[i];
+        sys.pio1.port[i] = pio1.port[i];
     }
-    write_intctrl_state(pio1.int_ctrl, state.pio1.intctrl);
+    write_intctrl_state(pio1.int_ctrl, sys.pio1.intctrl);
     const z80pio& pio2 = emu.board.pio2;
     for (int i = 0; i < 2; i++) {
-        state.pio2.port[i] = pio2.port[i];
+        sys.pio2.port[i] = pio2.port[i];
     }
-    write_intctrl_state(pio2.int_ctrl, state.pio2.intctrl);
+    write_intctrl_state(pio2.int_ctrl, sys.pio2.intctrl);
 }
 
 //------------------------------------------------------------------------------
 void
-snapshot::apply_pio_state(const state_t& state, yakc& emu) {
+snapshot::apply_pio_state(const sys_t& sys, yakc& emu) {
     z80pio& pio1 = emu.board.pio;
     for (int i = 0; i < 2; i++) {
-        pio1.port[i] = state.pio1.port[i];
+        pio1.port[i] = sys.pio1.port[i];
     }
-    apply_intctrl_state(state.pio1.intctrl, pio1.int_ctrl);
+    apply_intctrl_state(sys.pio1.intctrl, pio1.int_ctrl);
     z80pio& pio2 = emu.board.pio2;
     for (int i = 0; i < 2; i++) {
-        pio2.port[i] = state.pio2.port[i];
+        pio2.port[i] = sys.pio2.port[i];
     }
-    apply_intctrl_state(state.pio2.intctrl, pio2.int_ctrl);
+    apply_intctrl_state(sys.pio2.intctrl, pio2.int_ctrl);
 }
 
 //------------------------------------------------------------------------------
@@ -348,11 +872,11 @@ void
 snapshot::write_memory_state(const yakc& emu, state_t& state) {
     if (emu.is_device(device::any_kc85)) {
         const kc85& kc = emu.kc85;
-        static_assert(sizeof(kc.ram) == sizeof(state.ram), "KC RAM size mismatch");
-        static_assert(sizeof(kc.video.irm) == sizeof(state.irm), "KC video RAM size mismatch");
+        static_assert(kc85::ram_size == sizeof(state.ram), "KC RAM size mismatch");
+        static_assert(kc85_video::irm_size == sizeof(state.irm), "KC video RAM size mismatch");
 
-        memcpy(state.ram, kc.ram, sizeof(kc.ram));
-        memcpy(state.irm, kc.video.irm, sizeof(kc.video.irm));
+        memcpy(state.ram, kc.ram, kc85::ram_size);
+        memcpy(state.irm, kc.video.irm, kc85_video::irm_size);
 
         // copy content of RAM modules
         const auto& slot08 = kc.exp.slot_by_addr(0x08);
@@ -365,18 +889,18 @@ snapshot::write_memory_state(const yakc& emu, state_t& state) {
         }
     }
     else if (emu.is_device(device::any_z1013)) {
-        static_assert(sizeof(emu.z1013.ram) == sizeof(state.ram), "Z1013 RAM size mismatch");
-        static_assert(sizeof(emu.z1013.irm) < sizeof(state.irm[0]), "Z1013 IRM size too big");
-        memcpy(state.ram, emu.z1013.ram, sizeof(emu.z1013.ram));
-        memcpy(state.irm[0], emu.z1013.irm, sizeof(emu.z1013.irm));
+        static_assert(z1013::ram_size == sizeof(state.ram), "Z1013 RAM size mismatch");
+        static_assert(z1013::irm_size < sizeof(state.irm[0]), "Z1013 IRM size too big");
+        memcpy(state.ram, emu.z1013.ram, z1013::ram_size);
+        memcpy(state.irm[0], emu.z1013.irm, z1013::irm_size);
     }
     else if (emu.is_device(device::any_z9001)) {
-        static_assert(sizeof(emu.z9001.ram) == sizeof(state.ram), "Z9001 RAM size mismatch");
-        static_assert(sizeof(emu.z9001.color_ram) < sizeof(state.irm[0]), "Z9001 color RAM size too big");
-        static_assert(sizeof(emu.z9001.video_ram) < sizeof(state.irm[1]), "Z9001 video RAM size too big");
-        memcpy(state.ram, emu.z9001.ram, sizeof(emu.z9001.ram));
-        memcpy(state.irm[0], emu.z9001.color_ram, sizeof(emu.z9001.color_ram));
-        memcpy(state.irm[1], emu.z9001.video_ram, sizeof(emu.z9001.video_ram));
+        static_assert(z9001::ram_size == sizeof(state.ram), "Z9001 RAM size mismatch");
+        static_assert(z9001::color_ram_size < sizeof(state.irm[0]), "Z9001 color RAM size too big");
+        static_assert(z9001::video_ram_size < sizeof(state.irm[1]), "Z9001 video RAM size too big");
+        memcpy(state.ram, emu.z9001.ram, z9001::ram_size);
+        memcpy(state.irm[0], emu.z9001.color_ram, z9001::color_ram_size);
+        memcpy(state.irm[1], emu.z9001.video_ram, z9001::video_ram_size);
     }
 }
 
@@ -385,8 +909,8 @@ void
 snapshot::apply_memory_state(const state_t& state, yakc& emu) {
     if (emu.is_device(device::any_kc85)) {
         kc85& kc = emu.kc85;
-        static_assert(sizeof(kc.ram) == sizeof(state.ram), "KC RAM size mismatch");
-        static_assert(sizeof(kc.video.irm) == sizeof(state.irm), "KC video RAM size mismatch");
+        static_assert(kc85::ram_size == sizeof(state.ram), "KC RAM size mismatch");
+        static_assert(kc85_video::irm_size == sizeof(state.irm), "KC video RAM size mismatch");
 
         memcpy(kc.ram, state.ram, sizeof(state.ram));
         memcpy(kc.video.irm, state.irm, sizeof(state.irm));
@@ -400,18 +924,18 @@ snapshot::apply_memory_state(const state_t& state, yakc& emu) {
         }
     }
     else if (emu.is_device(device::any_z1013)) {
-        static_assert(sizeof(emu.z1013.ram) == sizeof(state.ram), "Z1013 RAM size mismatch");
-        static_assert(sizeof(emu.z1013.irm) < sizeof(state.irm[0]), "Z1013 IRM size too big");
-        memcpy(emu.z1013.ram, state.ram, sizeof(emu.z1013.ram));
-        memcpy(emu.z1013.irm, state.irm[0], sizeof(emu.z1013.irm));
+        static_assert(z1013::ram_size == sizeof(state.ram), "Z1013 RAM size mismatch");
+        static_assert(z1013::irm_size < sizeof(state.irm[0]), "Z1013 IRM size too big");
+        memcpy(emu.z1013.ram, state.ram, z1013::ram_size);
+        memcpy(emu.z1013.irm, state.irm[0], z1013::irm_size);
     }
     else if (emu.is_device(device::any_z9001)) {
-        static_assert(sizeof(emu.z9001.ram) == sizeof(state.ram), "Z9001 RAM size mismatch");
-        static_assert(sizeof(emu.z9001.color_ram) < sizeof(state.irm[0]), "Z9001 color RAM size too big");
-        static_assert(sizeof(emu.z9001.video_ram) < sizeof(state.irm[1]), "Z9001 video RAM size too big");
-        memcpy(emu.z9001.ram, state.ram, sizeof(emu.z9001.ram));
-        memcpy(emu.z9001.color_ram, state.irm[0], sizeof(emu.z9001.color_ram));
-        memcpy(emu.z9001.video_ram, state.irm[1], sizeof(emu.z9001.video_ram));
+        static_assert(z9001::ram_size == sizeof(state.ram), "Z9001 RAM size mismatch");
+        static_assert(z9001::color_ram_size < sizeof(state.irm[0]), "Z9001 color RAM size too big");
+        static_assert(z9001::video_ram_size < sizeof(state.irm[1]), "Z9001 video RAM size too big");
+        memcpy(emu.z9001.ram, state.ram, z9001::ram_size);
+        memcpy(emu.z9001.color_ram, state.irm[0], z9001::color_ram_size);
+        memcpy(emu.z9001.video_ram, state.irm[1], z9001::video_ram_size);
     }
 }
 
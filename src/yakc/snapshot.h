@@ -3,6 +3,23 @@
 /**
     @class snapshot
     @brief helper functions for taking and applying machine state snapshots
+
+    There are 2 snapshot formats:
+
+    - version 1: the uncompressed, fixed-size state_t struct with room
+      for all memory banks of all systems (about 256 KByte)
+    - version 2: an 8-byte header (magic and version), followed by a
+      zlib-compressed stream of tagged chunks; one versioned chunk per
+      subsystem of the sys_t state (emulator, clock, CPU, CTC, PIOs, KC85,
+      Z1013, Z9001), and one chunk per memory bank that actually exists on
+      the emulated system, where all-zero 1 KByte pages are omitted
+
+    Version 2 snapshots are written and read through streaming callbacks,
+    so that they can go directly into files or growable memory buffers.
+    read_stream() also accepts the version 1 format. Unknown chunks and
+    subsystem chunks with an unknown version or size are skipped, the
+    affected subsystems keep their current state. Only the emulator
+    chunk (system model and OS) is required.
 */
 #include "yakc/yakc.h"
 
@@ -12,10 +29,8 @@ class snapshot {
 public:
     /// snapshot state
     #pragma pack(push,1)
-    struct state_t {
-        int magic;
-        int version;
-
+    /// the complete non-memory system state
+    struct sys_t {
         // general emulator state
         struct emu_t {
             uword model;
@@ -138,6 +153,14 @@ public:
         static_assert((sizeof(pio_t)&3)==0, "pio_t odd size!");
         pio_t pio1;
         pio_t pio2;
+    };
+    static_assert((sizeof(sys_t)&3)==0, "sys_t odd size!");
+
+    /// the original (version 1) uncompressed snapshot format
+    struct state_t {
+        int magic;
+        int version;
+        sys_t sys;
 
         // system RAM banks
         ubyte ram[4][0x4000];
@@ -151,52 +174,108 @@ public:
     static_assert((sizeof(state_t)&3)==0, "state odd size!");
     #pragma pack(pop)
 
-    /// record a snapshot into a memory buffer
-    static void take_snapshot(const yakc& emu, state_t& state);
-    /// apply a snapshot from memory buffer
+    /// the current (chunked, compressed) snapshot format version
+    static const int cur_version = 2;
+
+    /// stream output callback, must return false on error
+    typedef bool (*write_func)(void* userdata, const void* ptr, int num_bytes);
+    /// stream input callback, returns number of bytes read, 0 at end of stream
+    typedef int (*read_func)(void* userdata, void* ptr, int max_bytes);
+
+    /// a growable memory buffer to write snapshot streams to and read from
+    struct membuf {
+        ubyte* ptr = nullptr;
+        int size = 0;
+        int capacity = 0;
+        int pos = 0;
+        /// memory allocation functions (kept by discard())
+        ext_funcs funcs;
+
+        /// free the buffer memory
+        void discard();
+        /// stream output callback, userdata must point to membuf
+        static bool write(void* userdata, const void* ptr, int num_bytes);
+        /// stream input callback, userdata must point to membuf
+        static int read(void* userdata, void* ptr, int max_bytes);
+    };
+
+    /// memory bank types
+    enum bank_type {
+        bank_ram = 0,       // system RAM
+        bank_video,         // video RAM (IRM)
+        bank_color,         // color RAM (Z9001)
+        bank_module,        // KC85 expansion module RAM
+    };
+    /// description of a memory bank of the running system
+    struct bank_t {
+        ubyte type = 0;
+        ubyte index = 0;
+        ubyte* ptr = nullptr;
+        int size = 0;
+    };
+    /// max number of memory banks
+    static const int max_banks = 16;
+    /// enumerate the memory banks which exist on the running system (optionally ends copy-on-write sharing)
+    static int enumerate_banks(yakc& emu, bank_t* out_banks, int max_num_banks, bool unshare=true);
+
+    /// write a compressed snapshot to a stream (level is zlib compression level)
+    static bool write_stream(yakc& emu, write_func write_fn, void* userdata, int level=6);
+    /// read and apply a snapshot stream, also accepts the uncompressed version 1 format
+    static bool read_stream(read_func read_fn, void* userdata, yakc& emu);
+
+    /// record a version 1 snapshot into a memory buffer
+    static void take_snapshot(yakc& emu, state_t& state);
+    /// apply a version 1 snapshot from memory buffer
     static void apply_snapshot(const state_t& state, yakc& emu);
     /// test if state_t contains a valid snapshot
     static bool is_snapshot(const state_t& state);
 
+    /// write the complete non-memory state
+    static void write_sys_state(const yakc& emu, sys_t& sys);
+    /// apply the complete non-memory state
+    static void apply_sys_state(const sys_t& sys, yakc& emu);
+    /// fixup system after all state has been applied
+    static void after_apply(yakc& emu);
+
     /// write generic emu state
-    static void write_emu_state(const yakc& emu, state_t& state);
+    static void write_emu_state(const yakc& emu, sys_t& sys);
     /// apply generic emu state
-    static void apply_emu_state(const state_t& state, yakc& emu);
+    static void apply_emu_state(const sys_t& sys, yakc& emu);
     /// write the clock state
-    static void write_clock_state(const yakc& emu, state_t& state);
+    static void write_clock_state(const yakc& emu, sys_t& sys);
     /// apply clock state
-    static void apply_clock_state(const state_t& state, yakc& emu);
+    static void apply_clock_state(const sys_t& sys, yakc& emu);
     /// write the KC system state
-    static void write_kc_state(const yakc& emu, state_t& state);
+    static void write_kc_state(const yakc& emu, sys_t& sys);
     /// apply toplevel KC state
-    static void apply_kc_state(const state_t& state, yakc& emu);
+    static void apply_kc_state(const sys_t& sys, yakc& emu);
     /// write the Z1013 system state
-    static void write_z1013_state(const yakc& emu, state_t& state);
+    static void write_z1013_state(const yakc& emu, sys_t& sys);
     /// apply Z1013 system state
-    static void apply_z1013_state(const state_t& state, yakc& emu);
+    static void apply_z1013_state(const sys_t& sys, yakc& emu);
     /// write the z9001 system state
-    static void write_z9001_state(const yakc& emu, state_t& state);
+    static void write_z9001_state(const yakc& emu, sys_t& sys);
     /// apply z9001 system state
-    static void apply_z9001_state(const state_t& state, yakc& emu);
+    static void apply_z9001_state(const sys_t& sys, yakc& emu);
     /// write the cpu state
-    static void write_cpu_state(const yakc& emu, state_t& state);
+    static void write_cpu_state(const yakc& emu, sys_t& sys);
     /// apply cpu state
-    static void apply_cpu_state(const state_t& state, yakc& emu);
+    static void apply_cpu_state(const sys_t& sys, yakc& emu);
     /// write interrupt controller state
-    static void write_intctrl_state(const z80int& src, state_t::intctrl_t& dst);
+    static void write_intctrl_state(const z80int& src, sys_t::intctrl_t& dst);
     /// apply interrupt controller state
-    static void apply_intctrl_state(const state_t::intctrl_t& src, z80int& dst);
+    static void apply_intctrl_state(const sys_t::intctrl_t& src, z80int& dst);
     /// write the ctc state
-    static void write_ctc_state(const yakc& emu, state_t& state);
+    static void write_ctc_state(const yakc& emu, sys_t& sys);
     /// apply ctc state
-    static void apply_ctc_state(const state_t& state, yakc& emu);
+    static void apply_ctc_state(const sys_t& sys, yakc& emu);
     /// write the pio state
-    static void write_pio_state(const yakc& emu, state_t& state);
+    static void write_pio_state(const yakc& emu, sys_t& sys);
     /// apply pio state
-    static void apply_pio_state(const state_t& state, yakc& emu);
-    /// write memory state
+    static void apply_pio_state(const sys_t& sys, yakc& emu);
+    /// write version 1 memory state
     static void write_memory_state(const yakc& emu, state_t& state);
-    /// apply memory state
+    /// apply version 1 memory state
     static void apply_memory_state(const state_t& state, yakc& emu);
 };
 
@@ -0,0 +1,234 @@
+//------------------------------------------------------------------------------
+//  symbols.cc
+//------------------------------------------------------------------------------
+#include "symbols.h"
+#include <stdio.h>
+#include <ctype.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+symbols::~symbols() {
+    this->clear();
+}
+
+//------------------------------------------------------------------------------
+void
+symbols::clear() {
+    if (this->entries) {
+        YAKC_FREE(this->funcs, this->entries);
+        this->entries = nullptr;
+    }
+    this->num = 0;
+    this->capacity = 0;
+}
+
+//------------------------------------------------------------------------------
+int
+symbols::lower_bound(uword addr) const {
+    int lo = 0;
+    int hi = this->num;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (this->entries[mid].addr < addr) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+//------------------------------------------------------------------------------
+void
+symbols::add(uword addr, const char* name) {
+    YAKC_ASSERT(name);
+    const int index = this->lower_bound(addr);
+    if ((index >= this->num) || (this->entries[index].addr != addr)) {
+        // insert a new entry, keep the entries sorted by address
+        if (this->num == this->capacity) {
+            const int new_capacity = this->capacity ? this->capacity * 2 : 256;
+            entry* new_entries = (entry*) YAKC_MALLOC(this->funcs, new_capacity * sizeof(entry));
+            if (this->entries) {
+                memcpy(new_entries, this->entries, this->num * sizeof(entry));
+                YAKC_FREE(this->funcs, this->entries);
+            }
+            this->entries = new_entries;
+            this->capacity = new_capacity;
+        }
+        memmove(&this->entries[index + 1], &this->entries[index], (this->num - index) * sizeof(entry));
+        this->num++;
+    }
+    entry& e = this->entries[index];
+    e = entry();
+    e.addr = addr;
+    strncpy(e.name, name, max_name_length);
+}
+
+//------------------------------------------------------------------------------
+const char*
+symbols::lookup(uword addr) const {
+    const int index = this->lower_bound(addr);
+    if ((index < this->num) && (this->entries[index].addr == addr)) {
+        return this->entries[index].name;
+    }
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+int
+symbols::size() const {
+    return this->num;
+}
+
+//------------------------------------------------------------------------------
+bool
+symbols::parse_addr(const char* tok, int len, bool strict, uword& addr) {
+    bool marked = false;
+    if ((len > 1) && ((tok[0] == '$') || (tok[0] == '#'))) {
+        tok++; len--; marked = true;
+    }
+    else if ((len > 2) && (tok[0] == '0') && ((tok[1] == 'x') || (tok[1] == 'X'))) {
+        tok += 2; len -= 2; marked = true;
+    }
+    else if ((len > 1) && ((tok[len - 1] == 'h') || (tok[len - 1] == 'H'))) {
+        len--; marked = true;
+    }
+    else if (isdigit(tok[0])) {
+        marked = true;
+    }
+    if (strict && !marked) {
+        return false;
+    }
+    uint32_t val = 0;
+    for (int i = 0; i < len; i++) {
+        if (!isxdigit(tok[i])) {
+            return false;
+        }
+        val = (val << 4) | (isdigit(tok[i]) ? (tok[i] - '0') : ((tok[i] | 0x20) - 'a' + 10));
+        if (val > 0xFFFF) {
+            return false;
+        }
+    }
+    addr = uword(val);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static bool
+is_equ(const char* tok, int len) {
+    if ((len > 0) && (tok[0] == '.')) {
+        tok++; len--;
+    }
+    return (len == 3) && (tolower(tok[0]) == 'e') && (tolower(tok[1]) == 'q') && (tolower(tok[2]) == 'u');
+}
+
+//------------------------------------------------------------------------------
+bool
+symbols::parse_line(const char* line, int len) {
+    // split into tokens, skip EQU keywords
+    const char* tok[2];
+    int tok_len[2];
+    int num_tok = 0;
+    int i = 0;
+    while (i < len) {
+        const char c = line[i];
+        if (c == ';') {
+            break;
+        }
+        if (isspace(c) || (c == ':') || (c == '=') || (c == ',')) {
+            i++;
+            continue;
+        }
+        const int start = i;
+        while ((i < len) && !isspace(line[i]) && (line[i] != ':') && (line[i] != '=') && (line[i] != ',') && (line[i] != ';')) {
+            i++;
+        }
+        const int n = i - start;
+        const char* t = line + start;
+        if (is_equ(t, n)) {
+            continue;
+        }
+        if (num_tok == 2) {
+            return false;
+        }
+        tok[num_tok] = t;
+        tok_len[num_tok] = n;
+        num_tok++;
+    }
+    if (num_tok != 2) {
+        return false;
+    }
+    // find the address, prefer tokens which are clearly a number
+    uword addr = 0;
+    int name_index = -1;
+    if (parse_addr(tok[0], tok_len[0], true, addr)) {
+        name_index = 1;
+    }
+    else if (parse_addr(tok[1], tok_len[1], true, addr)) {
+        name_index = 0;
+    }
+    else if (parse_addr(tok[0], tok_len[0], false, addr)) {
+        name_index = 1;
+    }
+    else if (parse_addr(tok[1], tok_len[1], false, addr)) {
+        name_index = 0;
+    }
+    if (name_index < 0) {
+        return false;
+    }
+    const char* name = tok[name_index];
+    if (isdigit(name[0]) || (name[0] == '$') || (name[0] == '#')) {
+        return false;
+    }
+    char buf[max_name_length + 1] = { };
+    const int n = tok_len[name_index] < max_name_length ? tok_len[name_index] : max_name_length;
+    memcpy(buf, name, n);
+    this->add(addr, buf);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+int
+symbols::load(const char* text, int num_bytes) {
+    YAKC_ASSERT(text);
+    int num_found = 0;
+    int pos = 0;
+    while (pos < num_bytes) {
+        int end = pos;
+        while ((end < num_bytes) && (text[end] != '\n') && (text[end] != '\r')) {
+            end++;
+        }
+        if (this->parse_line(text + pos, end - pos)) {
+            num_found++;
+        }
+        pos = end + 1;
+    }
+    return num_found;
+}
+
+//------------------------------------------------------------------------------
+int
+symbols::load_file(const char* path) {
+    YAKC_ASSERT(path);
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        return -1;
+    }
+    fseek(fp, 0, SEEK_END);
+    const int size = int(ftell(fp));
+    fseek(fp, 0, SEEK_SET);
+    int num_found = -1;
+    if (size >= 0) {
+        char* text = (char*) YAKC_MALLOC(this->funcs, size + 1);
+        if (fread(text, 1, size, fp) == size_t(size)) {
+            num_found = this->load(text, size);
+        }
+        YAKC_FREE(this->funcs, text);
+    }
+    fclose(fp);
+    return num_found;
+}
+
+} // namespace YAKC
@@ -0,0 +1,64 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::symbols
+    @brief a table of symbol names for code addresses
+
+    Symbols can be added one by one, or loaded from a text file with
+    one symbol per line, which has an address and a name in any order,
+    for instance the output of most Z80 assemblers:
+
+        CRT     EQU 0F003H
+        KBD:    equ $E0F7
+        E1A4    PADR
+        0xE000  CAOS_INIT   ; comments start with a semicolon
+
+    Hex addresses can have a $, # or 0x prefix or an H suffix. Without
+    any of those, a token which consists of hex digits only is taken
+    as the address if the other token isn't. Lines which don't contain
+    an address and a name are skipped.
+*/
+#include "yakc/core.h"
+
+namespace YAKC {
+
+class symbols {
+public:
+    /// max length of a symbol name (longer names are truncated)
+    static const int max_name_length = 31;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+    /// destructor
+    ~symbols();
+    /// remove all symbols
+    void clear();
+    /// add a symbol, replaces an existing symbol at the same address
+    void add(uword addr, const char* name);
+    /// parse symbols from text, return the number of symbols found
+    int load(const char* text, int num_bytes);
+    /// load symbols from a text file, return the number of symbols found or -1 on error
+    int load_file(const char* path);
+    /// get the name of the symbol at an address, nullptr if none
+    const char* lookup(uword addr) const;
+    /// number of symbols
+    int size() const;
+
+private:
+    struct entry {
+        uword addr = 0;
+        char name[max_name_length + 1] = { };
+    };
+    /// index of the first entry with an address >= addr
+    int lower_bound(uword addr) const;
+    /// parse a token as address, return false if it isn't one
+    static bool parse_addr(const char* tok, int len, bool strict, uword& addr);
+    /// parse a single line
+    bool parse_line(const char* line, int len);
+
+    entry* entries = nullptr;
+    int num = 0;
+    int capacity = 0;
+};
+
+} // namespace YAKC
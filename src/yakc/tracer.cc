@@ -0,0 +1,421 @@
+//------------------------------------------------------------------------------
+//  tracer.cc
+//------------------------------------------------------------------------------
+#include "tracer.h"
+#include <chrono>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+tracer::~tracer() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+tracer::setup(int num, bool with_regs) {
+    YAKC_ASSERT(!this->is_valid() && (num >= 2));
+    this->ring = (ubyte*) YAKC_MALLOC(this->funcs, num * block_size);
+    this->num_blocks = num;
+    this->record_regs = with_regs;
+    this->num_written = 0;
+    this->num_lost_blocks = 0;
+    this->read_pos = 0;
+    this->cur = nullptr;
+    this->enabled = true;
+}
+
+//------------------------------------------------------------------------------
+void
+tracer::discard() {
+    if (this->exporting()) {
+        this->stop_export();
+    }
+    if (this->ring) {
+        YAKC_FREE(this->funcs, this->ring);
+        this->ring = nullptr;
+    }
+    this->num_blocks = 0;
+    this->cur = nullptr;
+    this->enabled = false;
+}
+
+//------------------------------------------------------------------------------
+bool
+tracer::is_valid() const {
+    return nullptr != this->ring;
+}
+
+//------------------------------------------------------------------------------
+ubyte
+tracer::peek(const memory& mem, uword addr) {
+    return mem.ptr(addr)[addr & memory::page::mask];
+}
+
+//------------------------------------------------------------------------------
+int
+tracer::instr_length(const memory& mem, uword addr) {
+    const ubyte op[4] = {
+        peek(mem, addr), peek(mem, addr + 1), peek(mem, addr + 2), peek(mem, addr + 3)
+    };
+    return instr_length(op);
+}
+
+//------------------------------------------------------------------------------
+int
+tracer::instr_length(const ubyte* bytes) {
+    // opcodes with an 8-bit immediate or displacement
+    static const uint32_t imm8[8] = {
+        0x41414040, 0x41414141, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x48484040, 0x40404040,
+    };
+    // opcodes with a 16-bit immediate
+    static const uint32_t imm16[8] = {
+        0x00020002, 0x04060406, 0x00000000, 0x00000000,
+        0x00000000, 0x00000000, 0x1414341C, 0x14141414,
+    };
+    // opcodes with an (HL) operand, which becomes (IX+d) with a DD/FD prefix
+    static const uint32_t ind[8] = {
+        0x00000000, 0x00700000, 0x40404040, 0x40BF4040,
+        0x40404040, 0x40404040, 0x00000000, 0x00000000,
+    };
+    ubyte op = bytes[0];
+    int len = 1;
+    if (0xCB == op) {
+        return 2;
+    }
+    else if (0xED == op) {
+        // LD (nn),rr and LD rr,(nn)
+        op = bytes[1];
+        return ((op & 0xC7) == 0x43) ? 4 : 2;
+    }
+    else if ((0xDD == op) || (0xFD == op)) {
+        op = bytes[1];
+        if (0xCB == op) {
+            return 4;
+        }
+        else if ((0xDD == op) || (0xED == op) || (0xFD == op)) {
+            // a prefix without effect
+            return 1;
+        }
+        len = 2;
+        if (ind[op>>5] & (1U<<(op & 31))) {
+            len++;
+        }
+    }
+    if (imm8[op>>5] & (1U<<(op & 31))) {
+        len += 1;
+    }
+    else if (imm16[op>>5] & (1U<<(op & 31))) {
+        len += 2;
+    }
+    return len;
+}
+
+//------------------------------------------------------------------------------
+void
+tracer::begin_block(uint64_t cycle_count) {
+    const uint64_t seq = this->num_written.load(std::memory_order_relaxed);
+    this->cur = this->ring + (seq % this->num_blocks) * block_size;
+    this->pos = sizeof(block_header);
+    this->cur_records = 0;
+    this->cur_flags = this->record_regs ? block_regs : 0;
+    this->start_cycle = cycle_count;
+    this->last_cycle = cycle_count;
+}
+
+//------------------------------------------------------------------------------
+void
+tracer::end_block() {
+    const uint64_t seq = this->num_written.load(std::memory_order_relaxed);
+    block_header hdr;
+    hdr.seq = seq;
+    hdr.start_cycle = this->start_cycle;
+    hdr.num_bytes = this->pos;
+    hdr.num_records = this->cur_records;
+    hdr.flags = this->cur_flags;
+    memcpy(this->cur, &hdr, sizeof(hdr));
+    // publish the block, the reader must see the block content first
+    this->num_written.store(seq + 1, std::memory_order_seq_cst);
+    this->cur = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void
+tracer::record(const z80& cpu, uint64_t cycle_count) {
+    YAKC_ASSERT(this->is_valid());
+    if (this->cur) {
+        // start a new block if the current is full, the cycle counter
+        // went backward (e.g. after a snapshot was applied), or
+        // register recording was switched on or off
+        if (((this->pos + max_record_size) > block_size) ||
+            (cycle_count < this->last_cycle) ||
+            (this->record_regs != (0 != (this->cur_flags & block_regs)))) {
+            this->end_block();
+        }
+    }
+    const bool first = (nullptr == this->cur);
+    if (first) {
+        this->begin_block(cycle_count);
+    }
+
+    ubyte* ptr = this->cur + this->pos;
+    ubyte& flags = *ptr++;
+    const int num_op = instr_length(cpu.mem, cpu.PC);
+    flags = ubyte(num_op - 1);
+    if (first || (cpu.PC != this->next_pc)) {
+        flags |= rec_pc;
+        *ptr++ = ubyte(cpu.PC);
+        *ptr++ = ubyte(cpu.PC>>8);
+    }
+    for (int i = 0; i < num_op; i++) {
+        *ptr++ = peek(cpu.mem, cpu.PC + i);
+    }
+    uint64_t delta = cycle_count - this->last_cycle;
+    if (delta < rec_delta_varint) {
+        flags |= ubyte(delta << rec_delta_shift);
+    }
+    else {
+        flags |= ubyte(rec_delta_varint << rec_delta_shift);
+        while (delta >= 0x80) {
+            *ptr++ = ubyte(delta | 0x80);
+            delta >>= 7;
+        }
+        *ptr++ = ubyte(delta);
+    }
+    if (this->cur_flags & block_regs) {
+        const uword regs[num_regs] = {
+            cpu.AF, cpu.BC, cpu.DE, cpu.HL, cpu.IX, cpu.IY, cpu.SP, cpu.WZ,
+            cpu.AF_, cpu.BC_, cpu.DE_, cpu.HL_, cpu.WZ_,
+            uword(cpu.I<<8 | cpu.R),
+            uword(cpu.IM | cpu.IFF1<<8 | cpu.IFF2<<9 | cpu.HALT<<10)
+        };
+        uword mask = 0;
+        for (int i = 0; i < num_regs; i++) {
+            if (first || (regs[i] != this->last_regs[i])) {
+                mask |= 1<<i;
+            }
+        }
+        *ptr++ = ubyte(mask);
+        *ptr++ = ubyte(mask>>8);
+        for (int i = 0; i < num_regs; i++) {
+            if (mask & (1<<i)) {
+                *ptr++ = ubyte(regs[i]);
+                *ptr++ = ubyte(regs[i]>>8);
+                this->last_regs[i] = regs[i];
+            }
+        }
+    }
+    this->pos = int(ptr - this->cur);
+    this->cur_records++;
+    this->next_pc = cpu.PC + num_op;
+    this->last_cycle = cycle_count;
+}
+
+//------------------------------------------------------------------------------
+void
+tracer::flush() {
+    if (this->cur) {
+        this->end_block();
+    }
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+tracer::num_blocks_written() const {
+    return this->num_written.load(std::memory_order_acquire);
+}
+
+//------------------------------------------------------------------------------
+bool
+tracer::read_block(ubyte* dst) {
+    YAKC_ASSERT(this->is_valid() && dst);
+    for (;;) {
+        const uint64_t written = this->num_written.load(std::memory_order_acquire);
+        if (this->read_pos >= written) {
+            return false;
+        }
+        // the slot of block 'written' is being filled, so only the
+        // blocks after it in the ring are complete
+        const uint64_t oldest = (written >= uint64_t(this->num_blocks)) ? (written - this->num_blocks + 1) : 0;
+        if (this->read_pos < oldest) {
+            this->num_lost_blocks += oldest - this->read_pos;
+            this->read_pos = oldest;
+        }
+        const uint64_t seq = this->read_pos++;
+        memcpy(dst, this->ring + (seq % this->num_blocks) * block_size, block_size);
+        // check that the block wasn't overwritten while it was copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t written_after = this->num_written.load(std::memory_order_relaxed);
+        block_header hdr;
+        memcpy(&hdr, dst, sizeof(hdr));
+        if ((written_after < (seq + this->num_blocks)) && (hdr.seq == seq)) {
+            return true;
+        }
+        this->num_lost_blocks++;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+tracer::drain(ubyte* buf) {
+    while (this->read_block(buf)) {
+        block_header hdr;
+        memcpy(&hdr, buf, sizeof(hdr));
+        if (!this->export_fn(this->export_userdata, buf, hdr.num_bytes)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+tracer::save(write_func write_fn, void* userdata) {
+    YAKC_ASSERT(this->is_valid() && write_fn && !this->exporting());
+    this->flush();
+    file_header hdr;
+    if (!write_fn(userdata, &hdr, sizeof(hdr))) {
+        return false;
+    }
+    ubyte* buf = (ubyte*) YAKC_MALLOC(this->funcs, block_size);
+    this->export_fn = write_fn;
+    this->export_userdata = userdata;
+    const bool ok = this->drain(buf);
+    this->export_fn = nullptr;
+    this->export_userdata = nullptr;
+    YAKC_FREE(this->funcs, buf);
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+bool
+tracer::start_export(write_func write_fn, void* userdata) {
+    YAKC_ASSERT(this->is_valid() && write_fn && !this->exporting());
+    file_header hdr;
+    if (!write_fn(userdata, &hdr, sizeof(hdr))) {
+        return false;
+    }
+    this->export_fn = write_fn;
+    this->export_userdata = userdata;
+    this->export_stop = false;
+    this->export_error = false;
+    this->export_thread = std::thread(&tracer::export_loop, this);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool
+tracer::stop_export() {
+    YAKC_ASSERT(this->exporting());
+    this->flush();
+    this->export_stop = true;
+    this->export_thread.join();
+    this->export_fn = nullptr;
+    this->export_userdata = nullptr;
+    return !this->export_error;
+}
+
+//------------------------------------------------------------------------------
+bool
+tracer::exporting() const {
+    return this->export_thread.joinable();
+}
+
+//------------------------------------------------------------------------------
+void
+tracer::export_loop() {
+    ubyte* buf = (ubyte*) YAKC_MALLOC(this->funcs, block_size);
+    for (;;) {
+        // check the stop flag first, so that the blocks flushed
+        // by stop_export() are written before the loop ends
+        const bool stop = this->export_stop;
+        if (!this->drain(buf)) {
+            this->export_error = true;
+            break;
+        }
+        if (stop) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    YAKC_FREE(this->funcs, buf);
+}
+
+//------------------------------------------------------------------------------
+int
+tracer::decode_block(const ubyte* block, entry_func fn, void* userdata) {
+    YAKC_ASSERT(block && fn);
+    block_header hdr;
+    memcpy(&hdr, block, sizeof(hdr));
+    if ((hdr.num_bytes < sizeof(hdr)) || (hdr.num_bytes > uint32_t(block_size))) {
+        return -1;
+    }
+    const ubyte* ptr = block + sizeof(hdr);
+    const ubyte* end = block + hdr.num_bytes;
+    entry e;
+    e.cycle_count = hdr.start_cycle;
+    e.has_regs = 0 != (hdr.flags & block_regs);
+    // each field is bounds-checked before it is read, a damaged
+    // block must not cause reads past the block end
+    for (uint32_t i = 0; i < hdr.num_records; i++) {
+        if (ptr >= end) {
+            return -1;
+        }
+        const ubyte flags = *ptr++;
+        e.num_op_bytes = (flags & rec_num_op_mask) + 1;
+        if (flags & rec_pc) {
+            if ((end - ptr) < 2) {
+                return -1;
+            }
+            e.pc = ptr[0] | ptr[1]<<8;
+            ptr += 2;
+        }
+        else if (0 == i) {
+            return -1;
+        }
+        if ((end - ptr) < e.num_op_bytes) {
+            return -1;
+        }
+        for (int j = 0; j < e.num_op_bytes; j++) {
+            e.op[j] = *ptr++;
+        }
+        uint64_t delta = flags >> rec_delta_shift;
+        if (rec_delta_varint == delta) {
+            delta = 0;
+            int shift = 0;
+            ubyte b;
+            do {
+                if (ptr >= end) {
+                    return -1;
+                }
+                b = *ptr++;
+                delta |= uint64_t(b & 0x7F) << shift;
+                shift += 7;
+            }
+            while ((b & 0x80) && (shift < 64));
+        }
+        e.cycle_count += delta;
+        if (e.has_regs) {
+            if ((end - ptr) < 2) {
+                return -1;
+            }
+            const uword mask = ptr[0] | ptr[1]<<8;
+            ptr += 2;
+            for (int r = 0; r < num_regs; r++) {
+                if (mask & (1<<r)) {
+                    if ((end - ptr) < 2) {
+                        return -1;
+                    }
+                    e.regs[r] = ptr[0] | ptr[1]<<8;
+                    ptr += 2;
+                }
+            }
+        }
+        fn(userdata, e);
+        e.pc += e.num_op_bytes;
+    }
+    return int(hdr.num_records);
+}
+
+} // namespace YAKC
@@ -0,0 +1,183 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::tracer
+    @brief record a long CPU execution trace into a ring buffer
+
+    When enabled, the emulated systems call record() before each
+    instruction, which appends a compact record to the trace:
+
+    - a flags byte with the number of opcode bytes, the cycle delta
+      to the previous record if it is small, and whether the PC follows
+    - the PC, only if it doesn't follow the previous instruction
+    - the opcode bytes (1..4, the instruction length is decoded)
+    - the cycle delta as varint, only if it doesn't fit into the flags
+    - optionally (for all records in a block) the registers, as a
+      16-bit mask of the register values which changed since the
+      previous record, followed by the changed values
+
+    Without registers, the boot sequence of the KC85/3 takes less than
+    4 bytes per instruction, so a few million instructions fit into the
+    default 16 MBytes.
+
+    The ring buffer is split into fixed-size blocks, and each block is
+    self-contained: its header has the sequence number and absolute
+    cycle count, and its first record has the PC and all registers.
+    The emulator thread fills the blocks and publishes them with an
+    atomic counter, another thread can read completed blocks with
+    read_block() at the same time without locking. When the ring buffer
+    is full, the oldest blocks are overwritten (and counted as lost if
+    they haven't been read yet), so the trace always contains the most
+    recent history.
+
+    A trace can be written to a stream in one go with save(), or
+    streamed continuously by a background thread with start_export().
+    The stream has a file_header, followed by the used part of each
+    block (starting with its block_header), the blocks can be decoded
+    with decode_block().
+
+    The cost when disabled is a single branch per instruction in the
+    emulation loop.
+*/
+#include "yakc/core.h"
+#include "yakc/z80.h"
+#include <atomic>
+#include <thread>
+
+namespace YAKC {
+
+class tracer {
+public:
+    /// size of a trace block in bytes
+    static const int block_size = 4096;
+    /// default number of blocks (16 MBytes)
+    static const int default_num_blocks = 4096;
+    /// max size of an encoded record
+    static const int max_record_size = 52;
+    /// register values in a record
+    enum reg {
+        reg_AF = 0, reg_BC, reg_DE, reg_HL, reg_IX, reg_IY, reg_SP, reg_WZ,
+        reg_AF_, reg_BC_, reg_DE_, reg_HL_, reg_WZ_,
+        reg_IR,         // I<<8 | R
+        reg_state,      // IM | IFF1<<8 | IFF2<<9 | HALT<<10
+        num_regs
+    };
+    /// record flags byte bits
+    enum {
+        rec_num_op_mask = (3<<0),   // number of opcode bytes - 1
+        rec_pc = (1<<2),            // PC follows
+        rec_delta_shift = 3,        // cycle delta 0..30, 31: varint follows
+        rec_delta_varint = 31,
+    };
+    /// block flags
+    enum {
+        block_regs = (1<<0),        // each record has a register mask and values
+    };
+    /// header at the start of each block
+    struct block_header {
+        uint64_t seq = 0;           // block sequence number
+        uint64_t start_cycle = 0;   // cycle count of the first record
+        uint32_t num_bytes = 0;     // used bytes, including the header
+        uint32_t num_records = 0;
+        uint32_t flags = 0;         // block_regs
+        uint32_t reserved = 0;
+    };
+    /// header at the start of an exported stream
+    struct file_header {
+        char magic[8] = { 'Y', 'A', 'K', 'C', 'T', 'R', 'C', '1' };
+        uint32_t block_size = tracer::block_size;
+        uint32_t reserved = 0;
+    };
+    /// a decoded trace record
+    struct entry {
+        uword pc = 0;
+        int num_op_bytes = 0;
+        ubyte op[4] = { };
+        uint64_t cycle_count = 0;
+        bool has_regs = false;
+        uword regs[num_regs] = { };
+    };
+    /// decoded record callback
+    typedef void (*entry_func)(void* userdata, const entry& e);
+    /// stream output callback (same as snapshot::write_func), must return false on error
+    typedef bool (*write_func)(void* userdata, const void* ptr, int num_bytes);
+
+    /// set to false to pause recording, record() must only be called when true
+    bool enabled = false;
+    /// also record register values
+    bool record_regs = false;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+
+    /// destructor
+    ~tracer();
+    /// allocate the ring buffer and enable recording
+    void setup(int num_blocks, bool with_regs);
+    /// stop exporting and free the ring buffer
+    void discard();
+    /// return true if setup
+    bool is_valid() const;
+    /// record the instruction at PC (called by the emulated systems before each instruction)
+    void record(const z80& cpu, uint64_t cycle_count);
+    /// complete the current block, so that it can be read (call from the emulator thread)
+    void flush();
+
+    /// copy the next completed block into dst (block_size bytes), false if none available
+    bool read_block(ubyte* dst);
+    /// number of completed blocks
+    uint64_t num_blocks_written() const;
+    /// number of blocks which were overwritten before they were read
+    uint64_t num_lost_blocks = 0;
+
+    /// write all unread blocks to a stream (call from the emulator thread)
+    bool save(write_func write_fn, void* userdata);
+    /// start streaming blocks to a stream on a background thread
+    bool start_export(write_func write_fn, void* userdata);
+    /// flush the current block, wait until everything is written and stop the background thread
+    bool stop_export();
+    /// return true if currently exporting
+    bool exporting() const;
+
+    /// decode a block, return number of records, or -1 if the block is malformed
+    static int decode_block(const ubyte* block, entry_func fn, void* userdata);
+    /// get the length of the instruction at an address
+    static int instr_length(const memory& mem, uword addr);
+    /// get the length of an instruction from its opcode bytes (4 bytes must be readable)
+    static int instr_length(const ubyte* bytes);
+
+private:
+    /// start a new block at the current sequence number
+    void begin_block(uint64_t cycle_count);
+    /// complete the current block and publish it
+    void end_block();
+    /// write blocks to a stream until no completed blocks are left
+    bool drain(ubyte* buf);
+    /// background export thread
+    void export_loop();
+    /// read a byte without triggering memory traps
+    static ubyte peek(const memory& mem, uword addr);
+
+    ubyte* ring = nullptr;
+    int num_blocks = 0;
+    // producer state
+    ubyte* cur = nullptr;           // current block
+    int pos = 0;                    // write position in current block
+    uint32_t cur_records = 0;
+    uint32_t cur_flags = 0;
+    uword next_pc = 0;              // PC if the previous instruction didn't jump
+    uint64_t start_cycle = 0;
+    uint64_t last_cycle = 0;
+    uword last_regs[num_regs] = { };
+    // completed blocks, published by the producer
+    std::atomic<uint64_t> num_written{0};
+    // consumer state
+    uint64_t read_pos = 0;
+    // export thread
+    std::thread export_thread;
+    std::atomic<bool> export_stop{false};
+    std::atomic<bool> export_error{false};
+    write_func export_fn = nullptr;
+    void* export_userdata = nullptr;
+};
+
+} // namespace YAKC
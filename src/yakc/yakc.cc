@@ -2,16 +2,30 @@
 //  yakc.cc
 //------------------------------------------------------------------------------
 #include "yakc.h"
+#include "yakc/bootcache.h"
+#include "yakc/rewinder.h"
+#include "yakc/movie.h"
+#include "yakc/reverser.h"
 
 namespace YAKC {
 
 //------------------------------------------------------------------------------
 void
 yakc::init(const ext_funcs& sys_funcs, const sound_funcs& snd_funcs) {
-    func = sys_funcs;
-    this->kc85.init(&this->board);
-    this->z1013.init(&this->board);
-    this->z9001.init(&this->board);
+    this->funcs = sys_funcs;
+    if (sys_funcs.assertmsg_func) {
+        install_assertmsg_func(sys_funcs.assertmsg_func);
+    }
+    this->board.trace.funcs = this->funcs;
+    this->board.prof.funcs = this->funcs;
+    this->board.calls.funcs = this->funcs;
+    this->board.ops.funcs = this->funcs;
+    this->board.dbg.funcs = this->funcs;
+    this->board.times.funcs = this->funcs;
+    this->board.cov.funcs = this->funcs;
+    this->kc85.init(&this->board, this->funcs);
+    this->z1013.init(&this->board, this->funcs);
+    this->z9001.init(&this->board, this->funcs);
     this->kc85.audio.setup_callbacks(snd_funcs);
     this->z9001.setup_sound_funcs(snd_funcs);
 }
@@ -31,11 +45,23 @@ yakc::poweron(device m, os_rom rom) {
     else if (this->is_device(device::any_z9001)) {
         this->z9001.poweron(m, rom);
     }
+    // the KC85 CAOS system calls go through the PV1 dispatcher
+    this->board.calls.dispatch_addr = this->is_device(device::any_kc85) ? 0xF003 : 0;
+    this->board.calls.reset();
+    if (this->boot_cache) {
+        this->boot_cache->boot(*this);
+    }
 }
 
 //------------------------------------------------------------------------------
 void
 yakc::poweroff() {
+    if (this->movie_recorder) {
+        this->movie_recorder->stop_recording(*this);
+    }
+    if (this->reverse_debugger) {
+        this->reverse_debugger->clear();
+    }
     if (this->kc85.on) {
         this->kc85.poweroff();
     }
@@ -56,6 +82,12 @@ yakc::switchedon() const {
 //------------------------------------------------------------------------------
 void
 yakc::reset() {
+    if (this->movie_recorder) {
+        this->movie_recorder->on_reset(*this);
+    }
+    if (this->reverse_debugger) {
+        this->reverse_debugger->on_reset(*this);
+    }
     if (this->kc85.on) {
         this->kc85.reset();
     }
@@ -76,6 +108,11 @@ yakc::is_device(device mask) const {
 //------------------------------------------------------------------------------
 void
 yakc::onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, uint64_t max_cycle_count) {
+    if (this->reverse_debugger) {
+        this->board.times.begin(frametimes::snapshot);
+        this->reverse_debugger->begin_frame(*this);
+        this->board.times.end();
+    }
     if (this->kc85.on) {
         this->kc85.onframe(speed_multiplier, micro_secs, min_cycle_count, max_cycle_count);
     }
@@ -85,11 +122,45 @@ yakc::onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, ui
     if (this->z9001.on) {
         this->z9001.onframe(speed_multiplier, micro_secs, min_cycle_count, max_cycle_count);
     }
+    this->board.times.begin(frametimes::snapshot);
+    if (this->rewind_buffer && !this->board.dbg.paused) {
+        this->rewind_buffer->record(*this);
+    }
+    if (this->movie_recorder) {
+        this->movie_recorder->on_frame(*this);
+    }
+    if (this->reverse_debugger) {
+        this->reverse_debugger->end_frame(*this);
+    }
+    this->board.times.end();
+}
+
+//------------------------------------------------------------------------------
+uint64_t
+yakc::cycle_count() const {
+    if (this->kc85.on) {
+        return this->kc85.abs_cycle_count;
+    }
+    else if (this->z1013.on) {
+        return this->z1013.abs_cycle_count;
+    }
+    else if (this->z9001.on) {
+        return this->z9001.abs_cycle_count;
+    }
+    else {
+        return 0;
+    }
 }
 
 //------------------------------------------------------------------------------
 void
 yakc::put_key(ubyte ascii) {
+    if (this->movie_recorder) {
+        this->movie_recorder->on_key(*this, ascii);
+    }
+    if (this->reverse_debugger) {
+        this->reverse_debugger->on_key(*this, ascii);
+    }
     if (this->kc85.on) {
         this->kc85.put_key(ascii);
     }
@@ -101,6 +172,40 @@ yakc::put_key(ubyte ascii) {
     }
 }
 
+//------------------------------------------------------------------------------
+void
+yakc::insert_module(ubyte slot_addr, kc85_exp::module_type type) {
+    if (this->kc85.on) {
+        if (this->movie_recorder) {
+            this->movie_recorder->on_insert_module(*this, slot_addr, type);
+        }
+        if (this->reverse_debugger) {
+            this->reverse_debugger->on_insert_module(*this, slot_addr, type);
+        }
+        kc85_exp& exp = this->kc85.exp;
+        if (exp.slot_occupied(slot_addr)) {
+            exp.remove_module(slot_addr, this->board.cpu.mem);
+        }
+        exp.insert_module(slot_addr, type);
+        // write the module control byte, this switches the module off
+        this->board.cpu.out(slot_addr<<8|0x80, 0x00);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+yakc::remove_module(ubyte slot_addr) {
+    if (this->kc85.on && this->kc85.exp.slot_occupied(slot_addr)) {
+        if (this->movie_recorder) {
+            this->movie_recorder->on_remove_module(*this, slot_addr);
+        }
+        if (this->reverse_debugger) {
+            this->reverse_debugger->on_remove_module(*this, slot_addr);
+        }
+        this->kc85.exp.remove_module(slot_addr, this->board.cpu.mem);
+    }
+}
+
 //------------------------------------------------------------------------------
 const char*
 yakc::system_info() const {
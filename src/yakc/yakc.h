@@ -3,6 +3,19 @@
 /**
     @class YAKC::yakc
     @brief main emulator class
+
+    Thread safety: the emulator core has no mutable global state, all
+    state lives in the yakc instance (including the memory allocation
+    functions passed to init(), which the helper objects hooked into it,
+    like the boot cache or rewind buffer, also allocate through).
+    Different yakc instances can be used on different threads at the
+    same time without locking. A single instance (and the helper objects
+    hooked into it) must only be accessed by one thread at a time. ROM
+    dumps and other data shared between instances are only read by the
+    core. The only exception is the assert callback in ext_funcs: the
+    first init() which passes one installs it process-wide (atomically,
+    so init() can be called on different threads), later callbacks are
+    ignored, so all instances should pass the same callback.
 */
 #include "yakc/core.h"
 #include "yakc/breadboard.h"
@@ -12,14 +25,29 @@
 
 namespace YAKC {
 
+class bootcache;
+class rewinder;
+class movie;
+class reverser;
+
 class yakc {
 public:
     device model = device::none;
     os_rom os = os_rom::none;
+    /// external functions, set in init()
+    ext_funcs funcs;
     breadboard board;
     class kc85 kc85;
     class z1013 z1013;
     class z9001 z9001;
+    /// optional boot cache, used by poweron() if set
+    bootcache* boot_cache = nullptr;
+    /// optional rewind buffer, onframe() records each frame into it if set
+    rewinder* rewind_buffer = nullptr;
+    /// movie currently recording input events (see movie::start_recording())
+    movie* movie_recorder = nullptr;
+    /// optional reverse debugger, logs frames and input events if set
+    reverser* reverse_debugger = nullptr;
 
     /// one-time init
     void init(const ext_funcs& funcs, const sound_funcs& snd_funcs);
@@ -33,10 +61,16 @@ public:
     void reset();
     /// check if currently emulated device matches
     bool is_device(device mask) const;
-    /// process one frame, up to absolute number of cycles
+    /// process one frame, up to absolute number of cycles (min/max of 0 disables the limiter, e.g. for warp mode)
     void onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, uint64_t max_cycle_count);
+    /// get the absolute CPU cycle count of the running system
+    uint64_t cycle_count() const;
     /// put a key as ASCII code
     void put_key(ubyte ascii);
+    /// insert a KC85 expansion module into a slot (replaces the current module)
+    void insert_module(ubyte slot_addr, kc85_exp::module_type type);
+    /// remove the KC85 expansion module from a slot
+    void remove_module(ubyte slot_addr);
     /// get human-readable info about current system
     const char* system_info() const;
     /// get current border color
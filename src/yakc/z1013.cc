@@ -7,8 +7,9 @@ namespace YAKC {
 
 //------------------------------------------------------------------------------
 void
-z1013::init(breadboard* b) {
+z1013::init(breadboard* b, const ext_funcs& funcs) {
     this->board = b;
+    this->funcs = funcs;
 }
 
 //------------------------------------------------------------------------------
@@ -84,10 +85,22 @@ z1013::poweron(device m) {
     this->kbd_column_bits = 0;
 
     // map memory
-    clear(this->ram, sizeof(this->ram));
-    clear(this->irm, sizeof(this->irm));
+    this->update_buffers();
+    clear(this->ram, ram_size);
+    clear(this->irm, irm_size);
     this->init_memory_mapping();
 
+    // the memory banks for the execution coverage
+    coverage& cov = this->board->cov;
+    cov.clear_banks();
+    cov.add_bank("ram", 0x0000, this->ram, (device::z1013_64 == m) ? 0x10000 : 0x4000);
+    if (os_rom::z1013_mon202 == this->cur_os) {
+        cov.add_bank("mon202", 0xF000, dump_z1013_mon202, sizeof(dump_z1013_mon202));
+    }
+    else {
+        cov.add_bank("mon_a2", 0xF000, dump_z1013_mon_a2, sizeof(dump_z1013_mon_a2));
+    }
+
     // initialize the clock, the z1013_01 runs at 1MHz, all others at 2MHz
     this->board->clck.init((m == device::z1013_01) ? 1000 : 2000);
 
@@ -105,7 +118,28 @@ void
 z1013::poweroff() {
     YAKC_ASSERT(this->on);
     this->board->cpu.mem.unmap_all();
+    this->board->cov.clear_banks();
     this->on = false;
+    this->update_buffers();
+}
+
+//------------------------------------------------------------------------------
+void
+z1013::update_buffers() {
+    if (this->on && !this->ram) {
+        // RAM, video memory and the RGBA8 buffer live in one chunk
+        ubyte* ptr = (ubyte*) YAKC_MALLOC(this->funcs, ram_size + irm_size + rgba8_buffer_size);
+        this->ram = ptr;
+        this->irm = ptr + ram_size;
+        this->rgba8_buffer = (uint32_t*) (ptr + ram_size + irm_size);
+        clear(this->rgba8_buffer, rgba8_buffer_size);
+    }
+    else if (!this->on && this->ram) {
+        YAKC_FREE(this->funcs, this->ram);
+        this->ram = nullptr;
+        this->irm = nullptr;
+        this->rgba8_buffer = nullptr;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -125,12 +159,17 @@ z1013::reset() {
 //------------------------------------------------------------------------------
 void
 z1013::onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, uint64_t max_cycle_count) {
-    // FIXME: the speed multiplier isn't currently working because of the min/max cycle count limiter!
     YAKC_ASSERT(speed_multiplier > 0);
     this->cpu_ahead = false;
     this->cpu_behind = false;    
     z80& cpu = this->board->cpu;
     z80dbg& dbg = this->board->dbg;
+    tracer& trace = this->board->trace;
+    profiler& prof = this->board->prof;
+    callgraph& calls = this->board->calls;
+    opstats& ops = this->board->ops;
+    frametimes& times = this->board->times;
+    coverage& cov = this->board->cov;
     clock& clk = this->board->clck;
 
     if (!dbg.paused) {
@@ -147,21 +186,52 @@ z1013::onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, u
             abs_end_cycles = min_cycle_count;
             this->cpu_behind = true;
         }
+        this->end_cycle_count = abs_end_cycles;
+        dbg.begin_run(cpu);
+        calls.begin_run(cpu);
+        ops.begin_run(cpu);
+        cov.begin_run(cpu);
+        times.begin(frametimes::cpu);
         while (this->abs_cycle_count < abs_end_cycles) {
-            if (dbg.check_break(cpu)) {
+            if (dbg.check_break(cpu, this->abs_cycle_count)) {
                 dbg.paused = true;
                 this->overflow_cycles = 0;
                 break;
             }
             dbg.store_pc_history(cpu); // FIXME: only if debug window open?
+            if (trace.enabled) {
+                trace.record(cpu, this->abs_cycle_count);
+            }
+            const uword pc = cpu.PC;
             int cycles_step = cpu.step();
+            if (prof.enabled) {
+                prof.record(cpu.mem, pc, cycles_step);
+            }
+            if (calls.enabled) {
+                calls.record(cpu, pc, cycles_step);
+            }
             cycles_step += cpu.handle_irq();
+            const bool timed = times.sample(frametimes::clocks);
+            if (timed) {
+                times.begin(frametimes::clocks);
+            }
             clk.update(this, cycles_step);
+            if (timed) {
+                times.end();
+            }
             this->abs_cycle_count += cycles_step;
         }
+        times.end();
+        dbg.end_run(cpu);
+        calls.end_run(cpu);
+        ops.end_run(cpu);
+        cov.end_run(cpu);
+        this->end_cycle_count = 0;
         this->overflow_cycles = uint32_t(this->abs_cycle_count - abs_end_cycles);
     }
+    times.begin(frametimes::video);
     this->decode_video();
+    times.end();
 }
 
 //------------------------------------------------------------------------------
@@ -250,6 +320,25 @@ z1013::pio_in(int pio_id, int port_id) {
     }
 }
 
+//------------------------------------------------------------------------------
+int
+z1013::block_cycles(uword pc) {
+    // block instructions only run in bulk inside onframe(), and must
+    // stop at breakpoints and watchpoints like when single-stepping, the
+    // memory access counters and the coverage also need each single access
+    if ((0 == this->end_cycle_count) ||
+        this->board->dbg.single_step_block(pc) ||
+        this->board->cpu.mem.instrumented()) {
+        return 0;
+    }
+    int64_t cycles = this->end_cycle_count - this->abs_cycle_count;
+    const int clk_cycles = this->board->clck.cycles_to_next_timer();
+    if (clk_cycles < cycles) {
+        cycles = clk_cycles;
+    }
+    return int(cycles);
+}
+
 //------------------------------------------------------------------------------
 void
 z1013::irq() {
@@ -41,16 +41,20 @@ namespace YAKC {
 
 class z1013 : public z80bus {
 public:
-    /// ram banks
-    ubyte ram[4*0x4000];
-    /// 1 Kbyte separate video memory
-    ubyte irm[0x400];
+    /// ram banks (allocated at power-on)
+    ubyte* ram = nullptr;
+    static const int ram_size = 4*0x4000;
+    /// 1 Kbyte separate video memory (allocated at power-on)
+    ubyte* irm = nullptr;
+    static const int irm_size = 0x400;
 
     /// the main board
     breadboard* board = nullptr;
+    /// memory allocation functions
+    ext_funcs funcs;
 
     /// one-time setup
-    void init(breadboard* board);
+    void init(breadboard* board, const ext_funcs& funcs);
     /// initialize memory mapping (called from poweron or snapshot restore)
     void init_memory_mapping();
     /// initialize keymap tables (called from poweron or snapshot restore)
@@ -60,6 +64,8 @@ public:
     void poweron(device m);
     /// power-off the device
     void poweroff();
+    /// allocate or free the RAM and video buffers to match the power state (called from poweron/poweroff or snapshot restore)
+    void update_buffers();
     /// reset the device
     void reset();
     /// get the Z1013 model
@@ -84,6 +90,8 @@ public:
     virtual ubyte pio_in(int pio_id, int port_id) override;
     /// interrupt request callback
     virtual void irq() override;
+    /// bulk block instruction callback
+    virtual int block_cycles(uword pc) override;
 
     /// initialize the key translation table for the basic 8x4 keyboard (z1013.01)
     void init_keymap_8x4();
@@ -104,6 +112,7 @@ public:
     bool cpu_behind = false;
     uint64_t abs_cycle_count = 0;
     uint32_t overflow_cycles = 0;
+    uint64_t end_cycle_count = 0;
     ubyte kbd_column_nr_requested = 0;      // requested keyboard matrix column number (0..7)
     bool kbd_8x8_requested = false;         // bit 4 in PIO-B written
     uint64_t next_kbd_column_bits = 0;
@@ -111,7 +120,8 @@ public:
     static const int max_num_keys = 128;
     uint64_t key_map[max_num_keys] = { };   // map ASCII code to keyboard matrix bits
 
-    uint32_t rgba8_buffer[256*256];          // decoded linear RGBA8 video buffer
+    uint32_t* rgba8_buffer = nullptr;        // decoded linear RGBA8 video buffer (allocated at power-on)
+    static const int rgba8_buffer_size = 256*256*sizeof(uint32_t);
 };
 
 } // namespace YAKC
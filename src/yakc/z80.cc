@@ -16,7 +16,12 @@ bus(nullptr),
 irq_device(nullptr),
 irq_received(false),
 enable_interrupt(false),
-break_on_invalid_opcode(false) {
+break_on_invalid_opcode(false),
+io_trap(nullptr),
+io_trap_userdata(nullptr),
+irq_trap(nullptr),
+irq_trap_userdata(nullptr),
+stats(nullptr) {
     this->init_tables();
 }
 
@@ -138,6 +143,9 @@ z80::handle_irq() {
                 this->mem.w16(this->SP, this->PC);
                 this->PC = this->mem.r16(addr);
                 tstates += 19;
+                if (this->irq_trap) {
+                    this->irq_trap(this->irq_trap_userdata, this->SP, this->PC);
+                }
             }
         }
         this->WZ = this->PC;
@@ -176,12 +184,18 @@ z80::di() {
 //------------------------------------------------------------------------------
 ubyte
 z80::in(uword port) {
+    if (this->io_trap) {
+        this->io_trap(this->io_trap_userdata, port, false);
+    }
     return this->bus->cpu_in(port);
 }
 
 //------------------------------------------------------------------------------
 void
 z80::out(uword port, ubyte val) {
+    if (this->io_trap) {
+        this->io_trap(this->io_trap_userdata, port, true);
+    }
     this->bus->cpu_out(port, val);
 }
 
@@ -195,34 +209,143 @@ z80::sziff2(ubyte val, bool iff2) {
 }
 
 //------------------------------------------------------------------------------
-void
-z80::ldi() {
-    ubyte val = mem.r8(HL);
-    mem.w8(DE, val);
+ubyte
+z80::ldi_ldd_flags(ubyte val) const {
     val += A;
     ubyte f = F & (SF|ZF|CF);
     if (val & 0x02) f |= YF;
     if (val & 0x08) f |= XF;
-    HL++;
-    DE++;
-    BC--;
     if (BC) {
         f |= VF;
     }
-    F = f;
+    return f;
+}
+
+//------------------------------------------------------------------------------
+ubyte
+z80::cpi_cpd_flags(ubyte val) const {
+    int r = int(A) - int(val);
+    ubyte f = NF | (F & CF) | YAKC_SZ(r);
+    if ((r & 0xF) > (A & 0xF)) {
+        f |= HF;
+        r--;
+    }
+    if (r & 0x02) f |= YF;
+    if (r & 0x08) f |= XF;
+    if (BC) {
+        f |= VF;
+    }
+    return f;
+}
+
+//------------------------------------------------------------------------------
+int
+z80::block_count(int ticks, uword addr0, uword addr1, int dir) const {
+    // a repeated iteration takes 21 T-states, an iteration may start
+    // as long as there are ticks left
+    int n = (ticks + 20) / 21;
+    if (n > BC) {
+        n = BC;
+    }
+    // don't cross a memory page boundary
+    const int mask = memory::page::mask;
+    const int left0 = dir > 0 ? memory::page::size - (addr0 & mask) : (addr0 & mask) + 1;
+    const int left1 = dir > 0 ? memory::page::size - (addr1 & mask) : (addr1 & mask) + 1;
+    if (n > left0) {
+        n = left0;
+    }
+    if (n > left1) {
+        n = left1;
+    }
+    return n;
+}
+
+//------------------------------------------------------------------------------
+bool
+z80::clip_block_write(uword dst, int& n, int dir) const {
+    // an iteration which overwrites the block instruction itself must
+    // be the last one, since the next iteration fetches the new opcode,
+    // this also checks for the same host memory mapped at another address
+    bool clipped = false;
+    const ubyte* dst_ptr = mem.ptr(dst) + (dst & memory::page::mask);
+    const bool writable = mem.is_writable(dst);
+    for (uword op_addr = PC - 2; op_addr != PC; op_addr++) {
+        int k = uword(dir > 0 ? op_addr - dst : dst - op_addr);
+        if (k < n) {
+            n = k + 1;
+            clipped = true;
+        }
+        if (writable) {
+            const ubyte* op_ptr = mem.ptr(op_addr) + (op_addr & memory::page::mask);
+            k = int(dir > 0 ? op_ptr - dst_ptr : dst_ptr - op_ptr);
+            if ((k >= 0) && (k < n)) {
+                n = k + 1;
+                clipped = true;
+            }
+        }
+    }
+    return clipped;
+}
+
+//------------------------------------------------------------------------------
+void
+z80::ldi() {
+    ubyte val = mem.r8(HL);
+    mem.w8(DE, val);
+    HL++;
+    DE++;
+    BC--;
+    F = ldi_ldd_flags(val);
 }
 
 //------------------------------------------------------------------------------
 int
 z80::ldir() {
     ldi();
+    if (BC == 0) {
+        return 16;
+    }
+    int cycles = 21;
+    int first = 1;
+    if (bus && !irq_received && !clip_block_write(DE - 1, first, +1)) {
+        // run the following iterations in bulk, up to the next scheduled event
+        const int budget = bus->block_cycles(PC - 2);
+        ubyte val = 0;
+        while ((BC != 0) && (cycles < budget)) {
+            int n = block_count(budget - cycles, HL, DE, +1);
+            const bool last = clip_block_write(DE, n, +1);
+            const ubyte* src = mem.ptr(HL) + (HL & memory::page::mask);
+            ubyte* dst = mem.ptr(DE) + (DE & memory::page::mask);
+            if (mem.is_writable(DE) && ((dst <= src) || (dst >= (src + n)))) {
+                val = src[n - 1];
+                memmove(dst, src, n);
+            }
+            else {
+                // a memory fill through an overlapping copy, or a write-protected
+                // destination, go through the regular memory access path
+                for (int i = 0; i < n; i++) {
+                    val = mem.r8(HL + i);
+                    mem.w8(DE + i, val);
+                }
+            }
+            HL += n;
+            DE += n;
+            BC -= n;
+            R = (R & 0x80) | ((R + 2*n) & 0x7F);
+            cycles += 21 * n;
+            F = ldi_ldd_flags(val);
+            if (last) {
+                break;
+            }
+        }
+    }
+    WZ = PC - 1;
     if (BC != 0) {
         PC -= 2;
-        WZ = PC + 1;
-        return 21;
+        return cycles;
     }
     else {
-        return 16;
+        return cycles - 5;
     }
 }
 
@@ -231,98 +354,153 @@ void
 z80::ldd() {
     ubyte val = mem.r8(HL);
     mem.w8(DE, val);
-    val += A;
-    ubyte f = F & (SF|ZF|CF);
-    if (val & 0x02) f |= YF;
-    if (val & 0x08) f |= XF;
     HL--;
     DE--;
     BC--;
-    if (BC) {
-        f |= VF;
-    }
-    F = f;
+    F = ldi_ldd_flags(val);
 }
 
 //------------------------------------------------------------------------------
 int
 z80::lddr() {
     ldd();
+    if (BC == 0) {
+        return 16;
+    }
+    int cycles = 21;
+    int first = 1;
+    if (bus && !irq_received && !clip_block_write(DE + 1, first, -1)) {
+        // run the following iterations in bulk, up to the next scheduled event
+        const int budget = bus->block_cycles(PC - 2);
+        ubyte val = 0;
+        while ((BC != 0) && (cycles < budget)) {
+            int n = block_count(budget - cycles, HL, DE, -1);
+            const bool last = clip_block_write(DE, n, -1);
+            const ubyte* src = mem.ptr(HL) + (HL & memory::page::mask) - (n - 1);
+            ubyte* dst = mem.ptr(DE) + (DE & memory::page::mask) - (n - 1);
+            if (mem.is_writable(DE) && ((dst >= src) || ((dst + n) <= src))) {
+                val = src[0];
+                memmove(dst, src, n);
+            }
+            else {
+                for (int i = 0; i < n; i++) {
+                    val = mem.r8(HL - i);
+                    mem.w8(DE - i, val);
+                }
+            }
+            HL -= n;
+            DE -= n;
+            BC -= n;
+            R = (R & 0x80) | ((R + 2*n) & 0x7F);
+            cycles += 21 * n;
+            F = ldi_ldd_flags(val);
+            if (last) {
+                break;
+            }
+        }
+    }
+    WZ = PC - 1;
     if (BC != 0) {
         PC -= 2;
-        WZ = PC + 1;
-        return 21;
+        return cycles;
     }
     else {
-        return 16;
+        return cycles - 5;
     }
 }
 
 //------------------------------------------------------------------------------
 void
 z80::cpi() {
-    int r = int(A) - int(mem.r8(HL));
-    ubyte f = NF | (F & CF) | YAKC_SZ(r);
-    if ((r & 0xF) > (A & 0xF)) {
-        f |= HF;
-        r--;
-    }
-    if (r & 0x02) f |= YF;
-    if (r & 0x08) f |= XF;
+    ubyte val = mem.r8(HL);
     WZ++;
     HL++;
     BC--;
-    if (BC) {
-        f |= VF;
-    }
-    F = f;
+    F = cpi_cpd_flags(val);
 }
 
 //------------------------------------------------------------------------------
 int
 z80::cpir() {
     cpi();
+    if ((BC == 0) || (F & ZF)) {
+        return 16;
+    }
+    int cycles = 21;
+    if (bus && !irq_received) {
+        // search in bulk up to the next scheduled event
+        const int budget = bus->block_cycles(PC - 2);
+        bool found = false;
+        while ((BC != 0) && !found && (cycles < budget)) {
+            int n = block_count(budget - cycles, HL, HL, +1);
+            const ubyte* src = mem.ptr(HL) + (HL & memory::page::mask);
+            const ubyte* hit = (const ubyte*) memchr(src, A, n);
+            if (hit) {
+                n = int(hit - src) + 1;
+                found = true;
+            }
+            HL += n;
+            BC -= n;
+            R = (R & 0x80) | ((R + 2*n) & 0x7F);
+            cycles += 21 * n;
+            F = cpi_cpd_flags(src[n - 1]);
+        }
+    }
     if ((BC != 0) && !(F & ZF)) {
         PC -= 2;
         WZ = PC + 1;
-        return 21;
+        return cycles;
     }
     else {
-        return 16;
+        WZ = PC;
+        return cycles - 5;
     }
 }
 
 //------------------------------------------------------------------------------
 void
 z80::cpd() {
-    int r = int(A) - int(mem.r8(HL));
-    ubyte f = NF | (F & CF) | YAKC_SZ(r);
-    if ((r & 0xF) > (A & 0xF)) {
-        f |= HF;
-        r--;
-    }
-    if (r & 0x02) f |= YF;
-    if (r & 0x08) f |= XF;
+    ubyte val = mem.r8(HL);
     WZ--;
     HL--;
     BC--;
-    if (BC) {
-        f |= VF;
-    }
-    F = f;
+    F = cpi_cpd_flags(val);
 }
 
 //------------------------------------------------------------------------------
 int
 z80::cpdr() {
     cpd();
+    if ((BC == 0) || (F & ZF)) {
+        return 16;
+    }
+    int cycles = 21;
+    if (bus && !irq_received) {
+        // search in bulk up to the next scheduled event
+        const int budget = bus->block_cycles(PC - 2);
+        bool found = false;
+        while ((BC != 0) && !found && (cycles < budget)) {
+            const int max_n = block_count(budget - cycles, HL, HL, -1);
+            const ubyte* src = mem.ptr(HL) + (HL & memory::page::mask);
+            int n = 0;
+            while ((n < max_n) && !found) {
+                found = (src[-n++] == A);
+            }
+            HL -= n;
+            BC -= n;
+            R = (R & 0x80) | ((R + 2*n) & 0x7F);
+            cycles += 21 * n;
+            F = cpi_cpd_flags(src[1 - n]);
+        }
+    }
     if ((BC != 0) && !(F & ZF)) {
         PC -= 2;
         WZ = PC + 1;
-        return 21;
+        return cycles;
     }
     else {
-        return 16;
+        WZ = PC - 2;
+        return cycles - 5;
     }
 }
 
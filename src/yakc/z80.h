@@ -7,6 +7,7 @@
 #include "yakc/core.h"
 #include "yakc/memory.h"
 #include "yakc/z80int.h"
+#include "yakc/opstats.h"
 
 namespace YAKC {
 
@@ -84,6 +85,17 @@ public:
     bool enable_interrupt;
     /// break on invalid opcode?
     bool break_on_invalid_opcode;
+    /// I/O trap callback, called before each IN and OUT when set
+    typedef void (*io_trap_func)(void* userdata, uword port, bool out);
+    io_trap_func io_trap;
+    void* io_trap_userdata;
+    /// interrupt trap callback, called after an interrupt was accepted with the
+    /// stack pointer (pointing to the pushed return address) and the handler address
+    typedef void (*irq_trap_func)(void* userdata, uword sp, uword addr);
+    irq_trap_func irq_trap;
+    void* irq_trap_userdata;
+    /// instruction statistics, counted by the decoder when set (see opstats)
+    opstats* stats;
 
     /// constructor
     z80();
@@ -154,6 +166,14 @@ public:
     uword adc16(uword acc, uword val);
     /// perform an 16-bit sbc, update flags and return result
     uword sbc16(uword acc, uword val);
+    /// compute flags after LDI/LDD from the transferred byte
+    ubyte ldi_ldd_flags(ubyte val) const;
+    /// compute flags after CPI/CPD from the compared byte
+    ubyte cpi_cpd_flags(ubyte val) const;
+    /// number of further block instruction iterations which start within ticks, and stay in the pages at addr0 and addr1
+    int block_count(int ticks, uword addr0, uword addr1, int dir) const;
+    /// clip a bulk write so that it ends at the block instruction's own opcode, return true if clipped
+    bool clip_block_write(uword dst, int& n, int dir) const;
     /// implement the LDI instruction
     void ldi();
     /// implement the LDIR instruction, return number of T-states
@@ -225,12 +245,16 @@ public:
     /// same as BIT, but take undocumented YF|XF flags from undocumented WZ register
     void ibit(ubyte val, ubyte mask);
 
-    /// fetch an opcode byte and increment R register
-    ubyte fetch_op();
+    /// fetch an opcode byte, increment R register and count it in the statistics
+    ubyte fetch_op(int table);
+    /// count a taken conditional jump, call or return in the statistics
+    void count_taken(int table, ubyte op);
     /// execute a single instruction, return number of cycles
     uint32_t step();
     /// top-level opcode decoder (generated)
     uint32_t do_op();
+    /// get the name of an instruction in an opcode table, nullptr for prefixes and invalid ops (generated)
+    static const char* op_name(int table, ubyte op);
 };
 
 #define YAKC_SZ(val) ((val&0xFF)?(val&SF):ZF)
@@ -496,9 +520,21 @@ z80::sbc16(uword acc, uword val) {
 
 //------------------------------------------------------------------------------
 inline ubyte
-z80::fetch_op() {
+z80::fetch_op(int table) {
     R = (R&0x80) | ((R+1)&0x7F);
-    return mem.r8(PC++);
+    const ubyte op = mem.x8(PC++);
+    if (stats) {
+        stats->record(table, op);
+    }
+    return op;
+}
+
+//------------------------------------------------------------------------------
+inline void
+z80::count_taken(int table, ubyte op) {
+    if (stats) {
+        stats->record_taken(table, op);
+    }
 }
 
 //------------------------------------------------------------------------------
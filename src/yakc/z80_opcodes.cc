@@ -1,9 +1,9 @@
-// #version:2#
+// #version:3#
 // machine generated, do not edit!
 #include "z80.h"
 namespace YAKC {
 uint32_t z80::do_op() {
-  switch (fetch_op()) {
+  switch (fetch_op(opstats::main_table)) {
     case 0x0: return 4; // NOP
     case 0x1: BC=mem.r16(PC); PC+=2; return 10; // LD BC,nn
     case 0x2: mem.w8(BC,A); Z=C+1; W=A; return 7; // LD (BC),A
@@ -20,7 +20,7 @@ uint32_t z80::do_op() {
     case 0xd: C=dec8(C); return 4; // DEC C
     case 0xe: C=mem.r8(PC++); return 7; // LD C,n
     case 0xf: rrca8(); return 4; // RRCA
-    case 0x10: if (--B>0) { WZ=PC=PC+mem.rs8(PC)+1; return 13; } else { PC++; return 8; } // DJNZ
+    case 0x10: if (--B>0) { count_taken(opstats::main_table,0x10); WZ=PC=PC+mem.rs8(PC)+1; return 13; } else { PC++; return 8; } // DJNZ
     case 0x11: DE=mem.r16(PC); PC+=2; return 10; // LD DE,nn
     case 0x12: mem.w8(DE,A); Z=E+1; W=A; return 7; // LD (DE),A
     case 0x13: DE++; return 6; // INC DE
@@ -36,7 +36,7 @@ uint32_t z80::do_op() {
     case 0x1d: E=dec8(E); return 4; // DEC E
     case 0x1e: E=mem.r8(PC++); return 7; // LD E,n
     case 0x1f: rra8(); return 4; // RRA
-    case 0x20: if (!(F&ZF)) { WZ=PC=PC+mem.rs8(PC)+1; return 12; } else { PC++; return 7; } // JR NZ,d
+    case 0x20: if (!(F&ZF)) { count_taken(opstats::main_table,0x20); WZ=PC=PC+mem.rs8(PC)+1; return 12; } else { PC++; return 7; } // JR NZ,d
     case 0x21: HL=mem.r16(PC); PC+=2; return 10; // LD HL,nn
     case 0x22: WZ=mem.r16(PC); mem.w16(WZ++,HL); PC+=2; return 16; // LD (nn),HL
     case 0x23: HL++; return 6; // INC HL
@@ -44,7 +44,7 @@ uint32_t z80::do_op() {
     case 0x25: H=dec8(H); return 4; // DEC H
     case 0x26: H=mem.r8(PC++); return 7; // LD H,n
     case 0x27: daa(); return 4; // DAA
-    case 0x28: if ((F&ZF)) { WZ=PC=PC+mem.rs8(PC)+1; return 12; } else { PC++; return 7; } // JR Z,d
+    case 0x28: if ((F&ZF)) { count_taken(opstats::main_table,0x28); WZ=PC=PC+mem.rs8(PC)+1; return 12; } else { PC++; return 7; } // JR Z,d
     case 0x29: HL=add16(HL,HL); return 11; // ADD HL,HL
     case 0x2a: WZ=mem.r16(PC); HL=mem.r16(WZ++); PC+=2; return 16; // LD HL,(nn)
     case 0x2b: HL--; return 6; // DEC HL
@@ -52,7 +52,7 @@ uint32_t z80::do_op() {
     case 0x2d: L=dec8(L); return 4; // DEC L
     case 0x2e: L=mem.r8(PC++); return 7; // LD L,n
     case 0x2f: A^=0xFF; F=(F&(SF|ZF|PF|CF))|HF|NF|(A&(YF|XF)); return 4; // CPL
-    case 0x30: if (!(F&CF)) { WZ=PC=PC+mem.rs8(PC)+1; return 12; } else { PC++; return 7; } // JR NC,d
+    case 0x30: if (!(F&CF)) { count_taken(opstats::main_table,0x30); WZ=PC=PC+mem.rs8(PC)+1; return 12; } else { PC++; return 7; } // JR NC,d
     case 0x31: SP=mem.r16(PC); PC+=2; return 10; // LD SP,nn
     case 0x32: WZ=mem.r16(PC); mem.w8(WZ++,A); W=A; PC+=2; return 13; // LD (nn),A
     case 0x33: SP++; return 6; // INC SP
@@ -60,7 +60,7 @@ uint32_t z80::do_op() {
     case 0x35: { uword a=HL; mem.w8(a,dec8(mem.r8(a))); } return 11; // DEC (HL)
     case 0x36: { uword a=HL; mem.w8(a,mem.r8(PC++)); } return 10; // LD (HL),n
     case 0x37: F=(F&(SF|ZF|YF|XF|PF))|CF|(A&(YF|XF)); return 4; // SCF
-    case 0x38: if ((F&CF)) { WZ=PC=PC+mem.rs8(PC)+1; return 12; } else { PC++; return 7; } // JR C,d
+    case 0x38: if ((F&CF)) { count_taken(opstats::main_table,0x38); WZ=PC=PC+mem.rs8(PC)+1; return 12; } else { PC++; return 7; } // JR C,d
     case 0x39: HL=add16(HL,SP); return 11; // ADD HL,SP
     case 0x3a: WZ=mem.r16(PC); A=mem.r8(WZ++); PC+=2; return 13; // LD A,(nn)
     case 0x3b: SP--; return 6; // DEC SP
@@ -196,19 +196,19 @@ uint32_t z80::do_op() {
     case 0xbd: cp8(L); return 4; // CP L
     case 0xbe: { uword a=HL; cp8(mem.r8(a)); } return 7; // CP (HL)
     case 0xbf: cp8(A); return 4; // CP A
-    case 0xc0: if (!(F&ZF)) { WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET NZ
+    case 0xc0: if (!(F&ZF)) { count_taken(opstats::main_table,0xc0); WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET NZ
     case 0xc1: BC=mem.r16(SP); SP+=2; return 10; // POP BC
-    case 0xc2: WZ=mem.r16(PC); if (!(F&ZF)) { PC=WZ; } else { PC+=2; }; return 10; // JP NZ,nn
+    case 0xc2: WZ=mem.r16(PC); if (!(F&ZF)) { count_taken(opstats::main_table,0xc2); PC=WZ; } else { PC+=2; }; return 10; // JP NZ,nn
     case 0xc3: WZ=PC=mem.r16(PC); return 10; // JP nn
-    case 0xc4: WZ=mem.r16(PC); PC+=2; if (!(F&ZF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL NZ,nn
+    case 0xc4: WZ=mem.r16(PC); PC+=2; if (!(F&ZF)) { count_taken(opstats::main_table,0xc4); SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL NZ,nn
     case 0xc5: SP-=2; mem.w16(SP,BC); return 11; // PUSH BC
     case 0xc6: add8(mem.r8(PC++)); return 7; // ADD n
     case 0xc7: rst(0x0); return 11; // RST 0x0
-    case 0xc8: if ((F&ZF)) { WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET Z
+    case 0xc8: if ((F&ZF)) { count_taken(opstats::main_table,0xc8); WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET Z
     case 0xc9: WZ=PC=mem.r16(SP); SP+=2; return 10; // RET
-    case 0xca: WZ=mem.r16(PC); if ((F&ZF)) { PC=WZ; } else { PC+=2; }; return 10; // JP Z,nn
+    case 0xca: WZ=mem.r16(PC); if ((F&ZF)) { count_taken(opstats::main_table,0xca); PC=WZ; } else { PC+=2; }; return 10; // JP Z,nn
     case 0xcb:
-      switch (fetch_op()) {
+      switch (fetch_op(opstats::cb_table)) {
         case 0x0: B=rlc8(B); return 8; // RLC B
         case 0x1: C=rlc8(C); return 8; // RLC C
         case 0x2: D=rlc8(D); return 8; // RLC D
@@ -468,25 +468,25 @@ uint32_t z80::do_op() {
         default: return invalid_opcode(2);
       }
       break;
-    case 0xcc: WZ=mem.r16(PC); PC+=2; if ((F&ZF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL Z,nn
+    case 0xcc: WZ=mem.r16(PC); PC+=2; if ((F&ZF)) { count_taken(opstats::main_table,0xcc); SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL Z,nn
     case 0xcd: SP-=2; mem.w16(SP,PC+2); WZ=PC=mem.r16(PC); return 17; // CALL nn
     case 0xce: adc8(mem.r8(PC++)); return 7; // ADC n
     case 0xcf: rst(0x8); return 11; // RST 0x8
-    case 0xd0: if (!(F&CF)) { WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET NC
+    case 0xd0: if (!(F&CF)) { count_taken(opstats::main_table,0xd0); WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET NC
     case 0xd1: DE=mem.r16(SP); SP+=2; return 10; // POP DE
-    case 0xd2: WZ=mem.r16(PC); if (!(F&CF)) { PC=WZ; } else { PC+=2; }; return 10; // JP NC,nn
+    case 0xd2: WZ=mem.r16(PC); if (!(F&CF)) { count_taken(opstats::main_table,0xd2); PC=WZ; } else { PC+=2; }; return 10; // JP NC,nn
     case 0xd3: out((A<<8)|mem.r8(PC++),A); return 11; // OUT (n),A
-    case 0xd4: WZ=mem.r16(PC); PC+=2; if (!(F&CF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL NC,nn
+    case 0xd4: WZ=mem.r16(PC); PC+=2; if (!(F&CF)) { count_taken(opstats::main_table,0xd4); SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL NC,nn
     case 0xd5: SP-=2; mem.w16(SP,DE); return 11; // PUSH DE
     case 0xd6: sub8(mem.r8(PC++)); return 7; // SUB n
     case 0xd7: rst(0x10); return 11; // RST 0x10
-    case 0xd8: if ((F&CF)) { WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET C
+    case 0xd8: if ((F&CF)) { count_taken(opstats::main_table,0xd8); WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET C
     case 0xd9: swap16(BC,BC_); swap16(DE,DE_); swap16(HL,HL_); swap16(WZ,WZ_); return 4; // EXX
-    case 0xda: WZ=mem.r16(PC); if ((F&CF)) { PC=WZ; } else { PC+=2; }; return 10; // JP C,nn
+    case 0xda: WZ=mem.r16(PC); if ((F&CF)) { count_taken(opstats::main_table,0xda); PC=WZ; } else { PC+=2; }; return 10; // JP C,nn
     case 0xdb: A=in((A<<8)|mem.r8(PC++)); return 11; // IN A,(n)
-    case 0xdc: WZ=mem.r16(PC); PC+=2; if ((F&CF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL C,nn
+    case 0xdc: WZ=mem.r16(PC); PC+=2; if ((F&CF)) { count_taken(opstats::main_table,0xdc); SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL C,nn
     case 0xdd:
-      switch (fetch_op()) {
+      switch (fetch_op(opstats::dd_table)) {
         case 0x0: return 8; // NOP
         case 0x1: BC=mem.r16(PC); PC+=2; return 14; // LD BC,nn
         case 0x2: mem.w8(BC,A); Z=C+1; W=A; return 11; // LD (BC),A
@@ -503,7 +503,7 @@ uint32_t z80::do_op() {
         case 0xd: C=dec8(C); return 8; // DEC C
         case 0xe: C=mem.r8(PC++); return 11; // LD C,n
         case 0xf: rrca8(); return 8; // RRCA
-        case 0x10: if (--B>0) { WZ=PC=PC+mem.rs8(PC)+1; return 17; } else { PC++; return 12; } // DJNZ
+        case 0x10: if (--B>0) { count_taken(opstats::dd_table,0x10); WZ=PC=PC+mem.rs8(PC)+1; return 17; } else { PC++; return 12; } // DJNZ
         case 0x11: DE=mem.r16(PC); PC+=2; return 14; // LD DE,nn
         case 0x12: mem.w8(DE,A); Z=E+1; W=A; return 11; // LD (DE),A
         case 0x13: DE++; return 10; // INC DE
@@ -519,7 +519,7 @@ uint32_t z80::do_op() {
         case 0x1d: E=dec8(E); return 8; // DEC E
         case 0x1e: E=mem.r8(PC++); return 11; // LD E,n
         case 0x1f: rra8(); return 8; // RRA
-        case 0x20: if (!(F&ZF)) { WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR NZ,d
+        case 0x20: if (!(F&ZF)) { count_taken(opstats::dd_table,0x20); WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR NZ,d
         case 0x21: IX=mem.r16(PC); PC+=2; return 14; // LD IX,nn
         case 0x22: WZ=mem.r16(PC); mem.w16(WZ++,IX); PC+=2; return 20; // LD (nn),IX
         case 0x23: IX++; return 10; // INC IX
@@ -527,7 +527,7 @@ uint32_t z80::do_op() {
         case 0x25: IXH=dec8(IXH); return 8; // DEC IXH
         case 0x26: IXH=mem.r8(PC++); return 11; // LD IXH,n
         case 0x27: daa(); return 8; // DAA
-        case 0x28: if ((F&ZF)) { WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR Z,d
+        case 0x28: if ((F&ZF)) { count_taken(opstats::dd_table,0x28); WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR Z,d
         case 0x29: IX=add16(IX,IX); return 15; // ADD IX,IX
         case 0x2a: WZ=mem.r16(PC); IX=mem.r16(WZ++); PC+=2; return 20; // LD IX,(nn)
         case 0x2b: IX--; return 10; // DEC IX
@@ -535,7 +535,7 @@ uint32_t z80::do_op() {
         case 0x2d: IXL=dec8(IXL); return 8; // DEC IXL
         case 0x2e: IXL=mem.r8(PC++); return 11; // LD IXL,n
         case 0x2f: A^=0xFF; F=(F&(SF|ZF|PF|CF))|HF|NF|(A&(YF|XF)); return 8; // CPL
-        case 0x30: if (!(F&CF)) { WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR NC,d
+        case 0x30: if (!(F&CF)) { count_taken(opstats::dd_table,0x30); WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR NC,d
         case 0x31: SP=mem.r16(PC); PC+=2; return 14; // LD SP,nn
         case 0x32: WZ=mem.r16(PC); mem.w8(WZ++,A); W=A; PC+=2; return 17; // LD (nn),A
         case 0x33: SP++; return 10; // INC SP
@@ -543,7 +543,7 @@ uint32_t z80::do_op() {
         case 0x35: { uword a=WZ=IX+mem.rs8(PC++); mem.w8(a,dec8(mem.r8(a))); } return 23; // DEC (IX+d)
         case 0x36: { uword a=WZ=IX+mem.rs8(PC++); mem.w8(a,mem.r8(PC++)); } return 19; // LD (IX+d),n
         case 0x37: F=(F&(SF|ZF|YF|XF|PF))|CF|(A&(YF|XF)); return 8; // SCF
-        case 0x38: if ((F&CF)) { WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR C,d
+        case 0x38: if ((F&CF)) { count_taken(opstats::dd_table,0x38); WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR C,d
         case 0x39: IX=add16(IX,SP); return 15; // ADD IX,SP
         case 0x3a: WZ=mem.r16(PC); A=mem.r8(WZ++); PC+=2; return 17; // LD A,(nn)
         case 0x3b: SP--; return 10; // DEC SP
@@ -679,20 +679,20 @@ uint32_t z80::do_op() {
         case 0xbd: cp8(IXL); return 8; // CP IXL
         case 0xbe: { uword a=WZ=IX+mem.rs8(PC++); cp8(mem.r8(a)); } return 19; // CP (IX+d)
         case 0xbf: cp8(A); return 8; // CP A
-        case 0xc0: if (!(F&ZF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET NZ
+        case 0xc0: if (!(F&ZF)) { count_taken(opstats::dd_table,0xc0); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET NZ
         case 0xc1: BC=mem.r16(SP); SP+=2; return 14; // POP BC
-        case 0xc2: WZ=mem.r16(PC); if (!(F&ZF)) { PC=WZ; } else { PC+=2; }; return 14; // JP NZ,nn
+        case 0xc2: WZ=mem.r16(PC); if (!(F&ZF)) { count_taken(opstats::dd_table,0xc2); PC=WZ; } else { PC+=2; }; return 14; // JP NZ,nn
         case 0xc3: WZ=PC=mem.r16(PC); return 14; // JP nn
-        case 0xc4: WZ=mem.r16(PC); PC+=2; if (!(F&ZF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL NZ,nn
+        case 0xc4: WZ=mem.r16(PC); PC+=2; if (!(F&ZF)) { count_taken(opstats::dd_table,0xc4); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL NZ,nn
         case 0xc5: SP-=2; mem.w16(SP,BC); return 15; // PUSH BC
         case 0xc6: add8(mem.r8(PC++)); return 11; // ADD n
         case 0xc7: rst(0x0); return 15; // RST 0x0
-        case 0xc8: if ((F&ZF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET Z
+        case 0xc8: if ((F&ZF)) { count_taken(opstats::dd_table,0xc8); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET Z
         case 0xc9: WZ=PC=mem.r16(SP); SP+=2; return 14; // RET
-        case 0xca: WZ=mem.r16(PC); if ((F&ZF)) { PC=WZ; } else { PC+=2; }; return 14; // JP Z,nn
+        case 0xca: WZ=mem.r16(PC); if ((F&ZF)) { count_taken(opstats::dd_table,0xca); PC=WZ; } else { PC+=2; }; return 14; // JP Z,nn
         case 0xcb:
           { const int d = mem.rs8(PC++);
-          switch (fetch_op()) {
+          switch (fetch_op(opstats::ddcb_table)) {
             case 0x0: { uword a=WZ=IX+d;; B=rlc8(mem.r8(a)); mem.w8(a,B); } return 23; // RLC (IX+d),B
             case 0x1: { uword a=WZ=IX+d;; C=rlc8(mem.r8(a)); mem.w8(a,C); } return 23; // RLC (IX+d),C
             case 0x2: { uword a=WZ=IX+d;; D=rlc8(mem.r8(a)); mem.w8(a,D); } return 23; // RLC (IX+d),D
@@ -953,53 +953,53 @@ uint32_t z80::do_op() {
           }
           break;
           }
-        case 0xcc: WZ=mem.r16(PC); PC+=2; if ((F&ZF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL Z,nn
+        case 0xcc: WZ=mem.r16(PC); PC+=2; if ((F&ZF)) { count_taken(opstats::dd_table,0xcc); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL Z,nn
         case 0xcd: SP-=2; mem.w16(SP,PC+2); WZ=PC=mem.r16(PC); return 21; // CALL nn
         case 0xce: adc8(mem.r8(PC++)); return 11; // ADC n
         case 0xcf: rst(0x8); return 15; // RST 0x8
-        case 0xd0: if (!(F&CF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET NC
+        case 0xd0: if (!(F&CF)) { count_taken(opstats::dd_table,0xd0); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET NC
         case 0xd1: DE=mem.r16(SP); SP+=2; return 14; // POP DE
-        case 0xd2: WZ=mem.r16(PC); if (!(F&CF)) { PC=WZ; } else { PC+=2; }; return 14; // JP NC,nn
+        case 0xd2: WZ=mem.r16(PC); if (!(F&CF)) { count_taken(opstats::dd_table,0xd2); PC=WZ; } else { PC+=2; }; return 14; // JP NC,nn
         case 0xd3: out((A<<8)|mem.r8(PC++),A); return 15; // OUT (n),A
-        case 0xd4: WZ=mem.r16(PC); PC+=2; if (!(F&CF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL NC,nn
+        case 0xd4: WZ=mem.r16(PC); PC+=2; if (!(F&CF)) { count_taken(opstats::dd_table,0xd4); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL NC,nn
         case 0xd5: SP-=2; mem.w16(SP,DE); return 15; // PUSH DE
         case 0xd6: sub8(mem.r8(PC++)); return 11; // SUB n
         case 0xd7: rst(0x10); return 15; // RST 0x10
-        case 0xd8: if ((F&CF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET C
+        case 0xd8: if ((F&CF)) { count_taken(opstats::dd_table,0xd8); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET C
         case 0xd9: swap16(BC,BC_); swap16(DE,DE_); swap16(HL,HL_); swap16(WZ,WZ_); return 8; // EXX
-        case 0xda: WZ=mem.r16(PC); if ((F&CF)) { PC=WZ; } else { PC+=2; }; return 14; // JP C,nn
+        case 0xda: WZ=mem.r16(PC); if ((F&CF)) { count_taken(opstats::dd_table,0xda); PC=WZ; } else { PC+=2; }; return 14; // JP C,nn
         case 0xdb: A=in((A<<8)|mem.r8(PC++)); return 15; // IN A,(n)
-        case 0xdc: WZ=mem.r16(PC); PC+=2; if ((F&CF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL C,nn
+        case 0xdc: WZ=mem.r16(PC); PC+=2; if ((F&CF)) { count_taken(opstats::dd_table,0xdc); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL C,nn
         case 0xde: sbc8(mem.r8(PC++)); return 11; // SBC n
         case 0xdf: rst(0x18); return 15; // RST 0x18
-        case 0xe0: if (!(F&PF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET PO
+        case 0xe0: if (!(F&PF)) { count_taken(opstats::dd_table,0xe0); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET PO
         case 0xe1: IX=mem.r16(SP); SP+=2; return 14; // POP IX
-        case 0xe2: WZ=mem.r16(PC); if (!(F&PF)) { PC=WZ; } else { PC+=2; }; return 14; // JP PO,nn
+        case 0xe2: WZ=mem.r16(PC); if (!(F&PF)) { count_taken(opstats::dd_table,0xe2); PC=WZ; } else { PC+=2; }; return 14; // JP PO,nn
         case 0xe3: {uword swp=mem.r16(SP); mem.w16(SP,IX); IX=WZ=swp;} return 23; // EX (SP),IX
-        case 0xe4: WZ=mem.r16(PC); PC+=2; if (!(F&PF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL PO,nn
+        case 0xe4: WZ=mem.r16(PC); PC+=2; if (!(F&PF)) { count_taken(opstats::dd_table,0xe4); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL PO,nn
         case 0xe5: SP-=2; mem.w16(SP,IX); return 15; // PUSH IX
         case 0xe6: and8(mem.r8(PC++)); return 11; // AND n
         case 0xe7: rst(0x20); return 15; // RST 0x20
-        case 0xe8: if ((F&PF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET PE
+        case 0xe8: if ((F&PF)) { count_taken(opstats::dd_table,0xe8); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET PE
         case 0xe9: PC=IX; return 8; // JP IX
-        case 0xea: WZ=mem.r16(PC); if ((F&PF)) { PC=WZ; } else { PC+=2; }; return 14; // JP PE,nn
+        case 0xea: WZ=mem.r16(PC); if ((F&PF)) { count_taken(opstats::dd_table,0xea); PC=WZ; } else { PC+=2; }; return 14; // JP PE,nn
         case 0xeb: swap16(DE,HL); return 8; // EX DE,HL
-        case 0xec: WZ=mem.r16(PC); PC+=2; if ((F&PF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL PE,nn
+        case 0xec: WZ=mem.r16(PC); PC+=2; if ((F&PF)) { count_taken(opstats::dd_table,0xec); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL PE,nn
         case 0xee: xor8(mem.r8(PC++)); return 11; // XOR n
         case 0xef: rst(0x28); return 15; // RST 0x28
-        case 0xf0: if (!(F&SF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET P
+        case 0xf0: if (!(F&SF)) { count_taken(opstats::dd_table,0xf0); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET P
         case 0xf1: AF=mem.r16(SP); SP+=2; return 14; // POP AF
-        case 0xf2: WZ=mem.r16(PC); if (!(F&SF)) { PC=WZ; } else { PC+=2; }; return 14; // JP P,nn
+        case 0xf2: WZ=mem.r16(PC); if (!(F&SF)) { count_taken(opstats::dd_table,0xf2); PC=WZ; } else { PC+=2; }; return 14; // JP P,nn
         case 0xf3: di(); return 8; // DI
-        case 0xf4: WZ=mem.r16(PC); PC+=2; if (!(F&SF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL P,nn
+        case 0xf4: WZ=mem.r16(PC); PC+=2; if (!(F&SF)) { count_taken(opstats::dd_table,0xf4); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL P,nn
         case 0xf5: SP-=2; mem.w16(SP,AF); return 15; // PUSH AF
         case 0xf6: or8(mem.r8(PC++)); return 11; // OR n
         case 0xf7: rst(0x30); return 15; // RST 0x30
-        case 0xf8: if ((F&SF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET M
+        case 0xf8: if ((F&SF)) { count_taken(opstats::dd_table,0xf8); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET M
         case 0xf9: SP=IX; return 10; // LD SP,IX
-        case 0xfa: WZ=mem.r16(PC); if ((F&SF)) { PC=WZ; } else { PC+=2; }; return 14; // JP M,nn
+        case 0xfa: WZ=mem.r16(PC); if ((F&SF)) { count_taken(opstats::dd_table,0xfa); PC=WZ; } else { PC+=2; }; return 14; // JP M,nn
         case 0xfb: ei(); return 8; // EI
-        case 0xfc: WZ=mem.r16(PC); PC+=2; if ((F&SF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL M,nn
+        case 0xfc: WZ=mem.r16(PC); PC+=2; if ((F&SF)) { count_taken(opstats::dd_table,0xfc); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL M,nn
         case 0xfe: cp8(mem.r8(PC++)); return 11; // CP n
         case 0xff: rst(0x38); return 15; // RST 0x38
         default: return invalid_opcode(2);
@@ -1007,21 +1007,21 @@ uint32_t z80::do_op() {
       break;
     case 0xde: sbc8(mem.r8(PC++)); return 7; // SBC n
     case 0xdf: rst(0x18); return 11; // RST 0x18
-    case 0xe0: if (!(F&PF)) { WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET PO
+    case 0xe0: if (!(F&PF)) { count_taken(opstats::main_table,0xe0); WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET PO
     case 0xe1: HL=mem.r16(SP); SP+=2; return 10; // POP HL
-    case 0xe2: WZ=mem.r16(PC); if (!(F&PF)) { PC=WZ; } else { PC+=2; }; return 10; // JP PO,nn
+    case 0xe2: WZ=mem.r16(PC); if (!(F&PF)) { count_taken(opstats::main_table,0xe2); PC=WZ; } else { PC+=2; }; return 10; // JP PO,nn
     case 0xe3: {uword swp=mem.r16(SP); mem.w16(SP,HL); HL=WZ=swp;} return 19; // EX (SP),HL
-    case 0xe4: WZ=mem.r16(PC); PC+=2; if (!(F&PF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL PO,nn
+    case 0xe4: WZ=mem.r16(PC); PC+=2; if (!(F&PF)) { count_taken(opstats::main_table,0xe4); SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL PO,nn
     case 0xe5: SP-=2; mem.w16(SP,HL); return 11; // PUSH HL
     case 0xe6: and8(mem.r8(PC++)); return 7; // AND n
     case 0xe7: rst(0x20); return 11; // RST 0x20
-    case 0xe8: if ((F&PF)) { WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET PE
+    case 0xe8: if ((F&PF)) { count_taken(opstats::main_table,0xe8); WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET PE
     case 0xe9: PC=HL; return 4; // JP HL
-    case 0xea: WZ=mem.r16(PC); if ((F&PF)) { PC=WZ; } else { PC+=2; }; return 10; // JP PE,nn
+    case 0xea: WZ=mem.r16(PC); if ((F&PF)) { count_taken(opstats::main_table,0xea); PC=WZ; } else { PC+=2; }; return 10; // JP PE,nn
     case 0xeb: swap16(DE,HL); return 4; // EX DE,HL
-    case 0xec: WZ=mem.r16(PC); PC+=2; if ((F&PF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL PE,nn
+    case 0xec: WZ=mem.r16(PC); PC+=2; if ((F&PF)) { count_taken(opstats::main_table,0xec); SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL PE,nn
     case 0xed:
-      switch (fetch_op()) {
+      switch (fetch_op(opstats::ed_table)) {
         case 0x40: B=in(BC); F=szp[B]|(F&CF); return 12; // IN B,(C)
         case 0x41: out(BC,B); return 12; // OUT (C),B
         case 0x42: HL=sbc16(HL,BC); return 15; // SBC HL,BC
@@ -1066,7 +1066,7 @@ uint32_t z80::do_op() {
         case 0x6e: IM=0; return 8; // IM 0
         case 0x6f: rld(); return 18; // RLD
         case 0x70: F=szp[in(BC)]|(F&CF); return 12; // IN (C)
-        case 0x71: out(BC,0); return 12; // None
+        case 0x71: out(BC,0); return 12; // OUT (C)
         case 0x72: HL=sbc16(HL,SP); return 15; // SBC HL,SP
         case 0x73: WZ=mem.r16(PC); mem.w16(WZ++,SP); PC+=2; return 20; // LD (nn),SP
         case 0x74: neg8(); return 8; // NEG
@@ -1100,21 +1100,21 @@ uint32_t z80::do_op() {
       break;
     case 0xee: xor8(mem.r8(PC++)); return 7; // XOR n
     case 0xef: rst(0x28); return 11; // RST 0x28
-    case 0xf0: if (!(F&SF)) { WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET P
+    case 0xf0: if (!(F&SF)) { count_taken(opstats::main_table,0xf0); WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET P
     case 0xf1: AF=mem.r16(SP); SP+=2; return 10; // POP AF
-    case 0xf2: WZ=mem.r16(PC); if (!(F&SF)) { PC=WZ; } else { PC+=2; }; return 10; // JP P,nn
+    case 0xf2: WZ=mem.r16(PC); if (!(F&SF)) { count_taken(opstats::main_table,0xf2); PC=WZ; } else { PC+=2; }; return 10; // JP P,nn
     case 0xf3: di(); return 4; // DI
-    case 0xf4: WZ=mem.r16(PC); PC+=2; if (!(F&SF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL P,nn
+    case 0xf4: WZ=mem.r16(PC); PC+=2; if (!(F&SF)) { count_taken(opstats::main_table,0xf4); SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL P,nn
     case 0xf5: SP-=2; mem.w16(SP,AF); return 11; // PUSH AF
     case 0xf6: or8(mem.r8(PC++)); return 7; // OR n
     case 0xf7: rst(0x30); return 11; // RST 0x30
-    case 0xf8: if ((F&SF)) { WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET M
+    case 0xf8: if ((F&SF)) { count_taken(opstats::main_table,0xf8); WZ=PC=mem.r16(SP); SP+=2; return 11; } else return 5; // RET M
     case 0xf9: SP=HL; return 6; // LD SP,HL
-    case 0xfa: WZ=mem.r16(PC); if ((F&SF)) { PC=WZ; } else { PC+=2; }; return 10; // JP M,nn
+    case 0xfa: WZ=mem.r16(PC); if ((F&SF)) { count_taken(opstats::main_table,0xfa); PC=WZ; } else { PC+=2; }; return 10; // JP M,nn
     case 0xfb: ei(); return 4; // EI
-    case 0xfc: WZ=mem.r16(PC); PC+=2; if ((F&SF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL M,nn
+    case 0xfc: WZ=mem.r16(PC); PC+=2; if ((F&SF)) { count_taken(opstats::main_table,0xfc); SP-=2; mem.w16(SP,PC); PC=WZ; return 17; } else { return 10; } // CALL M,nn
     case 0xfd:
-      switch (fetch_op()) {
+      switch (fetch_op(opstats::fd_table)) {
         case 0x0: return 8; // NOP
         case 0x1: BC=mem.r16(PC); PC+=2; return 14; // LD BC,nn
         case 0x2: mem.w8(BC,A); Z=C+1; W=A; return 11; // LD (BC),A
@@ -1131,7 +1131,7 @@ uint32_t z80::do_op() {
         case 0xd: C=dec8(C); return 8; // DEC C
         case 0xe: C=mem.r8(PC++); return 11; // LD C,n
         case 0xf: rrca8(); return 8; // RRCA
-        case 0x10: if (--B>0) { WZ=PC=PC+mem.rs8(PC)+1; return 17; } else { PC++; return 12; } // DJNZ
+        case 0x10: if (--B>0) { count_taken(opstats::fd_table,0x10); WZ=PC=PC+mem.rs8(PC)+1; return 17; } else { PC++; return 12; } // DJNZ
         case 0x11: DE=mem.r16(PC); PC+=2; return 14; // LD DE,nn
         case 0x12: mem.w8(DE,A); Z=E+1; W=A; return 11; // LD (DE),A
         case 0x13: DE++; return 10; // INC DE
@@ -1147,7 +1147,7 @@ uint32_t z80::do_op() {
         case 0x1d: E=dec8(E); return 8; // DEC E
         case 0x1e: E=mem.r8(PC++); return 11; // LD E,n
         case 0x1f: rra8(); return 8; // RRA
-        case 0x20: if (!(F&ZF)) { WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR NZ,d
+        case 0x20: if (!(F&ZF)) { count_taken(opstats::fd_table,0x20); WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR NZ,d
         case 0x21: IY=mem.r16(PC); PC+=2; return 14; // LD IY,nn
         case 0x22: WZ=mem.r16(PC); mem.w16(WZ++,IY); PC+=2; return 20; // LD (nn),IY
         case 0x23: IY++; return 10; // INC IY
@@ -1155,7 +1155,7 @@ uint32_t z80::do_op() {
         case 0x25: IYH=dec8(IYH); return 8; // DEC IYH
         case 0x26: IYH=mem.r8(PC++); return 11; // LD IYH,n
         case 0x27: daa(); return 8; // DAA
-        case 0x28: if ((F&ZF)) { WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR Z,d
+        case 0x28: if ((F&ZF)) { count_taken(opstats::fd_table,0x28); WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR Z,d
         case 0x29: IY=add16(IY,IY); return 15; // ADD IY,IY
         case 0x2a: WZ=mem.r16(PC); IY=mem.r16(WZ++); PC+=2; return 20; // LD IY,(nn)
         case 0x2b: IY--; return 10; // DEC IY
@@ -1163,7 +1163,7 @@ uint32_t z80::do_op() {
         case 0x2d: IYL=dec8(IYL); return 8; // DEC IYL
         case 0x2e: IYL=mem.r8(PC++); return 11; // LD IYL,n
         case 0x2f: A^=0xFF; F=(F&(SF|ZF|PF|CF))|HF|NF|(A&(YF|XF)); return 8; // CPL
-        case 0x30: if (!(F&CF)) { WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR NC,d
+        case 0x30: if (!(F&CF)) { count_taken(opstats::fd_table,0x30); WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR NC,d
         case 0x31: SP=mem.r16(PC); PC+=2; return 14; // LD SP,nn
         case 0x32: WZ=mem.r16(PC); mem.w8(WZ++,A); W=A; PC+=2; return 17; // LD (nn),A
         case 0x33: SP++; return 10; // INC SP
@@ -1171,7 +1171,7 @@ uint32_t z80::do_op() {
         case 0x35: { uword a=WZ=IY+mem.rs8(PC++); mem.w8(a,dec8(mem.r8(a))); } return 23; // DEC (IY+d)
         case 0x36: { uword a=WZ=IY+mem.rs8(PC++); mem.w8(a,mem.r8(PC++)); } return 19; // LD (IY+d),n
         case 0x37: F=(F&(SF|ZF|YF|XF|PF))|CF|(A&(YF|XF)); return 8; // SCF
-        case 0x38: if ((F&CF)) { WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR C,d
+        case 0x38: if ((F&CF)) { count_taken(opstats::fd_table,0x38); WZ=PC=PC+mem.rs8(PC)+1; return 16; } else { PC++; return 11; } // JR C,d
         case 0x39: IY=add16(IY,SP); return 15; // ADD IY,SP
         case 0x3a: WZ=mem.r16(PC); A=mem.r8(WZ++); PC+=2; return 17; // LD A,(nn)
         case 0x3b: SP--; return 10; // DEC SP
@@ -1307,20 +1307,20 @@ uint32_t z80::do_op() {
         case 0xbd: cp8(IYL); return 8; // CP IYL
         case 0xbe: { uword a=WZ=IY+mem.rs8(PC++); cp8(mem.r8(a)); } return 19; // CP (IY+d)
         case 0xbf: cp8(A); return 8; // CP A
-        case 0xc0: if (!(F&ZF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET NZ
+        case 0xc0: if (!(F&ZF)) { count_taken(opstats::fd_table,0xc0); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET NZ
         case 0xc1: BC=mem.r16(SP); SP+=2; return 14; // POP BC
-        case 0xc2: WZ=mem.r16(PC); if (!(F&ZF)) { PC=WZ; } else { PC+=2; }; return 14; // JP NZ,nn
+        case 0xc2: WZ=mem.r16(PC); if (!(F&ZF)) { count_taken(opstats::fd_table,0xc2); PC=WZ; } else { PC+=2; }; return 14; // JP NZ,nn
         case 0xc3: WZ=PC=mem.r16(PC); return 14; // JP nn
-        case 0xc4: WZ=mem.r16(PC); PC+=2; if (!(F&ZF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL NZ,nn
+        case 0xc4: WZ=mem.r16(PC); PC+=2; if (!(F&ZF)) { count_taken(opstats::fd_table,0xc4); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL NZ,nn
         case 0xc5: SP-=2; mem.w16(SP,BC); return 15; // PUSH BC
         case 0xc6: add8(mem.r8(PC++)); return 11; // ADD n
         case 0xc7: rst(0x0); return 15; // RST 0x0
-        case 0xc8: if ((F&ZF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET Z
+        case 0xc8: if ((F&ZF)) { count_taken(opstats::fd_table,0xc8); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET Z
         case 0xc9: WZ=PC=mem.r16(SP); SP+=2; return 14; // RET
-        case 0xca: WZ=mem.r16(PC); if ((F&ZF)) { PC=WZ; } else { PC+=2; }; return 14; // JP Z,nn
+        case 0xca: WZ=mem.r16(PC); if ((F&ZF)) { count_taken(opstats::fd_table,0xca); PC=WZ; } else { PC+=2; }; return 14; // JP Z,nn
         case 0xcb:
           { const int d = mem.rs8(PC++);
-          switch (fetch_op()) {
+          switch (fetch_op(opstats::fdcb_table)) {
             case 0x0: { uword a=WZ=IY+d;; B=rlc8(mem.r8(a)); mem.w8(a,B); } return 23; // RLC (IY+d),B
             case 0x1: { uword a=WZ=IY+d;; C=rlc8(mem.r8(a)); mem.w8(a,C); } return 23; // RLC (IY+d),C
             case 0x2: { uword a=WZ=IY+d;; D=rlc8(mem.r8(a)); mem.w8(a,D); } return 23; // RLC (IY+d),D
@@ -1581,53 +1581,53 @@ uint32_t z80::do_op() {
           }
           break;
           }
-        case 0xcc: WZ=mem.r16(PC); PC+=2; if ((F&ZF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL Z,nn
+        case 0xcc: WZ=mem.r16(PC); PC+=2; if ((F&ZF)) { count_taken(opstats::fd_table,0xcc); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL Z,nn
         case 0xcd: SP-=2; mem.w16(SP,PC+2); WZ=PC=mem.r16(PC); return 21; // CALL nn
         case 0xce: adc8(mem.r8(PC++)); return 11; // ADC n
         case 0xcf: rst(0x8); return 15; // RST 0x8
-        case 0xd0: if (!(F&CF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET NC
+        case 0xd0: if (!(F&CF)) { count_taken(opstats::fd_table,0xd0); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET NC
         case 0xd1: DE=mem.r16(SP); SP+=2; return 14; // POP DE
-        case 0xd2: WZ=mem.r16(PC); if (!(F&CF)) { PC=WZ; } else { PC+=2; }; return 14; // JP NC,nn
+        case 0xd2: WZ=mem.r16(PC); if (!(F&CF)) { count_taken(opstats::fd_table,0xd2); PC=WZ; } else { PC+=2; }; return 14; // JP NC,nn
         case 0xd3: out((A<<8)|mem.r8(PC++),A); return 15; // OUT (n),A
-        case 0xd4: WZ=mem.r16(PC); PC+=2; if (!(F&CF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL NC,nn
+        case 0xd4: WZ=mem.r16(PC); PC+=2; if (!(F&CF)) { count_taken(opstats::fd_table,0xd4); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL NC,nn
         case 0xd5: SP-=2; mem.w16(SP,DE); return 15; // PUSH DE
         case 0xd6: sub8(mem.r8(PC++)); return 11; // SUB n
         case 0xd7: rst(0x10); return 15; // RST 0x10
-        case 0xd8: if ((F&CF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET C
+        case 0xd8: if ((F&CF)) { count_taken(opstats::fd_table,0xd8); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET C
         case 0xd9: swap16(BC,BC_); swap16(DE,DE_); swap16(HL,HL_); swap16(WZ,WZ_); return 8; // EXX
-        case 0xda: WZ=mem.r16(PC); if ((F&CF)) { PC=WZ; } else { PC+=2; }; return 14; // JP C,nn
+        case 0xda: WZ=mem.r16(PC); if ((F&CF)) { count_taken(opstats::fd_table,0xda); PC=WZ; } else { PC+=2; }; return 14; // JP C,nn
         case 0xdb: A=in((A<<8)|mem.r8(PC++)); return 15; // IN A,(n)
-        case 0xdc: WZ=mem.r16(PC); PC+=2; if ((F&CF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL C,nn
+        case 0xdc: WZ=mem.r16(PC); PC+=2; if ((F&CF)) { count_taken(opstats::fd_table,0xdc); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL C,nn
         case 0xde: sbc8(mem.r8(PC++)); return 11; // SBC n
         case 0xdf: rst(0x18); return 15; // RST 0x18
-        case 0xe0: if (!(F&PF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET PO
+        case 0xe0: if (!(F&PF)) { count_taken(opstats::fd_table,0xe0); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET PO
         case 0xe1: IY=mem.r16(SP); SP+=2; return 14; // POP IY
-        case 0xe2: WZ=mem.r16(PC); if (!(F&PF)) { PC=WZ; } else { PC+=2; }; return 14; // JP PO,nn
+        case 0xe2: WZ=mem.r16(PC); if (!(F&PF)) { count_taken(opstats::fd_table,0xe2); PC=WZ; } else { PC+=2; }; return 14; // JP PO,nn
         case 0xe3: {uword swp=mem.r16(SP); mem.w16(SP,IY); IY=WZ=swp;} return 23; // EX (SP),IY
-        case 0xe4: WZ=mem.r16(PC); PC+=2; if (!(F&PF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL PO,nn
+        case 0xe4: WZ=mem.r16(PC); PC+=2; if (!(F&PF)) { count_taken(opstats::fd_table,0xe4); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL PO,nn
         case 0xe5: SP-=2; mem.w16(SP,IY); return 15; // PUSH IY
         case 0xe6: and8(mem.r8(PC++)); return 11; // AND n
         case 0xe7: rst(0x20); return 15; // RST 0x20
-        case 0xe8: if ((F&PF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET PE
+        case 0xe8: if ((F&PF)) { count_taken(opstats::fd_table,0xe8); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET PE
         case 0xe9: PC=IY; return 8; // JP IY
-        case 0xea: WZ=mem.r16(PC); if ((F&PF)) { PC=WZ; } else { PC+=2; }; return 14; // JP PE,nn
+        case 0xea: WZ=mem.r16(PC); if ((F&PF)) { count_taken(opstats::fd_table,0xea); PC=WZ; } else { PC+=2; }; return 14; // JP PE,nn
         case 0xeb: swap16(DE,HL); return 8; // EX DE,HL
-        case 0xec: WZ=mem.r16(PC); PC+=2; if ((F&PF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL PE,nn
+        case 0xec: WZ=mem.r16(PC); PC+=2; if ((F&PF)) { count_taken(opstats::fd_table,0xec); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL PE,nn
         case 0xee: xor8(mem.r8(PC++)); return 11; // XOR n
         case 0xef: rst(0x28); return 15; // RST 0x28
-        case 0xf0: if (!(F&SF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET P
+        case 0xf0: if (!(F&SF)) { count_taken(opstats::fd_table,0xf0); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET P
         case 0xf1: AF=mem.r16(SP); SP+=2; return 14; // POP AF
-        case 0xf2: WZ=mem.r16(PC); if (!(F&SF)) { PC=WZ; } else { PC+=2; }; return 14; // JP P,nn
+        case 0xf2: WZ=mem.r16(PC); if (!(F&SF)) { count_taken(opstats::fd_table,0xf2); PC=WZ; } else { PC+=2; }; return 14; // JP P,nn
         case 0xf3: di(); return 8; // DI
-        case 0xf4: WZ=mem.r16(PC); PC+=2; if (!(F&SF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL P,nn
+        case 0xf4: WZ=mem.r16(PC); PC+=2; if (!(F&SF)) { count_taken(opstats::fd_table,0xf4); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL P,nn
         case 0xf5: SP-=2; mem.w16(SP,AF); return 15; // PUSH AF
         case 0xf6: or8(mem.r8(PC++)); return 11; // OR n
         case 0xf7: rst(0x30); return 15; // RST 0x30
-        case 0xf8: if ((F&SF)) { WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET M
+        case 0xf8: if ((F&SF)) { count_taken(opstats::fd_table,0xf8); WZ=PC=mem.r16(SP); SP+=2; return 15; } else return 9; // RET M
         case 0xf9: SP=IY; return 10; // LD SP,IY
-        case 0xfa: WZ=mem.r16(PC); if ((F&SF)) { PC=WZ; } else { PC+=2; }; return 14; // JP M,nn
+        case 0xfa: WZ=mem.r16(PC); if ((F&SF)) { count_taken(opstats::fd_table,0xfa); PC=WZ; } else { PC+=2; }; return 14; // JP M,nn
         case 0xfb: ei(); return 8; // EI
-        case 0xfc: WZ=mem.r16(PC); PC+=2; if ((F&SF)) { SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL M,nn
+        case 0xfc: WZ=mem.r16(PC); PC+=2; if ((F&SF)) { count_taken(opstats::fd_table,0xfc); SP-=2; mem.w16(SP,PC); PC=WZ; return 21; } else { return 14; } // CALL M,nn
         case 0xfe: cp8(mem.r8(PC++)); return 11; // CP n
         case 0xff: rst(0x38); return 15; // RST 0x38
         default: return invalid_opcode(2);
@@ -1638,4 +1638,248 @@ uint32_t z80::do_op() {
     default: return invalid_opcode(1);
   }
 }
+const char* z80::op_name(int table, ubyte op) {
+  static const char* names[opstats::num_tables][256] = {
+    { // main_table
+      "NOP", "LD BC,nn", "LD (BC),A", "INC BC", "INC B", "DEC B", "LD B,n", "RLCA",
+      "EX AF,AF'", "ADD HL,BC", "LD A,(BC)", "DEC BC", "INC C", "DEC C", "LD C,n", "RRCA",
+      "DJNZ", "LD DE,nn", "LD (DE),A", "INC DE", "INC D", "DEC D", "LD D,n", "RLA",
+      "JR d", "ADD HL,DE", "LD A,(DE)", "DEC DE", "INC E", "DEC E", "LD E,n", "RRA",
+      "JR NZ,d", "LD HL,nn", "LD (nn),HL", "INC HL", "INC H", "DEC H", "LD H,n", "DAA",
+      "JR Z,d", "ADD HL,HL", "LD HL,(nn)", "DEC HL", "INC L", "DEC L", "LD L,n", "CPL",
+      "JR NC,d", "LD SP,nn", "LD (nn),A", "INC SP", "INC (HL)", "DEC (HL)", "LD (HL),n", "SCF",
+      "JR C,d", "ADD HL,SP", "LD A,(nn)", "DEC SP", "INC A", "DEC A", "LD A,n", "CCF",
+      "LD B,B", "LD B,C", "LD B,D", "LD B,E", "LD B,H", "LD B,L", "LD B,(HL)", "LD B,A",
+      "LD C,B", "LD C,C", "LD C,D", "LD C,E", "LD C,H", "LD C,L", "LD C,(HL)", "LD C,A",
+      "LD D,B", "LD D,C", "LD D,D", "LD D,E", "LD D,H", "LD D,L", "LD D,(HL)", "LD D,A",
+      "LD E,B", "LD E,C", "LD E,D", "LD E,E", "LD E,H", "LD E,L", "LD E,(HL)", "LD E,A",
+      "LD H,B", "LD H,C", "LD H,D", "LD H,E", "LD H,H", "LD H,L", "LD H,(HL)", "LD H,A",
+      "LD L,B", "LD L,C", "LD L,D", "LD L,E", "LD L,H", "LD L,L", "LD L,(HL)", "LD L,A",
+      "LD (HL),B", "LD (HL),C", "LD (HL),D", "LD (HL),E", "LD (HL),H", "LD (HL),L", "HALT", "LD (HL),A",
+      "LD A,B", "LD A,C", "LD A,D", "LD A,E", "LD A,H", "LD A,L", "LD A,(HL)", "LD A,A",
+      "ADD B", "ADD C", "ADD D", "ADD E", "ADD H", "ADD L", "ADD (HL)", "ADD A",
+      "ADC B", "ADC C", "ADC D", "ADC E", "ADC H", "ADC L", "ADC (HL)", "ADC A",
+      "SUB B", "SUB C", "SUB D", "SUB E", "SUB H", "SUB L", "SUB (HL)", "SUB A",
+      "SBC B", "SBC C", "SBC D", "SBC E", "SBC H", "SBC L", "SBC (HL)", "SBC A",
+      "AND B", "AND C", "AND D", "AND E", "AND H", "AND L", "AND (HL)", "AND A",
+      "XOR B", "XOR C", "XOR D", "XOR E", "XOR H", "XOR L", "XOR (HL)", "XOR A",
+      "OR B", "OR C", "OR D", "OR E", "OR H", "OR L", "OR (HL)", "OR A",
+      "CP B", "CP C", "CP D", "CP E", "CP H", "CP L", "CP (HL)", "CP A",
+      "RET NZ", "POP BC", "JP NZ,nn", "JP nn", "CALL NZ,nn", "PUSH BC", "ADD n", "RST 0x0",
+      "RET Z", "RET", "JP Z,nn", nullptr, "CALL Z,nn", "CALL nn", "ADC n", "RST 0x8",
+      "RET NC", "POP DE", "JP NC,nn", "OUT (n),A", "CALL NC,nn", "PUSH DE", "SUB n", "RST 0x10",
+      "RET C", "EXX", "JP C,nn", "IN A,(n)", "CALL C,nn", nullptr, "SBC n", "RST 0x18",
+      "RET PO", "POP HL", "JP PO,nn", "EX (SP),HL", "CALL PO,nn", "PUSH HL", "AND n", "RST 0x20",
+      "RET PE", "JP HL", "JP PE,nn", "EX DE,HL", "CALL PE,nn", nullptr, "XOR n", "RST 0x28",
+      "RET P", "POP AF", "JP P,nn", "DI", "CALL P,nn", "PUSH AF", "OR n", "RST 0x30",
+      "RET M", "LD SP,HL", "JP M,nn", "EI", "CALL M,nn", nullptr, "CP n", "RST 0x38",
+    },
+    { // cb_table
+      "RLC B", "RLC C", "RLC D", "RLC E", "RLC H", "RLC L", "RLC (HL)", "RLC A",
+      "RRC B", "RRC C", "RRC D", "RRC E", "RRC H", "RRC L", "RRC (HL)", "RRC A",
+      "RL B", "RL C", "RL D", "RL E", "RL H", "RL L", "RL (HL)", "RL A",
+      "RR B", "RR C", "RR D", "RR E", "RR H", "RR L", "RR (HL)", "RR A",
+      "SLA B", "SLA C", "SLA D", "SLA E", "SLA H", "SLA L", "SLA (HL)", "SLA A",
+      "SRA B", "SRA C", "SRA D", "SRA E", "SRA H", "SRA L", "SRA (HL)", "SRA A",
+      "SLL B", "SLL C", "SLL D", "SLL E", "SLL H", "SLL L", "SLL (HL)", "SLL A",
+      "SRL B", "SRL C", "SRL D", "SRL E", "SRL H", "SRL L", "SRL (HL)", "SRL A",
+      "BIT 0,B", "BIT 0,C", "BIT 0,D", "BIT 0,E", "BIT 0,H", "BIT 0,L", "BIT 0,(HL)", "BIT 0,A",
+      "BIT 1,B", "BIT 1,C", "BIT 1,D", "BIT 1,E", "BIT 1,H", "BIT 1,L", "BIT 1,(HL)", "BIT 1,A",
+      "BIT 2,B", "BIT 2,C", "BIT 2,D", "BIT 2,E", "BIT 2,H", "BIT 2,L", "BIT 2,(HL)", "BIT 2,A",
+      "BIT 3,B", "BIT 3,C", "BIT 3,D", "BIT 3,E", "BIT 3,H", "BIT 3,L", "BIT 3,(HL)", "BIT 3,A",
+      "BIT 4,B", "BIT 4,C", "BIT 4,D", "BIT 4,E", "BIT 4,H", "BIT 4,L", "BIT 4,(HL)", "BIT 4,A",
+      "BIT 5,B", "BIT 5,C", "BIT 5,D", "BIT 5,E", "BIT 5,H", "BIT 5,L", "BIT 5,(HL)", "BIT 5,A",
+      "BIT 6,B", "BIT 6,C", "BIT 6,D", "BIT 6,E", "BIT 6,H", "BIT 6,L", "BIT 6,(HL)", "BIT 6,A",
+      "BIT 7,B", "BIT 7,C", "BIT 7,D", "BIT 7,E", "BIT 7,H", "BIT 7,L", "BIT 7,(HL)", "BIT 7,A",
+      "RES 0,B", "RES 0,C", "RES 0,D", "RES 0,E", "RES 0,H", "RES 0,L", "RES 0,(HL)", "RES 0,A",
+      "RES 1,B", "RES 1,C", "RES 1,D", "RES 1,E", "RES 1,H", "RES 1,L", "RES 1,(HL)", "RES 1,A",
+      "RES 2,B", "RES 2,C", "RES 2,D", "RES 2,E", "RES 2,H", "RES 2,L", "RES 2,(HL)", "RES 2,A",
+      "RES 3,B", "RES 3,C", "RES 3,D", "RES 3,E", "RES 3,H", "RES 3,L", "RES 3,(HL)", "RES 3,A",
+      "RES 4,B", "RES 4,C", "RES 4,D", "RES 4,E", "RES 4,H", "RES 4,L", "RES 4,(HL)", "RES 4,A",
+      "RES 5,B", "RES 5,C", "RES 5,D", "RES 5,E", "RES 5,H", "RES 5,L", "RES 5,(HL)", "RES 5,A",
+      "RES 6,B", "RES 6,C", "RES 6,D", "RES 6,E", "RES 6,H", "RES 6,L", "RES 6,(HL)", "RES 6,A",
+      "RES 7,B", "RES 7,C", "RES 7,D", "RES 7,E", "RES 7,H", "RES 7,L", "RES 7,(HL)", "RES 7,A",
+      "SET 0,B", "SET 0,C", "SET 0,D", "SET 0,E", "SET 0,H", "SET 0,L", "SET 0,(HL)", "SET 0,A",
+      "SET 1,B", "SET 1,C", "SET 1,D", "SET 1,E", "SET 1,H", "SET 1,L", "SET 1,(HL)", "SET 1,A",
+      "SET 2,B", "SET 2,C", "SET 2,D", "SET 2,E", "SET 2,H", "SET 2,L", "SET 2,(HL)", "SET 2,A",
+      "SET 3,B", "SET 3,C", "SET 3,D", "SET 3,E", "SET 3,H", "SET 3,L", "SET 3,(HL)", "SET 3,A",
+      "SET 4,B", "SET 4,C", "SET 4,D", "SET 4,E", "SET 4,H", "SET 4,L", "SET 4,(HL)", "SET 4,A",
+      "SET 5,B", "SET 5,C", "SET 5,D", "SET 5,E", "SET 5,H", "SET 5,L", "SET 5,(HL)", "SET 5,A",
+      "SET 6,B", "SET 6,C", "SET 6,D", "SET 6,E", "SET 6,H", "SET 6,L", "SET 6,(HL)", "SET 6,A",
+      "SET 7,B", "SET 7,C", "SET 7,D", "SET 7,E", "SET 7,H", "SET 7,L", "SET 7,(HL)", "SET 7,A",
+    },
+    { // ed_table
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      "IN B,(C)", "OUT (C),B", "SBC HL,BC", "LD (nn),BC", "NEG", nullptr, "IM 0", "LD I,A",
+      "IN C,(C)", "OUT (C),C", "ADC HL,BC", "LD BC,(nn)", "NEG", "RETI", "IM 0", "LD R,A",
+      "IN D,(C)", "OUT (C),D", "SBC HL,DE", "LD (nn),DE", "NEG", nullptr, "IM 1", "LD A,I",
+      "IN E,(C)", "OUT (C),E", "ADC HL,DE", "LD DE,(nn)", "NEG", nullptr, "IM 2", "LD A,R",
+      "IN H,(C)", "OUT (C),H", "SBC HL,HL", "LD (nn),HL", "NEG", nullptr, "IM 0", "RRD",
+      "IN L,(C)", "OUT (C),L", "ADC HL,HL", "LD HL,(nn)", "NEG", nullptr, "IM 0", "RLD",
+      "IN (C)", "OUT (C)", "SBC HL,SP", "LD (nn),SP", "NEG", nullptr, "IM 1", "NOP (ED)",
+      "IN A,(C)", "OUT (C),A", "ADC HL,SP", "LD SP,(nn)", "NEG", nullptr, "IM 2", "NOP (ED)",
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      "LDI", "CPI", "INI", "OUTI", nullptr, nullptr, nullptr, nullptr,
+      "LDD", "CPD", "IND", "OUTD", nullptr, nullptr, nullptr, nullptr,
+      "LDIR", "CPIR", "INIR", "OTID", nullptr, nullptr, nullptr, nullptr,
+      "LDDR", "CPDR", "INDR", "OTDR", nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+    },
+    { // dd_table
+      "NOP", "LD BC,nn", "LD (BC),A", "INC BC", "INC B", "DEC B", "LD B,n", "RLCA",
+      "EX AF,AF'", "ADD IX,BC", "LD A,(BC)", "DEC BC", "INC C", "DEC C", "LD C,n", "RRCA",
+      "DJNZ", "LD DE,nn", "LD (DE),A", "INC DE", "INC D", "DEC D", "LD D,n", "RLA",
+      "JR d", "ADD IX,DE", "LD A,(DE)", "DEC DE", "INC E", "DEC E", "LD E,n", "RRA",
+      "JR NZ,d", "LD IX,nn", "LD (nn),IX", "INC IX", "INC IXH", "DEC IXH", "LD IXH,n", "DAA",
+      "JR Z,d", "ADD IX,IX", "LD IX,(nn)", "DEC IX", "INC IXL", "DEC IXL", "LD IXL,n", "CPL",
+      "JR NC,d", "LD SP,nn", "LD (nn),A", "INC SP", "INC (IX+d)", "DEC (IX+d)", "LD (IX+d),n", "SCF",
+      "JR C,d", "ADD IX,SP", "LD A,(nn)", "DEC SP", "INC A", "DEC A", "LD A,n", "CCF",
+      "LD B,B", "LD B,C", "LD B,D", "LD B,E", "LD B,IXH", "LD B,IXL", "LD B,(IX+d)", "LD B,A",
+      "LD C,B", "LD C,C", "LD C,D", "LD C,E", "LD C,IXH", "LD C,IXL", "LD C,(IX+d)", "LD C,A",
+      "LD D,B", "LD D,C", "LD D,D", "LD D,E", "LD D,IXH", "LD D,IXL", "LD D,(IX+d)", "LD D,A",
+      "LD E,B", "LD E,C", "LD E,D", "LD E,E", "LD E,IXH", "LD E,IXL", "LD E,(IX+d)", "LD E,A",
+      "LD IXH,B", "LD IXH,C", "LD IXH,D", "LD IXH,E", "LD IXH,IXH", "LD IXH,IXL", "LD H,(IX+d)", "LD IXH,A",
+      "LD IXL,B", "LD IXL,C", "LD IXL,D", "LD IXL,E", "LD IXL,IXH", "LD IXL,IXL", "LD L,(IX+d)", "LD IXL,A",
+      "LD (IX+d),B", "LD (IX+d),C", "LD (IX+d),D", "LD (IX+d),E", "LD (IX+d),H", "LD (IX+d),L", "HALT", "LD (IX+d),A",
+      "LD A,B", "LD A,C", "LD A,D", "LD A,E", "LD A,IXH", "LD A,IXL", "LD A,(IX+d)", "LD A,A",
+      "ADD B", "ADD C", "ADD D", "ADD E", "ADD IXH", "ADD IXL", "ADD (IX+d)", "ADD A",
+      "ADC B", "ADC C", "ADC D", "ADC E", "ADC IXH", "ADC IXL", "ADC (IX+d)", "ADC A",
+      "SUB B", "SUB C", "SUB D", "SUB E", "SUB IXH", "SUB IXL", "SUB (IX+d)", "SUB A",
+      "SBC B", "SBC C", "SBC D", "SBC E", "SBC IXH", "SBC IXL", "SBC (IX+d)", "SBC A",
+      "AND B", "AND C", "AND D", "AND E", "AND IXH", "AND IXL", "AND (IX+d)", "AND A",
+      "XOR B", "XOR C", "XOR D", "XOR E", "XOR IXH", "XOR IXL", "XOR (IX+d)", "XOR A",
+      "OR B", "OR C", "OR D", "OR E", "OR IXH", "OR IXL", "OR (IX+d)", "OR A",
+      "CP B", "CP C", "CP D", "CP E", "CP IXH", "CP IXL", "CP (IX+d)", "CP A",
+      "RET NZ", "POP BC", "JP NZ,nn", "JP nn", "CALL NZ,nn", "PUSH BC", "ADD n", "RST 0x0",
+      "RET Z", "RET", "JP Z,nn", nullptr, "CALL Z,nn", "CALL nn", "ADC n", "RST 0x8",
+      "RET NC", "POP DE", "JP NC,nn", "OUT (n),A", "CALL NC,nn", "PUSH DE", "SUB n", "RST 0x10",
+      "RET C", "EXX", "JP C,nn", "IN A,(n)", "CALL C,nn", nullptr, "SBC n", "RST 0x18",
+      "RET PO", "POP IX", "JP PO,nn", "EX (SP),IX", "CALL PO,nn", "PUSH IX", "AND n", "RST 0x20",
+      "RET PE", "JP IX", "JP PE,nn", "EX DE,HL", "CALL PE,nn", nullptr, "XOR n", "RST 0x28",
+      "RET P", "POP AF", "JP P,nn", "DI", "CALL P,nn", "PUSH AF", "OR n", "RST 0x30",
+      "RET M", "LD SP,IX", "JP M,nn", "EI", "CALL M,nn", nullptr, "CP n", "RST 0x38",
+    },
+    { // fd_table
+      "NOP", "LD BC,nn", "LD (BC),A", "INC BC", "INC B", "DEC B", "LD B,n", "RLCA",
+      "EX AF,AF'", "ADD IY,BC", "LD A,(BC)", "DEC BC", "INC C", "DEC C", "LD C,n", "RRCA",
+      "DJNZ", "LD DE,nn", "LD (DE),A", "INC DE", "INC D", "DEC D", "LD D,n", "RLA",
+      "JR d", "ADD IY,DE", "LD A,(DE)", "DEC DE", "INC E", "DEC E", "LD E,n", "RRA",
+      "JR NZ,d", "LD IY,nn", "LD (nn),IY", "INC IY", "INC IYH", "DEC IYH", "LD IYH,n", "DAA",
+      "JR Z,d", "ADD IY,IY", "LD IY,(nn)", "DEC IY", "INC IYL", "DEC IYL", "LD IYL,n", "CPL",
+      "JR NC,d", "LD SP,nn", "LD (nn),A", "INC SP", "INC (IY+d)", "DEC (IY+d)", "LD (IY+d),n", "SCF",
+      "JR C,d", "ADD IY,SP", "LD A,(nn)", "DEC SP", "INC A", "DEC A", "LD A,n", "CCF",
+      "LD B,B", "LD B,C", "LD B,D", "LD B,E", "LD B,IYH", "LD B,IYL", "LD B,(IY+d)", "LD B,A",
+      "LD C,B", "LD C,C", "LD C,D", "LD C,E", "LD C,IYH", "LD C,IYL", "LD C,(IY+d)", "LD C,A",
+      "LD D,B", "LD D,C", "LD D,D", "LD D,E", "LD D,IYH", "LD D,IYL", "LD D,(IY+d)", "LD D,A",
+      "LD E,B", "LD E,C", "LD E,D", "LD E,E", "LD E,IYH", "LD E,IYL", "LD E,(IY+d)", "LD E,A",
+      "LD IYH,B", "LD IYH,C", "LD IYH,D", "LD IYH,E", "LD IYH,IYH", "LD IYH,IYL", "LD H,(IY+d)", "LD IYH,A",
+      "LD IYL,B", "LD IYL,C", "LD IYL,D", "LD IYL,E", "LD IYL,IYH", "LD IYL,IYL", "LD L,(IY+d)", "LD IYL,A",
+      "LD (IY+d),B", "LD (IY+d),C", "LD (IY+d),D", "LD (IY+d),E", "LD (IY+d),H", "LD (IY+d),L", "HALT", "LD (IY+d),A",
+      "LD A,B", "LD A,C", "LD A,D", "LD A,E", "LD A,IYH", "LD A,IYL", "LD A,(IY+d)", "LD A,A",
+      "ADD B", "ADD C", "ADD D", "ADD E", "ADD IYH", "ADD IYL", "ADD (IY+d)", "ADD A",
+      "ADC B", "ADC C", "ADC D", "ADC E", "ADC IYH", "ADC IYL", "ADC (IY+d)", "ADC A",
+      "SUB B", "SUB C", "SUB D", "SUB E", "SUB IYH", "SUB IYL", "SUB (IY+d)", "SUB A",
+      "SBC B", "SBC C", "SBC D", "SBC E", "SBC IYH", "SBC IYL", "SBC (IY+d)", "SBC A",
+      "AND B", "AND C", "AND D", "AND E", "AND IYH", "AND IYL", "AND (IY+d)", "AND A",
+      "XOR B", "XOR C", "XOR D", "XOR E", "XOR IYH", "XOR IYL", "XOR (IY+d)", "XOR A",
+      "OR B", "OR C", "OR D", "OR E", "OR IYH", "OR IYL", "OR (IY+d)", "OR A",
+      "CP B", "CP C", "CP D", "CP E", "CP IYH", "CP IYL", "CP (IY+d)", "CP A",
+      "RET NZ", "POP BC", "JP NZ,nn", "JP nn", "CALL NZ,nn", "PUSH BC", "ADD n", "RST 0x0",
+      "RET Z", "RET", "JP Z,nn", nullptr, "CALL Z,nn", "CALL nn", "ADC n", "RST 0x8",
+      "RET NC", "POP DE", "JP NC,nn", "OUT (n),A", "CALL NC,nn", "PUSH DE", "SUB n", "RST 0x10",
+      "RET C", "EXX", "JP C,nn", "IN A,(n)", "CALL C,nn", nullptr, "SBC n", "RST 0x18",
+      "RET PO", "POP IY", "JP PO,nn", "EX (SP),IY", "CALL PO,nn", "PUSH IY", "AND n", "RST 0x20",
+      "RET PE", "JP IY", "JP PE,nn", "EX DE,HL", "CALL PE,nn", nullptr, "XOR n", "RST 0x28",
+      "RET P", "POP AF", "JP P,nn", "DI", "CALL P,nn", "PUSH AF", "OR n", "RST 0x30",
+      "RET M", "LD SP,IY", "JP M,nn", "EI", "CALL M,nn", nullptr, "CP n", "RST 0x38",
+    },
+    { // ddcb_table
+      "RLC (IX+d),B", "RLC (IX+d),C", "RLC (IX+d),D", "RLC (IX+d),E", "RLC (IX+d),H", "RLC (IX+d),L", "RLC (IX+d)", "RLC (IX+d),A",
+      "RRC (IX+d),B", "RRC (IX+d),C", "RRC (IX+d),D", "RRC (IX+d),E", "RRC (IX+d),H", "RRC (IX+d),L", "RRC (IX+d)", "RRC (IX+d),A",
+      "RL (IX+d),B", "RL (IX+d),C", "RL (IX+d),D", "RL (IX+d),E", "RL (IX+d),H", "RL (IX+d),L", "RL (IX+d)", "RL (IX+d),A",
+      "RR (IX+d),B", "RR (IX+d),C", "RR (IX+d),D", "RR (IX+d),E", "RR (IX+d),H", "RR (IX+d),L", "RR (IX+d)", "RR (IX+d),A",
+      "SLA (IX+d),B", "SLA (IX+d),C", "SLA (IX+d),D", "SLA (IX+d),E", "SLA (IX+d),H", "SLA (IX+d),L", "SLA (IX+d)", "SLA (IX+d),A",
+      "SRA (IX+d),B", "SRA (IX+d),C", "SRA (IX+d),D", "SRA (IX+d),E", "SRA (IX+d),H", "SRA (IX+d),L", "SRA (IX+d)", "SRA (IX+d),A",
+      "SLL (IX+d),B", "SLL (IX+d),C", "SLL (IX+d),D", "SLL (IX+d),E", "SLL (IX+d),H", "SLL (IX+d),L", "SLL (IX+d)", "SLL (IX+d),A",
+      "SRL (IX+d),B", "SRL (IX+d),C", "SRL (IX+d),D", "SRL (IX+d),E", "SRL (IX+d),H", "SRL (IX+d),L", "SRL (IX+d)", "SRL (IX+d),A",
+      "BIT 0,(IX+d)", "BIT 0,(IX+d)", "BIT 0,(IX+d)", "BIT 0,(IX+d)", "BIT 0,(IX+d)", "BIT 0,(IX+d)", "BIT 0,(IX+d)", "BIT 0,(IX+d)",
+      "BIT 1,(IX+d)", "BIT 1,(IX+d)", "BIT 1,(IX+d)", "BIT 1,(IX+d)", "BIT 1,(IX+d)", "BIT 1,(IX+d)", "BIT 1,(IX+d)", "BIT 1,(IX+d)",
+      "BIT 2,(IX+d)", "BIT 2,(IX+d)", "BIT 2,(IX+d)", "BIT 2,(IX+d)", "BIT 2,(IX+d)", "BIT 2,(IX+d)", "BIT 2,(IX+d)", "BIT 2,(IX+d)",
+      "BIT 3,(IX+d)", "BIT 3,(IX+d)", "BIT 3,(IX+d)", "BIT 3,(IX+d)", "BIT 3,(IX+d)", "BIT 3,(IX+d)", "BIT 3,(IX+d)", "BIT 3,(IX+d)",
+      "BIT 4,(IX+d)", "BIT 4,(IX+d)", "BIT 4,(IX+d)", "BIT 4,(IX+d)", "BIT 4,(IX+d)", "BIT 4,(IX+d)", "BIT 4,(IX+d)", "BIT 4,(IX+d)",
+      "BIT 5,(IX+d)", "BIT 5,(IX+d)", "BIT 5,(IX+d)", "BIT 5,(IX+d)", "BIT 5,(IX+d)", "BIT 5,(IX+d)", "BIT 5,(IX+d)", "BIT 5,(IX+d)",
+      "BIT 6,(IX+d)", "BIT 6,(IX+d)", "BIT 6,(IX+d)", "BIT 6,(IX+d)", "BIT 6,(IX+d)", "BIT 6,(IX+d)", "BIT 6,(IX+d)", "BIT 6,(IX+d)",
+      "BIT 7,(IX+d)", "BIT 7,(IX+d)", "BIT 7,(IX+d)", "BIT 7,(IX+d)", "BIT 7,(IX+d)", "BIT 7,(IX+d)", "BIT 7,(IX+d)", "BIT 7,(IX+d)",
+      "RES 0,(IX+d),B", "RES 0,(IX+d),C", "RES 0,(IX+d),D", "RES 0,(IX+d),E", "RES 0,(IX+d),H", "RES 0,(IX+d),L", "RES 0,(IX+d)", "RES 0,(IX+d),A",
+      "RES 1,(IX+d),B", "RES 1,(IX+d),C", "RES 1,(IX+d),D", "RES 1,(IX+d),E", "RES 1,(IX+d),H", "RES 1,(IX+d),L", "RES 1,(IX+d)", "RES 1,(IX+d),A",
+      "RES 2,(IX+d),B", "RES 2,(IX+d),C", "RES 2,(IX+d),D", "RES 2,(IX+d),E", "RES 2,(IX+d),H", "RES 2,(IX+d),L", "RES 2,(IX+d)", "RES 2,(IX+d),A",
+      "RES 3,(IX+d),B", "RES 3,(IX+d),C", "RES 3,(IX+d),D", "RES 3,(IX+d),E", "RES 3,(IX+d),H", "RES 3,(IX+d),L", "RES 3,(IX+d)", "RES 3,(IX+d),A",
+      "RES 4,(IX+d),B", "RES 4,(IX+d),C", "RES 4,(IX+d),D", "RES 4,(IX+d),E", "RES 4,(IX+d),H", "RES 4,(IX+d),L", "RES 4,(IX+d)", "RES 4,(IX+d),A",
+      "RES 5,(IX+d),B", "RES 5,(IX+d),C", "RES 5,(IX+d),D", "RES 5,(IX+d),E", "RES 5,(IX+d),H", "RES 5,(IX+d),L", "RES 5,(IX+d)", "RES 5,(IX+d),A",
+      "RES 6,(IX+d),B", "RES 6,(IX+d),C", "RES 6,(IX+d),D", "RES 6,(IX+d),E", "RES 6,(IX+d),H", "RES 6,(IX+d),L", "RES 6,(IX+d)", "RES 6,(IX+d),A",
+      "RES 7,(IX+d),B", "RES 7,(IX+d),C", "RES 7,(IX+d),D", "RES 7,(IX+d),E", "RES 7,(IX+d),H", "RES 7,(IX+d),L", "RES 7,(IX+d)", "RES 7,(IX+d),A",
+      "SET 0,(IX+d),B", "SET 0,(IX+d),C", "SET 0,(IX+d),D", "SET 0,(IX+d),E", "SET 0,(IX+d),H", "SET 0,(IX+d),L", "SET 0,(IX+d)", "SET 0,(IX+d),A",
+      "SET 1,(IX+d),B", "SET 1,(IX+d),C", "SET 1,(IX+d),D", "SET 1,(IX+d),E", "SET 1,(IX+d),H", "SET 1,(IX+d),L", "SET 1,(IX+d)", "SET 1,(IX+d),A",
+      "SET 2,(IX+d),B", "SET 2,(IX+d),C", "SET 2,(IX+d),D", "SET 2,(IX+d),E", "SET 2,(IX+d),H", "SET 2,(IX+d),L", "SET 2,(IX+d)", "SET 2,(IX+d),A",
+      "SET 3,(IX+d),B", "SET 3,(IX+d),C", "SET 3,(IX+d),D", "SET 3,(IX+d),E", "SET 3,(IX+d),H", "SET 3,(IX+d),L", "SET 3,(IX+d)", "SET 3,(IX+d),A",
+      "SET 4,(IX+d),B", "SET 4,(IX+d),C", "SET 4,(IX+d),D", "SET 4,(IX+d),E", "SET 4,(IX+d),H", "SET 4,(IX+d),L", "SET 4,(IX+d)", "SET 4,(IX+d),A",
+      "SET 5,(IX+d),B", "SET 5,(IX+d),C", "SET 5,(IX+d),D", "SET 5,(IX+d),E", "SET 5,(IX+d),H", "SET 5,(IX+d),L", "SET 5,(IX+d)", "SET 5,(IX+d),A",
+      "SET 6,(IX+d),B", "SET 6,(IX+d),C", "SET 6,(IX+d),D", "SET 6,(IX+d),E", "SET 6,(IX+d),H", "SET 6,(IX+d),L", "SET 6,(IX+d)", "SET 6,(IX+d),A",
+      "SET 7,(IX+d),B", "SET 7,(IX+d),C", "SET 7,(IX+d),D", "SET 7,(IX+d),E", "SET 7,(IX+d),H", "SET 7,(IX+d),L", "SET 7,(IX+d)", "SET 7,(IX+d),A",
+    },
+    { // fdcb_table
+      "RLC (IY+d),B", "RLC (IY+d),C", "RLC (IY+d),D", "RLC (IY+d),E", "RLC (IY+d),H", "RLC (IY+d),L", "RLC (IY+d)", "RLC (IY+d),A",
+      "RRC (IY+d),B", "RRC (IY+d),C", "RRC (IY+d),D", "RRC (IY+d),E", "RRC (IY+d),H", "RRC (IY+d),L", "RRC (IY+d)", "RRC (IY+d),A",
+      "RL (IY+d),B", "RL (IY+d),C", "RL (IY+d),D", "RL (IY+d),E", "RL (IY+d),H", "RL (IY+d),L", "RL (IY+d)", "RL (IY+d),A",
+      "RR (IY+d),B", "RR (IY+d),C", "RR (IY+d),D", "RR (IY+d),E", "RR (IY+d),H", "RR (IY+d),L", "RR (IY+d)", "RR (IY+d),A",
+      "SLA (IY+d),B", "SLA (IY+d),C", "SLA (IY+d),D", "SLA (IY+d),E", "SLA (IY+d),H", "SLA (IY+d),L", "SLA (IY+d)", "SLA (IY+d),A",
+      "SRA (IY+d),B", "SRA (IY+d),C", "SRA (IY+d),D", "SRA (IY+d),E", "SRA (IY+d),H", "SRA (IY+d),L", "SRA (IY+d)", "SRA (IY+d),A",
+      "SLL (IY+d),B", "SLL (IY+d),C", "SLL (IY+d),D", "SLL (IY+d),E", "SLL (IY+d),H", "SLL (IY+d),L", "SLL (IY+d)", "SLL (IY+d),A",
+      "SRL (IY+d),B", "SRL (IY+d),C", "SRL (IY+d),D", "SRL (IY+d),E", "SRL (IY+d),H", "SRL (IY+d),L", "SRL (IY+d)", "SRL (IY+d),A",
+      "BIT 0,(IY+d)", "BIT 0,(IY+d)", "BIT 0,(IY+d)", "BIT 0,(IY+d)", "BIT 0,(IY+d)", "BIT 0,(IY+d)", "BIT 0,(IY+d)", "BIT 0,(IY+d)",
+      "BIT 1,(IY+d)", "BIT 1,(IY+d)", "BIT 1,(IY+d)", "BIT 1,(IY+d)", "BIT 1,(IY+d)", "BIT 1,(IY+d)", "BIT 1,(IY+d)", "BIT 1,(IY+d)",
+      "BIT 2,(IY+d)", "BIT 2,(IY+d)", "BIT 2,(IY+d)", "BIT 2,(IY+d)", "BIT 2,(IY+d)", "BIT 2,(IY+d)", "BIT 2,(IY+d)", "BIT 2,(IY+d)",
+      "BIT 3,(IY+d)", "BIT 3,(IY+d)", "BIT 3,(IY+d)", "BIT 3,(IY+d)", "BIT 3,(IY+d)", "BIT 3,(IY+d)", "BIT 3,(IY+d)", "BIT 3,(IY+d)",
+      "BIT 4,(IY+d)", "BIT 4,(IY+d)", "BIT 4,(IY+d)", "BIT 4,(IY+d)", "BIT 4,(IY+d)", "BIT 4,(IY+d)", "BIT 4,(IY+d)", "BIT 4,(IY+d)",
+      "BIT 5,(IY+d)", "BIT 5,(IY+d)", "BIT 5,(IY+d)", "BIT 5,(IY+d)", "BIT 5,(IY+d)", "BIT 5,(IY+d)", "BIT 5,(IY+d)", "BIT 5,(IY+d)",
+      "BIT 6,(IY+d)", "BIT 6,(IY+d)", "BIT 6,(IY+d)", "BIT 6,(IY+d)", "BIT 6,(IY+d)", "BIT 6,(IY+d)", "BIT 6,(IY+d)", "BIT 6,(IY+d)",
+      "BIT 7,(IY+d)", "BIT 7,(IY+d)", "BIT 7,(IY+d)", "BIT 7,(IY+d)", "BIT 7,(IY+d)", "BIT 7,(IY+d)", "BIT 7,(IY+d)", "BIT 7,(IY+d)",
+      "RES 0,(IY+d),B", "RES 0,(IY+d),C", "RES 0,(IY+d),D", "RES 0,(IY+d),E", "RES 0,(IY+d),H", "RES 0,(IY+d),L", "RES 0,(IY+d)", "RES 0,(IY+d),A",
+      "RES 1,(IY+d),B", "RES 1,(IY+d),C", "RES 1,(IY+d),D", "RES 1,(IY+d),E", "RES 1,(IY+d),H", "RES 1,(IY+d),L", "RES 1,(IY+d)", "RES 1,(IY+d),A",
+      "RES 2,(IY+d),B", "RES 2,(IY+d),C", "RES 2,(IY+d),D", "RES 2,(IY+d),E", "RES 2,(IY+d),H", "RES 2,(IY+d),L", "RES 2,(IY+d)", "RES 2,(IY+d),A",
+      "RES 3,(IY+d),B", "RES 3,(IY+d),C", "RES 3,(IY+d),D", "RES 3,(IY+d),E", "RES 3,(IY+d),H", "RES 3,(IY+d),L", "RES 3,(IY+d)", "RES 3,(IY+d),A",
+      "RES 4,(IY+d),B", "RES 4,(IY+d),C", "RES 4,(IY+d),D", "RES 4,(IY+d),E", "RES 4,(IY+d),H", "RES 4,(IY+d),L", "RES 4,(IY+d)", "RES 4,(IY+d),A",
+      "RES 5,(IY+d),B", "RES 5,(IY+d),C", "RES 5,(IY+d),D", "RES 5,(IY+d),E", "RES 5,(IY+d),H", "RES 5,(IY+d),L", "RES 5,(IY+d)", "RES 5,(IY+d),A",
+      "RES 6,(IY+d),B", "RES 6,(IY+d),C", "RES 6,(IY+d),D", "RES 6,(IY+d),E", "RES 6,(IY+d),H", "RES 6,(IY+d),L", "RES 6,(IY+d)", "RES 6,(IY+d),A",
+      "RES 7,(IY+d),B", "RES 7,(IY+d),C", "RES 7,(IY+d),D", "RES 7,(IY+d),E", "RES 7,(IY+d),H", "RES 7,(IY+d),L", "RES 7,(IY+d)", "RES 7,(IY+d),A",
+      "SET 0,(IY+d),B", "SET 0,(IY+d),C", "SET 0,(IY+d),D", "SET 0,(IY+d),E", "SET 0,(IY+d),H", "SET 0,(IY+d),L", "SET 0,(IY+d)", "SET 0,(IY+d),A",
+      "SET 1,(IY+d),B", "SET 1,(IY+d),C", "SET 1,(IY+d),D", "SET 1,(IY+d),E", "SET 1,(IY+d),H", "SET 1,(IY+d),L", "SET 1,(IY+d)", "SET 1,(IY+d),A",
+      "SET 2,(IY+d),B", "SET 2,(IY+d),C", "SET 2,(IY+d),D", "SET 2,(IY+d),E", "SET 2,(IY+d),H", "SET 2,(IY+d),L", "SET 2,(IY+d)", "SET 2,(IY+d),A",
+      "SET 3,(IY+d),B", "SET 3,(IY+d),C", "SET 3,(IY+d),D", "SET 3,(IY+d),E", "SET 3,(IY+d),H", "SET 3,(IY+d),L", "SET 3,(IY+d)", "SET 3,(IY+d),A",
+      "SET 4,(IY+d),B", "SET 4,(IY+d),C", "SET 4,(IY+d),D", "SET 4,(IY+d),E", "SET 4,(IY+d),H", "SET 4,(IY+d),L", "SET 4,(IY+d)", "SET 4,(IY+d),A",
+      "SET 5,(IY+d),B", "SET 5,(IY+d),C", "SET 5,(IY+d),D", "SET 5,(IY+d),E", "SET 5,(IY+d),H", "SET 5,(IY+d),L", "SET 5,(IY+d)", "SET 5,(IY+d),A",
+      "SET 6,(IY+d),B", "SET 6,(IY+d),C", "SET 6,(IY+d),D", "SET 6,(IY+d),E", "SET 6,(IY+d),H", "SET 6,(IY+d),L", "SET 6,(IY+d)", "SET 6,(IY+d),A",
+      "SET 7,(IY+d),B", "SET 7,(IY+d),C", "SET 7,(IY+d),D", "SET 7,(IY+d),E", "SET 7,(IY+d),H", "SET 7,(IY+d),L", "SET 7,(IY+d)", "SET 7,(IY+d),A",
+    },
+  };
+  YAKC_ASSERT((table >= 0) && (table < opstats::num_tables));
+  return names[table][op];
+}
 } // namespace YAKC
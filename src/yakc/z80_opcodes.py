@@ -9,7 +9,7 @@
 #-------------------------------------------------------------------------------
 
 # fips code generator version stamp
-Version = 2
+Version = 3
 
 # tab-width for generated code
 TabWidth = 2
@@ -17,6 +17,12 @@ TabWidth = 2
 # the target file handle
 Out = None
 
+# the opcode table currently being generated (see opstats.h), and
+# the instruction names of each table for z80::op_name()
+Table = 'main_table'
+Tables = [ 'main_table', 'cb_table', 'ed_table', 'dd_table', 'fd_table', 'ddcb_table', 'fdcb_table' ]
+Names = {}
+
 # 8-bit register table, the 'HL' entry is for instructions that use
 # (HL), (IX+d) and (IY+d), and will be patched to 'IX' or 'IY' for
 # the DD/FD prefix instructions
@@ -98,6 +104,13 @@ def iHLdsrc(ext) :
         # HL
         return 'uword a={}'.format(r[6])
 
+#-------------------------------------------------------------------------------
+# Return code to count a taken conditional jump, call or return
+# in the instruction statistics
+#
+def taken(op) :
+    return 'count_taken(opstats::{},{});'.format(Table, hex(op))
+
 #-------------------------------------------------------------------------------
 # Encode a main instruction, or an DD or FD prefix instruction.
 # Takes an opcode byte and returns an opcode object, for invalid instructions
@@ -165,7 +178,7 @@ def enc_op(op, cyc, ext) :
             elif y == 2:
                 # DJNZ d
                 o.cmt = 'DJNZ'
-                o.src = 'if (--B>0) {{ WZ=PC=PC+mem.rs8(PC)+1; return {}; }} else {{ PC++; return {}; }}'.format(13+cyc, 8+cyc)
+                o.src = 'if (--B>0) {{ {} WZ=PC=PC+mem.rs8(PC)+1; return {}; }} else {{ PC++; return {}; }}'.format(taken(op), 13+cyc, 8+cyc)
             elif  y == 3:
                 # JR d
                 o.cmt = 'JR d'
@@ -173,7 +186,7 @@ def enc_op(op, cyc, ext) :
             else:
                 # JR cc,d
                 o.cmt = 'JR {},d'.format(cc_cmt[y-4])
-                o.src = 'if ({}) {{ WZ=PC=PC+mem.rs8(PC)+1; return {}; }} else {{ PC++; return {}; }}'.format(cc[y-4], 12+cyc, 7+cyc)
+                o.src = 'if ({}) {{ {} WZ=PC=PC+mem.rs8(PC)+1; return {}; }} else {{ PC++; return {}; }}'.format(cc[y-4], taken(op), 12+cyc, 7+cyc)
         elif z == 1:
             if q == 0:
                 # 16-bit immediate loads
@@ -245,7 +258,7 @@ def enc_op(op, cyc, ext) :
         if z == 0:
             # RET cc
             o.cmt = 'RET {}'.format(cc_cmt[y])
-            o.src = 'if ({}) {{ WZ=PC=mem.r16(SP); SP+=2; return {}; }} else return {};'.format(cc[y], 11+cyc, 5+cyc)
+            o.src = 'if ({}) {{ {} WZ=PC=mem.r16(SP); SP+=2; return {}; }} else return {};'.format(cc[y], taken(op), 11+cyc, 5+cyc)
         elif z == 1:
             if q == 0:
                 # POP BC,DE,HL,IX,IY,AF
@@ -264,7 +277,7 @@ def enc_op(op, cyc, ext) :
         elif z == 2:
             # JP cc,nn
             o.cmt = 'JP {},nn'.format(cc_cmt[y])
-            o.src = 'WZ=mem.r16(PC); if ({}) {{ PC=WZ; }} else {{ PC+=2; }}; return {};'.format(cc[y], 10+cyc)
+            o.src = 'WZ=mem.r16(PC); if ({}) {{ {} PC=WZ; }} else {{ PC+=2; }}; return {};'.format(cc[y], taken(op), 10+cyc)
         elif z == 3:
             # misc ops
             op_tbl = [
@@ -285,7 +298,7 @@ def enc_op(op, cyc, ext) :
         elif z == 4:
             # CALL cc,nn
             o.cmt = 'CALL {},nn'.format(cc_cmt[y])
-            o.src = 'WZ=mem.r16(PC); PC+=2; if ({}) {{ SP-=2; mem.w16(SP,PC); PC=WZ; return {}; }} else {{ return {}; }}'.format(cc[y], 17+cyc, 10+cyc)
+            o.src = 'WZ=mem.r16(PC); PC+=2; if ({}) {{ {} SP-=2; mem.w16(SP,PC); PC=WZ; return {}; }} else {{ return {}; }}'.format(cc[y], taken(op), 17+cyc, 10+cyc)
         elif z == 5:
             if q == 0:
                 # PUSH BC,DE,HL,IX,IY,AF
@@ -370,7 +383,7 @@ def enc_ed_op(op) :
             # OUT (C),r
             if y == 6:
                 # undocumented special case 'OUT (C),F', always output 0
-                o.cmd = 'OUT (C)';
+                o.cmt = 'OUT (C)';
                 o.src = 'out(BC,0); return 12;';
             else:
                 o.cmt = 'OUT (C),{}'.format(r[y])
@@ -545,7 +558,7 @@ def write_begin_group(f, indent, ext_byte=None, read_offset=False) :
     # the actual instruction byte
     if read_offset :
         l('{}{{ const int d = mem.rs8(PC++);'.format(tab(indent)))
-    l('{}switch (fetch_op()) {{'.format(tab(indent)))
+    l('{}switch (fetch_op(opstats::{})) {{'.format(tab(indent), Table))
     indent += 1
     return indent
 
@@ -554,6 +567,7 @@ def write_begin_group(f, indent, ext_byte=None, read_offset=False) :
 #
 def write_op(f, indent, op) :
     if op.src :
+        Names.setdefault(Table, {})[op.byte] = op.cmt
         l('{}case {}: {} // {}'.format(tab(indent), hex(op.byte), op.src, op.cmt))
 
 #-------------------------------------------------------------------------------
@@ -576,8 +590,32 @@ def write_end_group(f, indent, inv_op_bytes, ext_byte=None, read_offset=False) :
 #
 def write_footer(f) :
     l('}')
+    write_names(f)
     l('} // namespace YAKC');
 
+#-------------------------------------------------------------------------------
+# write the instruction name tables (nullptr for prefixes and invalid ops)
+#
+def write_names(f) :
+    l('const char* z80::op_name(int table, ubyte op) {')
+    l('{}static const char* names[opstats::num_tables][256] = {{'.format(tab(1)))
+    for t in Tables :
+        l('{}{{ // {}'.format(tab(2), t))
+        names = Names.get(t, {})
+        for i in range(0, 256, 8) :
+            items = []
+            for ii in range(i, i+8) :
+                if ii in names :
+                    items.append('"{}"'.format(names[ii]))
+                else :
+                    items.append('nullptr')
+            l('{}{},'.format(tab(3), ', '.join(items)))
+        l('{}}},'.format(tab(2)))
+    l('{}}};'.format(tab(1)))
+    l('{}YAKC_ASSERT((table >= 0) && (table < opstats::num_tables));'.format(tab(1)))
+    l('{}return names[table][op];'.format(tab(1)))
+    l('}')
+
 #-------------------------------------------------------------------------------
 # main encoder function, this populates all the opcode tables and
 # generates the C++ source code into the file f
@@ -585,7 +623,10 @@ def write_footer(f) :
 def do_it(f) :
 
     global Out
+    global Table
     Out = f
+    Table = 'main_table'
+    Names.clear()
 
     write_header(f)
     
@@ -594,31 +635,39 @@ def do_it(f) :
     for i in range(0, 256) :
         # DD or FD prefix instruction?
         if i == 0xDD or i == 0xFD:
+            Table = 'dd_table' if i==0xDD else 'fd_table'
             indent = write_begin_group(f, indent, i)
             patch_reg_tables('IX' if i==0xDD else 'IY')
             for ii in range(0, 256) :
                 if ii == 0xCB:
                     # DD/FD CB prefix
+                    Table = 'ddcb_table' if i==0xDD else 'fdcb_table'
                     indent = write_begin_group(f, indent, ii, True)
                     for iii in range(0, 256) :
                         write_op(f, indent, enc_cb_op(iii, 4, True))
                     indent = write_end_group(f, indent, 4, True, True)
+                    Table = 'dd_table' if i==0xDD else 'fd_table'
                 else:
                     write_op(f, indent, enc_op(ii, 4, True))
             unpatch_reg_tables()
             indent = write_end_group(f, indent, 2, True)
+            Table = 'main_table'
         # ED prefix instructions
         elif i == 0xED:
+            Table = 'ed_table'
             indent = write_begin_group(f, indent, i)
             for ii in range(0, 256) :
                 write_op(f, indent, enc_ed_op(ii))
             indent = write_end_group(f, indent, 2, True)
+            Table = 'main_table'
         # CB prefix instructions
         elif i == 0xCB:
+            Table = 'cb_table'
             indent = write_begin_group(f, indent, i, False)
             for ii in range(0, 256) :
                 write_op(f, indent, enc_cb_op(ii, 0, False))
             indent = write_end_group(f, indent, 2, True)
+            Table = 'main_table'
         # non-prefixed instruction
         else:
             write_op(f, indent, enc_op(i, 0, False))
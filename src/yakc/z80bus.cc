@@ -59,4 +59,11 @@ z80bus::timer(int timer_id) {
     // empty
 }
 
+//------------------------------------------------------------------------------
+int
+z80bus::block_cycles(uword) {
+    // default: execute block instructions one iteration per step
+    return 0;
+}
+
 } // namespace YAKC
@@ -31,6 +31,8 @@ public:
     virtual void irq();
     /// clock timer triggered
     virtual void timer(int timer_id);
+    /// T-states a repeating block instruction at pc may run in bulk before the next scheduled event
+    virtual int block_cycles(uword pc);
 };
 
 } // namespace YAKC
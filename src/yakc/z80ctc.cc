@@ -114,6 +114,22 @@ z80ctc::update_timers(z80bus* bus, int ticks) {
     }
 }
 
+//------------------------------------------------------------------------------
+int
+z80ctc::ticks_to_next_timer() const {
+    int ticks = 0x7FFFFFFF;
+    for (const auto& chn : this->channels) {
+        if (0 == (chn.mode & (RESET|CONSTANT_FOLLOWS))) {
+            if (((chn.mode & MODE) == MODE_TIMER) && !chn.waiting_for_trigger) {
+                if (chn.down_counter < ticks) {
+                    ticks = chn.down_counter;
+                }
+            }
+        }
+    }
+    return ticks;
+}
+
 //------------------------------------------------------------------------------
 void
 z80ctc::update_counter(z80bus* bus, int chn_index) {
@@ -78,6 +78,8 @@ public:
     void reset();
     /// update the CTC for a number of ticks, a tick is equal to a Z80 T-cycle
     void update_timers(z80bus* bus, int ticks);
+    /// get number of ticks until the next timer-mode channel reaches zero
+    int ticks_to_next_timer() const;
 
     /// trigger one of the CTC channel lines
     void ctrg(z80bus* bus, channel c);
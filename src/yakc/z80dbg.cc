@@ -12,19 +12,167 @@ paused(false) {
     memset(&this->pc_history, 0, sizeof(this->pc_history));
 }
 
+//------------------------------------------------------------------------------
+z80dbg::addr_bitmaps::addr_bitmaps(const addr_bitmaps& rhs) {
+    *this = rhs;
+}
+
+//------------------------------------------------------------------------------
+z80dbg::addr_bitmaps&
+z80dbg::addr_bitmaps::operator=(const addr_bitmaps& rhs) {
+    if (this != &rhs) {
+        if (rhs.pc) {
+            this->alloc(rhs.funcs);
+            memcpy(this->pc, rhs.pc, 3 * num_addr_words * sizeof(uint32_t));
+        }
+        else {
+            this->discard();
+        }
+    }
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+z80dbg::addr_bitmaps::~addr_bitmaps() {
+    this->discard();
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::addr_bitmaps::alloc(const ext_funcs& f) {
+    if (nullptr == this->pc) {
+        this->funcs = f;
+        const int num_bytes = 3 * num_addr_words * sizeof(uint32_t);
+        this->pc = (uint32_t*) YAKC_MALLOC(this->funcs, num_bytes);
+        clear(this->pc, num_bytes);
+        this->read = this->pc + num_addr_words;
+        this->write = this->read + num_addr_words;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::addr_bitmaps::discard() {
+    if (this->pc) {
+        YAKC_FREE(this->funcs, this->pc);
+        this->pc = this->read = this->write = nullptr;
+    }
+}
+
 //------------------------------------------------------------------------------
 bool
-z80dbg::check_break(const z80& cpu) const {
-    for (int i = 0; i < max_breakpoints; i++) {
-        if (this->breakpoints[i].enabled) {
-            if (cpu.PC == this->breakpoints[i].address) {
-                return true;
-            }
+z80dbg::check_break(const z80& cpu, uint64_t cycle_count) {
+    if (this->suspended) {
+        return false;
+    }
+    if (this->pending_type != break_none) {
+        const break_type type = this->pending_type;
+        this->pending_type = break_none;
+        if (this->condition_met(type, this->pending_addr, cpu, cycle_count) &&
+            this->stop(type, this->pending_addr, cycle_count)) {
+            return true;
         }
     }
+    if (test_bit(this->bits.pc, cpu.PC) && this->condition_met(break_pc, cpu.PC, cpu, cycle_count)) {
+        return this->stop(break_pc, cpu.PC, cycle_count);
+    }
     return false;
 }
 
+//------------------------------------------------------------------------------
+bool
+z80dbg::stop(break_type type, uword addr, uint64_t cycle_count) {
+    this->break_reason = type;
+    this->break_addr = addr;
+    this->break_cycle = cycle_count;
+    return this->stop_on_break;
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::begin_run(z80& cpu) {
+    if (this->suspended) {
+        return;
+    }
+    if ((0 != this->read_pages) || (0 != this->write_pages)) {
+        cpu.mem.set_traps(this->read_pages, this->write_pages, mem_trap, this);
+        this->traps_installed = true;
+    }
+    if (this->num_io_bits > 0) {
+        cpu.io_trap = io_trap;
+        cpu.io_trap_userdata = this;
+        this->traps_installed = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::end_run(z80& cpu) {
+    if (this->traps_installed) {
+        cpu.mem.set_traps(0, 0, nullptr, nullptr);
+        cpu.io_trap = nullptr;
+        cpu.io_trap_userdata = nullptr;
+        this->traps_installed = false;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+z80dbg::single_step_block(uword pc) const {
+    // a block instruction must stop after each iteration at a breakpoint
+    // on the instruction, and after each watched memory access
+    if (this->suspended) {
+        return false;
+    }
+    return test_bit(this->bits.pc, pc) || (0 != this->read_pages) || (0 != this->write_pages);
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::mem_trap(void* userdata, uword addr, bool write) {
+    z80dbg* self = (z80dbg*) userdata;
+    if (test_bit(write ? self->bits.write : self->bits.read, addr)) {
+        self->hit(write ? break_mem_write : break_mem_read, addr);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::io_trap(void* userdata, uword port, bool out) {
+    z80dbg* self = (z80dbg*) userdata;
+    if (test_bit(out ? self->out_bits : self->in_bits, port & 0xFF)) {
+        self->hit(out ? break_io_out : break_io_in, port);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::hit(break_type type, uword addr) {
+    // only the first hit during an instruction is recorded
+    if (break_none == this->pending_type) {
+        this->pending_type = type;
+        this->pending_addr = addr;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::set_bit(uint32_t* bits, int index, bool b) {
+    if (b) {
+        bits[index>>5] |= (1U<<(index & 31));
+    }
+    else {
+        bits[index>>5] &= ~(1U<<(index & 31));
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+z80dbg::test_bit(const uint32_t* bits, int index) {
+    // the address bitmaps don't exist before the first breakpoint or watchpoint
+    return bits && (0 != (bits[index>>5] & (1U<<(index & 31))));
+}
+
 //------------------------------------------------------------------------------
 void
 z80dbg::store_pc_history(const z80& cpu) {
@@ -43,15 +191,20 @@ z80dbg::get_pc_history(int index) const {
 void
 z80dbg::enable_breakpoint(int index, uword addr) {
     YAKC_ASSERT((index >= 0) && (index < max_breakpoints));
+    this->disable_breakpoint(index);
     this->breakpoints[index].enabled = true;
     this->breakpoints[index].address = addr;
+    this->add_breakpoint(addr);
 }
 
 //------------------------------------------------------------------------------
 void
 z80dbg::disable_breakpoint(int index) {
     YAKC_ASSERT((index >= 0) && (index < max_breakpoints));
-    this->breakpoints[index].enabled = false;
+    if (this->breakpoints[index].enabled) {
+        this->breakpoints[index].enabled = false;
+        this->remove_breakpoint(this->breakpoints[index].address);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -59,7 +212,12 @@ void
 z80dbg::toggle_breakpoint(int index, uword addr) {
     YAKC_ASSERT((index >= 0) && (index < max_breakpoints));
     if (this->breakpoints[index].address == addr) {
-        this->breakpoints[index].enabled = !this->breakpoints[index].enabled;
+        if (this->breakpoints[index].enabled) {
+            this->disable_breakpoint(index);
+        }
+        else {
+            this->enable_breakpoint(index, addr);
+        }
     }
     else {
         this->enable_breakpoint(index, addr);
@@ -69,12 +227,7 @@ z80dbg::toggle_breakpoint(int index, uword addr) {
 //------------------------------------------------------------------------------
 bool
 z80dbg::is_breakpoint(uword addr) const {
-    for (int i = 0; i < max_breakpoints; i++) {
-        if ((this->breakpoints[i].enabled) && (this->breakpoints[i].address == addr)) {
-            return true;
-        }
-    }
-    return false;
+    return test_bit(this->bits.pc, addr);
 }
 
 //------------------------------------------------------------------------------
@@ -91,6 +244,253 @@ z80dbg::breakpoint_addr(int index) const {
     return this->breakpoints[index].address;
 }
 
+//------------------------------------------------------------------------------
+void
+z80dbg::add_breakpoint(uword addr) {
+    this->bits.alloc(this->funcs);
+    if (!test_bit(this->bits.pc, addr)) {
+        set_bit(this->bits.pc, addr, true);
+        this->num_pc_bits++;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::remove_breakpoint(uword addr) {
+    if (test_bit(this->bits.pc, addr)) {
+        set_bit(this->bits.pc, addr, false);
+        this->num_pc_bits--;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::clear_breakpoints() {
+    if (this->bits.pc) {
+        clear(this->bits.pc, num_addr_words * sizeof(uint32_t));
+    }
+    this->num_pc_bits = 0;
+    for (auto& bp : this->breakpoints) {
+        bp.enabled = false;
+    }
+}
+
+//------------------------------------------------------------------------------
+int
+z80dbg::num_breakpoints() const {
+    return this->num_pc_bits;
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::add_watchpoint(uword addr, int size, int mode) {
+    YAKC_ASSERT((size > 0) && (size <= (1<<16)));
+    this->bits.alloc(this->funcs);
+    for (int i = 0; i < size; i++) {
+        const uword a = addr + i;
+        if (mode & access_read) {
+            set_bit(this->bits.read, a, true);
+        }
+        if (mode & access_write) {
+            set_bit(this->bits.write, a, true);
+        }
+    }
+    this->update_watch_pages(addr, size);
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::remove_watchpoint(uword addr, int size, int mode) {
+    YAKC_ASSERT((size > 0) && (size <= (1<<16)));
+    if (nullptr == this->bits.pc) {
+        return;
+    }
+    for (int i = 0; i < size; i++) {
+        const uword a = addr + i;
+        if (mode & access_read) {
+            set_bit(this->bits.read, a, false);
+        }
+        if (mode & access_write) {
+            set_bit(this->bits.write, a, false);
+        }
+    }
+    this->update_watch_pages(addr, size);
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::clear_watchpoints() {
+    if (this->bits.pc) {
+        clear(this->bits.read, 2 * num_addr_words * sizeof(uint32_t));
+    }
+    this->read_pages = 0;
+    this->write_pages = 0;
+}
+
+//------------------------------------------------------------------------------
+bool
+z80dbg::is_watchpoint(uword addr, int mode) const {
+    return ((mode & access_read) && test_bit(this->bits.read, addr)) ||
+           ((mode & access_write) && test_bit(this->bits.write, addr));
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::update_watch_pages(uword addr, int size) {
+    // a page is trapped if any address in it is watched
+    const int words_per_page = memory::page::size / 32;
+    const int first_page = addr >> memory::page::shift;
+    const int num_pages = ((addr & memory::page::mask) + size + memory::page::mask) >> memory::page::shift;
+    for (int i = 0; i < num_pages; i++) {
+        const int page_index = (first_page + i) % memory::num_pages;
+        const uint64_t bit = uint64_t(1)<<page_index;
+        uint32_t r = 0, w = 0;
+        for (int word = 0; word < words_per_page; word++) {
+            r |= this->bits.read[page_index * words_per_page + word];
+            w |= this->bits.write[page_index * words_per_page + word];
+        }
+        this->read_pages = r ? (this->read_pages | bit) : (this->read_pages & ~bit);
+        this->write_pages = w ? (this->write_pages | bit) : (this->write_pages & ~bit);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::add_io_breakpoint(ubyte port, int mode) {
+    if ((mode & access_read) && !test_bit(this->in_bits, port)) {
+        set_bit(this->in_bits, port, true);
+        this->num_io_bits++;
+    }
+    if ((mode & access_write) && !test_bit(this->out_bits, port)) {
+        set_bit(this->out_bits, port, true);
+        this->num_io_bits++;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::remove_io_breakpoint(ubyte port, int mode) {
+    if ((mode & access_read) && test_bit(this->in_bits, port)) {
+        set_bit(this->in_bits, port, false);
+        this->num_io_bits--;
+    }
+    if ((mode & access_write) && test_bit(this->out_bits, port)) {
+        set_bit(this->out_bits, port, false);
+        this->num_io_bits--;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::clear_io_breakpoints() {
+    memset(this->in_bits, 0, sizeof(this->in_bits));
+    memset(this->out_bits, 0, sizeof(this->out_bits));
+    this->num_io_bits = 0;
+}
+
+//------------------------------------------------------------------------------
+bool
+z80dbg::is_io_breakpoint(ubyte port, int mode) const {
+    return ((mode & access_read) && test_bit(this->in_bits, port)) ||
+           ((mode & access_write) && test_bit(this->out_bits, port));
+}
+
+//------------------------------------------------------------------------------
+bool
+z80dbg::set_condition(break_type type, uword addr, const char* expr, int ignore_count) {
+    YAKC_ASSERT((type != break_none) && (ignore_count >= 0));
+    this->condition_error = nullptr;
+    z80expr compiled;
+    if (expr && *expr && !compiled.compile(expr)) {
+        this->condition_error = compiled.error;
+        return false;
+    }
+    int index = this->find_condition(type, addr);
+    if (index < 0) {
+        if (this->num_conditions >= max_conditions) {
+            this->condition_error = "too many conditions";
+            return false;
+        }
+        index = this->num_conditions++;
+    }
+    condition& cond = this->conditions[index];
+    cond.type = type;
+    cond.addr = ((break_io_in == type) || (break_io_out == type)) ? (addr & 0xFF) : addr;
+    cond.expr = compiled;
+    cond.ignore_count = ignore_count;
+    cond.hits = 0;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::remove_condition(break_type type, uword addr) {
+    const int index = this->find_condition(type, addr);
+    if (index >= 0) {
+        // keep the conditions packed
+        this->conditions[index] = this->conditions[--this->num_conditions];
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::clear_conditions() {
+    this->num_conditions = 0;
+}
+
+//------------------------------------------------------------------------------
+bool
+z80dbg::has_condition(break_type type, uword addr) const {
+    return this->find_condition(type, addr) >= 0;
+}
+
+//------------------------------------------------------------------------------
+int
+z80dbg::hit_count(break_type type, uword addr) const {
+    const int index = this->find_condition(type, addr);
+    return (index >= 0) ? this->conditions[index].hits : 0;
+}
+
+//------------------------------------------------------------------------------
+void
+z80dbg::reset_hit_counts() {
+    for (int i = 0; i < this->num_conditions; i++) {
+        this->conditions[i].hits = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+int
+z80dbg::find_condition(break_type type, uword addr) const {
+    // I/O breakpoints only look at the low byte of the port number
+    if ((break_io_in == type) || (break_io_out == type)) {
+        addr &= 0xFF;
+    }
+    for (int i = 0; i < this->num_conditions; i++) {
+        if ((this->conditions[i].type == type) && (this->conditions[i].addr == addr)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+bool
+z80dbg::condition_met(break_type type, uword addr, const z80& cpu, uint64_t cycle_count) {
+    if (0 == this->num_conditions) {
+        return true;
+    }
+    const int index = this->find_condition(type, addr);
+    if (index < 0) {
+        return true;
+    }
+    condition& cond = this->conditions[index];
+    if (cond.expr.is_valid() && (0 == cond.expr.eval(cpu, cycle_count))) {
+        return false;
+    }
+    return ++cond.hits > cond.ignore_count;
+}
+
 //------------------------------------------------------------------------------
 void
 z80dbg::step_pc_modified(z80& cpu) {
@@ -3,9 +3,35 @@
 /**
     @class YAKC::z80dbg
     @brief debug helper functions
+
+    PC breakpoints are stored in a 64K-entry bitmap, so that checking
+    for a breakpoint before each instruction doesn't depend on the
+    number of breakpoints. The 2 indexed breakpoints are shortcuts for
+    the debugger UI, they set and clear bits in the same bitmap. The
+    PC and memory watchpoint bitmaps are allocated when the first
+    breakpoint or watchpoint is set.
+
+    Memory watchpoints trap reads and/or writes on the affected memory
+    pages only, and I/O breakpoints trap IN/OUT on the low byte of the
+    port number. The traps are installed in the CPU by begin_run() and
+    removed by end_run(), so that memory accesses from outside the
+    emulation (e.g. the debugger UI) don't trigger them. A watchpoint
+    or I/O breakpoint hit stops before the next instruction.
+
+    Breakpoints, watchpoints and I/O breakpoints can have a condition
+    (see z80expr) and an ignore count. The condition is only evaluated
+    when its trigger fires, so conditions don't slow down the emulation
+    loop. A triggered breakpoint counts as hit when its condition is
+    true, and only stops after the first ignore_count hits.
+
+    With stop_on_break cleared, hits are only recorded in break_reason,
+    break_addr and break_cycle but don't stop the emulation, this is
+    used to search for breakpoint hits when replaying the past (see
+    reverser).
 */
 #include "yakc/core.h"
 #include "yakc/z80.h"
+#include "yakc/z80expr.h"
 
 namespace YAKC {
 
@@ -21,6 +47,22 @@ public:
         num
     };
 
+    /// memory watchpoint and I/O breakpoint access modes
+    enum access {
+        access_read = (1<<0),
+        access_write = (1<<1),
+        access_rw = access_read|access_write,
+    };
+    /// what caused the last break
+    enum break_type {
+        break_none = 0,
+        break_pc,
+        break_mem_read,
+        break_mem_write,
+        break_io_in,
+        break_io_out,
+    };
+
     /// size of PC history ringbuffer (must be 2^N!)
     static const int pc_history_size = 8;
     /// current pc history position
@@ -29,12 +71,32 @@ public:
     uword pc_history[pc_history_size];
     /// execution paused (e.g. because in debugger)
     bool paused;
+    /// reason for the last break
+    break_type break_reason = break_none;
+    /// PC, memory address or port of the last break
+    uword break_addr = 0;
+    /// cycle count of the last break
+    uint64_t break_cycle = 0;
+    /// stop the emulation when a breakpoint is hit
+    bool stop_on_break = true;
+    /// ignore all breakpoints and watchpoints (see quietscope)
+    bool suspended = false;
+    /// memory allocation functions (default is the C runtime)
+    ext_funcs funcs;
+    /// error message of the last failed set_condition()
+    const char* condition_error = nullptr;
 
     /// constructor
     z80dbg();
 
-    /// test whether breakpoint is enabled and hit
-    bool check_break(const z80& cpu) const;
+    /// test whether a breakpoint or watchpoint was hit, called before each instruction
+    bool check_break(const z80& cpu, uint64_t cycle_count);
+    /// install watchpoint and I/O breakpoint traps before running the CPU
+    void begin_run(z80& cpu);
+    /// remove the traps after running the CPU
+    void end_run(z80& cpu);
+    /// return true if block instructions at pc must run one iteration per step
+    bool single_step_block(uword pc) const;
     /// store current pc in history ringbuffer
     void store_pc_history(const z80& cpu);
     /// get pc from history ringbuffer (0 is oldest entry)
@@ -53,6 +115,46 @@ public:
     /// get breakpoint address
     uword breakpoint_addr(int index) const;
 
+    /// add a PC breakpoint
+    void add_breakpoint(uword addr);
+    /// remove a PC breakpoint
+    void remove_breakpoint(uword addr);
+    /// remove all PC breakpoints
+    void clear_breakpoints();
+    /// get number of PC breakpoints
+    int num_breakpoints() const;
+
+    /// add a memory watchpoint for an address range (access_read, access_write or access_rw)
+    void add_watchpoint(uword addr, int size, int mode);
+    /// remove a memory watchpoint for an address range
+    void remove_watchpoint(uword addr, int size, int mode);
+    /// remove all memory watchpoints
+    void clear_watchpoints();
+    /// test if an address is watched
+    bool is_watchpoint(uword addr, int mode) const;
+
+    /// add an I/O breakpoint on the low byte of a port number
+    void add_io_breakpoint(ubyte port, int mode);
+    /// remove an I/O breakpoint
+    void remove_io_breakpoint(ubyte port, int mode);
+    /// remove all I/O breakpoints
+    void clear_io_breakpoints();
+    /// test if a port has an I/O breakpoint
+    bool is_io_breakpoint(ubyte port, int mode) const;
+
+    /// set condition (may be nullptr) and ignore count of a trigger (break_pc, break_mem_read, ...)
+    bool set_condition(break_type type, uword addr, const char* expr, int ignore_count);
+    /// remove the condition of a trigger
+    void remove_condition(break_type type, uword addr);
+    /// remove all conditions
+    void clear_conditions();
+    /// test if a trigger has a condition
+    bool has_condition(break_type type, uword addr) const;
+    /// get number of hits of a trigger with a condition
+    int hit_count(break_type type, uword addr) const;
+    /// reset the hit counts of all conditions
+    void reset_hit_counts();
+
     /// step until PC changed (or an invalid opcode is hit)
     void step_pc_modified(z80& cpu);
 
@@ -68,12 +170,68 @@ public:
     static const char* reg_name(reg r);
 
 private:
+    /// memory trap callback
+    static void mem_trap(void* userdata, uword addr, bool write);
+    /// I/O trap callback
+    static void io_trap(void* userdata, uword port, bool out);
+    /// record a watchpoint or I/O breakpoint hit
+    void hit(break_type type, uword addr);
+    /// record a break, return true if the emulation should stop
+    bool stop(break_type type, uword addr, uint64_t cycle_count);
+    /// find the condition index of a trigger, or -1
+    int find_condition(break_type type, uword addr) const;
+    /// evaluate the condition of a trigger, true if the trigger should stop
+    bool condition_met(break_type type, uword addr, const z80& cpu, uint64_t cycle_count);
+    /// recompute the trapped memory pages of a watched address range
+    void update_watch_pages(uword addr, int size);
+
+    /// set, clear and test a bit in a bitmap
+    static void set_bit(uint32_t* bits, int index, bool b);
+    static bool test_bit(const uint32_t* bits, int index);
+
     static const int max_breakpoints = 2;
     struct breakpoint {
         breakpoint() : enabled(false), address(0) {};
         bool enabled;
         uword address;
     } breakpoints[max_breakpoints];
+
+    static const int max_conditions = 16;
+    struct condition {
+        break_type type = break_none;
+        uword addr = 0;
+        z80expr expr;
+        int ignore_count = 0;
+        int hits = 0;
+    } conditions[max_conditions];
+    int num_conditions = 0;
+
+    static const int num_addr_words = (1<<16) / 32;
+    /// the PC, read and write address bitmaps, copied with the z80dbg
+    struct addr_bitmaps {
+        ext_funcs funcs;
+        uint32_t* pc = nullptr;
+        uint32_t* read = nullptr;
+        uint32_t* write = nullptr;
+
+        addr_bitmaps() { };
+        addr_bitmaps(const addr_bitmaps& rhs);
+        addr_bitmaps& operator=(const addr_bitmaps& rhs);
+        ~addr_bitmaps();
+        /// allocate cleared bitmaps if not happened yet
+        void alloc(const ext_funcs& f);
+        /// free the bitmaps
+        void discard();
+    } bits;
+    uint32_t in_bits[256 / 32] = { };
+    uint32_t out_bits[256 / 32] = { };
+    int num_pc_bits = 0;
+    int num_io_bits = 0;
+    uint64_t read_pages = 0;
+    uint64_t write_pages = 0;
+    bool traps_installed = false;
+    break_type pending_type = break_none;
+    uword pending_addr = 0;
 };
 
 } // namespace YAKC
@@ -0,0 +1,323 @@
+//------------------------------------------------------------------------------
+//  z80expr.cc
+//------------------------------------------------------------------------------
+#include "z80expr.h"
+#include "z80dbg.h"
+#include <ctype.h>
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+bool
+z80expr::compile(const char* str) {
+    YAKC_ASSERT(str);
+    this->clear();
+    this->src = str;
+    bool ok = this->parse_binary(1);
+    if (ok) {
+        this->skip_space();
+        if (*this->src) {
+            ok = this->fail("unexpected character");
+        }
+    }
+    if (ok) {
+        ok = this->emit(op_end, 0);
+    }
+    if (!ok) {
+        const char* msg = this->error;
+        this->clear();
+        this->error = msg;
+    }
+    this->src = nullptr;
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+bool
+z80expr::is_valid() const {
+    return this->code_size > 0;
+}
+
+//------------------------------------------------------------------------------
+void
+z80expr::clear() {
+    this->code_size = 0;
+    this->depth = 0;
+    this->error = nullptr;
+}
+
+//------------------------------------------------------------------------------
+bool
+z80expr::fail(const char* msg) {
+    if (nullptr == this->error) {
+        this->error = msg;
+    }
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void
+z80expr::skip_space() {
+    while ((' ' == *this->src) || ('\t' == *this->src)) {
+        this->src++;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+z80expr::emit(ubyte b, int stack_delta) {
+    this->depth += stack_delta;
+    if (this->depth > max_stack_depth) {
+        return this->fail("expression too complex");
+    }
+    return this->emit_operand(b);
+}
+
+//------------------------------------------------------------------------------
+bool
+z80expr::emit_operand(ubyte b) {
+    if (this->code_size >= max_code_size) {
+        return this->fail("expression too long");
+    }
+    this->code[this->code_size++] = b;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+int
+z80expr::match_binary(op& out_op, int& out_len) const {
+    static const struct {
+        const char* str;
+        op code;
+        int prec;
+    } ops[] = {
+        // 2-character operators must come first
+        { "||", op_lor, 1 }, { "&&", op_land, 2 },
+        { "==", op_eq, 6 }, { "!=", op_ne, 6 },
+        { "<=", op_le, 7 }, { ">=", op_ge, 7 },
+        { "<<", op_shl, 8 }, { ">>", op_shr, 8 },
+        { "|", op_or, 3 }, { "^", op_xor, 4 }, { "&", op_and, 5 },
+        { "<", op_lt, 7 }, { ">", op_gt, 7 },
+        { "+", op_add, 9 }, { "-", op_sub, 9 },
+        { "*", op_mul, 10 },
+    };
+    for (const auto& o : ops) {
+        const int len = int(strlen(o.str));
+        if (0 == strncmp(this->src, o.str, len)) {
+            out_op = o.code;
+            out_len = len;
+            return o.prec;
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+bool
+z80expr::parse_binary(int min_prec) {
+    if (!this->parse_unary()) {
+        return false;
+    }
+    for (;;) {
+        this->skip_space();
+        op code;
+        int len;
+        const int prec = this->match_binary(code, len);
+        if ((0 == prec) || (prec < min_prec)) {
+            return true;
+        }
+        this->src += len;
+        // all binary operators are left-associative
+        if (!this->parse_binary(prec + 1)) {
+            return false;
+        }
+        if (!this->emit(code, -1)) {
+            return false;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+bool
+z80expr::parse_unary() {
+    this->skip_space();
+    op code;
+    switch (*this->src) {
+        case '!': code = op_not; break;
+        case '~': code = op_cpl; break;
+        case '-': code = op_neg; break;
+        default: return this->parse_primary();
+    }
+    this->src++;
+    return this->parse_unary() && this->emit(code, 0);
+}
+
+//------------------------------------------------------------------------------
+bool
+z80expr::parse_primary() {
+    this->skip_space();
+    const char c = *this->src;
+    if (('(' == c) || ('[' == c)) {
+        // (addr) is a memory read, [expr] is grouping
+        const char close = ('(' == c) ? ')' : ']';
+        this->src++;
+        if (!this->parse_binary(1)) {
+            return false;
+        }
+        this->skip_space();
+        if (close != *this->src) {
+            return this->fail(('(' == c) ? "missing ')'" : "missing ']'");
+        }
+        this->src++;
+        return ('(' == c) ? this->emit(op_mem8, 0) : true;
+    }
+    else if (('$' == c) || isdigit((unsigned char)c)) {
+        int base = 10;
+        if ('$' == c) {
+            base = 16;
+            this->src++;
+        }
+        else if (('0' == c) && (('x' == this->src[1]) || ('X' == this->src[1]))) {
+            base = 16;
+            this->src += 2;
+        }
+        if (!isxdigit((unsigned char)*this->src)) {
+            return this->fail("invalid number");
+        }
+        uint64_t val = 0;
+        for (;;) {
+            const char d = *this->src;
+            int v;
+            if (isdigit((unsigned char)d)) {
+                v = d - '0';
+            }
+            else if ((16 == base) && isxdigit((unsigned char)d)) {
+                v = (tolower((unsigned char)d) - 'a') + 10;
+            }
+            else if (isalpha((unsigned char)d)) {
+                return this->fail("invalid number");
+            }
+            else {
+                break;
+            }
+            val = val * base + v;
+            if (val > 0xFFFFFFFF) {
+                return this->fail("number too large");
+            }
+            this->src++;
+        }
+        if (val <= 0xFF) {
+            return this->emit(op_const8, 1) && this->emit_operand(ubyte(val));
+        }
+        else if (val <= 0xFFFF) {
+            return this->emit(op_const16, 1) &&
+                   this->emit_operand(ubyte(val)) && this->emit_operand(ubyte(val>>8));
+        }
+        else {
+            return this->emit(op_const32, 1) &&
+                   this->emit_operand(ubyte(val)) && this->emit_operand(ubyte(val>>8)) &&
+                   this->emit_operand(ubyte(val>>16)) && this->emit_operand(ubyte(val>>24));
+        }
+    }
+    else if (isalpha((unsigned char)c)) {
+        char name[8];
+        int len = 0;
+        while (isalnum((unsigned char)*this->src) || ('\'' == *this->src)) {
+            if (len >= int(sizeof(name)) - 1) {
+                return this->fail("unknown register");
+            }
+            name[len++] = toupper((unsigned char)*this->src++);
+        }
+        name[len] = 0;
+        if (0 == strcmp(name, "CYC")) {
+            return this->emit(op_cyc, 1);
+        }
+        for (int i = 0; i < z80dbg::num; i++) {
+            const z80dbg::reg r = z80dbg::reg(i);
+            if (0 == strcmp(name, z80dbg::reg_name(r))) {
+                const bool is8 = (r <= z80dbg::L) || (z80dbg::I == r) || (z80dbg::R == r) || (z80dbg::IM == r);
+                return this->emit(is8 ? op_reg8 : op_reg16, 1) && this->emit_operand(ubyte(r));
+            }
+        }
+        return this->fail("unknown register");
+    }
+    else {
+        return this->fail(c ? "unexpected character" : "unexpected end of expression");
+    }
+}
+
+//------------------------------------------------------------------------------
+int64_t
+z80expr::eval(const z80& cpu, uint64_t cycle_count) const {
+    YAKC_ASSERT(this->is_valid());
+    int64_t stack[max_stack_depth];
+    int sp = -1;
+    const ubyte* pc = this->code;
+    for (;;) {
+        const ubyte c = *pc++;
+        switch (c) {
+            case op_end:
+                return stack[0];
+            case op_const8:
+                stack[++sp] = pc[0];
+                pc += 1;
+                break;
+            case op_const16:
+                stack[++sp] = pc[0] | pc[1]<<8;
+                pc += 2;
+                break;
+            case op_const32:
+                stack[++sp] = uint32_t(pc[0] | pc[1]<<8 | pc[2]<<16 | uint32_t(pc[3])<<24);
+                pc += 4;
+                break;
+            case op_reg8:
+                stack[++sp] = z80dbg::get8(cpu, z80dbg::reg(*pc++));
+                break;
+            case op_reg16:
+                stack[++sp] = z80dbg::get16(cpu, z80dbg::reg(*pc++));
+                break;
+            case op_cyc:
+                stack[++sp] = int64_t(cycle_count);
+                break;
+            case op_mem8:
+                {
+                    const uword addr = uword(stack[sp]);
+                    stack[sp] = cpu.mem.ptr(addr)[addr & memory::page::mask];
+                }
+                break;
+            case op_not: stack[sp] = !stack[sp]; break;
+            case op_cpl: stack[sp] = ~stack[sp]; break;
+            case op_neg: stack[sp] = -stack[sp]; break;
+            default:
+                {
+                    // binary operators
+                    const int64_t r = stack[sp--];
+                    int64_t& l = stack[sp];
+                    switch (c) {
+                        case op_mul:  l = l * r; break;
+                        case op_add:  l = l + r; break;
+                        case op_sub:  l = l - r; break;
+                        case op_shl:  l = ((r >= 0) && (r < 64)) ? int64_t(uint64_t(l) << r) : 0; break;
+                        case op_shr:  l = ((r >= 0) && (r < 64)) ? (l >> r) : 0; break;
+                        case op_lt:   l = l < r; break;
+                        case op_le:   l = l <= r; break;
+                        case op_gt:   l = l > r; break;
+                        case op_ge:   l = l >= r; break;
+                        case op_eq:   l = l == r; break;
+                        case op_ne:   l = l != r; break;
+                        case op_and:  l = l & r; break;
+                        case op_xor:  l = l ^ r; break;
+                        case op_or:   l = l | r; break;
+                        case op_land: l = l && r; break;
+                        case op_lor:  l = l || r; break;
+                        default:
+                            YAKC_ASSERT(false);
+                            return 0;
+                    }
+                }
+                break;
+        }
+    }
+}
+
+} // namespace YAKC
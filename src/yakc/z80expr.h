@@ -0,0 +1,89 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class YAKC::z80expr
+    @brief compiled debugger condition expressions
+
+    An expression like "PC==0x0213 && A==0x1F && (IX+8)&1" is compiled
+    once into a compact stack-machine bytecode, which can then be
+    evaluated quickly whenever a breakpoint or watchpoint triggers.
+
+    Expression syntax (C-like operator precedence):
+
+    - numbers: decimal (123), hex (0x7B or $7B)
+    - registers: the names from z80dbg::reg_name() (A, HL, AF', IX, IM, ...)
+    - CYC: the current cycle count
+    - (expr): the byte at the memory address expr (Z80 assembler style)
+    - [expr]: grouping
+    - unary: ! ~ -
+    - binary: * + - << >> < <= > >= == != & ^ | && ||
+
+    Memory reads during evaluation bypass memory traps and copy-on-write
+    sharing, so that they don't trigger watchpoints.
+*/
+#include "yakc/core.h"
+#include "yakc/z80.h"
+
+namespace YAKC {
+
+class z80expr {
+public:
+    /// max size of the bytecode
+    static const int max_code_size = 64;
+    /// max evaluation stack depth
+    static const int max_stack_depth = 16;
+
+    /// compile an expression, return false on error
+    bool compile(const char* src);
+    /// return true if a valid expression has been compiled
+    bool is_valid() const;
+    /// evaluate the compiled expression
+    int64_t eval(const z80& cpu, uint64_t cycle_count) const;
+    /// reset to an invalid expression
+    void clear();
+
+    /// the bytecode, terminated with op_end
+    ubyte code[max_code_size];
+    /// number of valid bytecode bytes
+    int code_size = 0;
+    /// error message of the last failed compile()
+    const char* error = nullptr;
+
+    /// bytecode opcodes
+    enum op {
+        op_end = 0,
+        op_const8,      // 1 byte operand
+        op_const16,     // 2 byte operand
+        op_const32,     // 4 byte operand
+        op_reg8,        // 1 byte z80dbg::reg operand
+        op_reg16,       // 1 byte z80dbg::reg operand
+        op_cyc,
+        op_mem8,
+        op_not, op_cpl, op_neg,
+        op_mul, op_add, op_sub, op_shl, op_shr,
+        op_lt, op_le, op_gt, op_ge, op_eq, op_ne,
+        op_and, op_xor, op_or, op_land, op_lor,
+    };
+
+private:
+    /// parse a binary expression with operators of at least min_prec precedence
+    bool parse_binary(int min_prec);
+    /// parse a unary expression
+    bool parse_unary();
+    /// parse a number, register, memory access or grouping
+    bool parse_primary();
+    /// match a binary operator at the current position, return its precedence or 0
+    int match_binary(op& out_op, int& out_len) const;
+    /// skip whitespace
+    void skip_space();
+    /// append bytes to the bytecode, adjust the stack depth
+    bool emit(ubyte b, int stack_delta);
+    bool emit_operand(ubyte b);
+    /// set error message and return false
+    bool fail(const char* msg);
+
+    const char* src = nullptr;
+    int depth = 0;
+};
+
+} // namespace YAKC
@@ -12,8 +12,9 @@ static uint64_t kbd_bits(int col, int line) {
 
 //------------------------------------------------------------------------------
 void
-z9001::init(breadboard* b) {
+z9001::init(breadboard* b, const ext_funcs& funcs) {
     this->board = b;
+    this->funcs = funcs;
 
     // setup color palette (FIXME: fore- and background colors are identical?)
     this->pal[0] = 0xFF000000;     // black
@@ -142,11 +143,27 @@ z9001::poweron(device m, os_rom os) {
     this->keybuf.init(4);
 
     // map memory
-    clear(this->ram, sizeof(this->ram));
-    fill_random(this->color_ram, sizeof(this->color_ram));
-    fill_random(this->video_ram, sizeof(this->video_ram));
+    this->update_buffers();
+    clear(this->ram, ram_size);
+    fill_random(this->color_ram, color_ram_size);
+    fill_random(this->video_ram, video_ram_size);
     this->init_memory_mapping();
 
+    // the memory banks for the execution coverage
+    coverage& cov = this->board->cov;
+    cov.clear_banks();
+    if (device::z9001 == m) {
+        cov.add_bank("ram", 0x0000, this->ram, 0x8000);
+        cov.add_bank("basic", 0xC000, dump_basic_507_511, 0x2800);
+        cov.add_bank("os12_1", 0xF000, dump_z9001_os12_1, 0x0800);
+        cov.add_bank("os12_2", 0xF800, dump_z9001_os12_2, 0x0800);
+    }
+    else {
+        cov.add_bank("ram", 0x0000, this->ram, 0xC000);
+        cov.add_bank("basic", 0xC000, dump_z9001_basic, 0x2000);
+        cov.add_bank("kc87_os_2", 0xE000, dump_kc87_os_2, 0x2000);
+    }
+
     // initialize the clock at 2.4576 MHz
     this->board->clck.init(2458);
 
@@ -179,7 +196,30 @@ void
 z9001::poweroff() {
     YAKC_ASSERT(this->on);
     this->board->cpu.mem.unmap_all();
-    this->on = false;    
+    this->board->cov.clear_banks();
+    this->on = false;
+    this->update_buffers();
+}
+
+//------------------------------------------------------------------------------
+void
+z9001::update_buffers() {
+    if (this->on && !this->ram) {
+        // RAM, video memory and the RGBA8 buffer live in one chunk
+        ubyte* ptr = (ubyte*) YAKC_MALLOC(this->funcs, ram_size + color_ram_size + video_ram_size + rgba8_buffer_size);
+        this->ram = ptr;
+        this->color_ram = ptr + ram_size;
+        this->video_ram = ptr + ram_size + color_ram_size;
+        this->rgba8_buffer = (uint32_t*) (ptr + ram_size + color_ram_size + video_ram_size);
+        clear(this->rgba8_buffer, rgba8_buffer_size);
+    }
+    else if (!this->on && this->ram) {
+        YAKC_FREE(this->funcs, this->ram);
+        this->ram = nullptr;
+        this->color_ram = nullptr;
+        this->video_ram = nullptr;
+        this->rgba8_buffer = nullptr;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -199,12 +239,17 @@ z9001::reset() {
 //------------------------------------------------------------------------------
 void
 z9001::onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, uint64_t max_cycle_count) {
-    // FIXME: the speed multiplier isn't currently working because of the min/max cycle count limiter!
     YAKC_ASSERT(speed_multiplier > 0);
     this->cpu_ahead = false;
     this->cpu_behind = false;    
     z80& cpu = this->board->cpu;
     z80dbg& dbg = this->board->dbg;
+    tracer& trace = this->board->trace;
+    profiler& prof = this->board->prof;
+    callgraph& calls = this->board->calls;
+    opstats& ops = this->board->ops;
+    frametimes& times = this->board->times;
+    coverage& cov = this->board->cov;
     z80ctc& ctc = this->board->ctc;
     clock& clk = this->board->clck;
 
@@ -223,22 +268,53 @@ z9001::onframe(int speed_multiplier, int micro_secs, uint64_t min_cycle_count, u
             abs_end_cycles = min_cycle_count;
             this->cpu_behind = true;
         }
+        this->end_cycle_count = abs_end_cycles;
+        dbg.begin_run(cpu);
+        calls.begin_run(cpu);
+        ops.begin_run(cpu);
+        cov.begin_run(cpu);
+        times.begin(frametimes::cpu);
         while (this->abs_cycle_count < abs_end_cycles) {
-            if (dbg.check_break(cpu)) {
+            if (dbg.check_break(cpu, this->abs_cycle_count)) {
                 dbg.paused = true;
                 this->overflow_cycles = 0;
                 break;
             }
             dbg.store_pc_history(cpu); // FIXME: only if debug window open?
+            if (trace.enabled) {
+                trace.record(cpu, this->abs_cycle_count);
+            }
+            const uword pc = cpu.PC;
             int cycles_step = cpu.step();
+            if (prof.enabled) {
+                prof.record(cpu.mem, pc, cycles_step);
+            }
+            if (calls.enabled) {
+                calls.record(cpu, pc, cycles_step);
+            }
             cycles_step += cpu.handle_irq();
+            const bool timed = times.sample(frametimes::clocks);
+            if (timed) {
+                times.begin(frametimes::clocks);
+            }
             clk.update(this, cycles_step);
             ctc.update_timers(this, cycles_step);
+            if (timed) {
+                times.end();
+            }
             this->abs_cycle_count += cycles_step;
         }
+        times.end();
+        dbg.end_run(cpu);
+        calls.end_run(cpu);
+        ops.end_run(cpu);
+        cov.end_run(cpu);
+        this->end_cycle_count = 0;
         this->overflow_cycles = uint32_t(this->abs_cycle_count - abs_end_cycles);
     }
+    times.begin(frametimes::video);
     this->decode_video();
+    times.end();
 }
 
 //------------------------------------------------------------------------------
@@ -412,6 +488,7 @@ z9001::ctc_write(int ctc_id, int chn_id) {
     // this is the same as in the KC85/3 emu
     z80ctc& ctc = this->board->ctc;
     if (0 == chn_id) {
+        this->board->times.begin(frametimes::audio);
         // has the CTC channel state changed since last time?
         const auto& ctc_chn = ctc.channels[0];
         if ((ctc_chn.constant != this->ctc0_constant) ||
@@ -437,6 +514,7 @@ z9001::ctc_write(int ctc_id, int chn_id) {
                 this->ctc0_mode = ctc_chn.mode;
             }
         }
+        this->board->times.end();
     }
 }
 
@@ -450,6 +528,29 @@ z9001::ctc_zcto(int ctc_id, int chn_id) {
     }
 }
 
+//------------------------------------------------------------------------------
+int
+z9001::block_cycles(uword pc) {
+    // block instructions only run in bulk inside onframe(), and must
+    // stop at breakpoints and watchpoints like when single-stepping, the
+    // memory access counters and the coverage also need each single access
+    if ((0 == this->end_cycle_count) ||
+        this->board->dbg.single_step_block(pc) ||
+        this->board->cpu.mem.instrumented()) {
+        return 0;
+    }
+    int64_t cycles = this->end_cycle_count - this->abs_cycle_count;
+    const int clk_cycles = this->board->clck.cycles_to_next_timer();
+    if (clk_cycles < cycles) {
+        cycles = clk_cycles;
+    }
+    const int ctc_cycles = this->board->ctc.ticks_to_next_timer();
+    if (ctc_cycles < cycles) {
+        cycles = ctc_cycles;
+    }
+    return int(cycles);
+}
+
 //------------------------------------------------------------------------------
 void
 z9001::irq() {
@@ -24,18 +24,23 @@ namespace YAKC {
 
 class z9001 : public z80bus {
 public:
-    /// system RAM
-    ubyte ram[4*0x4000];
-    /// color RAM (40x24 color attributes)
-    ubyte color_ram[0x400];
-    /// video RAM (40x24 characters)
-    ubyte video_ram[0x400];
+    /// system RAM (allocated at power-on)
+    ubyte* ram = nullptr;
+    static const int ram_size = 4*0x4000;
+    /// color RAM (40x24 color attributes, allocated at power-on)
+    ubyte* color_ram = nullptr;
+    static const int color_ram_size = 0x400;
+    /// video RAM (40x24 characters, allocated at power-on)
+    ubyte* video_ram = nullptr;
+    static const int video_ram_size = 0x400;
 
     /// the main board
     breadboard* board = nullptr;
+    /// memory allocation functions
+    ext_funcs funcs;
 
     /// one-time setup
-    void init(breadboard* board);
+    void init(breadboard* board, const ext_funcs& funcs);
     /// setup audio callbacks
     void setup_sound_funcs(const sound_funcs& funcs);
     /// init the memory map
@@ -45,6 +50,8 @@ public:
     void poweron(device m, os_rom os);
     /// power-off the device
     void poweroff();
+    /// allocate or free the RAM and video buffers to match the power state (called from poweron/poweroff or snapshot restore)
+    void update_buffers();
     /// reset the device
     void reset();
     /// get the Z1013 model
@@ -75,6 +82,8 @@ public:
     virtual void irq() override;
     /// clock timer triggered
     virtual void timer(int timer_id) override;
+    /// bulk block instruction callback
+    virtual int block_cycles(uword pc) override;
 
     /// put a key as ASCII code
     void put_key(ubyte ascii);
@@ -91,6 +100,7 @@ public:
     bool cpu_behind = false;
     uint64_t abs_cycle_count = 0;
     uint32_t overflow_cycles = 0;
+    uint64_t end_cycle_count = 0;
 
     keybuffer keybuf;
     uint64_t key_mask = 0;              // (column<<8)|line bits for currently pressed key
@@ -103,7 +113,8 @@ public:
     uint8_t brd_color = 0;              // border color byte extracted from PIO1-A
     uint32_t blink_counter = 0;
     uint32_t pal[8];
-    uint32_t rgba8_buffer[320*192];     // decoded linear RGBA8 video buffer
+    uint32_t* rgba8_buffer = nullptr;   // decoded linear RGBA8 video buffer (allocated at power-on)
+    static const int rgba8_buffer_size = 320*192*sizeof(uint32_t);
 
     sound_funcs sound_cb;               // external sound callbacks
     ubyte ctc0_mode = z80ctc::RESET;    // CTC0 state for audio output
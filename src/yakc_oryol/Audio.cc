@@ -25,6 +25,12 @@ Audio::Setup(const clock& clk) {
     this->audioSource.sample_rate = soloud->getBackendSamplerate();
     this->audioSource.cpu_clock_speed = clk.base_freq_khz * 1000;
     this->audioHandle = soloud->play(this->audioSource, 1.0f);
+
+    // the audio playback position advances in steps of the backend
+    // buffer size, so the CPU must run at least that much ahead
+    const float bufferSecs = float(soloud->getBackendBufferSize()) / float(soloud->getBackendSamplerate());
+    this->Sync.targetLead = bufferSecs + 0.015f;
+    this->Sync.lead = this->Sync.targetLead;
 }
 
 //------------------------------------------------------------------------------
@@ -47,7 +53,102 @@ Audio::Update(const clock& clk) {
 //------------------------------------------------------------------------------
 uint64_t
 Audio::GetProcessedCycles() const {
-    return this->audioSource.sample_cycle_count;
+    const uint64_t resync_cycle_count = this->audioSource.resync_cycle_count;
+    if (resync_cycle_count != 0) {
+        return resync_cycle_count;
+    }
+    else {
+        return this->audioSource.sample_cycle_count;
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+Audio::BeginWarp() {
+    o_assert_dbg(!this->warp);
+    this->warp = true;
+    // silence all channels, sound events will only be recorded in lastOp
+    AudioSource::op silence;
+    silence.cycle_pos = 0;
+    for (auto& chn : this->audioSource.channels) {
+        chn.reset(silence);
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+Audio::EndWarp(uint64_t cycle_count) {
+    o_assert_dbg(this->warp);
+    this->warp = false;
+    // continue playback at the current CPU position with the sound
+    // state that was active when warp mode was left
+    for (int i = 0; i < 2; i++) {
+        AudioSource::op op = this->lastOp[i];
+        op.cycle_pos = 0;
+        this->audioSource.channels[i].reset(op);
+    }
+    this->audioSource.resync_cycle_count = cycle_count;
+    this->Sync.lead = this->Sync.targetLead;
+    this->Sync.integral = 0.0f;
+    this->Sync.adjust = 0.0f;
+}
+
+//------------------------------------------------------------------------------
+bool
+Audio::InWarp() const {
+    return this->warp;
+}
+
+//------------------------------------------------------------------------------
+static float
+clampAdjust(float val, float maxVal) {
+    if (val < -maxVal) {
+        return -maxVal;
+    }
+    else if (val > maxVal) {
+        return maxVal;
+    }
+    else {
+        return val;
+    }
+}
+
+//------------------------------------------------------------------------------
+int
+Audio::RateControl(int micro_secs, uint64_t cpu_cycle_count, const clock& clk) {
+    // PI controller which keeps the CPU at a target distance ahead of
+    // the audio playback position by stretching or shrinking the emulated
+    // frame time by a few percent, instead of hard-clamping the CPU
+    // (audio pitch isn't affected since sound events are cycle-stamped)
+    const uint64_t audio_cycle_count = this->GetProcessedCycles();
+    if ((audio_cycle_count == 0) || (cpu_cycle_count == 0) || this->warp) {
+        return micro_secs;
+    }
+    rateControl& rc = this->Sync;
+    const float freq = float(clk.base_freq_khz) * 1000.0f;
+    const float lead = float(int64_t(cpu_cycle_count - audio_cycle_count)) / freq;
+    rc.lead += (lead - rc.lead) * rc.smoothing;
+    const float error = (rc.targetLead - rc.lead) / rc.targetLead;
+    rc.integral = clampAdjust(rc.integral + error * rc.ki, rc.maxAdjust);
+    rc.adjust = clampAdjust(error * rc.kp + rc.integral, rc.maxAdjust);
+    return int(float(micro_secs) * (1.0f + rc.adjust));
+}
+
+//------------------------------------------------------------------------------
+void
+Audio::CycleLimits(const clock& clk, uint64_t& out_min_cycle_count, uint64_t& out_max_cycle_count) const {
+    // the rate controller should keep the CPU well within these limits,
+    // they only kick in after hiccups (e.g. the app was suspended)
+    const uint64_t audio_cycle_count = this->GetProcessedCycles();
+    if (audio_cycle_count > 0) {
+        const uint64_t max_ahead_cycles = uint64_t(clk.base_freq_khz * 1000 * this->Sync.targetLead * 4.0f);
+        out_min_cycle_count = audio_cycle_count;
+        out_max_cycle_count = audio_cycle_count + max_ahead_cycles;
+    }
+    else {
+        out_min_cycle_count = 0;
+        out_max_cycle_count = 0;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -60,7 +161,10 @@ Audio::cb_sound(void* userdata, uint64_t cycle_pos, int channel, int hz) {
     op.cycle_pos = cycle_pos;
     op.hz = hz;
     op.vol = 0x1f;
-    self->audioSource.channels[channel].push(op);
+    self->lastOp[channel] = op;
+    if (!self->warp) {
+        self->audioSource.channels[channel].push(op);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -72,7 +176,10 @@ Audio::cb_stop(void* userdata, uint64_t cycle_pos, int channel) {
     op.cycle_pos = cycle_pos;
     op.hz = 0;
     op.vol = 0;
-    self->audioSource.channels[channel].push(op);
+    self->lastOp[channel] = op;
+    if (!self->warp) {
+        self->audioSource.channels[channel].push(op);
+    }
 }
 
 //------------------------------------------------------------------------------
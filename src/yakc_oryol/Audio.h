@@ -21,6 +21,16 @@ public:
     void Update(const clock& clk);
     /// get the current max processed audio sample count in number of CPU cycles
     uint64_t GetProcessedCycles() const;
+    /// enter warp mode, mutes audio output and ignores sound events
+    void BeginWarp();
+    /// leave warp mode, resync audio playback to a CPU cycle count
+    void EndWarp(uint64_t cycle_count);
+    /// return true if in warp mode
+    bool InWarp() const;
+    /// nudge the emulated frame time to keep the CPU at a constant distance ahead of audio playback
+    int RateControl(int micro_secs, uint64_t cpu_cycle_count, const clock& clk);
+    /// get safety min/max cycle counts for the emulator's onframe limiter
+    void CycleLimits(const clock& clk, uint64_t& out_min_cycle_count, uint64_t& out_max_cycle_count) const;
 
     /// callback to start sound or change frequency
     static void cb_sound(void* userdata, uint64_t cycle_count, int channel, int hz);
@@ -34,6 +44,20 @@ public:
     SoLoud::BiquadResonantFilter filter;
     AudioSource audioSource;
     int audioHandle = 0;
+    bool warp = false;
+    AudioSource::op lastOp[2];      // most recent sound event per channel
+
+    /// dynamic rate control state
+    struct rateControl {
+        float targetLead = 0.04f;   // target distance of CPU ahead of audio in seconds
+        float smoothing = 0.05f;    // low-pass factor for measured lead
+        float kp = 0.05f;           // proportional gain
+        float ki = 0.001f;          // integral gain
+        float maxAdjust = 0.05f;    // max relative frame time adjustment
+        float lead = 0.0f;          // smoothed measured lead in seconds
+        float integral = 0.0f;
+        float adjust = 0.0f;        // current relative frame time adjustment
+    } Sync;
 };
 
 } // namespace YAKC
@@ -9,6 +9,7 @@ namespace YAKC {
 //------------------------------------------------------------------------------
 AudioSource::AudioSource() {
     this->mChannels = 2;
+    this->resync_cycle_count = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -31,6 +32,13 @@ AudioSourceInstance::getAudio(float* aBuffer, unsigned int aSamples) {
 
     const int precision = 6;
 
+    // jump to a new CPU cycle position (e.g. after warp mode)?
+    const uint64_t resync_cycle_count = this->parent->resync_cycle_count;
+    if (resync_cycle_count != 0) {
+        this->parent->sample_cycle_count = resync_cycle_count;
+        this->parent->resync_cycle_count = 0;
+    }
+
     const uint64_t cpu_clock_speed = this->parent->cpu_clock_speed;
     const uint64_t sample_rate = this->parent->sample_rate;
     const uint64_t cycles_per_sample = ((cpu_clock_speed<<precision) / sample_rate);
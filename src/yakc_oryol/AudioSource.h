@@ -55,6 +55,15 @@ public:
             // always write a new 'infinity-op' past the newest write-pos
             this->ops[this->write_pos] = op();
         };
+        // drop all pending audio ops and continue with a new op (called from main thread)
+        void reset(const op& in_op) {
+            Oryol::ScopedWriteLock l(this->lock);
+            this->read_pos = 0;
+            this->write_pos = 1;
+            this->overflow = false;
+            this->ops[0] = in_op;
+            this->ops[1] = op();
+        };
         // get the current audio op (called from audio thread)
         void peek(op& out_op) {
             // called from audio-thread
@@ -75,9 +84,11 @@ public:
     #if ORYOL_HAS_ATOMIC
     std::atomic<uint32_t> cpu_clock_speed;
     std::atomic<uint64_t> sample_cycle_count;
+    std::atomic<uint64_t> resync_cycle_count;
     #else
     uint32_t cpu_clock_speed;
     uint64_t sample_cycle_count;
+    uint64_t resync_cycle_count;
     #endif
     uint32_t sample_rate = 44100;               // audio sample rate in Hz
     channel channels[2];
@@ -3,6 +3,7 @@
 //------------------------------------------------------------------------------
 #include "FileLoader.h"
 #include "Core/String/StringBuilder.h"
+#include "yakc/reverser.h"
 
 using namespace Oryol;
 
@@ -166,6 +167,10 @@ FileLoader::parseHeader(const Buffer& data, const Item& item) {
 void
 FileLoader::copy(yakc* emu, const FileInfo& info, const Buffer& data) {
     if (!info.FileSizeError) {
+        // the loaded file isn't part of the reverse debugger's history
+        if (emu->reverse_debugger) {
+            emu->reverse_debugger->clear();
+        }
         const ubyte* payload = data.Data() + info.PayloadOffset;
         if (FileType::TAP != info.Type) {
             // KCC, Z80 and BIN file type payload is simply a continuous block of data
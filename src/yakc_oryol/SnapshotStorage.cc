@@ -6,22 +6,31 @@
 namespace YAKC {
 
 //------------------------------------------------------------------------------
-SnapshotStorage::SnapshotStorage() {
-    memset(&this->snapshots, 0, sizeof(this->snapshots));
+SnapshotStorage::~SnapshotStorage() {
+    for (auto& buf : this->snapshots) {
+        buf.discard();
+    }
 }
 
 //------------------------------------------------------------------------------
-void
-SnapshotStorage::TakeSnapshot(const yakc& emu, int slotIndex) {
+bool
+SnapshotStorage::TakeSnapshot(yakc& emu, int slotIndex) {
     YAKC_ASSERT((slotIndex >= 0) && (slotIndex < MaxNumSnapshots));
-    snapshot::take_snapshot(emu, this->snapshots[slotIndex]);
+    snapshot::membuf& buf = this->snapshots[slotIndex];
+    buf.discard();
+    if (!snapshot::write_stream(emu, snapshot::membuf::write, &buf)) {
+        // don't keep a broken snapshot around
+        buf.discard();
+        return false;
+    }
+    return true;
 }
 
 //------------------------------------------------------------------------------
 bool
 SnapshotStorage::HasSnapshot(int slotIndex) const {
     YAKC_ASSERT((slotIndex >= 0) && (slotIndex < MaxNumSnapshots));
-    return snapshot::is_snapshot(this->snapshots[slotIndex]);
+    return this->snapshots[slotIndex].size > 0;
 }
 
 //------------------------------------------------------------------------------
@@ -36,10 +45,12 @@ SnapshotStorage::HasSnapshots() const {
 }
 
 //------------------------------------------------------------------------------
-void
+bool
 SnapshotStorage::ApplySnapshot(int slotIndex, yakc& emu) {
     YAKC_ASSERT((slotIndex >= 0) && (slotIndex < MaxNumSnapshots));
-    snapshot::apply_snapshot(this->snapshots[slotIndex], emu);
+    snapshot::membuf& buf = this->snapshots[slotIndex];
+    buf.pos = 0;
+    return snapshot::read_stream(snapshot::membuf::read, &buf, emu);
 }
 
 } // namespace YAKC
@@ -3,6 +3,8 @@
 /**
     @class YAKC::SnapshotStorage
     @brief simple class to store machine state snapshots
+
+    Snapshots are kept in memory in the compressed snapshot format.
 */
 #include "yakc/yakc.h"
 #include "yakc/snapshot.h"
@@ -14,18 +16,18 @@ public:
     /// max number of snapshots
     static const int MaxNumSnapshots = 4;
 
-    /// constructor
-    SnapshotStorage();
-    /// take a snapshot
-    void TakeSnapshot(const yakc& emu, int slotIndex);
+    /// destructor
+    ~SnapshotStorage();
+    /// take a snapshot, returns false and leaves the slot empty on error
+    bool TakeSnapshot(yakc& emu, int slotIndex);
     /// test if any valid snapshots exist
     bool HasSnapshots() const;
     /// test if a snapshot slot contains a snapshot
     bool HasSnapshot(int slotIndex) const;
-    /// apply a snapshot
-    void ApplySnapshot(int slotIndex, yakc& emu);
+    /// apply a snapshot, returns false if the snapshot is invalid
+    bool ApplySnapshot(int slotIndex, yakc& emu);
 
-    snapshot::state_t snapshots[MaxNumSnapshots];
+    snapshot::membuf snapshots[MaxNumSnapshots];
 };
 
 } // namespace YAKC
@@ -52,6 +52,9 @@ AudioWindow::Draw(yakc& emu) {
         else {
             ImGui::TextColored(UI::OkColor, "CPU SYNCED");
         }
+        ImGui::Text("CPU ahead of audio: %.1f ms (target %.1f ms), rate adjust: %+.2f%%",
+            this->audio->Sync.lead * 1000.0f, this->audio->Sync.targetLead * 1000.0f,
+            this->audio->Sync.adjust * 100.0f);
         for (int chn=0; chn<2; chn++) {
             if (this->audio->audioSource.channels[chn].overflow) {
                 ImGui::TextColored(UI::WarnColor, "*** CHANNEL %d: RINGBUFFER OVERFLOW***", chn);
@@ -5,6 +5,7 @@
 #include "IMUI/IMUI.h"
 #include "yakc_ui/UI.h"
 #include "yakc_oryol/Disasm.h"
+#include "yakc/reverser.h"
 
 using namespace Oryol;
 
@@ -54,6 +55,9 @@ void
 DebugWindow::drawReg16(yakc& emu, z80dbg::reg r) {
     if (this->regWidget[r].Draw()) {
         z80dbg::set16(emu.board.cpu, r, this->regWidget[r].Get16());
+        if (emu.reverse_debugger) {
+            emu.reverse_debugger->clear();
+        }
     }
     else {
         this->regWidget[r].Set16(z80dbg::get16(emu.board.cpu, r));
@@ -65,6 +69,9 @@ void
 DebugWindow::drawReg8(yakc& emu, z80dbg::reg r) {
     if (this->regWidget[r].Draw()) {
         z80dbg::set8(emu.board.cpu, r, this->regWidget[r].Get8());
+        if (emu.reverse_debugger) {
+            emu.reverse_debugger->clear();
+        }
     }
     else {
         this->regWidget[r].Set8(z80dbg::get8(emu.board.cpu, r));
@@ -136,20 +143,46 @@ DebugWindow::drawControls(yakc& emu) {
     }
     ImGui::SameLine();
     ImGui::Checkbox("break", &emu.board.dbg.paused);
+    reverser* rv = emu.reverse_debugger;
     if (emu.board.dbg.paused) {
         ImGui::SameLine();
         if (ImGui::Button("step")) {
-            emu.board.dbg.step_pc_modified(emu.board.cpu);
+            if (rv) {
+                // a machine-exact step, which can be stepped back
+                rv->step(emu);
+            }
+            else {
+                emu.board.dbg.step_pc_modified(emu.board.cpu);
+            }
+        }
+        if (rv) {
+            ImGui::SameLine();
+            if (ImGui::Button("step back")) {
+                rv->step_back(emu);
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("reverse")) {
+                rv->reverse_continue(emu);
+            }
         }
     }
     ImGui::Checkbox("break on invalid opcode", &emu.board.cpu.break_on_invalid_opcode);
+    if (rv) {
+        // shorter intervals need more memory, but step back faster
+        ImGui::PushItemWidth(128);
+        ImGui::SliderInt("checkpoint interval", &rv->checkpoint_interval, 1, 250, "%.0f frames");
+        ImGui::PopItemWidth();
+        ImGui::SameLine();
+        ImGui::Text("%d checkpoints (%d KBytes)", rv->num_checkpoints(), rv->num_bytes() / 1024);
+    }
 }
 
 //------------------------------------------------------------------------------
 void
 DebugWindow::drawMainContent(yakc& emu, uword start_addr, int num_lines) {
     // this is a modified version of ImGuiMemoryEditor.h
-    ImGui::BeginChild("##scrolling", ImVec2(0, -2 * ImGui::GetItemsLineHeightWithSpacing()));
+    const int num_control_lines = emu.reverse_debugger ? 3 : 2;
+    ImGui::BeginChild("##scrolling", ImVec2(0, -num_control_lines * ImGui::GetItemsLineHeightWithSpacing()));
 
     ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(0,0));
     ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(1,1));
@@ -19,10 +19,60 @@ bool
 InfoWindow::Draw(yakc& emu) {
     ImGui::SetNextWindowSize(ImVec2(540, 440), ImGuiSetCond_Once);
     if (ImGui::Begin(this->title.AsCStr(), &this->Visible, ImGuiWindowFlags_ShowBorders)) {
-        ImGui::TextWrapped("%s", emu.system_info());
+        if (ImGui::CollapsingHeader("System", "#system", true, true)) {
+            ImGui::TextWrapped("%s", emu.system_info());
+        }
+        if (ImGui::CollapsingHeader("Frame Times", "#frametimes", true, false)) {
+            this->drawFrameTimes(emu);
+        }
     }
     ImGui::End();
     return this->Visible;
 }
 
+//------------------------------------------------------------------------------
+void
+InfoWindow::drawFrameTimes(yakc& emu) {
+    frametimes& times = emu.board.times;
+    bool enabled = times.enabled;
+    if (ImGui::Checkbox("Enabled", &enabled)) {
+        // switching inside the UI section leaves it unbalanced
+        times.reset();
+        times.enabled = enabled;
+    }
+    ImGui::SameLine();
+    if (!times.capturing()) {
+        if (ImGui::Button("Capture Trace")) {
+            times.enabled = true;
+            times.start_capture(MaxTraceEvents);
+            this->saveFailed = false;
+        }
+    }
+    else {
+        if (ImGui::Button("Stop and Save")) {
+            times.stop_capture();
+            this->saveFailed = !times.write_trace_file("yakc_frametimes.json");
+        }
+        ImGui::SameLine();
+        ImGui::Text("%d/%d events", times.num_events(), MaxTraceEvents);
+    }
+    if (this->saveFailed) {
+        ImGui::Text("failed to write yakc_frametimes.json");
+    }
+
+    // oldest frame first
+    const int num_frames = times.num_frames();
+    for (int s = 0; s < frametimes::num_sections; s++) {
+        float values[frametimes::history_size] = { };
+        for (int i = 0; i < num_frames; i++) {
+            values[frametimes::history_size - 1 - i] = times.get_ns(i, s) / 1000000.0f;
+        }
+        const int calls = num_frames > 0 ? times.get_calls(0, s) : 0;
+        ImGui::Text("%-8s %6.3fms %6d calls", frametimes::section_name(s), times.average_ns(s) / 1000000.0f, calls);
+        ImGui::PushID(s);
+        ImGui::PlotHistogram("##histogram", values, frametimes::history_size, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 30));
+        ImGui::PopID();
+    }
+}
+
 } // namespace YAKC
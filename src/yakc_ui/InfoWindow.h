@@ -3,6 +3,9 @@
 /**
     @class YAKC::InfoWindow
     @brief show quick info about currently emulated system
+
+    Also shows the host frame times of the emulator subsystems (see
+    YAKC::frametimes) and captures them as a Chrome trace.
 */
 #include "yakc_ui/WindowBase.h"
 
@@ -15,6 +18,15 @@ public:
     virtual void Setup(yakc& emu) override;
     /// draw method
     virtual bool Draw(yakc& emu) override;
+
+    /// number of events in a trace capture
+    static const int MaxTraceEvents = 64 * 1024;
+
+private:
+    /// draw the frame times
+    void drawFrameTimes(yakc& emu);
+
+    bool saveFailed = false;
 };
 
 } // namespace YAKC
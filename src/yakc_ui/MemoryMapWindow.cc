@@ -5,6 +5,7 @@
 #include "IMUI/IMUI.h"
 #include "Core/String/StringBuilder.h"
 #include "yakc_ui/UI.h"
+#include <math.h>
 
 using namespace Oryol;
 
@@ -13,6 +14,7 @@ namespace YAKC {
 static const int bank_height = 20;
 static const int left_padding = 80;
 static const int bank_div = 160;
+const float MemoryMapWindow::HeatDecay = 0.9f;
 
 //------------------------------------------------------------------------------
 void
@@ -20,6 +22,78 @@ MemoryMapWindow::Setup(yakc& emu) {
     this->setName("Memory Map");
 }
 
+//------------------------------------------------------------------------------
+static float
+delta(uint64_t cur, uint64_t last) {
+    // the counters may have been cleared since the last frame
+    return float(cur >= last ? cur - last : cur);
+}
+
+//------------------------------------------------------------------------------
+void
+MemoryMapWindow::updateHeat(const memory& mem) {
+    for (int i = 0; i < memory::num_pages; i++) {
+        const memory::page_counters& c = mem.counters[i];
+        memory::page_counters& last = this->lastCounters[i];
+        this->readHeat[i] = this->readHeat[i] * HeatDecay + delta(c.reads, last.reads);
+        this->writeHeat[i] = this->writeHeat[i] * HeatDecay + delta(c.writes, last.writes);
+        this->execHeat[i] = this->execHeat[i] * HeatDecay + delta(c.execs, last.execs);
+        last = c;
+    }
+}
+
+//------------------------------------------------------------------------------
+float
+MemoryMapWindow::getHeat(int page_index) const {
+    switch (this->heatMode) {
+        case access::read:  return this->readHeat[page_index];
+        case access::write: return this->writeHeat[page_index];
+        case access::exec:  return this->execHeat[page_index];
+        default:
+            return this->readHeat[page_index] + this->writeHeat[page_index] + this->execHeat[page_index];
+    }
+}
+
+//------------------------------------------------------------------------------
+void
+MemoryMapWindow::drawHeat(int layer, uword addr, unsigned int len, const char* tooltip) {
+    // log scale, full heat at 64K decayed accesses (about 6500 per frame)
+    static const float max_heat = log2f(float(1<<16));
+    const int h = bank_height;
+    const int y = layer * h;
+    const ImVec2 canvas_pos = ImGui::GetCursorScreenPos();
+    ImDrawList* l = ImGui::GetWindowDrawList();
+    // same inset as the memory rectangle
+    const float min_x = addr/bank_div + canvas_pos.x + left_padding + 3;
+    const float max_x = min_x + len/bank_div - 5;
+    const unsigned int end = addr + len;
+    for (unsigned int page_addr = addr; page_addr < end; page_addr += memory::page::size) {
+        const int page_index = page_addr >> memory::page::shift;
+        const float heat = this->getHeat(page_index);
+        float intensity = log2f(1.0f + heat) / max_heat;
+        if (intensity > 1.0f) {
+            intensity = 1.0f;
+        }
+        const float x0 = float(page_addr) / bank_div + canvas_pos.x + left_padding + 3;
+        const float x1 = float(page_addr + memory::page::size) / bank_div + canvas_pos.x + left_padding + 3;
+        ImVec2 a(x0 < min_x ? min_x : x0, y+canvas_pos.y+2);
+        ImVec2 b(x1 > max_x ? max_x : x1, a.y+h-4);
+        if (intensity > 0.0f) {
+            const ImVec4 color(1.0f, 1.0f - intensity, 0.0f, 0.25f + 0.75f * intensity);
+            l->AddRectFilled(a, b, ImGui::ColorConvertFloat4ToU32(color));
+        }
+        if (ImGui::IsMouseHoveringRect(a, b)) {
+            // the decayed heat is about 1/(1-decay) times the accesses per frame
+            ImGui::SetTooltip("%s\n%04X: %.0f reads, %.0f writes, %.0f execs per frame",
+                tooltip ? tooltip : "",
+                page_addr,
+                this->readHeat[page_index] * (1.0f - HeatDecay),
+                this->writeHeat[page_index] * (1.0f - HeatDecay),
+                this->execHeat[page_index] * (1.0f - HeatDecay));
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 void
 MemoryMapWindow::drawGrid(bool is_kc85_4) {
@@ -87,6 +161,9 @@ MemoryMapWindow::drawRect(int layer, uword addr, unsigned int len, const char* t
             ImGui::SetTooltip("%s", tooltip);
         }
     }
+    if (this->heatMap && (type::mapped == t)) {
+        this->drawHeat(layer, addr, len, tooltip);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -99,10 +176,27 @@ MemoryMapWindow::Draw(yakc& emu) {
     static const ImVec2 page_size(12, 0);
     bool is_kc85_4 = emu.model == device::kc85_4;
     bool is_kc85_2 = emu.model == device::kc85_2;
-    const float window_height = is_kc85_4 ? 220.0f : 120.0f;
+    const float window_height = is_kc85_4 ? 244.0f : 144.0f;
     ImGui::SetNextWindowSize(ImVec2(512.0f, window_height), ImGuiSetCond_Always);
     if (ImGui::Begin(this->title.AsCStr(), &this->Visible, ImGuiWindowFlags_NoResize|ImGuiWindowFlags_ShowBorders)) {
 
+        // the access heat map
+        memory& mem = emu.board.cpu.mem;
+        this->heatMap = mem.counting;
+        if (ImGui::Checkbox("Heat Map", &this->heatMap)) {
+            mem.set_counting(this->heatMap);
+        }
+        static const char* modes[] = { "All", "Read", "Write", "Exec" };
+        for (int i = 0; i < 4; i++) {
+            ImGui::SameLine();
+            if (ImGui::RadioButton(modes[i], int(this->heatMode) == i)) {
+                this->heatMode = access(i);
+            }
+        }
+        if (this->heatMap) {
+            this->updateHeat(mem);
+        }
+
         // draw the background grid
         this->drawGrid(is_kc85_4);
 
@@ -188,7 +282,6 @@ MemoryMapWindow::Draw(yakc& emu) {
 
         // modules
         for (int mem_layer = 1; mem_layer < 3; mem_layer++) {
-            const memory& mem = emu.board.cpu.mem;
             const ubyte slot_addr = mem_layer == 1 ? 0x08 : 0x0C;
             if (emu.kc85.exp.slot_occupied(slot_addr)) {
                 const int draw_layer = (is_kc85_4 ? 5 : 0) + mem_layer;
@@ -212,6 +305,10 @@ MemoryMapWindow::Draw(yakc& emu) {
         }
     }
     ImGui::End();
+    if (!this->Visible) {
+        // stop counting when the window is closed
+        emu.board.cpu.mem.set_counting(false);
+    }
     return this->Visible;
 }
 
@@ -3,6 +3,10 @@
 /**
     @class MemoryMapWindow
     @brief visualize the current memory map configuration
+
+    Optionally overlays the mapped banks with a heat map of the memory
+    accesses per 1 KByte page (counted by YAKC::memory), the heat
+    decays each frame, so that bank switching is visible.
 */
 #include "yakc_ui/WindowBase.h"
 
@@ -28,12 +32,35 @@ public:
         hidden,
     };
 
+    /// heat map display modes
+    enum class access {
+        all,
+        read,
+        write,
+        exec,
+    };
+    /// heat decay per frame
+    static const float HeatDecay;
+
+    /// update the decaying heat from the memory access counters
+    void updateHeat(const memory& mem);
+    /// get the heat of a page for the current display mode
+    float getHeat(int page_index) const;
+    /// draw the heat map over a mapped memory rectangle
+    void drawHeat(int layer, uword addr, unsigned int len, const char* tooltip);
     /// draw background grid
     void drawGrid(bool is_kc85_4);
     /// draw a 'memory rectangle'
     void drawRect(int layer, uword addr, unsigned int len, const char* tooltip, type t);
     /// get name for a memory layer and page
     pageInfo getPageInfo(kc85& kc, int layer_index, int page_index) const;
+
+    bool heatMap = false;
+    access heatMode = access::all;
+    memory::page_counters lastCounters[memory::num_pages];
+    float readHeat[memory::num_pages] = { };
+    float writeHeat[memory::num_pages] = { };
+    float execHeat[memory::num_pages] = { };
 };
 
 } // namespace YAKC
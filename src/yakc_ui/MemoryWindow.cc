@@ -3,6 +3,7 @@
 //------------------------------------------------------------------------------
 #include "MemoryWindow.h"
 #include "Input/Core/Key.h"
+#include "yakc/reverser.h"
 
 using namespace Oryol;
 
@@ -26,6 +27,9 @@ static void
 write_func(void* userdata, uword addr, ubyte value) {
     yakc* emu = (yakc*) userdata;
     emu->board.cpu.mem.w8(addr, value);
+    if (emu->reverse_debugger) {
+        emu->reverse_debugger->clear();
+    }
 }
 
 //------------------------------------------------------------------------------
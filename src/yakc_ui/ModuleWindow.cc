@@ -17,7 +17,8 @@ ModuleWindow::Setup(yakc& emu) {
 
 //------------------------------------------------------------------------------
 void
-ModuleWindow::drawModuleSlot(kc85& kc, ubyte slot_addr) {
+ModuleWindow::drawModuleSlot(yakc& emu, ubyte slot_addr) {
+    const kc85& kc = emu.kc85;
     ImGui::PushID(slot_addr);
     ImGui::AlignFirstTextHeightToWidgets();
     ImGui::Text("SLOT %02X:", slot_addr); ImGui::SameLine();
@@ -36,11 +37,7 @@ ModuleWindow::drawModuleSlot(kc85& kc, ubyte slot_addr) {
             if (kc.exp.is_module_registered(type)) {
                 const auto& mod = kc.exp.module_template(type);
                 if (ImGui::Selectable(mod.name)) {
-                    if (kc.exp.slot_occupied(slot_addr)) {
-                        kc.exp.remove_module(slot_addr, kc.board->cpu.mem);
-                    }
-                    kc.exp.insert_module(slot_addr, type);
-                    kc.board->cpu.out(slot_addr<<8|0x80, 0x00);
+                    emu.insert_module(slot_addr, type);
                 }
             }
         }
@@ -54,8 +51,8 @@ bool
 ModuleWindow::Draw(yakc& emu) {
     ImGui::SetNextWindowSize(ImVec2(384, 116), ImGuiSetCond_Once);
     if (ImGui::Begin(this->title.AsCStr(), &this->Visible, ImGuiWindowFlags_NoResize|ImGuiWindowFlags_ShowBorders)) {
-        this->drawModuleSlot(emu.kc85, 0x08);     // base device, right expansion slot
-        this->drawModuleSlot(emu.kc85, 0x0C);     // base device, left expansion slot
+        this->drawModuleSlot(emu, 0x08);     // base device, right expansion slot
+        this->drawModuleSlot(emu, 0x0C);     // base device, left expansion slot
         ImGui::TextWrapped("Hover over slot buttons to get help about inserted module!");
     }
     ImGui::End();
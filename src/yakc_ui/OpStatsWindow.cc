@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+//  OpStatsWindow.cc
+//------------------------------------------------------------------------------
+#include "OpStatsWindow.h"
+#include "IMUI/IMUI.h"
+
+using namespace Oryol;
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+void
+OpStatsWindow::Setup(yakc& emu) {
+    this->setName("Instruction Mix");
+}
+
+//------------------------------------------------------------------------------
+bool
+OpStatsWindow::Draw(yakc& emu) {
+    ImGui::SetNextWindowSize(ImVec2(460, 440), ImGuiSetCond_Once);
+    if (ImGui::Begin(this->title.AsCStr(), &this->Visible, ImGuiWindowFlags_ShowBorders)) {
+        opstats& ops = emu.board.ops;
+        ImGui::Checkbox("Enabled", &ops.enabled);
+        ImGui::SameLine();
+        if (ImGui::Button("Reset")) {
+            ops.reset();
+            this->totalCount = 0;
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Save")) {
+            ops.analyze();
+            this->saveFailed = !ops.write_file("yakc_opstats.txt");
+        }
+        if (this->saveFailed) {
+            ImGui::Text("failed to write yakc_opstats.txt");
+        }
+        if ((this->frameCount++ % UpdateInterval) == 0) {
+            ops.analyze();
+            this->totalCount = ops.num_instructions();
+        }
+        ImGui::Text("%llu instructions, %d opcodes", (unsigned long long) this->totalCount, ops.num_entries());
+        ImGui::Checkbox("All Tables", &this->showAll);
+        for (int i = 0; i < opstats::num_tables; i++) {
+            ImGui::SameLine();
+            const char* name = i == opstats::main_table ? "Main" : opstats::table_name(i);
+            if (ImGui::RadioButton(name, this->table == i)) {
+                this->table = i;
+            }
+        }
+        this->drawHistogram(emu);
+        ImGui::Separator();
+        this->drawEntries(emu);
+    }
+    ImGui::End();
+    return this->Visible;
+}
+
+//------------------------------------------------------------------------------
+void
+OpStatsWindow::drawHistogram(const yakc& emu) {
+    const opstats& ops = emu.board.ops;
+    float values[256];
+    for (int op = 0; op < 256; op++) {
+        values[op] = float(ops.get_count(this->table, op));
+    }
+    ImGui::PlotHistogram("##histogram", values, 256, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 60));
+}
+
+//------------------------------------------------------------------------------
+void
+OpStatsWindow::drawEntries(const yakc& emu) {
+    ImGui::BeginChild("##entries");
+    const opstats& ops = emu.board.ops;
+    const int num_entries = ops.num_entries();
+    for (int i = 0; i < num_entries; i++) {
+        const opstats::entry& e = ops.get_entry(i);
+        if (!this->showAll && (e.table != this->table)) {
+            continue;
+        }
+        const float percent = this->totalCount > 0 ? (100.0f * e.count) / this->totalCount : 0.0f;
+        const char* name = z80::op_name(e.table, e.op);
+        ImGui::Text("%6.2f%% %12llu %4s %02X %-16s", percent, (unsigned long long) e.count,
+            opstats::table_name(e.table), e.op, name ? name : "?");
+        if (opstats::is_conditional(e.table, e.op)) {
+            ImGui::SameLine();
+            ImGui::Text("%6.2f%% taken", (100.0f * e.taken) / e.count);
+        }
+    }
+    ImGui::EndChild();
+}
+
+} // namespace YAKC
@@ -0,0 +1,33 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class OpStatsWindow
+    @brief show the instruction mix of the emulated program
+*/
+#include "yakc_ui/WindowBase.h"
+
+namespace YAKC {
+
+class OpStatsWindow : public WindowBase {
+    OryolClassDecl(OpStatsWindow);
+public:
+    /// setup the window
+    virtual void Setup(yakc& emu) override;
+    /// draw method
+    virtual bool Draw(yakc& emu) override;
+
+    /// draw the histogram of an opcode table
+    void drawHistogram(const yakc& emu);
+    /// draw the executed instructions
+    void drawEntries(const yakc& emu);
+
+    /// re-analyze the counters every N frames
+    static const int UpdateInterval = 25;
+    int frameCount = 0;
+    uint64_t totalCount = 0;
+    int table = opstats::main_table;
+    bool showAll = true;
+    bool saveFailed = false;
+};
+
+} // namespace YAKC
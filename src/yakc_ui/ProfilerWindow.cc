@@ -0,0 +1,142 @@
+//------------------------------------------------------------------------------
+//  ProfilerWindow.cc
+//------------------------------------------------------------------------------
+#include "ProfilerWindow.h"
+#include "IMUI/IMUI.h"
+#include "yakc_oryol/Disasm.h"
+#include "yakc_ui/UI.h"
+
+using namespace Oryol;
+
+namespace YAKC {
+
+//------------------------------------------------------------------------------
+ProfilerWindow::ProfilerWindow(symbols* syms_) :
+syms(syms_) {
+    // empty
+}
+
+//------------------------------------------------------------------------------
+void
+ProfilerWindow::Setup(yakc& emu) {
+    this->setName("Profiler");
+}
+
+//------------------------------------------------------------------------------
+bool
+ProfilerWindow::Draw(yakc& emu) {
+    ImGui::SetNextWindowSize(ImVec2(460, 400), ImGuiSetCond_Once);
+    if (ImGui::Begin(this->title.AsCStr(), &this->Visible, ImGuiWindowFlags_ShowBorders)) {
+        profiler& prof = emu.board.prof;
+        callgraph& calls = emu.board.calls;
+        ImGui::Checkbox("Enabled", &prof.enabled);
+        ImGui::SameLine();
+        ImGui::Checkbox("Call Graph", &calls.enabled);
+        ImGui::SameLine();
+        if (ImGui::Button("Reset")) {
+            prof.reset();
+            calls.reset();
+            this->totalCycles = 0;
+            this->totalCallCycles = 0;
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Save")) {
+            this->saveFailed = !prof.write_file("yakc_profile.txt");
+            if (calls.num_nodes() > 0) {
+                this->saveFailed |= !calls.write_folded_file("yakc_calls.folded", this->syms);
+            }
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Load Symbols")) {
+            this->syms->clear();
+            this->numSymbols = this->syms->load_file("yakc.sym");
+        }
+        if (this->saveFailed) {
+            ImGui::Text("failed to write yakc_profile.txt or yakc_calls.folded");
+        }
+        if (this->numSymbols < 0) {
+            ImGui::Text("failed to read yakc.sym");
+        }
+        if ((this->frameCount++ % UpdateInterval) == 0) {
+            prof.analyze(emu.board.cpu.mem);
+            calls.analyze();
+            this->totalCycles = prof.total_cycles();
+            this->totalCallCycles = calls.total_cycles();
+        }
+        if (ImGui::RadioButton("Blocks", !this->showCalls)) {
+            this->showCalls = false;
+        }
+        ImGui::SameLine();
+        if (ImGui::RadioButton("Calls", this->showCalls)) {
+            this->showCalls = true;
+        }
+        ImGui::SameLine();
+        if (this->showCalls) {
+            ImGui::Text("%d targets, depth %d, %llu T-states", calls.num_targets(), calls.depth(),
+                (unsigned long long) this->totalCallCycles);
+        }
+        else {
+            ImGui::Text("%d blocks in %d pages, %llu T-states", prof.num_blocks(), prof.num_pages(),
+                (unsigned long long) this->totalCycles);
+        }
+        ImGui::Separator();
+        if (this->showCalls) {
+            this->drawCalls(emu);
+        }
+        else {
+            this->drawBlocks(emu);
+        }
+    }
+    ImGui::End();
+    return this->Visible;
+}
+
+//------------------------------------------------------------------------------
+void
+ProfilerWindow::drawBlocks(const yakc& emu) {
+    ImGui::BeginChild("##blocks");
+    const profiler& prof = emu.board.prof;
+    const int num_blocks = prof.num_blocks();
+    ImGuiListClipper clipper(num_blocks, ImGui::GetTextLineHeightWithSpacing());
+    Disasm disasm;
+    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+        const profiler::block& b = prof.get_block(i);
+        const float percent = this->totalCycles > 0 ? (100.0f * b.cycles) / this->totalCycles : 0.0f;
+        ImGui::Text("%6.2f%% %10llu %04X:%d %3d", percent, (unsigned long long) b.count,
+            b.addr, b.bank, b.num_instrs);
+        ImGui::SameLine();
+        if (prof.is_mapped(emu.board.cpu.mem, b)) {
+            disasm.Disassemble(emu, b.addr);
+            ImGui::Text("%s", disasm.Result());
+        }
+        else {
+            ImGui::PushStyleColor(ImGuiCol_Text, UI::DisabledColor);
+            ImGui::Text("(not mapped)");
+            ImGui::PopStyleColor();
+        }
+    }
+    clipper.End();
+    ImGui::EndChild();
+}
+
+//------------------------------------------------------------------------------
+void
+ProfilerWindow::drawCalls(const yakc& emu) {
+    ImGui::BeginChild("##calls");
+    const callgraph& calls = emu.board.calls;
+    const int num_targets = calls.num_targets();
+    ImGuiListClipper clipper(num_targets, ImGui::GetTextLineHeightWithSpacing());
+    char name[64];
+    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+        const callgraph::target& t = calls.get_target(i);
+        const uint64_t total = this->totalCallCycles;
+        const float incl = total > 0 ? (100.0f * t.incl_cycles) / total : 0.0f;
+        const float excl = total > 0 ? (100.0f * t.excl_cycles) / total : 0.0f;
+        callgraph::target_name(this->syms, t.addr, t.func, t.irq, name, sizeof(name));
+        ImGui::Text("%6.2f%% %6.2f%% %10llu %s", incl, excl, (unsigned long long) t.count, name);
+    }
+    clipper.End();
+    ImGui::EndChild();
+}
+
+} // namespace YAKC
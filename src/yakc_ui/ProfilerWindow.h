@@ -0,0 +1,37 @@
+#pragma once
+//------------------------------------------------------------------------------
+/**
+    @class ProfilerWindow
+    @brief show the hot spots and call targets of the emulated program, sorted by cost
+*/
+#include "yakc_ui/WindowBase.h"
+
+namespace YAKC {
+
+class ProfilerWindow : public WindowBase {
+    OryolClassDecl(ProfilerWindow);
+public:
+    /// constructor
+    ProfilerWindow(symbols* syms);
+    /// setup the window
+    virtual void Setup(yakc& emu) override;
+    /// draw method
+    virtual bool Draw(yakc& emu) override;
+
+    /// draw the basic blocks
+    void drawBlocks(const yakc& emu);
+    /// draw the call targets
+    void drawCalls(const yakc& emu);
+
+    /// re-analyze the counters every N frames
+    static const int UpdateInterval = 25;
+    symbols* syms;
+    int frameCount = 0;
+    uint64_t totalCycles = 0;
+    uint64_t totalCallCycles = 0;
+    bool showCalls = false;
+    bool saveFailed = false;
+    int numSymbols = 0;
+};
+
+} // namespace YAKC
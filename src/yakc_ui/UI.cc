@@ -16,10 +16,14 @@
 #include "AudioWindow.h"
 #include "KC85IOWindow.h"
 #include "InfoWindow.h"
+#include "ProfilerWindow.h"
+#include "OpStatsWindow.h"
 #include "Core/Time/Clock.h"
 #include "Input/Input.h"
 #include "Core/String/StringBuilder.h"
 #include "yakc/roms/roms.h"
+#include "yakc/rewinder.h"
+#include "yakc/reverser.h"
 
 using namespace Oryol;
 
@@ -352,6 +356,12 @@ UI::OnFrame(yakc& emu) {
                 if (ImGui::MenuItem("Memory Editor")) {
                     this->OpenWindow(emu, MemoryWindow::Create());
                 }
+                if (ImGui::MenuItem("Profiler")) {
+                    this->OpenWindow(emu, ProfilerWindow::Create(&this->Symbols));
+                }
+                if (ImGui::MenuItem("Instruction Mix")) {
+                    this->OpenWindow(emu, OpStatsWindow::Create());
+                }
                 if (emu.is_device(device::any_kc85)) {
                     if (ImGui::MenuItem("Scan for Commands...")) {
                         this->OpenWindow(emu, CommandWindow::Create());
@@ -373,12 +383,82 @@ UI::OnFrame(yakc& emu) {
                                 strBuilder.Format(32, "Snapshot %d", i);
                                 if (ImGui::MenuItem(strBuilder.AsCStr())) {
                                     this->snapshotStorage.ApplySnapshot(i, emu);
+                                    if (emu.reverse_debugger) {
+                                        emu.reverse_debugger->clear();
+                                    }
                                 }
                             }
                         }
                         ImGui::EndMenu();
                     }
                 }
+                if (emu.rewind_buffer) {
+                    if (ImGui::BeginMenu("Rewind")) {
+                        rewinder* rw = emu.rewind_buffer;
+                        ImGui::Text("%d frames (%d KBytes)", rw->num_frames(), rw->num_bytes() / 1024);
+                        const int steps[] = { 1, 10, 100 };
+                        for (int num_steps : steps) {
+                            strBuilder.Format(32, "Step Back %d Frame%s", num_steps, num_steps > 1 ? "s" : "");
+                            if (ImGui::MenuItem(strBuilder.AsCStr(), nullptr, false, rw->num_frames() > 1)) {
+                                for (int i = 0; i < num_steps; i++) {
+                                    if (!rw->step_back(emu)) {
+                                        break;
+                                    }
+                                }
+                                if (emu.reverse_debugger) {
+                                    emu.reverse_debugger->clear();
+                                }
+                            }
+                        }
+                        ImGui::EndMenu();
+                    }
+                }
+                if (ImGui::BeginMenu("Input Movie")) {
+                    movie& mv = this->Movie;
+                    if (mv.recording()) {
+                        ImGui::Text("recording: %d frames (%d bytes)", mv.num_frames(), mv.log_size());
+                        if (ImGui::MenuItem("Stop Recording")) {
+                            mv.stop_recording(emu);
+                        }
+                    }
+                    else if (this->MovieReplay) {
+                        ImGui::Text("replaying: frame %d of %d", mv.replay_pos(), mv.num_frames());
+                        if (mv.num_desyncs() > 0) {
+                            ImGui::TextColored(UI::WarnColor, "%d desyncs!", mv.num_desyncs());
+                        }
+                        if (ImGui::MenuItem("Stop Replay")) {
+                            this->MovieReplay = false;
+                        }
+                    }
+                    else {
+                        if (ImGui::MenuItem("Start Recording", nullptr, false, emu.switchedon())) {
+                            this->MovieReplay = false;
+                            mv.start_recording(emu);
+                        }
+                        if (mv.valid()) {
+                            strBuilder.Format(64, "Replay (%d frames)", mv.num_frames());
+                            if (ImGui::MenuItem(strBuilder.AsCStr())) {
+                                this->MovieReplay = mv.start_replay(emu);
+                            }
+                        }
+                    }
+                    ImGui::EndMenu();
+                }
+                if (ImGui::BeginMenu("Code Coverage")) {
+                    coverage& cov = emu.board.cov;
+                    for (int i = 0; i < cov.num_banks(); i++) {
+                        ImGui::Text("%-10s %5d of %5d bytes executed", cov.bank_name(i),
+                            cov.count(i, coverage::exec), cov.bank_size(i));
+                    }
+                    ImGui::MenuItem("Record", nullptr, &cov.enabled);
+                    if (ImGui::MenuItem("Reset")) {
+                        cov.reset();
+                    }
+                    if (ImGui::MenuItem("Save Regions", nullptr, false, cov.num_banks() > 0)) {
+                        cov.write_file("yakc_coverage.txt");
+                    }
+                    ImGui::EndMenu();
+                }
                 ImGui::EndMenu();
             }
             if (ImGui::BeginMenu("Settings")) {
@@ -389,8 +469,20 @@ UI::OnFrame(yakc& emu) {
                     this->Settings.colorTV = !this->Settings.colorTV;
                 }
                 ImGui::SliderFloat("CRT Warp", &this->Settings.crtWarp, 0.0f, 1.0f/16.0f);
-                // FIXME: speed multiplier currently not working
-                //ImGui::SliderInt("CPU Speed", &this->Settings.cpuSpeed, 1, 8, "%.0fx");
+                ImGui::SliderInt("CPU Speed", &this->Settings.cpuSpeed, 1, 8, "%.0fx");
+                if (ImGui::MenuItem("Warp (max speed)", nullptr, this->Settings.warp)) {
+                    this->Settings.warp = !this->Settings.warp;
+                }
+                if (ImGui::MenuItem("Rewind Buffer", nullptr, this->Settings.rewind)) {
+                    this->Settings.rewind = !this->Settings.rewind;
+                }
+                if (ImGui::MenuItem("Reverse Debugging", nullptr, this->Settings.reverseDebug)) {
+                    this->Settings.reverseDebug = !this->Settings.reverseDebug;
+                }
+                ImGui::SliderInt("Run-Ahead Frames", &this->Settings.runAhead, 0, 4);
+                if (this->Settings.runAhead > 0) {
+                    ImGui::Text("emu: %.2fms, run-ahead: %.2fms", this->FrameTimes.emu, this->FrameTimes.runAhead);
+                }
                 if (ImGui::MenuItem("Reset To Defaults")) {
                     this->Settings = settings();
                 }
@@ -8,6 +8,8 @@
 #include "yakc_ui/WindowBase.h"
 #include "yakc_oryol/FileLoader.h"
 #include "yakc_oryol/SnapshotStorage.h"
+#include "yakc/movie.h"
+#include "yakc/symbols.h"
 #include "Core/Time/TimePoint.h"
 #include "Core/Containers/Array.h"
 #include "IMUI/IMUI.h"
@@ -49,8 +51,25 @@ public:
         bool colorTV = true;
         float crtWarp = 1.0f/64.0f;
         int cpuSpeed = 1;
+        bool warp = false;
+        bool rewind = true;
+        bool reverseDebug = true;
+        int runAhead = 0;
     } Settings;
 
+    /// smoothed host time spent in emulation per frame (ms), written by app
+    struct frameTimes {
+        double emu = 0.0;
+        double runAhead = 0.0;
+    } FrameTimes;
+
+    /// an in-memory input movie, recorded and replayed from the Debugging menu
+    movie Movie;
+    /// true while replaying the movie, the app calls movie::replay_frame() instead of yakc::onframe()
+    bool MovieReplay = false;
+    /// symbol names for the profiler, loaded from a text file
+    symbols Symbols;
+
 private:
     FileLoader fileLoader;
     SnapshotStorage snapshotStorage;
@@ -10,6 +10,10 @@
 #include "IO/IO.h"
 #include "HTTP/HTTPFileSystem.h"
 #include "yakc/yakc.h"
+#include "yakc/bootcache.h"
+#include "yakc/rewinder.h"
+#include "yakc/runahead.h"
+#include "yakc/reverser.h"
 #include "yakc_oryol/Draw.h"
 #include "yakc_oryol/Audio.h"
 #include "yakc_oryol/Keyboard.h"
@@ -29,6 +33,10 @@ public:
     void initModules();
 
     yakc emu;
+    bootcache bootCache;
+    rewinder rewindBuffer;
+    reverser reverseDebugger;
+    runahead runAhead;
     Draw draw;
     Audio audio;
     Keyboard keyboard;
@@ -36,6 +44,7 @@ public:
     UI ui;
     #endif
     TimePoint lapTimePoint;
+    bool warp = false;
 };
 OryolMain(YakcApp);
 
@@ -86,7 +95,13 @@ YakcApp::OnInit() {
     // initialize the ROM dumps and modules
     this->initRoms();
 
-    // switch the emulator on
+    // on KC85/3 put a 16kByte module into slot 8 by default, CAOS will initialize
+    // this automatically on startup
+    this->initModules();
+    this->emu.kc85.exp.insert_module(0x08, kc85_exp::m022_16kbyte);
+
+    // switch the emulator on, further power-ons will skip the OS boot sequence
+    this->emu.boot_cache = &this->bootCache;
     this->emu.poweron(device::kc85_3, os_rom::caos_3_1);
 
     this->draw.Setup(gfxSetup, frameSizeX, frameSizeY);
@@ -96,13 +111,6 @@ YakcApp::OnInit() {
     this->ui.Setup(this->emu, &this->audio);
     #endif
 
-    // on KC85/3 put a 16kByte module into slot 8 by default, CAOS will initialize
-    // this automatically on startup
-    this->initModules();
-    if (this->emu.kc85.on) {
-        this->emu.kc85.exp.insert_module(0x08, kc85_exp::m022_16kbyte);
-    }
-
     this->lapTimePoint = Clock::Now();
 
     return AppState::Running;
@@ -122,8 +130,9 @@ YakcApp::OnRunning() {
     if (Input::KeyDown(Key::Tab)) {
         this->ui.Toggle();
     }
-    // don't handle KC input if IMGUI has the keyboard focus
-    if (!ImGui::GetIO().WantCaptureKeyboard) {
+    // don't handle KC input if IMGUI has the keyboard focus, or
+    // while replaying recorded input
+    if (!ImGui::GetIO().WantCaptureKeyboard && !this->ui.MovieReplay) {
         this->keyboard.HandleInput();
     }
     #else
@@ -135,32 +144,121 @@ YakcApp::OnRunning() {
     clear.w = 1.0f;
     Gfx::ApplyDefaultRenderTarget(ClearState::ClearColor(clear));
     int micro_secs = (int) frameTime.AsMicroSeconds();
-    uint64_t min_cycle_count = 0;
-    uint64_t max_cycle_count = 0;
-    const uint64_t audio_cycle_count = this->audio.GetProcessedCycles();
-    if (audio_cycle_count > 0) {
-        const uint64_t cpu_min_ahead_cycles = (this->emu.board.clck.base_freq_khz*1000)/100;
-        const uint64_t cpu_max_ahead_cycles = (this->emu.board.clck.base_freq_khz*1000)/25;
-        min_cycle_count = audio_cycle_count + cpu_min_ahead_cycles;
-        max_cycle_count = audio_cycle_count + cpu_max_ahead_cycles;
+
+    // record each frame into the rewind buffer (only useful with the UI)
+    #if YAKC_UI
+    if (this->ui.Settings.rewind) {
+        this->emu.rewind_buffer = &this->rewindBuffer;
+    }
+    else if (this->emu.rewind_buffer) {
+        this->emu.rewind_buffer = nullptr;
+        this->rewindBuffer.clear();
     }
+    // log frames and input for stepping back in the debugger
+    if (this->ui.Settings.reverseDebug) {
+        this->emu.reverse_debugger = &this->reverseDebugger;
+    }
+    else if (this->emu.reverse_debugger) {
+        this->emu.reverse_debugger = nullptr;
+        this->reverseDebugger.clear();
+    }
+    #endif
 
+    // in warp mode the CPU runs decoupled from audio playback (which is
+    // muted), when leaving warp mode the audio playback position is
+    // resynced to the CPU, so that the limiter below starts fresh
     #if YAKC_UI
-        o_trace_begin(yakc_kc);
+    const int speed_multiplier = this->ui.Settings.cpuSpeed;
+    const bool max_speed = this->ui.Settings.warp;
+    const bool warp = max_speed || (speed_multiplier > 1);
+    #else
+    // without UI, always run at 1x inside the audio limiter: the rate
+    // controller keeps the CPU in sync, a higher multiplier would only
+    // saturate at max_cycle_count every frame (the old onframe(2, ...)
+    // relied on that clamping)
+    const int speed_multiplier = 1;
+    const bool max_speed = false;
+    const bool warp = false;
+    #endif
+    if (warp != this->warp) {
+        if (warp) {
+            this->audio.BeginWarp();
+        }
+        else {
+            this->audio.EndWarp(this->emu.cycle_count());
+        }
+        this->warp = warp;
+    }
+
+    o_trace_begin(yakc_kc);
+    const TimePoint emuStart = Clock::Now();
+    #if YAKC_UI
+    const bool movieReplay = this->ui.MovieReplay;
+    #else
+    const bool movieReplay = false;
+    #endif
+    if (movieReplay) {
+        // replayed frames run to the recorded cycle count, not host time
+        #if YAKC_UI
+        if (!this->ui.Movie.replay_frame(this->emu)) {
+            this->ui.MovieReplay = false;
+        }
+        #endif
+    }
+    else if (warp) {
+        if (max_speed) {
+            // run as fast as possible, but leave some frame time to the host
+            const double budget = frameTime.AsMilliSeconds() * 0.75;
+            const TimePoint start = Clock::Now();
+            do {
+                this->emu.onframe(speed_multiplier, micro_secs, 0, 0);
+            }
+            while (!this->emu.board.dbg.paused && (Clock::Since(start).AsMilliSeconds() < budget));
+        }
+        else {
+            this->emu.onframe(speed_multiplier, micro_secs, 0, 0);
+        }
+    }
+    else {
         // keep CPU synchronized to a small time window ahead of audio playback
-        this->emu.onframe(this->ui.Settings.cpuSpeed, micro_secs, min_cycle_count, max_cycle_count);
+        const clock& clk = this->emu.board.clck;
+        const int synced_micro_secs = this->audio.RateControl(micro_secs, this->emu.cycle_count(), clk);
+        uint64_t min_cycle_count = 0;
+        uint64_t max_cycle_count = 0;
+        this->audio.CycleLimits(clk, min_cycle_count, max_cycle_count);
+        this->emu.onframe(speed_multiplier, synced_micro_secs, min_cycle_count, max_cycle_count);
+    }
+    o_trace_end();
+
+    // optionally run a few frames ahead and display the future frame, this
+    // hides the input latency of programs which react to keys late
+    #if YAKC_UI
+    const double emuTime = Clock::Since(emuStart).AsMilliSeconds();
+    double runAheadTime = 0.0;
+    if (!warp && !movieReplay) {
+        o_trace_begin(yakc_runahead);
+        this->runAhead.num_frames = this->ui.Settings.runAhead;
+        const TimePoint runAheadStart = Clock::Now();
+        if (this->runAhead.run(this->emu, micro_secs)) {
+            runAheadTime = Clock::Since(runAheadStart).AsMilliSeconds();
+        }
         o_trace_end();
-        this->draw.UpdateParams(
-            this->ui.Settings.crtEffect,
-            this->ui.Settings.colorTV,
-            glm::vec2(this->ui.Settings.crtWarp));
+    }
+    this->ui.FrameTimes.emu += (emuTime - this->ui.FrameTimes.emu) * 0.05;
+    this->ui.FrameTimes.runAhead += (runAheadTime - this->ui.FrameTimes.runAhead) * 0.05;
+    #endif
+
+    #if YAKC_UI
+    this->draw.UpdateParams(
+        this->ui.Settings.crtEffect,
+        this->ui.Settings.colorTV,
+        glm::vec2(this->ui.Settings.crtWarp));
     #else
-        o_trace_begin(yakc_kc);
-        this->emu.onframe(2, micro_secs, min_cycle_count, max_cycle_count);
-        o_trace_end();
-        this->draw.UpdateParams(true, true, glm::vec2(1.0f/64.0f));
+    this->draw.UpdateParams(true, true, glm::vec2(1.0f/64.0f));
     #endif
     this->audio.Update(this->emu.board.clck);
+    frametimes& times = this->emu.board.times;
+    times.begin(frametimes::render);
     if (this->emu.kc85.on) {
         this->draw.Render(this->emu.kc85.video.rgba8_buffer, 320, 256);
     }
@@ -170,9 +268,13 @@ YakcApp::OnRunning() {
     else if (this->emu.z1013.on) {
         this->draw.Render(this->emu.z1013.rgba8_buffer, 256, 256);
     }
+    times.end();
     #if YAKC_UI
+    times.begin(frametimes::ui);
     this->ui.OnFrame(this->emu);
+    times.end();
     #endif
+    times.next_frame();
     Gfx::CommitFrame();
     return Gfx::QuitRequested() ? AppState::Cleanup : AppState::Running;
 }